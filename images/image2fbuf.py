@@ -16,23 +16,95 @@
 import imageio
 import sys
 
-input_file = sys.argv[1]
-name = input_file.split(".")[0]
-output_file = name+".h"
-
-im = imageio.imread(input_file)
-h, w, c = im.shape
-
-pixels = []
-for y in range(h):
-  for x in range(w):
-    r, g, b = im[y][x][:3]
-    color = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
-    color = (color >> 8 | color << 8) & 0xffff;
-    pixels.append("0x%04x"%color)
-pixels = ",\n".join(pixels)
-contents = "static const uint16_t %s[] = {%s};"%(name, pixels)
-
-with open(output_file, "w") as outf:
-  outf.write(contents);
-     
+def read_pixels(input_file):
+  """RGB565 pixels, not yet byte swapped for the display"""
+  im = imageio.imread(input_file)
+  h, w, c = im.shape
+
+  pixels = []
+  for y in range(h):
+    for x in range(w):
+      r, g, b = [int(i) for i in im[y][x][:3]]
+      color = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+      pixels.append(color)
+  return w, h, pixels
+
+def swap(color):
+  return (color >> 8 | color << 8) & 0xffff
+
+def color_hash(color):
+  """must match image_decoder.cpp"""
+  return ((color >> 11)*3 + ((color >> 5) & 0x3f)*5 + (color & 0x1f)*7) & 0x3f
+
+def compress(pixels):
+  """Compress RGB565 pixels, the format is decoded by image_decoder.cpp
+
+  Each op is one byte, the top two bits select:
+    00nnnnnn run, repeat the previous pixel n+1 times
+    01iiiiii index, a recently seen pixel from a 64 entry hash table
+    10rrggbb diff, red, green and blue each change by -2..1 from the previous pixel
+    11nnnnnn literal, n+1 byte swapped pixels follow, 2 bytes each
+  The previous pixel starts as black.
+  """
+  output = bytearray()
+  previous = 0
+  table = [0]*64
+  literals = []
+
+  def flush_literals():
+    while literals:
+      n = min(64, len(literals))
+      output.append(0xc0 | (n-1))
+      for color in literals[:n]:
+        output.extend(swap(color).to_bytes(2, "little"))
+      del literals[:n]
+
+  idx = 0
+  while idx < len(pixels):
+    color = pixels[idx]
+
+    if color == previous:
+      n = 1
+      while idx+n < len(pixels) and pixels[idx+n] == color and n < 64:
+        n += 1
+      flush_literals()
+      output.append(n-1)
+      idx += n
+      continue
+
+    h = color_hash(color)
+    dr = (color >> 11) - (previous >> 11)
+    dg = ((color >> 5) & 0x3f) - ((previous >> 5) & 0x3f)
+    db = (color & 0x1f) - (previous & 0x1f)
+    if table[h] == color:
+      flush_literals()
+      output.append(0x40 | h)
+    elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+      flush_literals()
+      output.append(0x80 | ((dr+2) << 4) | ((dg+2) << 2) | (db+2))
+    else:
+      literals.append(color)
+
+    table[h] = color
+    previous = color
+    idx += 1
+
+  flush_literals()
+  return bytes(output)
+
+if __name__ == "__main__":
+  input_file = sys.argv[1]
+  compressed = "--compress" in sys.argv[2:]
+  name = input_file.split(".")[0]
+  output_file = name+".h"
+
+  w, h, pixels = read_pixels(input_file)
+  if compressed:
+    data = ",\n".join("0x%02x"%i for i in compress(pixels))
+    contents = "//%ux%u, decode with c_image_decoder\nstatic const uint8_t %s[] = {%s};"%(w, h, name, data)
+  else:
+    data = ",\n".join("0x%04x"%swap(color) for color in pixels)
+    contents = "static const uint16_t %s[] = {%s};"%(name, data)
+
+  with open(output_file, "w") as outf:
+    outf.write(contents);
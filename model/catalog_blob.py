@@ -0,0 +1,62 @@
+import os
+import struct
+
+#Sections are written by the individual generator scripts, then packed into
+#a single blob by make_catalog_blob.py. A section file is its 4 character id,
+#a uint32 record count, then the records exactly as the C++ structs lay them
+#out (see pico_planetarium/catalog_blob.h).
+
+def write_section(filename, section_id, record_format, records):
+  """pack records with a struct format and write them as a section file"""
+  os.makedirs(os.path.dirname(filename) or ".", exist_ok=True)
+  with open(filename, "wb") as output_file:
+    output_file.write(struct.pack("<4sI", section_id.encode(), len(records)))
+    for record in records:
+      output_file.write(struct.pack(record_format, *record))
+
+def read_section(filename):
+  """return id, count and raw record bytes of a section file"""
+  with open(filename, "rb") as input_file:
+    data = input_file.read()
+  section_id, count = struct.unpack("<4sI", data[:8])
+  return section_id, count, data[8:]
+
+def align(offset, alignment=16):
+  return (offset + alignment - 1) // alignment * alignment
+
+def pack_blob(sections, version=1):
+  """sections is a list of (id, count, data), data is aligned to 16 bytes"""
+  header_size = 16 + 16*len(sections)
+  offset = align(header_size)
+  table = []
+  for section_id, count, data in sections:
+    table.append((section_id, offset, len(data), count))
+    offset = align(offset + len(data))
+  size = offset
+
+  blob = bytearray(struct.pack("<4sHHII", b"PLNB", version, len(sections), size, 0))
+  for entry in table:
+    blob += struct.pack("<4sIII", *entry)
+  for (section_id, count, data), (_, offset, _, _) in zip(sections, table):
+    blob += b"\0"*(offset - len(blob))
+    blob += data
+  blob += b"\0"*(size - len(blob))
+  return bytes(blob)
+
+def write_blob(filename, sections, version=1):
+  """a blob as a file, render_server maps one in place of the built in blob
+  with --blob"""
+  with open(filename, "wb") as output_file:
+    output_file.write(pack_blob(sections, version))
+
+def write_blob_source(filename, blob):
+  """write a blob as a C++ array, so the sketch builds it into flash with no
+  extra build settings"""
+  with open(filename, "w") as output_file:
+    output_file.write("//generated by model/make_catalog_blob.py, do not edit\n")
+    output_file.write("#include \"catalog_blob.h\"\n\n")
+    output_file.write("alignas(16) const uint8_t catalog_blob_data[%u] = {\n" % len(blob))
+    for offset in range(0, len(blob), 16):
+      output_file.write(",".join("0x%02x" % byte for byte in blob[offset:offset+16]) + ",\n")
+    output_file.write("};\n")
+    output_file.write("const uint32_t catalog_blob_size = sizeof(catalog_blob_data);\n")
@@ -0,0 +1,49 @@
+import glob
+import os
+import struct
+import sys
+from catalog_blob import read_section, pack_blob, write_blob_source, align
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "images"))
+from image2fbuf import read_pixels, compress
+
+#Packs the sections written by make_star_list.py and
+#make_constellation_lines.py, and the images, into catalog_blob_data.cpp, a
+#C++ array built into both the firmware and the host tests. Run from the
+#model directory.
+
+images = [
+  "mercury", "venus", "mars", "jupiter", "saturn", "uranus", "neptune",
+  "sun", "moon", "splash_320x240", "splash_480x320", "skyline",
+]
+
+def read_image(filename):
+  """compressed as image2fbuf.py --compress"""
+  w, h, pixels = read_pixels(filename)
+  return w, h, compress(pixels)
+
+sections = [read_section(filename) for filename in sorted(glob.glob("sections/*.bin"))]
+
+#the image table holds absolute offsets, so work out where the image data
+#section will land: it is placed last, after the image table
+num_sections = len(sections) + 2
+offset = align(16 + 16*num_sections)
+for section_id, count, data in sections:
+  offset = align(offset + len(data))
+image_data = [read_image("../images/%s.png"%name) for name in images]
+table_size = 28*len(images)
+data_offset = align(offset + table_size)
+
+table = b""
+image_bytes = b""
+for name, (width, height, data) in zip(images, image_data):
+  table += struct.pack("<16sHHII", name.encode(), width, height, data_offset + len(image_bytes), len(data))
+  image_bytes += data
+
+sections.append((b"IMGS", len(images), table))
+sections.append((b"IMGD", len(image_bytes), image_bytes))
+blob = pack_blob(sections, version=2)
+write_blob_source("../pico_planetarium/catalog_blob_data.cpp", blob)
+
+for section_id, count, data in sections:
+  print("%s %6u records %8u bytes"%(section_id.decode(), count, len(data)))
+print("%u bytes"%len(blob))
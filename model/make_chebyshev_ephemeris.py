@@ -0,0 +1,123 @@
+import argparse
+import itertools
+import numpy as np
+from numpy.polynomial import chebyshev
+from jplephem.spk import SPK
+
+AU_KM = 149597870.700
+ARCSEC = np.pi/180/3600
+
+#closest approach to the Earth in AU, where a position error is largest on
+#the screen. The Earth is fitted as the Earth-Moon barycentre, the planetarium
+#adds the monthly wobble from the Moon's position, and its error moves every
+#body, so it is held to the budget at the distance of Venus.
+bodies = [
+  ("Mercury", 1, 0.52),
+  ("Venus", 2, 0.26),
+  ("Earth", 3, 0.26),
+  ("Mars", 4, 0.37),
+  ("Jupiter", 5, 3.93),
+  ("Saturn", 6, 7.99),
+  ("Uranus", 7, 17.2),
+  ("Neptune", 8, 28.7),
+]
+
+#candidate segment lengths (days) and numbers of coefficients, each body
+#gets the smallest table that meets the error budget
+segment_lengths = [8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096]
+coefficient_counts = range(4, 21)
+
+def calendar_to_jd(year, month=1, day=1):
+  """julian date at 0h UTC, same formula as the planetarium"""
+  if month <= 2:
+    year -= 1
+    month += 12
+  a = year // 100
+  b = 2 - a + a // 4
+  return int(365.25 * (year + 4716)) + int(30.6001 * (month + 1)) + day + b - 1524.5
+
+def heliocentric(kernel, body, jd):
+  """heliocentric equatorial position in AU of a planet (or the Earth-Moon barycentre)"""
+  jd = np.asarray(jd)
+  position = kernel[0, body].compute(jd) - kernel[0, 10].compute(jd)
+  return position / AU_KM
+
+def fit_body(kernel, body, start_jd, num_segments, segment_days, num_coefficients, max_allowed):
+  """fit Chebyshev coefficients at the Chebyshev nodes of each segment, gives
+  up early once the error is over max_allowed AU"""
+  nodes = np.cos(np.pi * (np.arange(num_coefficients) + 0.5) / num_coefficients)
+  check = np.linspace(-1, 1, 4 * num_coefficients + 1)
+  coefficients = []
+  max_error = 0
+  for segment in range(num_segments):
+    segment_start = start_jd + segment * segment_days
+    jd = segment_start + (nodes + 1) * segment_days / 2
+    position = heliocentric(kernel, body, jd)
+    segment_coefficients = [chebyshev.chebfit(nodes, position[axis], num_coefficients - 1) for axis in range(3)]
+    coefficients.append(segment_coefficients)
+
+    #error of the single precision coefficients the device will use
+    expected = heliocentric(kernel, body, segment_start + (check + 1) * segment_days / 2)
+    fitted = np.array([chebyshev.chebval(check, np.float32(segment_coefficients[axis])) for axis in range(3)])
+    max_error = max(max_error, np.max(np.linalg.norm(fitted - expected, axis=0)))
+    if max_error > max_allowed:
+      break
+  return coefficients, max_error
+
+def choose_fit(kernel, body, start_jd, end_jd, max_allowed):
+  """smallest segment length and number of coefficients within max_allowed AU"""
+  candidates = []
+  for segment_days, num_coefficients in itertools.product(segment_lengths, coefficient_counts):
+    num_segments = int(np.ceil((end_jd - start_jd) / segment_days))
+    candidates.append((num_segments * 3 * num_coefficients * 4, segment_days, num_segments, num_coefficients))
+  for size, segment_days, num_segments, num_coefficients in sorted(candidates):
+    coefficients, max_error = fit_body(kernel, body, start_jd, num_segments, segment_days, num_coefficients, max_allowed)
+    if max_error <= max_allowed:
+      return size, segment_days, num_segments, num_coefficients, coefficients, max_error
+  raise ValueError("no fit is within %.3g AU" % max_allowed)
+
+parser = argparse.ArgumentParser(description="fit Chebyshev planet ephemeris tables")
+parser.add_argument("--kernel", default="de440s.bsp", help="JPL SPK kernel, e.g. de440s.bsp")
+parser.add_argument("--start", type=int, default=1990, help="first year")
+parser.add_argument("--end", type=int, default=2060, help="last year (inclusive)")
+parser.add_argument("--field", type=float, default=2.0, help="narrowest field of view in degrees")
+parser.add_argument("--pixels", type=int, default=320, help="display width in pixels")
+parser.add_argument("--output", default="../pico_planetarium/chebyshev_ephemeris.cpp")
+args = parser.parse_args()
+
+kernel = SPK.open(args.kernel)
+start_jd = calendar_to_jd(args.start)
+end_jd = calendar_to_jd(args.end + 1)
+
+#half a pixel at the narrowest field of view
+budget = 0.5 * args.field * 3600 / args.pixels
+print("error budget %.1f arcsec" % budget)
+
+definitions = []
+total = 0
+for name, body, closest in bodies:
+  size, segment_days, num_segments, num_coefficients, coefficients, max_error = choose_fit(
+    kernel, body, start_jd, end_jd, budget * ARCSEC * closest)
+  print("%-8s %4u days x %2u coefficients, %5u segments, %6u bytes, max error %.2e AU, %.1f arcsec" % (
+    name, segment_days, num_coefficients, num_segments, size, max_error, max_error / closest / ARCSEC))
+  total += size
+
+  values = []
+  for segment in coefficients:
+    for axis in segment:
+      values.append(", ".join("%.9g" % value for value in axis))
+  definitions.append((name, segment_days, num_segments, num_coefficients, values))
+
+print("total %u bytes (%.0f KB) of flash" % (total, total / 1024))
+
+with open(args.output, "w") as output_file:
+  output_file.write("#include \"chebyshev_ephemeris.h\"\n\n")
+  output_file.write("//generated by model/make_chebyshev_ephemeris.py from %s, %u to %u\n\n" % (args.kernel, args.start, args.end))
+  for name, segment_days, num_segments, num_coefficients, values in definitions:
+    output_file.write("static const float %s_coefficients[] = {\n" % name.lower())
+    output_file.write(",\n".join("  " + line for line in values))
+    output_file.write("\n};\n\n")
+  output_file.write("const s_chebyshev_body chebyshev_bodies[8] = {\n")
+  for name, segment_days, num_segments, num_coefficients, values in definitions:
+    output_file.write("  {%.1f, %u, %u, %u, %s_coefficients},\n" % (start_jd, segment_days, num_segments, num_coefficients, name.lower()))
+  output_file.write("};\n")
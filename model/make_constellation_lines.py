@@ -3,6 +3,10 @@ import numpy as np
 import math
 from math import tan, sin, cos, asin, atan2, radians, degrees
 from datetime import datetime, timezone
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.abspath(__file__)))
+from catalog_blob import write_section
 
 def hhmmss_to_deg(hh, mm, ss):
   """convert hours, minutes and seconds to degrees"""
@@ -59,6 +63,15 @@ def read_stars():
 
   return stars
 
+def bounding_cone(p1, p2):
+  """unit vector to the midpoint of a line, and the cos/sin of its half-angle"""
+  mx, my, mz = [a+b for a, b in zip(p1, p2)]
+  r = math.sqrt(mx*mx + my*my + mz*mz)
+  mx, my, mz = mx/r, my/r, mz/r
+  cos_half = p1[0]*mx + p1[1]*my + p1[2]*mz
+  sin_half = math.sqrt(max(0.0, 1.0 - cos_half*cos_half))
+  return mx, my, mz, cos_half, sin_half
+
 def read_constellations(stars):
   with open("constellations") as input_file:
     data = input_file.read()
@@ -69,7 +82,7 @@ def read_constellations(stars):
     points = [stars[int(number)][:3] for number in line.split()[2:]]
     last_point = points[0]
     for point in points[1:]:
-      clines.append(last_point+point) 
+      clines.append(last_point+point+bounding_cone(last_point, point))
       last_point = point
 
   return clines
@@ -77,14 +90,5 @@ def read_constellations(stars):
 stars = read_stars()
 clines = read_constellations(stars)
 
-num_clines = len(clines)
-clines = ",\n".join(["{%.7ff, %.7ff, %.7ff, %.7ff, %.7ff, %.7ff}"%(i) for i in clines])
-clines = """
-#include "clines.h"
-const uint16_t num_clines = %u;
-const s_cline clines[num_clines] = {
-%s
-};"""%(num_clines, clines);
-
-with open("pico_planetarium/clines.cpp", 'w') as output_file:
-  output_file.write(clines)
+#records match s_cline in clines.h
+write_section("model/sections/clines.bin", "CLIN", "<11f", clines)
@@ -0,0 +1,56 @@
+import re
+
+def read_font(filename, name):
+  """read a column-major bitmap font array from a C header"""
+  with open(filename) as input_file:
+    data = input_file.read()
+
+  #remove comments, and anything after the first #else (alternative fonts)
+  data = re.sub(r"//.*", "", data)
+  data = re.sub(r"/\*.*?\*/", "", data, flags=re.S)
+  data = data.split("#else")[0]
+
+  body = data[data.index(name):]
+  body = body[body.index("{")+1:body.index("}")]
+  values = [int(i, 0) for i in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+  return values[:5], values[5:]
+
+def make_row_masks(header, data):
+  """convert column-major bits into one row mask per glyph row, bit n = column n"""
+  height, width, space, first, last = header
+  bytes_per_char = width*height//8
+  rows = []
+  for char in range(last-first+1):
+    bits = data[char*bytes_per_char:(char+1)*bytes_per_char]
+    bits += [0]*(bytes_per_char-len(bits)) #glyphs missing from the end are blank
+    glyph = [0]*height
+    for column in range(width):
+      for row in range(height):
+        bit = column*height + row
+        if bits[bit//8] & (1 << (bit%8)):
+          glyph[row] |= 1 << column
+    rows.extend(glyph)
+  return rows
+
+fonts = [
+  ("font_8x5", "../pico_planetarium/font_8x5.h"),
+  ("font_16x12", "../pico_planetarium/font_16x12.h"),
+]
+
+definitions = []
+for name, filename in fonts:
+  header, data = read_font(filename, name)
+  rows = make_row_masks(header, data)
+  rows = ",\n".join([", ".join(["0x%04x"%i for i in rows[n:n+header[0]]]) for n in range(0, len(rows), header[0])])
+  definitions.append("""static const uint16_t %s_rows[] = {
+%s
+};
+const s_font_masks %s_masks = {%u, %u, %u, %u, %u, %s_rows};
+"""%(name, rows, name, header[0], header[1], header[2], header[3], header[4], name))
+
+font_masks = """
+#include "font_masks.h"
+%s"""%("\n".join(definitions))
+
+with open("../pico_planetarium/font_masks.cpp", 'w') as output_file:
+  output_file.write(font_masks)
@@ -3,6 +3,10 @@ import numpy as np
 import math
 from math import tan, sin, cos, asin, atan2, radians, degrees
 from datetime import datetime, timezone
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.abspath(__file__)))
+from catalog_blob import write_section
 
 def hhmmss_to_deg(hh, mm, ss):
   """convert hours, minutes and seconds to degrees"""
@@ -39,6 +43,8 @@ def read_stars():
     dec_min = line[86:88]
     dec_sec = line[88:90]
     mk = line[129:131]
+    pm_ra = line[148:154]
+    pm_dec = line[154:160]
 
     try:
       number = int(number)
@@ -56,7 +62,19 @@ def read_stars():
     y = cos_dec*cos_ra
     z = sin_dec
 
-    stars[number] = (x, y, z, constellation, magnitude, mk)
+    try:
+      #proper motion in mas/yr, pm_ra is already multiplied by cos(dec)
+      pm_ra = float(pm_ra)*1000
+      pm_dec = float(pm_dec)*1000
+    except ValueError:
+      pm_ra = pm_dec = 0
+
+    #rate of change of x, y, z in mas/yr
+    dx = -sin(radians(dec))*sin(radians(ra))*pm_dec + cos(radians(ra))*pm_ra
+    dy = -sin(radians(dec))*cos(radians(ra))*pm_dec - sin(radians(ra))*pm_ra
+    dz = cos(radians(dec))*pm_dec
+
+    stars[number] = (x, y, z, constellation, magnitude, mk, (dx, dy, dz))
 
   return stars
 
@@ -80,15 +98,14 @@ def scale_colour(mk):
   return x; 
   
 
-stars = read_stars().values()
+stars = list(read_stars().values())
 num_stars = len(stars)
-stars = ",\n".join(["{%.7ff, %.7ff, %.7ff, %.7ff, %u}"%(x, y, z, magnitude, scale_colour(col)) for x, y, z, _, magnitude, col in stars])
-stars = """
-#include "stars.h"
-const uint16_t num_stars = %u;
-s_star stars[num_stars] = {
-%s
-};"""%(num_stars, stars);
 
-with open("pico_planetarium/stars.cpp", 'w') as output_file:
-  output_file.write(stars)
+#only stars that move by more than this (mas/yr) get a proper motion entry,
+#slower stars move less than a pixel in 2000 years at the narrowest field
+min_proper_motion = 75
+proper_motions = [(idx, round(dx), round(dy), round(dz)) for idx, (_, _, _, _, _, _, (dx, dy, dz)) in enumerate(stars) if (dx*dx+dy*dy+dz*dz)**0.5 >= min_proper_motion]
+
+#records match s_star and s_proper_motion in stars.h
+write_section("model/sections/stars.bin", "STAR", "<ffffB3x", [(x, y, z, magnitude, scale_colour(col)) for x, y, z, _, magnitude, col, _ in stars])
+write_section("model/sections/proper_motions.bin", "PMOT", "<Hhhh", proper_motions)
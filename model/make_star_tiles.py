@@ -0,0 +1,176 @@
+import argparse
+import struct
+from math import sin, cos, radians, degrees, acos, ceil
+
+def hhmmss_to_deg(hh, mm, ss):
+  """convert hours, minutes and seconds to degrees"""
+  return int(hh)*15 + int(mm)*15/60 + float(ss)*15/3600
+
+def ddmmss_to_deg(dd, mm, ss):
+  """convert degrees, minutes and seconds to degrees"""
+  return int(dd) + int(mm)/60 + float(ss)/3600
+
+scale = {
+"O" : 0,
+"B" : 10,
+"A" : 20,
+"F" : 30,
+"G" : 40,
+"K" : 50,
+"M" : 60
+}
+def scale_colour(mk):
+  """scale mk spectral class to fit in one byte, as make_star_list.py"""
+  x = scale.get(mk[:1], 30)#by default assume a medium colour
+  if len(mk) > 1:
+    try:
+      x += int(mk[1])
+    except ValueError:
+      pass
+  return x
+
+def colour_from_b_v(b_v):
+  """approximate spectral class from B-V colour index when there is no MK type"""
+  classes = [(-0.30, 5), (-0.02, 15), (0.30, 25), (0.58, 35), (0.81, 45), (1.40, 55)]
+  for limit, mk in classes:
+    if b_v < limit:
+      return mk
+  return 65
+
+def read_bsc(filename):
+  """Bright Star Catalog, same fields as make_star_list.py"""
+  with open(filename) as input_file:
+    for line in input_file:
+      try:
+        ra = hhmmss_to_deg(line[75:77], line[77:79], line[79:83])
+        dec = ddmmss_to_deg(line[83:86], line[86:88], line[88:90])
+        magnitude = float(line[102:107])
+      except ValueError:
+        continue
+      yield ra, dec, magnitude, scale_colour(line[129:131])
+
+def read_hipparcos(filename):
+  """Hipparcos main catalog (hip_main.dat), | separated"""
+  with open(filename) as input_file:
+    for line in input_file:
+      fields = line.split("|")
+      try:
+        ra = float(fields[8])
+        dec = float(fields[9])
+        magnitude = float(fields[5])
+      except ValueError:
+        continue
+      sp_type = fields[76].strip()
+      if sp_type[:1] in scale:
+        mk = scale_colour(sp_type)
+      else:
+        try:
+          mk = colour_from_b_v(float(fields[37]))
+        except ValueError:
+          mk = 30
+      yield ra, dec, magnitude, mk
+
+def read_tycho2(filename):
+  """Tycho-2 main catalog (catalog.dat or its parts), | separated"""
+  with open(filename) as input_file:
+    for line in input_file:
+      fields = line.split("|")
+      try:
+        #mean position if there is one, otherwise the observed position
+        ra = float(fields[2]) if fields[2].strip() else float(fields[24])
+        dec = float(fields[3]) if fields[3].strip() else float(fields[25])
+        bt = float(fields[17]) if fields[17].strip() else None
+        vt = float(fields[19])
+      except (ValueError, IndexError):
+        continue
+      if bt is None:
+        magnitude, b_v = vt, 0.6
+      else:
+        #Johnson V and B-V from Tycho photometry (ESA 1997, 1.3)
+        magnitude = vt - 0.090*(bt - vt)
+        b_v = 0.850*(bt - vt)
+      yield ra, dec, magnitude, colour_from_b_v(b_v)
+
+readers = {"bsc": read_bsc, "hipparcos": read_hipparcos, "tycho2": read_tycho2}
+
+def x_y_z(ra, dec):
+  """unit vector in the same axes as make_star_list.py"""
+  return cos(radians(dec))*sin(radians(ra)), cos(radians(dec))*cos(radians(ra)), sin(radians(dec))
+
+def make_tiles(tile_size):
+  """split the sky into declination bands, each split into roughly square tiles"""
+  tiles = []
+  num_bands = int(ceil(180/tile_size))
+  band_height = 180/num_bands
+  for band in range(num_bands):
+    dec_min = -90 + band*band_height
+    dec_max = dec_min + band_height
+    widest = max(cos(radians(dec_min)), cos(radians(dec_max)))
+    num_ra = max(1, int(ceil(360*widest/tile_size)))
+    for ra_idx in range(num_ra):
+      ra_min = ra_idx*360/num_ra
+      ra_max = ra_min + 360/num_ra
+      tiles.append((ra_min, ra_max, dec_min, dec_max))
+  return tiles, band_height
+
+def tile_index(ra, dec, tiles, band_height, band_start):
+  band = min(int((dec + 90)/band_height), len(band_start)-2)
+  first, last = band_start[band], band_start[band+1]
+  num_ra = last - first
+  return first + min(int((ra % 360)*num_ra/360), num_ra-1)
+
+def bounding_cone(ra_min, ra_max, dec_min, dec_max):
+  """cone around the centre of a tile enclosing points sampled on its edges"""
+  centre = x_y_z((ra_min+ra_max)/2, (dec_min+dec_max)/2)
+  samples = 16
+  edge = []
+  for idx in range(samples+1):
+    ra = ra_min + (ra_max-ra_min)*idx/samples
+    dec = dec_min + (dec_max-dec_min)*idx/samples
+    edge += [x_y_z(ra, dec_min), x_y_z(ra, dec_max), x_y_z(ra_min, dec), x_y_z(ra_max, dec)]
+  cos_half = min(sum(a*b for a, b in zip(centre, point)) for point in edge)
+  #widen slightly to cover the curvature between samples
+  half = min(degrees(acos(max(-1, min(1, cos_half)))) + 0.1, 180)
+  return centre, cos(radians(half)), sin(radians(half))
+
+parser = argparse.ArgumentParser(description="write a tiled binary star catalog for the planetarium")
+parser.add_argument("input", nargs="+", help="catalog files")
+parser.add_argument("--format", choices=readers.keys(), default="bsc")
+parser.add_argument("--magnitude", type=float, default=11.0, help="faintest magnitude to include")
+parser.add_argument("--tile-size", type=float, default=10.0, help="tile size in degrees")
+parser.add_argument("--output", default="stars.bin")
+args = parser.parse_args()
+
+tiles, band_height = make_tiles(args.tile_size)
+band_start = [0]
+for idx in range(1, len(tiles)):
+  if tiles[idx][2] != tiles[idx-1][2]:
+    band_start.append(idx)
+band_start.append(len(tiles))
+
+tile_stars = [[] for _ in tiles]
+for filename in args.input:
+  for ra, dec, magnitude, mk in readers[args.format](filename):
+    if magnitude > args.magnitude:
+      continue
+    x, y, z = x_y_z(ra, dec)
+    record = (round(x*32767), round(y*32767), round(z*32767), max(0, min(255, round((magnitude+2)*10))), mk)
+    tile_stars[tile_index(ra, dec, tiles, band_height, band_start)].append(record)
+
+header_size = struct.calcsize("<4sHHI")
+tile_format = "<fffffII"
+offset = header_size + len(tiles)*struct.calcsize(tile_format)
+num_stars = sum(len(stars) for stars in tile_stars)
+
+with open(args.output, "wb") as output_file:
+  output_file.write(struct.pack("<4sHHI", b"PSTC", 1, len(tiles), num_stars))
+  for tile, stars in zip(tiles, tile_stars):
+    centre, cos_half, sin_half = bounding_cone(*tile)
+    output_file.write(struct.pack(tile_format, *centre, cos_half, sin_half, offset, len(stars)))
+    offset += len(stars)*struct.calcsize("<hhhBB")
+  for stars in tile_stars:
+    stars.sort(key=lambda star: star[3])
+    for star in stars:
+      output_file.write(struct.pack("<hhhBB", *star))
+
+print("%u stars in %u tiles, largest tile %u stars" % (num_stars, len(tiles), max(len(stars) for stars in tile_stars)))
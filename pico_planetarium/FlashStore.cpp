@@ -0,0 +1,50 @@
+#include "FlashStore.h"
+#include "hardware/flash.h"
+#include "hardware/regs/addressmap.h"
+
+extern "C" uint8_t _FS_start;
+extern "C" uint8_t __flash_binary_end;
+
+FlashStore :: FlashStore(uint8_t num_sectors):
+  c_kv_store(num_sectors), flash_offset(0)
+{
+}
+
+bool FlashStore :: begin()
+{
+  const uint32_t store_start = (uintptr_t)&_FS_start - num_sectors()*sector_size;
+  if((uintptr_t)&__flash_binary_end > store_start) return false;
+  flash_offset = store_start - XIP_BASE;
+  return open();
+}
+
+bool FlashStore :: flash_read(uint32_t offset, void *data, uint32_t size)
+{
+  if(!flash_offset) return false;
+  memcpy(data, (const void*)(XIP_BASE + flash_offset + offset), size);
+  return true;
+}
+
+//nothing may run from flash while it is written, so stop the other core
+//and interrupts for the duration, as EEPROM.commit() does
+bool FlashStore :: flash_program(uint32_t offset, const void *data, uint32_t size)
+{
+  if(!flash_offset) return false;
+  noInterrupts();
+  rp2040.idleOtherCore();
+  flash_range_program(flash_offset + offset, (const uint8_t*)data, size);
+  rp2040.resumeOtherCore();
+  interrupts();
+  return true;
+}
+
+bool FlashStore :: flash_erase(uint32_t offset)
+{
+  if(!flash_offset) return false;
+  noInterrupts();
+  rp2040.idleOtherCore();
+  flash_range_erase(flash_offset + offset, sector_size);
+  rp2040.resumeOtherCore();
+  interrupts();
+  return true;
+}
@@ -0,0 +1,29 @@
+#ifndef _FLASH_STORE_H_
+#define _FLASH_STORE_H_
+
+#include "Arduino.h"
+#include "kv_store.h"
+
+//c_kv_store in the sectors just below the flash filesystem (_FS_start).
+//Uploading a sketch only writes the sketch, so values survive it, as
+//EEPROM does. With no filesystem configured _FS_start is the EEPROM
+//sector, so the store sits just below that instead.
+class FlashStore : public c_kv_store
+{
+
+  uint32_t flash_offset;
+  bool flash_read(uint32_t offset, void *data, uint32_t size);
+  bool flash_program(uint32_t offset, const void *data, uint32_t size);
+  bool flash_erase(uint32_t offset);
+
+  public:
+
+  FlashStore(uint8_t num_sectors = 4);
+
+  //false if the sketch has grown into the store, otherwise as open()
+  bool begin();
+  bool isAvailable() const {return flash_offset != 0;}
+
+};
+
+#endif
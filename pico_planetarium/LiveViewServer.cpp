@@ -0,0 +1,153 @@
+#include "LiveViewServer.h"
+
+static const char viewer_page[] = R"(<!DOCTYPE html>
+<html><head><title>Pico Planetarium</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<style>body{background:#000;color:#888;font-family:sans-serif;text-align:center}
+canvas{max-width:100%;image-rendering:pixelated}</style></head>
+<body><canvas id="sky"></canvas><p id="status">connecting</p>
+<script>
+const canvas = document.getElementById("sky");
+const context = canvas.getContext("2d");
+const status = document.getElementById("status");
+let frame = null;
+
+function u16(b, i) {return b[i] | b[i+1] << 8;}
+
+//returns the bytes used, or 0 if the message isn't complete yet
+function message(b, i) {
+  const left = b.length - i;
+  switch(b[i]) {
+    case 1:
+      if(left < 5) return 0;
+      canvas.width = u16(b, i+1);
+      canvas.height = u16(b, i+3);
+      frame = context.createImageData(canvas.width, canvas.height);
+      return 5;
+    case 2: {
+      if(left < 9 || left < 9 + u16(b, i+7)) return 0;
+      const x = u16(b, i+1), y = u16(b, i+3), w = b[i+5], end = i + 9 + u16(b, i+7);
+      let p = i + 9, n = 0;
+      const put = (v) => {
+        const o = ((y + Math.floor(n/w))*canvas.width + x + n%w)*4;
+        frame.data[o] = (v >> 8) & 0xf8;
+        frame.data[o+1] = (v >> 3) & 0xfc;
+        frame.data[o+2] = (v << 3) & 0xf8;
+        frame.data[o+3] = 255;
+        n++;
+      };
+      //pixels are byte swapped RGB565
+      while(p < end) {
+        const c = b[p++];
+        if(c < 128) {for(let k = 0; k <= c; k++, p += 2) put(b[p] << 8 | b[p+1]);}
+        else {const v = b[p] << 8 | b[p+1]; for(let k = 0; k < c - 125; k++) put(v); p += 2;}
+      }
+      return end - i;
+    }
+    case 3:
+      context.putImageData(frame, 0, 0);
+      return 1;
+    case 4: {
+      if(left < 33) return 0;
+      const v = new DataView(b.buffer, b.byteOffset + i + 1, 32);
+      status.textContent = "field " + v.getFloat32(0, true).toFixed(1) +
+        " alt " + v.getFloat32(4, true).toFixed(1) + " az " + v.getFloat32(8, true).toFixed(1) +
+        " JD " + v.getFloat64(20, true).toFixed(5);
+      return 33;
+    }
+  }
+  throw new Error("bad message " + b[i]);
+}
+
+async function stream() {
+  const reader = (await fetch("/stream")).body.getReader();
+  let pending = new Uint8Array(0);
+  status.textContent = "connected";
+  for(;;) {
+    const {value, done} = await reader.read();
+    if(done) break;
+    const b = new Uint8Array(pending.length + value.length);
+    b.set(pending);
+    b.set(value, pending.length);
+    let i = 0, used;
+    while(i < b.length && (used = message(b, i))) i += used;
+    pending = b.slice(i);
+  }
+}
+
+function connect() {
+  stream().catch(() => {}).finally(() => {status.textContent = "reconnecting"; setTimeout(connect, 1000);});
+}
+connect();
+</script></body></html>
+)";
+
+LiveViewServer :: LiveViewServer(uint16_t width, uint16_t height, uint16_t port):
+  c_live_view(width, height), server(port)
+{
+}
+
+void LiveViewServer :: begin()
+{
+  server.begin();
+}
+
+bool LiveViewServer :: stream_write(const uint8_t *data, uint32_t size)
+{
+  return viewer.write(data, size) == size;
+}
+
+bool LiveViewServer :: isStreaming()
+{
+  if(viewer && !viewer.connected()) viewer.stop();
+  return viewer.connected();
+}
+
+bool LiveViewServer :: poll()
+{
+  WiFiClient client = server.accept();
+  if(!client) return false;
+
+  //only the request line matters, skip the headers
+  client.setTimeout(100);
+  String request = client.readStringUntil('\n');
+  while(client.connected())
+  {
+    String header = client.readStringUntil('\n');
+    if(header.length() <= 1) break;
+  }
+
+  if(request.startsWith("GET /stream"))
+  {
+    viewer.stop();
+    viewer = client;
+    viewer.setNoDelay(true);
+    viewer.print("HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n");
+    reset();
+    return true;
+  }
+
+  if(request.startsWith("GET / "))
+  {
+    client.print("HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nConnection: close\r\n\r\n");
+    client.write((const uint8_t*)viewer_page, sizeof(viewer_page) - 1);
+  }
+  else
+  {
+    client.print("HTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\n");
+  }
+  client.stop();
+  return false;
+}
+
+void LiveViewServer :: sendFrame(const uint16_t *pixels)
+{
+  if(!isStreaming()) return;
+  update(pixels, viewer.availableForWrite());
+}
+
+void LiveViewServer :: sendObserver(const s_observer &observer, const s_settings &settings)
+{
+  if(!isStreaming() || viewer.availableForWrite() < 64) return;
+  send_observer(observer, settings);
+}
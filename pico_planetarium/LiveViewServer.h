@@ -0,0 +1,33 @@
+#ifndef _LIVE_VIEW_SERVER_H_
+#define _LIVE_VIEW_SERVER_H_
+
+#include <WiFi.h>
+#include "Arduino.h"
+#include "live_view.h"
+
+//c_live_view over a WiFiServer. GET / serves a page that draws the stream
+//on a canvas, GET /stream is the stream itself. There is one viewer at a
+//time, a new one replaces the last. Each update sends no more than the TCP
+//send buffer can take, so a slow viewer never blocks the display.
+class LiveViewServer : public c_live_view
+{
+
+  WiFiServer server;
+  WiFiClient viewer;
+  bool stream_write(const uint8_t *data, uint32_t size);
+
+  public:
+
+  LiveViewServer(uint16_t width, uint16_t height, uint16_t port = 80);
+  void begin();
+
+  //handle new connections, true if a viewer has just started streaming
+  bool poll();
+  bool isStreaming();
+
+  void sendFrame(const uint16_t *pixels);
+  void sendObserver(const s_observer &observer, const s_settings &settings);
+
+};
+
+#endif
@@ -22,49 +22,40 @@
 static const char* ntpServerName = "pool.ntp.org";  // NTP server pool
 static const int ntpPort = 123;                     // NTP server port (123 for NTP)
 
-// Function to send an NTP request
-void NTPTime :: sendNTPpacket(const char* ntpServer) {
-  memset(udpBuffer, 0, udpBufferSize);
-  udpBuffer[0] = 0b11100011;   // NTP request header
+bool NTPTime :: udp_send(const uint8_t *packet, uint16_t size)
+{
+  if(!udp.beginPacket(ntpServerName, ntpPort)) return false;
+  udp.write(packet, size);
+  return udp.endPacket();
+}
+
+int NTPTime :: udp_receive(uint8_t *packet, uint16_t size)
+{
+  if(!udp.parsePacket()) return 0;
+  return udp.read(packet, size);
+}
 
-  udp.beginPacket(ntpServer, ntpPort);
-  udp.write(udpBuffer, udpBufferSize);
-  udp.endPacket();
+uint64_t NTPTime :: local_us()
+{
+  return time_us_64();
 }
 
-// Function to fetch local time and internet time
+// Poll the server when due, and keep the system clock on the disciplined time
 void NTPTime :: setTime() {
     
     if (WiFi.status() != WL_CONNECTED){
-      Serial.println("No Connection...");
       return;
     }
 
-    int packetSize = udp.parsePacket();
-    if (packetSize) {
-      udp.read(udpBuffer, udpBufferSize);
-      unsigned long highWord = word(udpBuffer[40], udpBuffer[41]);
-      unsigned long lowWord = word(udpBuffer[42], udpBuffer[43]);
-      time_t secsSince1900 = highWord << 16 | lowWord;
-      highWord = word(udpBuffer[44], udpBuffer[45]);
-      lowWord = word(udpBuffer[46], udpBuffer[47]);
-      unsigned long fractionalSeconds = highWord << 16 | lowWord;
-
-      // Unix time starts on Jan 1 1970. In seconds, that's 2208988800:
-      const unsigned long seventyYears = 2208988800UL;
-      time_t unix_time = secsSince1900 - seventyYears;
+    const bool was_synchronised = is_synchronised();
+    poll();
+    if(!is_synchronised()) return;
+    if(!was_synchronised) Serial.println("Time Updated");
 
-      //set clock to ntp time
-      timeval tv = {.tv_sec = unix_time};
-      settimeofday(&tv, NULL);
-      Serial.println("Time Updated");
-    }
-
-    if(millis() - lastUpdated > 30000)
-    {
-      sendNTPpacket(ntpServerName);
-      lastUpdated = millis();
-    }
+    const double now = time();
+    const time_t seconds = (time_t)now;
+    timeval tv = {.tv_sec = seconds, .tv_usec = (suseconds_t)((now - seconds)*1.0e6)};
+    settimeofday(&tv, NULL);
   }
 
 void NTPTime :: begin()
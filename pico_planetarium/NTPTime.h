@@ -22,15 +22,17 @@
 #include <WiFi.h>
 #include <WiFiUdp.h>
 #include "Arduino.h"
+#include "sntp_clock.h"
 
-class NTPTime
+//c_sntp_clock over WiFiUDP, the disciplined time is copied to the system
+//clock so time() and gettimeofday() follow it
+class NTPTime : public c_sntp_clock
 {
 
   WiFiUDP udp;
-  static const int udpBufferSize = 48;
-  byte udpBuffer[udpBufferSize];
-  uint64_t lastUpdated = 0;
-  void sendNTPpacket(const char* ntpServer);
+  bool udp_send(const uint8_t *packet, uint16_t size);
+  int udp_receive(uint8_t *packet, uint16_t size);
+  uint64_t local_us();
 
   public:
 
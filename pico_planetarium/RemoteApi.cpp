@@ -0,0 +1,40 @@
+#include "RemoteApi.h"
+
+static const uint8_t max_args = 20;
+
+RemoteApi :: RemoteApi(s_observer &observer, s_settings &settings, uint16_t port):
+  c_remote_api(observer, settings), server(port)
+{
+}
+
+void RemoteApi :: begin()
+{
+  server.onNotFound(std::bind(&RemoteApi::handleRequest, this));
+  server.begin();
+}
+
+void RemoteApi :: handleClient()
+{
+  server.handleClient();
+}
+
+void RemoteApi :: handleRequest()
+{
+  //WebServer has already parsed the query string and any form body
+  s_api_arg args[max_args];
+  const uint8_t num_args = server.args() < max_args ? server.args() : max_args;
+  String names[max_args], values[max_args];
+  for(uint8_t idx = 0; idx < num_args; ++idx)
+  {
+    names[idx] = server.argName(idx);
+    values[idx] = server.arg(idx);
+    args[idx] = {names[idx].c_str(), values[idx].c_str()};
+  }
+
+  const HTTPMethod method = server.method();
+  const e_api_method api_method = method == HTTP_GET ? api_get : method == HTTP_POST ? api_post : api_other;
+  char response[512];
+  const uint16_t status = handle(api_method, server.uri().c_str(), args, num_args, response, sizeof(response));
+  server.sendHeader("Cache-Control", "no-cache");
+  server.send(status, "application/json", response);
+}
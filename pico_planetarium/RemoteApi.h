@@ -0,0 +1,24 @@
+#ifndef _REMOTE_API_H_
+#define _REMOTE_API_H_
+
+#include <WiFi.h>
+#include <WebServer.h>
+#include "Arduino.h"
+#include "remote_api.h"
+
+//c_remote_api on a WebServer, call handleClient() from the main loop
+class RemoteApi : public c_remote_api
+{
+
+  WebServer server;
+  void handleRequest();
+
+  public:
+
+  RemoteApi(s_observer &observer, s_settings &settings, uint16_t port = 8080);
+  void begin();
+  void handleClient();
+
+};
+
+#endif
@@ -1,7 +1,12 @@
 #include "button.h"
-#include "pico/stdlib.h"
 
-#include <cstdio>
+c_event_queue<s_button_event, 16> button_events;
+
+static const uint32_t debounce_us = 50 * 1000;
+static const uint32_t hold_us = 500 * 1000;
+static const uint32_t repeat_us = 100 * 1000;
+
+static button *buttons[NUM_BANK0_GPIOS];
 
 button :: button(uint8_t gpio_num):gpio_num(gpio_num)
 {
@@ -10,57 +15,49 @@ button :: button(uint8_t gpio_num):gpio_num(gpio_num)
     gpio_init(gpio_num);
     gpio_set_dir(gpio_num, GPIO_IN);
     gpio_pull_up(gpio_num);
+
+    //there is one GPIO callback per core, shared by all the buttons
+    buttons[gpio_num] = this;
+    gpio_set_irq_enabled_with_callback(gpio_num, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, &gpio_callback);
+}
+
+void button :: gpio_callback(uint gpio, uint32_t events)
+{
+  if(gpio < NUM_BANK0_GPIOS && buttons[gpio]) buttons[gpio]->edge(time_us_32());
 }
 
-void button :: update_state()
+void button :: edge(uint32_t now)
 {
-  if(button_state == up)
+  //bounces can deliver both edges at once, so go by the current level
+  const bool is_down = !gpio_get(gpio_num);
+
+  if(button_state == up && is_down)
   {
-    if(!gpio_get(gpio_num)) //on
-    {
-      time_pressed = time_us_32();
-      button_state = down;
-    }
+    time_pressed = now;
+    button_state = down;
+    hold_alarm = add_alarm_in_us(hold_us, &hold_callback, this, true);
   }
-  else if(button_state == down)
+  else if(button_state != up && !is_down)
   {
-    if((time_us_32() - time_pressed) > (500 * 1000))
-    {
-      button_state = held;
-    }
-    else if(gpio_get(gpio_num)) //off
+    if(hold_alarm > 0) cancel_alarm(hold_alarm);
+    hold_alarm = 0;
+    if(button_state == down && (now - time_pressed) > debounce_us)
     {
-      if((time_us_32() - time_pressed) > (50 * 1000))
-      {
-        button_state = pressed;
-      }
-      else
-      {
-        button_state = up;
-      }
+      button_events.push({this, s_button_event::pressed, now});
     }
-  }
-  else if(button_state == pressed)
-  {
     button_state = up;
   }
-  else if(button_state == held)
-  {
-    if(gpio_get(gpio_num)) //off
-    {
-      button_state = up;
-    }
-  }
 }
 
-bool button :: is_pressed()
+int64_t button :: hold_callback(alarm_id_t id, void *user_data)
 {
-  update_state();
-  return button_state == pressed;
-}
-
-bool button :: is_held()
-{
-  update_state();
-  return button_state == held;
+  button &b = *(button*)user_data;
+  if(b.button_state == up)
+  {
+    b.hold_alarm = 0;
+    return 0;
+  }
+  b.button_state = held;
+  button_events.push({&b, s_button_event::held, time_us_32()});
+  return -(int64_t)repeat_us; //repeat, measured from when the alarm was due
 }
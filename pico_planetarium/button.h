@@ -2,21 +2,41 @@
 #define __button__
 
 #include <cstdint>
+#include "pico/stdlib.h"
+#include "event_queue.h"
 
+class button;
+
+struct s_button_event
+{
+  enum e_type {pressed, held};
+  button *source;
+  e_type type;
+  uint32_t time; //time_us_32() of the edge or hold
+};
+
+//Buttons are handled by GPIO edge interrupts, which timestamp the edges
+//and push events into button_events. Presses shorter than 50ms are
+//treated as bounce, a button down for more than 500ms sends a held event
+//then repeats it every 100ms until released. The interrupt and alarm
+//handlers share a priority, so there is only ever one producer.
 class button
 {
   public:
   button(uint8_t gpio_num);
-  bool is_pressed();
-  bool is_held();
-  public:
   uint8_t gpio_num;
-  void update_state();
 
-  enum e_button_state {up, down, pressed, held};
-  e_button_state button_state = up;
-  uint32_t time_pressed = 0;
+  private:
+  static void gpio_callback(uint gpio, uint32_t events);
+  static int64_t hold_callback(alarm_id_t id, void *user_data);
+  void edge(uint32_t now);
 
+  enum e_button_state {up, down, held};
+  volatile e_button_state button_state = up;
+  uint32_t time_pressed = 0;
+  alarm_id_t hold_alarm = 0;
 };
 
+extern c_event_queue<s_button_event, 16> button_events;
+
 #endif
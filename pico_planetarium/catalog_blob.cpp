@@ -0,0 +1,65 @@
+#include <cstring>
+#include "catalog_blob.h"
+
+c_catalog_blob catalog_blob;
+
+bool c_catalog_blob :: attach(const void *data, uint32_t size)
+{
+  m_data = nullptr;
+  m_sections = nullptr;
+  m_num_sections = 0;
+
+  //records are read in place, so the blob must be aligned for them
+  if(!data || ((uintptr_t)data & 3) || size < sizeof(s_blob_header)) return false;
+
+  const s_blob_header *header = (const s_blob_header*)data;
+  if(memcmp(header->magic, "PLNB", 4) != 0 || header->version != version || header->size > size) return false;
+  if(sizeof(s_blob_header) + header->num_sections*sizeof(s_blob_section) > header->size) return false;
+
+  const s_blob_section *sections = (const s_blob_section*)(header + 1);
+  for(uint16_t idx = 0; idx < header->num_sections; ++idx)
+  {
+    if(sections[idx].offset & 15) return false;
+    if(sections[idx].offset > header->size || sections[idx].size > header->size - sections[idx].offset) return false;
+  }
+
+  m_data = (const uint8_t*)data;
+  m_sections = sections;
+  m_num_sections = header->num_sections;
+  return true;
+}
+
+const void *c_catalog_blob :: find(const char *id, uint32_t element_size, uint32_t &count) const
+{
+  count = 0;
+  for(uint16_t idx = 0; idx < m_num_sections; ++idx)
+  {
+    const s_blob_section &section = m_sections[idx];
+    if(memcmp(section.id, id, 4) != 0) continue;
+    if(section.size != section.count*element_size) return nullptr;
+    count = section.count;
+    return m_data + section.offset;
+  }
+  return nullptr;
+}
+
+const uint8_t *c_catalog_blob :: image(const char *name, uint16_t &width, uint16_t &height) const
+{
+  uint32_t num_images;
+  const s_blob_image *images = section<s_blob_image>("IMGS", num_images);
+  for(uint32_t idx = 0; idx < num_images; ++idx)
+  {
+    if(strncmp(images[idx].name, name, sizeof(images[idx].name)) != 0) continue;
+    width = images[idx].width;
+    height = images[idx].height;
+    return m_data + images[idx].offset;
+  }
+  width = height = 0;
+  return nullptr;
+}
+
+const uint8_t *c_catalog_blob :: image(const char *name) const
+{
+  uint16_t width, height;
+  return image(name, width, height);
+}
@@ -0,0 +1,82 @@
+#ifndef __CATALOG_BLOB_H__
+#define __CATALOG_BLOB_H__
+
+#include <cstdint>
+
+//Catalogs and images are packed by model/make_catalog_blob.py into a single
+//binary blob, generated as the array in catalog_blob_data.cpp. The device
+//builds it into flash and the host tests link the same file. Records are
+//used in place, so the
+//structures in stars.h, clines.h etc. define the on-disk layout too.
+//
+//blob layout (little endian):
+//  s_blob_header
+//  s_blob_section[num_sections]
+//  section data, each section starting on a 16 byte boundary
+
+struct s_blob_header
+{
+  char magic[4]; //"PLNB"
+  uint16_t version;
+  uint16_t num_sections;
+  uint32_t size; //whole blob in bytes
+  uint32_t reserved;
+};
+
+struct s_blob_section
+{
+  char id[4];
+  uint32_t offset; //bytes from the start of the blob
+  uint32_t size;
+  uint32_t count; //number of records
+};
+
+//one entry per image in the "IMGS" section, the compressed images are in
+//"IMGD", decode them with c_image_decoder
+struct s_blob_image
+{
+  char name[16];
+  uint16_t width;
+  uint16_t height;
+  uint32_t offset; //bytes from the start of the blob
+  uint32_t size; //compressed bytes
+};
+static_assert(sizeof(s_blob_image) == 28, "s_blob_image must match model/make_catalog_blob.py");
+
+class c_catalog_blob
+{
+  const uint8_t *m_data;
+  const s_blob_section *m_sections;
+  uint16_t m_num_sections;
+
+  const void *find(const char *id, uint32_t element_size, uint32_t &count) const;
+
+  public:
+
+  static const uint16_t version = 2;
+
+  c_catalog_blob():m_data(nullptr), m_sections(nullptr), m_num_sections(0){}
+
+  //check the header and section table, false leaves the blob detached
+  bool attach(const void *data, uint32_t size);
+  bool is_attached() const {return m_data != nullptr;}
+
+  //records in a section, nullptr and a count of 0 if it is missing or the
+  //record size doesn't match
+  template<typename T> const T *section(const char *id, uint32_t &count) const
+  {
+    return (const T*)find(id, sizeof(T), count);
+  }
+
+  //compressed data of a named image, see image_decoder.h
+  const uint8_t *image(const char *name, uint16_t &width, uint16_t &height) const;
+  const uint8_t *image(const char *name) const;
+};
+
+extern c_catalog_blob catalog_blob;
+
+//the blob as an array, defined in the generated catalog_blob_data.cpp
+extern const uint8_t catalog_blob_data[];
+extern const uint32_t catalog_blob_size;
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef __CHEBYSHEV_EPHEMERIS_H__
+#define __CHEBYSHEV_EPHEMERIS_H__
+
+#include <cstdint>
+
+//Planet positions fitted by model/make_chebyshev_ephemeris.py from a JPL
+//development ephemeris. Each body is split into equal length segments, and
+//each segment holds num_coefficients Chebyshev coefficients for x, y and z
+//(heliocentric, equatorial J2000, AU), stored [segment][axis][coefficient].
+//The Earth's entry is the Earth-Moon barycentre, the Earth is placed
+//earth_barycentre_offset AU from it, away from the Moon.
+//
+//The script picks the segment length and number of coefficients for each
+//body so that the error seen from the Earth stays under half a pixel at the
+//narrowest field of view, 11 arc-seconds for 2 degrees on 320 pixels. Over
+//the default 1990 to 2060 that is about 110KB of flash, 78KB of it for
+//Mercury, whose fast eccentric orbit needs short segments. The cost scales
+//with the number of years, and the script prints the size of each table.
+//
+//Define CHEBYSHEV_EPHEMERIS once chebyshev_ephemeris.cpp has been generated.
+//Dates outside the fitted range fall back to the Keplerian elements.
+//#define CHEBYSHEV_EPHEMERIS
+
+struct s_chebyshev_body
+{
+  double start_jd;
+  float segment_days;
+  uint16_t num_segments;
+  uint8_t num_coefficients;
+  const float *coefficients;
+};
+
+//mean Earth-Moon distance over 1 + the Earth/Moon mass ratio, in AU
+static const float earth_barycentre_offset = 384400.0f/82.3006f/149597870.7f;
+
+//same order as the Keplerian elements, index 2 is the Earth-Moon barycentre
+extern const s_chebyshev_body chebyshev_bodies[8];
+
+#endif
@@ -1,755 +0,0 @@
-
-#include "clines.h"
-const uint16_t num_clines = 750;
-const s_cline clines[num_clines] = {
-{-0.0673281f, 0.6855874f, 0.7248703f, -0.0610711f, 0.7126676f, 0.6988385f},
-{-0.0610711f, 0.7126676f, 0.6988385f, -0.0693583f, 0.7248442f, 0.6854125f},
-{-0.0693583f, 0.7248442f, 0.6854125f, -0.1853567f, 0.7157118f, 0.6733495f},
-{-0.1853567f, 0.7157118f, 0.6733495f, -0.0693583f, 0.7248442f, 0.6854125f},
-{-0.0693583f, 0.7248442f, 0.6854125f, 0.0639805f, 0.7983256f, 0.5988178f},
-{0.0639805f, 0.7983256f, 0.5988178f, 0.1465842f, 0.8458077f, 0.5129546f},
-{0.1465842f, 0.8458077f, 0.5129546f, 0.0319767f, 0.8732671f, 0.4861913f},
-{0.0319767f, 0.8732671f, 0.4861913f, 0.1465842f, 0.8458077f, 0.5129546f},
-{0.1465842f, 0.8458077f, 0.5129546f, 0.1459987f, 0.8596600f, 0.4895600f},
-{0.1459987f, 0.8596600f, 0.4895600f, 0.1869651f, 0.8922606f, 0.4109929f},
-{0.1869651f, 0.8922606f, 0.4109929f, 0.1459987f, 0.8596600f, 0.4895600f},
-{0.1459987f, 0.8596600f, 0.4895600f, 0.1465842f, 0.8458077f, 0.5129546f},
-{0.1465842f, 0.8458077f, 0.5129546f, 0.2435334f, 0.7755544f, 0.5824146f},
-{0.2435334f, 0.7755544f, 0.5824146f, 0.3804818f, 0.6338543f, 0.6733961f},
-{0.3804818f, 0.6338543f, 0.6733961f, 0.2435334f, 0.7755544f, 0.5824146f},
-{0.2435334f, 0.7755544f, 0.5824146f, 0.2740702f, 0.6014385f, 0.7504380f},
-{0.2740702f, 0.6014385f, 0.7504380f, 0.2435334f, 0.7755544f, 0.5824146f},
-{0.2435334f, 0.7755544f, 0.5824146f, 0.1918265f, 0.7587408f, 0.6225070f},
-{0.1918265f, 0.7587408f, 0.6225070f, 0.1625539f, 0.7360700f, 0.6570975f},
-{0.2181204f, -0.7697741f, -0.5998928f, 0.3380802f, -0.7883409f, -0.5140237f},
-{0.3380802f, -0.7883409f, -0.5140237f, 0.5009542f, -0.7441067f, -0.4419843f},
-{0.5009542f, -0.7441067f, -0.4419843f, 0.5065598f, -0.6556779f, -0.5598961f},
-{-0.1281018f, -0.1424464f, -0.9814779f, -0.1993243f, -0.0925796f, -0.9755505f},
-{-0.1993243f, -0.0925796f, -0.9755505f, -0.2074749f, -0.0823023f, -0.9747720f},
-{-0.2074749f, -0.0823023f, -0.9747720f, -0.2206993f, -0.0769888f, -0.9722986f},
-{-0.8705972f, 0.4791757f, 0.1115846f, -0.8748423f, 0.4592213f, 0.1541643f},
-{-0.8748423f, 0.4592213f, 0.1541643f, -0.8791262f, 0.4395621f, 0.1841801f},
-{-0.8791262f, 0.4395621f, 0.1841801f, -0.9298419f, 0.3639253f, 0.0543354f},
-{-0.9298419f, 0.3639253f, 0.0543354f, -0.9315961f, 0.2733446f, 0.2396068f},
-{-0.9315961f, 0.2733446f, 0.2396068f, -0.9298419f, 0.3639253f, 0.0543354f},
-{-0.9298419f, 0.3639253f, 0.0543354f, -0.8818403f, 0.4712215f, 0.0175494f},
-{-0.8818403f, 0.4712215f, 0.0175494f, -0.8402320f, 0.5420376f, 0.0143354f},
-{-0.8402320f, 0.5420376f, 0.0143354f, -0.8818403f, 0.4712215f, 0.0175494f},
-{-0.8818403f, 0.4712215f, 0.0175494f, -0.9298419f, 0.3639253f, 0.0543354f},
-{-0.9298419f, 0.3639253f, 0.0543354f, -0.9570929f, 0.2846323f, -0.0543838f},
-{-0.9570929f, 0.2846323f, -0.0543838f, -0.9613379f, 0.2651577f, -0.0743019f},
-{-0.2044989f, 0.9120090f, -0.3555556f, -0.1889637f, 0.9696866f, -0.1549211f},
-{-0.1889637f, 0.9696866f, -0.1549211f, -0.1969183f, 0.9749224f, -0.1036798f},
-{-0.1969183f, 0.9749224f, -0.1036798f, -0.3609864f, 0.9325688f, 0.0020508f},
-{-0.3609864f, 0.9325688f, 0.0020508f, -0.4160322f, 0.9092870f, -0.0106948f},
-{-0.4160322f, 0.9092870f, -0.0106948f, -0.2879869f, 0.9510834f, -0.1118206f},
-{-0.2879869f, 0.9510834f, -0.1118206f, -0.2727250f, 0.9303860f, -0.2449549f},
-{-0.2727250f, 0.9303860f, -0.2449549f, -0.2879869f, 0.9510834f, -0.1118206f},
-{-0.2879869f, 0.9510834f, -0.1118206f, -0.4160322f, 0.9092870f, -0.0106948f},
-{-0.4160322f, 0.9092870f, -0.0106948f, -0.4325415f, 0.8950874f, -0.1082885f},
-{-0.4325415f, 0.8950874f, -0.1082885f, -0.4648670f, 0.8600825f, -0.2101352f},
-{-0.4648670f, 0.8600825f, -0.2101352f, -0.4325415f, 0.8950874f, -0.1082885f},
-{-0.4325415f, 0.8950874f, -0.1082885f, -0.4160322f, 0.9092870f, -0.0106948f},
-{-0.4160322f, 0.9092870f, -0.0106948f, -0.4779819f, 0.8783519f, 0.0055802f},
-{-0.4779819f, 0.8783519f, 0.0055802f, -0.6015513f, 0.7950929f, -0.0772217f},
-{-0.6437428f, 0.0186326f, -0.7650151f, -0.6624902f, -0.0818082f, -0.7445899f},
-{-0.6624902f, -0.0818082f, -0.7445899f, -0.5744809f, -0.0876514f, -0.8138114f},
-{-0.5744809f, -0.0876514f, -0.8138114f, -0.5582179f, -0.0849375f, -0.8253353f},
-{-0.5582179f, -0.0849375f, -0.8253353f, -0.5062488f, -0.0641823f, -0.8599958f},
-{-0.5062488f, -0.0641823f, -0.8599958f, -0.5582179f, -0.0849375f, -0.8253353f},
-{-0.5582179f, -0.0849375f, -0.8253353f, -0.5666982f, -0.1555096f, -0.8091167f},
-{-0.5666982f, -0.1555096f, -0.8091167f, -0.4916453f, -0.1555224f, -0.8567950f},
-{-0.4916453f, -0.1555224f, -0.8567950f, -0.5666982f, -0.1555096f, -0.8091167f},
-{-0.5666982f, -0.1555096f, -0.8091167f, -0.5831840f, -0.1573961f, -0.7969460f},
-{-0.5831840f, -0.1573961f, -0.7969460f, -0.6624902f, -0.0818082f, -0.7445899f},
-{0.6985145f, 0.6309902f, 0.3375334f, 0.6563551f, 0.6608861f, 0.3639061f},
-{0.6563551f, 0.6608861f, 0.3639061f, 0.6005066f, 0.6554337f, 0.4580377f},
-{0.6005066f, 0.6554337f, 0.4580377f, 0.4832968f, 0.7796805f, 0.3981488f},
-{0.4832968f, 0.7796805f, 0.3981488f, 0.4483287f, 0.8202481f, 0.3552384f},
-{0.4483287f, 0.8202481f, 0.3552384f, 0.4486585f, 0.8303826f, 0.3304092f},
-{0.6823155f, 0.1304981f, 0.7193162f, 0.7077529f, 0.0014566f, 0.7064586f},
-{0.7077529f, 0.0014566f, 0.7064586f, 0.7963974f, 0.0009672f, 0.6047729f},
-{0.7963974f, 0.0009672f, 0.6047729f, 0.8684416f, 0.1286598f, 0.4788068f},
-{0.8684416f, 0.1286598f, 0.4788068f, 0.8056532f, 0.2272430f, 0.5470682f},
-{0.8056532f, 0.2272430f, 0.5470682f, 0.7302213f, 0.1872230f, 0.6570573f},
-{0.7302213f, 0.1872230f, 0.6570573f, 0.7316331f, 0.1739117f, 0.6591417f},
-{0.7316331f, 0.1739117f, 0.6591417f, 0.6984725f, 0.1807403f, 0.6924370f},
-{0.6984725f, 0.1807403f, 0.6924370f, 0.6823155f, 0.1304981f, 0.7193162f},
-{-0.4833124f, -0.6181760f, 0.6198932f, -0.5306675f, -0.6802629f, 0.5056030f},
-{-0.5306675f, -0.6802629f, 0.5056030f, -0.5269882f, -0.7837856f, 0.3285782f},
-{-0.5269882f, -0.7837856f, 0.3285782f, -0.5870545f, -0.6694859f, 0.4551435f},
-{-0.5870545f, -0.6694859f, 0.4551435f, -0.6294957f, -0.5496119f, 0.5492376f},
-{-0.6294957f, -0.5496119f, 0.5492376f, -0.5431195f, -0.5339705f, 0.6479944f},
-{-0.5431195f, -0.5339705f, 0.6479944f, -0.4833124f, -0.6181760f, 0.6198932f},
-{-0.4833124f, -0.6181760f, 0.6198932f, -0.3887886f, -0.5743283f, 0.7204099f},
-{-0.3887886f, -0.5743283f, 0.7204099f, -0.3656858f, -0.4978360f, 0.7864052f},
-{-0.3656858f, -0.4978360f, 0.7864052f, -0.3402324f, -0.5165615f, 0.7857519f},
-{-0.3402324f, -0.5165615f, 0.7857519f, -0.3887886f, -0.5743283f, 0.7204099f},
-{0.9280280f, -0.2319713f, -0.2914675f, 0.9510677f, -0.2291652f, -0.2072525f},
-{0.9510677f, -0.2291652f, -0.2072525f, 0.9314819f, -0.2660355f, -0.2481263f},
-{0.9314819f, -0.2660355f, -0.2481263f, 0.9280280f, -0.2319713f, -0.2914675f},
-{0.9280280f, -0.2319713f, -0.2914675f, 0.9459745f, -0.1888026f, -0.2636018f},
-{0.9459745f, -0.1888026f, -0.2636018f, 0.9563387f, -0.0950339f, -0.2763783f},
-{0.9563387f, -0.0950339f, -0.2763783f, 0.9348583f, -0.1509257f, -0.3213431f},
-{0.9348583f, -0.1509257f, -0.3213431f, 0.8894460f, -0.2140776f, -0.4038026f},
-{0.8894460f, -0.2140776f, -0.4038026f, 0.8618012f, -0.2253861f, -0.4544224f},
-{0.8618012f, -0.2253861f, -0.4544224f, 0.8659179f, -0.2389946f, -0.4393949f},
-{0.8659179f, -0.2389946f, -0.4393949f, 0.8619268f, -0.2651290f, -0.4321907f},
-{0.8619268f, -0.2651290f, -0.4321907f, 0.8187800f, -0.3146897f, -0.4801767f},
-{0.8187800f, -0.3146897f, -0.4801767f, 0.8619268f, -0.2651290f, -0.4321907f},
-{0.8619268f, -0.2651290f, -0.4321907f, 0.8912930f, -0.2514756f, -0.3773021f},
-{0.8912930f, -0.2514756f, -0.3773021f, 0.9459745f, -0.1888026f, -0.2636018f},
-{0.9038201f, -0.4181101f, 0.0910671f, 0.9188655f, -0.3672875f, 0.1441739f},
-{-0.1899007f, -0.7612492f, 0.6200301f, -0.1101091f, -0.7424813f, 0.6607553f},
-{0.6761899f, 0.2772050f, -0.6825867f, 0.7190480f, 0.2597182f, -0.6446056f},
-{0.7190480f, 0.2597182f, -0.6446056f, 0.7543227f, 0.2669036f, -0.5997997f},
-{0.4099303f, 0.3147922f, 0.8560742f, 0.3961497f, 0.3065430f, 0.8655038f},
-{0.3961497f, 0.3065430f, 0.8655038f, 0.3489320f, 0.2233230f, 0.9101502f},
-{0.3489320f, 0.2233230f, 0.9101502f, 0.2702215f, 0.1715567f, 0.9473904f},
-{0.2702215f, 0.1715567f, 0.9473904f, 0.3847647f, 0.1138812f, 0.9159624f},
-{0.3847647f, 0.1138812f, 0.9159624f, 0.4783434f, 0.1205547f, 0.8698587f},
-{0.4783434f, 0.1205547f, 0.8698587f, 0.5692793f, 0.1597849f, 0.8064675f},
-{-0.8075764f, 0.5553173f, -0.1986030f, -0.7949758f, 0.5618940f, -0.2286671f},
-{-0.7949758f, 0.5618940f, -0.2286671f, -0.6800235f, 0.6021366f, -0.4183295f},
-{-0.6800235f, 0.6021366f, -0.4183295f, -0.6628753f, 0.6171776f, -0.4238965f},
-{-0.6628753f, 0.6171776f, -0.4238965f, -0.5767257f, 0.7293886f, -0.3679397f},
-{-0.5767257f, 0.7293886f, -0.3679397f, -0.5528315f, 0.7901977f, -0.2645090f},
-{-0.5528315f, 0.7901977f, -0.2645090f, -0.5272472f, 0.8044917f, -0.2735022f},
-{-0.5272472f, 0.8044917f, -0.2735022f, -0.5528315f, 0.7901977f, -0.2645090f},
-{-0.5528315f, 0.7901977f, -0.2645090f, -0.6131242f, 0.7454123f, -0.2616090f},
-{-0.6131242f, 0.7454123f, -0.2616090f, -0.6592506f, 0.6943815f, -0.2884841f},
-{-0.6592506f, 0.6943815f, -0.2884841f, -0.7949758f, 0.5618940f, -0.2286671f},
-{0.6217748f, -0.0652186f, -0.7804759f, 0.5960657f, -0.1317490f, -0.7920529f},
-{0.5960657f, -0.1317490f, -0.7920529f, 0.5491662f, -0.3068505f, -0.7773412f},
-{0.5491662f, -0.3068505f, -0.7773412f, 0.4248111f, -0.3044527f, -0.8525515f},
-{0.4248111f, -0.3044527f, -0.8525515f, 0.3387260f, -0.3934232f, -0.8546829f},
-{0.3387260f, -0.3934232f, -0.8546829f, 0.2126625f, -0.4413049f, -0.8717939f},
-{0.2126625f, -0.4413049f, -0.8717939f, 0.1854717f, -0.4591932f, -0.8687588f},
-{0.1854717f, -0.4591932f, -0.8687588f, 0.1466428f, -0.4196655f, -0.8957549f},
-{0.1466428f, -0.4196655f, -0.8957549f, 0.1532393f, -0.3064682f, -0.9394652f},
-{0.1532393f, -0.3064682f, -0.9394652f, 0.2461525f, -0.2762756f, -0.9290214f},
-{0.2461525f, -0.2762756f, -0.9290214f, 0.2321853f, -0.3544843f, -0.9057764f},
-{0.2123107f, 0.3894257f, 0.8962543f, 0.1815762f, 0.4620415f, 0.8680713f},
-{0.1815762f, 0.4620415f, 0.8680713f, 0.1197972f, 0.4742316f, 0.8722116f},
-{0.1197972f, 0.4742316f, 0.8722116f, 0.0969530f, 0.5428045f, 0.8342442f},
-{0.0969530f, 0.5428045f, 0.8342442f, 0.0205310f, 0.5123852f, 0.8585102f},
-{0.0479207f, -0.4517627f, -0.8908502f, 0.0286729f, -0.4866856f, -0.8731065f},
-{0.0286729f, -0.4866856f, -0.8731065f, 0.1006948f, -0.5861112f, -0.8039491f},
-{0.1006948f, -0.5861112f, -0.8039491f, -0.0315437f, -0.6199163f, -0.7840336f},
-{-0.0315437f, -0.6199163f, -0.7840336f, -0.0237877f, -0.6519623f, -0.7578782f},
-{-0.0237877f, -0.6519623f, -0.7578782f, -0.0788230f, -0.6410370f, -0.7634517f},
-{-0.0788230f, -0.6410370f, -0.7634517f, -0.1107285f, -0.6669904f, -0.7367924f},
-{-0.1107285f, -0.6669904f, -0.7367924f, -0.1227772f, -0.6703330f, -0.7318330f},
-{-0.1227772f, -0.6703330f, -0.7318330f, -0.2568043f, -0.5514304f, -0.7937103f},
-{-0.2568043f, -0.5514304f, -0.7937103f, -0.2600835f, -0.4336085f, -0.8627515f},
-{-0.2600835f, -0.4336085f, -0.8627515f, -0.2568043f, -0.5514304f, -0.7937103f},
-{-0.2568043f, -0.5514304f, -0.7937103f, -0.3287860f, -0.3932295f, -0.8586445f},
-{-0.3287860f, -0.3932295f, -0.8586445f, -0.2568043f, -0.5514304f, -0.7937103f},
-{-0.2568043f, -0.5514304f, -0.7937103f, -0.3312151f, -0.6003666f, -0.7279124f},
-{-0.3312151f, -0.6003666f, -0.7279124f, -0.3445786f, -0.6646412f, -0.6629613f},
-{-0.3445786f, -0.6646412f, -0.6629613f, -0.3506356f, -0.6771316f, -0.6469525f},
-{-0.3506356f, -0.6771316f, -0.6469525f, -0.2811736f, -0.7663049f, -0.5776835f},
-{-0.2811736f, -0.7663049f, -0.5776835f, -0.3506356f, -0.6771316f, -0.6469525f},
-{-0.3506356f, -0.6771316f, -0.6469525f, -0.4267491f, -0.6917531f, -0.5825486f},
-{-0.4267491f, -0.6917531f, -0.5825486f, -0.3506356f, -0.6771316f, -0.6469525f},
-{-0.3506356f, -0.6771316f, -0.6469525f, -0.3672890f, -0.6473893f, -0.6678217f},
-{-0.3672890f, -0.6473893f, -0.6678217f, -0.4675867f, -0.5799696f, -0.6670816f},
-{-0.4675867f, -0.5799696f, -0.6670816f, -0.5244132f, -0.5282639f, -0.6677784f},
-{-0.0192753f, 0.2133122f, 0.9767939f, -0.2041396f, 0.2628435f, 0.9429954f},
-{-0.2041396f, 0.2628435f, 0.9429954f, -0.2981342f, 0.3508645f, 0.8876993f},
-{-0.2981342f, 0.3508645f, 0.8876993f, -0.2415681f, 0.4683053f, 0.8499029f},
-{-0.2415681f, 0.4683053f, 0.8499029f, -0.1218830f, 0.3846897f, 0.9149636f},
-{-0.1218830f, 0.3846897f, 0.9149636f, -0.0192753f, 0.2133122f, 0.9767939f},
-{0.6527085f, 0.7555034f, 0.0564459f, 0.5958122f, 0.7895340f, 0.1471189f},
-{0.5958122f, 0.7895340f, 0.1471189f, 0.6489110f, 0.7403212f, 0.1756101f},
-{0.6489110f, 0.7403212f, 0.1756101f, 0.6977095f, 0.6994470f, 0.1548397f},
-{0.6977095f, 0.6994470f, 0.1548397f, 0.7122878f, 0.6982548f, 0.0713185f},
-{0.7122878f, 0.6982548f, 0.0713185f, 0.6527085f, 0.7555034f, 0.0564459f},
-{0.6527085f, 0.7555034f, 0.0564459f, 0.6410485f, 0.7674790f, 0.0057353f},
-{0.6410485f, 0.7674790f, 0.0057353f, 0.5711420f, 0.8206573f, -0.0178450f},
-{0.5711420f, 0.8206573f, -0.0178450f, 0.4607558f, 0.8715033f, -0.1678872f},
-{0.4607558f, 0.8715033f, -0.1678872f, 0.3551323f, 0.9248697f, -0.1360038f},
-{0.3551323f, 0.9248697f, -0.1360038f, 0.2905148f, 0.9415549f, -0.1705152f},
-{0.2905148f, 0.9415549f, -0.1705152f, 0.1817169f, 0.9438642f, -0.2758610f},
-{0.1817169f, 0.9438642f, -0.2758610f, 0.3572449f, 0.8667232f, -0.3480903f},
-{0.3572449f, 0.8667232f, -0.3480903f, 0.4670507f, 0.8089147f, -0.3571003f},
-{0.4670507f, 0.8089147f, -0.3571003f, 0.4607558f, 0.8715033f, -0.1678872f},
-{0.2118483f, -0.1463172f, -0.9662875f, 0.1906358f, -0.1342816f, -0.9724333f},
-{0.1906358f, -0.1342816f, -0.9724333f, 0.0582142f, -0.1721388f, -0.9833511f},
-{0.0582142f, -0.1721388f, -0.9833511f, -0.0156845f, -0.1955273f, -0.9805728f},
-{-0.0156845f, -0.1955273f, -0.9805728f, 0.0786955f, -0.2035959f, -0.9758871f},
-{0.0786955f, -0.2035959f, -0.9758871f, 0.2118483f, -0.1463172f, -0.9662875f},
-{-0.4111825f, -0.3526959f, -0.8405561f, -0.2953554f, -0.3442726f, -0.8912023f},
-{-0.2953554f, -0.3442726f, -0.8912023f, -0.4030947f, -0.3282341f, -0.8542699f},
-{0.6965720f, -0.6874330f, 0.2054830f, 0.7152749f, -0.6255421f, 0.3115749f},
-{0.7152749f, -0.6255421f, 0.3115749f, 0.8171639f, -0.5538598f, 0.1596323f},
-{0.8171639f, -0.5538598f, 0.1596323f, 0.7152749f, -0.6255421f, 0.3115749f},
-{0.7152749f, -0.6255421f, 0.3115749f, 0.7042478f, -0.6083463f, 0.3659915f},
-{0.7042478f, -0.6083463f, 0.3659915f, 0.6547979f, -0.5828742f, 0.4811418f},
-{0.8388743f, -0.0811931f, -0.5382356f, 0.8184177f, -0.0592093f, -0.5715652f},
-{0.8184177f, -0.0592093f, -0.5715652f, 0.8219309f, 0.0088347f, -0.5695187f},
-{0.8219309f, 0.0088347f, -0.5695187f, 0.8261267f, 0.0326030f, -0.5625404f},
-{0.8261267f, 0.0326030f, -0.5625404f, 0.7525853f, 0.0028022f, -0.6584888f},
-{0.7525853f, 0.0028022f, -0.6584888f, 0.8261267f, 0.0326030f, -0.5625404f},
-{0.8261267f, 0.0326030f, -0.5625404f, 0.8264913f, 0.0735867f, -0.5581193f},
-{0.8264913f, 0.0735867f, -0.5581193f, 0.8233017f, 0.1545043f, -0.5461710f},
-{-0.2866954f, -0.9094431f, 0.3011959f, -0.2726893f, -0.8408323f, 0.4675913f},
-{-0.2726893f, -0.8408323f, 0.4675913f, -0.1032845f, -0.8746622f, 0.4736015f},
-{-0.7736530f, 0.2026875f, -0.6003155f, -0.7659692f, 0.2284121f, -0.6009319f},
-{-0.7659692f, 0.2284121f, -0.6009319f, -0.7711953f, 0.2412038f, -0.5891337f},
-{-0.7711953f, 0.2412038f, -0.5891337f, -0.7447055f, 0.2349060f, -0.6246863f},
-{-0.7447055f, 0.2349060f, -0.6246863f, -0.7375291f, 0.2267116f, -0.6361231f},
-{-0.7375291f, 0.2267116f, -0.6361231f, -0.7162121f, 0.2023807f, -0.6678939f},
-{-0.7538389f, -0.4289220f, 0.4977479f, -0.7677355f, -0.4540903f, 0.4520888f},
-{-0.7677355f, -0.4540903f, 0.4520888f, -0.7567397f, -0.4839785f, 0.4394428f},
-{-0.7567397f, -0.4839785f, 0.4394428f, -0.7404894f, -0.5053959f, 0.4430016f},
-{-0.7404894f, -0.5053959f, 0.4430016f, -0.7196425f, -0.5291700f, 0.4495485f},
-{-0.7196425f, -0.5291700f, 0.4495485f, -0.6880998f, -0.5384330f, 0.4864243f},
-{-0.6880998f, -0.5384330f, 0.4864243f, -0.6840521f, -0.5111314f, 0.5204012f},
-{0.0166406f, -0.9569264f, -0.2898532f, 0.0633066f, -0.9508257f, -0.3031877f},
-{0.0633066f, -0.9508257f, -0.3031877f, 0.1464866f, -0.9484811f, -0.2809366f},
-{0.1464866f, -0.9484811f, -0.2809366f, 0.1952345f, -0.9118196f, -0.3612042f},
-{0.1952345f, -0.9118196f, -0.3612042f, 0.2474687f, -0.9199521f, -0.3040515f},
-{0.2474687f, -0.9199521f, -0.3040515f, 0.1717986f, -0.9582145f, -0.2287143f},
-{0.1717986f, -0.9582145f, -0.2287143f, 0.1464866f, -0.9484811f, -0.2809366f},
-{0.1464866f, -0.9484811f, -0.2809366f, 0.1717986f, -0.9582145f, -0.2287143f},
-{0.1717986f, -0.9582145f, -0.2287143f, 0.1518520f, -0.9755539f, -0.1588569f},
-{0.1518520f, -0.9755539f, -0.1588569f, 0.1005321f, -0.9846630f, -0.1425905f},
-{-0.0527491f, -0.4524676f, -0.8902194f, -0.0740583f, -0.5412538f, -0.8375916f},
-{-0.1085887f, -0.5139565f, -0.8509155f, -0.0357219f, -0.5397774f, -0.8410495f},
-{-0.0337160f, -0.9180268f, -0.3950824f, -0.0411250f, -0.9302728f, -0.3645563f},
-{-0.0411250f, -0.9302728f, -0.3645563f, -0.0660913f, -0.9567473f, -0.2833133f},
-{-0.0660913f, -0.9567473f, -0.2833133f, -0.1252256f, -0.9555323f, -0.2669767f},
-{-0.1252256f, -0.9555323f, -0.2669767f, -0.1379961f, -0.9128159f, -0.3843490f},
-{-0.1379961f, -0.9128159f, -0.3843490f, -0.0411250f, -0.9302728f, -0.3645563f},
-{-0.8149735f, 0.3405836f, 0.4688508f, -0.7151846f, 0.3976853f, 0.5747672f},
-{-0.7151846f, 0.3976853f, 0.5747672f, -0.6208564f, 0.4437865f, 0.6462128f},
-{-0.6208564f, 0.4437865f, 0.6462128f, -0.6206218f, 0.5501025f, 0.5587628f},
-{-0.6206218f, 0.5501025f, 0.5587628f, -0.5755253f, 0.6444630f, 0.5034263f},
-{-0.5755253f, 0.6444630f, 0.5034263f, -0.6206218f, 0.5501025f, 0.5587628f},
-{-0.6206218f, 0.5501025f, 0.5587628f, -0.6208564f, 0.4437865f, 0.6462128f},
-{-0.6208564f, 0.4437865f, 0.6462128f, -0.5361831f, 0.4556490f, 0.7105573f},
-{-0.5361831f, 0.4556490f, 0.7105573f, -0.6208564f, 0.4437865f, 0.6462128f},
-{-0.6208564f, 0.4437865f, 0.6462128f, -0.6327690f, 0.3119613f, 0.7087196f},
-{-0.6327690f, 0.3119613f, 0.7087196f, -0.5725296f, 0.2362866f, 0.7850978f},
-{-0.7695189f, 0.6078021f, 0.1960032f, -0.7479314f, 0.6140846f, 0.2519896f},
-{-0.7479314f, 0.6140846f, 0.2519896f, -0.7376674f, 0.6169954f, 0.2741597f},
-{-0.7376674f, 0.6169954f, 0.2741597f, -0.7176619f, 0.6386181f, 0.2777199f},
-{-0.7176619f, 0.6386181f, 0.2777199f, -0.7302342f, 0.6317591f, 0.2600739f},
-{-0.7302342f, 0.6317591f, 0.2600739f, -0.7479314f, 0.6140846f, 0.2519896f},
-{0.5715743f, 0.2786931f, -0.7717726f, 0.5342610f, 0.2104600f, -0.8187013f},
-{0.5342610f, 0.2104600f, -0.8187013f, 0.5360251f, 0.1299010f, -0.8341480f},
-{0.5360251f, 0.1299010f, -0.8341480f, 0.4738459f, 0.0547735f, -0.8789027f},
-{0.4738459f, 0.0547735f, -0.8789027f, 0.4332602f, 0.0288277f, -0.9008077f},
-{0.4332602f, 0.0288277f, -0.9008077f, 0.4738459f, 0.0547735f, -0.8789027f},
-{0.4738459f, 0.0547735f, -0.8789027f, 0.4552387f, 0.0117188f, -0.8902923f},
-{-0.5462820f, -0.0154300f, 0.8374592f, -0.6225981f, -0.0092190f, 0.7824874f},
-{-0.6225981f, -0.0092190f, 0.7824874f, -0.6064262f, -0.0786713f, 0.7912384f},
-{-0.6064262f, -0.0786713f, 0.7912384f, -0.5667382f, -0.0691433f, 0.8209915f},
-{-0.5667382f, -0.0691433f, 0.8209915f, -0.5462820f, -0.0154300f, 0.8374592f},
-{-0.5462820f, -0.0154300f, 0.8374592f, -0.3611874f, 0.1183247f, 0.9249556f},
-{-0.3611874f, 0.1183247f, 0.9249556f, -0.3007098f, 0.1535059f, 0.9412808f},
-{-0.3007098f, 0.1535059f, 0.9412808f, -0.2955767f, 0.0272334f, 0.9549308f},
-{-0.2955767f, 0.0272334f, 0.9549308f, -0.3055931f, -0.0241334f, 0.9518563f},
-{-0.3055931f, -0.0241334f, 0.9518563f, -0.4010543f, -0.0911418f, 0.9115090f},
-{-0.4010543f, -0.0911418f, 0.9115090f, -0.4357006f, -0.1940054f, 0.8789351f},
-{-0.4357006f, -0.1940054f, 0.8789351f, -0.4537886f, -0.2570332f, 0.8532349f},
-{-0.4537886f, -0.2570332f, 0.8532349f, -0.4019669f, -0.3228145f, 0.8568625f},
-{-0.4019669f, -0.3228145f, 0.8568625f, -0.2233643f, -0.3703179f, 0.9016502f},
-{-0.2233643f, -0.3703179f, 0.9016502f, -0.0502961f, -0.3418086f, 0.9384227f},
-{-0.0502961f, -0.3418086f, 0.9384227f, 0.0439278f, -0.3502227f, 0.9356358f},
-{0.0439278f, -0.3502227f, 0.9356358f, 0.0880618f, -0.1224232f, 0.9885634f},
-{-0.6538883f, 0.7510424f, 0.0914630f, -0.6285978f, 0.7686349f, 0.1185965f},
-{-0.6285978f, 0.7686349f, 0.1185965f, -0.6509879f, 0.7389314f, 0.1737675f},
-{-0.6509879f, 0.7389314f, 0.1737675f, -0.6639724f, 0.7267710f, 0.1759108f},
-{0.9706423f, 0.2247597f, -0.0856536f, 0.9544255f, 0.2877264f, -0.0792807f},
-{0.9544255f, 0.2877264f, -0.0792807f, 0.9465439f, 0.3189994f, -0.0478958f},
-{0.9465439f, 0.3189994f, -0.0478958f, 0.9330803f, 0.3566897f, -0.0461912f},
-{0.9330803f, 0.3566897f, -0.0461912f, 0.8871257f, 0.4526715f, -0.0899808f},
-{0.8871257f, 0.4526715f, -0.0899808f, 0.8412980f, 0.4954141f, -0.2162929f},
-{0.8412980f, 0.4954141f, -0.2162929f, 0.8186663f, 0.5561127f, -0.1432623f},
-{0.8186663f, 0.5561127f, -0.1432623f, 0.7921856f, 0.5919300f, -0.1485286f},
-{0.7921856f, 0.5919300f, -0.1485286f, 0.6906617f, 0.7125313f, -0.1236352f},
-{0.6906617f, 0.7125313f, -0.1236352f, 0.6417810f, 0.7374826f, -0.2103248f},
-{0.6417810f, 0.7374826f, -0.2103248f, 0.6294030f, 0.7170442f, -0.2994988f},
-{0.6294030f, 0.7170442f, -0.2994988f, 0.6606555f, 0.6470087f, -0.3806759f},
-{0.6606555f, 0.6470087f, -0.3806759f, 0.7174588f, 0.6046024f, -0.3459897f},
-{0.7174588f, 0.6046024f, -0.3459897f, 0.7530854f, 0.5583310f, -0.3480358f},
-{0.7530854f, 0.5583310f, -0.3480358f, 0.7708876f, 0.5061458f, -0.3867154f},
-{0.7708876f, 0.5061458f, -0.3867154f, 0.7819809f, 0.4805606f, -0.3969477f},
-{0.7819809f, 0.4805606f, -0.3969477f, 0.7911048f, 0.4570898f, -0.4064753f},
-{0.7911048f, 0.4570898f, -0.4064753f, 0.8124314f, 0.3136949f, -0.4914781f},
-{0.8124314f, 0.3136949f, -0.4914781f, 0.7575685f, 0.3371460f, -0.5589477f},
-{0.7575685f, 0.3371460f, -0.5589477f, 0.7635805f, 0.3646387f, -0.5329009f},
-{0.7635805f, 0.3646387f, -0.5329009f, 0.6830084f, 0.4374112f, -0.5849537f},
-{0.6830084f, 0.4374112f, -0.5849537f, 0.6763617f, 0.4367282f, -0.5931301f},
-{0.6763617f, 0.4367282f, -0.5931301f, 0.6243821f, 0.4490980f, -0.6391072f},
-{0.6243821f, 0.4490980f, -0.6391072f, 0.5607376f, 0.4708136f, -0.6811079f},
-{0.5607376f, 0.4708136f, -0.6811079f, 0.5399642f, 0.5481702f, -0.6387081f},
-{0.5399642f, 0.5481702f, -0.6387081f, 0.5072746f, 0.6009873f, -0.6176461f},
-{0.5072746f, 0.6009873f, -0.6176461f, 0.4838159f, 0.5776122f, -0.6574848f},
-{0.4838159f, 0.5776122f, -0.6574848f, 0.4133651f, 0.5536385f, -0.7229203f},
-{0.4133651f, 0.5536385f, -0.7229203f, 0.3569554f, 0.5266762f, -0.7714889f},
-{0.3569554f, 0.5266762f, -0.7714889f, 0.3089859f, 0.5576643f, -0.7704143f},
-{0.3089859f, 0.5576643f, -0.7704143f, 0.2266724f, 0.4990308f, -0.8364137f},
-{0.6622564f, 0.5959234f, -0.4541935f, 0.5729563f, 0.6302783f, -0.5238992f},
-{0.5729563f, 0.6302783f, -0.5238992f, 0.4533569f, 0.7508715f, -0.4802703f},
-{0.9185509f, -0.0165145f, 0.3949577f, 0.9218894f, -0.0599256f, 0.3827909f},
-{0.9218894f, -0.0599256f, 0.3827909f, 0.9191567f, -0.0923922f, 0.3829029f},
-{0.9191567f, -0.0923922f, 0.3829029f, 0.8887562f, -0.1724817f, 0.4246911f},
-{0.8887562f, -0.1724817f, 0.4246911f, 0.9309356f, -0.1182786f, 0.3454984f},
-{0.9309356f, -0.1182786f, 0.3454984f, 0.8887562f, -0.1724817f, 0.4246911f},
-{0.8887562f, -0.1724817f, 0.4246911f, 0.8225918f, -0.2638678f, 0.5037028f},
-{0.8225918f, -0.2638678f, 0.5037028f, 0.7865856f, -0.3222481f, 0.5267250f},
-{0.7865856f, -0.3222481f, 0.5267250f, 0.7777653f, -0.3406059f, 0.5282696f},
-{0.7777653f, -0.3406059f, 0.5282696f, 0.7865856f, -0.3222481f, 0.5267250f},
-{0.7865856f, -0.3222481f, 0.5267250f, 0.8225918f, -0.2638678f, 0.5037028f},
-{0.8225918f, -0.2638678f, 0.5037028f, 0.8075125f, -0.1893570f, 0.5586301f},
-{0.8075125f, -0.1893570f, 0.5586301f, 0.8225918f, -0.2638678f, 0.5037028f},
-{0.8225918f, -0.2638678f, 0.5037028f, 0.8234305f, -0.3232240f, 0.4663566f},
-{0.8234305f, -0.3232240f, 0.4663566f, 0.8148516f, -0.3624616f, 0.4523699f},
-{0.8148516f, -0.3624616f, 0.4523699f, 0.7911623f, -0.3915108f, 0.4698739f},
-{0.7911623f, -0.3915108f, 0.4698739f, 0.8148516f, -0.3624616f, 0.4523699f},
-{0.8148516f, -0.3624616f, 0.4523699f, 0.8177500f, -0.4008181f, 0.4130735f},
-{0.8177500f, -0.4008181f, 0.4130735f, 0.8148516f, -0.3624616f, 0.4523699f},
-{0.8148516f, -0.3624616f, 0.4523699f, 0.8712062f, -0.3176242f, 0.3743189f},
-{0.8712062f, -0.3176242f, 0.3743189f, 0.8998514f, -0.2584886f, 0.3513560f},
-{0.8998514f, -0.2584886f, 0.3513560f, 0.9463601f, -0.1571427f, 0.2823275f},
-{0.9463601f, -0.1571427f, 0.2823275f, 0.8998514f, -0.2584886f, 0.3513560f},
-{0.8998514f, -0.2584886f, 0.3513560f, 0.8712062f, -0.3176242f, 0.3743189f},
-{0.8712062f, -0.3176242f, 0.3743189f, 0.9035044f, -0.3203619f, 0.2846893f},
-{0.9035044f, -0.3203619f, 0.2846893f, 0.9558070f, -0.1913794f, 0.2231745f},
-{-0.4194945f, 0.6840726f, -0.5967152f, -0.3733075f, 0.6883704f, -0.6219226f},
-{-0.3733075f, 0.6883704f, -0.6219226f, -0.2842918f, 0.6802049f, -0.6756474f},
-{-0.2842918f, 0.6802049f, -0.6756474f, -0.2336209f, 0.6658899f, -0.7085280f},
-{-0.2336209f, 0.6658899f, -0.7085280f, -0.3311057f, 0.6242517f, -0.7075866f},
-{-0.3311057f, 0.6242517f, -0.7075866f, -0.2336209f, 0.6658899f, -0.7085280f},
-{-0.2336209f, 0.6658899f, -0.7085280f, -0.1943363f, 0.6030710f, -0.7736529f},
-{-0.1943363f, 0.6030710f, -0.7736529f, -0.1596927f, 0.6052681f, -0.7798390f},
-{-0.1596927f, 0.6052681f, -0.7798390f, -0.1943363f, 0.6030710f, -0.7736529f},
-{-0.1943363f, 0.6030710f, -0.7736529f, -0.1526141f, 0.6935517f, -0.7040560f},
-{-0.1526141f, 0.6935517f, -0.7040560f, -0.1694157f, 0.7177977f, -0.6753257f},
-{-0.8288788f, -0.2209736f, 0.5139364f, -0.7852833f, -0.1560363f, 0.5991517f},
-{-0.7852833f, -0.1560363f, 0.5991517f, -0.7958898f, -0.0130123f, 0.6053017f},
-{-0.7958898f, -0.0130123f, 0.6053017f, -0.6917919f, -0.0621515f, 0.7194173f},
-{-0.6917919f, -0.0621515f, 0.7194173f, -0.7958898f, -0.0130123f, 0.6053017f},
-{-0.7958898f, -0.0130123f, 0.6053017f, -0.7852833f, -0.1560363f, 0.5991517f},
-{-0.7852833f, -0.1560363f, 0.5991517f, -0.7343851f, -0.2568303f, 0.6282649f},
-{-0.7343851f, -0.2568303f, 0.6282649f, -0.6867890f, -0.2701758f, 0.6747784f},
-{-0.6867890f, -0.2701758f, 0.6747784f, -0.6256681f, -0.2926184f, 0.7231279f},
-{-0.6256681f, -0.2926184f, 0.7231279f, -0.6867890f, -0.2701758f, 0.6747784f},
-{-0.6867890f, -0.2701758f, 0.6747784f, -0.7343851f, -0.2568303f, 0.6282649f},
-{-0.7343851f, -0.2568303f, 0.6282649f, -0.8019580f, -0.2868004f, 0.5240313f},
-{-0.8019580f, -0.2868004f, 0.5240313f, -0.8599959f, -0.3552552f, 0.3663343f},
-{-0.8599959f, -0.3552552f, 0.3663343f, -0.8019580f, -0.2868004f, 0.5240313f},
-{-0.8019580f, -0.2868004f, 0.5240313f, -0.8288788f, -0.2209736f, 0.5139364f},
-{-0.8288788f, -0.2209736f, 0.5139364f, -0.8900778f, -0.1769196f, 0.4200725f},
-{-0.8900778f, -0.1769196f, 0.4200725f, -0.8836820f, -0.0522747f, 0.4651597f},
-{-0.8836820f, -0.0522747f, 0.4651597f, -0.8724735f, -0.0085087f, 0.4885874f},
-{-0.8724735f, -0.0085087f, 0.4885874f, -0.8761470f, 0.0288479f, 0.4811800f},
-{0.3091309f, 0.3123942f, -0.8982472f, 0.3777791f, 0.3660508f, -0.8504645f},
-{0.3777791f, 0.3660508f, -0.8504645f, 0.3841077f, 0.4550936f, -0.8033375f},
-{0.3841077f, 0.4550936f, -0.8033375f, 0.3950959f, 0.4818257f, -0.7821401f},
-{0.3950959f, 0.4818257f, -0.7821401f, 0.4255743f, 0.4958324f, -0.7569919f},
-{0.4255743f, 0.4958324f, -0.7569919f, 0.4593685f, 0.4845742f, -0.7444249f},
-{0.4593685f, 0.4845742f, -0.7444249f, 0.6681369f, 0.3331147f, -0.6653027f},
-{0.6681369f, 0.3331147f, -0.6653027f, 0.6807230f, 0.3511844f, -0.6428730f},
-{0.7380308f, -0.6670570f, 0.1017122f, 0.7420249f, -0.6609846f, 0.1117965f},
-{0.7420249f, -0.6609846f, 0.1117965f, 0.7687518f, -0.6317783f, 0.0993825f},
-{0.7687518f, -0.6317783f, 0.0993825f, 0.7682121f, -0.6375367f, 0.0582852f},
-{0.7682121f, -0.6375367f, 0.0582852f, 0.7555925f, -0.6523538f, 0.0592822f},
-{0.7555925f, -0.6523538f, 0.0592822f, 0.7380308f, -0.6670570f, 0.1017122f},
-{0.7380308f, -0.6670570f, 0.1017122f, 0.7172967f, -0.6890253f, 0.1035834f},
-{0.7172967f, -0.6890253f, 0.1035834f, 0.6608870f, -0.7493984f, 0.0403788f},
-{0.6608870f, -0.7493984f, 0.0403788f, 0.5740244f, -0.8187015f, -0.0149608f},
-{0.5740244f, -0.8187015f, -0.0149608f, 0.6120231f, -0.7804484f, -0.1277811f},
-{0.6120231f, -0.7804484f, -0.1277811f, 0.5178949f, -0.8246225f, -0.2275578f},
-{0.5178949f, -0.8246225f, -0.2275578f, 0.4500114f, -0.8699090f, -0.2018615f},
-{0.4500114f, -0.8699090f, -0.2018615f, 0.3845181f, -0.8852817f, -0.2615762f},
-{0.3845181f, -0.8852817f, -0.2615762f, 0.2908365f, -0.9171800f, -0.2723875f},
-{0.2908365f, -0.9171800f, -0.2723875f, 0.1016379f, -0.8587881f, -0.5021481f},
-{0.1016379f, -0.8587881f, -0.5021481f, 0.0262047f, -0.8467913f, -0.5312795f},
-{0.0262047f, -0.8467913f, -0.5312795f, -0.3111517f, -0.8675614f, -0.3879714f},
-{-0.3111517f, -0.8675614f, -0.3879714f, -0.4735629f, -0.7699788f, -0.4276340f},
-{0.2444440f, 0.4286863f, -0.8697558f, 0.2430469f, 0.2907066f, -0.9254285f},
-{0.2430469f, 0.2907066f, -0.9254285f, 0.2340207f, 0.1530830f, -0.9601041f},
-{0.2340207f, 0.1530830f, -0.9601041f, 0.0257074f, 0.2278254f, -0.9733626f},
-{0.0257074f, 0.2278254f, -0.9733626f, 0.2444440f, 0.4286863f, -0.8697558f},
-{-0.5299336f, 0.4351633f, -0.7278758f, -0.3911276f, 0.4655774f, -0.7938872f},
-{-0.3911276f, 0.4655774f, -0.7938872f, -0.3055759f, 0.5183424f, -0.7987143f},
-{-0.3055759f, 0.5183424f, -0.7987143f, -0.2779833f, 0.4982089f, -0.8212875f},
-{-0.2779833f, 0.4982089f, -0.8212875f, -0.3055759f, 0.5183424f, -0.7987143f},
-{-0.3055759f, 0.5183424f, -0.7987143f, -0.3911276f, 0.4655774f, -0.7938872f},
-{-0.3911276f, 0.4655774f, -0.7938872f, -0.4130827f, 0.4324048f, -0.8014916f},
-{-0.4130827f, 0.4324048f, -0.8014916f, -0.3879459f, 0.3707615f, -0.8438210f},
-{0.2372421f, -0.7921711f, 0.5622999f, 0.3136249f, -0.7378095f, 0.5977262f},
-{0.3136249f, -0.7378095f, 0.5977262f, 0.3852072f, -0.7201428f, 0.5770700f},
-{-0.3467137f, 0.7106324f, 0.6122019f, -0.3435952f, 0.6882301f, 0.6389692f},
-{-0.3435952f, 0.6882301f, 0.6389692f, -0.2778770f, 0.6749185f, 0.6835711f},
-{-0.2778770f, 0.6749185f, 0.6835711f, -0.2433673f, 0.6733502f, 0.6981203f},
-{-0.2433673f, 0.6733502f, 0.6981203f, -0.2778770f, 0.6749185f, 0.6835711f},
-{-0.2778770f, 0.6749185f, 0.6835711f, -0.2879193f, 0.6247363f, 0.7258147f},
-{-0.2879193f, 0.6247363f, 0.7258147f, -0.2778770f, 0.6749185f, 0.6835711f},
-{-0.2778770f, 0.6749185f, 0.6835711f, -0.2587908f, 0.6211702f, 0.7397127f},
-{-0.2587908f, 0.6211702f, 0.7397127f, -0.2629429f, 0.5941808f, 0.7601383f},
-{-0.2629429f, 0.5941808f, 0.7601383f, -0.2502019f, 0.5590716f, 0.7904669f},
-{-0.2502019f, 0.5590716f, 0.7904669f, -0.2412047f, 0.5917304f, 0.7692044f},
-{-0.2412047f, 0.5917304f, 0.7692044f, -0.2587908f, 0.6211702f, 0.7397127f},
-{0.5055943f, -0.7627965f, 0.4031327f, 0.4737189f, -0.7637576f, 0.4384801f},
-{0.4737189f, -0.7637576f, 0.4384801f, 0.3997799f, -0.8259724f, 0.3974237f},
-{0.3997799f, -0.8259724f, 0.3974237f, 0.3976188f, -0.8524696f, 0.3394038f},
-{0.3976188f, -0.8524696f, 0.3394038f, 0.4519797f, -0.8441174f, 0.2884098f},
-{0.4519797f, -0.8441174f, 0.2884098f, 0.4578669f, -0.8645016f, 0.2073521f},
-{0.4578669f, -0.8645016f, 0.2073521f, 0.5609925f, -0.8097986f, 0.1717954f},
-{0.5609925f, -0.8097986f, 0.1717954f, 0.4578669f, -0.8645016f, 0.2073521f},
-{0.4578669f, -0.8645016f, 0.2073521f, 0.1911932f, -0.9448078f, 0.2660515f},
-{0.1911932f, -0.9448078f, 0.2660515f, 0.1541182f, -0.9710073f, 0.1827360f},
-{0.1541182f, -0.9710073f, 0.1827360f, 0.1678282f, -0.9802043f, 0.1050395f},
-{0.1678282f, -0.9802043f, 0.1050395f, 0.1541182f, -0.9710073f, 0.1827360f},
-{0.1541182f, -0.9710073f, 0.1827360f, 0.1911932f, -0.9448078f, 0.2660515f},
-{0.1911932f, -0.9448078f, 0.2660515f, 0.0461817f, -0.9667300f, 0.2515955f},
-{0.0461817f, -0.9667300f, 0.2515955f, 0.1862798f, -0.9178149f, 0.3505933f},
-{0.1862798f, -0.9178149f, 0.3505933f, 0.3976188f, -0.8524696f, 0.3394038f},
-{0.9033939f, 0.2191313f, -0.3685933f, 0.9350949f, 0.1303998f, -0.3295350f},
-{0.9350949f, 0.1303998f, -0.3295350f, 0.9536111f, 0.1140067f, -0.2786186f},
-{0.9536111f, 0.1140067f, -0.2786186f, 0.9420225f, 0.1962340f, -0.2721869f},
-{0.9420225f, 0.1962340f, -0.2721869f, 0.9536111f, 0.1140067f, -0.2786186f},
-{0.9536111f, 0.1140067f, -0.2786186f, 0.9720895f, 0.0553907f, -0.2279780f},
-{0.9720895f, 0.0553907f, -0.2279780f, 0.9708805f, 0.0152306f, -0.2390796f},
-{-0.8221508f, -0.5046786f, -0.2633773f, -0.7864243f, -0.5738560f, -0.2285302f},
-{-0.7864243f, -0.5738560f, -0.2285302f, -0.7490325f, -0.6453697f, -0.1498277f},
-{-0.7490325f, -0.6453697f, -0.1498277f, -0.6522661f, -0.7063695f, -0.2749382f},
-{-0.6522661f, -0.7063695f, -0.2749382f, -0.6536240f, -0.6308117f, -0.4181534f},
-{-0.6536240f, -0.6308117f, -0.4181534f, -0.7490325f, -0.6453697f, -0.1498277f},
-{-0.7490325f, -0.6453697f, -0.1498277f, -0.6536240f, -0.6308117f, -0.4181534f},
-{-0.6536240f, -0.6308117f, -0.4181534f, -0.7175294f, -0.5164284f, -0.4673899f},
-{-0.7175294f, -0.5164284f, -0.4673899f, -0.7187967f, -0.5096116f, -0.4728925f},
-{-0.7191448f, -0.3880632f, -0.5764006f, -0.6863250f, -0.3957643f, -0.6101874f},
-{-0.6863250f, -0.3957643f, -0.6101874f, -0.6104469f, -0.4470182f, -0.6538572f},
-{-0.6104469f, -0.4470182f, -0.6538572f, -0.5628440f, -0.4611680f, -0.6859524f},
-{-0.5628440f, -0.4611680f, -0.6859524f, -0.5042020f, -0.4542445f, -0.7344673f},
-{-0.5042020f, -0.4542445f, -0.7344673f, -0.4590516f, -0.4122994f, -0.7869440f},
-{-0.4590516f, -0.4122994f, -0.7869440f, -0.4459720f, -0.5224892f, -0.7267146f},
-{-0.4459720f, -0.5224892f, -0.7267146f, -0.5149396f, -0.5215805f, -0.6802875f},
-{-0.5149396f, -0.5215805f, -0.6802875f, -0.5953153f, -0.4934875f, -0.6340897f},
-{-0.5953153f, -0.4934875f, -0.6340897f, -0.6104469f, -0.4470182f, -0.6538572f},
-{-0.6104469f, -0.4470182f, -0.6538572f, -0.5953153f, -0.4934875f, -0.6340897f},
-{-0.5953153f, -0.4934875f, -0.6340897f, -0.6258843f, -0.5168266f, -0.5840883f},
-{-0.6258843f, -0.5168266f, -0.5840883f, -0.7142049f, -0.4508113f, -0.5354256f},
-{0.5275048f, -0.6345652f, 0.5648590f, 0.5177680f, -0.6107742f, 0.5990585f},
-{0.5177680f, -0.6107742f, 0.5990585f, 0.5377539f, -0.5693054f, 0.6218618f},
-{0.5377539f, -0.5693054f, 0.6218618f, 0.5257983f, -0.5287431f, 0.6663084f},
-{0.5257983f, -0.5287431f, 0.6663084f, 0.5920343f, -0.4255569f, 0.6843951f},
-{0.5920343f, -0.4255569f, 0.6843951f, 0.6070658f, -0.2413150f, 0.7571249f},
-{0.6070658f, -0.2413150f, 0.7571249f, 0.5073841f, -0.1295074f, 0.8519326f},
-{0.5073841f, -0.1295074f, 0.8519326f, 0.5129898f, -0.0440314f, 0.8572647f},
-{-0.7694143f, 0.1250946f, 0.6263809f, -0.7771663f, 0.1537891f, 0.6102143f},
-{-0.7771663f, 0.1537891f, 0.6102143f, -0.8153445f, 0.1810561f, 0.5499383f},
-{-0.8153445f, 0.1810561f, 0.5499383f, -0.8139288f, 0.2140744f, 0.5400853f},
-{-0.8139288f, 0.2140744f, 0.5400853f, -0.7771888f, 0.1883927f, 0.6004047f},
-{-0.7771888f, 0.1883927f, 0.6004047f, -0.7771663f, 0.1537891f, 0.6102143f},
-{0.2879597f, -0.0128747f, -0.9575560f, 0.2458323f, 0.0303133f, -0.9688383f},
-{0.2458323f, 0.0303133f, -0.9688383f, 0.2797472f, 0.0812917f, -0.9566259f},
-{0.2797472f, 0.0812917f, -0.9566259f, 0.3204745f, 0.0818120f, -0.9437176f},
-{-0.4962220f, 0.5953729f, -0.6318978f, -0.5519706f, 0.6459226f, -0.5273637f},
-{-0.5519706f, 0.6459226f, -0.5273637f, -0.5979417f, 0.6047199f, -0.5260985f},
-{-0.5979417f, 0.6047199f, -0.5260985f, -0.6238189f, 0.5714662f, -0.5331757f},
-{0.9816169f, -0.1419050f, 0.1276368f, 0.9914333f, -0.1031907f, 0.0800733f},
-{0.9914333f, -0.1031907f, 0.0800733f, 0.9774076f, -0.2071304f, 0.0420888f},
-{0.9774076f, -0.2071304f, 0.0420888f, 0.9512032f, -0.3084453f, 0.0086005f},
-{0.9512032f, -0.3084453f, 0.0086005f, 0.9847796f, -0.1244794f, -0.1213015f},
-{0.9847796f, -0.1244794f, -0.1213015f, 0.9929222f, -0.0644487f, -0.0997587f},
-{0.9929222f, -0.0644487f, -0.0997587f, 0.9847796f, -0.1244794f, -0.1213015f},
-{0.9847796f, -0.1244794f, -0.1213015f, 0.9512032f, -0.3084453f, 0.0086005f},
-{0.9512032f, -0.3084453f, 0.0086005f, 0.8941847f, -0.4229020f, -0.1469271f},
-{0.8941847f, -0.4229020f, -0.1469271f, 0.8465402f, -0.5320293f, -0.0177336f},
-{-0.0754862f, -0.3687066f, -0.9264757f, -0.0582445f, -0.3558404f, -0.9327300f},
-{-0.0582445f, -0.3558404f, -0.9327300f, -0.0898007f, -0.3223358f, -0.9423563f},
-{-0.0898007f, -0.3223358f, -0.9423563f, -0.0582445f, -0.3558404f, -0.9327300f},
-{-0.0582445f, -0.3558404f, -0.9327300f, -0.0439416f, -0.3081071f, -0.9503363f},
-{-0.0439416f, -0.3081071f, -0.9503363f, -0.0582445f, -0.3558404f, -0.9327300f},
-{-0.0582445f, -0.3558404f, -0.9327300f, -0.0311006f, -0.4049194f, -0.9138233f},
-{-0.0311006f, -0.4049194f, -0.9138233f, 0.0262544f, -0.4174960f, -0.9082994f},
-{-0.6333130f, -0.2714873f, -0.7247133f, -0.5842558f, -0.2729397f, -0.7642965f},
-{-0.5842558f, -0.2729397f, -0.7642965f, -0.5753463f, -0.3215007f, -0.7520731f},
-{-0.0516868f, 0.1545989f, -0.9866244f, -0.0797941f, -0.1069400f, -0.9910584f},
-{-0.0797941f, -0.1069400f, -0.9910584f, -0.1316041f, 0.1905486f, -0.9728163f},
-{-0.1316041f, 0.1905486f, -0.9728163f, -0.0516868f, 0.1545989f, -0.9866244f},
-{-0.9702372f, -0.1065367f, 0.2174619f, -0.9503770f, -0.2650446f, 0.1628955f},
-{-0.9503770f, -0.2650446f, 0.1628955f, -0.9248426f, -0.3787714f, 0.0346185f},
-{-0.9248426f, -0.3787714f, 0.0346185f, -0.8948800f, -0.4444900f, -0.0402287f},
-{-0.8948800f, -0.4444900f, -0.0402287f, -0.9016842f, -0.4285289f, -0.0576947f},
-{-0.9016842f, -0.4285289f, -0.0576947f, -0.9227321f, -0.3488631f, -0.1638903f},
-{-0.9227321f, -0.3488631f, -0.1638903f, -0.9464951f, -0.2081943f, -0.2465809f},
-{-0.9464951f, -0.2081943f, -0.2465809f, -0.9942340f, -0.0718199f, 0.0796287f},
-{-0.9942340f, -0.0718199f, 0.0796287f, -0.9702372f, -0.1065367f, 0.2174619f},
-{0.9964771f, 0.0838590f, -0.0009987f, 0.9880378f, 0.0528328f, -0.1448791f},
-{0.9880378f, 0.0528328f, -0.1448791f, 0.9713234f, 0.1952431f, -0.1356868f},
-{0.9713234f, 0.1952431f, -0.1356868f, 0.9925362f, 0.1218388f, 0.0052214f},
-{0.9925362f, 0.1218388f, 0.0052214f, 0.9823850f, 0.1506258f, 0.1105968f},
-{0.9823850f, 0.1506258f, 0.1105968f, 0.9792166f, 0.1066436f, 0.1725165f},
-{0.9792166f, 0.1066436f, 0.1725165f, 0.9914355f, 0.0208902f, 0.1289158f},
-{0.9914355f, 0.0208902f, 0.1289158f, 0.9858041f, -0.0102520f, 0.1675861f},
-{0.9858041f, -0.0102520f, 0.1675861f, 0.9680920f, -0.0504814f, 0.2454578f},
-{0.9680920f, -0.0504814f, 0.2454578f, 0.9664368f, -0.0319404f, 0.2549114f},
-{0.9664368f, -0.0319404f, 0.2549114f, 0.9377517f, 0.0229932f, 0.3465446f},
-{0.9377517f, 0.0229932f, 0.3465446f, 0.9387268f, -0.0160578f, 0.3442879f},
-{0.9387268f, -0.0160578f, 0.3442879f, 0.9680920f, -0.0504814f, 0.2454578f},
-{0.9680920f, -0.0504814f, 0.2454578f, 0.9858041f, -0.0102520f, 0.1675861f},
-{0.9858041f, -0.0102520f, 0.1675861f, 0.9914355f, 0.0208902f, 0.1289158f},
-{0.9914355f, 0.0208902f, 0.1289158f, 0.9964771f, 0.0838590f, -0.0009987f},
-{0.9964771f, 0.0838590f, -0.0009987f, 0.9945223f, 0.1035926f, -0.0139282f},
-{0.9945223f, 0.1035926f, -0.0139282f, 0.9925362f, 0.1218388f, 0.0052214f},
-{0.9925362f, 0.1218388f, 0.0052214f, 0.9823850f, 0.1506258f, 0.1105968f},
-{0.9823850f, 0.1506258f, 0.1105968f, 0.9464776f, 0.2991499f, 0.1212004f},
-{0.9464776f, 0.2991499f, 0.1212004f, 0.9507196f, 0.2942666f, 0.0976697f},
-{0.9507196f, 0.2942666f, 0.0976697f, 0.9582610f, 0.2827056f, 0.0425829f},
-{0.9582610f, 0.2827056f, 0.0425829f, 0.9638356f, 0.2648135f, 0.0299134f},
-{0.9638356f, 0.2648135f, 0.0299134f, 0.9582610f, 0.2827056f, 0.0425829f},
-{0.9582610f, 0.2827056f, 0.0425829f, 0.9507196f, 0.2942666f, 0.0976697f},
-{0.9507196f, 0.2942666f, 0.0976697f, 0.9464776f, 0.2991499f, 0.1212004f},
-{0.9464776f, 0.2991499f, 0.1212004f, 0.9430229f, 0.2945693f, 0.1547152f},
-{0.9430229f, 0.2945693f, 0.1547152f, 0.9350788f, 0.2664892f, 0.2336905f},
-{0.9350788f, 0.2664892f, 0.2336905f, 0.9360144f, 0.2309107f, 0.2656262f},
-{0.9360144f, 0.2309107f, 0.2656262f, 0.9400708f, 0.2097001f, 0.2688731f},
-{-0.4585424f, 0.3382159f, -0.8217961f, -0.3082822f, 0.2702571f, -0.9120983f},
-{-0.3082822f, 0.2702571f, -0.9120983f, -0.2660367f, 0.3357852f, -0.9035888f},
-{-0.2660367f, 0.3357852f, -0.9035888f, -0.3082822f, 0.2702571f, -0.9120983f},
-{-0.3082822f, 0.2702571f, -0.9120983f, -0.2802524f, 0.1627699f, -0.9460257f},
-{-0.2802524f, 0.1627699f, -0.9460257f, -0.3267761f, 0.0620921f, -0.9430599f},
-{-0.3267761f, 0.0620921f, -0.9430599f, -0.4488204f, -0.0279753f, -0.8931840f},
-{-0.4488204f, -0.0279753f, -0.8931840f, -0.4640273f, 0.0173801f, -0.8856504f},
-{-0.4640273f, 0.0173801f, -0.8856504f, -0.4898045f, 0.0498101f, -0.8704082f},
-{-0.4898045f, 0.0498101f, -0.8704082f, -0.4601513f, 0.1066926f, -0.8814065f},
-{-0.4601513f, 0.1066926f, -0.8814065f, -0.3467007f, 0.2181742f, -0.9122492f},
-{-0.3467007f, 0.2181742f, -0.9122492f, -0.3082822f, 0.2702571f, -0.9120983f},
-{-0.3865135f, 0.7423801f, 0.5472468f, -0.2848755f, 0.8157771f, 0.5033426f},
-{-0.2848755f, 0.8157771f, 0.5033426f, -0.2142804f, 0.8558513f, 0.4707467f},
-{-0.2142804f, 0.8558513f, 0.4707467f, 0.0319767f, 0.8732671f, 0.4861913f},
-{0.0319767f, 0.8732671f, 0.4861913f, -0.2142804f, 0.8558513f, 0.4707467f},
-{-0.2142804f, 0.8558513f, 0.4707467f, -0.2303397f, 0.9370986f, 0.2622781f},
-{-0.2303397f, 0.9370986f, 0.2622781f, 0.0557087f, 0.9634823f, 0.2619131f},
-{0.0557087f, 0.9634823f, 0.2619131f, 0.0319767f, 0.8732671f, 0.4861913f},
-{0.0319767f, 0.8732671f, 0.4861913f, 0.0557087f, 0.9634823f, 0.2619131f},
-{0.0557087f, 0.9634823f, 0.2619131f, -0.2303397f, 0.9370986f, 0.2622781f},
-{-0.2303397f, 0.9370986f, 0.2622781f, -0.3300337f, 0.9250751f, 0.1879194f},
-{-0.3300337f, 0.9250751f, 0.1879194f, -0.4582800f, 0.8822267f, 0.1079608f},
-{-0.4582800f, 0.8822267f, 0.1079608f, -0.5502426f, 0.8172032f, 0.1714992f},
-{0.5527098f, 0.5146518f, 0.6554734f, 0.5215783f, 0.4800500f, 0.7053425f},
-{0.5215783f, 0.4800500f, 0.7053425f, 0.5015533f, 0.4049796f, 0.7644840f},
-{0.5015533f, 0.4049796f, 0.7644840f, 0.4292487f, 0.4116467f, 0.8039232f},
-{0.4292487f, 0.4116467f, 0.8039232f, 0.5015533f, 0.4049796f, 0.7644840f},
-{0.5015533f, 0.4049796f, 0.7644840f, 0.5552472f, 0.3783203f, 0.7406580f},
-{0.5552472f, 0.3783203f, 0.7406580f, 0.6596980f, 0.3891607f, 0.6429250f},
-{0.6596980f, 0.3891607f, 0.6429250f, 0.7006417f, 0.4087456f, 0.5848318f},
-{0.7006417f, 0.4087456f, 0.5848318f, 0.7242510f, 0.4432494f, 0.5281955f},
-{0.0854470f, 0.7418041f, -0.6651507f, 0.2000857f, 0.6745774f, -0.7105710f},
-{0.2000857f, 0.6745774f, -0.7105710f, 0.2764703f, 0.6811627f, -0.6779245f},
-{0.2764703f, 0.6811627f, -0.6779245f, 0.2547409f, 0.6056225f, -0.7538756f},
-{0.2547409f, 0.6056225f, -0.7538756f, 0.2764703f, 0.6811627f, -0.6779245f},
-{0.2764703f, 0.6811627f, -0.6779245f, 0.2000857f, 0.6745774f, -0.7105710f},
-{0.2000857f, 0.6745774f, -0.7105710f, 0.1696504f, 0.5515857f, -0.8166835f},
-{0.1696504f, 0.5515857f, -0.8166835f, 0.1036843f, 0.5415631f, -0.8342415f},
-{0.1036843f, 0.5415631f, -0.8342415f, 0.0294062f, 0.7156676f, -0.6978217f},
-{0.0294062f, 0.7156676f, -0.6978217f, 0.0854470f, 0.7418041f, -0.6651507f},
-{0.4881208f, -0.1041763f, -0.8665364f, 0.5610491f, 0.0249170f, -0.8274074f},
-{0.5610491f, 0.0249170f, -0.8274074f, 0.6292508f, 0.0349465f, -0.7764162f},
-{-0.2364135f, 0.8474755f, -0.4752830f, -0.3024591f, 0.8384668f, -0.4533122f},
-{-0.3024591f, 0.8384668f, -0.4533122f, -0.3991431f, 0.8033057f, -0.4420234f},
-{-0.3991431f, 0.8033057f, -0.4420234f, -0.4405122f, 0.7694632f, -0.4624666f},
-{-0.4405122f, 0.7694632f, -0.4624666f, -0.4767244f, 0.7322479f, -0.4863608f},
-{-0.4767244f, 0.7322479f, -0.4863608f, -0.4662391f, 0.6974247f, -0.5442608f},
-{-0.4662391f, 0.6974247f, -0.5442608f, -0.4011013f, 0.7574153f, -0.5152084f},
-{-0.4011013f, 0.7574153f, -0.5152084f, -0.3205817f, 0.7885596f, -0.5247868f},
-{-0.3205817f, 0.7885596f, -0.5247868f, -0.2484019f, 0.8192145f, -0.5168986f},
-{-0.2484019f, 0.8192145f, -0.5168986f, -0.2353041f, 0.8199053f, -0.5219073f},
-{-0.2353041f, 0.8199053f, -0.5219073f, -0.2364135f, 0.8474755f, -0.4752830f},
-{0.2875955f, 0.8626793f, 0.4160207f, 0.3020784f, 0.8360017f, 0.4580937f},
-{0.3020784f, 0.8360017f, 0.4580937f, 0.2661532f, 0.8232892f, 0.5013555f},
-{0.2661532f, 0.8232892f, 0.5013555f, 0.2875955f, 0.8626793f, 0.4160207f},
-{0.2875955f, 0.8626793f, 0.4160207f, 0.3747979f, 0.8885324f, 0.2646446f},
-{0.3747979f, 0.8885324f, 0.2646446f, 0.4381702f, 0.8846903f, 0.1591537f},
-{0.4381702f, 0.8846903f, 0.1591537f, 0.5071233f, 0.8605238f, 0.0482154f},
-{0.5071233f, 0.8605238f, 0.0482154f, 0.4263088f, 0.8995087f, 0.0956286f},
-{0.4263088f, 0.8995087f, 0.0956286f, 0.2686351f, 0.9534105f, 0.1372717f},
-{0.2686351f, 0.9534105f, 0.1372717f, 0.2089825f, 0.9689701f, 0.1319969f},
-{0.2089825f, 0.9689701f, 0.1319969f, -0.0029819f, 0.9928295f, 0.1195015f},
-{-0.0029819f, 0.9928295f, 0.1195015f, -0.0869521f, 0.9913764f, 0.0980413f},
-{-0.0869521f, 0.9913764f, 0.0980413f, -0.1384474f, 0.9841181f, 0.1111028f},
-{-0.1384474f, 0.9841181f, 0.1111028f, -0.1714138f, 0.9807251f, 0.0937849f},
-{-0.1714138f, 0.9807251f, 0.0937849f, -0.1855119f, 0.9809726f, 0.0572543f},
-{-0.1855119f, 0.9809726f, 0.0572543f, -0.1437460f, 0.9893720f, 0.0219118f},
-{-0.1437460f, 0.9893720f, 0.0219118f, -0.0782183f, 0.9964522f, 0.0310619f},
-{-0.0782183f, 0.9964522f, 0.0310619f, -0.0592328f, 0.9963899f, 0.0608163f},
-{-0.0592328f, 0.9963899f, 0.0608163f, -0.0869521f, 0.9913764f, 0.0980413f},
-{0.7775161f, -0.4836944f, -0.4018812f, 0.8169491f, -0.4220878f, -0.3929836f},
-{0.8169491f, -0.4220878f, -0.3929836f, 0.8220183f, -0.3781803f, -0.4257530f},
-{0.8220183f, -0.3781803f, -0.4257530f, 0.8103333f, -0.3581601f, -0.4637686f},
-{0.8103333f, -0.3581601f, -0.4637686f, 0.7547837f, -0.2641120f, -0.6004551f},
-{0.7547837f, -0.2641120f, -0.6004551f, 0.7237473f, -0.1203402f, -0.6794911f},
-{0.7237473f, -0.1203402f, -0.6794911f, 0.6355776f, -0.1407199f, -0.7591041f},
-{0.6355776f, -0.1407199f, -0.7591041f, 0.6799288f, -0.2789631f, -0.6781419f},
-{0.6799288f, -0.2789631f, -0.6781419f, 0.6573737f, -0.3933716f, -0.6427430f},
-{0.6573737f, -0.3933716f, -0.6427430f, 0.7775161f, -0.4836944f, -0.4018812f},
-{0.6296239f, -0.5288012f, -0.5691599f, 0.6352679f, -0.5502459f, -0.5419079f},
-{0.6352679f, -0.5502459f, -0.5419079f, 0.6596092f, -0.6072415f, -0.4429147f},
-{0.4270611f, 0.2119369f, -0.8790345f, 0.4674444f, 0.2267730f, -0.8544412f},
-{0.4674444f, 0.2267730f, -0.8544412f, 0.4237883f, 0.2477783f, -0.8712114f},
-{0.4237883f, 0.2477783f, -0.8712114f, 0.4096207f, 0.2343626f, -0.8816377f},
-{0.4096207f, 0.2343626f, -0.8816377f, 0.3741040f, 0.2518616f, -0.8925312f},
-{0.3741040f, 0.2518616f, -0.8925312f, 0.4270611f, 0.2119369f, -0.8790345f},
-{0.2219888f, 0.8490885f, -0.4793430f, -0.0426958f, 0.8829811f, -0.4674627f},
-{-0.0426958f, 0.8829811f, -0.4674627f, -0.1524206f, 0.8392019f, -0.5220231f},
-{-0.1524206f, 0.8392019f, -0.5220231f, -0.0949693f, 0.8015427f, -0.5903474f},
-{-0.8337542f, -0.4553251f, -0.3123027f, -0.8272969f, -0.3805651f, -0.4132192f},
-{-0.8272969f, -0.3805651f, -0.4132192f, -0.8071138f, -0.4644235f, -0.3645247f},
-{-0.8071138f, -0.4644235f, -0.3645247f, -0.8272969f, -0.3805651f, -0.4132192f},
-{-0.8272969f, -0.3805651f, -0.4132192f, -0.7768697f, -0.4537311f, -0.4365794f},
-{-0.7768697f, -0.4537311f, -0.4365794f, -0.8272969f, -0.3805651f, -0.4132192f},
-{-0.8272969f, -0.3805651f, -0.4132192f, -0.8325105f, -0.3473650f, -0.4315829f},
-{-0.8325105f, -0.3473650f, -0.4315829f, -0.8257884f, -0.3174729f, -0.4661379f},
-{-0.8257884f, -0.3174729f, -0.4661379f, -0.7935652f, -0.2495885f, -0.5549412f},
-{-0.7935652f, -0.2495885f, -0.5549412f, -0.7539354f, -0.2309689f, -0.6150080f},
-{-0.7539354f, -0.2309689f, -0.6150080f, -0.7171123f, -0.2104344f, -0.6644300f},
-{-0.7171123f, -0.2104344f, -0.6644300f, -0.7182522f, -0.1521670f, -0.6789396f},
-{-0.7182522f, -0.1521670f, -0.6789396f, -0.7509918f, -0.0745618f, -0.6560883f},
-{-0.7509918f, -0.0745618f, -0.6560883f, -0.7663409f, -0.0415538f, -0.6410888f},
-{-0.7663409f, -0.0415538f, -0.6410888f, -0.7752069f, -0.0593484f, -0.6289134f},
-{-0.7752069f, -0.0593484f, -0.6289134f, -0.7944288f, -0.0918893f, -0.6003659f},
-{-0.7944288f, -0.0918893f, -0.6003659f, -0.7952174f, -0.1019990f, -0.5976835f},
-{-0.9773132f, 0.2040601f, -0.0567315f, -0.9791838f, 0.1516148f, -0.1349518f},
-{-0.9791838f, 0.1516148f, -0.1349518f, -0.9647546f, 0.1235808f, -0.2323279f},
-{-0.9647546f, 0.1235808f, -0.2323279f, -0.9791838f, 0.1516148f, -0.1349518f},
-{-0.9791838f, 0.1516148f, -0.1349518f, -0.9871225f, 0.1022631f, -0.1230097f},
-{-0.9668181f, -0.1668754f, -0.1934306f, -0.9630791f, -0.0944873f, -0.2520928f},
-{-0.9630791f, -0.0944873f, -0.2520928f, -0.9779851f, -0.0794814f, -0.1929454f},
-{-0.9779851f, -0.0794814f, -0.1929454f, -0.9954964f, 0.0928313f, -0.0192168f},
-{-0.9954964f, 0.0928313f, -0.0192168f, -0.9674308f, 0.2422989f, 0.0732720f},
-{-0.8042976f, -0.5314030f, 0.2659253f, -0.7986469f, -0.5149888f, 0.3113676f},
-{-0.7986469f, -0.5149888f, 0.3113676f, -0.8263222f, -0.4942825f, 0.2699563f},
-{-0.8263222f, -0.4942825f, 0.2699563f, -0.8042976f, -0.5314030f, 0.2659253f},
-{-0.8042976f, -0.5314030f, 0.2659253f, -0.7923409f, -0.5820234f, 0.1828790f},
-{-0.7923409f, -0.5820234f, 0.1828790f, -0.8244797f, -0.5547152f, 0.1119122f},
-{-0.8244797f, -0.5547152f, 0.1119122f, -0.8427206f, -0.5326601f, 0.0780724f},
-{-0.8427206f, -0.5326601f, 0.0780724f, -0.8416522f, -0.5381556f, -0.0448351f},
-{-0.8416522f, -0.5381556f, -0.0448351f, -0.9668181f, -0.1668754f, -0.1934306f},
-{0.3814838f, -0.9243087f, 0.0111165f, 0.4696992f, -0.8828027f, 0.0064868f},
-{0.4696992f, -0.8828027f, 0.0064868f, 0.5230381f, -0.8411682f, -0.1373581f},
-{-0.8189358f, 0.4669075f, 0.3336789f, -0.8459396f, 0.4281878f, 0.3178701f},
-{-0.8459396f, 0.4281878f, 0.3178701f, -0.8617124f, 0.4022657f, 0.3092475f},
-{-0.8617124f, 0.4022657f, 0.3092475f, -0.8459396f, 0.4281878f, 0.3178701f},
-{-0.8459396f, 0.4281878f, 0.3178701f, -0.8626217f, 0.4070612f, 0.3003081f},
-{-0.7217124f, 0.2766300f, -0.6345132f, -0.6698945f, 0.3685124f, -0.6445463f},
-{-0.6698945f, 0.3685124f, -0.6445463f, -0.6782655f, 0.2557486f, -0.6888749f},
-{-0.6782655f, 0.2557486f, -0.6888749f, -0.6698945f, 0.3685124f, -0.6445463f},
-{-0.6698945f, 0.3685124f, -0.6445463f, -0.7122661f, 0.4101366f, -0.5696183f},
-{-0.7122661f, 0.4101366f, -0.5696183f, -0.7711933f, 0.4572566f, -0.4429191f},
-{-0.7711933f, 0.4572566f, -0.4429191f, -0.7786729f, 0.4358398f, -0.4513448f},
-{-0.7786729f, 0.4358398f, -0.4513448f, -0.8390388f, 0.3766683f, -0.3926002f},
-{-0.8390388f, 0.3766683f, -0.3926002f, -0.8582992f, 0.2580737f, -0.4435318f},
-{-0.8582992f, 0.2580737f, -0.4435318f, -0.8749813f, 0.2151792f, -0.4337115f},
-{-0.8749813f, 0.2151792f, -0.4337115f, -0.9010240f, 0.2612744f, -0.3462535f},
-{-0.9010240f, 0.2612744f, -0.3462535f, -0.8908017f, 0.2798577f, -0.3579832f},
-{-0.8908017f, 0.2798577f, -0.3579832f, -0.9001740f, 0.3350996f, -0.2781996f},
-{-0.9001740f, 0.3350996f, -0.2781996f, -0.9090753f, 0.3386541f, -0.2426839f},
-{-0.9090753f, 0.3386541f, -0.2426839f, -0.9001740f, 0.3350996f, -0.2781996f},
-{-0.9001740f, 0.3350996f, -0.2781996f, -0.8908017f, 0.2798577f, -0.3579832f},
-{-0.8908017f, 0.2798577f, -0.3579832f, -0.9010240f, 0.2612744f, -0.3462535f},
-{-0.9010240f, 0.2612744f, -0.3462535f, -0.9047630f, 0.2328508f, -0.3566293f},
-{-0.9047630f, 0.2328508f, -0.3566293f, -0.9010240f, 0.2612744f, -0.3462535f},
-{-0.9010240f, 0.2612744f, -0.3462535f, -0.8749813f, 0.2151792f, -0.4337115f},
-{-0.8749813f, 0.2151792f, -0.4337115f, -0.8883168f, 0.1793447f, -0.4227633f},
-{-0.8883168f, 0.1793447f, -0.4227633f, -0.8492560f, 0.2379622f, -0.4713155f},
-{-0.8492560f, 0.2379622f, -0.4713155f, -0.8582992f, 0.2580737f, -0.4435318f},
-{-0.8582992f, 0.2580737f, -0.4435318f, -0.8492560f, 0.2379622f, -0.4713155f},
-{-0.8492560f, 0.2379622f, -0.4713155f, -0.8883168f, 0.1793447f, -0.4227633f},
-{-0.8883168f, 0.1793447f, -0.4227633f, -0.9026295f, 0.1107090f, -0.4159369f},
-{-0.9026295f, 0.1107090f, -0.4159369f, -0.8778384f, 0.0806427f, -0.4721192f},
-{-0.8778384f, 0.0806427f, -0.4721192f, -0.8694239f, 0.0220391f, -0.4935751f},
-{-0.8694239f, 0.0220391f, -0.4935751f, -0.8778384f, 0.0806427f, -0.4721192f},
-{-0.8778384f, 0.0806427f, -0.4721192f, -0.8281462f, 0.0876689f, -0.5536136f},
-{-0.8281462f, 0.0876689f, -0.5536136f, -0.8143446f, 0.0627557f, -0.5769789f},
-{0.9282528f, 0.0908320f, 0.3606887f, 0.8949729f, 0.3439064f, 0.2841687f},
-{0.8949729f, 0.3439064f, 0.2841687f, 0.8724373f, 0.4077824f, 0.2693821f},
-{0.8724373f, 0.4077824f, 0.2693821f, 0.8469736f, 0.4856555f, 0.2162739f},
-{0.8469736f, 0.4856555f, 0.2162739f, 0.7697175f, 0.6187950f, 0.1569324f},
-{0.7697175f, 0.6187950f, 0.1569324f, 0.8469736f, 0.4856555f, 0.2162739f},
-{0.8469736f, 0.4856555f, 0.2162739f, 0.8724373f, 0.4077824f, 0.2693821f},
-{0.8724373f, 0.4077824f, 0.2693821f, 0.8692482f, 0.3918644f, 0.3014132f},
-{0.8692482f, 0.3918644f, 0.3014132f, 0.8703970f, 0.3667008f, 0.3285416f},
-{0.8703970f, 0.3667008f, 0.3285416f, 0.8684416f, 0.1286598f, 0.4788068f},
-{-0.7179245f, 0.0352066f, -0.6952301f, -0.7139821f, 0.0844211f, -0.6950558f},
-{-0.7139821f, 0.0844211f, -0.6950558f, -0.6517996f, 0.0824329f, -0.7538979f},
-{-0.3415789f, -0.1098910f, -0.9334066f, -0.2941855f, -0.2492448f, -0.9226765f},
-{-0.2941855f, -0.2492448f, -0.9226765f, -0.3338989f, -0.2409927f, -0.9112815f},
-{-0.3338989f, -0.2409927f, -0.9112815f, -0.3939826f, -0.2387414f, -0.8875698f},
-{-0.3939826f, -0.2387414f, -0.8875698f, -0.3415789f, -0.1098910f, -0.9334066f},
-{0.4388211f, 0.6918495f, 0.5733937f, 0.4683671f, 0.6858609f, 0.5569803f},
-{0.4683671f, 0.6858609f, 0.5569803f, 0.4119081f, 0.7659436f, 0.4936215f},
-{0.4119081f, 0.7659436f, 0.4936215f, 0.4388211f, 0.6918495f, 0.5733937f},
-{-0.1783974f, 0.4169021f, -0.8912727f, -0.2159473f, 0.4553051f, -0.8637500f},
-{-0.2159473f, 0.4553051f, -0.8637500f, -0.0985095f, 0.5242301f, -0.8458597f},
-{-0.0985095f, 0.5242301f, -0.8458597f, -0.0001570f, 0.4317272f, -0.9020042f},
-{-0.0001570f, 0.4317272f, -0.9020042f, 0.0395388f, 0.4503087f, -0.8919970f},
-{0.0395388f, 0.4503087f, -0.8919970f, 0.0664313f, 0.4795901f, -0.8749744f},
-{0.0664313f, 0.4795901f, -0.8749744f, -0.0985095f, 0.5242301f, -0.8458597f},
-{-0.2947999f, -0.5814596f, 0.7582861f, -0.2057585f, -0.5365440f, 0.8184033f},
-{-0.2057585f, -0.5365440f, 0.8184033f, -0.1307443f, -0.5442928f, 0.8286443f},
-{-0.1307443f, -0.5442928f, 0.8286443f, -0.0366008f, -0.5429309f, 0.8389794f},
-{-0.0366008f, -0.5429309f, 0.8389794f, 0.0159381f, -0.5918729f, 0.8058737f},
-{0.0159381f, -0.5918729f, 0.8058737f, 0.0408775f, -0.6707419f, 0.7405636f},
-{0.0408775f, -0.6707419f, 0.7405636f, 0.1509527f, -0.8240626f, 0.5460167f},
-{0.1509527f, -0.8240626f, 0.5460167f, 0.1546624f, -0.8382250f, 0.5229325f},
-{0.1546624f, -0.8382250f, 0.5229325f, 0.1509527f, -0.8240626f, 0.5460167f},
-{0.1509527f, -0.8240626f, 0.5460167f, 0.0408775f, -0.6707419f, 0.7405636f},
-{0.0408775f, -0.6707419f, 0.7405636f, 0.1554021f, -0.6961326f, 0.7008920f},
-{0.1554021f, -0.6961326f, 0.7008920f, 0.3096129f, -0.6819708f, 0.6626128f},
-{0.3096129f, -0.6819708f, 0.6626128f, 0.3178970f, -0.6597797f, 0.6809055f},
-{0.3178970f, -0.6597797f, 0.6809055f, 0.3096129f, -0.6819708f, 0.6626128f},
-{0.3096129f, -0.6819708f, 0.6626128f, 0.1554021f, -0.6961326f, 0.7008920f},
-{0.1554021f, -0.6961326f, 0.7008920f, 0.0408775f, -0.6707419f, 0.7405636f},
-{0.0408775f, -0.6707419f, 0.7405636f, 0.0159381f, -0.5918729f, 0.8058737f},
-{0.0159381f, -0.5918729f, 0.8058737f, 0.1389921f, -0.5359151f, 0.8327522f},
-{0.1389921f, -0.5359151f, 0.8327522f, 0.1150476f, -0.4591116f, 0.8808976f},
-{0.1150476f, -0.4591116f, 0.8808976f, -0.0366008f, -0.5429309f, 0.8389794f},
-{-0.0366008f, -0.5429309f, 0.8389794f, 0.1150476f, -0.4591116f, 0.8808976f},
-{0.1150476f, -0.4591116f, 0.8808976f, 0.2733824f, -0.3612415f, 0.8914968f},
-{0.2733824f, -0.3612415f, 0.8914968f, 0.3876906f, -0.2981983f, 0.8722234f},
-{0.3876906f, -0.2981983f, 0.8722234f, 0.2745425f, -0.4350814f, 0.8575142f},
-{0.2745425f, -0.4350814f, 0.8575142f, 0.1389921f, -0.5359151f, 0.8327522f},
-{0.1389921f, -0.5359151f, 0.8327522f, 0.2745425f, -0.4350814f, 0.8575142f},
-{0.2745425f, -0.4350814f, 0.8575142f, 0.3713263f, -0.4966181f, 0.7845299f},
-{0.3713263f, -0.4966181f, 0.7845299f, 0.4731647f, -0.4883747f, 0.7332158f},
-{0.4731647f, -0.4883747f, 0.7332158f, 0.4743982f, -0.4711252f, 0.7436312f},
-{0.0078982f, 0.0101264f, 0.9999175f, -0.0591065f, -0.0072011f, 0.9982257f},
-{-0.0591065f, -0.0072011f, 0.9982257f, -0.1313650f, -0.0439743f, 0.9903583f},
-{-0.1313650f, -0.0439743f, 0.9903583f, -0.1753049f, -0.1181797f, 0.9773954f},
-{-0.1753049f, -0.1181797f, 0.9773954f, -0.1850724f, -0.2007279f, 0.9620065f},
-{-0.1850724f, -0.2007279f, 0.9620065f, -0.2394676f, -0.1996438f, 0.9501566f},
-{-0.2394676f, -0.1996438f, 0.9501566f, -0.2218644f, -0.1064127f, 0.9692536f},
-{-0.2218644f, -0.1064127f, 0.9692536f, -0.1753049f, -0.1181797f, 0.9773954f},
-{0.5797261f, -0.3675093f, -0.7272239f, 0.4499158f, -0.3935365f, -0.8016887f},
-{0.4499158f, -0.3935365f, -0.8016887f, 0.3647190f, -0.4428856f, -0.8190436f},
-{0.3647190f, -0.4428856f, -0.8190436f, 0.3049200f, -0.5118296f, -0.8031527f},
-{0.3049200f, -0.5118296f, -0.8031527f, 0.2078114f, -0.6280877f, -0.7498802f},
-{0.2078114f, -0.6280877f, -0.7498802f, 0.2372755f, -0.6287747f, -0.7405017f},
-{0.2372755f, -0.6287747f, -0.7405017f, 0.3300808f, -0.6674033f, -0.6675474f},
-{0.3300808f, -0.6674033f, -0.6675474f, 0.4676389f, -0.6133084f, -0.6365270f},
-{0.4676389f, -0.6133084f, -0.6365270f, 0.5022866f, -0.5386207f, -0.6764583f},
-{0.5022866f, -0.5386207f, -0.6764583f, 0.5656837f, -0.4934773f, -0.6606679f},
-{0.5656837f, -0.4934773f, -0.6606679f, 0.5829995f, -0.4790729f, -0.6562017f},
-{0.5829995f, -0.4790729f, -0.6562017f, 0.5797261f, -0.3675093f, -0.7272239f},
-{-0.3567445f, -0.9150809f, -0.1880432f, -0.2995873f, -0.9508929f, -0.0777824f},
-{-0.2995873f, -0.9508929f, -0.0777824f, -0.1807683f, -0.9834788f, -0.0096089f},
-{-0.1807683f, -0.9834788f, -0.0096089f, -0.2398199f, -0.9690069f, 0.0592628f},
-{-0.2398199f, -0.9690069f, 0.0592628f, -0.4014999f, -0.9158000f, 0.0103991f},
-{-0.4014999f, -0.9158000f, 0.0103991f, -0.3567445f, -0.9150809f, -0.1880432f},
-{0.2889307f, -0.2951665f, -0.9107117f, 0.3289916f, -0.2428565f, -0.9125707f},
-{0.3289916f, -0.2428565f, -0.9125707f, 0.3261985f, -0.2036929f, -0.9230947f},
-{0.3261985f, -0.2036929f, -0.9230947f, 0.3834508f, -0.1335880f, -0.9138489f},
-{0.3834508f, -0.1335880f, -0.9138489f, 0.3345515f, -0.1034784f, -0.9366790f},
-{0.3345515f, -0.1034784f, -0.9366790f, 0.2880870f, -0.1371328f, -0.9477344f},
-{0.2880870f, -0.1371328f, -0.9477344f, 0.3261985f, -0.2036929f, -0.9230947f},
-{-0.8801021f, 0.3039744f, 0.3647188f, -0.8415394f, 0.3430190f, 0.4173120f},
-{-0.8415394f, 0.3430190f, 0.4173120f, -0.8033623f, 0.4337499f, 0.4080074f}
-};
\ No newline at end of file
@@ -10,10 +10,17 @@ struct s_cline {
   float x2;
   float y2;
   float z2;
+
+  //bounding cone used to cull lines outside the field of view
+  float mx; //unit vector to midpoint
+  float my;
+  float mz;
+  float cos_half; //half-angle subtended by the line
+  float sin_half;
 };
 
-extern const s_cline clines[];
-extern const uint16_t num_clines;
+//lines are read from the "CLIN" section of the catalog blob
+static_assert(sizeof(s_cline) == 44, "s_cline must match model/make_constellation_lines.py");
 
 #endif
 
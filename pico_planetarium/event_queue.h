@@ -0,0 +1,45 @@
+#ifndef __EVENT_QUEUE_H__
+#define __EVENT_QUEUE_H__
+
+#include <atomic>
+#include <cstdint>
+
+//Lock free queue for one producer (e.g. an interrupt handler) and one
+//consumer (the main loop). Holds size-1 events, size must be a power of 2.
+//When the queue is full new events are dropped.
+template<typename T, uint8_t size> class c_event_queue
+{
+  static_assert((size & (size-1)) == 0, "size must be a power of 2");
+
+  T m_events[size];
+  std::atomic<uint8_t> m_head{0}; //written by the producer
+  std::atomic<uint8_t> m_tail{0}; //written by the consumer
+
+  public:
+
+  bool push(const T &event)
+  {
+    const uint8_t head = m_head.load(std::memory_order_relaxed);
+    const uint8_t next = (head + 1) & (size - 1);
+    if(next == m_tail.load(std::memory_order_acquire)) return false;
+    m_events[head] = event;
+    m_head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &event)
+  {
+    const uint8_t tail = m_tail.load(std::memory_order_relaxed);
+    if(tail == m_head.load(std::memory_order_acquire)) return false;
+    event = m_events[tail];
+    m_tail.store((tail + 1) & (size - 1), std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const
+  {
+    return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+  }
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef __FAST_TRIG_H__
+#define __FAST_TRIG_H__
+
+//single precision trig in degrees, see fast_trig.cpp for error bounds
+float fast_sind(float degrees);
+float fast_cosd(float degrees);
+void fast_sincosd(float degrees, float &s, float &c);
+float fast_tand(float degrees);
+float fast_atan2d(float y, float x);
+float fast_atand(float x);
+float fast_asind(float x);
+
+#endif
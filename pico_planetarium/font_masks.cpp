@@ -0,0 +1,213 @@
+
+#include "font_masks.h"
+static const uint16_t font_8x5_rows[] = {
+0x0010, 0x0018, 0x0017, 0x0013, 0x0017, 0x0018, 0x0010, 0x0000,
+0x0000, 0x000e, 0x001f, 0x001f, 0x001f, 0x000e, 0x0000, 0x0000,
+0x0018, 0x001c, 0x001e, 0x001f, 0x001e, 0x001c, 0x0018, 0x0000,
+0x0003, 0x0007, 0x000f, 0x001f, 0x000f, 0x0007, 0x0003, 0x0000,
+0x0000, 0x001f, 0x0011, 0x0011, 0x0011, 0x0011, 0x001f, 0x0000,
+0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0004, 0x0000,
+0x000a, 0x000a, 0x000a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x000a, 0x000a, 0x001f, 0x000a, 0x001f, 0x000a, 0x000a, 0x0000,
+0x0004, 0x001e, 0x0005, 0x000e, 0x0014, 0x000f, 0x0004, 0x0000,
+0x0003, 0x0013, 0x0008, 0x0004, 0x0002, 0x0019, 0x0018, 0x0000,
+0x0002, 0x0005, 0x0005, 0x0002, 0x0015, 0x0009, 0x0016, 0x0000,
+0x000c, 0x000c, 0x0004, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0008, 0x0004, 0x0002, 0x0002, 0x0002, 0x0004, 0x0008, 0x0000,
+0x0002, 0x0004, 0x0008, 0x0008, 0x0008, 0x0004, 0x0002, 0x0000,
+0x0004, 0x0015, 0x000e, 0x001f, 0x000e, 0x0015, 0x0004, 0x0000,
+0x0000, 0x0004, 0x0004, 0x001f, 0x0004, 0x0004, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x0004, 0x0002,
+0x0000, 0x0000, 0x0000, 0x001f, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x0000,
+0x0000, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001, 0x0000, 0x0000,
+0x000e, 0x0011, 0x0019, 0x0015, 0x0013, 0x0011, 0x000e, 0x0000,
+0x0004, 0x0006, 0x0004, 0x0004, 0x0004, 0x0004, 0x000e, 0x0000,
+0x000e, 0x0011, 0x0010, 0x000e, 0x0001, 0x0001, 0x001f, 0x0000,
+0x001f, 0x0010, 0x0008, 0x000c, 0x0010, 0x0011, 0x000e, 0x0000,
+0x0008, 0x000c, 0x000a, 0x0009, 0x001f, 0x0008, 0x0008, 0x0000,
+0x001f, 0x0001, 0x000f, 0x0010, 0x0010, 0x0011, 0x000e, 0x0000,
+0x001c, 0x0002, 0x0001, 0x000f, 0x0011, 0x0011, 0x000e, 0x0000,
+0x001f, 0x0010, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001, 0x0000,
+0x000e, 0x0011, 0x0011, 0x000e, 0x0011, 0x0011, 0x000e, 0x0000,
+0x000e, 0x0011, 0x0011, 0x001e, 0x0010, 0x0008, 0x0007, 0x0000,
+0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0004, 0x0002, 0x0000,
+0x0010, 0x0008, 0x0004, 0x0002, 0x0004, 0x0008, 0x0010, 0x0000,
+0x0000, 0x0000, 0x001f, 0x0000, 0x001f, 0x0000, 0x0000, 0x0000,
+0x0002, 0x0004, 0x0008, 0x0010, 0x0008, 0x0004, 0x0002, 0x0000,
+0x000e, 0x0011, 0x0010, 0x000c, 0x0004, 0x0000, 0x0004, 0x0000,
+0x000e, 0x0011, 0x0015, 0x001d, 0x000d, 0x0001, 0x001e, 0x0000,
+0x0004, 0x000a, 0x0011, 0x0011, 0x001f, 0x0011, 0x0011, 0x0000,
+0x000f, 0x0011, 0x0011, 0x000f, 0x0011, 0x0011, 0x000f, 0x0000,
+0x000e, 0x0011, 0x0001, 0x0001, 0x0001, 0x0011, 0x000e, 0x0000,
+0x000f, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x000f, 0x0000,
+0x001f, 0x0001, 0x0001, 0x000f, 0x0001, 0x0001, 0x001f, 0x0000,
+0x001f, 0x0001, 0x0001, 0x000f, 0x0001, 0x0001, 0x0001, 0x0000,
+0x001e, 0x0011, 0x0001, 0x0001, 0x0019, 0x0011, 0x001e, 0x0000,
+0x0011, 0x0011, 0x0011, 0x001f, 0x0011, 0x0011, 0x0011, 0x0000,
+0x000e, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x000e, 0x0000,
+0x001c, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0006, 0x0000,
+0x0011, 0x0009, 0x0005, 0x0003, 0x0005, 0x0009, 0x0011, 0x0000,
+0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x001f, 0x0000,
+0x0011, 0x001b, 0x0015, 0x0015, 0x0015, 0x0011, 0x0011, 0x0000,
+0x0011, 0x0011, 0x0013, 0x0015, 0x0019, 0x0011, 0x0011, 0x0000,
+0x000e, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x000e, 0x0000,
+0x000f, 0x0011, 0x0011, 0x000f, 0x0001, 0x0001, 0x0001, 0x0000,
+0x000e, 0x0011, 0x0011, 0x0011, 0x0015, 0x0009, 0x0016, 0x0000,
+0x000f, 0x0011, 0x0011, 0x000f, 0x0005, 0x0009, 0x0011, 0x0000,
+0x000e, 0x0011, 0x0001, 0x000e, 0x0010, 0x0011, 0x000e, 0x0000,
+0x001f, 0x0015, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x000e, 0x0000,
+0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x000a, 0x0004, 0x0000,
+0x0011, 0x0011, 0x0011, 0x0015, 0x0015, 0x0015, 0x000a, 0x0000,
+0x0011, 0x0011, 0x000a, 0x0004, 0x000a, 0x0011, 0x0011, 0x0000,
+0x0011, 0x0011, 0x000a, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+0x001f, 0x0010, 0x0008, 0x000e, 0x0002, 0x0001, 0x001f, 0x0000,
+0x001e, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x001e, 0x0000,
+0x0000, 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0000, 0x0000,
+0x001e, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x001e, 0x0000,
+0x0004, 0x000a, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001f, 0x0000,
+0x0006, 0x0006, 0x0004, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0006, 0x0008, 0x000e, 0x0009, 0x001e, 0x0000,
+0x0001, 0x0001, 0x000d, 0x0013, 0x0011, 0x0013, 0x000d, 0x0000,
+0x0000, 0x0000, 0x000e, 0x0011, 0x0001, 0x0011, 0x000e, 0x0000,
+0x0010, 0x0010, 0x0016, 0x0019, 0x0011, 0x0019, 0x0016, 0x0000,
+0x0000, 0x0000, 0x000e, 0x0011, 0x001f, 0x0001, 0x000e, 0x0000,
+0x0008, 0x0014, 0x0004, 0x000e, 0x0004, 0x0004, 0x0004, 0x0000,
+0x0000, 0x0000, 0x000e, 0x0019, 0x0019, 0x0016, 0x0010, 0x000e,
+0x0001, 0x0001, 0x000d, 0x0013, 0x0011, 0x0011, 0x0011, 0x0000,
+0x0004, 0x0000, 0x0006, 0x0004, 0x0004, 0x0004, 0x000e, 0x0000,
+0x0008, 0x0000, 0x0008, 0x0008, 0x0008, 0x0009, 0x0006, 0x0000,
+0x0001, 0x0001, 0x0009, 0x0005, 0x0003, 0x0005, 0x0009, 0x0000,
+0x0006, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x000e, 0x0000,
+0x0000, 0x0000, 0x000b, 0x0015, 0x0015, 0x0015, 0x0015, 0x0000,
+0x0000, 0x0000, 0x000d, 0x0013, 0x0011, 0x0011, 0x0011, 0x0000,
+0x0000, 0x0000, 0x000e, 0x0011, 0x0011, 0x0011, 0x000e, 0x0000,
+0x0000, 0x0000, 0x000d, 0x0013, 0x0013, 0x000d, 0x0001, 0x0001,
+0x0000, 0x0000, 0x0016, 0x0019, 0x0019, 0x0016, 0x0010, 0x0010,
+0x0000, 0x0000, 0x000d, 0x0013, 0x0001, 0x0001, 0x0001, 0x0000,
+0x0000, 0x0000, 0x001e, 0x0001, 0x000e, 0x0010, 0x000f, 0x0000,
+0x0004, 0x0004, 0x001f, 0x0004, 0x0004, 0x0014, 0x0008, 0x0000,
+0x0000, 0x0000, 0x0011, 0x0011, 0x0011, 0x0019, 0x0016, 0x0000,
+0x0000, 0x0000, 0x0011, 0x0011, 0x0011, 0x000a, 0x0004, 0x0000,
+0x0000, 0x0000, 0x0011, 0x0011, 0x0015, 0x0015, 0x000a, 0x0000,
+0x0000, 0x0000, 0x0011, 0x000a, 0x0004, 0x000a, 0x0011, 0x0000,
+0x0000, 0x0000, 0x0011, 0x0011, 0x001e, 0x0010, 0x0011, 0x000e,
+0x0000, 0x0000, 0x001f, 0x0008, 0x0004, 0x0002, 0x001f, 0x0000,
+0x0008, 0x0004, 0x0004, 0x0002, 0x0004, 0x0004, 0x0008, 0x0000,
+0x0004, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000,
+0x0002, 0x0004, 0x0004, 0x0008, 0x0004, 0x0004, 0x0002, 0x0000,
+0x0002, 0x0015, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0007, 0x0005, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+const s_font_masks font_8x5_masks = {8, 5, 1, 26, 127, font_8x5_rows};
+
+static const uint16_t font_16x12_rows[] = {
+0x0400, 0x0600, 0x0580, 0x0460, 0x043e, 0x0412, 0x0412, 0x0412, 0x0412, 0x043e, 0x0460, 0x0580, 0x0600, 0x0400, 0x0000, 0x0000,
+0x0000, 0x0000, 0x01f8, 0x03fc, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x07fe, 0x03fc, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0f00, 0x0f80, 0x0fc0, 0x0fe0, 0x0ff0, 0x0ff8, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff0, 0x0fe0, 0x0fc0, 0x0f80, 0x0f00, 0x0000, 0x0000,
+0x000f, 0x001f, 0x003f, 0x007f, 0x00ff, 0x01ff, 0x03ff, 0x03ff, 0x01ff, 0x00ff, 0x007f, 0x003f, 0x001f, 0x000f, 0x0000, 0x0000,
+0x0000, 0x0000, 0x07fe, 0x07fe, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x07fe, 0x07fe, 0x0000, 0x0000,
+0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x079e, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0060, 0x0060, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0060, 0x0060, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0198, 0x0198, 0x0198, 0x0198, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0660, 0x0660, 0x0660, 0x0ffc, 0x0330, 0x0330, 0x0198, 0x0198, 0x03fe, 0x00cc, 0x00cc, 0x00cc, 0x0000, 0x0000, 0x0000,
+0x0060, 0x0060, 0x01f8, 0x03fc, 0x006c, 0x006c, 0x01fc, 0x03f8, 0x0360, 0x0360, 0x03fc, 0x01f8, 0x0060, 0x0060, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0800, 0x0c1c, 0x0e1c, 0x071c, 0x0380, 0x01c0, 0x00e0, 0x0070, 0x0038, 0x071c, 0x070e, 0x0706, 0x0000, 0x0000,
+0x0000, 0x00e0, 0x01b0, 0x0198, 0x0198, 0x00d8, 0x0070, 0x0078, 0x007c, 0x06cc, 0x03cc, 0x018c, 0x03dc, 0x0678, 0x0000, 0x0000,
+0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x01c0, 0x0060, 0x0070, 0x0030, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0030, 0x0070, 0x0060, 0x01c0, 0x0000, 0x0000,
+0x0038, 0x0060, 0x00e0, 0x00c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00c0, 0x00e0, 0x0060, 0x0038, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x036c, 0x036c, 0x01f8, 0x00f0, 0x03fc, 0x00f0, 0x01f8, 0x036c, 0x036c, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x03fc, 0x03fc, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0060, 0x0030,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03fc, 0x03fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000,
+0x0000, 0x0800, 0x0c00, 0x0e00, 0x0700, 0x0380, 0x01c0, 0x00e0, 0x0070, 0x0038, 0x001c, 0x000e, 0x0006, 0x0000, 0x0000, 0x0000,
+0x01f0, 0x07fc, 0x060c, 0x0e06, 0x0f06, 0x0d86, 0x0cc6, 0x0c66, 0x0c36, 0x0c1e, 0x0c0e, 0x060c, 0x07fc, 0x01f0, 0x0000, 0x0000,
+0x00c0, 0x00e0, 0x00f8, 0x00f8, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07f8, 0x07f8, 0x0000, 0x0000,
+0x03f8, 0x07fc, 0x0e0e, 0x0c06, 0x0e06, 0x0700, 0x0380, 0x01c0, 0x00e0, 0x0070, 0x0038, 0x001c, 0x0ffe, 0x0ffe, 0x0000, 0x0000,
+0x03f8, 0x07fc, 0x0e0e, 0x0c06, 0x0c00, 0x0e00, 0x07f0, 0x03f0, 0x0600, 0x0c00, 0x0c06, 0x0e0e, 0x07fc, 0x03f8, 0x0000, 0x0000,
+0x0380, 0x03c0, 0x03e0, 0x0370, 0x0338, 0x031c, 0x030e, 0x0306, 0x0ffe, 0x0ffe, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000,
+0x0ffe, 0x0ffe, 0x0006, 0x0006, 0x0006, 0x03fe, 0x07fc, 0x0e00, 0x0c00, 0x0c00, 0x0c06, 0x0e0e, 0x07fc, 0x03f8, 0x0000, 0x0000,
+0x03c0, 0x03e0, 0x0070, 0x0038, 0x001c, 0x000c, 0x03fe, 0x07fe, 0x0e0e, 0x0c06, 0x0c06, 0x0e0e, 0x07fc, 0x03f8, 0x0000, 0x0000,
+0x0ffe, 0x0ffe, 0x0600, 0x0600, 0x0300, 0x0300, 0x0180, 0x0180, 0x00c0, 0x00c0, 0x0060, 0x0060, 0x0030, 0x0030, 0x0000, 0x0000,
+0x01f0, 0x03f8, 0x071c, 0x060c, 0x060c, 0x071c, 0x03f8, 0x07fc, 0x0e0e, 0x0c06, 0x0c06, 0x0e0e, 0x07fc, 0x03f8, 0x0000, 0x0000,
+0x03f8, 0x07fc, 0x0e0e, 0x0c06, 0x0c06, 0x0e0e, 0x0ffc, 0x0ff8, 0x0600, 0x0700, 0x0380, 0x01c0, 0x00f8, 0x0078, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0030,
+0x0300, 0x0380, 0x01c0, 0x00e0, 0x0070, 0x0038, 0x001c, 0x001c, 0x0038, 0x0070, 0x00e0, 0x01c0, 0x0380, 0x0300, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07fc, 0x07fc, 0x0000, 0x0000, 0x07fc, 0x07fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x000c, 0x001c, 0x0038, 0x0070, 0x00e0, 0x01c0, 0x0380, 0x0380, 0x01c0, 0x00e0, 0x0070, 0x0038, 0x001c, 0x000c, 0x0000, 0x0000,
+0x01f8, 0x03fc, 0x070e, 0x0606, 0x0706, 0x0380, 0x01c0, 0x00e0, 0x0060, 0x0060, 0x0060, 0x0000, 0x0060, 0x0060, 0x0000, 0x0000,
+0x03f8, 0x07fc, 0x060c, 0x0de6, 0x0df6, 0x0db6, 0x0db6, 0x0db6, 0x0db6, 0x07f6, 0x03e6, 0x000e, 0x03fc, 0x03f0, 0x0000, 0x0000,
+0x0060, 0x0060, 0x00f0, 0x00f0, 0x00f0, 0x0198, 0x0198, 0x0198, 0x030c, 0x03fc, 0x03fc, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000,
+0x00fe, 0x01fe, 0x0386, 0x0306, 0x0306, 0x0386, 0x01fe, 0x03fe, 0x0706, 0x0606, 0x0606, 0x0706, 0x03fe, 0x01fe, 0x0000, 0x0000,
+0x01f0, 0x03f8, 0x071c, 0x060c, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x060c, 0x071c, 0x03f8, 0x01f0, 0x0000, 0x0000,
+0x00fe, 0x01fe, 0x0386, 0x0306, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x0386, 0x01fe, 0x00fe, 0x0000, 0x0000,
+0x07fe, 0x07fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x07fe, 0x07fe, 0x0000, 0x0000,
+0x07fe, 0x07fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000,
+0x03f0, 0x07f8, 0x061c, 0x000c, 0x0006, 0x0006, 0x07c6, 0x07c6, 0x0606, 0x0606, 0x060c, 0x061c, 0x07f8, 0x07f0, 0x0000, 0x0000,
+0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x07fe, 0x07fe, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000,
+0x01f8, 0x01f8, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x01f8, 0x0000, 0x0000,
+0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0606, 0x0606, 0x030e, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x0606, 0x0706, 0x0386, 0x01c6, 0x00e6, 0x0076, 0x003e, 0x003e, 0x0076, 0x00e6, 0x01c6, 0x0386, 0x0706, 0x0606, 0x0000, 0x0000,
+0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x07fe, 0x07fe, 0x0000, 0x0000,
+0x0606, 0x070e, 0x070e, 0x079e, 0x079e, 0x06f6, 0x06f6, 0x0666, 0x0666, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000,
+0x0606, 0x060e, 0x060e, 0x061e, 0x0636, 0x0636, 0x0666, 0x0666, 0x06c6, 0x06c6, 0x0786, 0x0706, 0x0706, 0x0606, 0x0000, 0x0000,
+0x00f0, 0x01f8, 0x039c, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x039c, 0x01f8, 0x00f0, 0x0000, 0x0000,
+0x01fe, 0x03fe, 0x0706, 0x0606, 0x0606, 0x0606, 0x0706, 0x03fe, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000,
+0x00f0, 0x01f8, 0x039c, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x06c6, 0x03cc, 0x039c, 0x07f8, 0x06f0, 0x0000, 0x0000,
+0x01fe, 0x03fe, 0x0706, 0x0606, 0x0606, 0x0606, 0x0706, 0x03fe, 0x01fe, 0x00e6, 0x01c6, 0x0386, 0x0706, 0x0606, 0x0000, 0x0000,
+0x01f8, 0x03fc, 0x070e, 0x0606, 0x0006, 0x000e, 0x01fc, 0x03f8, 0x0700, 0x0600, 0x0606, 0x070e, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x03fc, 0x03fc, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000,
+0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x0606, 0x0606, 0x0606, 0x030c, 0x030c, 0x030c, 0x0198, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0000, 0x0000,
+0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0666, 0x0666, 0x06f6, 0x079e, 0x070e, 0x070e, 0x0606, 0x0000, 0x0000,
+0x0606, 0x0606, 0x030c, 0x030c, 0x0198, 0x00f0, 0x0060, 0x0060, 0x00f0, 0x0198, 0x030c, 0x030c, 0x0606, 0x0606, 0x0000, 0x0000,
+0x0606, 0x0606, 0x030c, 0x030c, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000,
+0x07fe, 0x07fe, 0x0300, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0060, 0x0030, 0x0018, 0x000c, 0x000c, 0x07fe, 0x07fe, 0x0000, 0x0000,
+0x01f8, 0x01f8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x01f8, 0x01f8, 0x0000, 0x0000,
+0x0000, 0x0002, 0x0006, 0x000e, 0x001c, 0x0038, 0x0070, 0x00e0, 0x01c0, 0x0380, 0x0700, 0x0e00, 0x0c00, 0x0000, 0x0000, 0x0000,
+0x01f8, 0x01f8, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x01f8, 0x01f8, 0x0000, 0x0000,
+0x0040, 0x00e0, 0x01f0, 0x03b8, 0x071c, 0x0e0e, 0x0c06, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ffe, 0x0ffe,
+0x0000, 0x00e0, 0x00e0, 0x00e0, 0x0060, 0x0060, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03f8, 0x07fc, 0x0600, 0x07f8, 0x07fc, 0x0606, 0x0606, 0x07fe, 0x07fc, 0x0000, 0x0000,
+0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x01f6, 0x03fe, 0x070e, 0x0606, 0x0606, 0x0606, 0x0706, 0x03fe, 0x01fe, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x03fc, 0x060e, 0x0006, 0x0006, 0x0006, 0x060e, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x06f8, 0x07fc, 0x078e, 0x0606, 0x0606, 0x0606, 0x060e, 0x07fc, 0x07f8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x03fc, 0x060e, 0x07fe, 0x03fe, 0x0006, 0x000e, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x03c0, 0x03e0, 0x0070, 0x0030, 0x0030, 0x0030, 0x01fc, 0x01fc, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07f8, 0x07fc, 0x060e, 0x0606, 0x070e, 0x07fc, 0x06f8, 0x0600, 0x0700, 0x03fc, 0x01fc,
+0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x00f6, 0x01fe, 0x038e, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0060, 0x0060, 0x0000, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x01f8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0180, 0x0180, 0x0000, 0x01c0, 0x01c0, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0198, 0x01f8, 0x00f0,
+0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x018c, 0x01cc, 0x00ec, 0x007c, 0x007c, 0x00ec, 0x01cc, 0x038c, 0x030c, 0x0000, 0x0000,
+0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x01f8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019a, 0x03fe, 0x07fe, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x03fc, 0x070c, 0x060c, 0x060c, 0x060c, 0x060c, 0x060c, 0x060c, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x03fc, 0x070e, 0x0606, 0x0606, 0x0606, 0x070e, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x03fe, 0x0706, 0x0606, 0x0606, 0x070e, 0x03fe, 0x01f6, 0x0006, 0x0006, 0x0006,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07f8, 0x07fc, 0x060e, 0x0606, 0x0606, 0x070e, 0x07fc, 0x06f8, 0x0600, 0x0600, 0x0600,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03ec, 0x07fc, 0x061c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x03fc, 0x000c, 0x01fc, 0x03f8, 0x0300, 0x0300, 0x03fc, 0x01f8, 0x0000, 0x0000,
+0x0000, 0x0030, 0x0030, 0x0030, 0x0030, 0x01fc, 0x01fc, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x03f0, 0x03e0, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x070e, 0x07fc, 0x06f8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x030c, 0x030c, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x0060, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x06f6, 0x03fc, 0x039c, 0x0108, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0306, 0x038e, 0x01dc, 0x00f8, 0x0070, 0x00f8, 0x01dc, 0x038e, 0x0306, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x030c, 0x030c, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0030, 0x0030, 0x0018,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03fe, 0x01fe, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x03fe, 0x03fe, 0x0000, 0x0000,
+0x03c0, 0x03e0, 0x0070, 0x0030, 0x0030, 0x0030, 0x0038, 0x001c, 0x0038, 0x0030, 0x0030, 0x0030, 0x0070, 0x03e0, 0x03c0, 0x0000,
+0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000,
+0x003c, 0x007c, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x01c0, 0x0380, 0x01c0, 0x00c0, 0x00c0, 0x00c0, 0x00e0, 0x007c, 0x003c, 0x0000,
+0x0000, 0x0000, 0x0638, 0x036c, 0x01c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+const s_font_masks font_16x12_masks = {16, 12, 0, 26, 127, font_16x12_rows};
@@ -0,0 +1,21 @@
+#ifndef __FONT_MASKS_H__
+#define __FONT_MASKS_H__
+
+#include <cstdint>
+
+//Fonts pre-expanded by model/make_font_masks.py into one mask per glyph
+//row, bit n of each mask is column n of the glyph.
+struct s_font_masks
+{
+  uint8_t height;
+  uint8_t width;
+  uint8_t space;
+  uint8_t first_char;
+  uint8_t last_char;
+  const uint16_t *rows;
+};
+
+extern const s_font_masks font_8x5_masks;
+extern const s_font_masks font_16x12_masks;
+
+#endif
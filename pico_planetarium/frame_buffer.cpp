@@ -1,5 +1,8 @@
 #include <cmath>
+#include <algorithm>
+#include <cstring>
 #include "frame_buffer.h"
+#include "image_decoder.h"
 
 void c_frame_buffer :: set_pixel(uint16_t x, uint16_t y, uint16_t colour, uint16_t alpha)
 {
@@ -8,78 +11,255 @@ void c_frame_buffer :: set_pixel(uint16_t x, uint16_t y, uint16_t colour, uint16
   m_buffer[y*m_width + x] = alpha_blend(old_colour, colour, alpha);
 }
 
-float ipart(float x) { return floorf(x); }
-float rfpart(float x) { return 1 - (x - floorf(x)); }
-float fpart(float x) { return x - floorf(x); }
+uint8_t c_frame_buffer :: outcode(int32_t x, int32_t y)
+{
+  uint8_t code = 0;
+  if(x < 0) code |= 1;
+  else if(x >= m_width) code |= 2;
+  if(y < 0) code |= 4;
+  else if(y >= m_height) code |= 8;
+  return code;
+}
+
+bool c_frame_buffer :: clip_line(int32_t &x1, int32_t &y1, int32_t &x2, int32_t &y2)
+{
+  //Cohen-Sutherland line clipping, shortens the line so that both ends
+  //lie within the buffer. Returns false if no part of the line is visible.
+  const int32_t x_max = m_width-1;
+  const int32_t y_max = m_height-1;
+  uint8_t code1 = outcode(x1, y1);
+  uint8_t code2 = outcode(x2, y2);
+
+  //each pass moves one end onto an edge, rounding can occasionally push
+  //a point just past the next edge so limit the number of passes
+  for(uint8_t pass = 0; pass < 8; ++pass)
+  {
+    if(!(code1 | code2)) return true; //both ends inside
+    if(code1 & code2) return false; //both ends beyond the same edge
+
+    const uint8_t code = code1 ? code1 : code2;
+    const int64_t dx = x2 - x1;
+    const int64_t dy = y2 - y1;
+    int32_t x, y;
+
+    if(code & 8)
+    {
+      y = y_max;
+      x = x1 + dx * (y_max - y1) / dy;
+    }
+    else if(code & 4)
+    {
+      y = 0;
+      x = x1 + dx * (0 - y1) / dy;
+    }
+    else if(code & 2)
+    {
+      x = x_max;
+      y = y1 + dy * (x_max - x1) / dx;
+    }
+    else
+    {
+      x = 0;
+      y = y1 + dy * (0 - x1) / dx;
+    }
+
+    if(code == code1)
+    {
+      x1 = x; y1 = y;
+      code1 = outcode(x1, y1);
+    }
+    else
+    {
+      x2 = x; y2 = y;
+      code2 = outcode(x2, y2);
+    }
+  }
+  return false;
+}
+
+void c_frame_buffer :: build_blend_lut(uint16_t alpha)
+{
+  for(uint16_t coverage = 0; coverage < 256; ++coverage)
+  {
+    m_blend_lut[coverage] = (coverage * alpha * 33) >> 16;
+  }
+  m_blend_lut_alpha = alpha;
+}
+
+//Blend two native (not byte swapped) RGB565 colours with a 5-bit weight.
+//Spreading the channels out into a 32-bit word with gaps between them
+//allows all three to be blended with a single multiply.
+static inline uint16_t blend_spread(uint16_t bg, uint32_t fg_spread, uint8_t weight)
+{
+  const uint32_t bg_spread = (bg | ((uint32_t)bg << 16)) & 0x07E0F81Fu;
+  const uint32_t result = (bg_spread + (((fg_spread - bg_spread) * weight) >> 5)) & 0x07E0F81Fu;
+  return result | (result >> 16);
+}
 
 void c_frame_buffer :: draw_line_antialiased(int x0, int y0, int x1, int y1, uint16_t colour, uint16_t alpha) 
 {
-    bool one_point_in_view = 
-      (x0 >= 0 && x0 < m_width && y0 >= 0 && y0 < m_height) || 
-      (x1 >= 0 && x1 < m_width && y1 >= 0 && y1 < m_height);
-    if(!one_point_in_view) return;
+    //Xiaolin Wu's line algorithm using 16.16 fixed point, the fractional
+    //part of the minor coordinate gives 8-bit coverage for the two pixels
+    //either side of the ideal line.
+    int32_t cx0 = x0, cy0 = y0, cx1 = x1, cy1 = y1;
+    if(!clip_line(cx0, cy0, cx1, cy1)) return;
+
+    if(alpha != m_blend_lut_alpha) build_blend_lut(alpha);
 
-    int steep = fabs(y1 - y0) > fabs(x1 - x0);
+    const bool steep = abs(cy1 - cy0) > abs(cx1 - cx0);
     if (steep) {
-        int temp;
-        temp = x0; x0 = y0; y0 = temp;
-        temp = x1; x1 = y1; y1 = temp;
+        std::swap(cx0, cy0);
+        std::swap(cx1, cy1);
     }
-    if (x0 > x1) {
-        int temp;
-        temp = x0; x0 = x1; x1 = temp;
-        temp = y0; y0 = y1; y1 = temp;
+    if (cx0 > cx1) {
+        std::swap(cx0, cx1);
+        std::swap(cy0, cy1);
     }
 
-    float dx = x1 - x0;
-    float dy = y1 - y0;
-    float gradient = (dx == 0) ? 1 : dy / dx;
-    
-    float intery = y0 + gradient * (roundf(x0) - x0);
+    const int32_t dx = cx1 - cx0;
+    const int32_t dy = cy1 - cy0;
+    const int32_t gradient = dx ? (dy * 65536) / dx : 0;
 
-    for (int x = roundf(x0); x <= roundf(x1); x++) {
-        if (steep) {
-            set_pixel(ipart(intery), x, colour_scale(colour, rfpart(intery)*256), alpha);
-            set_pixel(ipart(intery) + 1, x, colour_scale(colour, fpart(intery)*256), alpha);
-        } else {
-            set_pixel(x, ipart(intery), colour_scale(colour, rfpart(intery)*256), alpha);
-            set_pixel(x, ipart(intery) + 1, colour_scale(colour, fpart(intery)*256), alpha);
+    //step along the major axis, the second pixel is offset along the minor axis
+    const int32_t major_stride = steep ? m_width : 1;
+    const int32_t minor_stride = steep ? 1 : m_width;
+    const int32_t minor_limit = steep ? m_width : m_height;
+
+    const uint16_t fg = (colour >> 8) | (colour << 8);
+    const uint32_t fg_spread = (fg | ((uint32_t)fg << 16)) & 0x07E0F81Fu;
+
+    uint16_t *major = &m_buffer[cx0 * major_stride];
+    int32_t intery = cy0 * 65536;
+
+    for (int32_t x = cx0; x <= cx1; x++) {
+        const int32_t y = intery >> 16;
+        const uint8_t coverage = (intery >> 8) & 0xff;
+        uint16_t *pixel = major + y * minor_stride;
+
+        uint8_t weight = m_blend_lut[255 - coverage];
+        if(weight)
+        {
+          const uint16_t bg = (*pixel >> 8) | (*pixel << 8);
+          const uint16_t result = blend_spread(bg, fg_spread, weight);
+          *pixel = (result >> 8) | (result << 8);
         }
-      intery += gradient;
+
+        //both ends are inside the buffer so only the second pixel can fall outside
+        weight = m_blend_lut[coverage];
+        if(weight && y + 1 < minor_limit)
+        {
+          pixel += minor_stride;
+          const uint16_t bg = (*pixel >> 8) | (*pixel << 8);
+          const uint16_t result = blend_spread(bg, fg_spread, weight);
+          *pixel = (result >> 8) | (result << 8);
+        }
+
+        major += major_stride;
+        intery += gradient;
     }
 }
 
 void c_frame_buffer :: draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t colour, uint16_t alpha)
 {
-    bool one_point_in_view = 
-      (x1 >= 0 && x1 < m_width && y1 >= 0 && y1 < m_height) || 
-      (x2 >= 0 && x2 < m_width && y2 >= 0 && y2 < m_height);
-    if(!one_point_in_view) return;
+    int32_t cx1 = x1, cy1 = y1, cx2 = x2, cy2 = y2;
+    if(!clip_line(cx1, cy1, cx2, cy2)) return;
 
-    //draw line between 2 points
-    int dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
-    int dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+    //draw line between 2 points, clipping guarantees every pixel is in the buffer
+    int dx = abs(cx2 - cx1), sx = cx1 < cx2 ? 1 : -1;
+    int dy = -abs(cy2 - cy1), sy = cy1 < cy2 ? m_width : -m_width;
     int err = dx + dy, e2;
+    int steps = std::max(dx, -dy);
+    uint16_t *pixel = &m_buffer[cy1*m_width + cx1];
   
     while (1) {
-        set_pixel(x1, y1, colour, alpha);
-        if (x1 == x2 && y1 == y2) break;
+        *pixel = alpha_blend(*pixel, colour, alpha);
+        if (steps-- == 0) break;
         e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x1 += sx; }
-        if (e2 <= dx) { err += dx; y1 += sy; }
+        if (e2 >= dy) { err += dy; pixel += sx; }
+        if (e2 <= dx) { err += dx; pixel += sy; }
+    }
+}
+
+const s_font_masks *c_frame_buffer::find_font_masks(const uint8_t *font)
+{
+  //The font arrays are defined in headers, so each file that includes them
+  //has its own copy. Match the pre-expanded masks on the font header instead.
+  static const s_font_masks * const all_masks[] = {&font_8x5_masks, &font_16x12_masks};
+  for(const s_font_masks *masks : all_masks)
+  {
+    if(font[0] == masks->height && font[1] == masks->width && font[2] == masks->space &&
+       font[3] == masks->first_char && font[4] == masks->last_char) return masks;
+  }
+  return nullptr;
+}
+
+void c_frame_buffer::blit_string(int32_t x, int32_t y, const s_font_masks &masks, const char *s, uint16_t fg, uint16_t alpha)
+{
+  //clip the whole string once, then draw it a row at a time
+  const int32_t advance = masks.width + masks.space;
+  const int32_t length = strlen(s);
+  if(x >= m_width || y >= m_height) return;
+  if(x + length*advance <= 0 || y + masks.height <= 0) return;
+
+  const int32_t first_row = std::max<int32_t>(0, -y);
+  const int32_t last_row = std::min<int32_t>(masks.height, m_height - y);
+  const int32_t first_glyph = x < 0 ? -x/advance : 0;
+
+  for(int32_t row = first_row; row < last_row; ++row)
+  {
+    uint16_t *line = &m_buffer[(y + row)*m_width];
+    for(int32_t glyph = first_glyph; glyph < length; ++glyph)
+    {
+      const int32_t glyph_x = x + glyph*advance;
+      if(glyph_x >= m_width) break;
+
+      const uint8_t c = s[glyph];
+      if(c < masks.first_char || c > masks.last_char) continue;
+      uint32_t mask = masks.rows[(c - masks.first_char)*masks.height + row];
+
+      //remove columns that fall outside the buffer
+      if(glyph_x < 0) mask &= ~0u << -glyph_x;
+      if(glyph_x + masks.width > m_width) mask &= (1u << (m_width - glyph_x)) - 1;
+
+      //draw each run of set bits as a span
+      while(mask)
+      {
+        const uint8_t start = __builtin_ctz(mask);
+        const uint8_t run = __builtin_ctz(~(mask >> start));
+        uint16_t *pixel = &line[glyph_x + start];
+        for(uint8_t i = 0; i < run; ++i)
+        {
+          pixel[i] = alpha_blend(pixel[i], fg, alpha);
+        }
+        mask &= ~(((1u << run) - 1) << start);
+      }
     }
+  }
 }
 
-void c_frame_buffer::draw_string(uint16_t x, uint16_t y, const uint8_t *font, const char *s, uint16_t fg, uint16_t alpha) 
+void c_frame_buffer::draw_string(int16_t x, int16_t y, const uint8_t *font, const char *s, uint16_t fg, uint16_t alpha) 
 {
+  const s_font_masks *masks = find_font_masks(font);
+  if(masks)
+  {
+    blit_string(x, y, *masks, s, fg, alpha);
+    return;
+  }
+
   const uint8_t font_width  = font[1];
   const uint8_t font_space  = font[2];
   for(int32_t x_n=x; *s; x_n+=(font_width+font_space)) {
-      draw_char(x_n, y, font, *(s++), fg, alpha);
+      draw_char_bits(x_n, y, font, *(s++), fg, alpha);
   }
 }
 
-void c_frame_buffer::draw_char(uint16_t x, uint16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha) 
+void c_frame_buffer::draw_char(int16_t x, int16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha) 
+{
+  const char s[2] = {c, 0};
+  draw_string(x, y, font, s, fg, alpha);
+}
+
+void c_frame_buffer::draw_char_bits(int16_t x, int16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha) 
 {
 
   const uint8_t font_height = font[0];
@@ -217,12 +397,15 @@ void c_frame_buffer :: draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void c_frame_buffer :: fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t colour, uint16_t alpha)
 {
-  //fill buffer with background colour
-  for(uint16_t xx = 0; xx < w; xx++)
+  //clip once, then fill a row at a time
+  const uint16_t x_end = std::min<uint32_t>(x + w, m_width);
+  const uint16_t y_end = std::min<uint32_t>(y + h, m_height);
+  for(uint16_t yy = y; yy < y_end; yy++)
   {
-    for(uint16_t yy = 0; yy < h; yy++)
+    uint16_t *line = &m_buffer[yy*m_width];
+    for(uint16_t xx = x; xx < x_end; xx++)
     {
-      set_pixel(x+xx, y+yy, colour, alpha);
+      line[xx] = alpha_blend(line[xx], colour, alpha);
     }
   }
 }
@@ -232,14 +415,20 @@ void c_frame_buffer :: clear(uint16_t colour)
   std::fill_n(m_buffer, m_width*m_height, colour);
 }
 
-void c_frame_buffer :: draw_object(uint16_t x, uint16_t y, uint16_t r, uint16_t* image)
+void c_frame_buffer :: draw_object(uint16_t x, uint16_t y, uint16_t r, const uint8_t* image)
 {
-  for(int16_t xx = -r; xx<r; xx++)
+  //image is a compressed 2r x 2r sprite, decode it a row at a time
+  const uint16_t max_r = 32;
+  if(!image || r > max_r) return;
+  c_image_decoder decoder(image);
+  uint16_t row[2*max_r];
+  for(int16_t yy = -r; yy<r; yy++)
   {
-    for(int16_t yy = -r; yy<r; yy++)
+    decoder.decode(row, 2*r);
+    for(int16_t xx = -r; xx<r; xx++)
     {
       if((xx*xx+yy*yy)>(r*r)) continue;
-      set_pixel(x+xx, y+yy, image[((yy+r)*2*r)+xx+r]);
+      set_pixel(x+xx, y+yy, row[xx+r]);
     }
   }
 }
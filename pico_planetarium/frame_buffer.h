@@ -2,6 +2,7 @@
 #define __FRAME_BUFFER_H__
 
 #include <cstdint>
+#include "font_masks.h"
 
 class c_frame_buffer
 {
@@ -10,6 +11,19 @@ class c_frame_buffer
   uint16_t m_height;
   uint16_t *m_buffer;
 
+  uint8_t outcode(int32_t x, int32_t y);
+  bool clip_line(int32_t &x1, int32_t &y1, int32_t &x2, int32_t &y2);
+
+  //maps 8-bit coverage to a 5-bit blend weight for antialiased lines,
+  //alpha is at most 256 so the table starts out matching no alpha
+  uint8_t m_blend_lut[256];
+  uint16_t m_blend_lut_alpha = 0xffff;
+  void build_blend_lut(uint16_t alpha);
+
+  const s_font_masks *find_font_masks(const uint8_t *font);
+  void blit_string(int32_t x, int32_t y, const s_font_masks &masks, const char *s, uint16_t fg, uint16_t alpha);
+  void draw_char_bits(int16_t x, int16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha);
+
   public:
   uint16_t colour565(uint8_t r, uint8_t g, uint8_t b);
   void colour_rgb(uint16_t colour_565, uint8_t &r, uint8_t &g, uint8_t &b);
@@ -20,11 +34,11 @@ class c_frame_buffer
   void draw_line_antialiased(int x0, int y0, int x1, int y1, uint16_t colour, uint16_t alpha=256); 
   void fill_circle(uint16_t xc, uint16_t yc, uint16_t radius, uint16_t colour, uint16_t alpha=256);
   void draw_circle(uint16_t xc, uint16_t yc, uint16_t radius, uint16_t colour, uint16_t alpha=256);
-  void draw_string(uint16_t x, uint16_t y, const uint8_t *font, const char *s, uint16_t fg, uint16_t alpha=256);
-  void draw_char(uint16_t x, uint16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha=256);
+  void draw_string(int16_t x, int16_t y, const uint8_t *font, const char *s, uint16_t fg, uint16_t alpha=256);
+  void draw_char(int16_t x, int16_t y, const uint8_t *font, char c, uint16_t fg, uint16_t alpha=256);
   void fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t colour, uint16_t alpha=256);
   void draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t colour, uint16_t alpha=256);
-  void draw_object(uint16_t x, uint16_t y, uint16_t r, uint16_t* image);
+  void draw_object(uint16_t x, uint16_t y, uint16_t r, const uint8_t* image);
   void clear(uint16_t colour);
 
 
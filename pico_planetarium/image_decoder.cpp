@@ -0,0 +1,79 @@
+#include "image_decoder.h"
+
+static inline uint8_t color_hash(uint16_t color)
+{
+  return ((color >> 11)*3 + ((color >> 5) & 0x3f)*5 + (color & 0x1f)*7) & 0x3f;
+}
+
+static inline uint16_t swap(uint16_t color)
+{
+  return (color >> 8) | (color << 8);
+}
+
+c_image_decoder :: c_image_decoder(const uint8_t *data):
+  m_data(data), m_previous(0), m_run(0), m_literals(0)
+{
+  for(uint8_t idx = 0; idx < 64; ++idx) m_table[idx] = 0;
+}
+
+void c_image_decoder :: decode(uint16_t *pixels, uint32_t num_pixels)
+{
+  while(num_pixels)
+  {
+    //finish any run or literals left over from the last chunk
+    if(m_run)
+    {
+      uint16_t color = swap(m_previous);
+      while(m_run && num_pixels)
+      {
+        *pixels++ = color;
+        --m_run;
+        --num_pixels;
+      }
+      continue;
+    }
+
+    if(m_literals)
+    {
+      uint16_t color = m_data[0] | (m_data[1] << 8);
+      m_data += 2;
+      --m_literals;
+      *pixels++ = color;
+      --num_pixels;
+      m_previous = swap(color);
+      m_table[color_hash(m_previous)] = m_previous;
+      continue;
+    }
+
+    uint8_t op = *m_data++;
+    uint16_t color;
+    switch(op >> 6)
+    {
+      case 0:
+        m_run = (op & 0x3f) + 1;
+        continue;
+
+      case 1:
+        color = m_table[op & 0x3f];
+        break;
+
+      case 2:
+      {
+        uint16_t r = (m_previous >> 11) + ((op >> 4) & 3) - 2;
+        uint16_t g = ((m_previous >> 5) & 0x3f) + ((op >> 2) & 3) - 2;
+        uint16_t b = (m_previous & 0x1f) + (op & 3) - 2;
+        color = ((r & 0x1f) << 11) | ((g & 0x3f) << 5) | (b & 0x1f);
+        break;
+      }
+
+      default:
+        m_literals = (op & 0x3f) + 1;
+        continue;
+    }
+
+    m_table[color_hash(color)] = color;
+    m_previous = color;
+    *pixels++ = swap(color);
+    --num_pixels;
+  }
+}
@@ -0,0 +1,23 @@
+#ifndef __IMAGE_DECODER_H__
+#define __IMAGE_DECODER_H__
+
+#include <cstdint>
+
+//Streaming decoder for images compressed by images/image2fbuf.py (see
+//compress() there for the format). Pixels come out byte swapped RGB565 as
+//the display expects, and can be taken in chunks of any size, so a large
+//image can be sent to the display a few rows at a time.
+class c_image_decoder
+{
+  const uint8_t *m_data;
+  uint16_t m_previous;
+  uint8_t m_run;
+  uint8_t m_literals;
+  uint16_t m_table[64];
+
+  public:
+  c_image_decoder(const uint8_t *data);
+  void decode(uint16_t *pixels, uint32_t num_pixels);
+};
+
+#endif
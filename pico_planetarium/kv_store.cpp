@@ -0,0 +1,268 @@
+#include <cstring>
+#include "kv_store.h"
+
+static const uint16_t erased_key = 0xffff;
+
+static uint32_t crc32(uint32_t crc, const void *data, uint32_t size)
+{
+  const uint8_t *p = (const uint8_t*)data;
+  crc = ~crc;
+  while(size--)
+  {
+    crc ^= *p++;
+    for(uint8_t bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static uint32_t record_crc(uint16_t key, uint16_t size, const void *data)
+{
+  const uint16_t header[2] = {key, size};
+  return crc32(crc32(0, header, sizeof(header)), data, size);
+}
+
+static uint32_t padded(uint32_t size)
+{
+  return (size + 3) & ~3u;
+}
+
+c_kv_store :: c_kv_store(uint8_t num_sectors):
+  m_num_sectors(num_sectors), m_active(num_sectors-1), m_sequence(0), m_write_offset(sector_size),
+  m_needs_compaction(true), m_num_entries(0), m_set_count(0), m_polled_set_count(0), m_last_change_ms(0)
+{
+}
+
+c_kv_store::s_entry *c_kv_store :: find(uint16_t key)
+{
+  for(uint8_t idx = 0; idx < m_num_entries; ++idx)
+  {
+    if(m_entries[idx].key == key) return &m_entries[idx];
+  }
+  return nullptr;
+}
+
+const c_kv_store::s_entry *c_kv_store :: find(uint16_t key) const
+{
+  return const_cast<c_kv_store*>(this)->find(key);
+}
+
+bool c_kv_store :: open()
+{
+  m_num_entries = 0;
+  m_active = m_num_sectors-1;
+  m_sequence = 0;
+  m_write_offset = sector_size;
+  m_needs_compaction = true;
+
+  //the newest complete sector has every value
+  bool found = false;
+  for(uint8_t sector = 0; sector < m_num_sectors; ++sector)
+  {
+    s_kv_sector_header header;
+    if(!flash_read(sector*sector_size, &header, sizeof(header))) continue;
+    if(memcmp(header.magic, "PKVS", 4) || header.version != version) continue;
+    if(header.crc != crc32(0, &header, sizeof(header) - sizeof(header.crc))) continue;
+    if(found && header.sequence <= m_sequence) continue;
+    found = true;
+    m_active = sector;
+    m_sequence = header.sequence;
+  }
+
+  if(!found) return false;
+  m_needs_compaction = !scan(m_active);
+  return true;
+}
+
+bool c_kv_store :: scan(uint8_t sector)
+{
+  const uint32_t base = sector*sector_size;
+  uint32_t offset = sizeof(s_kv_sector_header);
+  while(offset + sizeof(s_kv_record_header) <= sector_size)
+  {
+    s_kv_record_header header;
+    if(!flash_read(base + offset, &header, sizeof(header))) return false;
+    if(header.key == erased_key) break;
+
+    //a bad record could be a torn write, keep what came before it and
+    //start a fresh sector on the next commit
+    if(header.size > max_value_size || offset + sizeof(header) + header.size > sector_size) return false;
+    uint8_t data[max_value_size];
+    if(!flash_read(base + offset + sizeof(header), data, header.size)) return false;
+    if(header.crc != record_crc(header.key, header.size, data)) return false;
+
+    s_entry *entry = find(header.key);
+    if(!entry)
+    {
+      if(m_num_entries == max_keys) return false;
+      entry = &m_entries[m_num_entries++];
+      entry->key = header.key;
+    }
+    entry->size = header.size;
+    entry->dirty = false;
+    memcpy(entry->data, data, header.size);
+    offset += sizeof(header) + padded(header.size);
+  }
+  m_write_offset = offset;
+
+  //anything after the end marker would corrupt the next record
+  uint8_t buffer[64];
+  while(offset < sector_size)
+  {
+    const uint32_t size = sector_size - offset < sizeof(buffer) ? sector_size - offset : sizeof(buffer);
+    if(!flash_read(base + offset, buffer, size)) return false;
+    for(uint32_t idx = 0; idx < size; ++idx) if(buffer[idx] != 0xff) return false;
+    offset += size;
+  }
+  return true;
+}
+
+bool c_kv_store :: get(uint16_t key, void *data, uint16_t size) const
+{
+  const s_entry *entry = find(key);
+  if(!entry || entry->size != size) return false;
+  memcpy(data, entry->data, size);
+  return true;
+}
+
+bool c_kv_store :: set(uint16_t key, const void *data, uint16_t size)
+{
+  if(key == erased_key || size > max_value_size) return false;
+  s_entry *entry = find(key);
+  if(entry && entry->size == size && !memcmp(entry->data, data, size)) return true;
+  if(!entry)
+  {
+    if(m_num_entries == max_keys) return false;
+    entry = &m_entries[m_num_entries++];
+    entry->key = key;
+  }
+  entry->size = size;
+  entry->dirty = true;
+  memcpy(entry->data, data, size);
+  m_set_count++;
+  return true;
+}
+
+bool c_kv_store :: is_dirty() const
+{
+  for(uint8_t idx = 0; idx < m_num_entries; ++idx)
+  {
+    if(m_entries[idx].dirty) return true;
+  }
+  return false;
+}
+
+//program bytes anywhere in the store, one page at a time. Erased bytes
+//are all ones, so programming a page again only clears the new bits.
+bool c_kv_store :: write(uint32_t offset, const void *data, uint32_t size)
+{
+  const uint8_t *p = (const uint8_t*)data;
+  uint8_t page[page_size];
+  while(size)
+  {
+    const uint32_t page_offset = offset & ~(page_size-1);
+    const uint32_t start = offset - page_offset;
+    const uint32_t length = page_size - start < size ? page_size - start : size;
+    memset(page, 0xff, page_size);
+    memcpy(page + start, p, length);
+    if(!flash_program(page_offset, page, page_size)) return false;
+    offset += length;
+    p += length;
+    size -= length;
+  }
+  return true;
+}
+
+bool c_kv_store :: append(const s_entry &entry, uint32_t &offset)
+{
+  uint8_t record[sizeof(s_kv_record_header) + max_value_size + 3];
+  memset(record, 0xff, sizeof(record));
+  s_kv_record_header header = {entry.key, entry.size, record_crc(entry.key, entry.size, entry.data)};
+  memcpy(record, &header, sizeof(header));
+  memcpy(record + sizeof(header), entry.data, entry.size);
+  const uint32_t size = sizeof(header) + padded(entry.size);
+  if(!write(offset, record, size)) return false;
+  offset += size;
+  return true;
+}
+
+bool c_kv_store :: compact()
+{
+  //write every value to the next sector, then its header to make it active
+  const uint8_t sector = (m_active + 1) % m_num_sectors;
+  const uint32_t base = sector*sector_size;
+  if(!flash_erase(base)) return false;
+
+  uint32_t offset = base + sizeof(s_kv_sector_header);
+  for(uint8_t idx = 0; idx < m_num_entries; ++idx)
+  {
+    if(!append(m_entries[idx], offset)) return false;
+  }
+
+  s_kv_sector_header header = {{'P', 'K', 'V', 'S'}, version, 0xffff, m_sequence + 1, 0};
+  header.crc = crc32(0, &header, sizeof(header) - sizeof(header.crc));
+  if(!write(base, &header, sizeof(header))) return false;
+
+  m_active = sector;
+  m_sequence++;
+  m_write_offset = offset - base;
+  m_needs_compaction = false;
+  return true;
+}
+
+bool c_kv_store :: commit()
+{
+  uint32_t needed = 0;
+  for(uint8_t idx = 0; idx < m_num_entries; ++idx)
+  {
+    if(m_entries[idx].dirty) needed += sizeof(s_kv_record_header) + padded(m_entries[idx].size);
+  }
+  if(!needed) return true;
+
+  if(m_needs_compaction || m_write_offset + needed > sector_size)
+  {
+    if(!compact()) return false;
+  }
+  else
+  {
+    uint32_t offset = m_active*sector_size + m_write_offset;
+    for(uint8_t idx = 0; idx < m_num_entries; ++idx)
+    {
+      if(!m_entries[idx].dirty) continue;
+      if(!append(m_entries[idx], offset))
+      {
+        //whatever got written is suspect, start afresh next time
+        m_needs_compaction = true;
+        return false;
+      }
+    }
+    m_write_offset = offset - m_active*sector_size;
+  }
+
+  for(uint8_t idx = 0; idx < m_num_entries; ++idx) m_entries[idx].dirty = false;
+  return true;
+}
+
+bool c_kv_store :: poll(uint32_t now_ms)
+{
+  if(!is_dirty()) return false;
+
+  //wait for the changes to settle
+  if(m_set_count != m_polled_set_count)
+  {
+    m_polled_set_count = m_set_count;
+    m_last_change_ms = now_ms;
+    return false;
+  }
+  if(now_ms - m_last_change_ms < commit_delay_ms) return false;
+  return commit();
+}
+
+uint32_t c_kv_store :: ms_until_commit(uint32_t now_ms) const
+{
+  if(!is_dirty()) return 0xffffffff;
+
+  //a change poll() hasn't seen yet starts the wait
+  if(m_set_count != m_polled_set_count) return 0;
+  const uint32_t waited = now_ms - m_last_change_ms;
+  return waited < commit_delay_ms ? commit_delay_ms - waited : 0;
+}
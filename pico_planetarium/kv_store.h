@@ -0,0 +1,119 @@
+#ifndef __KV_STORE_H__
+#define __KV_STORE_H__
+
+#include <cstdint>
+
+//Small journaled key-value store over a few sectors of flash.
+//
+//set() only changes a copy in RAM. commit() appends the changed values to
+//the active sector as new records, which only programs a page or two.
+//When the active sector is full, every value is written to the next
+//sector in turn, so erases are spread evenly over all of them. The sector
+//header is written last, so a sector only counts once it is complete. A
+//record torn by a power cut fails its CRC, and the last good value of
+//that key is used instead.
+//
+//sector layout (little endian):
+//  s_kv_sector_header
+//  records, each s_kv_record_header then size bytes of data, padded to 4
+//  bytes. Erased flash (key 0xffff) marks the end.
+//
+//Values are checked against the size the caller expects, so a struct
+//that changes size reads as missing rather than as garbage. Use a new key
+//if a struct changes without changing size.
+//
+//Flash access is left to a derived class (FlashStore on the device, a RAM
+//image on the host). Programming is whole, aligned pages.
+
+struct s_kv_sector_header
+{
+  char magic[4]; //"PKVS"
+  uint16_t version;
+  uint16_t reserved;
+  uint32_t sequence; //the highest complete sector is the active one
+  uint32_t crc; //of the fields above
+};
+
+struct s_kv_record_header
+{
+  uint16_t key;
+  uint16_t size;
+  uint32_t crc; //of key, size and the data
+};
+
+class c_kv_store
+{
+  public:
+
+  static const uint32_t sector_size = 4096;
+  static const uint32_t page_size = 256;
+  static const uint16_t version = 1;
+  static const uint8_t max_keys = 8;
+  static const uint16_t max_value_size = 128;
+
+  //changes are committed once nothing has been set for this long
+  static const uint32_t commit_delay_ms = 2000;
+
+  c_kv_store(uint8_t num_sectors);
+  virtual ~c_kv_store(){}
+
+  //read the values from flash, false if there was no store there yet
+  bool open();
+
+  //false if the key is missing or its size is different
+  bool get(uint16_t key, void *data, uint16_t size) const;
+
+  //change the value in RAM, setting the same value again does nothing
+  bool set(uint16_t key, const void *data, uint16_t size);
+
+  bool is_dirty() const;
+  bool commit();
+
+  //commit once there have been no changes for commit_delay_ms, call this
+  //when there is nothing else to do, returns true if it wrote to flash
+  bool poll(uint32_t now_ms);
+
+  //how long until poll() would commit, 0 if it should be called now and
+  //0xffffffff if there is nothing to commit, so the caller can wake for it
+  uint32_t ms_until_commit(uint32_t now_ms) const;
+
+  //diagnostics
+  uint8_t num_sectors() const {return m_num_sectors;}
+  uint32_t sequence() const {return m_sequence;}
+  uint32_t write_offset() const {return m_write_offset;}
+
+  private:
+
+  //offsets are from the start of the store
+  virtual bool flash_read(uint32_t offset, void *data, uint32_t size) = 0;
+  virtual bool flash_program(uint32_t offset, const void *data, uint32_t size) = 0;
+  virtual bool flash_erase(uint32_t offset) = 0;
+
+  struct s_entry
+  {
+    uint16_t key;
+    uint16_t size;
+    bool dirty;
+    uint8_t data[max_value_size];
+  };
+
+  s_entry *find(uint16_t key);
+  const s_entry *find(uint16_t key) const;
+  bool write(uint32_t offset, const void *data, uint32_t size);
+  bool append(const s_entry &entry, uint32_t &offset);
+  bool compact();
+  bool scan(uint8_t sector);
+
+  uint8_t m_num_sectors;
+  uint8_t m_active;
+  uint32_t m_sequence;
+  uint32_t m_write_offset;
+  bool m_needs_compaction;
+  s_entry m_entries[max_keys];
+  uint8_t m_num_entries;
+  uint32_t m_set_count;
+  uint32_t m_polled_set_count;
+  uint32_t m_last_change_ms;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include <cstring>
+#include <algorithm>
+#include "label_layout.h"
+
+c_label_layout :: c_label_layout(c_frame_buffer &frame_buffer, uint16_t width, uint16_t height):
+  frame_buffer(frame_buffer), width(width), height(height)
+{
+  cells_x = (width + cell_size - 1)/cell_size;
+  cells_y = (height + cell_size - 1)/cell_size;
+  occupied = new uint32_t[(cells_x*cells_y + 31)/32];
+  clear();
+}
+
+c_label_layout :: ~c_label_layout()
+{
+  delete[] occupied;
+}
+
+void c_label_layout :: clear()
+{
+  num_labels = 0;
+  std::fill_n(occupied, (cells_x*cells_y + 31)/32, 0);
+}
+
+void c_label_layout :: add(int16_t x, int16_t y, const char *text, uint16_t colour, e_label_priority priority)
+{
+  if(num_labels == max_labels) return;
+  labels[num_labels++] = {text, x, y, colour, (uint8_t)priority};
+}
+
+bool c_label_layout :: claim(int16_t x, int16_t y, uint16_t w, uint16_t h)
+{
+  //clip to the screen as draw_string does, so a label only claims the
+  //cells it is drawn in and one that is entirely off screen claims nothing
+  const int32_t left = std::max<int32_t>(0, x);
+  const int32_t top = std::max<int32_t>(0, y);
+  const int32_t right = std::min<int32_t>(width, x + w);
+  const int32_t bottom = std::min<int32_t>(height, y + h);
+  if(left >= right || top >= bottom) return false;
+
+  const int16_t first_x = left/cell_size;
+  const int16_t first_y = top/cell_size;
+  const int16_t last_x = (right - 1)/cell_size;
+  const int16_t last_y = (bottom - 1)/cell_size;
+
+  for(int16_t cy = first_y; cy <= last_y; ++cy)
+  {
+    for(int16_t cx = first_x; cx <= last_x; ++cx)
+    {
+      const uint32_t cell = cy*cells_x + cx;
+      if(occupied[cell/32] & (1u << (cell%32))) return false;
+    }
+  }
+
+  for(int16_t cy = first_y; cy <= last_y; ++cy)
+  {
+    for(int16_t cx = first_x; cx <= last_x; ++cx)
+    {
+      const uint32_t cell = cy*cells_x + cx;
+      occupied[cell/32] |= 1u << (cell%32);
+    }
+  }
+  return true;
+}
+
+void c_label_layout :: draw(const uint8_t *font)
+{
+  const uint8_t font_height = font[0];
+  const uint8_t font_advance = font[1] + font[2];
+
+  //place labels in priority order, in the order they were added within a priority
+  for(uint8_t priority = 0; priority < num_label_priorities; ++priority)
+  {
+    for(uint16_t idx = 0; idx < num_labels; ++idx)
+    {
+      const s_label &label = labels[idx];
+      if(label.priority != priority) continue;
+      const uint16_t w = strlen(label.text)*font_advance;
+      if(!claim(label.x, label.y, w, font_height)) continue;
+      frame_buffer.draw_string(label.x, label.y, font, label.text, label.colour);
+    }
+  }
+}
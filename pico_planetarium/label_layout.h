@@ -0,0 +1,54 @@
+#ifndef __LABEL_LAYOUT_H__
+#define __LABEL_LAYOUT_H__
+
+#include <cstdint>
+#include "frame_buffer.h"
+
+//lower values are placed first
+enum e_label_priority {
+  planet_label,
+  star_label,
+  constellation_label,
+  object_label,
+  num_label_priorities
+};
+
+struct s_label
+{
+  const char *text;
+  int16_t x;
+  int16_t y;
+  uint16_t colour;
+  uint8_t priority;
+};
+
+//Collects labels during an update, then draws only those that don't overlap
+//a higher priority label. Overlaps are found using a coarse grid of
+//occupied cells rather than comparing every pair of labels.
+class c_label_layout
+{
+  static const uint16_t max_labels = 320;
+  static const uint8_t cell_size = 8;
+
+  c_frame_buffer &frame_buffer;
+  uint16_t width, height;
+  uint16_t cells_x, cells_y;
+  uint32_t *occupied;
+  s_label labels[max_labels];
+  uint16_t num_labels = 0;
+
+  bool claim(int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+  public:
+
+  c_label_layout(c_frame_buffer &frame_buffer, uint16_t width, uint16_t height);
+  ~c_label_layout();
+  c_label_layout(const c_label_layout &) = delete;
+  c_label_layout &operator=(const c_label_layout &) = delete;
+
+  void clear();
+  void add(int16_t x, int16_t y, const char *text, uint16_t colour, e_label_priority priority);
+  void draw(const uint8_t *font);
+};
+
+#endif
@@ -0,0 +1,192 @@
+#include <cstring>
+#include "live_view.h"
+
+static const uint16_t tile_header_size = 9;
+
+//the encoded tile can be a little bigger than the raw pixels, one control
+//byte per 128 literals
+static const uint32_t max_tile_bytes = tile_header_size + c_live_view::tile_size*c_live_view::tile_size*2 + (c_live_view::tile_size*c_live_view::tile_size+127)/128;
+
+static uint8_t *put16(uint8_t *p, uint16_t value)
+{
+  p[0] = value;
+  p[1] = value >> 8;
+  return p + 2;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t value)
+{
+  p = put16(p, value);
+  return put16(p, value >> 16);
+}
+
+c_live_view :: c_live_view(uint16_t width, uint16_t height):
+  m_width(width), m_height(height)
+{
+  m_tiles_x = (width + tile_size - 1)/tile_size;
+  m_tiles_y = (height + tile_size - 1)/tile_size;
+  m_sent_hashes = new uint32_t[m_tiles_x*m_tiles_y];
+  m_sent_valid = new bool[m_tiles_x*m_tiles_y];
+  m_tile_buffer = new uint8_t[max_tile_bytes];
+  reset();
+}
+
+c_live_view :: ~c_live_view()
+{
+  delete[] m_sent_hashes;
+  delete[] m_sent_valid;
+  delete[] m_tile_buffer;
+}
+
+void c_live_view :: reset()
+{
+  //the viewer has nothing yet, so every tile is dirty
+  m_size_sent = false;
+  m_pending = true;
+  m_scan_start = 0;
+  memset(m_sent_valid, 0, (uint32_t)m_tiles_x*m_tiles_y*sizeof(bool));
+}
+
+uint32_t c_live_view :: tile_hash(const uint16_t *pixels, uint16_t x, uint16_t y, uint8_t w, uint8_t h)
+{
+  //FNV-1a over the pixels
+  uint32_t hash = 2166136261u;
+  for(uint16_t row = 0; row < h; ++row)
+  {
+    const uint16_t *p = pixels + (y + row)*m_width + x;
+    for(uint16_t col = 0; col < w; ++col)
+    {
+      hash = (hash ^ p[col]) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+uint16_t c_live_view :: encode_tile(const uint16_t *pixels, uint16_t x, uint16_t y, uint8_t w, uint8_t h)
+{
+  //gather the tile so runs can cross rows
+  uint16_t tile[tile_size*tile_size];
+  uint16_t n = 0;
+  for(uint16_t row = 0; row < h; ++row)
+  {
+    memcpy(tile + n, pixels + (y + row)*m_width + x, w*sizeof(uint16_t));
+    n += w;
+  }
+
+  uint8_t *out = m_tile_buffer + tile_header_size;
+  uint16_t idx = 0;
+  while(idx < n)
+  {
+    //a run of at least 3 pixels is worth encoding as a run
+    uint16_t run = 1;
+    while(idx + run < n && tile[idx + run] == tile[idx] && run < 130) run++;
+    if(run >= 3)
+    {
+      *out++ = run + 125;
+      out = put16(out, tile[idx]);
+      idx += run;
+      continue;
+    }
+
+    //otherwise literals, up to the start of the next run
+    uint16_t literals = 0;
+    while(idx + literals < n && literals < 128)
+    {
+      const uint16_t p = idx + literals;
+      if(p + 2 < n && tile[p] == tile[p+1] && tile[p] == tile[p+2]) break;
+      literals++;
+    }
+    *out++ = literals - 1;
+    for(uint16_t i = 0; i < literals; ++i) out = put16(out, tile[idx + i]);
+    idx += literals;
+  }
+
+  const uint16_t length = out - m_tile_buffer - tile_header_size;
+  uint8_t *header = m_tile_buffer;
+  *header++ = live_view_tile;
+  header = put16(header, x);
+  header = put16(header, y);
+  *header++ = w;
+  *header++ = h;
+  put16(header, length);
+  return tile_header_size + length;
+}
+
+uint32_t c_live_view :: update(const uint16_t *pixels, uint32_t budget)
+{
+  uint32_t sent = 0;
+
+  if(!m_size_sent)
+  {
+    uint8_t message[5] = {live_view_size};
+    put16(put16(message + 1, m_width), m_height);
+    if(budget < sizeof(message) || !stream_write(message, sizeof(message))) return 0;
+    sent += sizeof(message);
+    m_size_sent = true;
+  }
+
+  //start where the last update ran out of budget, so every tile gets a turn
+  const uint32_t num_tiles = (uint32_t)m_tiles_x*m_tiles_y;
+  uint32_t resume = num_tiles;
+  bool any_tiles = false;
+  for(uint32_t n = 0; n < num_tiles; ++n)
+  {
+    const uint32_t tile = (m_scan_start + n) % num_tiles;
+    const uint16_t x = (tile % m_tiles_x)*tile_size;
+    const uint16_t y = (tile / m_tiles_x)*tile_size;
+    const uint8_t w = m_width - x < tile_size ? m_width - x : tile_size;
+    const uint8_t h = m_height - y < tile_size ? m_height - y : tile_size;
+    const uint32_t hash = tile_hash(pixels, x, y, w, h);
+    if(m_sent_valid[tile] && hash == m_sent_hashes[tile]) continue;
+
+    //leave room for the end of frame marker
+    const uint16_t size = encode_tile(pixels, x, y, w, h);
+    if(sent + size + 1 > budget)
+    {
+      if(resume == num_tiles) resume = tile;
+      continue;
+    }
+    if(!stream_write(m_tile_buffer, size)) return sent;
+    sent += size;
+    m_sent_hashes[tile] = hash;
+    m_sent_valid[tile] = true;
+    any_tiles = true;
+  }
+  if(resume != num_tiles) m_scan_start = resume;
+  m_pending = resume != num_tiles;
+
+  if(any_tiles)
+  {
+    const uint8_t message = live_view_frame;
+    if(stream_write(&message, 1)) sent++;
+  }
+  return sent;
+}
+
+bool c_live_view :: send_observer(const s_observer &observer, const s_settings &settings)
+{
+  //settings is all bools, one bit each in declaration order
+  const bool *flags = (const bool*)&settings;
+  uint32_t bits = 0;
+  for(uint8_t idx = 0; idx < sizeof(s_settings) && idx < 32; ++idx)
+  {
+    if(flags[idx]) bits |= 1u << idx;
+  }
+
+  uint8_t message[1 + 5*4 + 8 + 4];
+  uint8_t *p = message;
+  *p++ = live_view_observer;
+  const float values[] = {observer.field, observer.alt, observer.az, observer.latitude, observer.longitude};
+  for(float value : values)
+  {
+    uint32_t raw;
+    memcpy(&raw, &value, sizeof(raw));
+    p = put32(p, raw);
+  }
+  uint64_t raw_date;
+  memcpy(&raw_date, &observer.julian_date, sizeof(raw_date));
+  p = put32(p, raw_date);
+  p = put32(p, raw_date >> 32);
+  put32(p, bits);
+  return stream_write(message, sizeof(message));
+}
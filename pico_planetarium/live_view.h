@@ -0,0 +1,71 @@
+#ifndef __LIVE_VIEW_H__
+#define __LIVE_VIEW_H__
+
+#include <cstdint>
+#include "planetarium.h"
+
+//Streams the frame buffer to a remote viewer. The frame is split into
+//tiles, and only tiles whose hash has changed since they were last sent go
+//out, run length encoded. Each update has a byte budget, tiles that don't
+//fit stay dirty and go in a later update, so a slow link sees fewer, more
+//up to date frames rather than a growing backlog.
+//
+//stream format, all little endian, each message starts with a type byte:
+//  live_view_size:     uint16 width, uint16 height
+//  live_view_tile:     uint16 x, uint16 y, uint8 w, uint8 h, uint16 length,
+//                      then length bytes of w*h pixels, packbits encoded:
+//                      c < 128 c+1 literal pixels follow, c >= 128 the next
+//                      pixel repeats c-125 times
+//  live_view_frame:    end of an update, the viewer can show it
+//  live_view_observer: float field, alt, az, latitude, longitude,
+//                      double julian_date, uint32 settings (one bit per
+//                      s_settings field, in order), so a viewer with its own
+//                      renderer can mirror the sky without any pixels
+//pixels are RGB565, byte swapped as in the frame buffer
+enum e_live_view_message {
+  live_view_size = 1,
+  live_view_tile = 2,
+  live_view_frame = 3,
+  live_view_observer = 4,
+};
+
+class c_live_view
+{
+  public:
+
+  static const uint16_t tile_size = 16;
+
+  c_live_view(uint16_t width, uint16_t height);
+  virtual ~c_live_view();
+
+  //start again with a new viewer, every tile is sent on the next update
+  void reset();
+
+  //send the tiles that changed, up to budget bytes, and return the bytes sent
+  uint32_t update(const uint16_t *pixels, uint32_t budget);
+  bool send_observer(const s_observer &observer, const s_settings &settings);
+
+  //the last update ran out of budget, call update again even if the frame
+  //hasn't changed
+  bool pending() const {return m_pending;}
+
+  private:
+
+  virtual bool stream_write(const uint8_t *data, uint32_t size) = 0;
+
+  uint32_t tile_hash(const uint16_t *pixels, uint16_t x, uint16_t y, uint8_t w, uint8_t h);
+  uint16_t encode_tile(const uint16_t *pixels, uint16_t x, uint16_t y, uint8_t w, uint8_t h);
+
+  uint16_t m_width;
+  uint16_t m_height;
+  uint16_t m_tiles_x;
+  uint16_t m_tiles_y;
+  uint32_t *m_sent_hashes;
+  bool *m_sent_valid;
+  uint32_t m_scan_start;
+  bool m_size_sent;
+  bool m_pending;
+  uint8_t *m_tile_buffer;
+};
+
+#endif
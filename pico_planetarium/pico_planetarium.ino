@@ -1,6 +1,7 @@
 #include "planetarium.h"
 #include "frame_buffer.h"
-#include "images.h"
+#include "catalog_blob.h"
+#include "image_decoder.h"
 
 #include "ctime"
 #include "pico/stdlib.h"
@@ -12,6 +13,9 @@
 #include "font_8x5.h"
 #include "font_16x12.h"
 #include "button.h"
+#include "playback.h"
+#include "hardware/sync.h"
+#include "FlashStore.h"
 
 //CONFIGURATION SECTION
 ///////////////////////////////////////////////////////////////////////////////
@@ -47,11 +51,34 @@
 #define USE_NTP_TIME 1 //use credentials defined in ~/credentials.h
 #define USE_WIFI_MANAGER 1 //use WIFI Manager to get credentials
 
+//With wifi, mirror the display at http://<pico address>/ (the settings menu
+//isn't included)
+#define USE_LIVE_VIEW 1
+
+//With wifi, set the observer, settings and time at
+//http://<pico address>:8080/api/..., see remote_api.h
+#define USE_REMOTE_API 1
+
+//Plot stars from /stars.bin on the flash filesystem (written by
+//model/make_star_tiles.py) instead of the built in Bright Star Catalogue
+#define USE_STAR_CATALOG 0
+
+//The sky is only redrawn when it has moved by a pixel, or in response to
+//the buttons, otherwise the CPU sleeps. Frames while buttons are in use
+//(or during fast playback) are limited to this rate.
+#define MAX_FRAME_RATE 10
+
 
 //END OF CONFIGURATION SECTION
 ///////////////////////////////////////////////////////////////////////////////
 
 bool use_internet_time = true;
+
+//settings and observer are kept in a journal in flash, see kv_store.h
+FlashStore settings_store;
+const uint16_t settings_key = 1;
+const uint16_t observer_key = 2;
+c_playback playback;
 s_observer observer =
 {
   .field              = 60.0f,   //float field of view in degrees 
@@ -80,28 +107,30 @@ s_settings settings =
   .ecliptic = true,
   .alt_az_grid = true,
   .ra_dec_grid = true,
+  .antialiased_lines = false,
+  .proper_motion = true,
 };
 
 #if DISPLAY_TYPE == 0
-  const uint16_t * splash_image = splash_320x240;
+  const char * splash_image = "splash_320x240";
   const uint16_t width = 320u;
   const uint16_t height = 240u;
   uint16_t image[width][height];
   e_display_type display_type = ILI9341;
 #elif DISPLAY_TYPE == 1
-  const uint16_t * splash_image = splash_320x240;
+  const char * splash_image = "splash_320x240";
   const uint16_t width = 320u;
   const uint16_t height = 240u;
   uint16_t image[width][height];
   e_display_type display_type = ILI9341_2;
 #elif DISPLAY_TYPE == 2
-  const uint16_t * splash_image = splash_480x320;
+  const char * splash_image = "splash_480x320";
   const uint16_t width = 480u;
   const uint16_t height = 320u;
   uint16_t image[width][height];
   e_display_type display_type = ST7796;
 #else
-  const uint16_t * splash_image = splash_480x320;
+  const char * splash_image = "splash_480x320";
   const uint16_t width = 480u;
   const uint16_t height = 320u;
   uint16_t image[width][height];
@@ -114,17 +143,79 @@ s_settings settings =
   #if USE_WIFI_MANAGER
     #include "WiFiManager.h"
   #endif
+  #if USE_LIVE_VIEW
+    #include "LiveViewServer.h"
+    LiveViewServer liveView(width, height);
+  #endif
+  #if USE_REMOTE_API
+    #include "RemoteApi.h"
+    RemoteApi remoteApi(observer, settings);
+  #endif
 #endif
 
 
+#if USE_STAR_CATALOG
+  #include <LittleFS.h>
+  #include "star_catalog.h"
+
+  //works with any Arduino filesystem, e.g. SD instead of LittleFS
+  class c_star_catalog_fs : public c_star_catalog
+  {
+    public:
+    //32KB of stars, shared out between the tiles in view
+    c_star_catalog_fs(fs::FS &fs):c_star_catalog(4096), fs(fs){}
+
+    private:
+    bool file_open(const char* filename)
+    {
+      f = fs.open(filename, "r");
+      return f;
+    }
+
+    void file_close()
+    {
+      f.close();
+    }
+
+    void file_read(void* data, uint32_t element_size, uint32_t num_elements)
+    {
+      f.read((uint8_t*)data, element_size*num_elements);
+    }
+
+    void file_seek(uint32_t offset)
+    {
+      f.seek(offset);
+    }
+
+    fs::FS &fs;
+    File f;
+  };
+  c_star_catalog_fs star_catalog(LittleFS);
+#endif
+
 ILI934X *display;
 c_frame_buffer frame_buffer((uint16_t*)image, width, height);
 c_planetarium planetarium(frame_buffer, width, height);
 
+//the splash screen is compressed, decode it a strip at a time into the
+//(not yet used) frame buffer and send each strip to the display
+void draw_splash()
+{
+  const uint16_t strip_height = 16;
+  c_image_decoder decoder(catalog_blob.image(splash_image));
+  for(uint16_t y = 0; y < height; y += strip_height)
+  {
+    uint16_t rows = height - y < strip_height ? height - y : strip_height;
+    decoder.decode((uint16_t*)image, width*rows);
+    display->writeImage(0, y, width, rows, (uint16_t*)image);
+  }
+}
+
 void setup() {
   Serial.begin(115200);
+  catalog_blob.attach(catalog_blob_data, catalog_blob_size);
   configure_display();
-  display->writeImage(0, 0, width, height, splash_image);
+  draw_splash();
   Serial.println("Pico Planetarium (C) Jonathan P Dawson 2025");
   Serial.println("github: https://github.com/dawsonjon/101Things");
   Serial.println("docs: 101-things.readthedocs.io");
@@ -142,15 +233,24 @@ void setup() {
       String maker("101 Things");
       String version("0.0.1");
 
-      WiFiManager wm("PICO_PLANETARIUM", "password");
-      wm.setContentText(title, name, shortname, maker, version);
-      wm.autoConnect();
+      //the portal stops its web server when wm goes out of scope
+      {
+        WiFiManager wm("PICO_PLANETARIUM", "password");
+        wm.setContentText(title, name, shortname, maker, version);
+        wm.autoConnect();
+      }
     #else
     #include "~/credentials.h"
       Serial.print("Connecting to WiFi...");
       WiFi.begin(ssid, password);
     #endif
     ntpTime.begin();
+    #if USE_LIVE_VIEW
+      liveView.begin();
+    #endif
+    #if USE_REMOTE_API
+      remoteApi.begin();
+    #endif
   
   #else
 
@@ -167,10 +267,58 @@ void setup() {
   
   #endif
 
+  if(!settings_store.begin() && !settings_store.isAvailable())
+  {
+    Serial.println("The sketch overlaps the settings store, settings won't be saved");
+  }
   load_settings(settings);
   load_observer(observer);
+
+  #if USE_STAR_CATALOG
+    if(LittleFS.begin() && star_catalog.open("/stars.bin"))
+    {
+      planetarium.set_star_catalog(&star_catalog);
+    }
+  #endif
+}
+
+
+//the status bar is drawn over a copy of the sky behind it, so it can be
+//updated without rendering the sky again
+const uint16_t status_bar_height = 22;
+uint16_t sky_under_status_bar[width*status_bar_height];
+uint16_t * const status_bar = (uint16_t*)image + (height-status_bar_height)*width;
+
+//microseconds for the sky to drift by about one pixel
+uint32_t sky_redraw_interval(const s_observer &observer)
+{
+  const float degrees_per_pixel = observer.field/width;
+  const float degrees_per_second = (360.0f/86164.0905f)*playback.time_multiplier();
+  const float interval = 1.0e6f*degrees_per_pixel/degrees_per_second;
+  return interval < 60.0e6f ? interval : 60.0e6f;
 }
 
+//sleep until an interrupt, at most timeout_us
+volatile bool sleep_timeout;
+int64_t wake_up(alarm_id_t id, void *user_data)
+{
+  sleep_timeout = true;
+  return 0;
+}
+
+void sleep_for(uint32_t timeout_us)
+{
+  if(timeout_us < 100) return;
+  sleep_timeout = false;
+  const alarm_id_t alarm = add_alarm_in_us(timeout_us, &wake_up, nullptr, true);
+
+  //with interrupts masked, an event arriving after the check still wakes __wfi
+  const uint32_t status = save_and_disable_interrupts();
+  if(!sleep_timeout && button_events.empty()) __wfi();
+  restore_interrupts(status);
+
+  if(alarm > 0) cancel_alarm(alarm);
+}
 
 void loop()
 {
@@ -182,25 +330,113 @@ void loop()
   }
   #endif
 
-  //get time
-  time_t now;
-  time(&now);
-  tm *current_time = gmtime(&now); 
-  observer.year  = current_time->tm_year + 1900;
-  observer.month = current_time->tm_mon+1; 
-  observer.day   = current_time->tm_mday;
-  observer.hour  = current_time->tm_hour; 
-  observer.min   = current_time->tm_min; 
-  observer.sec   = current_time->tm_sec;  
-  
-  uint32_t start = micros();
-  planetarium.update(observer, settings);
-  user_interface(frame_buffer, observer, settings, use_internet_time);
-  display->writeImage(0, 0, width, height, (uint16_t*)image);
-  uint32_t elapsed = micros()-start;
-  
-  //Serial.println(spi_get_baudrate(SPI_PORT));
-  //Serial.println(elapsed/1000);
+  #if USE_NTP_TIME && USE_REMOTE_API
+  const bool api_input = remote_api_input();
+  #else
+  const bool api_input = false;
+  #endif
+
+  //get time, from the playback clock when animating
+  static uint32_t last_frame = micros();
+  const uint32_t frame_start = micros();
+  if(playback.is_playing())
+  {
+    playback.advance((frame_start - last_frame)*1.0e-6f, observer);
+  }
+  else
+  {
+    timeval now;
+    gettimeofday(&now, NULL);
+    tm *current_time = gmtime(&now.tv_sec); 
+    observer.year  = current_time->tm_year + 1900;
+    observer.month = current_time->tm_mon+1; 
+    observer.day   = current_time->tm_mday;
+    observer.hour  = current_time->tm_hour; 
+    observer.min   = current_time->tm_min; 
+    observer.sec   = current_time->tm_sec;  
+    observer.julian_date = unix_to_julian_date(now.tv_sec + now.tv_usec*1.0e-6);
+  }
+  last_frame = frame_start;
+
+  //decide what needs drawing
+  static bool sky_pending = true;
+  static uint32_t last_sky = 0;
+  static uint8_t last_sec = 60;
+  const uint32_t frame_interval = 1000000/MAX_FRAME_RATE;
+  const uint32_t since_sky = frame_start - last_sky;
+  const bool sky_moved = since_sky >= sky_redraw_interval(observer);
+  const bool clock_ticked = observer.sec != last_sec;
+  last_sec = observer.sec;
+  bool sky_drawn = false, frame_changed = false;
+  sky_pending |= api_input;
+
+  if((sky_pending || sky_moved) && since_sky >= frame_interval)
+  {
+    const uint32_t render_start = micros();
+    planetarium.update(observer, settings);
+    const uint32_t render_us = micros() - render_start;
+    memcpy(sky_under_status_bar, status_bar, sizeof(sky_under_status_bar));
+    last_sky = frame_start;
+    sky_pending = user_interface(frame_buffer, observer, settings, use_internet_time);
+    const uint32_t push_start = micros();
+    push_rows(0, height);
+    sky_drawn = frame_changed = true;
+
+    #if USE_NTP_TIME && USE_REMOTE_API
+    s_frame_profile &profile = remoteApi.profile;
+    profile.frames++;
+    profile.render_us = render_us;
+    if(render_us > profile.max_render_us) profile.max_render_us = render_us;
+    profile.push_us = micros() - push_start;
+    #endif
+  }
+  else
+  {
+    memcpy(status_bar, sky_under_status_bar, sizeof(sky_under_status_bar));
+    const bool input = user_interface(frame_buffer, observer, settings, use_internet_time);
+    sky_pending |= input;
+    if(input || clock_ticked)
+    {
+      push_rows(height-status_bar_height, height);
+      frame_changed = true;
+    }
+  }
+
+  #if USE_NTP_TIME && USE_LIVE_VIEW
+  if(liveView.poll()) sky_drawn = frame_changed = true;
+  if(liveView.isStreaming())
+  {
+    if(frame_changed || liveView.pending()) liveView.sendFrame((uint16_t*)image);
+    if(sky_drawn) liveView.sendObserver(observer, settings);
+  }
+  #endif
+
+  //sleep until the sky needs redrawing or the clock next ticks
+  uint32_t next_sky = (sky_pending ? frame_interval : sky_redraw_interval(observer)) - (micros() - last_sky);
+  if((int32_t)next_sky < 0) next_sky = 0;
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  const uint32_t next_tick = 1000000 - tv.tv_usec;
+  uint32_t sleep_us = playback.is_playing() ? next_sky : (next_sky < next_tick ? next_sky : next_tick);
+
+  #if USE_NTP_TIME
+  //look for the NTP reply often, it is timestamped when it is read
+  if(use_internet_time && ntpTime.is_waiting() && sleep_us > 1000) sleep_us = 1000;
+  #endif
+
+  #if USE_NTP_TIME && USE_LIVE_VIEW
+  //tiles left over when the viewer couldn't keep up
+  if(liveView.isStreaming() && liveView.pending() && sleep_us > frame_interval) sleep_us = frame_interval;
+  #endif
+
+  //write settings to flash between sky renders, the wait for changes to
+  //settle means a burst of button presses is a single write. Waking for the
+  //commit lands between renders, since the sky is never redrawn that soon
+  if(!sky_drawn) settings_store.poll(millis());
+  const uint32_t commit_ms = settings_store.ms_until_commit(millis());
+  if(commit_ms < sleep_us/1000) sleep_us = commit_ms*1000;
+
+  sleep_for(sleep_us);
 
 }
 
@@ -225,51 +461,274 @@ button button_down(20);
 button button_right(21); 
 button button_left(22); 
 
-bool number_entry(uint8_t min, uint8_t max, int &value)
+bool number_entry(const s_button_event &event, uint8_t min, uint8_t max, int &value)
 {
-  if(button_down.is_pressed() || button_down.is_held() && value > min){value--; return true;}
-  if(button_up.is_pressed() || button_up.is_held() && value < max){value++; return true;}
+  const bool pressed = event.type == s_button_event::pressed;
+  if(event.source == &button_down && (pressed || value > min)){value--; return true;}
+  if(event.source == &button_up && (pressed || value < max)){value++; return true;}
   return false;
 }
 
-bool bool_entry(bool &value)
+bool bool_entry(const s_button_event &event, bool &value)
 {
-  if(button_down.is_pressed()){value=!value; return true;}
-  if(button_up.is_pressed()){value=!value; return true;}
+  if(event.type != s_button_event::pressed) return false;
+  if(event.source == &button_down){value=!value; return true;}
+  if(event.source == &button_up){value=!value; return true;}
   return false;
 }
 
-bool number_entry(float min, float max, float step, float &value)
+bool number_entry(const s_button_event &event, float min, float max, float step, float &value)
 {
-  if(button_down.is_pressed()) 
+  //held buttons repeat in bigger steps
+  if(event.type == s_button_event::held) step *= 10;
+
+  if(event.source == &button_down) 
   {
     value-=step;
     if(value < min) value = max;
     return true;
   }
-  if(button_up.is_pressed())
+  if(event.source == &button_up)
   {
     value+=step;
     if(value > max) value = min;
     return true;
   } 
-  if(button_down.is_held()) 
+
+  return false;
+}
+
+//The settings menu is drawn over the sky in strips, a header then one strip
+//per item on screen. Each strip is composited over a copy of the frame
+//buffer rows behind it, so the sky is left intact and the menu can be
+//updated, or removed, by sending just the rows that change.
+const uint8_t num_settings = 17;
+const uint8_t num_menu_items = num_settings+2;
+const uint8_t num_items_on_screen = 8;
+const uint8_t num_menu_strips = num_items_on_screen+1;
+const uint16_t menu_width = 320;
+const uint16_t menu_header_height = 45;
+const uint16_t menu_item_height = 25;
+const uint16_t menu_height = menu_header_height + num_items_on_screen*menu_item_height;
+const uint16_t menu_left = (width-menu_width)/2;
+const uint16_t menu_top = height > menu_height ? (height-menu_height)/2 : 0;
+const uint16_t menu_bottom = menu_top + menu_height < height ? menu_top + menu_height : height;
+
+const char* const menu_items[num_menu_items] = {
+    "Constellation Lines",
+    "Constellation Names",
+    "Star Names",
+    "Deep Sky Objects",
+    "Deep Sky Object Names",
+    "Planets",
+    "Planet Names",
+    "Moon",
+    "Moon Name",
+    "Sun",
+    "Sun Name",
+    "Celestial Equator",
+    "Ecliptic",
+    "ALT/AZ Grid",
+    "RA/DEC Grid",
+    "Antialiased Lines",
+    "Proper Motion",
+    "Accept",
+    "Cancel"
+};
+
+bool menu_open = false;
+uint8_t menu_selection = 0;
+uint8_t menu_offset = 0;
+bool menu_settings[num_settings];
+uint16_t menu_strip[width*menu_header_height];
+
+uint16_t menu_strip_top(uint8_t strip)
+{
+  return menu_top + (strip ? menu_header_height + (strip-1)*menu_item_height : 0);
+}
+
+uint16_t menu_strip_rows(uint8_t strip)
+{
+  const uint16_t top = menu_strip_top(strip);
+  const uint16_t rows = strip ? menu_item_height : menu_header_height;
+  if(top >= height) return 0;
+  return top + rows < height ? rows : height - top;
+}
+
+void draw_menu_strip(uint8_t strip)
+{
+  const uint16_t top = menu_strip_top(strip);
+  const uint16_t rows = menu_strip_rows(strip);
+  if(!rows) return;
+
+  memcpy(menu_strip, (uint16_t*)image + top*width, width*rows*sizeof(uint16_t));
+  c_frame_buffer strip_buffer(menu_strip, width, rows);
+  strip_buffer.fill_rect(menu_left, 0, menu_width, rows, 0, 224);
+
+  if(strip == 0)
   {
-    value-=(step*10);
-    if(value < min) value = max;
-    return true;
+    strip_buffer.draw_string((width-(4*12))/2, 5, font_16x12, "Menu", strip_buffer.colour565(0, 255, 128));
+    strip_buffer.draw_line(menu_left, 35, menu_left+menu_width, 35, strip_buffer.colour565(0, 255, 128));
   }
-  if(button_up.is_held())
+  else
   {
-    value+=(step*10);
-    if(value > max) value = min;
-    return true;
+    const uint8_t menu_item_index = menu_offset + strip - 1;
+    if(menu_item_index < num_settings)
+    {
+      uint16_t colour = menu_selection == menu_item_index?strip_buffer.colour565(255, 0, 255):strip_buffer.colour565(128, 0, 128);
+      strip_buffer.draw_string(menu_left+3, 0, font_16x12, menu_items[menu_item_index],  colour);
+      strip_buffer.draw_char(menu_left+menu_width-16, 0, font_16x12, menu_settings[menu_item_index]?'Y':'N',  colour);
+    }
+    else
+    {
+      uint16_t colour = menu_selection == menu_item_index?strip_buffer.colour565(0, 255, 128):strip_buffer.colour565(0, 128, 64);
+      strip_buffer.draw_string((width-strlen(menu_items[menu_item_index])*12)/2, 0, font_16x12, menu_items[menu_item_index],  colour);
+    }
   }
 
+  display->writeImage(0, top, width, rows, menu_strip);
+}
+
+//send frame buffer rows to the display, with the menu over them if it is open
+void push_rows(uint16_t y_begin, uint16_t y_end)
+{
+  uint16_t y = y_begin;
+  if(menu_open)
+  {
+    for(uint8_t strip = 0; strip < num_menu_strips; ++strip)
+    {
+      const uint16_t top = menu_strip_top(strip);
+      const uint16_t rows = menu_strip_rows(strip);
+      if(!rows || top + rows <= y || top >= y_end) continue;
+      if(top > y) display->writeImage(0, y, width, top-y, (uint16_t*)image + y*width);
+      draw_menu_strip(strip);
+      y = top + rows;
+    }
+  }
+  if(y < y_end) display->writeImage(0, y, width, y_end-y, (uint16_t*)image + y*width);
+}
+
+void open_menu(const s_settings &settings)
+{
+  menu_settings[0] = settings.constellation_lines;
+  menu_settings[1] = settings.constellation_names;
+  menu_settings[2] = settings.star_names;
+  menu_settings[3] = settings.deep_sky_objects;
+  menu_settings[4] = settings.deep_sky_object_names;
+  menu_settings[5] = settings.planets;
+  menu_settings[6] = settings.planet_names;
+  menu_settings[7] = settings.moon;
+  menu_settings[8] = settings.moon_name;
+  menu_settings[9] = settings.sun;
+  menu_settings[10] = settings.sun_name;
+  menu_settings[11] = settings.celestial_equator;
+  menu_settings[12] = settings.ecliptic;
+  menu_settings[13] = settings.alt_az_grid;
+  menu_settings[14] = settings.ra_dec_grid;
+  menu_settings[15] = settings.antialiased_lines;
+  menu_settings[16] = settings.proper_motion;
+
+  menu_selection = 0;
+  menu_offset = 0;
+  menu_open = true;
+  push_rows(menu_top, menu_bottom);
+}
+
+void close_menu()
+{
+  menu_open = false;
+  push_rows(menu_top, menu_bottom);
+}
+
+//handle a button event while the menu is open, returns true if the
+//settings were changed
+bool menu_input(const s_button_event &event, s_settings &settings)
+{
+  if(event.type != s_button_event::pressed) return false;
+  const bool up_or_down = event.source == &button_up || event.source == &button_down;
+  const uint8_t old_selection = menu_selection;
+  const uint8_t old_offset = menu_offset;
+
+  if(event.source == &button_left && menu_selection > 0) menu_selection--;
+  if(event.source == &button_right && menu_selection < num_menu_items-1) menu_selection++;
+  if(up_or_down && menu_selection < num_settings) menu_settings[menu_selection] = !menu_settings[menu_selection];
+
+  if(menu_selection == num_menu_items-2 && up_or_down)
+  {
+    settings.constellation_lines=menu_settings[0];
+    settings.constellation_names=menu_settings[1];
+    settings.star_names=menu_settings[2];
+    settings.deep_sky_objects=menu_settings[3];
+    settings.deep_sky_object_names=menu_settings[4];
+    settings.planets=menu_settings[5];
+    settings.planet_names=menu_settings[6];
+    settings.moon=menu_settings[7];
+    settings.moon_name=menu_settings[8];
+    settings.sun=menu_settings[9];
+    settings.sun_name=menu_settings[10];
+    settings.celestial_equator=menu_settings[11];
+    settings.ecliptic=menu_settings[12];
+    settings.alt_az_grid=menu_settings[13];
+    settings.ra_dec_grid=menu_settings[14];
+    settings.antialiased_lines=menu_settings[15];
+    settings.proper_motion=menu_settings[16];
+
+    save_settings(settings);
+    close_menu();
+    return true;//accept
+  } 
+  if(menu_selection == num_menu_items-1 && up_or_down)
+  {
+    close_menu();
+    return false;//cancel
+  }
+
+  while(menu_selection < menu_offset) menu_offset--;
+  while(menu_selection > menu_offset+num_items_on_screen-1) menu_offset++;
+
+  //scrolling changes every item, otherwise only the old and new selection
+  if(menu_offset != old_offset)
+  {
+    for(uint8_t strip = 1; strip < num_menu_strips; ++strip) draw_menu_strip(strip);
+  }
+  else
+  {
+    draw_menu_strip(old_selection - menu_offset + 1);
+    if(menu_selection != old_selection) draw_menu_strip(menu_selection - menu_offset + 1);
+  }
   return false;
 }
 
-void user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settings &settings, bool &use_internet_time)
+#if USE_NTP_TIME && USE_REMOTE_API
+//apply requests from the network, returns true if the sky needs drawing
+//again. However many requests came in, they cost one render.
+bool remote_api_input()
+{
+  remoteApi.set_time((observer.julian_date - 2440587.5)*86400.0, use_internet_time);
+  remoteApi.handleClient();
+  const uint8_t changes = remoteApi.take_changes();
+
+  if(changes & api_time_changed)
+  {
+    use_internet_time = remoteApi.internet_time_requested();
+    if(!use_internet_time)
+    {
+      const double seconds = remoteApi.requested_time();
+      timeval tv = {.tv_sec = (time_t)seconds, .tv_usec = (suseconds_t)((seconds - floor(seconds))*1.0e6)};
+      settimeofday(&tv, NULL);
+      observer.julian_date = unix_to_julian_date(seconds);
+      if(playback.is_playing()) playback.start(observer, playback.get_rate());
+    }
+  }
+  if(changes & api_settings_changed) save_settings(settings);
+  if(changes & api_observer_changed) save_observer(observer);
+  return changes != 0;
+}
+#endif
+
+//handle button events and draw the status bar, returns true if the sky
+//needs drawing again
+bool user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settings &settings, bool &use_internet_time)
 {
   static uint8_t menu_item = 0;
   
@@ -280,53 +739,60 @@ void user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settin
   const uint8_t fov = 4;
   const uint8_t tmode = 5;
   const uint8_t menu = 6;
-  const uint16_t year = 7;
-  const uint8_t month = 8;
-  const uint8_t day = 9;
-  const uint8_t hour = 10;
-  const uint8_t min = 11;
-  const uint8_t second = 12;
-
-  if(button_left.is_pressed() && menu_item > 0) menu_item--;
-  if(button_right.is_pressed() && menu_item < second) menu_item++;
+  const uint8_t play = 7;
+  const uint16_t year = 8;
+  const uint8_t month = 9;
+  const uint8_t day = 10;
+  const uint8_t hour = 11;
+  const uint8_t min = 12;
+  const uint8_t second = 13;
 
   time_t now;
   time(&now);
   tm ct = *gmtime(&now); 
 
   bool time_changed=false;
-  static bool observer_changed = false;
-  static uint8_t timeout = 40;
-  switch(menu_item)
-  {
-    case lat: observer_changed |= number_entry(-90.0f, 90.0f, 0.1f, observer.latitude); break;
-    case lon: observer_changed |= number_entry(-180.0f, 180.0f, 0.1f, observer.longitude); break;
-    case alt: observer_changed |= number_entry(-90.0f, 90.0f, 1.0f, observer.alt); break;
-    case az:  observer_changed |= number_entry(0.0f, 360.0f, 1.0f, observer.az); break;
-    case fov: observer_changed |= number_entry(0.0f, 180.0f, 1.0f, observer.field); break;
-    case tmode: bool_entry(use_internet_time); break;
-    case menu: if(button_up.is_pressed()) launch_menu(frame_buffer, observer, settings, use_internet_time); break;
-    
-    case year:   time_changed |= number_entry(100, 150, ct.tm_year); break;
-    case month:  time_changed |= number_entry(0, 11, ct.tm_mon); break;
-    case day:    time_changed |= number_entry(1, 31, ct.tm_mday); break;
-    case hour:   time_changed |= number_entry(0, 23, ct.tm_hour); break;
-    case min:    time_changed |= number_entry(0, 59, ct.tm_min); break;
-    case second: time_changed |= number_entry(0, 59, ct.tm_sec); break;
-  }
+  bool observer_changed=false;
 
-  //use a timeout for observer changes to avoid writing to flash too often
-  if(observer_changed)
+  //handle every button event since the last frame
+  bool handled = false;
+  s_button_event event;
+  while(button_events.pop(event))
   {
-    if(timeout-- == 0)
+    //the menu takes all the buttons while it is open
+    if(menu_open)
+    {
+      handled |= menu_input(event, settings);
+      continue;
+    }
+
+    handled = true;
+    const bool pressed = event.type == s_button_event::pressed;
+    if(pressed && event.source == &button_left && menu_item > 0) menu_item--;
+    if(pressed && event.source == &button_right && menu_item < second) menu_item++;
+
+    switch(menu_item)
     {
-      timeout = 40;
-      observer_changed = false;
-      save_observer(observer);
-      Serial.println("writing observer to EEPROM");
+      case lat: observer_changed |= number_entry(event, -90.0f, 90.0f, 0.1f, observer.latitude); break;
+      case lon: observer_changed |= number_entry(event, -180.0f, 180.0f, 0.1f, observer.longitude); break;
+      case alt: observer_changed |= number_entry(event, -90.0f, 90.0f, 1.0f, observer.alt); break;
+      case az:  observer_changed |= number_entry(event, 0.0f, 360.0f, 1.0f, observer.az); break;
+      case fov: observer_changed |= number_entry(event, 0.0f, 180.0f, 1.0f, observer.field); break;
+      case tmode: bool_entry(event, use_internet_time); break;
+      case menu: if(pressed && event.source == &button_up) open_menu(settings); break;
+      case play: if(pressed && (event.source == &button_up || event.source == &button_down)) playback.next_rate(observer); break;
+      
+      case year:   time_changed |= number_entry(event, 100, 150, ct.tm_year); break;
+      case month:  time_changed |= number_entry(event, 0, 11, ct.tm_mon); break;
+      case day:    time_changed |= number_entry(event, 1, 31, ct.tm_mday); break;
+      case hour:   time_changed |= number_entry(event, 0, 23, ct.tm_hour); break;
+      case min:    time_changed |= number_entry(event, 0, 59, ct.tm_min); break;
+      case second: time_changed |= number_entry(event, 0, 59, ct.tm_sec); break;
     }
   }
 
+  if(observer_changed) save_observer(observer);
+
   if(!use_internet_time && time_changed)
   {
     timeval tv = {.tv_sec = mktime(&ct)};
@@ -334,7 +800,7 @@ void user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settin
   }
   char buffer[100];
 
-  frame_buffer.fill_rect(0, height-22, width, 22, 0, 128);
+  frame_buffer.fill_rect(0, height-status_bar_height, width, status_bar_height, 0, 128);
 
   const uint16_t inactive_colour = frame_buffer.colour565(255, 255, 255);
   const uint16_t active_colour = frame_buffer.colour565(255, 0, 0);
@@ -370,6 +836,10 @@ void user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settin
 
   colour = menu_item==menu?active_colour:inactive_colour;
   frame_buffer.draw_string(216, height-20, font_8x5, "Menu", colour);
+
+  snprintf(buffer, 100, "%c%s", playback.is_playing()?CHAR_PLAY:CHAR_STOP, playback.is_playing()?playback.rate_name():"");
+  colour = menu_item==play?active_colour:inactive_colour;
+  frame_buffer.draw_string(216, height-10, font_8x5, buffer, colour);
   
   uint16_t x=width-(12*6);
 
@@ -406,147 +876,86 @@ void user_interface(c_frame_buffer &frame_buffer, s_observer &observer, s_settin
   colour = menu_item==day?active_colour:inactive_colour;
   frame_buffer.draw_string(x, height-10, font_8x5, buffer, colour);
 
+  return handled;
 }
 
-void launch_menu(c_frame_buffer &frame_buffer, s_observer &observer, s_settings &settings, bool &use_internet_time)
+//saving only updates the copy in RAM, settings_store.poll() writes it to flash later
+void save_settings(s_settings settings)
 {
-  uint8_t menu_item = 0;
-  const uint8_t num_settings = 15;
-  const uint8_t num_menu_items = num_settings+2;
-  const uint8_t num_items_on_screen = 8;
-  uint8_t offset = 0;
-
-  bool settings_array[num_settings] = {
-    settings.constellation_lines,
-    settings.constellation_names,
-    settings.star_names,
-    settings.deep_sky_objects,
-    settings.deep_sky_object_names,
-    settings.planets,
-    settings.planet_names,
-    settings.moon,
-    settings.moon_name,
-    settings.sun,
-    settings.sun_name,
-    settings.celestial_equator,
-    settings.ecliptic,
-    settings.alt_az_grid,
-    settings.ra_dec_grid
-  };
-  const char* const menu_items[] = {
-      "Constellation Lines",
-      "Constellation Names",
-      "Star Names",
-      "Deep Sky Objects",
-      "Deep Sky Object Names",
-      "Planets",
-      "Planet Names",
-      "Moon",
-      "Moon Name",
-      "Sun",
-      "Sun Name",
-      "Celestial Equator",
-      "Ecliptic",
-      "ALT/AZ Grid",
-      "RA/DEC Grid",
-      "Accept",
-      "Cancel"
-  };
-
-  while(1)
-  {
-
-    frame_buffer.fill_rect((width-320)/2, (height-240)/2-5, 320, 240, 0);
-    frame_buffer.draw_string((width-(4*12))/2, (height-240)/2, font_16x12, "Menu", frame_buffer.colour565(0, 255, 128));
-    frame_buffer.draw_line((width-320)/2, (height-240)/2+30, (width-320)/2+320, (height-240)/2+30, frame_buffer.colour565(0, 255, 128));
-
-    for(uint8_t idx=0; idx < num_items_on_screen; ++idx)
-    {
-      const uint8_t menu_item_index = idx + offset;
-      
-
-      if(menu_item_index < num_settings)
-      {
-        uint16_t colour = menu_item == menu_item_index?frame_buffer.colour565(255, 0, 255):frame_buffer.colour565(128, 0, 128);
-        frame_buffer.draw_string((width-320)/2+3, 40 + ((height-240)/2) + ((idx)*25), font_16x12, menu_items[menu_item_index],  colour);
-        if(settings_array[menu_item_index]) frame_buffer.draw_char((width-320)/2+320-16, 40 + ((height-240)/2) + ((idx)*25), font_16x12, 'Y',  colour);
-        else frame_buffer.draw_char((width-320)/2+320-16, 40 + ((height-240)/2) + ((idx)*25), font_16x12, 'N',  colour);
-      }
-      else
-      {
-        uint16_t colour = menu_item == menu_item_index?frame_buffer.colour565(0, 255, 128):frame_buffer.colour565(0, 128, 64);
-        frame_buffer.draw_string((width-strlen(menu_items[menu_item_index])*12)/2, 40 + ((height-240)/2) + ((idx)*25), font_16x12, menu_items[menu_item_index],  colour);
-      }    
-    }
-
-    if(button_left.is_pressed() && menu_item > 0) menu_item--;
-    if(button_right.is_pressed() && menu_item < num_menu_items-1) menu_item++;
-    if(button_up.is_pressed() && menu_item < num_settings) settings_array[menu_item] = !settings_array[menu_item];
-    if(button_down.is_pressed() && menu_item < num_settings) settings_array[menu_item] = !settings_array[menu_item];
-    
-    if(menu_item < offset) offset--;
-    if(menu_item > offset+num_items_on_screen-1) offset++;
-
-    display->writeImage(0, 0, width, height, (uint16_t*)image);
-
-    if(menu_item == num_menu_items-2 && (button_up.is_pressed()||button_down.is_pressed()))
-    {
-      settings.constellation_lines=settings_array[0];
-      settings.constellation_names=settings_array[1];
-      settings.star_names=settings_array[2];
-      settings.deep_sky_objects=settings_array[3];
-      settings.deep_sky_object_names=settings_array[4];
-      settings.planets=settings_array[5];
-      settings.planet_names=settings_array[6];
-      settings.moon=settings_array[7];
-      settings.moon_name=settings_array[8];
-      settings.sun=settings_array[9];
-      settings.sun_name=settings_array[10];
-      settings.celestial_equator=settings_array[11];
-      settings.ecliptic=settings_array[12];
-      settings.alt_az_grid=settings_array[13];
-      settings.ra_dec_grid=settings_array[14];
-
-      save_settings(settings);
-
-      return;//accept
-    } 
-    if(menu_item == num_menu_items-1 && (button_up.is_pressed()||button_down.is_pressed())) return;//cancel
-  }
+  settings_store.set(settings_key, &settings, sizeof(settings));
 }
 
-void save_settings(s_settings settings)
+//Versions before the flash store saved settings and the observer in
+//EEPROM, at 256 and 384, each with a marker of 123 in front. They were
+//written with these layouts, fields added since keep their defaults.
+static bool s_settings::* const legacy_settings[] = {
+  &s_settings::constellation_lines, &s_settings::constellation_names, &s_settings::star_names,
+  &s_settings::deep_sky_objects, &s_settings::deep_sky_object_names, &s_settings::planets,
+  &s_settings::planet_names, &s_settings::moon, &s_settings::moon_name, &s_settings::sun,
+  &s_settings::sun_name, &s_settings::celestial_equator, &s_settings::ecliptic,
+  &s_settings::alt_az_grid, &s_settings::ra_dec_grid,
+};
+const uint8_t num_legacy_settings = sizeof(legacy_settings)/sizeof(legacy_settings[0]);
+
+struct s_legacy_observer
 {
-  //save settings to EEPROM
-  EEPROM.put(260, settings);
-  uint32_t settings_stored = 0;
-  EEPROM.get(256, settings_stored);
-  if(settings_stored != 123) EEPROM.put(256, 123);
-  EEPROM.commit();
-}
+  float field, alt, az, smallest_magnitude;
+  float latitude, longitude;
+  uint16_t year;
+  uint8_t month, day, hour, min, sec;
+};
+static_assert(sizeof(s_legacy_observer) == 32, "s_legacy_observer must match the layout old versions wrote");
+
+//the same size WiFiManager uses, so it doesn't matter which begins it first
+const uint16_t eeprom_size = 512;
 
 void load_settings(s_settings &settings)
 {
-  //read settings from EEPROM
+  if(settings_store.get(settings_key, &settings, sizeof(settings))) return;
+
+  EEPROM.begin(eeprom_size);
   uint32_t settings_stored = 0;
   EEPROM.get(256, settings_stored);
-  if(settings_stored == 123) EEPROM.get(260, settings);
+  if(settings_stored == 123)
+  {
+    uint8_t legacy[num_legacy_settings];
+    EEPROM.get(260, legacy);
+    for(uint8_t idx = 0; idx < num_legacy_settings; ++idx) settings.*legacy_settings[idx] = legacy[idx] != 0;
+    save_settings(settings);
+  }
+  EEPROM.end();
 }
 
 void save_observer(s_observer observer)
 {
-  //save settings to EEPROM
-  EEPROM.put(388, observer);
-  uint32_t observer_stored = 0;
-  EEPROM.get(384, observer_stored);
-  if(observer_stored != 123) EEPROM.put(384, 123);
-  EEPROM.commit();
+  settings_store.set(observer_key, &observer, sizeof(observer));
 }
 
 void load_observer(s_observer &observer)
 {
-  //read settings from EEPROM
+  if(settings_store.get(observer_key, &observer, sizeof(observer))) return;
+
+  EEPROM.begin(eeprom_size);
   uint32_t observer_stored = 0;
   EEPROM.get(384, observer_stored);
-  if(observer_stored == 123) EEPROM.get(388, observer);
+  if(observer_stored == 123)
+  {
+    s_legacy_observer legacy;
+    EEPROM.get(388, legacy);
+    observer.field = legacy.field;
+    observer.alt = legacy.alt;
+    observer.az = legacy.az;
+    observer.smallest_magnitude = legacy.smallest_magnitude;
+    observer.latitude = legacy.latitude;
+    observer.longitude = legacy.longitude;
+    observer.year = legacy.year;
+    observer.month = legacy.month;
+    observer.day = legacy.day;
+    observer.hour = legacy.hour;
+    observer.min = legacy.min;
+    observer.sec = legacy.sec;
+    observer.julian_date = 0.0; //use the calendar fields
+    save_observer(observer);
+  }
+  EEPROM.end();
 }
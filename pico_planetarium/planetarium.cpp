@@ -1,15 +1,17 @@
 #include <cmath>
 #include <cstdio>
 #include "planetarium.h"
+#include "fast_trig.h"
+#include "chebyshev_ephemeris.h"
 #include "stars.h"
+#include "star_catalog.h"
 #include "star_names.h"
 #include "constellations.h"
 #include "clines.h"
+#include "catalog_blob.h"
 #include "objects.h"
-#include "skyline.h"
 #include "font_8x5.h"
 #include "font_16x12.h"
-#include "images.h"
 
 const char * const planet_names[]={"Mercury","Venus","Earth","Mars","Jupiter","Saturn","Uranus","Neptune","Pluto","Sun"};
 
@@ -19,14 +21,20 @@ void c_planetarium :: update(s_observer o, s_settings s)
   settings = s;
   local_sidereal_time();
   frame_buffer.clear(frame_buffer.colour565(5, 0, 50));
-
-  //calculate constants related to observer view
-  sin_lat = sin(to_radians(observer.latitude));
-  cos_lat = cos(to_radians(observer.latitude));
-  view_scale = 1.0f/(2.0f*sin(to_radians(observer.field/2.0f)));
-  const float theta = -(90-observer.alt);
-  sin_theta = sin(to_radians(theta));
-  cos_theta = cos(to_radians(theta));
+  labels.clear();
+
+  //constants related to the observer's view only change when they move,
+  //a time-only update just turns the sky under the cached pose
+  const bool pose_changed = !pose_valid || observer.latitude != pose_latitude || observer.alt != pose_alt || observer.az != pose_az;
+  const bool field_changed = !pose_valid || observer.field != pose_field;
+  if(pose_changed) build_pose_matrix();
+  if(field_changed)
+  {
+    view_scale = 1.0f/(2.0f*fast_sind(observer.field/2.0f));
+    calculate_view_cone();
+    pose_field = observer.field;
+  }
+  pose_valid = true;
   build_rotation_matrix();
 
   //plot_milky_way(); //155ms 
@@ -35,15 +43,17 @@ void c_planetarium :: update(s_observer o, s_settings s)
   plot_planes(); //4ms 
   if(settings.constellation_lines) plot_constellations(); //8ms 
   plot_stars(); //25ms 
+  if(settings.planets || settings.moon) update_ephemeris();
   if(settings.planets) plot_planets(); //3ms
   if(settings.moon) plot_moon(); //2ms 
   if(settings.constellation_names) plot_constellation_names(); //5ms
   if(settings.deep_sky_objects) plot_objects();
   if(settings.star_names) plot_star_names();
+  labels.draw(font_8x5);
 
   //obscure the area bellow the horizon
-  uint16_t view_major_radius = height/(2*sin(to_radians(observer.field/2)));
-  uint16_t view_minor_radius = view_major_radius * sin(to_radians(observer.alt));
+  uint16_t view_major_radius = height/(2*fast_sind(observer.field/2));
+  uint16_t view_minor_radius = view_major_radius * fast_sind(observer.alt);
   const int a = view_major_radius;
   const int b = view_minor_radius;
 
@@ -62,6 +72,8 @@ void c_planetarium :: update(s_observer o, s_settings s)
 
   //90ms
   /*
+  static uint16_t skyline[480*480];
+  c_image_decoder(catalog_blob.image("skyline")).decode(skyline, 480*480);
   int min_y = observer.alt>89.0f?-height/2:0;
   for (int y = min_y; y <= height/2; y++) {
     for (int x = -width/2; x < width/2; x++) {
@@ -97,14 +109,14 @@ void inline c_planetarium :: ra_dec_to_alt_az(float ra, float dec, float &alt, f
     if(H<0.0f) H+=360.0f;
     if(H>180.0f) H=H-360.0f;
     
-    const float sin_H = sin(to_radians(H));
-    const float cos_H = cos(to_radians(H));
-    const float tan_dec = tan(to_radians(dec));
-    const float sin_dec = sin(to_radians(dec));
-    const float cos_dec = cos(to_radians(dec));
-
-    az = to_degrees(atan2(sin_H, cos_H*sin_lat - tan_dec*cos_lat));
-    alt = to_degrees(asin(sin_lat*sin_dec + cos_lat*cos_dec*cos_H));
+    const float sin_H = fast_sind(H);
+    const float cos_H = fast_cosd(H);
+    const float tan_dec = fast_tand(dec);
+    const float sin_dec = fast_sind(dec);
+    const float cos_dec = fast_cosd(dec);
+
+    az = fast_atan2d(sin_H, cos_H*sin_lat - tan_dec*cos_lat);
+    alt = fast_asind(sin_lat*sin_dec + cos_lat*cos_dec*cos_H);
     az-=180.0f;
     if(az<0.0f) az+=360.0f;
 }
@@ -112,10 +124,10 @@ void inline c_planetarium :: ra_dec_to_alt_az(float ra, float dec, float &alt, f
 void c_planetarium :: calculate_view_alt_az(float alt, float az, float &x, float &y, float &z)
 {
   //convert to x, y, z
-  const float sin_alt = sin(to_radians(alt));
-  const float cos_alt = cos(to_radians(alt));
-  const float sin_az = sin(to_radians(180+az));
-  const float cos_az = cos(to_radians(180+az));
+  const float sin_alt = fast_sind(alt);
+  const float cos_alt = fast_cosd(alt);
+  const float sin_az = fast_sind(180+az);
+  const float cos_az = fast_cosd(180+az);
   x = cos_alt*-sin_az;
   y = cos_alt*cos_az;
   z = sin_alt;
@@ -152,14 +164,27 @@ void c_planetarium :: calculate_view_horizontal_x_y_z(float &x, float &y, float
 
 }
 
+void c_planetarium :: calculate_view_of_date_x_y_z(float &x, float &y, float &z)
+{
+
+  float new_x = date_rotation_matrix[0][0]*x+date_rotation_matrix[0][1]*y+date_rotation_matrix[0][2]*z;
+  float new_y = date_rotation_matrix[1][0]*x+date_rotation_matrix[1][1]*y+date_rotation_matrix[1][2]*z;
+  float new_z = date_rotation_matrix[2][0]*x+date_rotation_matrix[2][1]*y+date_rotation_matrix[2][2]*z;
+
+  x = new_x * view_scale;
+  y = new_y * view_scale; 
+  z = new_z * view_scale;
+
+}
+
 void inline c_planetarium :: calculate_view_ra_dec(float ra, float dec, float &x, float &y, float &z)
 {
 
   //convert to x, y, z
-  const float sin_dec = sin(to_radians(dec));
-  const float cos_dec = cos(to_radians(dec));
-  const float sin_ra = sin(to_radians(-ra));
-  const float cos_ra = cos(to_radians(-ra));
+  const float sin_dec = fast_sind(dec);
+  const float cos_dec = fast_cosd(dec);
+  const float sin_ra = fast_sind(-ra);
+  const float cos_ra = fast_cosd(-ra);
   x = cos_dec*-sin_ra;
   y = cos_dec*cos_ra;
   z = sin_dec;
@@ -168,17 +193,138 @@ void inline c_planetarium :: calculate_view_ra_dec(float ra, float dec, float &x
 
 }
 
+//screen coordinates are kept within a guard band so that very narrow
+//fields of view can't overflow the 16-bit coordinates used by the frame buffer
+static const float pixel_guard = 16000.0f;
+
 void c_planetarium :: calculate_pixel_coords(float &x, float &y)
 {
+  //a point outside the band is off screen wherever it is clamped to
   x = round((width-height)/2 + (height * (x+0.5f)));
   y = round(height * (1.0f-(y + 0.5f)));
+  x = std::min(std::max(x, -pixel_guard), pixel_guard);
+  y = std::min(std::max(y, -pixel_guard), pixel_guard);
+}
+
+//Liang-Barsky clip of a line to the guard band. The ends are moved along
+//the line rather than clamped, so the part that is kept has the same angle.
+//Returns false if none of the line is inside.
+static bool clip_to_guard_band(float &x1, float &y1, float &x2, float &y2)
+{
+  const float dx = x2 - x1, dy = y2 - y1;
+  const float p[4] = {-dx, dx, -dy, dy};
+  const float q[4] = {x1 + pixel_guard, pixel_guard - x1, y1 + pixel_guard, pixel_guard - y1};
+  float t1 = 0.0f, t2 = 1.0f;
+  for(uint8_t edge = 0; edge < 4; ++edge)
+  {
+    if(p[edge] == 0.0f)
+    {
+      //parallel to this edge, and outside it
+      if(q[edge] < 0.0f) return false;
+      continue;
+    }
+    const float t = q[edge]/p[edge];
+    if(p[edge] < 0.0f) t1 = std::max(t1, t);
+    else t2 = std::min(t2, t);
+    if(t1 > t2) return false;
+  }
+  x2 = x1 + t2*dx;
+  y2 = y1 + t2*dy;
+  x1 += t1*dx;
+  y1 += t1*dy;
+  return true;
+}
+
+void c_planetarium :: calculate_view_cone()
+{
+  //The projection is orthographic, so a point at angle a from the centre
+  //of view lands sin(a)/view_scale screen heights from the centre. Find the
+  //angle of the cone that just encloses the corners of the screen (plus a
+  //few pixels for star discs), anything outside it can be skipped with a
+  //single dot product before doing the full transform.
+  const float margin = 4.0f;
+  const float half_diagonal = 0.5f*sqrt((float)width*width + (float)height*height) + margin;
+  const float r = half_diagonal/(height*view_scale);
+
+  if(r >= 1.0f)
+  {
+    //the whole visible hemisphere is on screen
+    sin_view_cone = 1.0f;
+    cos_view_cone = 0.0f;
+  }
+  else
+  {
+    sin_view_cone = r;
+    cos_view_cone = sqrt(1.0f - r*r);
+  }
+}
+
+bool inline c_planetarium :: in_view_cone(float x, float y, float z)
+{
+  //the third row of the rotation matrix is the view axis in equatorial coordinates
+  const float cos_angle = rotation_matrix[2][0]*x+rotation_matrix[2][1]*y+rotation_matrix[2][2]*z;
+  return cos_angle >= cos_view_cone;
+}
+
+bool inline c_planetarium :: in_view_cone(float x, float y, float z, float cos_half, float sin_half)
+{
+  //an object with angular radius h can be seen if its centre is within
+  //the view cone + h, cos(view + h) = cos(view)cos(h) - sin(view)sin(h)
+  const float cos_angle = rotation_matrix[2][0]*x+rotation_matrix[2][1]*y+rotation_matrix[2][2]*z;
+  return cos_angle >= cos_view_cone*cos_half - sin_view_cone*sin_half;
+}
+
+void c_planetarium :: plot_segment(float x1, float y1, float z1, float x2, float y2, float z2, uint16_t colour, uint16_t alpha)
+{
+  //Clip a line in view coordinates against the plane z=near, so that
+  //lines passing behind the observer are shortened rather than dropped.
+  const float near = 0.001f*view_scale;
+
+  //the whole line is behind the observer
+  if(z1 < near && z2 < near) return;
+
+  if(z1 < near)
+  {
+    const float t = (near - z1)/(z2 - z1);
+    x1 += t*(x2 - x1);
+    y1 += t*(y2 - y1);
+  }
+  else if(z2 < near)
+  {
+    const float t = (near - z2)/(z1 - z2);
+    x2 += t*(x1 - x2);
+    y2 += t*(y1 - y2);
+  }
+
+  x1 = (width-height)/2 + (height * (x1+0.5f));
+  y1 = height * (1.0f-(y1 + 0.5f));
+  x2 = (width-height)/2 + (height * (x2+0.5f));
+  y2 = height * (1.0f-(y2 + 0.5f));
+  if(!clip_to_guard_band(x1, y1, x2, y2)) return;
+  x1 = round(x1);
+  y1 = round(y1);
+  x2 = round(x2);
+  y2 = round(y2);
+
+  if(settings.antialiased_lines)
+  {
+    frame_buffer.draw_line_antialiased(x1, y1, x2, y2, colour, alpha);
+  }
+  else
+  {
+    frame_buffer.draw_line(x1, y1, x2, y2, colour, alpha);
+  }
 }
 
 void c_planetarium :: plot_constellations()
 {
   uint16_t colour = frame_buffer.colour565(68, 123, 127);
-  for(uint16_t idx=0; idx < num_clines; ++idx)
+  uint32_t num_clines;
+  const s_cline *clines = catalog_blob.section<s_cline>("CLIN", num_clines);
+  for(uint32_t idx=0; idx < num_clines; ++idx)
   {
+    if(!in_view_cone(clines[idx].mx, clines[idx].my, clines[idx].mz, clines[idx].cos_half, clines[idx].sin_half)) continue;
+
     float x1 = clines[idx].x1;
     float y1 = clines[idx].y1;
     float z1 = clines[idx].z1;
@@ -190,354 +336,174 @@ void c_planetarium :: plot_constellations()
     float z2 = clines[idx].z2;
     calculate_view_equatorial_x_y_z(x2, y2, z2);
 
-    if(z1 < 0.0f || z2 < 0.0f) continue;
-    calculate_pixel_coords(x1, y1);
-    calculate_pixel_coords(x2, y2);
-    frame_buffer.draw_line(x1, y1, x2, y2, colour, 200); 
+    plot_segment(x1, y1, z1, x2, y2, z2, colour, 200);
 
   }
 }
 
-void c_planetarium :: plot_plane(float pole_alt, float pole_az, uint16_t colour)
+void c_planetarium :: plot_circle(bool equatorial, const float centre[3], const float u[3], const float v[3], uint16_t colour)
 {
-  float plane_elevation = 90-pole_alt; //maximum height of plane above horizon
-  float plane_direction = pole_az+180; //azimuth direction of highest point
-
-  uint16_t az1 = 0;
-  float x1, y1, z1;
-  float alt = to_degrees(atan(cos(to_radians(az1-plane_direction))*sin(to_radians(plane_elevation))));
-  calculate_view_alt_az(alt, az1, x1, y1, z1);
-  calculate_pixel_coords(x1, y1);
-
-  for(uint16_t az=1; az <= 360; az += 1)
+  //Points on the circle are centre + u.cos(phi) + v.sin(phi). The view
+  //transform is linear, so only the three vectors need to be transformed,
+  //and cos(phi)/sin(phi) are stepped with a rotation rather than trig calls.
+  //The circle is walked in coarse steps, and only the steps that can reach
+  //the screen are split finely enough to follow it.
+  const uint8_t steps = 72;
+  float c[3] = {centre[0], centre[1], centre[2]};
+  float uu[3] = {u[0], u[1], u[2]};
+  float vv[3] = {v[0], v[1], v[2]};
+  if(equatorial)
   {
-    float x2, y2, z2;
-    float alt = to_degrees(atan(cos(to_radians(az-plane_direction))*tan(to_radians(plane_elevation))));
+    //grids and planes follow the equator and equinox of date
+    calculate_view_of_date_x_y_z(c[0], c[1], c[2]);
+    calculate_view_of_date_x_y_z(uu[0], uu[1], uu[2]);
+    calculate_view_of_date_x_y_z(vv[0], vv[1], vv[2]);
+  }
+  else
+  {
+    calculate_view_horizontal_x_y_z(c[0], c[1], c[2]);
+    calculate_view_horizontal_x_y_z(uu[0], uu[1], uu[2]);
+    calculate_view_horizontal_x_y_z(vv[0], vv[1], vv[2]);
+  }
 
-    calculate_view_alt_az(alt, az, x2, y2, z2);
-    calculate_pixel_coords(x2, y2);
-    
-    //don't bother plotting line outside field of observer
-    bool draw = (z1 >= 0.0f) && (z2 >= 0.0f);
-    
-    //draw line between 2 points
-    if(draw) frame_buffer.draw_line(x1, y1, x2, y2, colour);
+  //A chord of angle a on a circle of radius r falls short of the arc by
+  //r(1-cos(a/2)), about r.a^2/8. The view vectors include view_scale, so r
+  //is in screen heights, pick the number of pieces for each coarse step
+  //that keeps the gap under half a pixel.
+  const float step_angle = 2.0f*(float)M_PI/steps;
+  const float radius = sqrt(uu[0]*uu[0] + uu[1]*uu[1] + uu[2]*uu[2]);
+  const float max_angle = sqrt(4.0f/(height*radius));
+  const uint8_t pieces = std::min(255.0f, std::max(1.0f, ceilf(step_angle/max_angle)));
+  const float bow = radius*(1.0f - fast_cosd(180.0f/steps));
+  const float half_width = 0.5f*width/height + bow;
+  const float half_height = 0.5f + bow;
+
+  const float cos_step = fast_cosd(360.0f/steps);
+  const float sin_step = fast_sind(360.0f/steps);
+  const float cos_piece = fast_cosd(360.0f/steps/pieces);
+  const float sin_piece = fast_sind(360.0f/steps/pieces);
+  float cos_phi = 1.0f, sin_phi = 0.0f;
+  float x1 = c[0] + uu[0], y1 = c[1] + uu[1], z1 = c[2] + uu[2];
+
+  for(uint8_t step = 1; step <= steps; ++step)
+  {
+    const float new_cos_phi = cos_phi*cos_step - sin_phi*sin_step;
+    const float new_sin_phi = sin_phi*cos_step + cos_phi*sin_step;
+
+    const float x2 = c[0] + uu[0]*new_cos_phi + vv[0]*new_sin_phi;
+    const float y2 = c[1] + uu[1]*new_cos_phi + vv[1]*new_sin_phi;
+    const float z2 = c[2] + uu[2]*new_cos_phi + vv[2]*new_sin_phi;
+
+    //the arc stays within bow of the chord, so if that box misses the screen
+    //(or the step is already fine enough) the chord will do
+    const bool visible =
+      std::max(x1, x2) >= -half_width && std::min(x1, x2) <= half_width &&
+      std::max(y1, y2) >= -half_height && std::min(y1, y2) <= half_height;
+    if(pieces == 1 || !visible)
+    {
+      plot_segment(x1, y1, z1, x2, y2, z2, colour);
+    }
+    else
+    {
+      float cos_p = cos_phi, sin_p = sin_phi;
+      float px1 = x1, py1 = y1, pz1 = z1;
+      for(uint8_t piece = 1; piece <= pieces; ++piece)
+      {
+        float px2 = x2, py2 = y2, pz2 = z2;
+        if(piece < pieces)
+        {
+          const float new_cos_p = cos_p*cos_piece - sin_p*sin_piece;
+          sin_p = sin_p*cos_piece + cos_p*sin_piece;
+          cos_p = new_cos_p;
+          px2 = c[0] + uu[0]*cos_p + vv[0]*sin_p;
+          py2 = c[1] + uu[1]*cos_p + vv[1]*sin_p;
+          pz2 = c[2] + uu[2]*cos_p + vv[2]*sin_p;
+        }
+        plot_segment(px1, py1, pz1, px2, py2, pz2, colour);
+        px1 = px2;
+        py1 = py2;
+        pz1 = pz2;
+      }
+    }
 
+    cos_phi = new_cos_phi;
+    sin_phi = new_sin_phi;
     x1 = x2;
     y1 = y2;
     z1 = z2;
-    az1 = az;
-
   }
+}
 
+void c_planetarium :: plot_plane(float pole_ra, float pole_dec, uint16_t colour)
+{
+  //plot the great circle perpendicular to a pole given in equatorial coordinates
+  const float cos_dec = fast_cosd(pole_dec);
+  const float pole[3] = {
+    cos_dec*fast_sind(pole_ra), 
+    cos_dec*fast_cosd(pole_ra), 
+    fast_sind(pole_dec)
+  };
+
+  //u is perpendicular to both the pole and the z axis, v completes the set
+  float u[3] = {1.0f, 0.0f, 0.0f};
+  const float r = sqrt(pole[0]*pole[0] + pole[1]*pole[1]);
+  if(r > 1.0e-6f)
+  {
+    u[0] = pole[1]/r;
+    u[1] = -pole[0]/r;
+    u[2] = 0.0f;
+  }
+  const float v[3] = {
+    pole[1]*u[2] - pole[2]*u[1],
+    pole[2]*u[0] - pole[0]*u[2],
+    pole[0]*u[1] - pole[1]*u[0]
+  };
+  const float centre[3] = {0.0f, 0.0f, 0.0f};
+  plot_circle(true, centre, u, v, colour);
 }
 
 void c_planetarium :: plot_ra_dec_grid(uint16_t colour)
 {
-
-  //plot lines of conastant declination
+  //plot lines of constant declination
   for(int dec = -80; dec<90; dec+=10)
   {
-    float r = cos(to_radians(dec));
-    float z = sin(to_radians(dec));
-    float x, y;
-    float x_octants[8], y_octants[8], z_octants[8];
-    float last_x_octants[8], last_y_octants[8], last_z_octants[8];
-    bool first_iteration = true;
-    
-    for(x=0.0f; x<1.0f; x+=0.177*r)
-    {
-      y = sqrt((r*r)-(x*x));
-      if(std::isnan(y)) y=0.0f;
-
-      x_octants[0] = x;
-      x_octants[1] = x;
-      x_octants[2] = -x;
-      x_octants[3] = -x;
-      x_octants[4] = y;
-      x_octants[5] = y;
-      x_octants[6] = -y;
-      x_octants[7] = -y;
-
-      y_octants[0] = y;
-      y_octants[1] = -y;
-      y_octants[2] = y;
-      y_octants[3] = -y;
-      y_octants[4] = x;
-      y_octants[5] = -x;
-      y_octants[6] = x;
-      y_octants[7] = -x;
-
-      z_octants[0] = z;
-      z_octants[1] = z;
-      z_octants[2] = z;
-      z_octants[3] = z;
-      z_octants[4] = z;
-      z_octants[5] = z;
-      z_octants[6] = z;
-      z_octants[7] = z;
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        calculate_view_equatorial_x_y_z(x_octants[octant], y_octants[octant], z_octants[octant]);
-        calculate_pixel_coords(x_octants[octant], y_octants[octant]);
-      }
-
-      if(first_iteration)
-      {
-        first_iteration = false;
-      }
-      else
-      {
-        for(uint8_t octant = 0; octant<8; octant++)
-        {
-          if(last_z_octants[octant] > 0.0f && z_octants[octant] > 0.0f)
-          {
-            frame_buffer.draw_line(last_x_octants[octant], last_y_octants[octant], x_octants[octant], y_octants[octant], colour);
-          }
-        }
-      }
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        last_x_octants[octant] = x_octants[octant];
-        last_y_octants[octant] = y_octants[octant];
-        last_z_octants[octant] = z_octants[octant];
-      }
-
-      if(x > y) break;
-    }
+    const float r = fast_cosd(dec);
+    const float centre[3] = {0.0f, 0.0f, fast_sind(dec)};
+    const float u[3] = {r, 0.0f, 0.0f};
+    const float v[3] = {0.0f, r, 0.0f};
+    plot_circle(true, centre, u, v, colour);
   }
 
-  //plot lines of conastant right ascension
+  //plot lines of constant right ascension, each circle covers ra and ra+180
   for(int ra = 0; ra<=170; ra+=10)
   {
-    float sin_ra = sin(to_radians(ra));
-    float cos_ra = cos(to_radians(ra));
-    float y, z;
-    float x_octants[8], y_octants[8], z_octants[8];
-    float last_x_octants[8], last_y_octants[8], last_z_octants[8];
-    bool first_iteration = true;
-    for(y=0.0f; y<1.0f; y+=0.177)
-    {
-      z = sqrt(1.0f-(y*y));
-
-      x_octants[0] = 0;
-      x_octants[1] = 0;
-      x_octants[2] = 0;
-      x_octants[3] = 0;
-      x_octants[4] = 0;
-      x_octants[5] = 0;
-      x_octants[6] = 0;
-      x_octants[7] = 0;
-
-      y_octants[0] = y;
-      y_octants[1] = -y;
-      y_octants[2] = y;
-      y_octants[3] = -y;
-      y_octants[4] = z;
-      y_octants[5] = -z;
-      y_octants[6] = z;
-      y_octants[7] = -z;
-
-      z_octants[0] = z;
-      z_octants[1] = z;
-      z_octants[2] = -z;
-      z_octants[3] = -z;
-      z_octants[4] = y;
-      z_octants[5] = y;
-      z_octants[6] = -y;
-      z_octants[7] = -y;
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        float temp_y = y_octants[octant]*cos_ra;
-        float temp_x = y_octants[octant]*sin_ra;
-        y_octants[octant] = temp_y;
-        x_octants[octant] = temp_x;
-        calculate_view_equatorial_x_y_z(x_octants[octant], y_octants[octant], z_octants[octant]);
-        calculate_pixel_coords(x_octants[octant], y_octants[octant]);
-      }
-
-      if(first_iteration)
-      {
-        first_iteration = false;
-      }
-      else
-      {
-        for(uint8_t octant = 0; octant<8; octant++)
-        {
-          if(last_z_octants[octant] > 0.0f && z_octants[octant] > 0.0f)
-          {
-            frame_buffer.draw_line(last_x_octants[octant], last_y_octants[octant], x_octants[octant], y_octants[octant], colour);
-          }
-        }
-      }
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        last_x_octants[octant] = x_octants[octant];
-        last_y_octants[octant] = y_octants[octant];
-        last_z_octants[octant] = z_octants[octant];
-      }
-
-      if(y > z) break;
-    }
+    const float centre[3] = {0.0f, 0.0f, 0.0f};
+    const float u[3] = {fast_sind(ra), fast_cosd(ra), 0.0f};
+    const float v[3] = {0.0f, 0.0f, 1.0f};
+    plot_circle(true, centre, u, v, colour);
   }
 }
 
 void c_planetarium :: plot_alt_az_grid(uint16_t colour)
 {
-  //plot lines of conastant right declination
+  //plot lines of constant altitude
   for(int alt = -80; alt<90; alt+=10)
   {
-    float r = cos(to_radians(alt));
-    float z = sin(to_radians(alt));
-    float x, y;
-    float x_octants[8], y_octants[8], z_octants[8];
-    float last_x_octants[8], last_y_octants[8], last_z_octants[8];
-    bool first_iteration = true;
-    
-    for(x=0.0f; x<1.0f; x+=0.177*r)
-    {
-      y = sqrt((r*r)-(x*x));
-      if(std::isnan(y)) y=0.0f;
-
-      x_octants[0] = x;
-      x_octants[1] = x;
-      x_octants[2] = -x;
-      x_octants[3] = -x;
-      x_octants[4] = y;
-      x_octants[5] = y;
-      x_octants[6] = -y;
-      x_octants[7] = -y;
-
-      y_octants[0] = y;
-      y_octants[1] = -y;
-      y_octants[2] = y;
-      y_octants[3] = -y;
-      y_octants[4] = x;
-      y_octants[5] = -x;
-      y_octants[6] = x;
-      y_octants[7] = -x;
-
-      z_octants[0] = z;
-      z_octants[1] = z;
-      z_octants[2] = z;
-      z_octants[3] = z;
-      z_octants[4] = z;
-      z_octants[5] = z;
-      z_octants[6] = z;
-      z_octants[7] = z;
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        calculate_view_horizontal_x_y_z(x_octants[octant], y_octants[octant], z_octants[octant]);
-        calculate_pixel_coords(x_octants[octant], y_octants[octant]);
-      }
-
-      if(first_iteration)
-      {
-        first_iteration = false;
-      }
-      else
-      {
-        for(uint8_t octant = 0; octant<8; octant++)
-        {
-          if(last_z_octants[octant] > 0.0f && z_octants[octant] > 0.0f)
-          {
-            frame_buffer.draw_line(last_x_octants[octant], last_y_octants[octant], x_octants[octant], y_octants[octant], colour);
-          }
-        }
-      }
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        last_x_octants[octant] = x_octants[octant];
-        last_y_octants[octant] = y_octants[octant];
-        last_z_octants[octant] = z_octants[octant];
-      }
-
-      if(x > y) break;
-    }
+    const float r = fast_cosd(alt);
+    const float centre[3] = {0.0f, 0.0f, fast_sind(alt)};
+    const float u[3] = {r, 0.0f, 0.0f};
+    const float v[3] = {0.0f, r, 0.0f};
+    plot_circle(false, centre, u, v, colour);
   }
 
-  //plot lines of conastant right ascension
-  for(int dec = 0; dec<=170; dec+=10)
+  //plot lines of constant azimuth, each circle covers az and az+180
+  for(int az = 0; az<=170; az+=10)
   {
-    float sin_ra = sin(to_radians(dec));
-    float cos_ra = cos(to_radians(dec));
-    float y, z;
-    float x_octants[8], y_octants[8], z_octants[8];
-    float last_x_octants[8], last_y_octants[8], last_z_octants[8];
-    bool first_iteration = true;
-    for(y=0.0f; y<1.0f; y+=0.177)
-    {
-      z = sqrt(1.0f-(y*y));
-
-      x_octants[0] = 0;
-      x_octants[1] = 0;
-      x_octants[2] = 0;
-      x_octants[3] = 0;
-      x_octants[4] = 0;
-      x_octants[5] = 0;
-      x_octants[6] = 0;
-      x_octants[7] = 0;
-
-      y_octants[0] = y;
-      y_octants[1] = -y;
-      y_octants[2] = y;
-      y_octants[3] = -y;
-      y_octants[4] = z;
-      y_octants[5] = -z;
-      y_octants[6] = z;
-      y_octants[7] = -z;
-
-      z_octants[0] = z;
-      z_octants[1] = z;
-      z_octants[2] = -z;
-      z_octants[3] = -z;
-      z_octants[4] = y;
-      z_octants[5] = y;
-      z_octants[6] = -y;
-      z_octants[7] = -y;
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        float temp_y = y_octants[octant]*cos_ra;
-        float temp_x = y_octants[octant]*sin_ra;
-        y_octants[octant] = temp_y;
-        x_octants[octant] = temp_x;
-        calculate_view_horizontal_x_y_z(x_octants[octant], y_octants[octant], z_octants[octant]);
-        calculate_pixel_coords(x_octants[octant], y_octants[octant]);
-      }
-
-      if(first_iteration)
-      {
-        first_iteration = false;
-      }
-      else
-      {
-        for(uint8_t octant = 0; octant<8; octant++)
-        {
-          if(last_z_octants[octant] > 0.0f && z_octants[octant] > 0.0f)
-          {
-            frame_buffer.draw_line(last_x_octants[octant], last_y_octants[octant], x_octants[octant], y_octants[octant], colour);
-          }
-        }
-      }
-
-      for(uint8_t octant = 0; octant<8; octant++)
-      {
-        last_x_octants[octant] = x_octants[octant];
-        last_y_octants[octant] = y_octants[octant];
-        last_z_octants[octant] = z_octants[octant];
-      }
-
-      if(y > z) break;
-    }
+    const float centre[3] = {0.0f, 0.0f, 0.0f};
+    const float u[3] = {fast_sind(az), fast_cosd(az), 0.0f};
+    const float v[3] = {0.0f, 0.0f, 1.0f};
+    plot_circle(false, centre, u, v, colour);
   }
-  
 }
 
 void c_planetarium :: plot_planes()
@@ -545,19 +511,15 @@ void c_planetarium :: plot_planes()
   if(settings.celestial_equator)
   {
     //plot celestial equator
-    float az, alt;
-    ra_dec_to_alt_az(90, 90, alt, az);
-    plot_plane(observer.latitude, 0, frame_buffer.colour565(3, 50, 153));
+    plot_plane(0, 90, frame_buffer.colour565(3, 50, 153));
   }
 
   if(settings.ecliptic)
   {
     //plot ecliptic
-    float az, alt;
     const float orbital_noth_pole_dec = 66.56;
     const float orbital_noth_pole_ra = 270;
-    ra_dec_to_alt_az(orbital_noth_pole_ra, orbital_noth_pole_dec, alt, az);
-    plot_plane(alt, az, frame_buffer.colour565(135, 0, 57));
+    plot_plane(orbital_noth_pole_ra, orbital_noth_pole_dec, frame_buffer.colour565(135, 0, 57));
   }
 
 }
@@ -618,7 +580,7 @@ void c_planetarium :: plot_milky_way()
   {
 
     float x, y, z;
-    float alt = to_degrees(atan(cos(to_radians(az-plane_direction))*tan(to_radians(plane_elevation))));
+    float alt = fast_atand(fast_cosd(az-plane_direction)*fast_tand(plane_elevation));
 
     calculate_view_alt_az(alt, az, x, y, z);
     calculate_pixel_coords(x, y);
@@ -639,64 +601,140 @@ void c_planetarium :: plot_milky_way()
 
 }
 
-void c_planetarium :: plot_stars()
+void c_planetarium :: plot_star(float x, float y, float z, float magnitude, uint8_t mk)
 {
+  calculate_view_equatorial_x_y_z(x, y, z);
+  calculate_pixel_coords(x, y);
 
-  for(uint16_t idx=0; idx < num_stars; ++idx)
-  {
-
-    if(stars[idx].mag > observer.smallest_magnitude) continue;
+  //don't bother plotting stars outside field of observer
+  if(x>width) return;
+  if(y>height) return;
+  if(x<0) return;
+  if(y<0) return;
+  if(z<0) return;
 
-    float x, y, z;
-    x = stars[idx].x; y = stars[idx].y; z = stars[idx].z;
-    calculate_view_equatorial_x_y_z(x, y, z);
-    calculate_pixel_coords(x, y);
+  int8_t mag = magnitude;
 
-    //don't bother plotting stars outside field of observer
-    if(x>width) continue;
-    if(y>height) continue;
-    if(x<0) continue;
-    if(y<0) continue;
-    if(z<0) continue;
+  if(mag <= 1)
+  {
+    frame_buffer.fill_circle(x, y, 3, star_colour(mk));
+  }
+  else if(mag <= 2)
+  {
+    frame_buffer.fill_circle(x, y, 2, star_colour(mk));
+  }
+  else if(mag <= 3)
+  {
+    frame_buffer.fill_circle(x, y, 1, star_colour(mk));
+  }
+  else
+  {
+    frame_buffer.set_pixel(x, y, star_colour(mk), (256 >> (mag-3)));
+  }
+}
 
+void c_planetarium :: plot_catalog_stars()
+{
+  //give every tile that overlaps the view a place in the cache
+  uint16_t tiles_in_view = 0;
+  for(uint16_t tile=0; tile < star_catalog->num_tiles(); ++tile)
+  {
+    const s_catalog_tile &t = star_catalog->tile(tile);
+    if(in_view_cone(t.x, t.y, t.z, t.cos_half, t.sin_half)) ++tiles_in_view;
+  }
+  star_catalog->reserve(tiles_in_view);
 
-    int8_t mag = stars[idx].mag;
-    uint8_t mk = stars[idx].mk;
+  //only read tiles that overlap the view, stars are sorted brightest
+  //first so each tile can stop at the limiting magnitude
+  for(uint16_t tile=0; tile < star_catalog->num_tiles(); ++tile)
+  {
+    const s_catalog_tile &t = star_catalog->tile(tile);
+    if(!in_view_cone(t.x, t.y, t.z, t.cos_half, t.sin_half)) continue;
 
-    if(mag <= 1)
-    {
-      frame_buffer.fill_circle(x, y, 3, star_colour(mk));
-    }
-    else if(mag <= 2)
+    uint32_t first = 0, count;
+    bool faintest = false;
+    while(!faintest)
     {
-      frame_buffer.fill_circle(x, y, 2, star_colour(mk));
-    }
-    else if(mag <= 3)
-    {
-      frame_buffer.fill_circle(x, y, 1, star_colour(mk));
+      const s_catalog_star *catalog_stars = star_catalog->read_tile(tile, first, count);
+      if(!catalog_stars) break;
+      for(uint32_t idx=0; idx < count; ++idx)
+      {
+        const s_catalog_star &star = catalog_stars[idx];
+        const float magnitude = c_star_catalog::magnitude(star);
+        if(magnitude > observer.smallest_magnitude)
+        {
+          faintest = true;
+          break;
+        }
+
+        const float x = star.x*(1.0f/32767.0f);
+        const float y = star.y*(1.0f/32767.0f);
+        const float z = star.z*(1.0f/32767.0f);
+        if(!in_view_cone(x, y, z)) continue;
+        plot_star(x, y, z, magnitude, star.mk);
+      }
+      first += count;
     }
-    else
+  }
+}
+
+void c_planetarium :: plot_stars()
+{
+  //an external catalog replaces the built in one
+  if(star_catalog && star_catalog->is_open())
+  {
+    plot_catalog_stars();
+    return;
+  }
+
+  uint32_t num_stars, num_proper_motions;
+  const s_star *stars = catalog_blob.section<s_star>("STAR", num_stars);
+  const s_proper_motion *proper_motions = catalog_blob.section<s_proper_motion>("PMOT", num_proper_motions);
+
+  //proper motions are sorted by star, so walk them alongside the catalog
+  const s_proper_motion *motion = proper_motions;
+  const s_proper_motion *last_motion = proper_motions + (settings.proper_motion?num_proper_motions:0);
+
+  for(uint32_t idx=0; idx < num_stars; ++idx)
+  {
+
+    float x, y, z;
+    x = stars[idx].x; y = stars[idx].y; z = stars[idx].z;
+    if(motion != last_motion && motion->star == idx)
     {
-      frame_buffer.set_pixel(x, y, star_colour(mk), (256 >> (mag-3)));
+      x += motion->dx*proper_motion_scale;
+      y += motion->dy*proper_motion_scale;
+      z += motion->dz*proper_motion_scale;
+      ++motion;
     }
+
+    if(stars[idx].mag > observer.smallest_magnitude) continue;
+    if(!in_view_cone(x, y, z)) continue;
+    plot_star(x, y, z, stars[idx].mag, stars[idx].mk);
   }
 }
 
+void c_planetarium :: calculate_view_direction(float dx, float dy, float dz, float &x, float &y, float &z)
+{
+  //equatorial vector to the unit vector used by the star catalog (x and y swapped)
+  const float inv_r = 1.0f/sqrtf(dx*dx + dy*dy + dz*dz);
+  x = dy*inv_r;
+  y = dx*inv_r;
+  z = dz*inv_r;
+  calculate_view_equatorial_x_y_z(x, y, z);
+}
+
 void c_planetarium :: plot_planets()
 {
-  double earth_x, earth_y, earth_z;
-  compute_planet_position(julian_date, elements[2], rates[2], extra_terms[2], earth_x, earth_y, earth_z);
+  const float *earth = ephemeris.planets[2];
 
   for(uint16_t idx=0; idx < 8; ++idx)
   {
     if(idx == 2) continue;
 
-    double planet_x, planet_y, planet_z;
-    compute_planet_position(julian_date, elements[idx], rates[idx], extra_terms[idx], planet_x, planet_y, planet_z);
-    double ra, dec;
-    convert_to_ra_dec(planet_x-earth_x, planet_y-earth_y, planet_z-earth_z, ra, dec);
+    const float *planet = ephemeris.planets[idx];
     float x, y, z;
-    calculate_view_ra_dec(ra, dec, x, y, z);
+    calculate_view_direction(planet[0]-earth[0], planet[1]-earth[1], planet[2]-earth[2], x, y, z);
 
     //don't bother plotting stars outside field of observer
     if(z < 0.0f) continue;
@@ -707,27 +745,25 @@ void c_planetarium :: plot_planets()
 
     switch(idx)
     {
-      case 0: frame_buffer.draw_object(x, y, 4, (uint16_t*)mercury); break;
-      case 1: frame_buffer.draw_object(x, y, 4, (uint16_t*)venus); break;
-      case 3: frame_buffer.draw_object(x, y, 4, (uint16_t*)mars); break;
-      case 4: frame_buffer.draw_object(x, y, 6, (uint16_t*)jupiter); break;
+      case 0: frame_buffer.draw_object(x, y, 4, catalog_blob.image("mercury")); break;
+      case 1: frame_buffer.draw_object(x, y, 4, catalog_blob.image("venus")); break;
+      case 3: frame_buffer.draw_object(x, y, 4, catalog_blob.image("mars")); break;
+      case 4: frame_buffer.draw_object(x, y, 6, catalog_blob.image("jupiter")); break;
       case 5: 
-        frame_buffer.draw_object(x, y, 4, (uint16_t*)saturn); 
+        frame_buffer.draw_object(x, y, 4, catalog_blob.image("saturn")); 
         frame_buffer.draw_line(x-6, y-6, x+6, y+6, frame_buffer.colour565(0x49, 0x42, 0x3b));
         break;
-      case 6: frame_buffer.draw_object(x, y, 4, (uint16_t*)uranus); break;
-      case 7: frame_buffer.draw_object(x, y, 4, (uint16_t*)neptune); break;
+      case 6: frame_buffer.draw_object(x, y, 4, catalog_blob.image("uranus")); break;
+      case 7: frame_buffer.draw_object(x, y, 4, catalog_blob.image("neptune")); break;
     };
-    if(settings.planet_names) frame_buffer.draw_string(x+4, y-16, font_8x5, planet_names[idx], frame_buffer.colour565(223, 136, 247));
+    if(settings.planet_names) labels.add(x+4, y-16, planet_names[idx], frame_buffer.colour565(223, 136, 247), planet_label);
 
   }
 
   if(settings.sun)
   {
-    double ra, dec;
-    convert_to_ra_dec(-earth_x, -earth_y, -earth_z, ra, dec);
     float x, y, z;
-    calculate_view_ra_dec(ra, dec, x, y, z);
+    calculate_view_direction(-earth[0], -earth[1], -earth[2], x, y, z);
 
     //don't bother plotting stars outside field of observer
     if(z < 0.0f) return;
@@ -735,8 +771,8 @@ void c_planetarium :: plot_planets()
 
     //get coordinated and magnitude of x
     calculate_pixel_coords(x, y);
-    frame_buffer.draw_object(x, y, 10, (uint16_t*)sun);
-    if(settings.sun_name) frame_buffer.draw_string(x+4, y-16, font_8x5, "Sun", frame_buffer.colour565(223, 136, 247));
+    frame_buffer.draw_object(x, y, 10, catalog_blob.image("sun"));
+    if(settings.sun_name) labels.add(x+4, y-16, "Sun", frame_buffer.colour565(223, 136, 247), planet_label);
   }
 }
 
@@ -752,7 +788,7 @@ void c_planetarium :: plot_constellation_names()
 
     if(x > width || x < 0 || y > height || y < 0 || z < 0) continue;
 
-    frame_buffer.draw_string(x, y, font_8x5, constellation_names[idx], colour);
+    labels.add(x, y, constellation_names[idx], colour, constellation_label);
     
   }
 }
@@ -767,13 +803,14 @@ void c_planetarium :: plot_objects()
     float x = objects[idx].x;
     float y = objects[idx].y;
     float z = objects[idx].z;
+    if(!in_view_cone(x, y, z)) continue;
     calculate_view_equatorial_x_y_z(x, y, z);
     calculate_pixel_coords(x, y);
 
     if(x > width || x < 0 || y > height || y < 0 || z < 0) continue;
 
     frame_buffer.draw_circle(x, y, 2, colour);
-    if(settings.deep_sky_object_names) frame_buffer.draw_string(x, y, font_8x5, objects[idx].name, text_colour);
+    if(settings.deep_sky_object_names) labels.add(x, y, objects[idx].name, text_colour, object_label);
     
   }
 }
@@ -787,12 +824,13 @@ void c_planetarium :: plot_star_names()
     float x = star_names[idx].x;
     float y = star_names[idx].y;
     float z = star_names[idx].z;
+    if(!in_view_cone(x, y, z)) continue;
     calculate_view_equatorial_x_y_z(x, y, z);
     calculate_pixel_coords(x, y);
 
     if(x > width || x < 0 || y > height || y < 0 || z < 0) continue;
 
-    if(settings.star_names) frame_buffer.draw_string(x, y, font_8x5, star_names[idx].name, text_colour);
+    if(settings.star_names) labels.add(x, y, star_names[idx].name, text_colour, star_label);
     
   }
 }
@@ -801,20 +839,28 @@ float c_planetarium :: greenwich_sidereal_time()
 {
     //Calculate Greenwich Mean Sidereal Time (GMST) given a UTC datetime.
 
-    // Convert to Julian date
-    double ut = observer.hour + observer.min / 60.0f + observer.sec / 3600.0f;
-    
-    uint8_t month = observer.month;
-    uint16_t year = observer.year;
-    if(month <= 2)
+    if(observer.julian_date != 0.0)
     {
-        year -= 1;
-        month += 12;
+        //the caller already has a julian date
+        julian_date = observer.julian_date;
+    }
+    else
+    {
+        // Convert to Julian date
+        double ut = observer.hour + observer.min / 60.0 + observer.sec / 3600.0;
+        
+        uint8_t month = observer.month;
+        uint16_t year = observer.year;
+        if(month <= 2)
+        {
+            year -= 1;
+            month += 12;
+        }
+        
+        double a = floor(year / 100.0);
+        double b = 2.0 - a + floor(a / 4.0);
+        julian_date = floor(365.25 * (year + 4716.0)) + floor(30.6001 * (month + 1.0)) + observer.day + b - 1524.5 + ut / 24.0;
     }
-    
-    double a = floor(year / 100.0);
-    double b = 2.0 - a + floor(a / 4.0);
-    julian_date = floor(365.25 * (year + 4716.0)) + floor(30.6001 * (month + 1.0)) + observer.day + b - 1524.5 + ut / 24.0;
     
     // Julian centuries from J2000.0
     double centuries = (julian_date - 2451545.0) / 36525.0;
@@ -829,9 +875,11 @@ void c_planetarium :: local_sidereal_time()
 {
     //Calculate Local Sidereal Time (LST) for a given longitude.
     float gmst = greenwich_sidereal_time();
+    update_precession();
     
-    //Convert longitude to degrees (-180 to 180) to match convention
-    lst = fmod(gmst + observer.longitude, 360.0f);
+    //Convert longitude to degrees (-180 to 180) to match convention,
+    //nutation turns mean sidereal time into apparent sidereal time
+    lst = fmod(gmst + equation_of_equinoxes + observer.longitude + 360.0f, 360.0f);
     
 }
 
@@ -938,22 +986,6 @@ double c_planetarium :: solve_kepler(double M, double e, double E)
     return dE;
 }
 
-// Convert heliocentric coordinates to RA and Dec
-void c_planetarium :: convert_to_ra_dec(double x, double y, double z, double &ra, double &dec) 
-{
-    //Convert from Cartesian to polar coordinates 
-    const double r=sqrt(x*x+y*y+z*z);
-    ra=atan2(y,x);
-    dec=acos(z/r);
-
-    //Make sure RA is positive, and Dec is in range +/-90
-    if(ra<0){ra+=2*M_PI;}
-    dec=0.5*M_PI-dec;
-
-    ra = to_degrees(ra);
-    dec = to_degrees(dec);
-}
-
 //See https://www.celestialprogramming.com/planets_with_keplers_equation.html
 //https://ssd.jpl.nasa.gov/planets/approx_pos.html
 void c_planetarium :: compute_planet_position(double jd, s_keplarian elements, s_keplarian rates, s_extra_terms extra_terms, double &x, double &y, double&z){
@@ -981,7 +1013,7 @@ void c_planetarium :: compute_planet_position(double jd, s_keplarian elements, s
     double E=M+57.29578*e*sin(to_radians(M));
     double dE=1.0;
     uint8_t n=0;
-    while(abs(dE)>1e-7 && n<10)
+    while(fabs(dE)>1e-7 && n<10)
     {
         dE=solve_kepler(M,e,E);
         E+=dE;
@@ -1010,50 +1042,131 @@ void c_planetarium :: compute_planet_position(double jd, s_keplarian elements, s
 
 //code adapted from https://www.celestialprogramming.com/lowprecisionmoonposition.html
 //Low precision geocentric moon position (RA,DEC) from Astronomical Almanac page D22 (2017 ed)
-float c_planetarium :: sind(float r){return sin(to_radians(r));}
-float c_planetarium :: cosd(float r){return cos(to_radians(r));}
-void c_planetarium :: plot_moon()
+float c_planetarium :: sind(float r){return fast_sind(r);}
+float c_planetarium :: cosd(float r){return fast_cosd(r);}
+void c_planetarium :: compute_moon_position(double jd, float position[3])
 {
 
-	float T = (julian_date-2451545)/36525;
+	float T = (jd-2451545)/36525;
 	float L = 218.32 + 481267.881*T + 
     6.29*sind(135.0 + 477198.87*T) - 
     1.27*sind(259.3 - 413335.36*T) + 
     0.66*sind(235.7 + 890534.22*T) + 
     0.21*sind(269.9 + 954397.74*T) - 
     0.19*sind(357.5 + 35999.05*T) - 
-    0.11*sind(186.5 + 966404.03*T);
+    0.11*sind(186.5 + 966404.03*T) -
+    1.3969713*T; //ecliptic of date to J2000, precession is applied with the stars
 
 	float B = 5.13*sind( 93.3 + 483202.02*T) + 
     0.28*sind(228.2 + 960400.89*T) - 
     0.28*sind(318.3 + 6003.15*T) - 
     0.17*sind(217.6 - 407332.21*T);
 
-	float P = 0.9508 + 0.0518*cosd(135.0 + 477198.87*T) + 
-    0.0095*cosd(259.3 - 413335.36*T) + 
-    0.0078*cosd(235.7 + 890534.22*T) + 
-    0.0028*cosd(269.9 + 954397.74*T);
-
-	float SD=0.2724*P;
-	float r=1/sind(P);
-
-	float l = cosd(B) * cosd(L);
-	float m = 0.9175*cosd(B)*sind(L) - 0.3978*sind(B);
-	float n = 0.3978*cosd(B)*sind(L) + 0.9175*sind(B);
-
-	float ra=to_degrees(atan2(m,l));
-	if(ra<0)ra+=360;
-	float dec=to_degrees(asin(n));
+	//geocentric direction cosines
+	position[0] = cosd(B) * cosd(L);
+	position[1] = 0.9175*cosd(B)*sind(L) - 0.3978*sind(B);
+	position[2] = 0.3978*cosd(B)*sind(L) + 0.9175*sind(B);
+}
 
+void c_planetarium :: plot_moon()
+{
   float x, y, z;
-  calculate_view_ra_dec(ra, dec, x, y, z);
+  calculate_view_direction(ephemeris.moon[0], ephemeris.moon[1], ephemeris.moon[2], x, y, z);
 
   if(abs(x) > 0.5f || abs(y) > 0.5f) return;
   if(z < 0) return;
   calculate_pixel_coords(x, y);
   
-  frame_buffer.draw_object(x, y, 10, (uint16_t*)moon);
-  if(settings.moon_name) frame_buffer.draw_string(x+4, y-16, font_8x5, "Moon", frame_buffer.colour565(223, 136, 247));
+  frame_buffer.draw_object(x, y, 10, catalog_blob.image("moon"));
+  if(settings.moon_name) labels.add(x+4, y-16, "Moon", frame_buffer.colour565(223, 136, 247), planet_label);
+}
+
+#ifdef CHEBYSHEV_EPHEMERIS
+//evaluate a fitted segment using Clenshaw's recurrence, false if jd is outside the table
+static bool compute_chebyshev_position(double jd, const s_chebyshev_body &body, float position[3])
+{
+  const double days = jd - body.start_jd;
+  if(days < 0.0) return false;
+  const uint32_t segment = days/body.segment_days;
+  if(segment >= body.num_segments) return false;
+
+  const float tau = 2.0f*(float)(days - segment*(double)body.segment_days)/body.segment_days - 1.0f;
+  const float *coefficients = body.coefficients + segment*3*body.num_coefficients;
+  for(uint8_t axis=0; axis<3; ++axis)
+  {
+    float b1 = 0.0f, b2 = 0.0f;
+    for(int8_t n=body.num_coefficients-1; n>0; --n)
+    {
+      const float b0 = 2.0f*tau*b1 - b2 + coefficients[n];
+      b2 = b1;
+      b1 = b0;
+    }
+    position[axis] = tau*b1 - b2 + coefficients[0];
+    coefficients += body.num_coefficients;
+  }
+  return true;
+}
+#endif
+
+void c_planetarium :: compute_ephemeris(double jd, s_ephemeris &sample)
+{
+  sample.julian_date = jd;
+  compute_moon_position(jd, sample.moon);
+  for(uint16_t idx=0; idx < 8; ++idx)
+  {
+#ifdef CHEBYSHEV_EPHEMERIS
+    if(compute_chebyshev_position(jd, chebyshev_bodies[idx], sample.planets[idx]))
+    {
+      //the table holds the Earth-Moon barycentre, the Earth is offset from
+      //it away from the Moon, by the mean distance since only the
+      //direction of the Moon is known
+      if(idx == 2)
+      {
+        for(uint8_t axis=0; axis<3; ++axis) sample.planets[idx][axis] -= earth_barycentre_offset*sample.moon[axis];
+      }
+      continue;
+    }
+#endif
+    double x, y, z;
+    compute_planet_position(jd, elements[idx], rates[idx], extra_terms[idx], x, y, z);
+    sample.planets[idx][0] = x;
+    sample.planets[idx][1] = y;
+    sample.planets[idx][2] = z;
+  }
+}
+
+void c_planetarium :: update_ephemeris()
+{
+  //bodies move by arc-seconds per second, so only solve Kepler's equation when
+  //julian_date leaves the bracketing samples, and interpolate in between
+  if(!ephemeris_valid || julian_date < ephemeris_samples[0].julian_date || julian_date > ephemeris_samples[1].julian_date + ephemeris_tolerance)
+  {
+    compute_ephemeris(julian_date, ephemeris_samples[0]);
+    compute_ephemeris(julian_date + ephemeris_tolerance, ephemeris_samples[1]);
+    ephemeris_valid = true;
+  }
+  else if(julian_date > ephemeris_samples[1].julian_date)
+  {
+    //time running forwards, the later sample can be reused
+    ephemeris_samples[0] = ephemeris_samples[1];
+    compute_ephemeris(ephemeris_samples[0].julian_date + ephemeris_tolerance, ephemeris_samples[1]);
+  }
+
+  const s_ephemeris &e0 = ephemeris_samples[0];
+  const s_ephemeris &e1 = ephemeris_samples[1];
+  const float t = (julian_date - e0.julian_date)/(e1.julian_date - e0.julian_date);
+  for(uint16_t idx=0; idx < 8; ++idx)
+  {
+    for(uint16_t axis=0; axis < 3; ++axis)
+    {
+      ephemeris.planets[idx][axis] = e0.planets[idx][axis] + t*(e1.planets[idx][axis] - e0.planets[idx][axis]);
+    }
+  }
+  for(uint16_t axis=0; axis < 3; ++axis)
+  {
+    ephemeris.moon[axis] = e0.moon[axis] + t*(e1.moon[axis] - e0.moon[axis]);
+  }
+  ephemeris.julian_date = julian_date;
 }
 
 void c_planetarium :: matrix_multiply(float first_matrix[3][3], float second_matrix[3][3], float result_matrix[3][3]) {
@@ -1073,28 +1186,28 @@ void c_planetarium :: rotate_x_axis(float matrix[3][3], float theta)
   matrix[0][1] = 0.0f;
   matrix[0][2] = 0.0f;
   matrix[1][0] = 0.0f;
-  matrix[1][1] = cos(to_radians(theta));
-  matrix[1][2] = -sin(to_radians(theta));
+  matrix[1][1] = fast_cosd(theta);
+  matrix[1][2] = -fast_sind(theta);
   matrix[2][0] = 0.0f;
-  matrix[2][1] = sin(to_radians(theta));
-  matrix[2][2] = cos(to_radians(theta));
+  matrix[2][1] = fast_sind(theta);
+  matrix[2][2] = fast_cosd(theta);
 
 }
 
 void c_planetarium :: rotate_z_axis(float matrix[3][3], float theta)
 {
-  matrix[0][0] = cos(to_radians(theta));
-  matrix[0][1] = -sin(to_radians(theta));
+  matrix[0][0] = fast_cosd(theta);
+  matrix[0][1] = -fast_sind(theta);
   matrix[0][2] = 0.0f;
-  matrix[1][0] = sin(to_radians(theta));
-  matrix[1][1] = cos(to_radians(theta));
+  matrix[1][0] = fast_sind(theta);
+  matrix[1][1] = fast_cosd(theta);
   matrix[1][2] = 0.0f;
   matrix[2][0] = 0.0f;
   matrix[2][1] = 0.0f;
   matrix[2][2] = 1.0f;
 }
 
-void c_planetarium :: build_rotation_matrix()
+void c_planetarium :: build_pose_matrix()
 {
   //converting from alt-to az coordinates to screen
   //coordinates involes a series of rotations in 2 planes
@@ -1102,15 +1215,16 @@ void c_planetarium :: build_rotation_matrix()
   //Once the coordinates of the objects are in x, y, z format
   //the screen coordinates can be calculated using a 3x3 rotation
   //matrix. Building the matrix requires trig functions, but only
-  //needs to be done once for each update.
+  //needs to be done when the observer moves.
 
   //Applying the rotation matrix needs to be done tens of thousands
   //of times for each update, but only needs multiplies and adds.
 
-  //rotate celestial sphere around Earth's axis (z) depending on the
-  //local celestial time.
-  float lst_rotation[3][3];
-  rotate_z_axis(lst_rotation, lst);
+  sin_lat = fast_sind(observer.latitude);
+  cos_lat = fast_cosd(observer.latitude);
+  const float theta = -(90-observer.alt);
+  sin_theta = fast_sind(theta);
+  cos_theta = fast_cosd(theta);
 
   //rotate around x (W-E) axis depending on the latitude so that
   //the pole appears at the right altitude.
@@ -1126,11 +1240,82 @@ void c_planetarium :: build_rotation_matrix()
   rotate_x_axis(alt_rotation, -(90-observer.alt));
 
   //combine all the rotations into a single matrix
-  view_rotation_matrix[3][3];
   matrix_multiply(alt_rotation, az_rotation, view_rotation_matrix);
-  float lat_rotation_matrix[3][3];
-  matrix_multiply(view_rotation_matrix, lat_rotation, lat_rotation_matrix);
-  matrix_multiply(lat_rotation_matrix, lst_rotation, rotation_matrix);
+  matrix_multiply(view_rotation_matrix, lat_rotation, pose_matrix);
+
+  pose_latitude = observer.latitude;
+  pose_alt = observer.alt;
+  pose_az = observer.az;
+}
+
+void c_planetarium :: build_rotation_matrix()
+{
+  //rotate celestial sphere around Earth's axis (z) depending on the
+  //local celestial time. Composing with a z rotation only mixes the
+  //first two columns of the pose matrix.
+  const float cos_lst = fast_cosd(lst);
+  const float sin_lst = fast_sind(lst);
+  for(uint8_t i=0; i<3; ++i)
+  {
+    date_rotation_matrix[i][0] = pose_matrix[i][0]*cos_lst + pose_matrix[i][1]*sin_lst;
+    date_rotation_matrix[i][1] = pose_matrix[i][1]*cos_lst - pose_matrix[i][0]*sin_lst;
+    date_rotation_matrix[i][2] = pose_matrix[i][2];
+  }
+
+  //the catalogs are J2000, precess them to the date being viewed
+  matrix_multiply(date_rotation_matrix, precession_matrix, rotation_matrix);
+
+}
+
+void c_planetarium :: update_precession()
+{
+  //precession moves the equinox by ~50 arc-seconds a year and nutation
+  //by ~17 arc-seconds over 18.6 years, refreshing daily is plenty
+  if(fabs(julian_date - precession_julian_date) < 1.0) return;
+  precession_julian_date = julian_date;
+
+  //IAU 1976 precession angles (Lieske)
+  const double T = (julian_date - 2451545.0)/36525.0;
+  const double zeta = to_radians((2306.2181*T + 0.30188*T*T + 0.017998*T*T*T)/3600.0);
+  const double z = to_radians((2306.2181*T + 1.09468*T*T + 0.018203*T*T*T)/3600.0);
+  const double theta = to_radians((2004.3109*T - 0.42665*T*T - 0.041833*T*T*T)/3600.0);
+
+  const double p[3][3] = {
+    {cos(zeta)*cos(z)*cos(theta) - sin(zeta)*sin(z), -sin(zeta)*cos(z)*cos(theta) - cos(zeta)*sin(z), -cos(z)*sin(theta)},
+    {cos(zeta)*sin(z)*cos(theta) + sin(zeta)*cos(z), -sin(zeta)*sin(z)*cos(theta) + cos(zeta)*cos(z), -sin(z)*sin(theta)},
+    {cos(zeta)*sin(theta), -sin(zeta)*sin(theta), cos(theta)}
+  };
+
+  //main terms of the nutation in longitude and obliquity (Meeus ch. 22)
+  const double omega = to_radians(125.04452 - 1934.136261*T);
+  const double sun = to_radians(280.4665 + 36000.7698*T);
+  const double moon = to_radians(218.3165 + 481267.8813*T);
+  const double dpsi = to_radians((-17.20*sin(omega) - 1.32*sin(2*sun) - 0.23*sin(2*moon) + 0.21*sin(2*omega))/3600.0);
+  const double deps = to_radians((9.20*cos(omega) + 0.57*cos(2*sun) + 0.10*cos(2*moon) - 0.09*cos(2*omega))/3600.0);
+  const double eps = to_radians(23.439291 - 0.0130042*T);
+
+  //nutation angles are tiny, so the first order rotation is exact enough
+  const double n[3][3] = {
+    {1.0, -dpsi*cos(eps), -dpsi*sin(eps)},
+    {dpsi*cos(eps), 1.0, -deps},
+    {dpsi*sin(eps), deps, 1.0}
+  };
+  equation_of_equinoxes = to_degrees(dpsi*cos(eps));
+
+  //the catalogs store (y, x, z) rather than (x, y, z), swap rows and columns to match
+  const uint8_t axis[3] = {1, 0, 2};
+  for(uint8_t i=0; i<3; ++i)
+  {
+    for(uint8_t j=0; j<3; ++j)
+    {
+      double element = 0.0;
+      for(uint8_t k=0; k<3; ++k) element += n[axis[i]][k]*p[k][axis[j]];
+      precession_matrix[i][j] = element;
+    }
+  }
 
+  //proper motion is applied in one year steps
+  const float years = floor((julian_date - 2451545.0)/365.25 + 0.5);
+  proper_motion_scale = years*(float)(M_PI/(180.0*3600.0*1000.0));
 }
 
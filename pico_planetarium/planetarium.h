@@ -3,6 +3,8 @@
 
 #include <cstdint>
 #include "frame_buffer.h"
+#include "label_layout.h"
+#include "star_catalog.h"
 
 struct s_observer
 {
@@ -23,8 +25,19 @@ struct s_observer
   uint8_t hour;
   uint8_t min;
   uint8_t sec;
+
+  //utc as a julian date, with fractions of a second. If this is set (non
+  //zero) it is used instead of year..sec, so callers with a high resolution
+  //clock can skip the calendar conversion and the sky moves smoothly.
+  double julian_date;
 };
 
+//julian date from seconds since 1970
+inline double unix_to_julian_date(double unix_seconds)
+{
+  return unix_seconds/86400.0 + 2440587.5;
+}
+
 struct s_settings
 {
   bool constellation_lines;
@@ -42,6 +55,8 @@ struct s_settings
   bool ecliptic;
   bool alt_az_grid;
   bool ra_dec_grid;
+  bool antialiased_lines; //constellations, grids and planes
+  bool proper_motion; //move stars from their J2000 positions
 };
 
 struct s_keplarian {
@@ -60,6 +75,14 @@ struct s_extra_terms {
   double f;
 };
 
+//heliocentric equatorial positions of the planets (AU) and the geocentric
+//direction of the moon, sampled at a single julian date
+struct s_ephemeris {
+  double julian_date;
+  float planets[8][3];
+  float moon[3];
+};
+
 extern const s_keplarian elements[];
 extern const s_keplarian rates[];
 extern const s_extra_terms extra_terms[];
@@ -73,29 +96,48 @@ class c_planetarium
   float sin_lat, cos_lat;
   float view_scale;
   float cos_theta, sin_theta;
-  float rotation_matrix[3][3];
-  float view_rotation_matrix[3][3];
+  float cos_view_cone, sin_view_cone; //half-angle of cone enclosing the screen
+  float rotation_matrix[3][3]; //J2000 catalog to view
+  float date_rotation_matrix[3][3]; //equator and equinox of date to view
+  float precession_matrix[3][3]; //J2000 catalog to equator and equinox of date
+  double precession_julian_date;
+  float equation_of_equinoxes; //degrees, nutation in right ascension
+  float proper_motion_scale; //mas/yr to unit vector offset at the current epoch
+  float view_rotation_matrix[3][3]; //horizontal to view
+  float pose_matrix[3][3]; //equator of date at lst=0 to view, depends only on where the observer is and looks
+  float pose_latitude, pose_alt, pose_az, pose_field; //observer fields the cached pose was built from
+  bool pose_valid;
 
   inline float to_radians(float x);
   inline float to_degrees(float x);
   void ra_dec_to_alt_az(float ra, float dec, float &alt, float &az);
   void alt_az_to_ra_dec(float alt, float az, float &ra, float &dec);
+  void build_pose_matrix();
   void build_rotation_matrix();
+  void update_precession();
   void calculate_view_equatorial_x_y_z(float &x, float &y, float &z);
   void calculate_view_horizontal_x_y_z(float &x, float &y, float &z);
+  void calculate_view_of_date_x_y_z(float &x, float &y, float &z);
   void calculate_view_ra_dec(float ra, float dec, float &x, float &y, float &z);
   void calculate_view_alt_az(float alt, float az, float &x, float &y, float &z);
   void calculate_pixel_coords(float &x, float &y);
+  void calculate_view_cone();
+  bool in_view_cone(float x, float y, float z);
+  bool in_view_cone(float x, float y, float z, float cos_half, float sin_half);
   void plot_constellations();
   void plot_planes();
   void plot_stars();
+  void plot_catalog_stars();
+  void plot_star(float x, float y, float z, float magnitude, uint8_t mk);
   void plot_planets();
   void plot_moon();
   void plot_objects();
   void plot_constellation_names();
   void plot_cardinal_points();
   void plot_star_names();
-  void plot_plane(float pole_alt, float pole_az, uint16_t colour);
+  void plot_segment(float x1, float y1, float z1, float x2, float y2, float z2, uint16_t colour, uint16_t alpha=256);
+  void plot_circle(bool equatorial, const float centre[3], const float u[3], const float v[3], uint16_t colour);
+  void plot_plane(float pole_ra, float pole_dec, uint16_t colour);
   void plot_alt_az_grid(uint16_t colour);
   void plot_ra_dec_grid(uint16_t colour);
   void plot_milky_way();
@@ -112,17 +154,38 @@ class c_planetarium
   float cosd(float r);
 
   double solve_kepler(double M, double e, double E);
-  void convert_to_ra_dec(double x, double y, double z, double &ra, double &dec);
   void compute_planet_position(double jd, s_keplarian elements, s_keplarian rates, s_extra_terms extra_terms, double &x, double &y, double &z);
+  void compute_moon_position(double jd, float position[3]);
+  void compute_ephemeris(double jd, s_ephemeris &sample);
+  void update_ephemeris();
+  void calculate_view_direction(float dx, float dy, float dz, float &x, float &y, float &z);
 
   c_frame_buffer &frame_buffer;
   uint16_t width, height;
+  c_label_layout labels;
+  double ephemeris_tolerance; //days between ephemeris samples
+  bool ephemeris_valid;
+  s_ephemeris ephemeris_samples[2]; //bracket julian_date
+  s_ephemeris ephemeris; //interpolated to julian_date
+  c_star_catalog *star_catalog;
 
   public:
 
-  c_planetarium(c_frame_buffer & frame_buffer, uint16_t width, uint16_t height):frame_buffer(frame_buffer), width(width), height(height){} 
+  c_planetarium(c_frame_buffer & frame_buffer, uint16_t width, uint16_t height):precession_julian_date(0.0), pose_valid(false), frame_buffer(frame_buffer), width(width), height(height), labels(frame_buffer, width, height), ephemeris_tolerance(1.0/24.0), ephemeris_valid(false), star_catalog(nullptr){} 
 
   void update(s_observer observer, s_settings settings);
+
+  //planet, sun and moon positions are recomputed at most once per tolerance
+  //(in days) and linearly interpolated in between
+  void set_ephemeris_tolerance(double days){ephemeris_tolerance = days; ephemeris_valid = false;}
+
+  //the ephemeris and precession are reused from earlier frames, so a frame
+  //depends slightly on the ones before it. Call this first to render a
+  //frame that only depends on its observer and settings.
+  void invalidate_caches(){ephemeris_valid = false; precession_julian_date = 0.0;}
+
+  //plot stars from an external catalog instead of the built in one, nullptr to revert
+  void set_star_catalog(c_star_catalog *catalog){star_catalog = catalog;}
 };
 
 #endif
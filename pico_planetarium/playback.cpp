@@ -0,0 +1,94 @@
+#include <cmath>
+#include "playback.h"
+
+//simulated seconds per real second
+static const double playback_multipliers[num_playback_rates] = {
+  0.0,
+  1.0,
+  60.0,
+  3600.0,
+  86164.0905/60.0, //one sidereal day per minute
+};
+
+static const char * const playback_names[num_playback_rates] = {
+  "off",
+  "1x",
+  "60x",
+  "3600x",
+  "d/min",
+};
+
+//days since 1970-01-01 in the proleptic Gregorian calendar, done by hand
+//because timegm() isn't available on every target
+static int32_t days_from_civil(int32_t y, uint32_t m, uint32_t d)
+{
+  y -= m <= 2;
+  const int32_t era = (y >= 0 ? y : y-399) / 400;
+  const uint32_t yoe = y - era * 400;
+  const uint32_t doy = (153*(m + (m > 2 ? -3 : 9)) + 2)/5 + d-1;
+  const uint32_t doe = yoe * 365 + yoe/4 - yoe/100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+static void civil_from_days(int32_t z, int32_t &y, uint32_t &m, uint32_t &d)
+{
+  z += 719468;
+  const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const uint32_t doe = z - era * 146097;
+  const uint32_t yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+  const uint32_t doy = doe - (365*yoe + yoe/4 - yoe/100);
+  const uint32_t mp = (5*doy + 2)/153;
+  d = doy - (153*mp+2)/5 + 1;
+  m = mp < 10 ? mp+3 : mp-9;
+  y = yoe + era * 400 + (m <= 2);
+}
+
+void c_playback :: start(const s_observer &observer, e_playback_rate new_rate)
+{
+  if(observer.julian_date != 0.0)
+  {
+    seconds = (observer.julian_date - 2440587.5)*86400.0;
+  }
+  else
+  {
+    const int32_t days = days_from_civil(observer.year, observer.month, observer.day);
+    seconds = days*86400.0 + observer.hour*3600.0 + observer.min*60.0 + observer.sec;
+  }
+  rate = new_rate;
+}
+
+void c_playback :: next_rate(const s_observer &observer)
+{
+  const e_playback_rate new_rate = (e_playback_rate)((rate + 1) % num_playback_rates);
+  if(rate == playback_off) start(observer, new_rate);
+  else rate = new_rate;
+}
+
+double c_playback :: time_multiplier() const
+{
+  return rate == playback_off ? 1.0 : playback_multipliers[rate];
+}
+
+const char *c_playback :: rate_name() const
+{
+  return playback_names[rate];
+}
+
+void c_playback :: advance(float elapsed_seconds, s_observer &observer)
+{
+  seconds += elapsed_seconds*playback_multipliers[rate];
+
+  const double days = floor(seconds/86400.0);
+  uint32_t time_of_day = seconds - days*86400.0;
+  int32_t year;
+  uint32_t month, day;
+  civil_from_days(days, year, month, day);
+
+  observer.year = year;
+  observer.month = month;
+  observer.day = day;
+  observer.hour = time_of_day/3600;
+  observer.min = (time_of_day/60)%60;
+  observer.sec = time_of_day%60;
+  observer.julian_date = unix_to_julian_date(seconds);
+}
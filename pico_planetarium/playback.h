@@ -0,0 +1,42 @@
+#ifndef __PLAYBACK_H__
+#define __PLAYBACK_H__
+
+#include <cstdint>
+#include "planetarium.h"
+
+enum e_playback_rate {
+  playback_off,
+  playback_1x,
+  playback_60x,
+  playback_3600x,
+  playback_sidereal_day_per_minute,
+  num_playback_rates
+};
+
+//Runs a simulated UTC clock at a multiple of real time, so the sky can be
+//animated. The clock is kept as seconds since 1970 in a double, so fractions
+//of a second carry over between frames even at 1x.
+class c_playback
+{
+  e_playback_rate rate;
+  double seconds;
+
+  public:
+
+  c_playback():rate(playback_off), seconds(0.0){}
+
+  void start(const s_observer &observer, e_playback_rate new_rate);
+  void stop(){rate = playback_off;}
+  void next_rate(const s_observer &observer);
+  bool is_playing() const {return rate != playback_off;}
+  e_playback_rate get_rate() const {return rate;}
+  const char *rate_name() const;
+
+  //simulated seconds per real second, 1 when not playing
+  double time_multiplier() const;
+
+  //advance the clock by elapsed real seconds, and write the result into observer
+  void advance(float elapsed_seconds, s_observer &observer);
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "remote_api.h"
+
+struct s_api_number
+{
+  const char *name;
+  float s_observer::*field;
+  float min, max;
+};
+
+//same limits as the buttons
+static const s_api_number observer_fields[] = {
+  {"latitude", &s_observer::latitude, -90.0f, 90.0f},
+  {"longitude", &s_observer::longitude, -180.0f, 180.0f},
+  {"alt", &s_observer::alt, -90.0f, 90.0f},
+  {"az", &s_observer::az, 0.0f, 360.0f},
+  {"field", &s_observer::field, 0.0f, 180.0f},
+};
+static const uint8_t num_observer_fields = sizeof(observer_fields)/sizeof(observer_fields[0]);
+
+struct s_api_flag
+{
+  const char *name;
+  bool s_settings::*field;
+};
+
+static const s_api_flag settings_fields[] = {
+  {"constellation_lines", &s_settings::constellation_lines},
+  {"constellation_names", &s_settings::constellation_names},
+  {"star_names", &s_settings::star_names},
+  {"deep_sky_objects", &s_settings::deep_sky_objects},
+  {"deep_sky_object_names", &s_settings::deep_sky_object_names},
+  {"planets", &s_settings::planets},
+  {"planet_names", &s_settings::planet_names},
+  {"moon", &s_settings::moon},
+  {"moon_name", &s_settings::moon_name},
+  {"sun", &s_settings::sun},
+  {"sun_name", &s_settings::sun_name},
+  {"celestial_equator", &s_settings::celestial_equator},
+  {"ecliptic", &s_settings::ecliptic},
+  {"alt_az_grid", &s_settings::alt_az_grid},
+  {"ra_dec_grid", &s_settings::ra_dec_grid},
+  {"antialiased_lines", &s_settings::antialiased_lines},
+  {"proper_motion", &s_settings::proper_motion},
+};
+static const uint8_t num_settings_fields = sizeof(settings_fields)/sizeof(settings_fields[0]);
+static_assert(sizeof(settings_fields)/sizeof(settings_fields[0]) == sizeof(s_settings), "every s_settings field needs a name");
+
+static bool parse_number(const char *text, double &value)
+{
+  char *end;
+  value = strtod(text, &end);
+  return end != text && *end == 0;
+}
+
+//returns 0 or 1, 2 for toggle, or -1 if it isn't a flag
+static int8_t parse_flag(const char *text)
+{
+  if(!strcmp(text, "1") || !strcmp(text, "true") || !strcmp(text, "on")) return 1;
+  if(!strcmp(text, "0") || !strcmp(text, "false") || !strcmp(text, "off")) return 0;
+  if(!strcmp(text, "toggle")) return 2;
+  return -1;
+}
+
+static uint16_t error(uint16_t status, const char *message, const char *detail, char *response, uint16_t size)
+{
+  snprintf(response, size, "{\"error\":\"%s %s\"}", message, detail);
+  return status;
+}
+
+c_remote_api :: c_remote_api(s_observer &observer, s_settings &settings):
+  m_observer(observer), m_settings(settings), m_changes(0), m_internet_time(true),
+  m_requested_time(0.0), m_time(0.0), m_using_internet_time(true)
+{
+  memset(&profile, 0, sizeof(profile));
+}
+
+uint8_t c_remote_api :: take_changes()
+{
+  const uint8_t changes = m_changes;
+  m_changes = 0;
+  return changes;
+}
+
+uint16_t c_remote_api :: handle(e_api_method method, const char *path, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size)
+{
+  uint16_t status;
+  if(!strcmp(path, "/api/observer")) status = observer_request(method, args, num_args, response, size);
+  else if(!strcmp(path, "/api/settings")) status = settings_request(method, args, num_args, response, size);
+  else if(!strcmp(path, "/api/time")) status = time_request(method, args, num_args, response, size);
+  else if(!strcmp(path, "/api/profile")) status = profile_request(method, response, size);
+  else return error(404, "not found", path, response, size);
+
+  //snprintf stops at the end of the buffer, don't send half a document
+  if(strlen(response) + 1 >= size) return error(500, "response too long", "", response, size);
+  return status;
+}
+
+uint16_t c_remote_api :: observer_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size)
+{
+  if(method == api_other) return error(405, "method not allowed", "", response, size);
+
+  if(method == api_post)
+  {
+    //check everything before changing anything
+    float values[num_observer_fields];
+    bool present[num_observer_fields] = {};
+    for(uint8_t arg = 0; arg < num_args; ++arg)
+    {
+      uint8_t idx = 0;
+      while(idx < num_observer_fields && strcmp(args[arg].name, observer_fields[idx].name)) idx++;
+      if(idx == num_observer_fields) return error(400, "unknown field", args[arg].name, response, size);
+
+      double value;
+      const s_api_number &field = observer_fields[idx];
+      if(!parse_number(args[arg].value, value) || value < field.min || value > field.max)
+      {
+        return error(400, "bad value for", field.name, response, size);
+      }
+      values[idx] = value;
+      present[idx] = true;
+    }
+
+    for(uint8_t idx = 0; idx < num_observer_fields; ++idx)
+    {
+      if(!present[idx] || m_observer.*observer_fields[idx].field == values[idx]) continue;
+      m_observer.*observer_fields[idx].field = values[idx];
+      m_changes |= api_observer_changed;
+    }
+  }
+
+  snprintf(response, size,
+    "{\"latitude\":%.4f,\"longitude\":%.4f,\"alt\":%.2f,\"az\":%.2f,\"field\":%.2f,"
+    "\"julian_date\":%.6f,\"internet_time\":%s}",
+    m_observer.latitude, m_observer.longitude, m_observer.alt, m_observer.az, m_observer.field,
+    m_observer.julian_date, m_using_internet_time?"true":"false");
+  return 200;
+}
+
+uint16_t c_remote_api :: settings_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size)
+{
+  if(method == api_other) return error(405, "method not allowed", "", response, size);
+
+  if(method == api_post)
+  {
+    s_settings settings = m_settings;
+    for(uint8_t arg = 0; arg < num_args; ++arg)
+    {
+      uint8_t idx = 0;
+      while(idx < num_settings_fields && strcmp(args[arg].name, settings_fields[idx].name)) idx++;
+      if(idx == num_settings_fields) return error(400, "unknown setting", args[arg].name, response, size);
+
+      const int8_t flag = parse_flag(args[arg].value);
+      if(flag < 0) return error(400, "bad value for", settings_fields[idx].name, response, size);
+      bool &value = settings.*settings_fields[idx].field;
+      value = flag == 2 ? !value : flag;
+    }
+
+    if(memcmp(&settings, &m_settings, sizeof(settings)))
+    {
+      m_settings = settings;
+      m_changes |= api_settings_changed;
+    }
+  }
+
+  uint16_t length = snprintf(response, size, "{");
+  for(uint8_t idx = 0; idx < num_settings_fields && length < size; ++idx)
+  {
+    length += snprintf(response + length, size - length, "%s\"%s\":%s", idx?",":"",
+      settings_fields[idx].name, m_settings.*settings_fields[idx].field?"true":"false");
+  }
+  if(length < size) snprintf(response + length, size - length, "}");
+  return 200;
+}
+
+uint16_t c_remote_api :: time_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size)
+{
+  if(method != api_post) return error(405, "method not allowed", "", response, size);
+  if(num_args != 1) return error(400, "expected one of", "unix, julian_date, offset or ntp", response, size);
+
+  double value;
+  const char *name = args[0].name;
+  if(!strcmp(name, "ntp"))
+  {
+    if(parse_flag(args[0].value) != 1) return error(400, "bad value for", name, response, size);
+    m_internet_time = true;
+  }
+  else
+  {
+    if(!parse_number(args[0].value, value)) return error(400, "bad value for", name, response, size);
+    double unix_seconds;
+    if(!strcmp(name, "unix")) unix_seconds = value;
+    else if(!strcmp(name, "julian_date")) unix_seconds = (value - 2440587.5)*86400.0;
+    else if(!strcmp(name, "offset")) unix_seconds = m_time + value;
+    else return error(400, "unknown field", name, response, size);
+
+    //the playback clock and the calendar both start at 1970
+    if(unix_seconds < 0.0) return error(400, "time before 1970", "", response, size);
+    m_requested_time = unix_seconds;
+    m_internet_time = false;
+  }
+  m_changes |= api_time_changed;
+
+  snprintf(response, size, "{\"unix\":%.3f,\"internet_time\":%s}",
+    m_internet_time ? m_time : m_requested_time, m_internet_time?"true":"false");
+  return 200;
+}
+
+uint16_t c_remote_api :: profile_request(e_api_method method, char *response, uint16_t size)
+{
+  if(method != api_get) return error(405, "method not allowed", "", response, size);
+  snprintf(response, size, "{\"frames\":%lu,\"render_us\":%lu,\"max_render_us\":%lu,\"push_us\":%lu}",
+    (unsigned long)profile.frames, (unsigned long)profile.render_us,
+    (unsigned long)profile.max_render_us, (unsigned long)profile.push_us);
+  return 200;
+}
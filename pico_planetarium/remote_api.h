@@ -0,0 +1,92 @@
+#ifndef __REMOTE_API_H__
+#define __REMOTE_API_H__
+
+#include <cstdint>
+#include "planetarium.h"
+
+//Remote control of the observer and settings over HTTP.
+//
+//  GET  /api/observer   view, location and time as JSON
+//  POST /api/observer   latitude, longitude, alt, az, field
+//  GET  /api/settings   every s_settings field as JSON
+//  POST /api/settings   <field>=1|0|toggle for any s_settings field
+//  POST /api/time       unix=<seconds>, julian_date=<days>, offset=<seconds>
+//                       or ntp=1 to go back to internet time
+//  GET  /api/profile    timings of the last frame
+//
+//Arguments come from the query string or a form body. A request is applied
+//whole or not at all, a bad argument gives 400 and changes nothing.
+//
+//Requests write straight into the observer and settings, and only record
+//what changed. The main loop collects the changes once per frame with
+//take_changes(), so any number of fields or requests cost a single render.
+//The HTTP server itself is outside, see RemoteApi for the device and
+//test/remote_api_test.cpp for the host.
+
+enum e_api_method {
+  api_get,
+  api_post,
+  api_other,
+};
+
+enum e_api_change {
+  api_observer_changed = 1,
+  api_settings_changed = 2,
+  api_time_changed = 4,
+};
+
+struct s_api_arg
+{
+  const char *name;
+  const char *value;
+};
+
+//filled in by the main loop, reported by /api/profile
+struct s_frame_profile
+{
+  uint32_t frames; //sky renders since start up
+  uint32_t render_us; //last sky render
+  uint32_t max_render_us;
+  uint32_t push_us; //last full frame sent to the display
+};
+
+class c_remote_api
+{
+  public:
+
+  c_remote_api(s_observer &observer, s_settings &settings);
+
+  //handle one request, the JSON response goes in response, returns the HTTP
+  //status
+  uint16_t handle(e_api_method method, const char *path, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size);
+
+  //e_api_change bits since the last call
+  uint8_t take_changes();
+
+  //after api_time_changed, the time to set in seconds since 1970, unless
+  //internet time was asked for
+  bool internet_time_requested() const {return m_internet_time;}
+  double requested_time() const {return m_requested_time;}
+
+  //the current clock, used for offset= and reported by /api/observer
+  void set_time(double unix_seconds, bool internet_time){m_time = unix_seconds; m_using_internet_time = internet_time;}
+
+  s_frame_profile profile;
+
+  private:
+
+  uint16_t observer_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size);
+  uint16_t settings_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size);
+  uint16_t time_request(e_api_method method, const s_api_arg *args, uint8_t num_args, char *response, uint16_t size);
+  uint16_t profile_request(e_api_method method, char *response, uint16_t size);
+
+  s_observer &m_observer;
+  s_settings &m_settings;
+  uint8_t m_changes;
+  bool m_internet_time;
+  double m_requested_time;
+  double m_time;
+  bool m_using_internet_time;
+};
+
+#endif
@@ -0,0 +1,181 @@
+#include <cmath>
+#include <cstring>
+#include "sntp_clock.h"
+
+static const double ntp_to_unix = 2208988800.0; //seconds from 1900 to 1970
+static const double step_threshold = 0.5; //seconds
+static const double max_slew_rate = 500.0e-6;
+static const double max_frequency = 500.0e-6;
+static const double frequency_time_constant = 256.0; //seconds
+static const double settled_error = 0.005; //seconds
+static const double max_drift_error = 0.128; //bigger errors are a jump in phase, not drift
+static const uint32_t reply_timeout_us = 5000000;
+
+//64 bit NTP timestamps, 32.32 fixed point seconds since 1900. Era 1 starts
+//in 2036, times with the top bit clear are taken to be in era 1 (RFC 4330).
+static double read_timestamp(const uint8_t *data)
+{
+  const uint32_t seconds = (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+  const uint32_t fraction = (uint32_t)data[4] << 24 | (uint32_t)data[5] << 16 | (uint32_t)data[6] << 8 | data[7];
+  const double era = (seconds & 0x80000000u) ? 0.0 : 4294967296.0;
+  return seconds + era + fraction/4294967296.0 - ntp_to_unix;
+}
+
+static void write_timestamp(uint8_t *data, double unix_time)
+{
+  const double ntp_time = unix_time + ntp_to_unix;
+  const uint32_t seconds = (uint32_t)(uint64_t)ntp_time;
+  const uint32_t fraction = (ntp_time - floor(ntp_time))*4294967296.0;
+  for(uint8_t idx = 0; idx < 4; ++idx)
+  {
+    data[idx] = seconds >> (24 - 8*idx);
+    data[idx+4] = fraction >> (24 - 8*idx);
+  }
+}
+
+c_sntp_clock :: c_sntp_clock():
+  m_base_us(0), m_base_time(0.0), m_frequency(0.0), m_slew(0.0),
+  m_synchronised(false), m_waiting(false), m_sent_us(0), m_next_poll_us(0), m_last_sample_us(0),
+  m_poll_interval(min_poll_interval), m_min_delay(1.0), m_last_offset(0.0), m_last_delay(0.0)
+{
+  memset(m_origin, 0, sizeof(m_origin));
+}
+
+double c_sntp_clock :: time_at(uint64_t local)
+{
+  const double elapsed = (int64_t)(local - m_base_us)*1.0e-6;
+  const double max_slew = elapsed*max_slew_rate;
+  const double slewed = m_slew > max_slew ? max_slew : (m_slew < -max_slew ? -max_slew : m_slew);
+  return m_base_time + elapsed*(1.0 + m_frequency) + slewed;
+}
+
+double c_sntp_clock :: time()
+{
+  return time_at(local_us());
+}
+
+//move the base of the clock model to local, keeping the time continuous
+void c_sntp_clock :: rebase(uint64_t local)
+{
+  const double elapsed = (int64_t)(local - m_base_us)*1.0e-6;
+  const double max_slew = elapsed*max_slew_rate;
+  const double slewed = m_slew > max_slew ? max_slew : (m_slew < -max_slew ? -max_slew : m_slew);
+  m_base_time += elapsed*(1.0 + m_frequency) + slewed;
+  m_slew -= slewed;
+  m_base_us = local;
+}
+
+void c_sntp_clock :: poll()
+{
+  const uint64_t now = local_us();
+
+  if(m_waiting)
+  {
+    uint8_t packet[48];
+    while(udp_receive(packet, sizeof(packet)) >= 48)
+    {
+      handle_reply(packet, now);
+      if(!m_waiting) break;
+    }
+
+    if(m_waiting && now - m_sent_us > reply_timeout_us)
+    {
+      m_waiting = false;
+      m_next_poll_us = now + min_poll_interval*1000000ull;
+    }
+  }
+
+  if(!m_waiting && (int64_t)(now - m_next_poll_us) >= 0)
+  {
+    send_request(now);
+  }
+}
+
+void c_sntp_clock :: send_request(uint64_t local)
+{
+  uint8_t packet[48];
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0b00100011; //no leap warning, version 4, client
+
+  //the server copies our transmit timestamp into the reply's originate
+  //timestamp, which ties the reply to this request
+  write_timestamp(packet + 40, time_at(local));
+  memcpy(m_origin, packet + 40, sizeof(m_origin));
+
+  m_sent_us = local;
+  m_waiting = udp_send(packet, sizeof(packet));
+  if(!m_waiting) m_next_poll_us = local + min_poll_interval*1000000ull;
+}
+
+void c_sntp_clock :: handle_reply(const uint8_t *packet, uint64_t local)
+{
+  const uint8_t leap = packet[0] >> 6;
+  const uint8_t mode = packet[0] & 7;
+  const uint8_t stratum = packet[1];
+  if(mode != 4 || memcmp(packet + 24, m_origin, sizeof(m_origin)) != 0) return; //not our reply
+  m_waiting = false;
+  m_next_poll_us = local + m_poll_interval*1000000ull;
+  if(leap == 3 || stratum == 0 || stratum > 15) return; //server not synchronised, or kiss of death
+
+  const double t1 = read_timestamp(m_origin);
+  const double t2 = read_timestamp(packet + 32);
+  const double t3 = read_timestamp(packet + 40);
+  const double t4 = time_at(local);
+  const double offset = ((t2 - t1) + (t3 - t4))/2.0;
+  const double delay = (t4 - t1) - (t3 - t2);
+
+  //a slow reply has an uncertain offset, so skip it unless it is the only
+  //way to get the clock set. The best delay seen is allowed to creep up in
+  //case the route changes.
+  m_min_delay = delay < m_min_delay ? delay : m_min_delay*1.1;
+  if(m_synchronised && delay > 2.0*m_min_delay + 0.020)
+  {
+    m_next_poll_us = local + min_poll_interval*1000000ull;
+    return;
+  }
+
+  m_last_offset = offset;
+  m_last_delay = delay;
+  discipline(offset, local);
+}
+
+void c_sntp_clock :: discipline(double offset, uint64_t local)
+{
+  rebase(local);
+
+  if(!m_synchronised || fabs(offset) > step_threshold)
+  {
+    m_base_time += offset;
+    m_slew = 0.0;
+    m_synchronised = true;
+    m_last_sample_us = local;
+    m_poll_interval = min_poll_interval;
+    m_next_poll_us = local + m_poll_interval*1000000ull;
+    return;
+  }
+
+  //whatever isn't explained by the slew still to do is the crystal, weight
+  //it by how long it had to build up so noisy short polls count for less
+  const double interval = (local - m_last_sample_us)*1.0e-6;
+  const double error = offset - m_slew;
+  if(fabs(error) < max_drift_error)
+  {
+    const double weight = interval/(interval + frequency_time_constant);
+    m_frequency += weight*error/interval;
+    if(m_frequency > max_frequency) m_frequency = max_frequency;
+    if(m_frequency < -max_frequency) m_frequency = -max_frequency;
+  }
+  m_slew = offset;
+  m_last_sample_us = local;
+
+  //back off while the clock holds time, poll faster if it doesn't
+  if(fabs(error) < settled_error)
+  {
+    if(m_poll_interval < max_poll_interval) m_poll_interval = m_poll_interval*2 < max_poll_interval ? m_poll_interval*2 : max_poll_interval;
+  }
+  else if(m_poll_interval > min_poll_interval)
+  {
+    m_poll_interval /= 2;
+  }
+  m_next_poll_us = local + m_poll_interval*1000000ull;
+}
@@ -0,0 +1,76 @@
+#ifndef __SNTP_CLOCK_H__
+#define __SNTP_CLOCK_H__
+
+#include <cstdint>
+
+//SNTP client (RFC 4330) and disciplined clock.
+//
+//poll() never blocks: it sends a request when one is due and checks for the
+//reply on later calls. Each reply gives the offset and round trip delay from
+//the four timestamps. The first reply, or an offset bigger than
+//step_threshold, steps the clock. Smaller offsets are slewed out at no more
+//than max_slew_rate, so time never jumps or runs backwards. The offset left
+//over once the expected slew is accounted for is put down to the local
+//crystal, and is used to learn its frequency error. As the clock settles
+//the poll interval doubles, up to an hour.
+//
+//The network and the local timer are virtual, so the same code runs on the
+//device (NTPTime) and against a stand-in server on the host.
+class c_sntp_clock
+{
+  public:
+
+  static const uint32_t min_poll_interval = 16; //seconds
+  static const uint32_t max_poll_interval = 3600;
+
+  c_sntp_clock();
+  virtual ~c_sntp_clock(){}
+
+  void poll();
+
+  //disciplined UTC, in seconds since 1970
+  double time();
+  bool is_synchronised() const {return m_synchronised;}
+  bool is_waiting() const {return m_waiting;}
+
+  //diagnostics
+  uint32_t poll_interval() const {return m_poll_interval;}
+  double frequency_ppm() const {return m_frequency*1.0e6;}
+  double last_offset() const {return m_last_offset;}
+  double last_delay() const {return m_last_delay;}
+
+  private:
+
+  //send a 48 byte packet to the server, and read one back if there is one
+  //waiting, returning its size or 0 without blocking
+  virtual bool udp_send(const uint8_t *packet, uint16_t size) = 0;
+  virtual int udp_receive(uint8_t *packet, uint16_t size) = 0;
+
+  //free running local timer, in microseconds
+  virtual uint64_t local_us() = 0;
+
+  double time_at(uint64_t local);
+  void rebase(uint64_t local);
+  void send_request(uint64_t local);
+  void handle_reply(const uint8_t *packet, uint64_t local);
+  void discipline(double offset, uint64_t local);
+
+  //clock model: UTC = base_time + elapsed*(1+frequency) + slew applied so far
+  uint64_t m_base_us;
+  double m_base_time;
+  double m_frequency;
+  double m_slew; //offset still to be slewed out, seconds
+
+  bool m_synchronised;
+  bool m_waiting;
+  uint8_t m_origin[8]; //our transmit timestamp, which the reply must echo
+  uint64_t m_sent_us;
+  uint64_t m_next_poll_us;
+  uint64_t m_last_sample_us;
+  uint32_t m_poll_interval;
+  double m_min_delay;
+  double m_last_offset;
+  double m_last_delay;
+};
+
+#endif
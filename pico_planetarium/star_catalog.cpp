@@ -0,0 +1,148 @@
+#include <cstring>
+#include <algorithm>
+#include "star_catalog.h"
+
+c_star_catalog :: c_star_catalog(uint32_t cache_size):
+  m_cache_size(cache_size), m_max_slots(0), m_num_slots(0), m_slot_capacity(0), m_slots(nullptr), m_tile_slots(nullptr),
+  m_clock(0), m_stars_streamed(0), m_num_tiles(0), m_tiles(nullptr), m_mapped(nullptr)
+{
+  m_slot_stars = new s_catalog_star[cache_size];
+  m_stream = new s_catalog_star[stream_size];
+}
+
+c_star_catalog :: ~c_star_catalog()
+{
+  delete[] m_tiles;
+  delete[] m_slots;
+  delete[] m_tile_slots;
+  delete[] m_slot_stars;
+  delete[] m_stream;
+}
+
+bool c_star_catalog :: open(const char* filename)
+{
+  close();
+  if(!file_open(filename)) return false;
+
+  s_catalog_header header;
+  file_read(&header, sizeof(header), 1);
+  if(memcmp(header.magic, "PSTC", 4) != 0 || header.version != 1 || header.num_tiles == 0 || header.num_tiles == no_slot)
+  {
+    file_close();
+    return false;
+  }
+
+  //the tile index is small enough to keep in RAM
+  m_num_tiles = header.num_tiles;
+  m_tiles = new s_catalog_tile[m_num_tiles];
+  file_read(m_tiles, sizeof(s_catalog_tile), m_num_tiles);
+
+  //at most one slot per tile, and each slot holds at least one star
+  m_max_slots = std::min<uint32_t>(m_num_tiles, m_cache_size);
+  m_slots = new s_slot[m_max_slots];
+  m_tile_slots = new uint16_t[m_num_tiles];
+  partition(std::min<uint16_t>(m_max_slots, 16));
+
+  m_mapped = file_map();
+  return true;
+}
+
+void c_star_catalog :: close()
+{
+  if(!m_tiles) return;
+  file_close();
+  delete[] m_tiles;
+  delete[] m_slots;
+  delete[] m_tile_slots;
+  m_tiles = nullptr;
+  m_slots = nullptr;
+  m_tile_slots = nullptr;
+  m_mapped = nullptr;
+  m_num_tiles = 0;
+  m_max_slots = 0;
+  m_num_slots = 0;
+}
+
+void c_star_catalog :: partition(uint16_t num_slots)
+{
+  //share the cache out evenly, which empties it
+  m_num_slots = num_slots;
+  m_slot_capacity = num_slots ? std::min<uint32_t>(m_cache_size/num_slots, 0xffff) : 0;
+  for(uint16_t slot = 0; slot < m_num_slots; ++slot)
+  {
+    m_slots[slot].tile = no_slot;
+    m_slots[slot].last_used = 0;
+  }
+  std::fill_n(m_tile_slots, m_num_tiles, (uint16_t)no_slot);
+}
+
+void c_star_catalog :: reserve(uint16_t num_tiles)
+{
+  if(m_mapped || !m_max_slots) return;
+  num_tiles = std::max<uint16_t>(1, std::min(num_tiles, m_max_slots));
+
+  //more slots than tiles is fine, only split the cache again when there are
+  //too few or twice as many as needed
+  if(num_tiles <= m_num_slots && num_tiles*2 > m_num_slots) return;
+  partition(num_tiles);
+}
+
+uint16_t c_star_catalog :: load_slot(uint16_t idx)
+{
+  ++m_clock;
+  uint16_t slot = m_tile_slots[idx];
+  if(slot != no_slot)
+  {
+    m_slots[slot].last_used = m_clock;
+    return slot;
+  }
+
+  //replace the least recently used tile
+  slot = 0;
+  for(uint16_t candidate = 1; candidate < m_num_slots; ++candidate)
+  {
+    if(m_slots[candidate].last_used < m_slots[slot].last_used) slot = candidate;
+  }
+
+  s_slot &s = m_slots[slot];
+  if(s.tile != no_slot) m_tile_slots[s.tile] = no_slot;
+  const s_catalog_tile &t = m_tiles[idx];
+  s.tile = idx;
+  s.count = std::min<uint32_t>(t.count, m_slot_capacity);
+  s.last_used = m_clock;
+  m_tile_slots[idx] = slot;
+  file_seek(t.offset);
+  file_read(m_slot_stars + slot*m_slot_capacity, sizeof(s_catalog_star), s.count);
+  return slot;
+}
+
+const s_catalog_star *c_star_catalog :: read_tile(uint16_t idx, uint32_t first, uint32_t &count)
+{
+  const s_catalog_tile &t = m_tiles[idx];
+  if(first >= t.count)
+  {
+    count = 0;
+    return nullptr;
+  }
+
+  if(m_mapped)
+  {
+    count = t.count - first;
+    return (const s_catalog_star*)(m_mapped + t.offset) + first;
+  }
+
+  //the brightest stars of the tile come from its slot
+  if(first < m_slot_capacity)
+  {
+    const uint16_t slot = load_slot(idx);
+    count = m_slots[slot].count - first;
+    return m_slot_stars + slot*m_slot_capacity + first;
+  }
+
+  //and the rest straight from the file
+  count = std::min<uint32_t>(t.count - first, stream_size);
+  file_seek(t.offset + first*sizeof(s_catalog_star));
+  file_read(m_stream, sizeof(s_catalog_star), count);
+  m_stars_streamed += count;
+  return m_stream;
+}
@@ -0,0 +1,115 @@
+#ifndef __STAR_CATALOG_H__
+#define __STAR_CATALOG_H__
+
+#include <cstdint>
+
+//External star catalog written by model/make_star_tiles.py. The sky is
+//split into tiles, each described by a bounding cone so that tiles outside
+//the view can be skipped, and the stars in each tile are sorted brightest
+//first so that reading can stop at the limiting magnitude.
+//
+//file layout (little endian):
+//  s_catalog_header
+//  s_catalog_tile[num_tiles]
+//  s_catalog_star[num_stars], grouped by tile
+
+#pragma pack(push, 1)
+struct s_catalog_header
+{
+  char magic[4]; //"PSTC"
+  uint16_t version;
+  uint16_t num_tiles;
+  uint32_t num_stars;
+};
+
+struct s_catalog_tile
+{
+  float x, y, z; //centre of the tile, same axes as stars.cpp
+  float cos_half, sin_half; //half-angle of the cone enclosing the tile
+  uint32_t offset; //bytes from the start of the file
+  uint32_t count;
+};
+
+struct s_catalog_star
+{
+  int16_t x, y, z; //unit vector scaled by 32767
+  uint8_t mag; //(magnitude + 2) * 10
+  uint8_t mk; //colour, as s_star::mk
+};
+#pragma pack(pop)
+
+//Reads the catalog through an LRU cache of tiles. The cache holds a fixed
+//number of stars, shared out between the tiles in view by reserve(), and
+//each slot keeps the brightest stars of its tile. Fainter stars are
+//streamed from the file a chunk at a time, so dense tiles are never cut
+//short. File access is left to a derived class (LittleFS, SD card or
+//stdio), which can also map the file directly into memory to bypass the
+//cache.
+class c_star_catalog
+{
+  public:
+  c_star_catalog(uint32_t cache_size);
+  virtual ~c_star_catalog();
+  c_star_catalog(const c_star_catalog &) = delete;
+  c_star_catalog &operator=(const c_star_catalog &) = delete;
+
+  bool open(const char* filename);
+  void close();
+  bool is_open() const {return m_tiles != nullptr;}
+
+  uint16_t num_tiles() const {return m_num_tiles;}
+  const s_catalog_tile &tile(uint16_t idx) const {return m_tiles[idx];}
+
+  //give each of num_tiles tiles (the number in view) a slot, so drawing a
+  //frame never evicts a tile it has already read
+  void reserve(uint16_t num_tiles);
+
+  //stars first, first+1.. of a tile, brightest first, nullptr once there
+  //are no more. Returns as many as are at hand, call again from first+count
+  //for the rest. The stars stay valid until the next call.
+  const s_catalog_star *read_tile(uint16_t idx, uint32_t first, uint32_t &count);
+
+  //stars read past the cached part of their tile
+  uint32_t stars_streamed() const {return m_stars_streamed;}
+
+  static float magnitude(const s_catalog_star &star){return star.mag*0.1f - 2.0f;}
+
+  private:
+  static const uint16_t stream_size = 64;
+  static const uint16_t no_slot = 0xffff;
+
+  struct s_slot
+  {
+    uint16_t tile;
+    uint16_t count;
+    uint32_t last_used;
+  };
+
+  uint32_t m_cache_size;
+  uint16_t m_max_slots;
+  uint16_t m_num_slots;
+  uint32_t m_slot_capacity;
+  s_slot *m_slots;
+  uint16_t *m_tile_slots;
+  s_catalog_star *m_slot_stars;
+  s_catalog_star *m_stream;
+  uint32_t m_clock;
+  uint32_t m_stars_streamed;
+
+  uint16_t m_num_tiles;
+  s_catalog_tile *m_tiles;
+  const uint8_t *m_mapped;
+
+  void partition(uint16_t num_slots);
+  uint16_t load_slot(uint16_t idx);
+
+  virtual bool file_open(const char* filename)=0;
+  virtual void file_close()=0;
+  virtual void file_read(void* data, uint32_t element_size, uint32_t num_elements)=0;
+  virtual void file_seek(uint32_t offset)=0;
+
+  //return the whole file if it can be memory mapped, otherwise nullptr
+  virtual const uint8_t *file_map(){return nullptr;}
+};
+
+#endif
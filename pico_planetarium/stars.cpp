@@ -1,9101 +0,0 @@
-
-#include "stars.h"
-const uint16_t num_stars = 9096;
-const s_star stars[num_stars] = {
-{0.0158705f, 0.7040941f, 0.7099293f, 6.7000000f, 21},
-{0.0220903f, 0.9997174f, 0.0087799f, 6.2900000f, 49},
-{0.0232109f, 0.9969248f, -0.0748482f, 4.6100000f, 50},
-{0.0241917f, 0.9724908f, 0.2316819f, 5.5100000f, 45},
-{0.0143109f, 0.5232451f, 0.8520621f, 5.9600000f, 45},
-{0.0181070f, 0.6567968f, -0.7538502f, 5.7000000f, 41},
-{0.0122332f, 0.4351203f, 0.9002892f, 5.5900000f, 19},
-{0.0252294f, 0.8740746f, 0.4851361f, 6.1300000f, 50},
-{0.0274702f, 0.9208267f, -0.3890034f, 6.1800000f, 27},
-{0.0305313f, 0.9577682f, -0.2859160f, 6.1900000f, 26},
-{0.0337331f, 0.9991100f, -0.0253240f, 6.4300000f, 18},
-{0.0315804f, 0.9299383f, -0.3663569f, 5.9400000f, 22},
-{0.0296582f, 0.8431460f, -0.5368661f, 5.6800000f, 51},
-{0.0357658f, 0.9989930f, -0.0270881f, 6.0700000f, 52},
-{0.0319767f, 0.8732671f, 0.4861913f, 2.0600000f, 18},
-{0.0358808f, 0.9915179f, -0.1249196f, 5.9900000f, 48},
-{0.0303995f, 0.8019639f, 0.5965985f, 6.1900000f, 38},
-{0.0358040f, 0.9585346f, -0.2827182f, 6.0600000f, 60},
-{0.0349346f, 0.9021887f, 0.4299246f, 6.2300000f, 50},
-{0.0072719f, 0.1784013f, 0.9839309f, 6.0100000f, 27},
-{0.0205310f, 0.5123852f, 0.8585102f, 2.2700000f, 32},
-{0.0374588f, 0.9491681f, 0.3125330f, 5.5300000f, 49},
-{0.0231799f, 0.5873555f, -0.8089970f, 6.3300000f, 44},
-{0.0366542f, 0.8979527f, -0.4385629f, 5.4200000f, 32},
-{0.0294062f, 0.7156676f, -0.6978217f, 3.8800000f, 50},
-{0.0429606f, 0.9801983f, 0.1933021f, 5.5100000f, 19},
-{0.0312337f, 0.6930476f, 0.7202149f, 5.0300000f, 32},
-{0.0248209f, 0.5416450f, 0.8402408f, 6.7400000f, 17},
-{0.0448306f, 0.9955546f, -0.0828324f, 5.8400000f, 51},
-{0.0062612f, 0.1429045f, -0.9897167f, 5.2800000f, 48},
-{0.0458036f, 0.9791314f, -0.1979995f, 5.8500000f, 50},
-{0.0137468f, 0.2957963f, -0.9551521f, 6.6400000f, 32},
-{0.0475612f, 0.9668388f, -0.2509197f, 4.8900000f, 37},
-{0.0452906f, 0.8961124f, -0.4415102f, 5.4100000f, 55},
-{0.0419873f, 0.8194068f, -0.5716726f, 5.2500000f, 34},
-{0.0348723f, 0.6662382f, 0.7449232f, 6.1600000f, 54},
-{0.0509909f, 0.9596107f, -0.2766718f, 5.2500000f, 55},
-{0.0443092f, 0.7900531f, 0.6114350f, 6.7300000f, 12},
-{0.0557087f, 0.9634823f, 0.2619131f, 2.8300000f, 12},
-{0.0520721f, 0.8895850f, 0.4537918f, 6.3000000f, 40},
-{0.0444504f, 0.7529946f, 0.6565236f, 5.7200000f, 30},
-{0.0537122f, 0.8973558f, -0.4380269f, 5.9400000f, 55},
-{0.0539691f, 0.8993435f, -0.4338993f, 6.3100000f, 55},
-{0.0512194f, 0.8351367f, 0.5476525f, 6.2500000f, 21},
-{0.0597569f, 0.9365484f, 0.3454074f, 4.8000000f, 62},
-{0.0626807f, 0.9921362f, -0.1083367f, 5.1200000f, 63},
-{0.0070749f, 0.1215626f, -0.9925586f, 5.7700000f, 60},
-{0.0610244f, 0.9540113f, -0.2934935f, 4.4400000f, 63},
-{0.0602566f, 0.9233505f, 0.3792005f, 6.2400000f, 21},
-{0.0645435f, 0.9860626f, 0.1533452f, 5.7900000f, 30},
-{0.0643016f, 0.9871029f, -0.1466058f, 5.7500000f, 19},
-{0.0561769f, 0.8504599f, 0.5230317f, 6.4500000f, 55},
-{0.0588108f, 0.8868049f, 0.4583867f, 6.3500000f, 21},
-{0.0546828f, 0.8359745f, -0.5460370f, 6.1700000f, 53},
-{0.0159794f, 0.2252209f, 0.9741767f, 6.3500000f, 18},
-{0.0516549f, 0.7223909f, 0.6895528f, 6.1500000f, 22},
-{0.0606270f, 0.8590171f, -0.5083444f, 5.6700000f, 55},
-{0.0190283f, 0.2734892f, -0.9616868f, 6.4900000f, 48},
-{0.0714844f, 0.9870914f, 0.1433199f, 6.1100000f, 48},
-{0.0352234f, 0.4753442f, 0.8790946f, 5.7400000f, 48},
-{0.0685376f, 0.9384437f, -0.3385646f, 6.4700000f, 18},
-{0.0500807f, 0.6679364f, 0.7425314f, 5.8900000f, 17},
-{0.0581627f, 0.7784606f, 0.6249929f, 4.6100000f, 22},
-{0.0162176f, 0.2206223f, -0.9752245f, 6.7700000f, 33},
-{0.0481453f, 0.6215668f, 0.7818803f, 6.1400000f, 9},
-{0.0723283f, 0.9430390f, -0.3247246f, 6.4500000f, 34},
-{0.0775336f, 0.9965540f, 0.0294724f, 6.1700000f, 50},
-{0.0639805f, 0.7983256f, 0.5988178f, 4.5200000f, 22},
-{0.0781864f, 0.9778144f, 0.1943342f, 6.0500000f, 50},
-{0.0588401f, 0.7194655f, 0.6920312f, 6.1100000f, 18},
-{0.0692519f, 0.8496656f, 0.5227548f, 5.8700000f, 20},
-{0.0807065f, 0.9871020f, -0.1382609f, 6.4600000f, 40},
-{0.0598677f, 0.7317030f, -0.6789894f, 6.3300000f, 52},
-{0.0840074f, 0.9886040f, -0.1249196f, 3.5600000f, 51},
-{0.0650361f, 0.7550000f, 0.6524916f, 6.3300000f, 51},
-{0.0575816f, 0.6553068f, 0.7531649f, 6.5200000f, 20},
-{0.0395388f, 0.4503087f, -0.8919970f, 4.2300000f, 39},
-{0.0762734f, 0.8543456f, 0.5140778f, 5.9000000f, 17},
-{0.0759351f, 0.8360706f, 0.5433413f, 5.7900000f, 55},
-{0.0888408f, 0.9858054f, 0.1424610f, 5.3700000f, 53},
-{0.0894365f, 0.9776214f, 0.1904140f, 6.5600000f, 20},
-{0.0725519f, 0.7850023f, 0.6152297f, 5.1800000f, 35},
-{0.0331606f, 0.3670353f, -0.9296158f, 5.5100000f, 19},
-{0.0835279f, 0.8869367f, -0.4542756f, 5.1800000f, 45},
-{0.0891663f, 0.9357986f, -0.3410724f, 5.1200000f, 65},
-{0.0949992f, 0.9677897f, 0.2331484f, 6.2300000f, 53},
-{0.0217280f, 0.2311865f, -0.9726668f, 5.9700000f, 53},
-{0.0974934f, 0.9740341f, -0.2043347f, 6.3900000f, 42},
-{0.0866922f, 0.8530982f, -0.5144977f, 6.5500000f, 19},
-{0.0818301f, 0.7774739f, 0.6235689f, 7.3900000f, 36},
-{0.0650197f, 0.6119419f, 0.7882256f, 5.5700000f, 15},
-{0.0509664f, 0.4693128f, 0.8815599f, 5.4000000f, 19},
-{0.1066247f, 0.9938136f, -0.0310764f, 6.0700000f, 51},
-{0.0657246f, 0.5975569f, 0.7991283f, 5.7400000f, 19},
-{0.1105527f, 0.9932937f, 0.0338481f, 5.7700000f, 45},
-{0.0257074f, 0.2278254f, -0.9733626f, 2.8000000f, 42},
-{0.0854470f, 0.7418041f, -0.6651507f, 2.3900000f, 50},
-{0.0843538f, 0.7345686f, -0.6732707f, 3.9400000f, 27},
-{0.1159051f, 0.9932599f, 0.0008678f, 6.1900000f, 48},
-{0.1079609f, 0.9038780f, -0.4139431f, 5.9800000f, 48},
-{0.1161739f, 0.9445139f, 0.3072413f, 5.0600000f, 63},
-{0.0877871f, 0.7091273f, 0.6995941f, 5.1700000f, 22},
-{0.1019563f, 0.8325193f, -0.5445333f, 4.8100000f, 64},
-{0.1177630f, 0.9518346f, 0.2830948f, 6.0600000f, 55},
-{0.1213749f, 0.9767147f, 0.1769082f, 6.0400000f, 36},
-{0.1161955f, 0.9344800f, -0.3365201f, 6.4300000f, 40},
-{0.0974226f, 0.7810440f, -0.6168298f, 5.4300000f, 60},
-{0.1007232f, 0.7933161f, 0.6004202f, 6.2600000f, 45},
-{0.0812222f, 0.6447874f, -0.7600343f, 6.2600000f, 50},
-{0.0302093f, 0.2225797f, 0.9744464f, 6.2100000f, 50},
-{0.0660258f, 0.4959687f, 0.8658266f, 5.9400000f, 19},
-{0.1137777f, 0.8606967f, 0.4962418f, 5.2300000f, 27},
-{0.1265421f, 0.9655774f, -0.2272604f, 6.1400000f, 32},
-{0.1101535f, 0.8419502f, -0.5281914f, 6.5700000f, 54},
-{0.1306162f, 0.9907920f, -0.0356456f, 5.7200000f, 60},
-{0.1223549f, 0.9176690f, -0.3780383f, 5.1900000f, 25},
-{0.1029072f, 0.7696310f, -0.6301414f, 6.1900000f, 32},
-{0.0889667f, 0.6659985f, -0.7406287f, 5.6900000f, 32},
-{0.0544560f, 0.3946989f, 0.9171953f, 6.1800000f, 16},
-{0.1138807f, 0.8252781f, 0.5531250f, 5.8700000f, 51},
-{0.0802058f, 0.5748185f, 0.8143407f, 4.7300000f, 18},
-{0.0832497f, 0.5982864f, 0.7969460f, 5.6000000f, 52},
-{0.0928534f, 0.6731133f, -0.7336870f, 4.7700000f, 20},
-{0.0664313f, 0.4795901f, -0.8749744f, 4.3700000f, 19},
-{0.0664790f, 0.4797034f, -0.8749087f, 4.5400000f, 22},
-{0.1023613f, 0.7181797f, 0.6882878f, 6.7000000f, 21},
-{0.0472126f, 0.3224324f, 0.9454144f, 6.4200000f, 20},
-{0.0652967f, 0.4503437f, 0.8904644f, 4.1600000f, 11},
-{0.1329310f, 0.9284547f, 0.3468447f, 5.3800000f, 50},
-{0.1398500f, 0.9827395f, 0.1210994f, 5.6700000f, 19},
-{0.1255593f, 0.8774225f, 0.4629953f, 6.6700000f, 22},
-{0.1256745f, 0.8716270f, 0.4737851f, 6.3000000f, 50},
-{0.0829497f, 0.5690628f, 0.8180995f, 5.9300000f, 50},
-{0.0646838f, 0.4498476f, -0.8907599f, 5.0900000f, 20},
-{0.0590530f, 0.3902972f, 0.9187931f, 6.4800000f, 19},
-{0.1287738f, 0.8698219f, -0.4762638f, 5.5500000f, 52},
-{0.0478995f, 0.3264608f, -0.9439963f, 6.1300000f, 27},
-{0.0929980f, 0.6137737f, -0.7839855f, 5.5700000f, 33},
-{0.1476711f, 0.9616201f, 0.2312574f, 6.4000000f, 50},
-{0.1530591f, 0.9873241f, -0.0420016f, 5.2000000f, 38},
-{0.1544745f, 0.9879574f, 0.0088235f, 5.9300000f, 35},
-{0.0919260f, 0.5781393f, 0.8107432f, 5.0800000f, 17},
-{0.1519265f, 0.9616249f, 0.2284641f, 6.4100000f, 37},
-{0.0784155f, 0.4888130f, 0.8688572f, 5.7900000f, 24},
-{0.1037683f, 0.6610464f, -0.7431351f, 5.5100000f, 36},
-{0.0926107f, 0.5921317f, -0.8005019f, 6.0600000f, 50},
-{0.1403439f, 0.8778314f, 0.4579472f, 6.5000000f, 18},
-{0.1526188f, 0.9622382f, -0.2253998f, 6.4500000f, 49},
-{0.1463517f, 0.9210367f, -0.3609329f, 6.0600000f, 26},
-{0.1139859f, 0.7042245f, 0.7007675f, 5.1300000f, 55},
-{0.0946440f, 0.5815889f, 0.8079585f, 3.6600000f, 12},
-{0.1332763f, 0.8210187f, 0.5551267f, 4.3600000f, 15},
-{0.1542163f, 0.9524674f, 0.2627225f, 5.8900000f, 12},
-{0.1473015f, 0.9014898f, 0.4069625f, 6.4700000f, 52},
-{0.1322610f, 0.8043317f, 0.5792733f, 5.4800000f, 42},
-{0.0225652f, 0.1286682f, 0.9914309f, 6.4000000f, 36},
-{0.1490730f, 0.9067373f, -0.3944677f, 5.5700000f, 48},
-{0.0675609f, 0.4191805f, -0.9053857f, 6.4200000f, 52},
-{0.1626875f, 0.9851606f, 0.0546936f, 6.3900000f, 54},
-{0.0961453f, 0.5854954f, -0.8049542f, 6.4100000f, 50},
-{0.1459987f, 0.8596600f, 0.4895600f, 4.3700000f, 46},
-{0.1107726f, 0.6418897f, 0.7587536f, 5.4300000f, 57},
-{0.1465842f, 0.8458077f, 0.5129546f, 3.2700000f, 53},
-{0.1592905f, 0.9182912f, 0.3624471f, 5.8700000f, 50},
-{0.1613404f, 0.9167220f, 0.3654996f, 5.3600000f, 50},
-{0.0969530f, 0.5428045f, 0.8342442f, 2.2300000f, 50},
-{0.0494952f, 0.2904745f, -0.9556018f, 6.8500000f, 21},
-{0.1470729f, 0.8348375f, -0.5304865f, 6.6900000f, 38},
-{0.1261595f, 0.7179283f, -0.6845895f, 6.0100000f, 51},
-{0.1693199f, 0.9487184f, -0.2669534f, 6.4900000f, 45},
-{0.1629620f, 0.9114461f, -0.3777690f, 6.1400000f, 43},
-{0.1763259f, 0.9822732f, -0.0636276f, 5.9100000f, 50},
-{0.1377851f, 0.7596899f, 0.6355207f, 5.3300000f, 48},
-{0.0915996f, 0.5137179f, -0.8530553f, 5.8900000f, 41},
-{0.0737913f, 0.3975938f, 0.9145895f, 5.8300000f, 49},
-{0.1640963f, 0.8940902f, 0.4167436f, 6.0400000f, 27},
-{0.1160627f, 0.6252286f, 0.7717633f, 4.8000000f, 12},
-{0.1247754f, 0.6844443f, -0.7183085f, 4.5900000f, 48},
-{0.0956831f, 0.5098223f, 0.8549421f, 6.1700000f, 19},
-{0.1026728f, 0.5570471f, -0.8241097f, 5.7000000f, 20},
-{0.1285185f, 0.6694582f, 0.7316479f, 4.9400000f, 25},
-{0.1469379f, 0.7792307f, -0.6092690f, 6.0600000f, 20},
-{0.0933457f, 0.4952421f, -0.8637256f, 5.9800000f, 55},
-{0.0792358f, 0.4226445f, -0.9028252f, 5.3900000f, 36},
-{0.1817169f, 0.9438642f, -0.2758610f, 2.0400000f, 49},
-{0.1292761f, 0.6583174f, 0.7415564f, 5.6700000f, 15},
-{0.1859631f, 0.9603506f, -0.2077125f, 6.0200000f, 52},
-{0.1036843f, 0.5415631f, -0.8342415f, 4.3600000f, 20},
-{0.0512527f, 0.2538991f, 0.9658718f, 5.6600000f, 22},
-{0.1290363f, 0.6528022f, 0.7464575f, 4.5400000f, 15},
-{0.1890548f, 0.9683161f, -0.1631633f, 4.7600000f, 50},
-{0.1519045f, 0.7778261f, -0.6098455f, 5.9000000f, 51},
-{0.1119798f, 0.5593032f, 0.8213650f, 5.4200000f, 22},
-{0.1798606f, 0.9096121f, -0.3745077f, 5.2400000f, 31},
-{0.1463566f, 0.7365960f, -0.6603076f, 5.9400000f, 30},
-{0.0921396f, 0.4681434f, -0.8788356f, 6.0700000f, 35},
-{0.0713711f, 0.3457777f, 0.9355982f, 6.3300000f, 33},
-{0.1964684f, 0.9787456f, -0.0587982f, 6.1500000f, 60},
-{0.1193434f, 0.5999799f, -0.7910634f, 6.1500000f, 37},
-{0.1934363f, 0.9619726f, -0.1928502f, 6.1500000f, 40},
-{0.1140934f, 0.5576519f, 0.8221965f, 6.5200000f, 22},
-{0.1418656f, 0.6944734f, 0.7053941f, 6.0500000f, 19},
-{0.1907900f, 0.9441926f, -0.2685135f, 6.4700000f, 31},
-{0.1024933f, 0.4959382f, 0.8622879f, 6.3900000f, 40},
-{0.0540874f, 0.2557319f, 0.9652335f, 5.4100000f, 18},
-{0.1366591f, 0.6753198f, -0.7247534f, 5.8000000f, 41},
-{0.1863058f, 0.9117171f, -0.3661448f, 5.5000000f, 43},
-{0.1944056f, 0.9439331f, 0.2668272f, 5.3800000f, 64},
-{0.0621071f, 0.2912429f, 0.9546310f, 5.8700000f, 50},
-{0.1993154f, 0.9577219f, 0.2074659f, 5.5000000f, 48},
-{0.1927796f, 0.9222478f, 0.3351044f, 6.1300000f, 30},
-{0.1869651f, 0.8922606f, 0.4109929f, 4.0600000f, 51},
-{0.2039024f, 0.9719291f, 0.1173785f, 5.9900000f, 48},
-{0.1938538f, 0.9137092f, 0.3571501f, 6.5400000f, 38},
-{0.1966742f, 0.9308365f, -0.3079978f, 5.7000000f, 53},
-{0.1132419f, 0.5204654f, 0.8463404f, 3.4400000f, 39},
-{0.1950998f, 0.9175114f, -0.3465673f, 5.5700000f, 19},
-{0.2074540f, 0.9699574f, 0.1270646f, 5.9300000f, 48},
-{0.2086581f, 0.9736487f, 0.0920327f, 5.7500000f, 52},
-{0.1331758f, 0.6155071f, 0.7767980f, 4.8900000f, 19},
-{0.2089825f, 0.9689701f, 0.1319969f, 4.4300000f, 54},
-{0.2028824f, 0.9348459f, 0.2913794f, 5.0700000f, 38},
-{0.1625539f, 0.7360700f, 0.6570975f, 4.5300000f, 15},
-{0.2089735f, 0.9539055f, -0.2153934f, 5.5900000f, 55},
-{0.1949421f, 0.8934921f, -0.4045609f, 5.9000000f, 52},
-{0.1490738f, 0.6873880f, -0.7108268f, 6.2700000f, 48},
-{0.1911626f, 0.8644206f, 0.4650094f, 7.0000000f, 34},
-{0.1911888f, 0.8644195f, 0.4650009f, 7.1000000f, 35},
-{0.1980202f, 0.9014600f, -0.3849129f, 6.2800000f, 23},
-{0.0953842f, 0.4238852f, 0.9006793f, 5.3900000f, 40},
-{0.1539585f, 0.6901145f, 0.7071342f, 6.1500000f, 20},
-{0.2140930f, 0.9631917f, -0.1625606f, 5.1900000f, 37},
-{0.0612542f, 0.2845740f, -0.9566951f, 5.0700000f, 55},
-{0.1048204f, 0.4606866f, 0.8813516f, 6.0700000f, 52},
-{0.1372483f, 0.6070835f, 0.7826957f, 6.3900000f, 32},
-{0.1595004f, 0.7185449f, -0.6769438f, 6.4800000f, 29},
-{0.0259991f, 0.1064809f, 0.9939748f, 5.6200000f, 24},
-{0.1386582f, 0.6058790f, 0.7833802f, 6.2100000f, 19},
-{0.1438779f, 0.6399117f, -0.7548591f, 5.2200000f, 32},
-{0.2216079f, 0.9733466f, 0.0590450f, 6.3700000f, 50},
-{0.1108240f, 0.4700246f, 0.8756683f, 4.8200000f, 38},
-{0.1659909f, 0.7208748f, -0.6728942f, 6.9000000f, 32},
-{0.1788876f, 0.7613461f, 0.6231784f, 6.6900000f, 22},
-{0.2081397f, 0.8895610f, -0.4066436f, 5.4600000f, 52},
-{0.2292102f, 0.9732623f, -0.0149366f, 4.7700000f, 60},
-{0.1836213f, 0.7727054f, 0.6076262f, 6.0600000f, 53},
-{0.1409687f, 0.5895185f, 0.7953589f, 6.2700000f, 25},
-{0.2114364f, 0.8943226f, -0.3943117f, 6.4600000f, 36},
-{0.0830921f, 0.3570319f, -0.9303891f, 6.2200000f, 37},
-{0.1225177f, 0.5006728f, 0.8569225f, 4.8300000f, 52},
-{0.2228260f, 0.9177809f, 0.3286743f, 5.7400000f, 21},
-{0.2328086f, 0.9642789f, -0.1263577f, 6.1600000f, 45},
-{0.1571823f, 0.6413004f, 0.7510177f, 6.2700000f, 62},
-{0.1119633f, 0.4696847f, -0.8757057f, 5.7000000f, 64},
-{0.2176300f, 0.8899409f, 0.4008021f, 5.4700000f, 51},
-{0.2171312f, 0.8832513f, 0.4155974f, 6.2000000f, 64},
-{0.1286934f, 0.5141058f, 0.8480173f, 6.2100000f, 53},
-{0.0889985f, 0.3509029f, 0.9321729f, 6.3700000f, 34},
-{0.2150569f, 0.8629472f, 0.4572445f, 6.0900000f, 25},
-{0.2390592f, 0.9640690f, -0.1158521f, 5.8500000f, 55},
-{0.1197972f, 0.4742316f, 0.8722116f, 2.4700000f, 10},
-{0.1253812f, 0.4967469f, 0.8587910f, 4.6300000f, 48},
-{0.1212748f, 0.4794051f, 0.8691739f, 5.5500000f, 19},
-{0.2377934f, 0.9532941f, -0.1862382f, 5.3100000f, 54},
-{0.2167360f, 0.8704941f, -0.4418886f, 6.1000000f, 60},
-{0.1918265f, 0.7587408f, 0.6225070f, 3.8700000f, 25},
-{0.0872239f, 0.3564211f, -0.9302451f, 5.4500000f, 52},
-{0.2266804f, 0.8891945f, 0.3974282f, 4.4200000f, 48},
-{0.1734358f, 0.6747342f, 0.7173938f, 6.1200000f, 52},
-{0.1013087f, 0.3881085f, 0.9160286f, 5.9700000f, 20},
-{0.2184002f, 0.8469806f, 0.4846909f, 5.4200000f, 46},
-{0.2085237f, 0.8028801f, 0.5584813f, 5.9800000f, 50},
-{0.2428845f, 0.9407169f, 0.2367675f, 6.3200000f, 48},
-{0.2343493f, 0.9010508f, 0.3649490f, 6.3700000f, 22},
-{0.0850449f, 0.3145538f, 0.9454223f, 6.3900000f, 24},
-{0.2491279f, 0.9507738f, -0.1842944f, 5.6100000f, 47},
-{0.2219888f, 0.8490885f, -0.4793430f, 4.3100000f, 17},
-{0.1286211f, 0.4940196f, -0.8598844f, 6.2300000f, 20},
-{0.1841029f, 0.6864023f, 0.7035325f, 6.8400000f, 22},
-{0.1841058f, 0.6863733f, 0.7035601f, 6.0400000f, 19},
-{0.2564450f, 0.9599414f, 0.1129094f, 6.1100000f, 62},
-{0.0192895f, 0.0623673f, 0.9978668f, 4.2500000f, 52},
-{0.0068399f, 0.0157607f, 0.9998524f, 6.4600000f, 23},
-{0.1688624f, 0.6057493f, 0.7775302f, 6.4700000f, 23},
-{0.2108597f, 0.7693882f, -0.6029760f, 5.5900000f, 50},
-{0.1838859f, 0.6517381f, 0.7358148f, 6.4500000f, 29},
-{0.2034832f, 0.7226434f, 0.6605915f, 5.9800000f, 25},
-{0.2300357f, 0.8181269f, 0.5270217f, 5.5000000f, 19},
-{0.1325381f, 0.4651503f, 0.8752536f, 5.9200000f, 30},
-{0.2319777f, 0.8302913f, -0.5067570f, 5.5000000f, 22},
-{0.2686351f, 0.9534105f, 0.1372717f, 4.2800000f, 50},
-{0.1456269f, 0.5248470f, -0.8386468f, 6.1100000f, 48},
-{0.2712085f, 0.9609375f, -0.0551825f, 5.4300000f, 50},
-{0.1318352f, 0.4573029f, 0.8794848f, 5.8400000f, 36},
-{0.1678910f, 0.5851202f, 0.7933770f, 5.9900000f, 52},
-{0.1893796f, 0.6735136f, -0.7145032f, 5.3600000f, 48},
-{0.2396875f, 0.8457230f, -0.4767625f, 6.2900000f, 45},
-{0.2747901f, 0.9612084f, 0.0238506f, 6.0400000f, 31},
-{0.1754842f, 0.6042175f, 0.7772558f, 6.5400000f, 13},
-{0.2412020f, 0.8348436f, 0.4948311f, 6.1900000f, 37},
-{0.1161559f, 0.4138269f, -0.9029148f, 6.2100000f, 62},
-{0.2131267f, 0.7359034f, 0.6426688f, 6.7200000f, 30},
-{0.0162607f, 0.0470744f, 0.9987590f, 6.2500000f, 52},
-{0.2779523f, 0.9555250f, 0.0985623f, 6.0000000f, 55},
-{0.2707263f, 0.9274640f, 0.2579104f, 5.6800000f, 34},
-{0.1307193f, 0.4386288f, 0.8891104f, 6.5400000f, 25},
-{0.2630617f, 0.8926324f, 0.3660682f, 5.3400000f, 21},
-{0.2631282f, 0.8926665f, 0.3659373f, 5.5600000f, 20},
-{0.0515826f, 0.1655999f, 0.9848431f, 6.2900000f, 46},
-{0.2822234f, 0.9555256f, 0.0855618f, 6.3500000f, 33},
-{0.2823758f, 0.9554788f, 0.0855812f, 7.2500000f, 36},
-{0.2796347f, 0.9499131f, -0.1395332f, 6.1200000f, 50},
-{0.1572446f, 0.5224392f, 0.8380522f, 6.4300000f, 52},
-{0.2814914f, 0.9490066f, -0.1419475f, 5.5800000f, 21},
-{0.1718259f, 0.5694891f, 0.8038396f, 6.3800000f, 52},
-{0.2790673f, 0.9337311f, 0.2242046f, 6.1200000f, 48},
-{0.2638183f, 0.8888076f, -0.3747280f, 6.1400000f, 48},
-{0.1686860f, 0.5494025f, 0.8183532f, 5.1700000f, 45},
-{0.2000857f, 0.6745774f, -0.7105710f, 3.3100000f, 48},
-{0.2360404f, 0.7912564f, -0.5640906f, 6.6100000f, 21},
-{0.2105654f, 0.6885671f, 0.6939291f, 5.0300000f, 23},
-{0.2680498f, 0.8875671f, -0.3746650f, 6.3700000f, 27},
-{0.1550087f, 0.5026538f, 0.8504772f, 5.7900000f, 18},
-{0.2479889f, 0.8108609f, 0.5301002f, 6.2500000f, 35},
-{0.2732445f, 0.8943940f, 0.3541142f, 5.5500000f, 23},
-{0.2884220f, 0.9467832f, -0.1428785f, 5.8200000f, 37},
-{0.2924875f, 0.9511884f, 0.0984465f, 5.5200000f, 30},
-{0.2216381f, 0.7272336f, -0.6496213f, 5.2100000f, 23},
-{0.1437647f, 0.4753344f, -0.8679798f, 5.3700000f, 45},
-{0.0555985f, 0.1704100f, 0.9838035f, 5.6400000f, 23},
-{0.2905148f, 0.9415549f, -0.1705152f, 3.4500000f, 51},
-{0.2027467f, 0.6479231f, 0.7342271f, 4.2500000f, 17},
-{0.1098334f, 0.3449069f, 0.9321887f, 5.2900000f, 20},
-{0.2435334f, 0.7755544f, 0.5824146f, 2.0600000f, 60},
-{0.1696504f, 0.5515857f, -0.8166835f, 3.9200000f, 16},
-{0.2824733f, 0.8983506f, 0.3364151f, 5.5500000f, 40},
-{0.2241494f, 0.7075368f, 0.6701856f, 5.6500000f, 38},
-{0.2727225f, 0.8607293f, 0.4298458f, 5.8000000f, 57},
-{0.1334445f, 0.4142230f, 0.9003399f, 5.5500000f, 19},
-{0.1744552f, 0.5441527f, 0.8206481f, 4.3300000f, 27},
-{0.2902915f, 0.9180093f, 0.2701664f, 6.0600000f, 60},
-{0.1299605f, 0.4018258f, 0.9064471f, 5.5700000f, 19},
-{0.2992297f, 0.9461556f, -0.1234956f, 6.4000000f, 50},
-{0.3027593f, 0.9521114f, 0.0426700f, 5.9500000f, 54},
-{0.2417013f, 0.7531314f, 0.6118607f, 5.8100000f, 17},
-{0.2605505f, 0.8125753f, 0.5213779f, 5.1600000f, 30},
-{0.1671054f, 0.5289977f, -0.8320079f, 6.4100000f, 46},
-{0.2863069f, 0.8883665f, 0.3589336f, 4.6600000f, 48},
-{0.2661532f, 0.8232892f, 0.5013555f, 4.5100000f, 50},
-{0.3077322f, 0.9509834f, -0.0305191f, 5.9400000f, 54},
-{0.1487632f, 0.4500490f, 0.8805256f, 6.4100000f, 19},
-{0.2188683f, 0.6679831f, 0.7112631f, 6.1100000f, 61},
-{0.2710024f, 0.8219411f, 0.5009696f, 6.1900000f, 49},
-{0.0574076f, 0.1655223f, 0.9845338f, 6.2600000f, 35},
-{0.2711660f, 0.8297560f, -0.4878258f, 6.5200000f, 37},
-{0.2520783f, 0.7671892f, -0.5898112f, 5.9200000f, 30},
-{0.2875955f, 0.8626793f, 0.4160207f, 4.6500000f, 50},
-{0.3134345f, 0.9404148f, 0.1318287f, 5.2400000f, 27},
-{0.3135281f, 0.9403762f, 0.1318815f, 6.3000000f, 37},
-{0.2790771f, 0.8330668f, 0.4776146f, 6.4300000f, 33},
-{0.3053115f, 0.9108066f, 0.2778782f, 5.9800000f, 18},
-{0.1022497f, 0.2961081f, 0.9496657f, 7.8300000f, 51},
-{0.3171670f, 0.9424425f, -0.1058639f, 5.1300000f, 35},
-{0.3178435f, 0.9402889f, 0.1217875f, 6.0300000f, 46},
-{0.3206493f, 0.9470455f, 0.0169967f, 5.7000000f, 35},
-{0.2186253f, 0.6312779f, 0.7441043f, 6.6100000f, 19},
-{0.2299356f, 0.6755765f, -0.7005184f, 4.9600000f, 38},
-{0.2737713f, 0.7915724f, 0.5463172f, 6.0200000f, 51},
-{0.2337731f, 0.6686266f, 0.7058956f, 6.3400000f, 55},
-{0.3279506f, 0.9443323f, -0.0261721f, 5.4100000f, 45},
-{0.2817758f, 0.8023613f, 0.5261356f, 6.7300000f, 50},
-{0.0739022f, 0.2021522f, 0.9765618f, 6.3100000f, 45},
-{0.2263343f, 0.6376448f, 0.7363300f, 6.2500000f, 50},
-{0.1261897f, 0.3676885f, -0.9213476f, 4.8600000f, 36},
-{0.3323218f, 0.9410568f, 0.0630421f, 5.1600000f, 23},
-{0.2677886f, 0.7480760f, 0.6071833f, 6.4600000f, 25},
-{0.1362886f, 0.3899425f, -0.9106977f, 6.2400000f, 20},
-{0.0832907f, 0.2228157f, 0.9712960f, 6.3800000f, 30},
-{0.1802451f, 0.4946708f, 0.8501838f, 4.9800000f, 30},
-{0.3020784f, 0.8360017f, 0.4580937f, 4.7600000f, 23},
-{0.1482952f, 0.4015041f, 0.9037715f, 6.3400000f, 22},
-{0.3412070f, 0.9399462f, 0.0088817f, 5.8700000f, 48},
-{0.0698871f, 0.1825859f, 0.9807029f, 6.0700000f, 20},
-{0.3439792f, 0.9377480f, -0.0480314f, 6.2300000f, 51},
-{0.3378711f, 0.9224862f, -0.1867146f, 6.1500000f, 51},
-{0.3039274f, 0.8224681f, 0.4808060f, 5.2300000f, 55},
-{0.2463108f, 0.6558206f, 0.7136038f, 4.8800000f, 50},
-{0.1877699f, 0.4932702f, 0.8493685f, 6.4500000f, 34},
-{0.3525663f, 0.9353018f, 0.0301266f, 6.2000000f, 55},
-{0.3525659f, 0.9357541f, 0.0078491f, 6.4900000f, 50},
-{0.3332537f, 0.8853363f, -0.3242247f, 6.3500000f, 36},
-{0.2824496f, 0.7389205f, 0.6117342f, 5.5800000f, 22},
-{0.2949748f, 0.7722099f, 0.5627448f, 6.2900000f, 48},
-{0.3335078f, 0.8754904f, 0.3496987f, 5.9700000f, 55},
-{0.1191443f, 0.3033385f, 0.9454049f, 6.4900000f, 20},
-{0.1364216f, 0.3466220f, 0.9280314f, 4.7400000f, 50},
-{0.3115486f, 0.8167562f, -0.4856405f, 5.8400000f, 55},
-{0.3550549f, 0.9244474f, -0.1390435f, 6.2100000f, 30},
-{0.3551323f, 0.9248697f, -0.1360038f, 3.6000000f, 50},
-{0.1815762f, 0.4620415f, 0.8680713f, 2.6800000f, 25},
-{0.3583500f, 0.9293699f, -0.0886384f, 5.9100000f, 33},
-{0.3498192f, 0.9034853f, -0.2476708f, 6.1400000f, 45},
-{0.3615990f, 0.9321172f, -0.0200942f, 6.1500000f, 48},
-{0.3345657f, 0.8537658f, 0.3989358f, 6.1800000f, 35},
-{0.2745795f, 0.7090092f, -0.6495476f, 5.4200000f, 50},
-{0.2669497f, 0.6750124f, 0.6878198f, 5.9600000f, 37},
-{0.3022387f, 0.7658564f, 0.5675524f, 6.3100000f, 37},
-{0.2621361f, 0.6767174f, -0.6879958f, 6.2600000f, 51},
-{0.3550207f, 0.9056735f, -0.2317668f, 4.9000000f, 52},
-{0.3471511f, 0.8784269f, 0.3284088f, 5.3800000f, 32},
-{0.3486926f, 0.8773957f, 0.3295304f, 5.5000000f, 51},
-{0.3061797f, 0.7664413f, 0.5646429f, 6.2700000f, 37},
-{0.3683388f, 0.9296656f, 0.0069570f, 6.4100000f, 50},
-{0.2620247f, 0.6513414f, 0.7121077f, 4.8300000f, 35},
-{0.2805895f, 0.6993695f, 0.6573826f, 6.4600000f, 27},
-{0.3694140f, 0.9272168f, 0.0616631f, 6.5800000f, 19},
-{0.1611391f, 0.4138962f, -0.8959488f, 5.9300000f, 55},
-{0.3605893f, 0.9054309f, -0.2239873f, 5.6600000f, 30},
-{0.2848819f, 0.7070311f, 0.6472629f, 6.6000000f, 20},
-{0.3159881f, 0.7923485f, -0.5218577f, 5.7900000f, 36},
-{0.0078982f, 0.0101264f, 0.9999175f, 2.0200000f, 37},
-{0.3690011f, 0.9158784f, -0.1581293f, 6.1300000f, 54},
-{0.3725247f, 0.9176282f, 0.1385057f, 6.2000000f, 51},
-{0.1308950f, 0.3112729f, 0.9412628f, 5.8100000f, 36},
-{0.1564754f, 0.3737383f, 0.9142402f, 6.1400000f, 22},
-{0.2764703f, 0.6811627f, -0.6779245f, 3.4100000f, 60},
-{0.2612382f, 0.6298814f, 0.7314397f, 5.2700000f, 50},
-{0.3193307f, 0.7832610f, -0.5334136f, 6.5800000f, 30},
-{0.3627599f, 0.8770605f, 0.3149129f, 6.0200000f, 24},
-{0.3572449f, 0.8667232f, -0.3480903f, 5.1200000f, 21},
-{0.3812268f, 0.9182656f, 0.1070257f, 4.8400000f, 54},
-{0.2680442f, 0.6510764f, -0.7101069f, 6.3100000f, 62},
-{0.3459445f, 0.8312657f, -0.4351089f, 5.9300000f, 54},
-{0.3747979f, 0.8885324f, 0.2646446f, 3.6200000f, 47},
-{0.3212663f, 0.7556944f, 0.5707136f, 6.3900000f, 17},
-{0.2081703f, 0.4820338f, 0.8510632f, 5.7000000f, 50},
-{0.2547409f, 0.6056225f, -0.7538756f, 3.9500000f, 50},
-{0.3383739f, 0.7998584f, -0.4957113f, 5.8200000f, 50},
-{0.2038457f, 0.4691956f, 0.8592452f, 4.7100000f, 49},
-{0.2780506f, 0.6578241f, -0.6999681f, 6.1700000f, 22},
-{0.3901307f, 0.9074170f, -0.1561807f, 6.5900000f, 20},
-{0.3226034f, 0.7514823f, -0.5755010f, 5.5100000f, 50},
-{0.3183400f, 0.7297217f, 0.6051165f, 5.8800000f, 19},
-{0.2616841f, 0.6119922f, -0.7463156f, 6.2800000f, 34},
-{0.3946660f, 0.9107652f, -0.1214314f, 5.7600000f, 42},
-{0.1115385f, 0.2465283f, 0.9626957f, 6.5800000f, 19},
-{0.3813338f, 0.8685138f, 0.3166517f, 5.8900000f, 62},
-{0.3887941f, 0.8874857f, -0.2474030f, 5.6300000f, 23},
-{0.3062364f, 0.6888290f, 0.6570647f, 6.3800000f, 51},
-{0.3478738f, 0.7920562f, -0.5016282f, 6.1200000f, 50},
-{0.2695169f, 0.6021367f, 0.7515265f, 5.9200000f, 51},
-{0.3926184f, 0.8841878f, 0.2531061f, 6.2200000f, 19},
-{0.1215638f, 0.2651669f, 0.9565086f, 5.2800000f, 48},
-{0.3877235f, 0.8717282f, 0.2996005f, 5.8000000f, 30},
-{0.3074516f, 0.6841374f, 0.6613846f, 4.0900000f, 38},
-{0.3935390f, 0.8840761f, -0.2520647f, 5.4200000f, 52},
-{0.2147920f, 0.4866918f, -0.8467559f, 6.0100000f, 32},
-{0.2201587f, 0.4823874f, 0.8478399f, 5.5600000f, 45},
-{0.3593106f, 0.8057000f, -0.4708964f, 5.6900000f, 32},
-{0.4019137f, 0.8911941f, 0.2103296f, 5.5700000f, 30},
-{0.2740702f, 0.6014385f, 0.7504380f, 3.5700000f, 53},
-{0.2926503f, 0.6382591f, 0.7120260f, 6.3600000f, 19},
-{0.4085752f, 0.9004030f, -0.1494682f, 6.2400000f, 37},
-{0.0860367f, 0.1986923f, -0.9762782f, 6.1100000f, 50},
-{0.2187536f, 0.4870519f, -0.8455337f, 6.1800000f, 63},
-{0.3001827f, 0.6485398f, 0.6994901f, 4.9800000f, 48},
-{0.2497028f, 0.5341603f, 0.8076641f, 6.3900000f, 55},
-{0.3392032f, 0.7404004f, -0.5803003f, 5.9400000f, 50},
-{0.2266724f, 0.4990308f, -0.8364137f, 0.4600000f, 13},
-{0.3910623f, 0.8496119f, -0.3538784f, 5.5800000f, 24},
-{0.3789036f, 0.8234799f, -0.4222711f, 6.7000000f, 19},
-{0.4041971f, 0.8699729f, 0.2824391f, 5.9700000f, 52},
-{0.3094891f, 0.6587172f, 0.6857901f, 5.6100000f, 29},
-{0.3227336f, 0.6875562f, 0.6504686f, 4.9400000f, 18},
-{0.1614752f, 0.3372451f, 0.9274651f, 5.5900000f, 20},
-{0.2540357f, 0.5522920f, -0.7940022f, 6.8400000f, 35},
-{0.1440558f, 0.2988863f, 0.9433530f, 5.1800000f, 19},
-{0.2085593f, 0.4370083f, 0.8749439f, 6.7100000f, 18},
-{0.2247303f, 0.4695916f, 0.8538033f, 6.3700000f, 18},
-{0.3162103f, 0.6645399f, 0.6770508f, 4.9500000f, 41},
-{0.3853129f, 0.8141549f, 0.4343798f, 6.1700000f, 32},
-{0.3714738f, 0.7818524f, 0.5007136f, 5.9900000f, 50},
-{0.2370680f, 0.5096125f, -0.8270996f, 5.8700000f, 50},
-{0.2370625f, 0.5095620f, -0.8271323f, 5.7600000f, 55},
-{0.2077710f, 0.4308820f, 0.8781639f, 6.3400000f, 17},
-{0.4263088f, 0.8995087f, 0.0956286f, 4.4400000f, 53},
-{0.3517801f, 0.7370395f, 0.5770818f, 5.6400000f, 19},
-{0.2142279f, 0.4425191f, 0.8707946f, 5.7800000f, 18},
-{0.4220730f, 0.8874342f, -0.1852426f, 5.7500000f, 35},
-{0.4056873f, 0.8458190f, 0.3464218f, 5.2400000f, 51},
-{0.3381666f, 0.7133416f, -0.6138299f, 6.1700000f, 32},
-{0.3062264f, 0.6329310f, 0.7110722f, 6.3400000f, 52},
-{0.2768783f, 0.5698286f, 0.7737143f, 4.0700000f, 12},
-{0.3668703f, 0.7679232f, -0.5250715f, 5.2500000f, 50},
-{0.3520916f, 0.7377612f, -0.5759687f, 5.7200000f, 21},
-{0.2359296f, 0.4821335f, 0.8437325f, 6.2100000f, 23},
-{0.4330121f, 0.9004867f, -0.0403013f, 4.9900000f, 53},
-{0.2761527f, 0.5810199f, -0.7656080f, 6.6400000f, 23},
-{0.2398174f, 0.4875434f, 0.8395171f, 6.2500000f, 22},
-{0.3704274f, 0.7608926f, 0.5327532f, 6.3400000f, 48},
-{0.3049479f, 0.6221898f, 0.7210317f, 6.3500000f, 55},
-{0.2199687f, 0.4622117f, -0.8590542f, 5.7100000f, 52},
-{0.2646868f, 0.5518979f, -0.7907905f, 5.5200000f, 39},
-{0.4373335f, 0.8975277f, -0.0564217f, 6.1900000f, 50},
-{0.4151384f, 0.8424660f, 0.3433820f, 6.2700000f, 43},
-{0.4254936f, 0.8717315f, -0.2429802f, 3.5000000f, 48},
-{0.4381702f, 0.8846903f, 0.1591537f, 4.2600000f, 48},
-{0.1996339f, 0.3928767f, 0.8976604f, 5.6300000f, 50},
-{0.0646482f, 0.1419778f, -0.9877565f, 5.8700000f, 42},
-{0.4449158f, 0.8924768f, -0.0743986f, 5.3400000f, 54},
-{0.4033137f, 0.8120550f, -0.4217876f, 5.3100000f, 31},
-{0.4279402f, 0.8528257f, 0.2992582f, 6.5500000f, 29},
-{0.0827477f, 0.1747482f, -0.9811299f, 6.3300000f, 46},
-{0.3988504f, 0.7998245f, -0.4485522f, 6.3900000f, 32},
-{0.3135184f, 0.6166442f, 0.7221192f, 6.3200000f, 36},
-{0.2918982f, 0.5848392f, -0.7568081f, 5.4900000f, 63},
-{0.2720133f, 0.5449488f, -0.7931201f, 5.0400000f, 21},
-{0.3599657f, 0.7015591f, 0.6150118f, 5.9400000f, 50},
-{0.4349315f, 0.8519311f, 0.2916298f, 5.8400000f, 19},
-{0.3843463f, 0.7487140f, 0.5400975f, 5.7900000f, 38},
-{0.3444130f, 0.6812309f, -0.6459908f, 6.1800000f, 55},
-{0.0486340f, 0.1073790f, -0.9930279f, 5.6900000f, 48},
-{0.3076693f, 0.5957050f, 0.7419401f, 5.8200000f, 23},
-{0.4547320f, 0.8883056f, 0.0642807f, 5.9100000f, 49},
-{0.3627004f, 0.7134036f, -0.5995863f, 6.3200000f, 50},
-{0.2869726f, 0.5457244f, 0.7872939f, 5.9000000f, 35},
-{0.4277972f, 0.8205519f, 0.3790569f, 5.8600000f, 51},
-{0.4540758f, 0.8761413f, -0.1618383f, 4.6700000f, 33},
-{0.3938548f, 0.7620597f, -0.5139489f, 6.3400000f, 52},
-{0.2682612f, 0.5045880f, 0.8206259f, 5.5200000f, 11},
-{0.4564871f, 0.8688657f, 0.1915514f, 5.9400000f, 32},
-{0.3652852f, 0.7031040f, -0.6100914f, 6.3700000f, 38},
-{0.2971471f, 0.5579320f, 0.7748648f, 5.7900000f, 19},
-{0.3205933f, 0.6136513f, -0.7215622f, 6.1400000f, 51},
-{0.2944447f, 0.5488686f, 0.7823334f, 6.2600000f, 23},
-{0.4607558f, 0.8715033f, -0.1678872f, 3.7300000f, 50},
-{0.2691770f, 0.4967526f, 0.8250943f, 6.4500000f, 25},
-{0.3003439f, 0.5714143f, -0.7637272f, 5.9400000f, 21},
-{0.2123107f, 0.3894257f, 0.8962543f, 3.3800000f, 13},
-{0.3595193f, 0.6670837f, 0.6524916f, 5.4000000f, 51},
-{0.4119081f, 0.7659436f, 0.4936215f, 3.4100000f, 36},
-{0.4486524f, 0.8303714f, 0.3304458f, 4.8300000f, 19},
-{0.4486585f, 0.8303826f, 0.3304092f, 4.7500000f, 21},
-{0.4565511f, 0.8508550f, -0.2600130f, 5.8000000f, 30},
-{0.1762237f, 0.3179161f, 0.9315979f, 4.9900000f, 18},
-{0.4747159f, 0.8783809f, 0.0556037f, 4.6200000f, 50},
-{0.0800582f, 0.1575052f, -0.9842676f, 6.0600000f, 30},
-{0.3643437f, 0.6648216f, 0.6521241f, 6.2400000f, 52},
-{0.3833583f, 0.6990713f, 0.6036023f, 6.2600000f, 50},
-{0.4483287f, 0.8202481f, 0.3552384f, 2.6400000f, 25},
-{0.3771656f, 0.6991079f, -0.6074490f, 6.1000000f, 51},
-{0.3323232f, 0.6143198f, -0.7156623f, 4.4100000f, 64},
-{0.3854837f, 0.6960993f, 0.6056798f, 5.8900000f, 60},
-{0.3863716f, 0.6959225f, 0.6053171f, 5.6700000f, 50},
-{0.3584065f, 0.6575915f, -0.6626600f, 5.1100000f, 23},
-{0.4438138f, 0.8018987f, 0.3999847f, 5.7400000f, 51},
-{0.4841628f, 0.8743824f, 0.0322781f, 6.0100000f, 37},
-{0.2344655f, 0.4120848f, 0.8804613f, 6.0200000f, 15},
-{0.3675238f, 0.6499932f, 0.6651580f, 6.7800000f, 18},
-{0.4664590f, 0.8299328f, 0.3059861f, 5.1000000f, 51},
-{0.4346634f, 0.7703812f, 0.4664553f, 5.8200000f, 62},
-{0.4535364f, 0.8125898f, -0.3660636f, 4.8500000f, 54},
-{0.3089859f, 0.5576643f, -0.7704143f, 3.7000000f, 48},
-{0.2137048f, 0.3715190f, 0.9034954f, 5.2600000f, 20},
-{0.3231211f, 0.5678726f, 0.7570426f, 5.6900000f, 50},
-{0.4510025f, 0.7977262f, 0.4002868f, 4.7900000f, 30},
-{0.1928268f, 0.3517134f, -0.9160325f, 4.6900000f, 48},
-{0.2482455f, 0.4488932f, -0.8584108f, 6.0600000f, 30},
-{0.1069969f, 0.1799290f, 0.9778432f, 6.0400000f, 50},
-{0.3125532f, 0.5580943f, -0.7686620f, 6.1000000f, 36},
-{0.3360683f, 0.5990709f, -0.7267545f, 4.8300000f, 48},
-{0.1659642f, 0.2818732f, 0.9449886f, 4.5400000f, 23},
-{0.4147105f, 0.7296889f, -0.5436628f, 6.3500000f, 50},
-{0.4651786f, 0.8090113f, 0.3593183f, 5.8700000f, 50},
-{0.4864328f, 0.8473721f, 0.2129404f, 6.0900000f, 26},
-{0.1423954f, 0.2389298f, 0.9605395f, 6.2300000f, 25},
-{0.1549101f, 0.2592592f, 0.9533035f, 3.9800000f, 22},
-{0.1143160f, 0.1881585f, 0.9754631f, 5.3800000f, 30},
-{0.4998481f, 0.8644262f, 0.0540304f, 5.8800000f, 42},
-{0.4714312f, 0.8184523f, -0.3284637f, 5.4100000f, 61},
-{0.2112357f, 0.3737637f, -0.9031501f, 6.3700000f, 48},
-{0.4670507f, 0.8089147f, -0.3571003f, 4.0000000f, 60},
-{0.2166855f, 0.3646559f, 0.9055791f, 6.0000000f, 21},
-{0.4974281f, 0.8576915f, -0.1301176f, 5.5100000f, 63},
-{0.3707576f, 0.6444636f, -0.6687342f, 5.5700000f, 51},
-{0.2210110f, 0.3714677f, 0.9017571f, 5.5800000f, 18},
-{0.2954777f, 0.5001151f, 0.8139888f, 5.0400000f, 18},
-{0.2444440f, 0.4286863f, -0.8697558f, 2.8600000f, 30},
-{0.1249572f, 0.2048735f, 0.9707793f, 5.2200000f, 48},
-{0.1035495f, 0.1871130f, -0.9768655f, 6.1600000f, 35},
-{0.4370879f, 0.7476492f, -0.4999748f, 5.3500000f, 45},
-{0.5071233f, 0.8605238f, 0.0482154f, 5.2300000f, 23},
-{0.5071233f, 0.8605238f, 0.0482154f, 4.3300000f, 20},
-{0.0809887f, 0.1278375f, 0.9884829f, 6.0500000f, 21},
-{0.2178737f, 0.3602191f, 0.9070685f, 6.5200000f, 20},
-{0.4273169f, 0.7184930f, 0.5487878f, 5.5000000f, 22},
-{0.2034119f, 0.3534407f, -0.9130736f, 6.1000000f, 51},
-{0.4957065f, 0.8366379f, 0.2330494f, 5.9400000f, 62},
-{0.3686522f, 0.6276829f, -0.6856454f, 5.1400000f, 55},
-{0.3804818f, 0.6338543f, 0.6733961f, 2.2600000f, 53},
-{0.3805073f, 0.6338238f, 0.6734104f, 4.8400000f, 18},
-{0.4620059f, 0.7715354f, 0.4373599f, 5.6300000f, 38},
-{0.4482778f, 0.7574808f, -0.4746260f, 6.4200000f, 23},
-{0.5120228f, 0.8589689f, 0.0022398f, 5.4300000f, 25},
-{0.4944859f, 0.8313487f, -0.2536595f, 5.8600000f, 43},
-{0.4880914f, 0.8146537f, 0.3132191f, 6.2100000f, 54},
-{0.5142933f, 0.8575938f, 0.0059389f, 5.9300000f, 45},
-{0.5126344f, 0.8559138f, -0.0679524f, 5.6200000f, 55},
-{0.4533569f, 0.7508715f, -0.4802703f, 4.6900000f, 19},
-{0.4841449f, 0.7856983f, 0.3850740f, 5.0300000f, 22},
-{0.5178493f, 0.8433590f, 0.1434494f, 6.3100000f, 62},
-{0.4735385f, 0.7665746f, 0.4337333f, 6.1500000f, 19},
-{0.5243140f, 0.8515248f, 0.0006109f, 6.2800000f, 50},
-{0.4832968f, 0.7796805f, 0.3981488f, 2.0000000f, 52},
-{0.2787909f, 0.4432484f, 0.8519428f, 5.6700000f, 21},
-{0.3797058f, 0.6043653f, 0.7004042f, 6.4200000f, 48},
-{0.4198084f, 0.6686594f, 0.6137227f, 4.8200000f, 25},
-{0.3172885f, 0.4974203f, 0.8074039f, 6.3100000f, 48},
-{0.4388211f, 0.6918495f, 0.5733937f, 3.0000000f, 25},
-{0.4812538f, 0.7596406f, 0.4374253f, 4.9800000f, 32},
-{0.5110393f, 0.8069414f, 0.2961156f, 6.4300000f, 35},
-{0.5115284f, 0.8125948f, -0.2793356f, 6.1000000f, 62},
-{0.1512292f, 0.2298891f, 0.9613952f, 6.2900000f, 48},
-{0.2904517f, 0.4494715f, 0.8447563f, 6.3600000f, 15},
-{0.4198396f, 0.6534655f, 0.6298553f, 5.6300000f, 19},
-{0.4198609f, 0.6534046f, 0.6299042f, 6.1000000f, 21},
-{0.4907412f, 0.7734336f, -0.4012152f, 6.4800000f, 34},
-{0.5086520f, 0.7936265f, 0.3338114f, 5.7000000f, 63},
-{0.3939485f, 0.6234358f, -0.6753757f, 5.8500000f, 51},
-{0.4871452f, 0.7559013f, 0.4373817f, 6.0200000f, 54},
-{0.4624289f, 0.7160616f, 0.5228912f, 6.2300000f, 21},
-{0.5362101f, 0.8308272f, 0.1490128f, 5.6300000f, 40},
-{0.3983547f, 0.6248001f, -0.6715194f, 6.3200000f, 48},
-{0.3522820f, 0.5507068f, -0.7567162f, 6.1200000f, 51},
-{0.5341779f, 0.8275332f, -0.1727505f, 6.0100000f, 35},
-{0.5431597f, 0.8396239f, -0.0030495f, 5.9300000f, 49},
-{0.2205709f, 0.3317189f, 0.9172301f, 6.0700000f, 40},
-{0.2872988f, 0.4353325f, 0.8531970f, 6.4400000f, 23},
-{0.4713979f, 0.7233184f, 0.5045737f, 4.9400000f, 45},
-{0.3934453f, 0.5988398f, 0.6975612f, 4.8300000f, 53},
-{0.4989865f, 0.7638036f, 0.4094100f, 5.9600000f, 50},
-{0.3459484f, 0.5246334f, 0.7778685f, 5.3100000f, 48},
-{0.5104745f, 0.7800743f, 0.3618008f, 5.2700000f, 35},
-{0.3731022f, 0.5634644f, 0.7370906f, 6.0600000f, 34},
-{0.5291051f, 0.8065971f, 0.2635317f, 5.7100000f, 60},
-{0.5417704f, 0.8263372f, 0.1537907f, 4.3700000f, 46},
-{0.5473176f, 0.8364554f, -0.0280331f, 5.5400000f, 38},
-{0.5119279f, 0.7807083f, -0.3583634f, 5.8600000f, 49},
-{0.4779697f, 0.7296613f, -0.4890188f, 5.2800000f, 19},
-{0.3754540f, 0.5568169f, 0.7409381f, 6.3300000f, 49},
-{0.3057986f, 0.4497087f, 0.8391956f, 6.4800000f, 11},
-{0.4668704f, 0.6925766f, 0.5498816f, 5.2800000f, 20},
-{0.5027635f, 0.7470170f, 0.4349648f, 5.7900000f, 36},
-{0.5056833f, 0.7517328f, 0.4232992f, 5.5800000f, 36},
-{0.5511094f, 0.8211301f, -0.1484040f, 6.5500000f, 20},
-{0.4190708f, 0.6299568f, -0.6538609f, 5.9100000f, 48},
-{0.4655106f, 0.6833520f, 0.5624322f, 4.8700000f, 40},
-{0.3009866f, 0.4379451f, 0.8471193f, 5.7500000f, 53},
-{0.3043357f, 0.4425009f, 0.8435477f, 5.9800000f, 47},
-{0.4041833f, 0.5905343f, 0.6985020f, 6.7000000f, 67},
-{0.4683671f, 0.6858609f, 0.5569803f, 4.0100000f, 21},
-{0.5156434f, 0.7560940f, 0.4030307f, 6.5500000f, 49},
-{0.5600803f, 0.8227167f, -0.0971969f, 5.5100000f, 48},
-{0.2234590f, 0.3368268f, -0.9146660f, 5.5500000f, 61},
-{0.2487335f, 0.3545199f, 0.9013586f, 6.6000000f, 19},
-{0.5330039f, 0.7746200f, 0.3403978f, 5.6200000f, 21},
-{0.3866430f, 0.5558922f, 0.7358608f, 5.3000000f, 21},
-{0.3930067f, 0.5655591f, 0.7250439f, 6.2100000f, 24},
-{0.5662236f, 0.8236807f, 0.0306742f, 5.5800000f, 40},
-{0.3751773f, 0.5389141f, 0.7541973f, 6.3700000f, 34},
-{0.3569554f, 0.5266762f, -0.7714889f, 3.5600000f, 18},
-{0.5000876f, 0.7212092f, 0.4793430f, 5.0300000f, 22},
-{0.5239205f, 0.7554629f, 0.3934249f, 6.4600000f, 21},
-{0.4394060f, 0.6297468f, 0.6405789f, 6.6300000f, 18},
-{0.2244155f, 0.3343593f, -0.9153369f, 5.6900000f, 52},
-{0.3905671f, 0.5542287f, 0.7350428f, 6.1100000f, 15},
-{0.4960129f, 0.7078977f, 0.5028440f, 6.4700000f, 50},
-{0.5711420f, 0.8206573f, -0.0178450f, 3.0400000f, 67},
-{0.3697438f, 0.5233207f, 0.7677402f, 5.5900000f, 19},
-{0.5204156f, 0.7503507f, -0.4076045f, 6.3400000f, 45},
-{0.5712681f, 0.8182848f, -0.0637389f, 6.5000000f, 23},
-{0.3267324f, 0.4565574f, 0.8275272f, 5.1700000f, 22},
-{0.4367988f, 0.6272342f, -0.6448131f, 6.3700000f, 52},
-{0.4378469f, 0.6091135f, 0.6612646f, 5.8200000f, 30},
-{0.3364926f, 0.4809854f, -0.8095837f, 5.8100000f, 55},
-{0.5804878f, 0.8142396f, 0.0069085f, 5.2800000f, 62},
-{0.3337961f, 0.4600075f, 0.8227838f, 6.2800000f, 37},
-{0.5813675f, 0.8134945f, 0.0154455f, 5.4200000f, 30},
-{0.5732787f, 0.8035340f, -0.1602640f, 5.4600000f, 30},
-{0.5575382f, 0.7810389f, -0.2812995f, 5.8700000f, 50},
-{0.3787096f, 0.5192691f, 0.7661192f, 5.1900000f, 48},
-{0.5395042f, 0.7525767f, -0.3775759f, 5.2000000f, 40},
-{0.3259346f, 0.4434358f, 0.8349439f, 6.2500000f, 12},
-{0.5566370f, 0.7734785f, -0.3031277f, 6.2200000f, 45},
-{0.4265915f, 0.5969750f, -0.6794413f, 6.3100000f, 50},
-{0.3792797f, 0.5143328f, 0.7691610f, 4.7100000f, 54},
-{0.4704246f, 0.6528101f, -0.5937505f, 6.5300000f, 52},
-{0.3682096f, 0.5118992f, -0.7761320f, 5.9200000f, 25},
-{0.5805648f, 0.7931202f, 0.1841324f, 5.4700000f, 17},
-{0.5374088f, 0.7374106f, -0.4091667f, 6.4400000f, 53},
-{0.5910818f, 0.8063306f, -0.0212914f, 6.3300000f, 20},
-{0.2233730f, 0.3138859f, -0.9228110f, 4.0900000f, 23},
-{0.4573043f, 0.6261829f, -0.6314806f, 6.1800000f, 42},
-{0.2326762f, 0.3058001f, 0.9232270f, 4.5200000f, 25},
-{0.5822724f, 0.7872551f, -0.2029487f, 4.8900000f, 19},
-{0.3819335f, 0.5074722f, 0.7723980f, 6.1200000f, 34},
-{0.5754780f, 0.7776784f, -0.2530638f, 5.8300000f, 26},
-{0.5334112f, 0.7135663f, 0.4541978f, 6.1800000f, 55},
-{0.5098748f, 0.6799438f, 0.5269764f, 5.5400000f, 51},
-{0.5610346f, 0.7541497f, -0.3413185f, 5.8800000f, 52},
-{0.2982579f, 0.4071511f, -0.8632904f, 5.3500000f, 32},
-{0.1769672f, 0.2461134f, -0.9529485f, 5.0100000f, 51},
-{0.3433438f, 0.4498203f, 0.8244858f, 6.5100000f, 22},
-{0.5234189f, 0.6935504f, 0.4949954f, 5.2900000f, 30},
-{0.5958122f, 0.7895340f, 0.1471189f, 4.2800000f, 19},
-{0.6014626f, 0.7981679f, 0.0342163f, 6.4500000f, 50},
-{0.5239820f, 0.6902687f, 0.4989710f, 5.8900000f, 40},
-{0.4133651f, 0.5536385f, -0.7229203f, 4.2500000f, 15},
-{0.2458016f, 0.3338900f, -0.9099995f, 6.4100000f, 65},
-{0.5559438f, 0.7296044f, 0.3982511f, 6.1900000f, 25},
-{0.5093975f, 0.6758195f, -0.5327122f, 5.1400000f, 22},
-{0.5988906f, 0.7833990f, 0.1661807f, 6.0700000f, 52},
-{0.5064661f, 0.6583922f, 0.5567870f, 6.2500000f, 51},
-{0.5181723f, 0.6839673f, -0.5135038f, 6.1100000f, 52},
-{0.5523547f, 0.7163416f, 0.4263319f, 5.9200000f, 36},
-{0.5746542f, 0.7445894f, 0.3396455f, 6.1500000f, 29},
-{0.5668639f, 0.7392634f, -0.3635313f, 6.7700000f, 29},
-{0.5829164f, 0.7534806f, 0.3040977f, 6.2300000f, 45},
-{0.6113598f, 0.7913402f, 0.0044554f, 6.0000000f, 27},
-{0.5532816f, 0.7195543f, -0.4196677f, 6.5100000f, 29},
-{0.2667575f, 0.3537636f, -0.8964886f, 6.3700000f, 20},
-{0.5683392f, 0.7370273f, -0.3657613f, 6.1000000f, 61},
-{0.4974360f, 0.6360976f, 0.5898621f, 5.1500000f, 55},
-{0.6134660f, 0.7887297f, 0.0395602f, 5.2500000f, 53},
-{0.5095984f, 0.6471482f, 0.5670174f, 5.8300000f, 50},
-{0.6161126f, 0.7874780f, -0.0168416f, 5.3500000f, 43},
-{0.5956466f, 0.7617989f, -0.2546910f, 4.7500000f, 34},
-{0.5975762f, 0.7586911f, 0.2594044f, 6.0400000f, 38},
-{0.5014563f, 0.6404129f, -0.5817326f, 6.3000000f, 48},
-{0.1879322f, 0.2279124f, 0.9553729f, 5.1600000f, 48},
-{0.5174803f, 0.6557338f, -0.5497520f, 5.9000000f, 50},
-{0.5839201f, 0.7362617f, -0.3419883f, 6.2100000f, 50},
-{0.4830503f, 0.5993730f, 0.6382902f, 6.3600000f, 19},
-{0.2607430f, 0.3174290f, 0.9117302f, 5.7800000f, 55},
-{0.4995728f, 0.6188695f, 0.6061581f, 5.7100000f, 53},
-{0.5503607f, 0.6928596f, -0.4658848f, 4.9000000f, 19},
-{0.5168565f, 0.6395189f, 0.5691001f, 5.3500000f, 63},
-{0.6208399f, 0.7730781f, 0.1300311f, 6.1800000f, 46},
-{0.6213562f, 0.7761922f, -0.1069679f, 5.7500000f, 54},
-{0.6250545f, 0.7713159f, 0.1199106f, 5.8200000f, 53},
-{0.6259021f, 0.7737873f, 0.0974671f, 4.8600000f, 48},
-{0.3923572f, 0.4936584f, -0.7761167f, 6.2400000f, 36},
-{0.4934331f, 0.6041830f, 0.6256890f, 5.9000000f, 35},
-{0.5380282f, 0.6601875f, 0.5240974f, 6.1000000f, 50},
-{0.5230178f, 0.6399043f, 0.5630053f, 5.3000000f, 64},
-{0.6256769f, 0.7726467f, -0.1074499f, 5.5300000f, 60},
-{0.4863171f, 0.5933882f, 0.6413938f, 6.5400000f, 15},
-{0.5315829f, 0.6500072f, 0.5430564f, 6.2500000f, 38},
-{0.2971487f, 0.3750428f, -0.8780920f, 6.7700000f, 19},
-{0.6166168f, 0.7571817f, 0.2155449f, 5.6800000f, 37},
-{0.5749384f, 0.7039297f, 0.4170477f, 7.0900000f, 34},
-{0.5750856f, 0.7038174f, 0.4170344f, 6.5000000f, 36},
-{0.6255658f, 0.7684902f, 0.1345002f, 5.8100000f, 50},
-{0.5457081f, 0.6729623f, -0.4993239f, 5.7500000f, 48},
-{0.5038886f, 0.6096561f, 0.6118952f, 6.1800000f, 36},
-{0.5018513f, 0.6062928f, 0.6168909f, 6.3000000f, 19},
-{0.6303943f, 0.7646388f, 0.1339045f, 6.3900000f, 36},
-{0.6344007f, 0.7716682f, -0.0454308f, 5.6500000f, 45},
-{0.5280151f, 0.6463926f, -0.5507964f, 5.7900000f, 45},
-{0.5924682f, 0.7135258f, 0.3739817f, 5.4300000f, 27},
-{0.0994008f, 0.1105962f, 0.9888822f, 5.7800000f, 48},
-{0.6369947f, 0.7685252f, 0.0600565f, 6.2100000f, 49},
-{0.1184125f, 0.1520049f, -0.9812609f, 5.2800000f, 48},
-{0.5528445f, 0.6687989f, -0.4970623f, 5.8300000f, 34},
-{0.3950959f, 0.4818257f, -0.7821401f, 5.3100000f, 26},
-{0.6410485f, 0.7674790f, 0.0057353f, 4.0700000f, 12},
-{0.5156613f, 0.6232536f, -0.5879186f, 6.4900000f, 40},
-{0.6313338f, 0.7553122f, -0.1758440f, 4.8400000f, 35},
-{0.5744542f, 0.6804670f, 0.4549363f, 5.3000000f, 23},
-{0.6400031f, 0.7609599f, 0.1064714f, 6.2500000f, 33},
-{0.6363264f, 0.7569682f, -0.1486197f, 5.7800000f, 36},
-{0.3735075f, 0.4332984f, 0.8202101f, 5.7700000f, 17},
-{0.5603133f, 0.6675090f, -0.4903884f, 6.5200000f, 50},
-{0.3880274f, 0.4503478f, 0.8041279f, 5.8400000f, 50},
-{0.4967196f, 0.5803095f, 0.6453762f, 4.9100000f, 39},
-{0.4838159f, 0.5776122f, -0.6574848f, 4.7500000f, 22},
-{0.6468474f, 0.7625227f, 0.0121443f, 5.7100000f, 37},
-{0.2486517f, 0.2839617f, 0.9260335f, 5.9500000f, 25},
-{0.4345982f, 0.5042351f, 0.7462381f, 6.4800000f, 45},
-{0.6113786f, 0.7135177f, 0.3422115f, 5.6900000f, 20},
-{0.5072746f, 0.6009873f, -0.6176461f, 4.1100000f, 50},
-{0.6480336f, 0.7600584f, -0.0486173f, 6.0500000f, 49},
-{0.6302349f, 0.7407418f, -0.2326062f, 5.9800000f, 35},
-{0.6396368f, 0.7457391f, 0.1863811f, 6.3000000f, 22},
-{0.2839204f, 0.3397808f, -0.8966260f, 6.5500000f, 18},
-{0.4288668f, 0.4924861f, 0.7573181f, 4.1200000f, 38},
-{0.4697653f, 0.5399907f, 0.6983771f, 5.4300000f, 40},
-{0.5792317f, 0.6695586f, 0.4649536f, 4.6600000f, 13},
-{0.3841077f, 0.4550936f, -0.8033375f, 5.2100000f, 34},
-{0.5910314f, 0.6807833f, 0.4326846f, 6.3500000f, 22},
-{0.6527085f, 0.7555034f, 0.0564459f, 3.4700000f, 23},
-{0.5147286f, 0.6020843f, -0.6103679f, 6.0100000f, 48},
-{0.2430469f, 0.2907066f, -0.9254285f, 4.1100000f, 19},
-{0.4557312f, 0.5329253f, -0.7129514f, 6.1000000f, 51},
-{0.6257771f, 0.7178579f, 0.3050952f, 6.4600000f, 52},
-{0.6345111f, 0.7264041f, 0.2640694f, 5.7700000f, 19},
-{0.4255743f, 0.4958324f, -0.7569919f, 5.4100000f, 40},
-{0.6417810f, 0.7374826f, -0.2103248f, 4.2500000f, 17},
-{0.6437232f, 0.7342841f, 0.2155165f, 5.1800000f, 27},
-{0.6489110f, 0.7403212f, 0.1756101f, 4.2700000f, 30},
-{0.5047474f, 0.5840425f, -0.6357078f, 6.3600000f, 19},
-{0.2339081f, 0.2576821f, 0.9374897f, 6.1800000f, 23},
-{0.6582558f, 0.7482995f, 0.0821414f, 6.0300000f, 30},
-{0.5604908f, 0.6428328f, -0.5221265f, 6.2200000f, 21},
-{0.6294030f, 0.7170442f, -0.2994988f, 4.4700000f, 36},
-{0.5387469f, 0.6037651f, 0.5875538f, 6.2500000f, 48},
-{0.5418876f, 0.6068228f, 0.5814842f, 6.3000000f, 29},
-{0.4094043f, 0.4702263f, -0.7818410f, 6.1500000f, 22},
-{0.4610215f, 0.5244236f, -0.7158485f, 6.8500000f, 52},
-{0.2735285f, 0.3162064f, -0.9084028f, 6.2600000f, 35},
-{0.5835702f, 0.6486420f, 0.4885789f, 4.5100000f, 51},
-{0.3662685f, 0.4014199f, 0.8394697f, 6.2500000f, 25},
-{0.6235265f, 0.7001178f, -0.3479222f, 6.4900000f, 33},
-{0.6200516f, 0.6935711f, -0.3667358f, 6.4700000f, 32},
-{0.6369952f, 0.7041423f, 0.3137209f, 5.8200000f, 51},
-{0.2456188f, 0.2634438f, 0.9328820f, 5.8000000f, 35},
-{0.6077482f, 0.6704586f, 0.4255907f, 5.8600000f, 20},
-{0.5358232f, 0.5875646f, 0.6063509f, 6.4500000f, 36},
-{0.6553938f, 0.7283145f, -0.2000425f, 6.9000000f, 64},
-{0.3072354f, 0.3489247f, -0.8853576f, 5.7400000f, 48},
-{0.3800605f, 0.4122404f, 0.8280168f, 3.7600000f, 53},
-{0.5506110f, 0.6138725f, -0.5656748f, 6.5100000f, 50},
-{0.6422720f, 0.7052808f, 0.3001093f, 5.2200000f, 16},
-{0.2648575f, 0.3005717f, -0.9162462f, 4.8400000f, 22},
-{0.6005066f, 0.6554337f, 0.4580377f, 3.6300000f, 18},
-{0.3578164f, 0.3845233f, 0.8509461f, 6.4500000f, 21},
-{0.5315260f, 0.5770945f, 0.6200339f, 4.2300000f, 32},
-{0.5729563f, 0.6302783f, -0.5238992f, 4.4600000f, 50},
-{0.4658298f, 0.5008760f, 0.7294696f, 5.8800000f, 48},
-{0.5569798f, 0.5998364f, 0.5744300f, 4.5300000f, 55},
-{0.6193970f, 0.6768421f, -0.3977841f, 6.1400000f, 51},
-{0.6066352f, 0.6625870f, -0.4392860f, 5.3900000f, 20},
-{0.4121195f, 0.4386070f, 0.7986122f, 6.3600000f, 18},
-{0.6569439f, 0.7076161f, 0.2602002f, 5.4900000f, 17},
-{0.5597127f, 0.6095010f, -0.5614537f, 5.9200000f, 50},
-{0.4541362f, 0.4812721f, 0.7497583f, 6.2600000f, 45},
-{0.6338474f, 0.6854622f, -0.3583001f, 4.7500000f, 50},
-{0.5597316f, 0.6072484f, -0.5638704f, 5.4700000f, 55},
-{0.3240226f, 0.3566429f, -0.8762506f, 5.2600000f, 22},
-{0.5338946f, 0.5785845f, -0.6166009f, 6.3600000f, 20},
-{0.4170318f, 0.4384690f, 0.7961340f, 3.9500000f, 44},
-{0.5392047f, 0.5696450f, 0.6202925f, 5.3300000f, 34},
-{0.6576176f, 0.6978773f, 0.2837364f, 6.3100000f, 35},
-{0.6706118f, 0.7157858f, -0.1947575f, 6.0400000f, 52},
-{0.5951970f, 0.6387082f, -0.4876396f, 6.4000000f, 38},
-{0.6770546f, 0.7207273f, -0.1488258f, 6.3200000f, 27},
-{0.3311600f, 0.3430810f, 0.8789929f, 5.5900000f, 34},
-{0.3014513f, 0.3110374f, 0.9013229f, 6.2400000f, 53},
-{0.6386991f, 0.6754743f, -0.3685077f, 5.9500000f, 50},
-{0.5445755f, 0.5760067f, -0.6096342f, 5.9200000f, 36},
-{0.4363540f, 0.4485430f, 0.7800028f, 6.2200000f, 55},
-{0.4734873f, 0.4879331f, 0.7333015f, 6.0200000f, 53},
-{0.3301924f, 0.3530983f, -0.8753825f, 6.0300000f, 51},
-{0.6588344f, 0.6833858f, 0.3145171f, 5.9100000f, 66},
-{0.4593685f, 0.4845742f, -0.7444249f, 4.0000000f, 67},
-{0.6618701f, 0.6827883f, 0.3093997f, 5.6300000f, 36},
-{0.6879526f, 0.7109665f, 0.1457665f, 5.9700000f, 37},
-{0.4506583f, 0.4744454f, -0.7561803f, 6.2100000f, 54},
-{0.1760148f, 0.1912890f, -0.9656228f, 4.7500000f, 53},
-{0.5929487f, 0.6071487f, 0.5289445f, 5.1100000f, 19},
-{0.6906617f, 0.7125313f, -0.1236352f, 3.8900000f, 51},
-{0.6960570f, 0.7168760f, -0.0399186f, 5.1700000f, 21},
-{0.5477536f, 0.5572117f, 0.6240842f, 6.0400000f, 53},
-{0.6958772f, 0.7138600f, 0.0784784f, 6.1100000f, 64},
-{0.6560493f, 0.6670959f, 0.3529623f, 5.8000000f, 35},
-{0.5413918f, 0.5472742f, 0.6382678f, 4.7000000f, 22},
-{0.3069397f, 0.3224640f, -0.8954357f, 6.5600000f, 52},
-{0.1332737f, 0.1263284f, 0.9829950f, 5.4900000f, 61},
-{0.5755582f, 0.5802906f, 0.5761906f, 4.9300000f, 52},
-{0.6474909f, 0.6623801f, -0.3768396f, 5.4500000f, 25},
-{0.6158844f, 0.6310192f, -0.4717003f, 6.2900000f, 22},
-{0.4798960f, 0.4806015f, 0.7339769f, 5.4700000f, 45},
-{0.5326123f, 0.5341716f, 0.6564943f, 5.8900000f, 52},
-{0.6563551f, 0.6608861f, 0.3639061f, 4.6300000f, 22},
-{0.6563551f, 0.6608861f, 0.3639061f, 4.6300000f, 22},
-{0.6483247f, 0.6591932f, -0.3809718f, 5.8400000f, 52},
-{0.4335467f, 0.4302676f, 0.7917747f, 5.2800000f, 17},
-{0.4335788f, 0.4302243f, 0.7917806f, 6.7400000f, 19},
-{0.7029258f, 0.7109458f, -0.0212478f, 5.2300000f, 22},
-{0.5526405f, 0.5646089f, -0.6130296f, 6.4100000f, 20},
-{0.5566829f, 0.5557284f, 0.6174707f, 6.1100000f, 18},
-{0.6961313f, 0.7035210f, -0.1430368f, 6.1400000f, 22},
-{0.6977095f, 0.6994470f, 0.1548397f, 4.7000000f, 16},
-{0.5399424f, 0.5481960f, -0.6387044f, 3.2400000f, 24},
-{0.5399642f, 0.5481702f, -0.6387081f, 4.3500000f, 21},
-{0.7058860f, 0.7078188f, -0.0267876f, 5.5600000f, 19},
-{0.6270652f, 0.6319544f, -0.4554370f, 6.1400000f, 51},
-{0.6411617f, 0.6433944f, -0.4182767f, 5.7100000f, 32},
-{0.6966424f, 0.6921883f, 0.1885860f, 5.9500000f, 56},
-{0.6020020f, 0.6039050f, -0.5223911f, 6.3100000f, 20},
-{0.7095885f, 0.7043445f, -0.0195707f, 6.1100000f, 61},
-{0.6382528f, 0.6277478f, 0.4456076f, 5.9000000f, 23},
-{0.1100973f, 0.0993817f, 0.9889398f, 5.9500000f, 27},
-{0.7063544f, 0.6991993f, -0.1103800f, 5.7500000f, 50},
-{0.7097685f, 0.6982693f, 0.0929981f, 6.2500000f, 50},
-{0.3091309f, 0.3123942f, -0.8982472f, 4.9900000f, 23},
-{0.7123358f, 0.6977230f, 0.0758972f, 5.6100000f, 17},
-{0.7122878f, 0.6982548f, 0.0713185f, 2.5300000f, 61},
-{0.7060452f, 0.6942224f, -0.1398404f, 5.8300000f, 46},
-{0.7104322f, 0.6971959f, -0.0959374f, 6.1900000f, 40},
-{0.6292924f, 0.6204131f, -0.4680583f, 5.8900000f, 45},
-{0.4292487f, 0.4116467f, 0.8039232f, 2.9300000f, 48},
-{0.6322197f, 0.6131718f, 0.4736229f, 6.3600000f, 30},
-{0.7110626f, 0.6944726f, -0.1099897f, 5.3200000f, 50},
-{0.3974261f, 0.3786622f, 0.8358633f, 4.7600000f, 49},
-{0.6606555f, 0.6470087f, -0.3806759f, 4.0900000f, 24},
-{0.4043417f, 0.3848308f, 0.8297066f, 6.1100000f, 49},
-{0.5630624f, 0.5381838f, 0.6271515f, 3.3900000f, 64},
-{0.3190503f, 0.2993027f, 0.8992356f, 5.8900000f, 19},
-{0.5494076f, 0.5243530f, 0.6505423f, 6.0500000f, 50},
-{0.6939443f, 0.6661762f, 0.2732224f, 6.4900000f, 53},
-{0.7156808f, 0.6894773f, -0.1114545f, 5.2600000f, 28},
-{0.7208802f, 0.6922963f, 0.0325204f, 6.0500000f, 50},
-{0.6545305f, 0.6241457f, 0.4266521f, 6.8000000f, 17},
-{0.6545305f, 0.6241457f, 0.4266521f, 7.0000000f, 17},
-{0.5061338f, 0.4933480f, -0.7074152f, 5.8200000f, 52},
-{0.4482358f, 0.4177491f, 0.7902976f, 6.3100000f, 15},
-{0.7074002f, 0.6689843f, 0.2281337f, 5.6200000f, 53},
-{0.1998777f, 0.1800681f, 0.9631326f, 4.8700000f, 22},
-{0.4954725f, 0.4628851f, 0.7350132f, 6.4100000f, 23},
-{0.3777791f, 0.3660508f, -0.8504645f, 5.1100000f, 30},
-{0.7231830f, 0.6829344f, -0.1029903f, 5.2700000f, 63},
-{0.5527098f, 0.5146518f, 0.6554734f, 2.1200000f, 18},
-{0.4759268f, 0.4396855f, 0.7616891f, 4.0500000f, 40},
-{0.6944094f, 0.6507931f, 0.3070244f, 6.1100000f, 11},
-{0.2430722f, 0.2383319f, -0.9402733f, 5.5300000f, 13},
-{0.6933506f, 0.6445642f, 0.3221831f, 6.2700000f, 60},
-{0.5215783f, 0.4800500f, 0.7053425f, 3.8000000f, 50},
-{0.7252709f, 0.6725199f, 0.1473059f, 6.2800000f, 49},
-{0.6559833f, 0.6125264f, -0.4410186f, 6.1900000f, 25},
-{0.6433553f, 0.5915351f, 0.4859837f, 5.7200000f, 18},
-{0.6524437f, 0.5970868f, 0.4666954f, 6.4200000f, 20},
-{0.6587049f, 0.6012167f, 0.4523785f, 6.0200000f, 53},
-{0.5709068f, 0.5172583f, 0.6375809f, 4.6300000f, 51},
-{0.7233728f, 0.6590942f, 0.2057345f, 5.9800000f, 18},
-{0.5007611f, 0.4491495f, 0.7399345f, 6.3300000f, 55},
-{0.5493331f, 0.4939278f, 0.6739944f, 6.1500000f, 14},
-{0.6985145f, 0.6309902f, 0.3375334f, 4.3500000f, 52},
-{0.7221495f, 0.6538585f, 0.2257635f, 6.1200000f, 50},
-{0.6839305f, 0.6234754f, -0.3788371f, 6.3800000f, 50},
-{0.6612411f, 0.5941489f, 0.4579817f, 5.7900000f, 19},
-{0.7405962f, 0.6708646f, -0.0381843f, 6.0500000f, 61},
-{0.4982694f, 0.4431625f, 0.7452077f, 5.9000000f, 49},
-{0.7124225f, 0.6455323f, -0.2752132f, 6.2600000f, 50},
-{0.7394033f, 0.6631958f, 0.1159918f, 5.5600000f, 51},
-{0.2650611f, 0.2475630f, -0.9319094f, 6.1500000f, 51},
-{0.5012273f, 0.4574562f, -0.7345101f, 6.1200000f, 51},
-{0.1629326f, 0.1363194f, 0.9771745f, 5.4500000f, 26},
-{0.7453251f, 0.6665536f, -0.0140300f, 5.0600000f, 38},
-{0.6622564f, 0.5959234f, -0.4541935f, 3.8700000f, 38},
-{0.4091765f, 0.3563191f, 0.8400068f, 5.7900000f, 20},
-{0.0709178f, 0.0532781f, 0.9960583f, 5.6100000f, 43},
-{0.5541633f, 0.4862235f, 0.6756402f, 6.0700000f, 52},
-{0.3128650f, 0.2683314f, 0.9111058f, 6.3600000f, 23},
-{0.5392495f, 0.4837135f, -0.6893702f, 5.9300000f, 37},
-{0.4759574f, 0.4130027f, 0.7764621f, 5.0300000f, 46},
-{0.6181609f, 0.5516086f, -0.5600045f, 6.2700000f, 18},
-{0.6482751f, 0.5668145f, 0.5083903f, 5.5200000f, 21},
-{0.7014296f, 0.6156699f, 0.3590920f, 4.8900000f, 21},
-{0.5305870f, 0.4609139f, 0.7113619f, 6.1600000f, 62},
-{0.6591478f, 0.5850474f, -0.4724867f, 6.1600000f, 51},
-{0.6334597f, 0.5517104f, 0.5425352f, 6.3100000f, 34},
-{0.6206399f, 0.5393635f, 0.5691161f, 6.2500000f, 21},
-{0.4091246f, 0.3665927f, -0.8355997f, 5.7400000f, 35},
-{0.6401603f, 0.5536204f, 0.5326342f, 6.0600000f, 48},
-{0.5766114f, 0.4960078f, 0.6492268f, 6.4500000f, 19},
-{0.6763336f, 0.5931112f, -0.4367974f, 6.2500000f, 25},
-{0.1640750f, 0.1536282f, -0.9744115f, 5.5700000f, 32},
-{0.5463316f, 0.4674777f, 0.6949722f, 5.4700000f, 18},
-{0.7528384f, 0.6543460f, -0.0711734f, 6.1700000f, 19},
-{0.7483174f, 0.6514584f, -0.1249917f, 4.8000000f, 25},
-{0.3158088f, 0.2650185f, 0.9110598f, 4.8400000f, 12},
-{0.5880534f, 0.5032962f, 0.6331557f, 5.9600000f, 22},
-{0.4876570f, 0.4141855f, 0.7685317f, 5.1500000f, 13},
-{0.7474139f, 0.6463179f, -0.1537715f, 6.1400000f, 31},
-{0.4898553f, 0.4142286f, 0.7671092f, 5.0300000f, 15},
-{0.6594498f, 0.5723002f, -0.4874406f, 6.6500000f, 20},
-{0.6304543f, 0.5349953f, 0.5624121f, 4.8200000f, 52},
-{0.7613625f, 0.6481231f, 0.0162357f, 5.3800000f, 49},
-{0.6764166f, 0.5774762f, -0.4571454f, 5.9100000f, 33},
-{0.7085208f, 0.6031672f, -0.3663163f, 4.8800000f, 46},
-{0.6819436f, 0.5725736f, 0.4550960f, 5.9000000f, 46},
-{0.7629293f, 0.6438033f, 0.0587885f, 4.8300000f, 45},
-{0.7273031f, 0.6174165f, -0.2997115f, 5.7100000f, 30},
-{0.5247542f, 0.4503914f, -0.7223438f, 5.8500000f, 52},
-{0.6705169f, 0.5609375f, 0.4855473f, 4.4700000f, 52},
-{0.6915581f, 0.5780957f, 0.4330736f, 6.1200000f, 53},
-{0.5052866f, 0.4169830f, 0.7555201f, 5.9300000f, 36},
-{0.5601664f, 0.4640622f, 0.6861923f, 4.9500000f, 23},
-{0.7174588f, 0.6046024f, -0.3459897f, 3.6900000f, 63},
-{0.6994057f, 0.5890586f, -0.4047737f, 5.6100000f, 62},
-{0.7176562f, 0.5956686f, 0.3607611f, 5.2800000f, 15},
-{0.3634001f, 0.3110043f, -0.8781894f, 5.5400000f, 42},
-{0.7675758f, 0.6377442f, 0.0641066f, 5.6900000f, 48},
-{0.5607376f, 0.4708136f, -0.6811079f, 4.2700000f, 48},
-{0.3343094f, 0.2690920f, 0.9032313f, 5.2300000f, 60},
-{0.3631995f, 0.3096129f, -0.8787639f, 5.2400000f, 41},
-{0.5062642f, 0.4128254f, 0.7571471f, 5.2900000f, 15},
-{0.6842572f, 0.5630643f, 0.4634120f, 5.5200000f, 45},
-{0.6939366f, 0.5784056f, -0.4288344f, 6.3900000f, 37},
-{0.3204626f, 0.2737412f, -0.9068459f, 6.0500000f, 23},
-{0.7235631f, 0.5924756f, 0.3541596f, 5.0900000f, 53},
-{0.7120409f, 0.5900989f, -0.3805010f, 5.5200000f, 46},
-{0.5015533f, 0.4049796f, 0.7644840f, 1.7900000f, 35},
-{0.7033240f, 0.5783767f, -0.4132987f, 6.3500000f, 20},
-{0.6489141f, 0.5231637f, 0.5524584f, 5.6100000f, 20},
-{0.4605613f, 0.3669818f, 0.8082126f, 6.5100000f, 29},
-{0.5329951f, 0.4411082f, -0.7220387f, 6.3900000f, 50},
-{0.7066748f, 0.5706815f, 0.4182502f, 5.5000000f, 54},
-{0.7733727f, 0.6282135f, 0.0851029f, 6.3800000f, 45},
-{0.7706682f, 0.6280006f, -0.1081006f, 6.2000000f, 42},
-{0.1747264f, 0.1519408f, -0.9728230f, 5.5200000f, 34},
-{0.5866049f, 0.4701413f, 0.6594406f, 6.5100000f, 20},
-{0.7275939f, 0.5869108f, 0.3551659f, 6.0800000f, 21},
-{0.7587934f, 0.6135365f, 0.2186447f, 6.0400000f, 50},
-{0.5121133f, 0.4075115f, 0.7560915f, 6.0900000f, 17},
-{0.7697175f, 0.6187950f, 0.1569324f, 3.6000000f, 46},
-{0.6634874f, 0.5385130f, -0.5194114f, 6.5000000f, 53},
-{0.2472199f, 0.1891421f, 0.9503197f, 6.3200000f, 62},
-{0.3914813f, 0.3047781f, 0.8682469f, 6.4900000f, 19},
-{0.5164206f, 0.4032845f, 0.7554280f, 4.9800000f, 15},
-{0.3961497f, 0.3065430f, 0.8655038f, 4.2100000f, 19},
-{0.7437485f, 0.5860435f, 0.3215451f, 6.5700000f, 23},
-{0.5096288f, 0.3950475f, 0.7643402f, 5.5800000f, 16},
-{0.7744662f, 0.6096090f, 0.1690533f, 3.7400000f, 19},
-{0.7668187f, 0.6028220f, 0.2204421f, 6.2800000f, 20},
-{0.4099303f, 0.3147922f, 0.8560742f, 4.5400000f, 20},
-{0.6555404f, 0.5105693f, 0.5564044f, 5.6100000f, 22},
-{0.6480488f, 0.5158045f, -0.5603379f, 6.3900000f, 21},
-{0.4045083f, 0.3098623f, 0.8604408f, 6.1300000f, 22},
-{0.5140567f, 0.3967054f, 0.7605067f, 4.6700000f, 13},
-{0.7001763f, 0.5550773f, -0.4490461f, 5.9300000f, 45},
-{0.4499135f, 0.3452204f, 0.8236508f, 5.0900000f, 21},
-{0.5406721f, 0.4169878f, 0.7306126f, 6.2400000f, 17},
-{0.7275124f, 0.5661320f, 0.3875826f, 6.0300000f, 50},
-{0.5967164f, 0.4738213f, -0.6476287f, 6.3200000f, 20},
-{0.7743194f, 0.6048739f, -0.1858953f, 5.7300000f, 52},
-{0.5308819f, 0.4050952f, 0.7443536f, 5.8200000f, 18},
-{0.5319260f, 0.4060449f, 0.7430897f, 4.3600000f, 53},
-{0.2864404f, 0.2318687f, -0.9296176f, 6.1500000f, 40},
-{0.6498452f, 0.5097422f, -0.5637944f, 5.7100000f, 52},
-{0.2312601f, 0.1692465f, 0.9580576f, 6.5700000f, 20},
-{0.5208661f, 0.3943211f, 0.7571059f, 6.2900000f, 20},
-{0.6525863f, 0.5089780f, -0.5613133f, 6.5000000f, 21},
-{0.5194120f, 0.3920509f, 0.7592808f, 6.3900000f, 19},
-{0.7891721f, 0.6074610f, -0.0905457f, 5.9900000f, 45},
-{0.7789373f, 0.5954976f, 0.1965689f, 5.1400000f, 20},
-{0.7768623f, 0.5982645f, -0.1963788f, 5.5900000f, 25},
-{0.5343985f, 0.4021744f, 0.7434205f, 5.4700000f, 18},
-{0.2843540f, 0.2269900f, -0.9314603f, 5.9600000f, 33},
-{0.7064111f, 0.5354830f, 0.4628620f, 5.9600000f, 22},
-{0.7754718f, 0.5903592f, 0.2238739f, 4.1100000f, 50},
-{0.7907239f, 0.6026065f, 0.1078017f, 5.9400000f, 48},
-{0.4162128f, 0.3092901f, 0.8550477f, 6.4000000f, 24},
-{0.5550053f, 0.4165646f, 0.7200298f, 5.3100000f, 34},
-{0.7920580f, 0.6043793f, -0.0858468f, 4.7300000f, 19},
-{0.4271052f, 0.3169458f, 0.8468333f, 6.3700000f, 37},
-{0.5673532f, 0.4250074f, 0.7053219f, 6.4100000f, 12},
-{0.4608419f, 0.3420954f, 0.8188989f, 5.9800000f, 23},
-{0.6519148f, 0.4882864f, 0.5801581f, 5.9000000f, 11},
-{0.5952497f, 0.4570951f, -0.6608644f, 5.7800000f, 25},
-{0.6025567f, 0.4614119f, -0.6511717f, 6.1200000f, 37},
-{0.4027383f, 0.2952639f, 0.8663839f, 6.4600000f, 33},
-{0.6158686f, 0.4574470f, 0.6414422f, 5.8100000f, 25},
-{0.7895234f, 0.5917142f, 0.1628716f, 5.7700000f, 19},
-{0.2014171f, 0.1418035f, 0.9691867f, 6.2700000f, 49},
-{0.5459774f, 0.4166139f, -0.7268711f, 5.9900000f, 21},
-{0.7271426f, 0.5484472f, -0.4128792f, 6.3800000f, 23},
-{0.3830678f, 0.2955926f, -0.8751480f, 4.7200000f, 35},
-{0.7921856f, 0.5919300f, -0.1485286f, 3.7300000f, 52},
-{0.7655767f, 0.5657821f, 0.3062399f, 6.1700000f, 51},
-{0.7327313f, 0.5400023f, 0.4141285f, 5.9200000f, 23},
-{0.5401486f, 0.3906792f, 0.7453920f, 4.2300000f, 15},
-{0.7530854f, 0.5583310f, -0.3480358f, 4.2700000f, 18},
-{0.8009291f, 0.5882333f, 0.1117773f, 6.4900000f, 40},
-{0.5183695f, 0.3885666f, -0.7617802f, 5.6800000f, 52},
-{0.7973737f, 0.5866761f, -0.1414436f, 6.2500000f, 22},
-{0.3298134f, 0.2511140f, -0.9100356f, 5.8300000f, 18},
-{0.6895005f, 0.5104518f, -0.5138366f, 6.2000000f, 35},
-{0.4446533f, 0.3162080f, 0.8380310f, 6.3000000f, 19},
-{0.6965313f, 0.5127848f, -0.5018924f, 6.4000000f, 53},
-{0.3884854f, 0.2904656f, -0.8744763f, 6.4100000f, 50},
-{0.5994372f, 0.4275613f, 0.6766582f, 6.4200000f, 18},
-{0.7945736f, 0.5774946f, -0.1874908f, 5.5700000f, 47},
-{0.8109914f, 0.5849682f, 0.0102585f, 5.7100000f, 49},
-{0.7762812f, 0.5625019f, -0.2845685f, 5.2300000f, 19},
-{0.8112310f, 0.5846838f, 0.0070103f, 4.2800000f, 39},
-{0.7842716f, 0.5604660f, 0.2660749f, 6.3900000f, 25},
-{0.7628336f, 0.5391092f, 0.3569961f, 6.5000000f, 20},
-{0.3498782f, 0.2579249f, -0.9005887f, 6.7500000f, 23},
-{0.3715385f, 0.2549816f, 0.8927169f, 5.1000000f, 33},
-{0.6243821f, 0.4490980f, -0.6391072f, 4.5800000f, 51},
-{0.0522048f, 0.0271689f, 0.9982668f, 5.8600000f, 35},
-{0.8099297f, 0.5751262f, -0.1150816f, 5.8500000f, 45},
-{0.1696997f, 0.1302387f, -0.9768520f, 5.7000000f, 48},
-{0.7838961f, 0.5518091f, 0.2846289f, 6.1600000f, 50},
-{0.8143092f, 0.5753992f, -0.0762646f, 5.9600000f, 51},
-{0.4133219f, 0.2821826f, 0.8657586f, 5.7600000f, 53},
-{0.6514167f, 0.4513497f, 0.6098686f, 5.5700000f, 17},
-{0.7331723f, 0.5191390f, -0.4392642f, 6.0100000f, 20},
-{0.8176155f, 0.5732896f, 0.0533284f, 5.5700000f, 46},
-{0.8173990f, 0.5742734f, -0.0454841f, 6.2300000f, 45},
-{0.8063435f, 0.5676368f, -0.1661282f, 6.1900000f, 45},
-{0.7421425f, 0.5159385f, 0.4278224f, 6.1100000f, 22},
-{0.8190347f, 0.5735387f, -0.0153486f, 6.1200000f, 51},
-{0.7925322f, 0.5539584f, -0.2549958f, 6.3300000f, 45},
-{0.8178806f, 0.5692979f, -0.0834943f, 5.5300000f, 19},
-{0.5552472f, 0.3783203f, 0.7406580f, 3.0100000f, 15},
-{0.6842807f, 0.4686464f, 0.5586864f, 4.9700000f, 10},
-{0.3231354f, 0.2138482f, 0.9218744f, 5.8000000f, 30},
-{0.8092317f, 0.5601819f, -0.1770323f, 6.4900000f, 35},
-{0.7766214f, 0.5321869f, 0.3370998f, 5.6900000f, 19},
-{0.5492533f, 0.3701042f, 0.7492287f, 6.0600000f, 54},
-{0.7804518f, 0.5395376f, -0.3159020f, 6.5900000f, 23},
-{0.3741369f, 0.2475459f, 0.8937240f, 4.8000000f, 40},
-{0.5760098f, 0.3860358f, 0.7205477f, 6.1100000f, 27},
-{0.7014999f, 0.4717513f, 0.5341802f, 3.8300000f, 11},
-{0.7801945f, 0.5273052f, 0.3365201f, 6.1400000f, 48},
-{0.6677969f, 0.4482194f, 0.5942614f, 5.5900000f, 22},
-{0.7138011f, 0.4894439f, -0.5009318f, 5.0000000f, 15},
-{0.6125973f, 0.4085774f, 0.6766011f, 3.7700000f, 35},
-{0.8186663f, 0.5561127f, -0.1432623f, 3.5400000f, 50},
-{0.7754085f, 0.5207174f, 0.3572045f, 6.1000000f, 20},
-{0.2757815f, 0.1769976f, 0.9447838f, 5.4400000f, 22},
-{0.8165810f, 0.5530575f, -0.1652962f, 5.6000000f, 25},
-{0.7574323f, 0.5070408f, 0.4113464f, 5.4600000f, 17},
-{0.5825670f, 0.3856353f, 0.7154726f, 5.6600000f, 16},
-{0.7586382f, 0.5075045f, 0.4085429f, 3.7000000f, 16},
-{0.6625318f, 0.4518003f, -0.5974347f, 4.5900000f, 52},
-{0.7549063f, 0.5036423f, 0.4200725f, 5.6400000f, 18},
-{0.7572616f, 0.5049910f, 0.4141726f, 4.3000000f, 16},
-{0.8301873f, 0.5572932f, -0.0146069f, 5.2500000f, 17},
-{0.4693008f, 0.3061182f, 0.8282804f, 6.1000000f, 19},
-{0.2702215f, 0.1715567f, 0.9473904f, 4.6300000f, 22},
-{0.7592193f, 0.5033425f, 0.4125922f, 3.8700000f, 18},
-{0.8313170f, 0.5557744f, 0.0051778f, 5.5500000f, 54},
-{0.7582687f, 0.5023313f, 0.4155621f, 5.7600000f, 18},
-{0.7587403f, 0.5019691f, 0.4151388f, 6.4300000f, 20},
-{0.8284582f, 0.5500443f, 0.1053963f, 5.3500000f, 13},
-{0.1729365f, 0.1250702f, -0.9769598f, 6.2900000f, 52},
-{0.3489320f, 0.2233230f, 0.9101502f, 4.4700000f, 62},
-{0.7628163f, 0.5033350f, 0.4059127f, 4.1800000f, 16},
-{0.6413733f, 0.4321912f, -0.6339172f, 6.4500000f, 51},
-{0.3785787f, 0.2420840f, 0.8933496f, 5.8500000f, 25},
-{0.8283930f, 0.5474787f, 0.1184569f, 5.9100000f, 49},
-{0.5312407f, 0.3439875f, 0.7742454f, 6.1400000f, 18},
-{0.4570265f, 0.2930492f, 0.8397910f, 6.4600000f, 20},
-{0.8163035f, 0.5395741f, -0.2061757f, 4.4200000f, 62},
-{0.6983023f, 0.4540173f, 0.5533915f, 6.5700000f, 12},
-{0.7093440f, 0.4614679f, 0.5328024f, 6.2500000f, 40},
-{0.7644182f, 0.4988647f, 0.4084101f, 2.8700000f, 17},
-{0.3104501f, 0.1945626f, 0.9304655f, 6.3200000f, 19},
-{0.5567689f, 0.3725719f, -0.7424275f, 6.4900000f, 48},
-{0.4913084f, 0.3296375f, -0.8061980f, 6.3000000f, 51},
-{0.5713055f, 0.3807853f, -0.7270575f, 5.7300000f, 51},
-{0.6056015f, 0.3890256f, 0.6941944f, 6.0200000f, 29},
-{0.7326691f, 0.4828464f, -0.4796408f, 5.9000000f, 23},
-{0.7703297f, 0.4985950f, 0.3974860f, 5.4500000f, 18},
-{0.7708876f, 0.5061458f, -0.3867154f, 4.2300000f, 33},
-{0.8234918f, 0.5333951f, 0.1932641f, 5.0700000f, 13},
-{0.3741040f, 0.2518616f, -0.8925312f, 3.8500000f, 52},
-{0.5968275f, 0.3799465f, 0.7067090f, 5.6600000f, 42},
-{0.7056956f, 0.4515571f, 0.5459761f, 5.1100000f, 23},
-{0.7683569f, 0.4934579f, 0.4075868f, 3.6300000f, 18},
-{0.7384301f, 0.4825941f, -0.4709819f, 6.5500000f, 38},
-{0.7679111f, 0.4930532f, 0.4089145f, 5.0900000f, 18},
-{0.7761637f, 0.5056852f, -0.3766330f, 5.2400000f, 22},
-{0.8402013f, 0.5422601f, 0.0039755f, 5.9100000f, 53},
-{0.7716021f, 0.4928674f, 0.4021342f, 6.1700000f, 18},
-{0.7273974f, 0.4726783f, -0.4974619f, 5.5400000f, 46},
-{0.7804430f, 0.4975961f, 0.3785589f, 6.0700000f, 18},
-{0.6790743f, 0.4417265f, -0.5862899f, 6.2100000f, 18},
-{0.7938527f, 0.5126006f, -0.3271675f, 5.8100000f, 55},
-{0.7613939f, 0.4835915f, 0.4317622f, 5.2600000f, 22},
-{0.6763603f, 0.4367622f, -0.5931067f, 5.4000000f, 21},
-{0.6763617f, 0.4367282f, -0.5931301f, 4.7300000f, 19},
-{0.6998767f, 0.4377775f, 0.5643788f, 5.7700000f, 11},
-{0.4518091f, 0.2776243f, 0.8478168f, 5.8000000f, 25},
-{0.7852838f, 0.4925598f, 0.3751190f, 6.8300000f, 50},
-{0.8244962f, 0.5188948f, 0.2257304f, 6.3000000f, 19},
-{0.6830084f, 0.4374112f, -0.5849537f, 4.1700000f, 49},
-{0.2677676f, 0.1600917f, 0.9500901f, 6.3400000f, 25},
-{0.7257745f, 0.4531987f, 0.5175542f, 6.2500000f, 25},
-{0.5627611f, 0.3460607f, 0.7506943f, 5.7600000f, 50},
-{0.8425460f, 0.5264642f, 0.1138053f, 5.6700000f, 15},
-{0.6871712f, 0.4351393f, -0.5817642f, 6.8600000f, 19},
-{0.8121291f, 0.5017443f, 0.2978238f, 5.9700000f, 34},
-{0.8468644f, 0.5256240f, -0.0808706f, 5.4800000f, 18},
-{0.7242510f, 0.4432494f, 0.5281955f, 2.8500000f, 11},
-{0.3896255f, 0.2308256f, 0.8915781f, 5.0300000f, 19},
-{0.4153683f, 0.2467788f, 0.8755395f, 5.0000000f, 53},
-{0.8111761f, 0.5009111f, -0.3017968f, 6.2200000f, 50},
-{0.5749401f, 0.3455613f, 0.7416410f, 5.3700000f, 16},
-{0.2340207f, 0.1530830f, -0.9601041f, 3.2400000f, 62},
-{0.7331924f, 0.4432359f, 0.5157236f, 6.1000000f, 9},
-{0.5438321f, 0.3248057f, 0.7737880f, 5.2800000f, 35},
-{0.8531581f, 0.5213322f, -0.0182765f, 6.1400000f, 22},
-{0.8531624f, 0.5213263f, -0.0182425f, 4.7900000f, 48},
-{0.7819809f, 0.4805606f, -0.3969477f, 4.6500000f, 16},
-{0.7122349f, 0.4379628f, -0.5485527f, 5.1100000f, 16},
-{0.7023318f, 0.4200109f, 0.5747355f, 5.4900000f, 11},
-{0.6010699f, 0.3699434f, -0.7084185f, 5.9300000f, 52},
-{0.8371375f, 0.5066308f, -0.2062184f, 6.0000000f, 25},
-{0.7938423f, 0.4729043f, 0.3823296f, 5.6300000f, 32},
-{0.6572425f, 0.4012350f, -0.6379991f, 5.7100000f, 50},
-{0.6596980f, 0.3891607f, 0.6429250f, 2.8900000f, 10},
-{0.7901850f, 0.4698151f, 0.3935497f, 6.0600000f, 19},
-{0.7831551f, 0.4638949f, 0.4140888f, 6.1600000f, 50},
-{0.7074960f, 0.4165322f, 0.5709206f, 6.5300000f, 28},
-{0.8546984f, 0.5083491f, 0.1052227f, 6.0900000f, 22},
-{0.8497002f, 0.5073692f, -0.1434782f, 6.1900000f, 31},
-{0.6719557f, 0.3938991f, 0.6271515f, 6.3000000f, 51},
-{0.5338033f, 0.3253023f, -0.7805335f, 6.4600000f, 24},
-{0.7006417f, 0.4087456f, 0.5848318f, 4.0400000f, 7},
-{0.6741644f, 0.3905375f, 0.6268834f, 6.3800000f, 21},
-{0.1433808f, 0.0746022f, 0.9868518f, 5.1000000f, 48},
-{0.8412980f, 0.4954141f, -0.2162929f, 2.9500000f, 60},
-{0.8608556f, 0.5026824f, -0.0789811f, 5.8300000f, 49},
-{0.8512948f, 0.4930896f, 0.1793317f, 6.3700000f, 35},
-{0.6938889f, 0.3956067f, 0.6016756f, 6.4100000f, 20},
-{0.8477948f, 0.4919356f, -0.1980993f, 5.6000000f, 55},
-{0.3953819f, 0.2374129f, -0.8873039f, 6.1400000f, 51},
-{0.8281402f, 0.4751685f, 0.2973193f, 6.3200000f, 20},
-{0.8244093f, 0.4720800f, 0.3122336f, 5.8900000f, 34},
-{0.8469736f, 0.4856555f, 0.2162739f, 3.4700000f, 13},
-{0.7911048f, 0.4570898f, -0.4064753f, 4.6600000f, 16},
-{0.3195563f, 0.1734116f, 0.9315644f, 5.8700000f, 52},
-{0.4489162f, 0.2476788f, 0.8585624f, 5.0600000f, 30},
-{0.8566483f, 0.4858120f, 0.1736100f, 5.6700000f, 15},
-{0.8693244f, 0.4941795f, -0.0078587f, 5.2800000f, 15},
-{0.4714313f, 0.2757168f, -0.8376949f, 6.0500000f, 32},
-{0.7549665f, 0.4329058f, -0.4925628f, 5.9300000f, 22},
-{0.4237883f, 0.2477783f, -0.8712114f, 4.5600000f, 62},
-{0.3647080f, 0.1966830f, 0.9101120f, 6.1700000f, 23},
-{0.8716572f, 0.4900935f, 0.0046930f, 5.3800000f, 35},
-{0.5519777f, 0.3178447f, -0.7709056f, 6.5100000f, 61},
-{0.8680656f, 0.4853609f, 0.1043404f, 3.9100000f, 21},
-{0.7990437f, 0.4412702f, 0.4084234f, 5.4700000f, 40},
-{0.8701458f, 0.4836044f, 0.0947261f, 5.3300000f, 13},
-{0.8655652f, 0.4800704f, 0.1425809f, 5.4600000f, 32},
-{0.5171934f, 0.2790333f, 0.8091053f, 6.3100000f, 50},
-{0.8118225f, 0.4467876f, 0.3759323f, 4.3600000f, 50},
-{0.8739037f, 0.4835906f, 0.0493195f, 5.3600000f, 36},
-{0.8214505f, 0.4580980f, -0.3396546f, 6.4600000f, 12},
-{0.8219266f, 0.4574159f, -0.3394221f, 7.0100000f, 52},
-{0.4098806f, 0.2182778f, 0.8856369f, 6.9900000f, 10},
-{0.5615265f, 0.3030360f, 0.7699722f, 4.2900000f, 20},
-{0.8134901f, 0.4447425f, 0.3747504f, 5.9000000f, 45},
-{0.8434673f, 0.4668442f, -0.2657431f, 6.3900000f, 52},
-{0.4096207f, 0.2343626f, -0.8816377f, 4.5100000f, 64},
-{0.8587244f, 0.4741472f, -0.1943628f, 5.6100000f, 50},
-{0.4222751f, 0.2406092f, -0.8739514f, 4.9700000f, 54},
-{0.8252060f, 0.4542080f, -0.3357530f, 6.1300000f, 50},
-{0.7799275f, 0.4207967f, 0.4632960f, 5.2000000f, 19},
-{0.7704491f, 0.4139411f, 0.4848308f, 5.2300000f, 31},
-{0.4441908f, 0.2325630f, 0.8652219f, 6.2800000f, 48},
-{0.0757050f, 0.0517708f, -0.9957854f, 6.4100000f, 19},
-{0.8718743f, 0.4736765f, -0.1243616f, 6.2600000f, 23},
-{0.5950018f, 0.3141680f, 0.7397779f, 4.0400000f, 13},
-{0.8280366f, 0.4506247f, -0.3336058f, 6.3400000f, 45},
-{0.7868151f, 0.4288816f, -0.4438273f, 5.5900000f, 31},
-{0.5102070f, 0.2673726f, 0.8174354f, 6.1800000f, 35},
-{0.6987598f, 0.3705405f, 0.6119106f, 6.0900000f, 51},
-{0.6963768f, 0.3678960f, 0.6162076f, 5.5100000f, 37},
-{0.8516153f, 0.4542428f, 0.2615622f, 6.0100000f, 33},
-{0.8428020f, 0.4481729f, 0.2980367f, 5.8900000f, 55},
-{0.2745212f, 0.1372478f, 0.9517359f, 6.0300000f, 51},
-{0.3271529f, 0.1651493f, 0.9304282f, 6.3200000f, 50},
-{0.8339804f, 0.4380043f, 0.3356023f, 5.5000000f, 52},
-{0.8609533f, 0.4528415f, 0.2317196f, 5.9500000f, 19},
-{0.6646283f, 0.3555558f, -0.6571524f, 6.5900000f, 50},
-{0.7405680f, 0.3814857f, 0.5531977f, 5.7200000f, 51},
-{0.7954434f, 0.4104198f, 0.4458984f, 5.4100000f, 32},
-{0.8529079f, 0.4473278f, -0.2691580f, 5.3700000f, 14},
-{0.0993295f, 0.0420521f, 0.9941656f, 5.5700000f, 15},
-{0.8842834f, 0.4584914f, -0.0884790f, 5.4400000f, 48},
-{0.6345182f, 0.3353754f, -0.6963548f, 6.5900000f, 32},
-{0.8855618f, 0.4544414f, 0.0962463f, 5.7200000f, 34},
-{0.8816386f, 0.4550720f, -0.1249917f, 5.7000000f, 49},
-{0.3895568f, 0.2085285f, -0.8970849f, 6.3800000f, 43},
-{0.8517898f, 0.4315614f, 0.2969999f, 6.0900000f, 50},
-{0.4824448f, 0.2378369f, 0.8430187f, 6.0800000f, 24},
-{0.8252528f, 0.4166242f, 0.3812900f, 6.1200000f, 19},
-{0.8871257f, 0.4526715f, -0.0899808f, 4.0400000f, 32},
-{0.7302804f, 0.3770738f, -0.5696541f, 6.4400000f, 51},
-{0.8384089f, 0.4290201f, -0.3361731f, 5.7900000f, 22},
-{0.7055254f, 0.3517876f, 0.6152067f, 6.4500000f, 49},
-{0.6807230f, 0.3511844f, -0.6428730f, 4.9300000f, 29},
-{0.5952165f, 0.2938566f, 0.7479075f, 4.1400000f, 40},
-{0.1071405f, 0.0443781f, 0.9932530f, 5.4600000f, 48},
-{0.4248335f, 0.2051591f, 0.8817178f, 5.7000000f, 15},
-{0.6819900f, 0.3367334f, 0.6492305f, 4.7100000f, 45},
-{0.8799504f, 0.4407424f, 0.1772947f, 6.2300000f, 18},
-{0.8832600f, 0.4426813f, 0.1545475f, 6.5100000f, 22},
-{0.8859645f, 0.4438917f, 0.1342648f, 5.2900000f, 32},
-{0.8725360f, 0.4358309f, 0.2207542f, 6.2500000f, 50},
-{0.8831474f, 0.4406098f, 0.1609770f, 4.8400000f, 45},
-{0.8941274f, 0.4475667f, -0.0148396f, 6.4400000f, 15},
-{0.4792927f, 0.2308311f, 0.8467559f, 5.7100000f, 51},
-{0.5340230f, 0.2583916f, 0.8050175f, 5.1900000f, 22},
-{0.8824650f, 0.4370760f, 0.1738392f, 5.2200000f, 19},
-{0.6456556f, 0.3271112f, -0.6900197f, 6.7100000f, 53},
-{0.1465277f, 0.0629179f, 0.9872036f, 5.4300000f, 46},
-{0.8827815f, 0.4382405f, -0.1692396f, 4.8700000f, 53},
-{0.8660994f, 0.4234936f, 0.2655655f, 6.3200000f, 35},
-{0.8871107f, 0.4349031f, 0.1545763f, 4.2900000f, 13},
-{0.8924508f, 0.4380283f, 0.1079945f, 6.9300000f, 45},
-{0.8925811f, 0.4378184f, 0.1077680f, 6.3100000f, 40},
-{0.6885300f, 0.3448089f, -0.6379916f, 6.3700000f, 53},
-{0.5768880f, 0.2744100f, 0.7693500f, 4.6100000f, 22},
-{0.8918955f, 0.4385206f, -0.1105535f, 4.4300000f, 51},
-{0.6681369f, 0.3331147f, -0.6653027f, 3.8600000f, 51},
-{0.3815251f, 0.1765487f, 0.9073418f, 5.2700000f, 45},
-{0.6694524f, 0.3188225f, 0.6709588f, 6.2200000f, 19},
-{0.8436863f, 0.4057668f, 0.3514922f, 4.9400000f, 23},
-{0.5810458f, 0.2733523f, 0.7665926f, 5.4500000f, 27},
-{0.8399976f, 0.3989201f, 0.3677865f, 5.6500000f, 30},
-{0.8971121f, 0.4311725f, -0.0963331f, 5.9400000f, 48},
-{0.5715532f, 0.2659379f, 0.7762757f, 5.5500000f, 11},
-{0.8909966f, 0.4230366f, 0.1648181f, 6.5400000f, 24},
-{0.4446436f, 0.2031202f, 0.8723728f, 5.3900000f, 60},
-{0.4270611f, 0.2119369f, -0.8790345f, 3.3500000f, 48},
-{0.6758753f, 0.3143046f, 0.6666373f, 5.9200000f, 50},
-{0.5715743f, 0.2786931f, -0.7717726f, 4.2500000f, 34},
-{0.8443281f, 0.3962537f, 0.3606842f, 5.3500000f, 19},
-{0.4235349f, 0.2092972f, -0.8813699f, 5.4500000f, 50},
-{0.8409826f, 0.3938929f, 0.3709402f, 5.3800000f, 20},
-{0.5020164f, 0.2291437f, 0.8339500f, 5.8800000f, 23},
-{0.7469356f, 0.3466763f, 0.5673648f, 4.9300000f, 48},
-{0.7692441f, 0.3580236f, 0.5292284f, 6.1600000f, 55},
-{0.8524111f, 0.4053700f, -0.3302581f, 6.0000000f, 48},
-{0.8724373f, 0.4077824f, 0.2693821f, 3.6500000f, 50},
-{0.7635805f, 0.3646387f, -0.5329009f, 3.5600000f, 19},
-{0.8055721f, 0.3741264f, 0.4594378f, 4.9500000f, 51},
-{0.8915216f, 0.4175006f, 0.1757342f, 6.3100000f, 50},
-{0.6258313f, 0.2866821f, 0.7253610f, 4.8500000f, 14},
-{0.8791828f, 0.4101487f, 0.2425193f, 5.5900000f, 30},
-{0.4611257f, 0.2078067f, 0.8626584f, 6.1900000f, 24},
-{0.8435578f, 0.3995438f, -0.3588522f, 6.0700000f, 20},
-{0.8589774f, 0.3986405f, 0.3213155f, 6.1200000f, 33},
-{0.4674444f, 0.2267730f, -0.8544412f, 4.4400000f, 52},
-{0.8761089f, 0.4057241f, 0.2604249f, 5.2600000f, 30},
-{0.4625674f, 0.2247312f, -0.8576289f, 6.3700000f, 20},
-{0.8814729f, 0.4069243f, 0.2396209f, 6.1700000f, 36},
-{0.7663045f, 0.3612083f, -0.5313247f, 6.3700000f, 23},
-{0.9023792f, 0.4174994f, 0.1067992f, 5.7700000f, 48},
-{0.8960654f, 0.4139612f, 0.1603215f, 6.5300000f, 24},
-{0.9029205f, 0.4179491f, -0.1002652f, 6.2700000f, 48},
-{0.9019492f, 0.4171730f, -0.1115990f, 5.8500000f, 15},
-{0.6539145f, 0.3074417f, -0.6912854f, 5.3400000f, 52},
-{0.5670830f, 0.2684627f, -0.7786814f, 6.0900000f, 37},
-{0.9089652f, 0.4168686f, 0.0017114f, 5.8600000f, 53},
-{0.8561859f, 0.3962937f, -0.3315071f, 5.3800000f, 22},
-{0.8827364f, 0.4020148f, 0.2432294f, 5.7200000f, 23},
-{0.8213787f, 0.3718091f, 0.4325448f, 5.3700000f, 19},
-{0.8511760f, 0.3862001f, 0.3554559f, 5.9100000f, 60},
-{0.6737836f, 0.3014039f, 0.6746639f, 6.2300000f, 21},
-{0.4130637f, 0.1977519f, -0.8889727f, 5.8700000f, 19},
-{0.8692482f, 0.3918644f, 0.3014132f, 3.7600000f, 50},
-{0.8287359f, 0.3797676f, -0.4110636f, 6.0100000f, 30},
-{0.8522057f, 0.3814778f, 0.3580783f, 5.9900000f, 18},
-{0.8736658f, 0.3916486f, 0.2886512f, 5.6400000f, 21},
-{0.7569107f, 0.3350743f, 0.5610805f, 5.7300000f, 18},
-{0.8325956f, 0.3707100f, 0.4115320f, 6.3600000f, 13},
-{0.7586372f, 0.3352977f, 0.5586100f, 5.7600000f, 34},
-{0.8716960f, 0.3876636f, 0.2997717f, 4.8000000f, 27},
-{0.9008831f, 0.4017350f, 0.1643734f, 5.1200000f, 23},
-{0.4925261f, 0.2115677f, 0.8441902f, 6.3200000f, 20},
-{0.9122700f, 0.4076960f, -0.0393373f, 5.1700000f, 22},
-{0.8387663f, 0.3774185f, -0.3924620f, 5.8300000f, 55},
-{0.8651468f, 0.3808915f, 0.3262557f, 5.9800000f, 34},
-{0.7520019f, 0.3382457f, -0.5657588f, 6.3900000f, 51},
-{0.8474899f, 0.3712799f, 0.3793575f, 4.2200000f, 27},
-{0.8481382f, 0.3713507f, 0.3778363f, 5.2800000f, 27},
-{0.8716847f, 0.3813280f, 0.3078225f, 4.2900000f, 22},
-{0.7825887f, 0.3398530f, 0.5215889f, 5.2800000f, 51},
-{0.8811611f, 0.3848706f, 0.2746446f, 6.4600000f, 37},
-{0.8458132f, 0.3664178f, 0.3877346f, 4.2800000f, 28},
-{0.7575685f, 0.3371460f, -0.5589477f, 3.9600000f, 54},
-{0.8837789f, 0.3826895f, 0.2692280f, 4.4900000f, 30},
-{0.4184791f, 0.1909582f, -0.8879247f, 5.2400000f, 48},
-{0.8880051f, 0.3833238f, 0.2539877f, 4.6900000f, 47},
-{0.9073762f, 0.3928840f, 0.1493676f, 6.0600000f, 16},
-{0.7654422f, 0.3370419f, -0.5481797f, 6.5500000f, 32},
-{0.8462361f, 0.3622967f, 0.3906731f, 5.5300000f, 17},
-{0.9182062f, 0.3944372f, 0.0362852f, 6.2300000f, 51},
-{0.2791037f, 0.1106294f, 0.9538670f, 5.9400000f, 28},
-{0.9020630f, 0.3853209f, 0.1944484f, 5.8800000f, 18},
-{0.8557666f, 0.3631926f, 0.3684491f, 5.7200000f, 20},
-{0.6606051f, 0.2895786f, -0.6926364f, 6.3900000f, 36},
-{0.4987035f, 0.2215071f, -0.8379913f, 6.2900000f, 44},
-{0.7955286f, 0.3341440f, 0.5054524f, 6.4000000f, 37},
-{0.8839538f, 0.3732149f, 0.2816670f, 4.9700000f, 52},
-{0.8908497f, 0.3763555f, 0.2544472f, 5.9000000f, 30},
-{0.8703970f, 0.3667008f, 0.3285416f, 3.5300000f, 49},
-{0.8398088f, 0.3610274f, -0.4054385f, 6.1100000f, 22},
-{0.8859529f, 0.3734442f, 0.2750035f, 3.8400000f, 50},
-{0.8864972f, 0.3732789f, 0.2734696f, 3.4000000f, 27},
-{0.9201228f, 0.3902847f, 0.0324332f, 6.1500000f, 49},
-{0.8981240f, 0.3773675f, 0.2257588f, 5.0300000f, 27},
-{0.9211469f, 0.3884684f, 0.0240978f, 5.5500000f, 13},
-{0.4471538f, 0.1965467f, -0.8725955f, 5.9400000f, 54},
-{0.5461806f, 0.2205881f, 0.8081013f, 5.7700000f, 10},
-{0.6492095f, 0.2785869f, -0.7077544f, 6.1000000f, 35},
-{0.7804516f, 0.3207299f, 0.5366820f, 6.2100000f, 19},
-{0.9078768f, 0.3773782f, 0.1826073f, 6.7900000f, 15},
-{0.8737710f, 0.3679726f, -0.3179942f, 5.9600000f, 51},
-{0.8899113f, 0.3679614f, 0.2695595f, 5.5800000f, 30},
-{0.8989287f, 0.3764218f, -0.2241290f, 5.6000000f, 11},
-{0.7094035f, 0.2887803f, 0.6429250f, 6.2600000f, 18},
-{0.9091649f, 0.3764025f, 0.1781582f, 6.4800000f, 48},
-{0.1600444f, 0.0763501f, -0.9841527f, 5.6900000f, 52},
-{0.8881211f, 0.3653244f, 0.2788887f, 4.7800000f, 26},
-{0.8904850f, 0.3659031f, 0.2704651f, 5.4800000f, 25},
-{0.7049387f, 0.2986602f, -0.6433223f, 6.4400000f, 61},
-{0.8985060f, 0.3693212f, 0.2372526f, 5.4000000f, 30},
-{0.9025640f, 0.3731086f, -0.2148679f, 6.2400000f, 45},
-{0.8917099f, 0.3608929f, 0.2731478f, 6.0200000f, 34},
-{0.6469482f, 0.2701822f, -0.7130635f, 6.1600000f, 51},
-{0.6790707f, 0.2694974f, 0.6828134f, 6.0900000f, 30},
-{0.4393295f, 0.1870162f, -0.8786436f, 5.7500000f, 50},
-{0.9231839f, 0.3726157f, 0.0942821f, 6.3900000f, 35},
-{0.9269846f, 0.3750986f, 0.0007660f, 4.9100000f, 53},
-{0.9048006f, 0.3681758f, -0.2139682f, 6.2100000f, 23},
-{0.7637162f, 0.3137226f, -0.5641947f, 5.9600000f, 50},
-{0.4056916f, 0.1549118f, 0.9007867f, 5.9400000f, 21},
-{0.9270984f, 0.3716421f, -0.0486900f, 5.8100000f, 19},
-{0.8841074f, 0.3502735f, 0.3092936f, 6.2500000f, 19},
-{0.6761899f, 0.2772050f, -0.6825867f, 5.0700000f, 12},
-{0.8991302f, 0.3548643f, 0.2561956f, 4.6500000f, 28},
-{0.8149506f, 0.3184189f, 0.4842159f, 5.8800000f, 19},
-{0.9175762f, 0.3623605f, 0.1635508f, 6.0100000f, 48},
-{0.9174089f, 0.3643087f, -0.1601253f, 6.0600000f, 50},
-{0.9262467f, 0.3642126f, 0.0970377f, 5.6800000f, 22},
-{0.9263598f, 0.3653076f, -0.0916947f, 5.7200000f, 19},
-{0.9270202f, 0.3640576f, -0.0899759f, 6.0900000f, 52},
-{0.9221842f, 0.3623597f, -0.1351728f, 5.1100000f, 63},
-{0.9237326f, 0.3629603f, -0.1223842f, 5.2600000f, 54},
-{0.8190320f, 0.3246498f, -0.4730634f, 4.5100000f, 50},
-{0.7025526f, 0.2672606f, 0.6595390f, 4.2500000f, 54},
-{0.8775115f, 0.3381124f, 0.3400787f, 6.3600000f, 45},
-{0.1511267f, 0.0696983f, -0.9860542f, 5.7900000f, 30},
-{0.8949729f, 0.3439064f, 0.2841687f, 0.8500000f, 55},
-{0.9184065f, 0.3541304f, 0.1764119f, 4.2500000f, 25},
-{0.8578770f, 0.3272197f, 0.3962000f, 6.0200000f, 35},
-{0.9226964f, 0.3577360f, -0.1437229f, 6.3700000f, 21},
-{0.8860045f, 0.3445112f, -0.3103354f, 6.1300000f, 53},
-{0.9328113f, 0.3579482f, -0.0416674f, 6.3300000f, 17},
-{0.9330803f, 0.3566897f, -0.0461912f, 3.9300000f, 12},
-{0.8124314f, 0.3136949f, -0.4914781f, 3.8200000f, 48},
-{0.5342610f, 0.2104600f, -0.8187013f, 3.2700000f, 20},
-{0.5592776f, 0.2036479f, 0.8035770f, 5.3500000f, 28},
-{0.5643971f, 0.2056701f, 0.7994721f, 5.0500000f, 50},
-{0.2195947f, 0.0734700f, 0.9728208f, 6.4900000f, 37},
-{0.9353457f, 0.3533056f, 0.0174233f, 5.3100000f, 17},
-{0.8356960f, 0.3104052f, 0.4530572f, 6.4700000f, 32},
-{0.8766685f, 0.3266253f, 0.3532254f, 5.9200000f, 18},
-{0.9004666f, 0.3359693f, 0.2761965f, 5.7900000f, 30},
-{0.9146670f, 0.3412599f, 0.2166242f, 4.2700000f, 26},
-{0.9357298f, 0.3517100f, -0.0266422f, 5.2300000f, 30},
-{0.4482331f, 0.1775435f, -0.8761081f, 5.7900000f, 51},
-{0.8154311f, 0.3095564f, -0.4891288f, 6.3000000f, 19},
-{0.8492979f, 0.3117026f, 0.4260688f, 6.2200000f, 25},
-{0.9029684f, 0.3324365f, 0.2722756f, 5.0700000f, 24},
-{0.9026151f, 0.3317624f, 0.2742623f, 4.6900000f, 25},
-{0.9295074f, 0.3424373f, 0.1369403f, 5.3900000f, 25},
-{0.9103050f, 0.3395345f, -0.2367722f, 3.8700000f, 52},
-{0.6264816f, 0.2236912f, 0.7466479f, 5.6700000f, 20},
-{0.9179487f, 0.3391346f, -0.2058104f, 5.0100000f, 22},
-{0.9185608f, 0.3340716f, 0.2112869f, 5.4600000f, 18},
-{0.1410039f, 0.0636299f, -0.9879621f, 6.7600000f, 27},
-{0.4790853f, 0.1665969f, 0.8618136f, 6.5000000f, 27},
-{0.9122089f, 0.3350477f, -0.2358347f, 5.4500000f, 51},
-{0.9392455f, 0.3428478f, -0.0165314f, 6.1000000f, 50},
-{0.7397788f, 0.2625568f, 0.6195089f, 5.9900000f, 40},
-{0.8266448f, 0.2954528f, 0.4789217f, 5.7800000f, 22},
-{0.2313028f, 0.0742205f, 0.9700466f, 6.0600000f, 29},
-{0.4399610f, 0.1672134f, -0.8823118f, 5.4000000f, 68},
-{0.6075106f, 0.2110821f, 0.7657514f, 5.8700000f, 19},
-{0.6862479f, 0.2399677f, 0.6866435f, 5.2900000f, 21},
-{0.8617951f, 0.3131852f, -0.3990292f, 5.5800000f, 46},
-{0.8926461f, 0.3229498f, -0.3144619f, 4.3200000f, 64},
-{0.8683107f, 0.3064407f, 0.3900393f, 4.2800000f, 13},
-{0.5990125f, 0.2207746f, -0.7697030f, 6.4400000f, 52},
-{0.8621731f, 0.3001139f, 0.4081534f, 6.1300000f, 37},
-{0.7161246f, 0.2458303f, 0.6532481f, 6.0800000f, 18},
-{0.7939543f, 0.2741362f, 0.5426655f, 6.4500000f, 28},
-{0.7190480f, 0.2597182f, -0.6446056f, 4.4500000f, 32},
-{0.7543227f, 0.2669036f, -0.5997997f, 5.0500000f, 31},
-{0.5112645f, 0.1853149f, -0.8392062f, 6.5300000f, 45},
-{0.9374514f, 0.3247286f, -0.1254439f, 6.8200000f, 34},
-{0.9374684f, 0.3246963f, -0.1254006f, 6.7000000f, 48},
-{0.9282813f, 0.3176860f, 0.1933116f, 5.4000000f, 30},
-{0.9375617f, 0.3224242f, -0.1304637f, 5.9000000f, 12},
-{0.8240335f, 0.2871403f, -0.4883843f, 5.6800000f, 52},
-{0.3116766f, 0.0973650f, 0.9451866f, 6.3700000f, 20},
-{0.5213613f, 0.1693880f, 0.8363553f, 5.3000000f, 23},
-{0.8684518f, 0.2918094f, 0.4007977f, 6.3500000f, 15},
-{0.9027610f, 0.3102582f, -0.2979303f, 5.5300000f, 23},
-{0.7238971f, 0.2396163f, 0.6469598f, 5.9700000f, 49},
-{0.5373701f, 0.1742998f, 0.8251381f, 6.2600000f, 30},
-{0.6126916f, 0.2146416f, -0.7606169f, 5.3100000f, 50},
-{0.8984425f, 0.2993946f, 0.3211915f, 6.0100000f, 54},
-{0.7140091f, 0.2467711f, -0.6552061f, 6.2500000f, 53},
-{0.9286399f, 0.3105909f, 0.2028822f, 5.3700000f, 22},
-{0.9465439f, 0.3189994f, -0.0478958f, 4.0200000f, 15},
-{0.8857961f, 0.3003856f, -0.3537424f, 5.7200000f, 52},
-{0.9487203f, 0.3155896f, -0.0182474f, 6.3300000f, 22},
-{0.1479343f, 0.0394003f, 0.9882121f, 5.0700000f, 53},
-{0.7860430f, 0.2636675f, -0.5591206f, 6.8600000f, 20},
-{0.8385236f, 0.2788178f, -0.4681226f, 6.1900000f, 23},
-{0.7406037f, 0.2480781f, -0.6244705f, 6.0500000f, 51},
-{0.4266715f, 0.1302702f, 0.8949755f, 5.4400000f, 63},
-{0.8028067f, 0.2557581f, 0.5385992f, 5.8600000f, 28},
-{0.8128374f, 0.2593574f, 0.5215640f, 5.5800000f, 52},
-{0.4975655f, 0.1704720f, -0.8505104f, 5.2700000f, 28},
-{0.2212728f, 0.0823327f, -0.9717303f, 6.0500000f, 52},
-{0.9178522f, 0.2999782f, -0.2599240f, 5.5100000f, 42},
-{0.7566590f, 0.2389004f, 0.6085999f, 4.8800000f, 53},
-{0.9501873f, 0.3053309f, 0.0625873f, 6.0300000f, 51},
-{0.6299354f, 0.1951331f, 0.7517343f, 5.6600000f, 49},
-{0.9491569f, 0.3056320f, -0.0754332f, 5.7800000f, 38},
-{0.9168750f, 0.2902556f, 0.2740292f, 6.0800000f, 53},
-{0.9164070f, 0.2953660f, -0.2701057f, 5.7700000f, 36},
-{0.8236047f, 0.2682942f, -0.4996935f, 6.3700000f, 51},
-{0.4332542f, 0.1471438f, -0.8891791f, 6.4600000f, 50},
-{0.3373047f, 0.1176847f, -0.9340106f, 5.5400000f, 18},
-{0.3847647f, 0.1138812f, 0.9159624f, 4.2900000f, 9},
-{0.9464776f, 0.2991499f, 0.1212004f, 3.1900000f, 36},
-{0.9430229f, 0.2945693f, 0.1547152f, 4.3600000f, 21},
-{0.9316903f, 0.2950873f, -0.2118413f, 6.2600000f, 35},
-{0.5785270f, 0.1736673f, 0.7969606f, 6.4100000f, 22},
-{0.9043133f, 0.2791752f, 0.3229219f, 5.1000000f, 27},
-{0.7071127f, 0.2278348f, -0.6693900f, 6.7200000f, 48},
-{0.9180054f, 0.2885948f, -0.2719910f, 5.0300000f, 50},
-{0.7048278f, 0.2128112f, 0.6767047f, 5.7100000f, 23},
-{0.7673562f, 0.2322875f, 0.5976679f, 4.7800000f, 52},
-{0.9507196f, 0.2942666f, 0.0976697f, 3.6900000f, 12},
-{0.9415004f, 0.2890888f, 0.1732185f, 6.1100000f, 15},
-{0.8460489f, 0.2554976f, 0.4678913f, 5.9700000f, 32},
-{0.5471350f, 0.1593415f, 0.8217381f, 5.5200000f, 19},
-{0.9275348f, 0.2812173f, 0.2461627f, 4.7400000f, 33},
-{0.7235398f, 0.2271944f, -0.6518227f, 6.0700000f, 32},
-{0.6897662f, 0.2015221f, 0.6954217f, 6.0800000f, 20},
-{0.8006040f, 0.2467952f, -0.5460085f, 5.8600000f, 21},
-{0.9544255f, 0.2877264f, -0.0792807f, 4.3900000f, 34},
-{0.5803354f, 0.1660843f, 0.7972621f, 5.7500000f, 22},
-{0.9571302f, 0.2863336f, 0.0437598f, 5.3300000f, 61},
-{0.5808056f, 0.1805672f, -0.7937634f, 5.6100000f, 30},
-{0.5807980f, 0.1805139f, -0.7937811f, 6.4200000f, 34},
-{0.9583733f, 0.2842015f, 0.0273885f, 6.6100000f, 21},
-{0.9050325f, 0.2639143f, 0.3335646f, 6.3700000f, 33},
-{0.9582610f, 0.2827056f, 0.0425829f, 3.7200000f, 13},
-{0.5692793f, 0.1597849f, 0.8064675f, 4.4700000f, 21},
-{0.9407609f, 0.2751794f, 0.1981041f, 5.1900000f, 23},
-{0.9448981f, 0.2758750f, 0.1762401f, 4.6500000f, 20},
-{0.9509683f, 0.2780976f, 0.1353553f, 5.3300000f, 51},
-{0.2625817f, 0.0674989f, 0.9625460f, 6.0600000f, 55},
-{0.7763294f, 0.2213935f, 0.5901674f, 6.0700000f, 12},
-{0.9598284f, 0.2804689f, 0.0081593f, 5.9900000f, 15},
-{0.8743519f, 0.2496433f, 0.4161574f, 6.3700000f, 30},
-{0.9281456f, 0.2668502f, 0.2594933f, 5.8100000f, 19},
-{0.8056532f, 0.2272430f, 0.5470682f, 2.6900000f, 53},
-{0.9569650f, 0.2745258f, 0.0940938f, 6.5000000f, 20},
-{0.9263357f, 0.2695053f, -0.2631902f, 5.7000000f, 49},
-{0.9350788f, 0.2664892f, 0.2336905f, 4.0700000f, 52},
-{0.9251279f, 0.2682931f, -0.2686210f, 5.7200000f, 44},
-{0.9583320f, 0.2729730f, -0.0841754f, 5.5100000f, 16},
-{0.8757421f, 0.2531702f, -0.4110724f, 6.7200000f, 30},
-{0.7525995f, 0.2196716f, -0.6207564f, 6.1000000f, 53},
-{0.9200622f, 0.2578744f, 0.2949345f, 5.4800000f, 51},
-{0.8804704f, 0.2449554f, 0.4059171f, 5.7900000f, 48},
-{0.2713549f, 0.0673840f, 0.9601177f, 6.6600000f, 50},
-{0.5790572f, 0.1557764f, 0.8002665f, 6.0800000f, 54},
-{0.2665509f, 0.0656397f, 0.9615831f, 5.9600000f, 21},
-{0.8731534f, 0.2415042f, 0.4234134f, 5.8100000f, 20},
-{0.9626664f, 0.2702006f, -0.0162793f, 6.2300000f, 32},
-{0.7616309f, 0.2067283f, 0.6141513f, 4.9400000f, 21},
-{0.4680004f, 0.1219086f, 0.8752794f, 6.0300000f, 34},
-{0.3813988f, 0.0971464f, 0.9192919f, 6.1900000f, 36},
-{0.9356529f, 0.2605936f, -0.2380014f, 6.1500000f, 11},
-{0.9633710f, 0.2663518f, -0.0311927f, 6.3500000f, 22},
-{0.5164249f, 0.1508094f, -0.8429483f, 6.1200000f, 33},
-{0.4000322f, 0.1194290f, -0.9086864f, 6.4100000f, 60},
-{0.7467253f, 0.1990197f, 0.6346593f, 5.9500000f, 35},
-{0.9338648f, 0.2546446f, 0.2511028f, 6.0900000f, 17},
-{0.9638356f, 0.2648135f, 0.0299134f, 4.4700000f, 52},
-{0.7440024f, 0.1980101f, 0.6381633f, 6.5800000f, 54},
-{0.4783434f, 0.1205547f, 0.8698587f, 4.0300000f, 41},
-{0.9291615f, 0.2532241f, -0.2693260f, 5.6600000f, 33},
-{0.6984725f, 0.1807403f, 0.6924370f, 2.9900000f, 30},
-{0.3024118f, 0.0908837f, -0.9488347f, 6.2800000f, 36},
-{0.9399954f, 0.2535936f, -0.2282517f, 7.7100000f, 36},
-{0.9518338f, 0.2557554f, -0.1691201f, 5.3800000f, 44},
-{0.9646132f, 0.2560179f, 0.0630566f, 7.0300000f, 19},
-{0.9646366f, 0.2559264f, 0.0630712f, 6.6600000f, 19},
-{0.9465829f, 0.2539460f, -0.1987265f, 4.7900000f, 30},
-{0.7302213f, 0.1872230f, 0.6570573f, 3.7500000f, 54},
-{0.9661200f, 0.2558763f, -0.0337560f, 6.3200000f, 28},
-{0.9641875f, 0.2546743f, -0.0740505f, 6.2200000f, 53},
-{0.7268134f, 0.1835409f, 0.6618572f, 6.1400000f, 22},
-{0.0702898f, 0.0086928f, 0.9974887f, 6.5100000f, 25},
-{0.9606727f, 0.2509603f, -0.1188565f, 4.8100000f, 13},
-{0.9678939f, 0.2510429f, 0.0126048f, 5.9200000f, 50},
-{0.9677660f, 0.2502813f, 0.0280767f, 6.2400000f, 18},
-{0.9013252f, 0.2285098f, 0.3679623f, 4.6400000f, 27},
-{0.9094694f, 0.2376337f, -0.3411681f, 4.9100000f, 19},
-{0.5012818f, 0.1200194f, 0.8569200f, 5.0800000f, 12},
-{0.5006068f, 0.1197154f, 0.8573570f, 6.0800000f, 50},
-{0.4691309f, 0.1115573f, 0.8760543f, 6.0400000f, 55},
-{0.9668514f, 0.2466345f, -0.0661046f, 5.8500000f, 53},
-{0.8362998f, 0.2075765f, 0.5074590f, 6.1400000f, 50},
-{0.8205161f, 0.2022405f, 0.5346515f, 6.6200000f, 24},
-{0.8723528f, 0.2249426f, -0.4340522f, 5.0200000f, 51},
-{0.2797472f, 0.0812917f, -0.9566259f, 5.4700000f, 54},
-{0.5661750f, 0.1349689f, 0.8131600f, 7.2400000f, 45},
-{0.7596027f, 0.1979502f, -0.6195317f, 6.0300000f, 45},
-{0.8597114f, 0.2118350f, 0.4647819f, 6.6000000f, 30},
-{0.9045039f, 0.2240096f, 0.3628944f, 6.1900000f, 50},
-{0.9033539f, 0.2304789f, -0.3617059f, 5.7500000f, 51},
-{0.8368599f, 0.2149469f, -0.5034515f, 5.9400000f, 48},
-{0.3395514f, 0.0758806f, 0.9375217f, 6.4100000f, 51},
-{0.6044405f, 0.1432272f, 0.7836694f, 5.0000000f, 30},
-{0.9360144f, 0.2309107f, 0.2656262f, 4.6800000f, 20},
-{0.7873102f, 0.1889620f, 0.5868867f, 6.5200000f, 25},
-{0.9428309f, 0.2356568f, -0.2356604f, 6.4100000f, 12},
-{0.7316331f, 0.1739117f, 0.6591417f, 3.1700000f, 13},
-{0.9143999f, 0.2214912f, 0.3388428f, 6.4400000f, 25},
-{0.2705824f, 0.0570535f, 0.9610047f, 5.4300000f, 19},
-{0.7097302f, 0.1676859f, 0.6842254f, 6.2000000f, 32},
-{0.8889518f, 0.2221007f, -0.4005445f, 5.6100000f, 23},
-{0.9699509f, 0.2377567f, -0.0516436f, 6.0500000f, 15},
-{0.4137405f, 0.0922135f, 0.9057127f, 6.4100000f, 36},
-{0.9715451f, 0.2359616f, 0.0205498f, 6.1700000f, 36},
-{0.6376687f, 0.1625101f, -0.7529735f, 5.3800000f, 32},
-{0.2293315f, 0.0460401f, 0.9722589f, 6.3700000f, 20},
-{0.7404259f, 0.1849521f, -0.6461906f, 6.3100000f, 38},
-{0.7998387f, 0.1979154f, -0.5666459f, 4.5500000f, 53},
-{0.8019879f, 0.1983420f, -0.5634500f, 6.3400000f, 31},
-{0.9033939f, 0.2191313f, -0.3685933f, 3.1900000f, 55},
-{0.8744181f, 0.2128772f, -0.4359773f, 5.7300000f, 52},
-{0.9227186f, 0.2153601f, 0.3197036f, 5.0000000f, 44},
-{0.9714824f, 0.2298203f, -0.0583481f, 5.1200000f, 19},
-{0.9129726f, 0.2115877f, 0.3488719f, 5.3000000f, 25},
-{0.8883852f, 0.2046508f, 0.4109620f, 5.5000000f, 12},
-{0.9052208f, 0.2092987f, 0.3698233f, 5.8900000f, 12},
-{0.9485155f, 0.2250427f, -0.2228768f, 6.0500000f, 20},
-{0.9607345f, 0.2234005f, 0.1645646f, 6.1700000f, 41},
-{0.6445947f, 0.1578307f, -0.7480555f, 5.0300000f, 55},
-{0.9635566f, 0.2229787f, 0.1477806f, 5.3400000f, 20},
-{0.9542131f, 0.2228572f, -0.1995295f, 5.9700000f, 37},
-{0.9706423f, 0.2247597f, -0.0856536f, 2.7900000f, 23},
-{0.5765212f, 0.1410472f, -0.8048161f, 6.2700000f, 62},
-{0.6667605f, 0.1456364f, 0.7309039f, 5.6800000f, 35},
-{0.7768334f, 0.1711000f, 0.6060154f, 6.0200000f, 53},
-{0.8615661f, 0.1919843f, 0.4699424f, 6.0100000f, 25},
-{0.9667231f, 0.2216903f, -0.1276705f, 5.7800000f, 18},
-{0.9613336f, 0.2160876f, 0.1707159f, 5.4300000f, 22},
-{0.9732138f, 0.2214363f, -0.0618131f, 5.1200000f, 32},
-{0.5360251f, 0.1299010f, -0.8341480f, 4.7200000f, 37},
-{0.4619179f, 0.0959669f, 0.8817155f, 6.1700000f, 22},
-{0.9400708f, 0.2097001f, 0.2688731f, 4.8200000f, 32},
-{0.3204745f, 0.0818120f, -0.9437176f, 5.3100000f, 48},
-{0.4493810f, 0.0924048f, 0.8885483f, 6.5000000f, 27},
-{0.9676933f, 0.2183157f, -0.1261268f, 4.2700000f, 12},
-{0.8053007f, 0.1850056f, -0.5632617f, 6.5200000f, 51},
-{0.9762988f, 0.2162019f, 0.0098658f, 6.1000000f, 50},
-{0.2058290f, 0.0549400f, -0.9770445f, 6.2900000f, 55},
-{0.2831243f, 0.0521908f, 0.9576621f, 5.7400000f, 20},
-{0.9397729f, 0.2010696f, 0.2764016f, 5.1800000f, 55},
-{0.9767465f, 0.2122212f, -0.0304707f, 6.2500000f, 51},
-{0.1843600f, 0.0303898f, 0.9823889f, 5.0500000f, 36},
-{0.9771873f, 0.2107399f, -0.0263369f, 5.9000000f, 35},
-{0.4992599f, 0.0988825f, 0.8607914f, 6.1500000f, 52},
-{0.7666710f, 0.1579735f, 0.6223021f, 4.8600000f, 24},
-{0.9778260f, 0.2092261f, 0.0089835f, 6.6700000f, 19},
-{0.9777646f, 0.2089230f, 0.0180971f, 5.8900000f, 45},
-{0.5871894f, 0.1174963f, 0.8008766f, 6.2000000f, 20},
-{0.9622797f, 0.2072613f, -0.1762401f, 5.6800000f, 66},
-{0.8918968f, 0.1947028f, -0.4081800f, 6.4100000f, 51},
-{0.4482042f, 0.1043691f, -0.8878176f, 5.2000000f, 63},
-{0.9631626f, 0.2034165f, -0.1758965f, 4.4500000f, 18},
-{0.9736097f, 0.2033829f, -0.1035352f, 5.9100000f, 47},
-{0.9780831f, 0.2021433f, 0.0499151f, 4.4600000f, 50},
-{0.7849322f, 0.1682809f, -0.5962910f, 6.5700000f, 55},
-{0.2849527f, 0.0682073f, -0.9561118f, 6.2700000f, 21},
-{0.9789331f, 0.2012726f, 0.0343423f, 6.0900000f, 25},
-{0.9420225f, 0.1962340f, -0.2721869f, 3.3100000f, 19},
-{0.9796919f, 0.2002704f, 0.0097785f, 6.3200000f, 60},
-{0.9703514f, 0.1993831f, -0.1366185f, 6.3700000f, 15},
-{0.9610676f, 0.1988890f, -0.1918131f, 4.3600000f, 19},
-{0.8257444f, 0.1627281f, 0.5400608f, 5.0200000f, 29},
-{0.5833391f, 0.1099683f, 0.8047499f, 6.5000000f, 67},
-{0.6823155f, 0.1304981f, 0.7193162f, 0.0800000f, 45},
-{0.9765912f, 0.1954302f, 0.0898697f, 5.5000000f, 54},
-{0.9532721f, 0.1939526f, -0.2316347f, 6.2100000f, 32},
-{0.9078931f, 0.1786907f, 0.3792094f, 6.2700000f, 22},
-{0.8110131f, 0.1565313f, 0.5636983f, 5.9600000f, 9},
-{0.9713234f, 0.1952431f, -0.1356868f, 0.1200000f, 18},
-{0.0753463f, 0.0053310f, 0.9971432f, 6.6000000f, 22},
-{0.8105600f, 0.1657392f, -0.5617144f, 6.9800000f, 54},
-{0.1420886f, 0.0388388f, -0.9890917f, 5.8500000f, 48},
-{0.9809933f, 0.1937675f, -0.0103118f, 6.1500000f, 30},
-{0.9625145f, 0.1867961f, 0.1966545f, 5.5600000f, 20},
-{0.5199426f, 0.0929358f, 0.8491305f, 6.1300000f, 15},
-{0.4525205f, 0.0790249f, 0.8882456f, 5.6100000f, 54},
-{0.8125208f, 0.1635378f, -0.5595224f, 5.7600000f, 48},
-{0.7216883f, 0.1328941f, 0.6793417f, 5.4800000f, 64},
-{0.8887939f, 0.1751599f, -0.4235144f, 5.0700000f, 19},
-{0.9816259f, 0.1877657f, 0.0339789f, 6.4200000f, 20},
-{0.7484669f, 0.1364469f, 0.6489834f, 6.1800000f, 50},
-{0.8212540f, 0.1515495f, 0.5500678f, 4.5400000f, 52},
-{0.6036612f, 0.1231226f, -0.7876763f, 6.0500000f, 53},
-{0.8175898f, 0.1503693f, 0.5558201f, 6.1400000f, 19},
-{0.7528070f, 0.1356492f, 0.6441125f, 4.7100000f, 41},
-{0.8224253f, 0.1606703f, -0.5457120f, 6.6600000f, 22},
-{0.9400745f, 0.1793217f, -0.2900063f, 6.5600000f, 13},
-{0.8182158f, 0.1479575f, 0.5555460f, 5.4100000f, 20},
-{0.7033316f, 0.1238950f, 0.6999819f, 6.6200000f, 50},
-{0.8161974f, 0.1461464f, 0.5589839f, 6.4900000f, 27},
-{0.9789641f, 0.1831787f, -0.0898600f, 3.6000000f, 15},
-{0.6724270f, 0.1165865f, 0.7309237f, 6.5400000f, 40},
-{0.9597638f, 0.1793115f, -0.2161035f, 5.5000000f, 49},
-{0.7424124f, 0.1300836f, 0.6571926f, 5.5200000f, 23},
-{0.9119636f, 0.1637732f, 0.3761659f, 4.9400000f, 48},
-{0.8168550f, 0.1439784f, 0.5585858f, 5.0300000f, 25},
-{0.9240799f, 0.1660809f, 0.3442287f, 6.0800000f, 48},
-{0.6066217f, 0.1188816f, -0.7860517f, 6.4900000f, 52},
-{0.8233017f, 0.1545043f, -0.5461710f, 4.8300000f, 50},
-{0.3857184f, 0.0789019f, -0.9192365f, 4.8300000f, 52},
-{0.2064453f, 0.0277031f, 0.9780659f, 6.5600000f, 27},
-{0.9831754f, 0.1769602f, 0.0452903f, 5.3400000f, 35},
-{0.9364474f, 0.1700125f, -0.3068583f, 5.9600000f, 40},
-{0.9844412f, 0.1754148f, -0.0102585f, 6.3400000f, 11},
-{0.7350972f, 0.1236506f, 0.6665903f, 5.2300000f, 13},
-{0.8705319f, 0.1496304f, 0.4688122f, 6.3300000f, 19},
-{0.5298402f, 0.0851907f, 0.8438080f, 5.2800000f, 20},
-{0.8573264f, 0.1465006f, 0.4934865f, 5.7600000f, 21},
-{0.9388148f, 0.1685318f, -0.3003729f, 6.3600000f, 13},
-{0.9387715f, 0.1684677f, -0.3005440f, 6.5400000f, 18},
-{0.9271687f, 0.1595528f, 0.3389705f, 6.1800000f, 50},
-{0.9599301f, 0.1710976f, -0.2219456f, 4.2900000f, 10},
-{0.9643893f, 0.1701129f, -0.2025214f, 5.3000000f, 17},
-{0.8799176f, 0.1575494f, -0.4482445f, 5.9900000f, 20},
-{0.9819199f, 0.1711959f, -0.0807788f, 6.3900000f, 18},
-{0.7444770f, 0.1217849f, 0.6564468f, 5.5400000f, 23},
-{0.9833771f, 0.1675545f, 0.0699644f, 6.5700000f, 15},
-{0.9211800f, 0.1605715f, -0.3544633f, 4.7100000f, 20},
-{0.9754376f, 0.1644284f, 0.1465770f, 5.8000000f, 11},
-{0.9859190f, 0.1670655f, 0.0072673f, 5.6800000f, 13},
-{0.9860915f, 0.1660695f, 0.0066758f, 4.7300000f, 12},
-{0.8233156f, 0.1439014f, -0.5490390f, 6.3400000f, 32},
-{0.6406533f, 0.1147860f, -0.7592019f, 5.4500000f, 37},
-{0.8640079f, 0.1392360f, 0.4838425f, 6.4600000f, 19},
-{0.9637455f, 0.1619242f, -0.2120734f, 6.5600000f, 18},
-{0.9849915f, 0.1611514f, 0.0618228f, 5.0000000f, 11},
-{0.9061945f, 0.1525800f, -0.3943741f, 5.0600000f, 47},
-{0.8205419f, 0.1399569f, -0.5541868f, 6.0900000f, 15},
-{0.7851364f, 0.1220601f, 0.6071755f, 4.9900000f, 54},
-{0.9457886f, 0.1513709f, 0.2873512f, 6.0800000f, 22},
-{0.8449892f, 0.1314217f, 0.5183836f, 6.2800000f, 51},
-{0.8457129f, 0.1315216f, 0.5171766f, 5.9400000f, 19},
-{0.9831002f, 0.1578265f, 0.0927616f, 6.3500000f, 22},
-{0.9785757f, 0.1580200f, -0.1319825f, 5.9000000f, 18},
-{0.8111653f, 0.1240654f, 0.5715055f, 6.5500000f, 51},
-{0.9428521f, 0.1475483f, 0.2987632f, 4.9900000f, 38},
-{0.9874823f, 0.1577051f, 0.0027877f, 5.7000000f, 11},
-{0.9874772f, 0.1570342f, 0.0151353f, 6.1100000f, 37},
-{0.9655096f, 0.1550673f, -0.2091540f, 5.2500000f, 12},
-{0.9818901f, 0.1557503f, -0.1078596f, 4.1400000f, 48},
-{0.8924956f, 0.1445527f, -0.4272658f, 6.4900000f, 36},
-{0.9872638f, 0.1537041f, 0.0410522f, 6.3200000f, 14},
-{0.9878954f, 0.1543396f, 0.0155570f, 5.0800000f, 49},
-{0.9876249f, 0.1543195f, -0.0279749f, 3.3600000f, 11},
-{0.9876797f, 0.1531363f, 0.0322200f, 4.9500000f, 11},
-{0.9823850f, 0.1506258f, 0.1105968f, 1.6400000f, 12},
-{0.8684416f, 0.1286598f, 0.4788068f, 1.6500000f, 17},
-{0.9542370f, 0.1491167f, -0.2592218f, 5.6500000f, 21},
-{0.7745619f, 0.1247581f, -0.6200720f, 5.7100000f, 61},
-{0.8060709f, 0.1172159f, 0.5800950f, 6.1500000f, 52},
-{0.8165602f, 0.1190687f, 0.5648470f, 5.9400000f, 20},
-{0.8274346f, 0.1205069f, 0.5484797f, 6.1500000f, 50},
-{0.7920895f, 0.1266949f, -0.5971119f, 6.8200000f, 51},
-{0.9473589f, 0.1411823f, 0.2873652f, 6.2500000f, 12},
-{0.9743335f, 0.1498482f, -0.1679876f, 5.6100000f, 55},
-{0.9886595f, 0.1498737f, 0.0094974f, 6.5700000f, 19},
-{0.5535892f, 0.0917247f, -0.8277231f, 6.1100000f, 18},
-{0.4491135f, 0.0587880f, 0.8915386f, 5.4200000f, 61},
-{0.9888348f, 0.1487382f, 0.0090901f, 6.1600000f, 12},
-{0.8553306f, 0.1234900f, 0.5031498f, 5.7400000f, 19},
-{0.8161653f, 0.1159819f, 0.5660586f, 5.0700000f, 53},
-{0.9860175f, 0.1471854f, -0.0781401f, 6.2300000f, 19},
-{0.9823267f, 0.1439772f, 0.1196026f, 6.4200000f, 20},
-{0.9415158f, 0.1358073f, 0.3083899f, 5.4200000f, 15},
-{0.9549062f, 0.1374765f, 0.2631622f, 6.1600000f, 21},
-{0.9183615f, 0.1305591f, 0.3735860f, 4.8800000f, 12},
-{0.9881050f, 0.1439875f, 0.0540014f, 4.5900000f, 12},
-{0.9389707f, 0.1403441f, -0.3140661f, 5.8900000f, 32},
-{0.7136332f, 0.1100724f, -0.6918177f, 6.0800000f, 51},
-{0.9523632f, 0.1348631f, 0.2735256f, 5.5000000f, 19},
-{0.1622066f, 0.0341613f, -0.9861653f, 6.5100000f, 51},
-{0.9457981f, 0.1328110f, 0.2963564f, 5.7700000f, 61},
-{0.9743667f, 0.1409292f, -0.1753524f, 6.3500000f, 37},
-{0.6126926f, 0.0949320f, -0.7845991f, 6.2700000f, 20},
-{0.9625196f, 0.1327902f, 0.2364802f, 6.3500000f, 24},
-{0.9900300f, 0.1390222f, 0.0226583f, 6.4100000f, 12},
-{0.8970718f, 0.1209900f, 0.4249983f, 5.4700000f, 18},
-{0.8654074f, 0.1151754f, 0.4876523f, 6.2400000f, 36},
-{0.9265772f, 0.1318371f, -0.3522410f, 6.0700000f, 47},
-{0.7433255f, 0.0951892f, 0.6621224f, 6.0000000f, 50},
-{0.7617492f, 0.0977456f, 0.6404560f, 6.3700000f, 49},
-{0.9897397f, 0.1349396f, -0.0469757f, 6.3900000f, 20},
-{0.7685331f, 0.1111296f, -0.6300849f, 5.8700000f, 27},
-{0.5375235f, 0.0646588f, 0.8407661f, 6.4800000f, 38},
-{0.9350949f, 0.1303998f, -0.3295350f, 2.8400000f, 45},
-{0.9901117f, 0.1330179f, -0.0445542f, 5.7900000f, 51},
-{0.9165999f, 0.1177308f, 0.3820787f, 6.2900000f, 50},
-{0.9562669f, 0.1240489f, 0.2648877f, 5.9400000f, 23},
-{0.9909121f, 0.1308373f, 0.0312218f, 5.7800000f, 12},
-{0.9911679f, 0.1316632f, -0.0158430f, 4.7100000f, 55},
-{0.7933785f, 0.1106020f, -0.5985965f, 5.5700000f, 21},
-{0.5375015f, 0.0795590f, -0.8395013f, 5.1400000f, 46},
-{0.9889634f, 0.1287511f, 0.0733107f, 6.2100000f, 52},
-{0.8591789f, 0.1165028f, -0.4982355f, 6.7500000f, 48},
-{0.9865461f, 0.1264451f, 0.1036268f, 4.2000000f, 15},
-{0.9851373f, 0.1281874f, -0.1143351f, 6.3300000f, 12},
-{0.9905001f, 0.1249463f, 0.0574285f, 5.4600000f, 11},
-{0.8402836f, 0.1004643f, 0.5327573f, 4.7600000f, 15},
-{0.2570702f, 0.0227978f, 0.9661238f, 6.1700000f, 60},
-{0.9408417f, 0.1146320f, 0.3188674f, 4.3800000f, 62},
-{0.7369099f, 0.0856598f, 0.6705417f, 6.5500000f, 19},
-{0.9490019f, 0.1155281f, 0.2933405f, 5.4600000f, 17},
-{0.9879670f, 0.1241597f, -0.0922258f, 6.2200000f, 12},
-{0.9372534f, 0.1187073f, -0.3278180f, 5.5500000f, 20},
-{0.8349257f, 0.0971272f, 0.5417245f, 6.4800000f, 22},
-{0.9925384f, 0.1218318f, 0.0049645f, 6.8500000f, 12},
-{0.9925362f, 0.1218388f, 0.0052214f, 2.2300000f, 9},
-{0.3936638f, 0.0391714f, 0.9184195f, 6.2600000f, 28},
-{0.8164542f, 0.0943466f, 0.5696502f, 6.2700000f, 23},
-{0.9857335f, 0.1213385f, -0.1166467f, 4.6200000f, 10},
-{0.6772089f, 0.0886803f, -0.7304272f, 5.4600000f, 43},
-{0.4337967f, 0.0431999f, 0.8999746f, 6.1500000f, 20},
-{0.9417822f, 0.1092733f, 0.3179712f, 5.6900000f, 12},
-{0.3806816f, 0.0551962f, -0.9230574f, 6.0300000f, 30},
-{0.9306433f, 0.1074871f, 0.3497850f, 6.1800000f, 16},
-{0.9928825f, 0.1188847f, -0.0071219f, 5.3500000f, 11},
-{0.8173441f, 0.1032123f, -0.5668297f, 3.8700000f, 51},
-{0.9931179f, 0.1170160f, -0.0049160f, 6.4600000f, 14},
-{0.9627174f, 0.1100921f, 0.2470930f, 5.6400000f, 13},
-{0.9536111f, 0.1140067f, -0.2786186f, 2.5800000f, 30},
-{0.5786800f, 0.0593244f, 0.8133942f, 5.7300000f, 60},
-{0.4700583f, 0.0633664f, -0.8803578f, 6.5900000f, 54},
-{0.9932265f, 0.1152569f, -0.0147281f, 5.3400000f, 11},
-{0.6692104f, 0.0695546f, 0.7398105f, 6.1100000f, 30},
-{0.7129249f, 0.0887942f, -0.6955959f, 5.8600000f, 53},
-{0.9932522f, 0.1133424f, 0.0245679f, 6.5900000f, 12},
-{0.9915617f, 0.1117545f, 0.0656982f, 5.3600000f, 22},
-{0.9934632f, 0.1129054f, -0.0168319f, 6.2200000f, 12},
-{0.9935623f, 0.1129094f, -0.0092404f, 5.9300000f, 55},
-{0.9080313f, 0.0976350f, 0.4073655f, 5.3800000f, 12},
-{0.9803690f, 0.1081472f, 0.1648659f, 4.4100000f, 10},
-{0.7879327f, 0.0937635f, -0.6085806f, 5.4800000f, 52},
-{0.8808176f, 0.0928691f, 0.4642582f, 6.2700000f, 50},
-{0.9792166f, 0.1066436f, 0.1725165f, 3.5400000f, 8},
-{0.9792157f, 0.1066291f, 0.1725308f, 5.6100000f, 10},
-{0.8149125f, 0.0960066f, -0.5715771f, 5.7800000f, 50},
-{0.4644217f, 0.0605961f, -0.8835387f, 6.1900000f, 30},
-{0.9783267f, 0.1061795f, 0.1777718f, 5.6000000f, 19},
-{0.7601098f, 0.0769634f, 0.6452207f, 6.0900000f, 43},
-{0.0839856f, -0.0004898f, 0.9964668f, 6.1100000f, 60},
-{0.9886345f, 0.1082076f, -0.1043693f, 5.6700000f, 11},
-{0.9886356f, 0.1080768f, -0.1044947f, 4.7800000f, 10},
-{0.8759811f, 0.1003153f, -0.4717986f, 6.5300000f, 20},
-{0.8945349f, 0.0920336f, 0.4374210f, 6.4900000f, 35},
-{0.9923662f, 0.1070899f, -0.0611647f, 6.5600000f, 11},
-{0.9922987f, 0.1070316f, -0.0623502f, 6.2400000f, 12},
-{0.9927253f, 0.1070264f, -0.0551535f, 4.5900000f, 11},
-{0.9909614f, 0.1073685f, -0.0804212f, 6.7300000f, 10},
-{0.9909602f, 0.1073538f, -0.0804550f, 7.9600000f, 10},
-{0.9909695f, 0.1073256f, -0.0803777f, 5.1300000f, 6},
-{0.9909731f, 0.1072677f, -0.0804116f, 6.7000000f, 10},
-{0.9910561f, 0.1068684f, -0.0799186f, 5.0800000f, 9},
-{0.9922994f, 0.1064039f, -0.0634050f, 6.3800000f, 12},
-{0.9917283f, 0.1067147f, -0.0713234f, 2.7700000f, 9},
-{0.9931936f, 0.1061564f, -0.0479297f, 6.4000000f, 13},
-{0.9928681f, 0.1058514f, -0.0548485f, 5.2600000f, 30},
-{0.8871775f, 0.0887606f, 0.4528108f, 5.8300000f, 19},
-{0.9945223f, 0.1035926f, -0.0139282f, 1.7000000f, 10},
-{0.8293955f, 0.0807323f, 0.5527978f, 6.3300000f, 50},
-{0.9513148f, 0.0955268f, 0.2930439f, 5.5400000f, 30},
-{0.9917675f, 0.1031453f, -0.0758827f, 6.5400000f, 13},
-{0.9818758f, 0.0992808f, 0.1614411f, 4.0900000f, 50},
-{0.9766034f, 0.0980231f, 0.1914086f, 5.9400000f, 54},
-{0.8345427f, 0.0904516f, -0.5434675f, 5.7800000f, 52},
-{0.9282528f, 0.0908320f, 0.3606887f, 3.0000000f, 14},
-{0.9894577f, 0.1013997f, -0.1034001f, 5.7200000f, 11},
-{0.5965140f, 0.0686498f, -0.7996614f, 6.4300000f, 38},
-{0.9829869f, 0.0975881f, 0.1556060f, 6.1200000f, 12},
-{0.8579541f, 0.0802130f, 0.5074256f, 5.4000000f, 39},
-{0.8838805f, 0.0922303f, -0.4585289f, 6.2600000f, 22},
-{0.4103423f, 0.0315021f, 0.9113873f, 5.6000000f, 55},
-{0.4388716f, 0.0519568f, -0.8970464f, 5.3400000f, 48},
-{0.9926667f, 0.0979587f, -0.0708301f, 6.0500000f, 11},
-{0.9792313f, 0.0979704f, -0.1775046f, 6.1100000f, 22},
-{0.9867939f, 0.0949378f, 0.1312424f, 5.8800000f, 18},
-{0.8902493f, 0.0819722f, 0.4480365f, 6.3700000f, 49},
-{0.4738459f, 0.0547735f, -0.8789027f, 3.7600000f, 36},
-{0.9938113f, 0.0961746f, -0.0555843f, 6.1900000f, 12},
-{0.8692366f, 0.0786988f, 0.4880924f, 5.9600000f, 12},
-{0.5931160f, 0.0484026f, 0.8036607f, 6.2300000f, 51},
-{0.8933978f, 0.0888777f, -0.4403876f, 6.1600000f, 30},
-{0.6822509f, 0.0715720f, -0.7276065f, 6.1100000f, 52},
-{0.8960672f, 0.0794333f, 0.4367538f, 5.1800000f, 13},
-{0.9249959f, 0.0831640f, 0.3707646f, 6.3400000f, 21},
-{0.5395354f, 0.0589934f, -0.8398936f, 6.7500000f, 54},
-{0.9954059f, 0.0925747f, -0.0244322f, 3.8100000f, 9},
-{0.9954189f, 0.0924079f, -0.0245340f, 6.6500000f, 12},
-{0.9911943f, 0.0926919f, -0.0945620f, 5.9600000f, 11},
-{0.9933031f, 0.0904632f, 0.0718698f, 4.5700000f, 13},
-{0.8843462f, 0.0861525f, -0.4588133f, 5.3100000f, 34},
-{0.4845847f, 0.0531562f, -0.8731278f, 6.3200000f, 45},
-{0.9887811f, 0.0913566f, -0.1181777f, 4.8000000f, 24},
-{0.8508739f, 0.0722039f, 0.5203846f, 6.0400000f, 19},
-{0.8457721f, 0.0713869f, 0.5287470f, 6.1100000f, 62},
-{0.9951104f, 0.0891614f, -0.0424908f, 6.0000000f, 28},
-{0.5492381f, 0.0407512f, 0.8346717f, 6.0500000f, 50},
-{0.9855917f, 0.0883374f, -0.1442411f, 6.5000000f, 17},
-{0.4763741f, 0.0330120f, 0.8786227f, 6.1500000f, 45},
-{0.9566081f, 0.0867566f, -0.2781623f, 6.3800000f, 17},
-{0.8675826f, 0.0707566f, 0.4922337f, 6.4300000f, 18},
-{0.9554605f, 0.0781544f, 0.2845824f, 4.8600000f, 13},
-{0.7705914f, 0.0717343f, -0.6332796f, 5.8200000f, 18},
-{0.9964771f, 0.0838590f, -0.0009987f, 2.0500000f, 9},
-{0.9964777f, 0.0838517f, -0.0009987f, 4.2100000f, 10},
-{0.9962179f, 0.0844355f, -0.0205062f, 6.2200000f, 11},
-{0.9154050f, 0.0724057f, 0.3959685f, 6.5900000f, 18},
-{0.9963935f, 0.0834798f, -0.0152032f, 4.9500000f, 12},
-{0.2458323f, 0.0303133f, -0.9688383f, 5.1900000f, 52},
-{0.9199812f, 0.0721416f, 0.3852664f, 6.3600000f, 52},
-{0.9965818f, 0.0824009f, 0.0058953f, 5.9300000f, 30},
-{0.8264913f, 0.0735867f, -0.5581193f, 2.6400000f, 17},
-{0.9825534f, 0.0826512f, -0.1666062f, 6.5200000f, 19},
-{0.8505114f, 0.0750459f, -0.5205751f, 5.4500000f, 46},
-{0.9966189f, 0.0798724f, -0.0192653f, 6.4200000f, 29},
-{0.4135429f, 0.0418026f, -0.9095245f, 6.3100000f, 19},
-{0.9166750f, 0.0668138f, 0.3940087f, 6.2100000f, 12},
-{0.9615985f, 0.0769813f, -0.2634428f, 6.2100000f, 13},
-{0.9967481f, 0.0763602f, 0.0257359f, 4.9100000f, 51},
-{0.3028729f, 0.0335111f, -0.9524416f, 5.7800000f, 63},
-{0.9560912f, 0.0742457f, -0.2835086f, 6.1500000f, 50},
-{0.8396996f, 0.0681138f, -0.5387626f, 6.3400000f, 20},
-{0.9931064f, 0.0742508f, -0.0907002f, 6.0200000f, 33},
-{0.9268144f, 0.0719993f, -0.3685527f, 5.8700000f, 22},
-{0.5565537f, 0.0328054f, 0.8301637f, 5.9400000f, 24},
-{0.9972773f, 0.0734323f, -0.0067534f, 6.3100000f, 54},
-{0.6438853f, 0.0396637f, 0.7640932f, 5.4700000f, 22},
-{0.8680345f, 0.0675791f, -0.4918834f, 6.1900000f, 20},
-{0.8329944f, 0.0646378f, -0.5494928f, 5.2900000f, 19},
-{0.7588703f, 0.0469961f, 0.6495439f, 6.5800000f, 23},
-{0.9515048f, 0.0692063f, -0.2997485f, 5.7300000f, 20},
-{0.4564544f, 0.0217621f, 0.8894806f, 6.1300000f, 24},
-{0.9336434f, 0.0585081f, 0.3533932f, 6.9500000f, 35},
-{0.9954274f, 0.0651056f, 0.0698967f, 6.0900000f, 30},
-{0.7358218f, 0.0409939f, 0.6759333f, 6.2900000f, 50},
-{0.9382874f, 0.0636644f, -0.3399464f, 6.3400000f, 40},
-{0.7795722f, 0.0562109f, -0.6237849f, 6.2500000f, 33},
-{0.9277737f, 0.0630798f, -0.3677729f, 6.1500000f, 52},
-{0.9279503f, 0.0630037f, -0.3673401f, 3.6000000f, 36},
-{0.7154959f, 0.0510207f, -0.6967514f, 6.3900000f, 29},
-{0.9605056f, 0.0555576f, 0.2726581f, 6.0000000f, 18},
-{0.9960309f, 0.0607163f, -0.0650838f, 6.3400000f, 51},
-{0.9846031f, 0.0564773f, 0.1654301f, 5.7900000f, 48},
-{0.9980795f, 0.0584957f, 0.0203850f, 5.9500000f, 44},
-{0.9666937f, 0.0539619f, 0.2501829f, 5.7200000f, 23},
-{0.9510758f, 0.0521882f, 0.3045180f, 5.4900000f, 30},
-{0.2206471f, 0.0235755f, -0.9750687f, 6.0500000f, 18},
-{0.5453635f, 0.0224602f, 0.8378987f, 6.5400000f, 24},
-{0.9693234f, 0.0520089f, 0.2402233f, 5.2900000f, 12},
-{0.3667909f, 0.0113266f, 0.9302344f, 6.2000000f, 49},
-{0.7742883f, 0.0365992f, 0.6317738f, 4.5200000f, 48},
-{0.8492823f, 0.0519505f, -0.5253768f, 5.1700000f, 9},
-{0.9331925f, 0.0473824f, 0.3562397f, 6.0700000f, 19},
-{0.9720895f, 0.0553907f, -0.2279780f, 3.5500000f, 23},
-{0.9923011f, 0.0519898f, 0.1124084f, 5.2700000f, 25},
-{0.9608795f, 0.0540299f, -0.2716458f, 6.1700000f, 42},
-{0.9849010f, 0.0540084f, -0.1644786f, 6.0300000f, 24},
-{0.9084279f, 0.0435687f, 0.4157650f, 4.8600000f, 48},
-{0.6218273f, 0.0245947f, 0.7827681f, 6.2900000f, 51},
-{0.9880378f, 0.0528328f, -0.1448791f, 2.0600000f, 10},
-{0.8867185f, 0.0500475f, -0.4595928f, 6.2200000f, 15},
-{0.5152823f, 0.0173413f, 0.8568450f, 6.1400000f, 20},
-{0.9964400f, 0.0496856f, -0.0681072f, 5.9700000f, 44},
-{0.7008930f, 0.0414668f, -0.7120601f, 5.3100000f, 50},
-{0.8245839f, 0.0457044f, -0.5638905f, 6.3200000f, 51},
-{0.9747073f, 0.0444814f, 0.2190137f, 4.9100000f, 19},
-{0.7948069f, 0.0310891f, 0.6060655f, 4.7400000f, 60},
-{0.7749765f, 0.0287896f, 0.6313340f, 3.9700000f, 49},
-{0.8825258f, 0.0347967f, 0.4689749f, 5.5600000f, 47},
-{0.9842663f, 0.0427875f, 0.1714324f, 5.8000000f, 48},
-{0.4332602f, 0.0288277f, -0.9008077f, 4.3500000f, 27},
-{0.9681562f, 0.0402322f, 0.2470930f, 5.5200000f, 49},
-{0.7722495f, 0.0405789f, -0.6340222f, 6.6100000f, 51},
-{0.8462977f, 0.0316671f, 0.5317682f, 6.2500000f, 63},
-{0.9961135f, 0.0425405f, 0.0771251f, 5.9700000f, 52},
-{0.6292508f, 0.0349465f, -0.7764162f, 3.8500000f, 25},
-{0.9713038f, 0.0440713f, -0.2337235f, 5.4900000f, 46},
-{0.1808050f, 0.0180760f, -0.9833528f, 5.6500000f, 41},
-{0.5919465f, 0.0330518f, -0.8052993f, 6.1800000f, 53},
-{0.9985174f, 0.0414138f, 0.0353259f, 5.9800000f, 48},
-{0.7704020f, 0.0246876f, 0.6370803f, 6.4500000f, 22},
-{0.9324954f, 0.0411553f, -0.3588296f, 5.8700000f, 22},
-{0.5015657f, 0.0110245f, 0.8650493f, 5.2000000f, 22},
-{0.8294173f, 0.0265425f, 0.5579986f, 5.9800000f, 61},
-{0.5632835f, 0.0126679f, 0.8261666f, 4.9900000f, 22},
-{0.9399593f, 0.0312227f, 0.3398553f, 6.0600000f, 42},
-{0.9929026f, 0.0374204f, -0.1128901f, 5.3500000f, 12},
-{0.7291115f, 0.0332097f, -0.6835888f, 6.3800000f, 51},
-{0.9690295f, 0.0322660f, 0.2448280f, 5.5900000f, 19},
-{0.8857291f, 0.0257979f, 0.4634851f, 4.5800000f, 20},
-{0.9441526f, 0.0357687f, -0.3275615f, 3.8100000f, 50},
-{0.9324723f, 0.0346947f, -0.3595716f, 6.1700000f, 50},
-{0.9989322f, 0.0329635f, 0.0323702f, 4.7800000f, 51},
-{0.9374954f, 0.0273397f, 0.3469220f, 6.7100000f, 19},
-{0.9872182f, 0.0339281f, -0.1557209f, 5.9700000f, 22},
-{0.8261267f, 0.0326030f, -0.5625404f, 3.1200000f, 52},
-{0.4051811f, 0.0042727f, 0.9142265f, 6.2500000f, 50},
-{0.5610491f, 0.0249170f, -0.8274074f, 4.5100000f, 51},
-{0.8778526f, 0.0306872f, -0.4779468f, 6.4500000f, 53},
-{0.6256249f, 0.0260118f, -0.7796902f, 6.3500000f, 50},
-{0.6182718f, 0.0101443f, 0.7858989f, 6.4900000f, 25},
-{0.8505920f, 0.0186219f, 0.5254964f, 5.9000000f, 25},
-{0.9377517f, 0.0229932f, 0.3465446f, 4.4100000f, 40},
-{0.9826650f, 0.0247738f, 0.1837274f, 6.1200000f, 49},
-{0.6166701f, 0.0245345f, -0.7868393f, 5.1700000f, 48},
-{0.9787229f, 0.0233355f, 0.2038553f, 6.5900000f, 22},
-{0.9981031f, 0.0249959f, 0.0562620f, 6.3100000f, 50},
-{0.9409487f, 0.0207575f, 0.3379122f, 5.9200000f, 12},
-{0.8047909f, 0.0261586f, -0.5929817f, 5.6300000f, 51},
-{0.6556179f, 0.0083488f, 0.7550466f, 6.4700000f, 48},
-{0.7932356f, 0.0249458f, -0.6084037f, 6.7000000f, 51},
-{0.8458243f, 0.0254175f, -0.5328558f, 4.8700000f, 15},
-{0.9995934f, 0.0229676f, 0.0168998f, 6.0000000f, 50},
-{0.9973621f, 0.0235985f, -0.0686441f, 6.5700000f, 11},
-{0.1171488f, 0.0153025f, -0.9929965f, 6.2000000f, 19},
-{0.9487570f, 0.0250236f, -0.3150141f, 6.6900000f, 24},
-{0.9914355f, 0.0208902f, 0.1289158f, 0.5000000f, 61},
-{0.3201956f, 0.0170586f, -0.9471978f, 6.5300000f, 50},
-{0.9384876f, 0.0171119f, 0.3448887f, 5.4000000f, 66},
-{0.4206441f, 0.0185619f, -0.9070358f, 5.1100000f, 16},
-{0.9838543f, 0.0226418f, -0.1775332f, 5.6600000f, 55},
-{0.8750098f, 0.0131220f, 0.4839274f, 6.3200000f, 22},
-{0.9704669f, 0.0166925f, 0.2406563f, 6.6000000f, 45},
-{0.8755901f, 0.0220297f, -0.4825522f, 6.3600000f, 33},
-{0.7534945f, 0.0217654f, -0.6570939f, 6.5500000f, 53},
-{0.9980648f, 0.0195777f, -0.0590208f, 5.8700000f, 52},
-{0.9982445f, 0.0192108f, -0.0560248f, 6.2800000f, 22},
-{0.5466165f, 0.0182804f, -0.8371835f, 5.9400000f, 37},
-{0.4385882f, 0.0164975f, -0.8985367f, 6.3600000f, 48},
-{0.9116825f, 0.0121932f, 0.4107144f, 6.0200000f, 20},
-{0.9861404f, 0.0152046f, 0.1652150f, 5.9900000f, 20},
-{0.9797572f, 0.0135740f, 0.1997290f, 5.8700000f, 52},
-{0.5837565f, 0.0012056f, 0.8119279f, 3.7200000f, 50},
-{0.2488664f, -0.0055987f, 0.9685216f, 6.4000000f, 55},
-{0.5689802f, 0.0005917f, 0.8223510f, 6.4400000f, 25},
-{0.5800316f, 0.0005020f, 0.8145938f, 6.1400000f, 52},
-{0.6437947f, 0.0017885f, 0.7651961f, 5.8900000f, 45},
-{0.7873629f, 0.0176100f, -0.6162382f, 5.5700000f, 60},
-{0.6474050f, 0.0164488f, -0.7619686f, 6.5200000f, 48},
-{0.8991121f, 0.0078660f, 0.4376477f, 4.8200000f, 10},
-{0.9708805f, 0.0152306f, -0.2390796f, 3.7100000f, 31},
-{0.9324522f, 0.0153061f, -0.3609691f, 5.9600000f, 50},
-{0.7997486f, 0.0157109f, -0.6001294f, 4.9700000f, 51},
-{0.7077529f, 0.0014566f, 0.7064586f, 1.9000000f, 22},
-{0.6640992f, 0.0154039f, -0.7474858f, 6.1000000f, 13},
-{0.9218654f, 0.0137777f, -0.3872653f, 6.3600000f, 50},
-{0.6954496f, 0.0001972f, 0.7185749f, 4.2600000f, 63},
-{0.8604773f, 0.0137115f, -0.5093043f, 5.5000000f, 32},
-{0.9997298f, 0.0091462f, 0.0213690f, 6.2200000f, 60},
-{0.6242022f, 0.0140652f, -0.7811362f, 5.2900000f, 30},
-{0.7963974f, 0.0009672f, 0.6047729f, 2.6200000f, 20},
-{0.7121241f, -0.0009840f, 0.7020529f, 6.2200000f, 52},
-{0.9998185f, 0.0078745f, 0.0173506f, 6.2200000f, 50},
-{0.8657333f, 0.0120257f, -0.5003610f, 6.4400000f, 48},
-{0.9751045f, 0.0047369f, 0.2216951f, 5.7000000f, 52},
-{0.9994619f, 0.0069486f, 0.0320552f, 5.9000000f, 25},
-{0.6703954f, -0.0028569f, 0.7419986f, 5.7300000f, 19},
-{0.4552387f, 0.0117188f, -0.8902923f, 4.6500000f, 51},
-{0.9999403f, 0.0051194f, 0.0096525f, 5.2200000f, 21},
-{0.4457772f, 0.0112871f, -0.8950728f, 6.6300000f, 30},
-{0.6565746f, -0.0049229f, 0.7542450f, 5.9600000f, 50},
-{0.8219309f, 0.0088347f, -0.5695187f, 4.3600000f, 12},
-{0.9887008f, 0.0042421f, -0.1498421f, 6.1200000f, 32},
-{0.9891577f, 0.0040067f, -0.1468024f, 5.0300000f, 26},
-{0.9999517f, 0.0016216f, -0.0096961f, 6.6300000f, 18},
-{0.8568439f, -0.0043743f, 0.5155574f, 5.9800000f, 22},
-{0.8864195f, -0.0038935f, 0.4628663f, 6.0500000f, 19},
-{0.6440010f, -0.0079011f, 0.7649839f, 6.0500000f, 19},
-{0.9986964f, -0.0002469f, -0.0510432f, 4.5300000f, 51},
-{0.6076937f, 0.0073187f, -0.7941377f, 6.4500000f, 55},
-{0.7267732f, -0.0091757f, 0.6868162f, 6.4200000f, 50},
-{0.9245153f, -0.0068310f, 0.3810838f, 6.3700000f, 18},
-{0.7197444f, 0.0043130f, -0.6942258f, 5.8100000f, 48},
-{0.9812909f, -0.0012631f, -0.1925267f, 6.2200000f, 30},
-{0.7323284f, -0.0105455f, 0.6808700f, 6.1000000f, 50},
-{0.7525853f, 0.0028022f, -0.6584888f, 3.9600000f, 50},
-{0.5090178f, -0.0114142f, 0.8606803f, 6.3400000f, 51},
-{0.8420470f, -0.0107229f, 0.5392976f, 6.2400000f, 34},
-{0.6213935f, -0.0121619f, 0.7834043f, 6.4500000f, 27},
-{0.9858041f, -0.0102520f, 0.1675861f, 4.1200000f, 22},
-{0.1968195f, 0.0083539f, -0.9804042f, 5.4700000f, 19},
-{0.4467339f, -0.0129726f, 0.8945728f, 6.3900000f, 50},
-{0.9995131f, -0.0099657f, 0.0295693f, 6.5900000f, 18},
-{0.9865348f, -0.0079206f, -0.1633594f, 4.9500000f, 15},
-{0.9093524f, -0.0048341f, -0.4159987f, 6.0500000f, 21},
-{0.9414191f, -0.0141932f, 0.3369401f, 5.1400000f, 18},
-{0.8472170f, -0.0047072f, -0.5312261f, 5.5500000f, 55},
-{0.7313938f, -0.0161400f, 0.6817643f, 5.8700000f, 33},
-{0.9791821f, -0.0145774f, 0.2024597f, 6.0800000f, 20},
-{0.9185509f, -0.0165145f, 0.3949577f, 4.1600000f, 47},
-{0.9387268f, -0.0160578f, 0.3442879f, 4.6300000f, 12},
-{0.9722978f, -0.0108753f, -0.2334925f, 6.2000000f, 45},
-{0.7882048f, -0.0173478f, 0.6151685f, 6.3400000f, 50},
-{0.6322469f, -0.0022621f, -0.7747637f, 5.6700000f, 20},
-{0.8326836f, -0.0202292f, 0.5533794f, 6.2300000f, 19},
-{0.9008682f, -0.0128087f, -0.4339037f, 5.0400000f, 53},
-{0.8149614f, -0.0218446f, 0.5791033f, 6.1200000f, 40},
-{0.9955703f, -0.0183555f, -0.0922113f, 5.2100000f, 12},
-{0.7824721f, -0.0224886f, 0.6222794f, 5.3600000f, 24},
-{0.9952950f, -0.0215871f, 0.0944558f, 5.6700000f, 47},
-{0.9971323f, -0.0216414f, 0.0725177f, 5.6300000f, 44},
-{0.8699116f, -0.0242039f, 0.4926134f, 6.0800000f, 63},
-{0.7444522f, -0.0242028f, 0.6672369f, 6.1200000f, 50},
-{0.9633299f, -0.0209569f, -0.2675000f, 4.9300000f, 22},
-{0.8494875f, -0.0160823f, -0.5273637f, 5.6500000f, 12},
-{0.9852561f, -0.0234339f, -0.1694737f, 5.8700000f, 34},
-{0.5014425f, -0.0047115f, -0.8651782f, 6.4500000f, 64},
-{0.5155081f, -0.0224738f, 0.8565900f, 5.3600000f, 48},
-{0.7535687f, -0.0275772f, 0.6567905f, 6.3600000f, 49},
-{0.9973750f, -0.0289263f, -0.0663803f, 5.3800000f, 15},
-{0.9737641f, -0.0261579f, -0.2260516f, 4.6700000f, 21},
-{0.9146393f, -0.0229989f, -0.4036163f, 6.9500000f, 66},
-{0.7074244f, -0.0138097f, -0.7066541f, 6.3500000f, 40},
-{0.7079327f, -0.0144273f, -0.7061325f, 5.9300000f, 34},
-{0.9664368f, -0.0319404f, 0.2549114f, 4.4200000f, 13},
-{0.8240275f, -0.0196052f, -0.5662104f, 5.8000000f, 21},
-{0.9817602f, -0.0294167f, -0.1878337f, 6.6600000f, 13},
-{0.6749105f, -0.0140833f, -0.7377652f, 6.5800000f, 46},
-{0.9208828f, -0.0262588f, -0.3889542f, 5.4700000f, 20},
-{0.8806507f, -0.0234131f, -0.4731873f, 5.8100000f, 21},
-{0.4105763f, -0.0230476f, 0.9115349f, 5.3200000f, 51},
-{0.9381372f, -0.0284988f, -0.3450889f, 5.7800000f, 64},
-{0.9878465f, -0.0378917f, 0.1507432f, 6.5500000f, 19},
-{0.9459237f, -0.0317652f, -0.3228301f, 5.3100000f, 62},
-{0.9251344f, -0.0385320f, 0.3776792f, 5.9300000f, 54},
-{0.8316748f, -0.0256340f, -0.5546710f, 5.8300000f, 14},
-{0.7463046f, -0.0217696f, -0.6652485f, 6.1200000f, 20},
-{0.6059214f, -0.0311364f, 0.7949149f, 6.3000000f, 25},
-{0.9189008f, -0.0390489f, 0.3925512f, 5.7500000f, 12},
-{0.9982844f, -0.0390700f, 0.0436097f, 5.7300000f, 23},
-{0.6589842f, -0.0334067f, 0.7514145f, 6.8200000f, 28},
-{0.6590095f, -0.0334128f, 0.7513921f, 6.0900000f, 23},
-{0.8008536f, -0.0263105f, -0.5982819f, 5.0200000f, 19},
-{0.7079004f, -0.0217262f, -0.7059780f, 6.5100000f, 51},
-{0.9963243f, -0.0417729f, -0.0747853f, 6.1700000f, 33},
-{0.9292417f, -0.0363679f, -0.3676782f, 5.5000000f, 20},
-{0.7444989f, -0.0256136f, -0.6671322f, 5.5000000f, 20},
-{0.9509444f, -0.0387688f, -0.3069229f, 6.3500000f, 19},
-{0.9718636f, -0.0406128f, -0.2320167f, 5.5600000f, 52},
-{0.9492555f, -0.0457206f, 0.3111649f, 6.3300000f, 51},
-{0.9093837f, -0.0458221f, 0.4134267f, 5.8000000f, 50},
-{0.9313089f, -0.0398408f, -0.3620449f, 5.7100000f, 36},
-{0.7231367f, -0.0270744f, -0.6901741f, 6.2700000f, 18},
-{0.6258489f, -0.0376071f, 0.7790371f, 6.0400000f, 51},
-{0.8403550f, -0.0452730f, 0.5401424f, 5.7800000f, 62},
-{0.9267988f, -0.0479903f, 0.3724794f, 6.5600000f, 60},
-{0.9705866f, -0.0485946f, 0.2357971f, 6.0400000f, 20},
-{0.9032646f, -0.0385950f, -0.4273447f, 6.2700000f, 48},
-{0.9396424f, -0.0493336f, 0.3385828f, 5.7500000f, 19},
-{0.4072229f, -0.0109421f, -0.9132633f, 5.7100000f, 20},
-{0.9946603f, -0.0478712f, -0.0914292f, 6.1500000f, 20},
-{0.4716305f, -0.0145263f, -0.8816766f, 5.0500000f, 52},
-{0.9197986f, -0.0494858f, 0.3892579f, 6.3900000f, 61},
-{0.9593025f, -0.0505058f, 0.2778270f, 4.9500000f, 15},
-{0.9680920f, -0.0504814f, 0.2454578f, 4.4800000f, 13},
-{0.8912749f, -0.0411610f, -0.4515914f, 5.7200000f, 51},
-{0.4988433f, -0.0341754f, 0.8660181f, 5.3500000f, 53},
-{0.9970001f, -0.0510656f, -0.0581642f, 6.1800000f, 19},
-{0.7692387f, -0.0341630f, -0.6380476f, 5.5800000f, 62},
-{0.6628837f, -0.0271698f, -0.7482293f, 6.4900000f, 37},
-{0.9941465f, -0.0515066f, -0.0949722f, 5.0500000f, 12},
-{0.9013694f, -0.0441829f, -0.4307911f, 6.0900000f, 20},
-{0.9456637f, -0.0560033f, 0.3202869f, 6.5800000f, 18},
-{0.9812147f, -0.0566194f, 0.1844231f, 6.4500000f, 42},
-{0.3519594f, -0.0290085f, 0.9355656f, 4.8000000f, 20},
-{0.9981152f, -0.0555412f, -0.0260994f, 6.6200000f, 22},
-{0.7098085f, -0.0330547f, -0.7036187f, 6.3100000f, 20},
-{0.6007704f, -0.0270138f, -0.7989651f, 4.8100000f, 13},
-{0.9586232f, -0.0534765f, -0.2796102f, 6.5200000f, 13},
-{0.9496624f, -0.0600666f, 0.3074627f, 5.8800000f, 25},
-{0.4754683f, -0.0372393f, 0.8789443f, 4.9800000f, 63},
-{0.9218894f, -0.0599256f, 0.3827909f, 3.2800000f, 63},
-{0.8056078f, -0.0550974f, 0.5898817f, 6.9200000f, 34},
-{0.9973846f, -0.0605877f, -0.0394100f, 5.8300000f, 48},
-{0.8684137f, -0.0583587f, 0.4923940f, 4.3500000f, 48},
-{0.9426446f, -0.0611577f, 0.3281477f, 5.2000000f, 36},
-{0.3879306f, -0.0147954f, -0.9215698f, 5.0600000f, 18},
-{0.9688029f, -0.0641001f, 0.2393997f, 5.9100000f, 11},
-{0.9583976f, -0.0645738f, 0.2780366f, 5.3000000f, 17},
-{0.9961789f, -0.0635980f, -0.0598581f, 5.8300000f, 15},
-{0.9246116f, -0.0555461f, -0.3768396f, 6.3900000f, 45},
-{0.8764153f, -0.0518960f, -0.4787514f, 6.5400000f, 17},
-{0.9929222f, -0.0644487f, -0.0997587f, 3.9800000f, 51},
-{0.6872875f, -0.0528185f, 0.7244627f, 6.5200000f, 30},
-{0.9737985f, -0.0670273f, 0.2173104f, 5.3300000f, 19},
-{0.9114435f, -0.0650000f, 0.4062583f, 6.0800000f, 48},
-{0.9920777f, -0.0679302f, 0.1056759f, 6.0700000f, 16},
-{0.9948427f, -0.0686211f, 0.0746935f, 6.6400000f, 13},
-{0.9976528f, -0.0678892f, 0.0089398f, 5.6500000f, 36},
-{0.9962697f, -0.0674603f, -0.0538126f, 5.9900000f, 25},
-{0.9529303f, -0.0682930f, 0.2953977f, 6.3900000f, 55},
-{0.9973867f, -0.0693068f, 0.0204044f, 6.3700000f, 35},
-{0.9855456f, -0.0664678f, -0.1558263f, 6.1000000f, 19},
-{0.5129898f, -0.0440314f, 0.8572647f, 4.4800000f, 22},
-{0.6879235f, -0.0549915f, 0.7236969f, 6.3800000f, 52},
-{0.9128652f, -0.0677508f, 0.4026002f, 6.2500000f, 13},
-{0.9746348f, -0.0700479f, 0.2125567f, 5.0400000f, 35},
-{0.9392538f, -0.0621382f, -0.3375517f, 5.9100000f, 50},
-{0.9514725f, -0.0635790f, -0.3010942f, 5.9900000f, 50},
-{0.9748077f, -0.0670896f, -0.2127177f, 5.0100000f, 19},
-{0.4313993f, -0.0211933f, -0.9019121f, 5.0100000f, 62},
-{0.9972780f, -0.0712817f, 0.0188533f, 6.6300000f, 16},
-{0.9822379f, -0.0734669f, 0.1726598f, 5.3900000f, 22},
-{0.9897124f, -0.0734325f, 0.1227884f, 6.5700000f, 17},
-{0.9617913f, -0.0677962f, -0.2652570f, 5.9200000f, 12},
-{0.9672045f, -0.0742313f, 0.2429096f, 6.5900000f, 20},
-{0.9932146f, -0.0749780f, 0.0888991f, 5.7100000f, 39},
-{0.8790731f, -0.0612909f, -0.4727302f, 6.6700000f, 54},
-{0.9656408f, -0.0763933f, 0.2483987f, 6.1600000f, 23},
-{0.9292064f, -0.0692898f, -0.3630073f, 6.0700000f, 40},
-{0.9840226f, -0.0756588f, -0.1611684f, 6.7500000f, 30},
-{0.8184177f, -0.0592093f, -0.5715652f, 4.3700000f, 50},
-{0.5071004f, -0.0489622f, 0.8604951f, 5.9400000f, 23},
-{0.9513419f, -0.0791758f, 0.2977914f, 6.3200000f, 19},
-{0.9842823f, -0.0803823f, 0.1572484f, 6.2400000f, 50},
-{0.9622138f, -0.0744395f, -0.2619225f, 5.1400000f, 53},
-{0.2879597f, -0.0128747f, -0.9575560f, 5.0900000f, 46},
-{0.7779986f, -0.0564273f, -0.6257268f, 6.0000000f, 22},
-{0.8040931f, -0.0598250f, -0.5914856f, 5.5300000f, 51},
-{0.5928088f, -0.0564763f, 0.8033606f, 5.3600000f, 35},
-{0.7990411f, -0.0599341f, -0.5982819f, 5.8700000f, 23},
-{0.9478720f, -0.0755494f, -0.3095656f, 5.5200000f, 12},
-{0.9853909f, -0.0812015f, -0.1497031f, 5.3600000f, 51},
-{0.9627844f, -0.0792117f, -0.2584022f, 6.0600000f, 60},
-{0.9637766f, -0.0846162f, 0.2529325f, 5.6900000f, 53},
-{0.9881874f, -0.0826837f, -0.1290312f, 6.2200000f, 19},
-{0.9418577f, -0.0781934f, -0.3267872f, 5.8100000f, 14},
-{0.8662820f, -0.0803689f, 0.4930479f, 6.4300000f, 21},
-{0.9905187f, -0.0854109f, -0.1075993f, 5.2700000f, 12},
-{0.5169187f, -0.0368454f, -0.8552412f, 6.4300000f, 40},
-{0.9960282f, -0.0871120f, -0.0184219f, 4.9000000f, 61},
-{0.9749657f, -0.0890362f, 0.2037509f, 6.5400000f, 15},
-{0.9481625f, -0.0889251f, 0.3050905f, 6.3500000f, 49},
-{0.6237935f, -0.0487148f, -0.7800696f, 6.4100000f, 52},
-{0.8298192f, -0.0714446f, -0.5534400f, 5.7800000f, 19},
-{0.9948512f, -0.0932966f, 0.0395844f, 6.3100000f, 24},
-{0.6454041f, -0.0530052f, -0.7620000f, 7.0400000f, 42},
-{0.8631759f, -0.0767074f, -0.4990424f, 3.0200000f, 12},
-{0.3364096f, -0.0221944f, -0.9414542f, 6.6400000f, 38},
-{0.9798213f, -0.0918081f, -0.1775428f, 5.6400000f, 11},
-{0.3306947f, -0.0409607f, 0.9428485f, 5.9700000f, 24},
-{0.9191567f, -0.0923922f, 0.3829029f, 2.8800000f, 63},
-{0.9712857f, -0.0961269f, 0.2176322f, 6.0000000f, 30},
-{0.8270853f, -0.0745612f, -0.5571092f, 5.5300000f, 11},
-{0.6484111f, -0.0707215f, 0.7579984f, 4.9100000f, 55},
-{0.6760779f, -0.0594514f, -0.7344278f, 6.6000000f, 43},
-{0.5513753f, -0.0638694f, 0.8318088f, 5.6400000f, 23},
-{0.9926864f, -0.1013075f, 0.0656547f, 6.4000000f, 13},
-{0.5201491f, -0.0611380f, 0.8518844f, 5.2100000f, 54},
-{0.9563387f, -0.0950339f, -0.2763783f, 1.9800000f, 11},
-{0.9931394f, -0.1016602f, -0.0577867f, 6.6700000f, 22},
-{0.8388743f, -0.0811931f, -0.5382356f, 3.8500000f, 47},
-{0.8634573f, -0.0940937f, 0.4955682f, 6.7100000f, 18},
-{0.9914333f, -0.1031907f, 0.0800733f, 4.4400000f, 25},
-{0.9914264f, -0.1032191f, 0.0801216f, 6.7200000f, 35},
-{0.9825714f, -0.1034386f, 0.1544469f, 6.2600000f, 18},
-{0.9847167f, -0.1017606f, -0.1413428f, 6.1900000f, 55},
-{0.9553294f, -0.1041264f, 0.2765926f, 6.3300000f, 49},
-{0.9610579f, -0.1000221f, -0.2576106f, 6.2400000f, 52},
-{0.9125606f, -0.1021518f, 0.3959774f, 6.0600000f, 22},
-{0.9778869f, -0.1035207f, -0.1817159f, 5.2200000f, 53},
-{0.9447773f, -0.0984388f, -0.3125790f, 6.6000000f, 18},
-{0.8597477f, -0.0874816f, -0.5031708f, 6.3400000f, 48},
-{0.9612048f, -0.1072573f, 0.2541284f, 6.2400000f, 35},
-{0.9759713f, -0.1040500f, -0.1914514f, 6.1200000f, 15},
-{0.9863608f, -0.1089751f, 0.1233561f, 5.9800000f, 37},
-{0.9055638f, -0.0949056f, -0.4134576f, 5.6300000f, 55},
-{0.9935687f, -0.1101591f, 0.0261963f, 6.6600000f, 19},
-{0.9937903f, -0.1100373f, 0.0165120f, 5.8700000f, 38},
-{0.6718166f, -0.0820474f, 0.7361594f, 6.5600000f, 20},
-{0.9929004f, -0.1121467f, 0.0396474f, 6.5100000f, 20},
-{0.8117385f, -0.0853768f, -0.5777468f, 5.6200000f, 46},
-{0.9930034f, -0.1121949f, -0.0368327f, 6.3500000f, 49},
-{0.8840841f, -0.0957756f, -0.4574084f, 6.3900000f, 42},
-{0.8366992f, -0.1012209f, 0.5382275f, 6.4300000f, 50},
-{0.5617117f, -0.0563881f, -0.8254092f, 5.6100000f, 20},
-{0.9879453f, -0.1124748f, -0.1063653f, 6.4000000f, 24},
-{0.6148670f, -0.0636171f, -0.7860607f, 5.9800000f, 48},
-{0.7647449f, -0.0828809f, -0.6389804f, 6.3100000f, 19},
-{0.9932050f, -0.1160597f, -0.0086005f, 5.8700000f, 23},
-{0.9915335f, -0.1154917f, -0.0593548f, 6.1500000f, 12},
-{0.6217748f, -0.0652186f, -0.7804759f, -0.7200000f, 30},
-{0.9929726f, -0.1174309f, 0.0146748f, 6.7100000f, 21},
-{0.9868348f, -0.1157009f, -0.1130057f, 6.2700000f, 20},
-{0.8147226f, -0.0910198f, -0.5726627f, 6.2500000f, 53},
-{0.9297422f, -0.1139246f, 0.3501438f, 6.2200000f, 22},
-{0.5227555f, -0.0706483f, 0.8495502f, 5.8800000f, 50},
-{0.8550047f, -0.1071343f, 0.5074339f, 5.5500000f, 38},
-{0.9916144f, -0.1188573f, 0.0507334f, 5.5500000f, 49},
-{0.9929365f, -0.1185323f, 0.0052214f, 5.2000000f, 51},
-{0.9929229f, -0.1186625f, 0.0048190f, 5.5500000f, 55},
-{0.5350519f, -0.0557209f, -0.8429796f, 6.4800000f, 23},
-{0.4622383f, -0.0465891f, -0.8855311f, 6.2700000f, 61},
-{0.6801134f, -0.0896896f, 0.7275998f, 5.9000000f, 54},
-{0.8841638f, -0.1122577f, 0.4534893f, 6.4700000f, 35},
-{0.9527101f, -0.1189478f, 0.2796335f, 6.2300000f, 45},
-{0.6230242f, -0.0676913f, -0.7792681f, 6.5100000f, 55},
-{0.9763744f, -0.1212389f, 0.1788690f, 6.1500000f, 52},
-{0.9309356f, -0.1182786f, 0.3454984f, 4.1500000f, 16},
-{0.9909830f, -0.1215019f, -0.0564798f, 5.0600000f, 12},
-{0.5014279f, -0.0532073f, -0.8635618f, 5.8000000f, 20},
-{0.1777476f, -0.0315657f, 0.9835697f, 6.5400000f, 21},
-{0.9918439f, -0.1230133f, 0.0333684f, 6.4800000f, 19},
-{0.6672002f, -0.0752119f, -0.7410716f, 5.7600000f, 19},
-{0.9061122f, -0.1079939f, -0.4090207f, 6.0700000f, 39},
-{0.1346022f, -0.0264709f, 0.9905461f, 6.6500000f, 25},
-{0.9737147f, -0.1238722f, 0.1911421f, 6.5900000f, 29},
-{0.3725258f, -0.0369149f, -0.9272873f, 5.5600000f, 55},
-{0.8022920f, -0.0954013f, -0.5892590f, 6.4800000f, 33},
-{0.4580310f, -0.0490269f, -0.8875832f, 6.4600000f, 43},
-{0.9908100f, -0.1271381f, 0.0461669f, 6.1600000f, 61},
-{0.9847796f, -0.1244794f, -0.1213015f, 4.6000000f, 13},
-{0.9847786f, -0.1245156f, -0.1212726f, 5.4000000f, 13},
-{0.9847786f, -0.1245156f, -0.1212726f, 5.6000000f, 13},
-{0.9511855f, -0.1194108f, -0.2845824f, 5.7700000f, 45},
-{0.4640571f, -0.0506723f, -0.8843548f, 6.2700000f, 16},
-{0.8469314f, -0.1046216f, -0.5213075f, 4.4800000f, 14},
-{0.9791078f, -0.1293004f, 0.1569372f, 6.5700000f, 20},
-{0.2047470f, -0.0365447f, 0.9781325f, 5.7300000f, 55},
-{0.8448167f, -0.1061759f, -0.5244153f, 5.7400000f, 14},
-{0.2769081f, -0.0462330f, 0.9597835f, 6.2400000f, 32},
-{0.9477846f, -0.1296969f, 0.2913469f, 6.2000000f, 52},
-{0.9765202f, -0.1293778f, -0.1722491f, 5.9300000f, 50},
-{0.7496427f, -0.0943862f, -0.6550779f, 6.3200000f, 32},
-{0.5262606f, -0.0624423f, -0.8480275f, 5.8200000f, 53},
-{0.9717323f, -0.1329308f, 0.1951046f, 6.1400000f, 12},
-{0.9525846f, -0.1322809f, 0.2740152f, 6.4000000f, 28},
-{0.8353699f, -0.1190891f, 0.5366330f, 5.8700000f, 23},
-{0.9662831f, -0.1296950f, -0.2224325f, 6.1600000f, 11},
-{0.9695736f, -0.1347694f, 0.2043632f, 6.6500000f, 16},
-{0.9703504f, -0.1355320f, 0.2001280f, 5.2300000f, 23},
-{0.5620713f, -0.0853732f, 0.8226708f, 6.4500000f, 50},
-{0.3673079f, -0.0410000f, -0.9291953f, 5.3800000f, 48},
-{0.9695531f, -0.1379375f, 0.2023363f, 6.0300000f, 50},
-{0.9703764f, -0.1337159f, -0.2012204f, 5.1500000f, 53},
-{0.8889494f, -0.1200788f, -0.4419843f, 5.9300000f, 12},
-{0.9811063f, -0.1371653f, -0.1364408f, 5.4300000f, 52},
-{0.9865193f, -0.1400512f, 0.0846489f, 5.8400000f, 50},
-{0.8293865f, -0.1228861f, 0.5449927f, 6.4200000f, 23},
-{0.6405198f, -0.0838096f, -0.7633546f, 5.2700000f, 32},
-{0.9816169f, -0.1419050f, 0.1276368f, 4.5000000f, 20},
-{0.9874606f, -0.1404705f, -0.0720390f, 5.6000000f, 30},
-{0.9144284f, -0.1279246f, -0.3839999f, 4.3300000f, 10},
-{0.8141272f, -0.1115819f, -0.5698653f, 5.8400000f, 48},
-{0.5667501f, -0.0732937f, -0.8206232f, 5.2200000f, 50},
-{0.7691382f, -0.1046637f, -0.6304538f, 6.2000000f, 53},
-{0.9592336f, -0.1416544f, 0.2445506f, 5.5300000f, 52},
-{0.9721468f, -0.1400091f, -0.1879575f, 6.2400000f, 49},
-{0.8107906f, -0.1124464f, -0.5744339f, 6.3400000f, 61},
-{0.4710067f, -0.0781647f, 0.8786598f, 5.9400000f, 48},
-{0.9891605f, -0.1462062f, -0.0136083f, 5.1000000f, 15},
-{0.3082961f, -0.0551056f, 0.9496931f, 5.9200000f, 50},
-{0.8397365f, -0.1204469f, -0.5294669f, 5.6900000f, 12},
-{0.8723729f, -0.1350570f, 0.4698140f, 5.2700000f, 20},
-{0.7978762f, -0.1133948f, -0.5920601f, 5.2400000f, 48},
-{0.6344942f, -0.0872111f, -0.7679917f, 5.6000000f, 38},
-{0.1774515f, -0.0362924f, 0.9834601f, 5.4500000f, 38},
-{0.5393656f, -0.0893922f, 0.8373134f, 5.8500000f, 22},
-{0.9350409f, -0.1374218f, -0.3268239f, 6.4000000f, 45},
-{0.9798906f, -0.1498276f, 0.1317806f, 6.4500000f, 20},
-{0.7732645f, -0.1243703f, 0.6217669f, 5.2900000f, 35},
-{0.9731885f, -0.1510634f, 0.1734476f, 5.8800000f, 54},
-{0.7863730f, -0.1146201f, -0.6070253f, 6.4400000f, 48},
-{0.4278827f, -0.0564268f, -0.9020712f, 6.2900000f, 30},
-{0.9880669f, -0.1532404f, 0.0155328f, 5.8000000f, 18},
-{0.4935785f, -0.0675607f, -0.8670731f, 6.1500000f, 13},
-{0.8025716f, -0.1193187f, -0.5845015f, 5.4200000f, 53},
-{0.5357791f, -0.0752353f, -0.8409997f, 5.7000000f, 19},
-{0.9846470f, -0.1559528f, 0.0784156f, 6.5500000f, 19},
-{0.9224616f, -0.1422139f, -0.3589427f, 4.5400000f, 20},
-{0.8448932f, -0.1284884f, -0.5192747f, 5.6200000f, 18},
-{0.6135867f, -0.0901553f, -0.7844638f, 6.1900000f, 48},
-{0.8971876f, -0.1479386f, 0.4161353f, 6.4400000f, 23},
-{0.9838370f, -0.1584145f, -0.0834846f, 5.5200000f, 18},
-{0.7618666f, -0.1297436f, 0.6346069f, 5.6900000f, 55},
-{0.7561585f, -0.1293205f, 0.6414831f, 5.2000000f, 18},
-{0.9463601f, -0.1571427f, 0.2823275f, 1.9300000f, 20},
-{0.9810616f, -0.1615415f, 0.1068763f, 6.0600000f, 8},
-{0.9425519f, -0.1508880f, -0.2980414f, 5.7000000f, 48},
-{0.8072166f, -0.1256912f, -0.5767175f, 5.5900000f, 20},
-{0.8625142f, -0.1458188f, 0.4845679f, 5.7900000f, 19},
-{0.9689152f, -0.1604680f, 0.1882908f, 6.3800000f, 50},
-{0.7265758f, -0.1259313f, 0.6754472f, 4.7900000f, 53},
-{0.9630791f, -0.1558913f, -0.2194915f, 5.9700000f, 55},
-{0.9348583f, -0.1509257f, -0.3213431f, 3.9500000f, 51},
-{0.9854225f, -0.1634522f, 0.0471791f, 6.1700000f, 51},
-{0.8000116f, -0.1263516f, -0.5865294f, 6.3500000f, 40},
-{0.9826835f, -0.1639086f, 0.0864119f, 6.1500000f, 11},
-{0.9192500f, -0.1483990f, -0.3646330f, 6.3500000f, 15},
-{0.7082637f, -0.1247798f, 0.6948327f, 6.4100000f, 51},
-{0.6216780f, -0.0956206f, -0.7774144f, 4.3900000f, 20},
-{0.9135323f, -0.1573361f, 0.3751055f, 6.0400000f, 49},
-{0.9683395f, -0.1606621f, -0.1910660f, 6.1200000f, 50},
-{0.8676993f, -0.1512492f, 0.4735204f, 6.0300000f, 17},
-{0.8957492f, -0.1560245f, 0.4162808f, 6.3800000f, 38},
-{0.9857199f, -0.1664640f, -0.0254160f, 6.1400000f, 52},
-{0.9823698f, -0.1680298f, 0.0819482f, 6.5700000f, 18},
-{0.9854336f, -0.1677131f, 0.0281591f, 6.2100000f, 9},
-{0.9393440f, -0.1567288f, -0.3050721f, 4.4300000f, 51},
-{0.7792991f, -0.1270275f, -0.6136423f, 6.0400000f, 50},
-{0.7512319f, -0.1218580f, -0.6486920f, 6.3400000f, 50},
-{0.8082742f, -0.1324686f, -0.5737115f, 5.7100000f, 17},
-{0.8396282f, -0.1397273f, -0.5248817f, 5.2700000f, 52},
-{0.9517000f, -0.1617797f, -0.2609492f, 6.0300000f, 21},
-{0.9597849f, -0.1683437f, 0.2246629f, 5.9700000f, 22},
-{0.9566842f, -0.1655848f, -0.2394514f, 4.8200000f, 52},
-{0.7237473f, -0.1203402f, -0.6794911f, 3.1700000f, 18},
-{0.7963941f, -0.1462674f, 0.5868239f, 6.4600000f, 38},
-{0.8670273f, -0.1581518f, 0.4724952f, 6.4200000f, 45},
-{0.9783228f, -0.1748384f, 0.1109775f, 6.5100000f, 18},
-{0.9114003f, -0.1590853f, -0.3795279f, 6.0500000f, 20},
-{0.9694174f, -0.1752046f, 0.1718527f, 4.6600000f, 7},
-{0.9437443f, -0.1722023f, 0.2822996f, 6.2800000f, 21},
-{0.9657309f, -0.1758803f, 0.1908661f, 6.1100000f, 61},
-{0.7003909f, -0.1332372f, 0.7012135f, 5.0200000f, 55},
-{0.8570708f, -0.1500131f, -0.4928750f, 5.7100000f, 50},
-{0.9839340f, -0.1783233f, 0.0086441f, 5.7900000f, 18},
-{0.6624611f, -0.1127210f, -0.7405668f, 4.9300000f, 48},
-{0.5865983f, -0.1145368f, 0.8017380f, 6.2700000f, 50},
-{0.7829512f, -0.1494622f, 0.6038613f, 6.1900000f, 50},
-{0.7777484f, -0.1369572f, -0.6134739f, 6.5800000f, 51},
-{0.9366858f, -0.1753171f, 0.3031231f, 5.2100000f, 22},
-{0.9772412f, -0.1810695f, 0.1105149f, 6.3700000f, 6},
-{0.4861619f, -0.0813774f, -0.8700715f, 6.1800000f, 41},
-{0.9716413f, -0.1798200f, -0.1535512f, 5.1900000f, 60},
-{0.4981045f, -0.1018725f, 0.8611120f, 4.8700000f, 23},
-{0.7929051f, -0.1548793f, 0.5893335f, 6.3100000f, 22},
-{0.8887562f, -0.1724817f, 0.4246911f, 2.9800000f, 48},
-{0.9809857f, -0.1867264f, 0.0529169f, 6.1900000f, 50},
-{0.7575248f, -0.1377851f, -0.6380999f, 6.1200000f, 14},
-{0.6796379f, -0.1223525f, -0.7232719f, 6.6500000f, 62},
-{0.5308839f, -0.1100012f, 0.8402750f, 5.3500000f, 50},
-{0.9555922f, -0.1856978f, 0.2288228f, 4.4900000f, 50},
-{0.9796100f, -0.1888426f, 0.0685764f, 5.9000000f, 10},
-{0.8582356f, -0.1697731f, 0.4843643f, 5.4400000f, 54},
-{0.9139480f, -0.1725408f, -0.3673266f, 6.1300000f, 30},
-{0.7788354f, -0.1453096f, -0.6101644f, 6.2900000f, 23},
-{0.7094302f, -0.1467169f, 0.6893351f, 5.2500000f, 40},
-{0.9558070f, -0.1913794f, 0.2231745f, 3.3600000f, 35},
-{0.5510388f, -0.1176673f, 0.8261420f, 6.3300000f, 36},
-{0.5510440f, -0.1176433f, 0.8261420f, 6.2800000f, 35},
-{0.6446336f, -0.1360219f, 0.7522935f, 5.2200000f, 50},
-{0.7653419f, -0.1466487f, -0.6266945f, 6.3000000f, 28},
-{0.9560564f, -0.1940920f, 0.2197374f, 6.4600000f, 29},
-{0.3721333f, -0.0841227f, 0.9243593f, 5.1400000f, 14},
-{0.9459745f, -0.1888026f, -0.2636018f, -1.4600000f, 21},
-{0.8417008f, -0.1654148f, -0.5139821f, 5.2000000f, 12},
-{0.8766262f, -0.1738350f, -0.4486735f, 6.4500000f, 42},
-{0.9684723f, -0.1994154f, 0.1493148f, 5.9300000f, 12},
-{0.9055713f, -0.1817250f, -0.3832970f, 6.0500000f, 50},
-{0.8543273f, -0.1700913f, -0.4911149f, 6.5400000f, 18},
-{0.9540287f, -0.1940488f, -0.2284170f, 5.3200000f, 22},
-{0.9297694f, -0.1950506f, 0.3122244f, 6.2000000f, 22},
-{0.8473323f, -0.1700059f, -0.5031163f, 5.9200000f, 36},
-{0.8569992f, -0.1724965f, -0.4855896f, 5.8000000f, 12},
-{0.9647933f, -0.1991406f, -0.1718049f, 5.6600000f, 19},
-{0.9691374f, -0.2030371f, 0.1398164f, 4.7700000f, 54},
-{0.9518256f, -0.1973374f, -0.2347039f, 5.2900000f, 19},
-{0.3329465f, -0.0601515f, -0.9410252f, 6.5100000f, 51},
-{0.9774076f, -0.2071304f, 0.0420888f, 4.4700000f, 50},
-{0.7672853f, -0.1562977f, -0.6219681f, 6.6200000f, 16},
-{0.9711955f, -0.2047441f, -0.1218982f, 5.0700000f, 61},
-{0.9140922f, -0.1902355f, -0.3581145f, 6.0800000f, 17},
-{0.7903715f, -0.1615273f, -0.5909499f, 6.2100000f, 14},
-{0.3503433f, -0.0836305f, 0.9328802f, 5.1200000f, 17},
-{0.8226689f, -0.1812079f, 0.5388688f, 5.7100000f, 53},
-{0.6063107f, -0.1217995f, -0.7858449f, 6.5700000f, 46},
-{0.9777904f, -0.2092482f, -0.0118825f, 5.7500000f, 31},
-{0.6088688f, -0.1235853f, -0.7835850f, 5.8000000f, 53},
-{0.7274738f, -0.1638266f, 0.6662903f, 5.0200000f, 53},
-{0.9770246f, -0.2124081f, 0.0174863f, 6.1500000f, 13},
-{0.7911009f, -0.1658340f, -0.5887771f, 5.2600000f, 19},
-{0.9376716f, -0.2071472f, 0.2790377f, 5.8500000f, 17},
-{0.4947361f, -0.1166886f, 0.8611736f, 5.3300000f, 44},
-{0.9765330f, -0.2132460f, -0.0301557f, 5.7400000f, 18},
-{0.9446014f, -0.2049348f, -0.2563784f, 5.3900000f, 16},
-{0.6197242f, -0.1285643f, -0.7742178f, 5.4000000f, 51},
-{0.5851931f, -0.1208992f, -0.8018307f, 6.4600000f, 46},
-{0.9492725f, -0.2122963f, 0.2319743f, 5.6500000f, 53},
-{0.5689294f, -0.1191449f, -0.8137099f, 5.6100000f, 55},
-{0.2176386f, -0.0583840f, 0.9742817f, 4.5500000f, 54},
-{0.8926452f, -0.1968053f, -0.4055272f, 6.3300000f, 21},
-{0.9053427f, -0.2071433f, 0.3707376f, 5.2700000f, 22},
-{0.9754607f, -0.2199712f, 0.0094392f, 5.7700000f, 32},
-{0.2890280f, -0.0556755f, -0.9557003f, 6.3700000f, 48},
-{0.6901192f, -0.1629041f, 0.7051225f, 6.2600000f, 28},
-{0.8928651f, -0.2061341f, 0.4003757f, 5.6500000f, 55},
-{0.9662280f, -0.2173281f, -0.1384625f, 6.2900000f, 22},
-{0.9337225f, -0.2085620f, -0.2909712f, 5.7900000f, 50},
-{0.3424373f, -0.0680141f, -0.9370757f, 6.1100000f, 53},
-{0.8723697f, -0.1937991f, -0.4487905f, 7.0400000f, 12},
-{0.8326332f, -0.1839869f, -0.5223704f, 3.9600000f, 11},
-{0.7578351f, -0.1785337f, 0.6275442f, 6.1200000f, 32},
-{0.8075125f, -0.1893570f, 0.5586301f, 3.6000000f, 23},
-{0.7622539f, -0.1802711f, 0.6216682f, 6.3000000f, 35},
-{0.7895399f, -0.1861180f, 0.5847964f, 6.0100000f, 53},
-{0.9733344f, -0.2231692f, 0.0530622f, 6.3800000f, 22},
-{0.8898130f, -0.1997734f, -0.4102723f, 6.3300000f, 12},
-{0.8426643f, -0.1883127f, -0.5044355f, 5.7000000f, 16},
-{0.6957708f, -0.1541319f, -0.7015314f, 6.5500000f, 55},
-{0.7609716f, -0.1825175f, 0.6225829f, 6.4800000f, 19},
-{0.6857475f, -0.1517440f, -0.7118456f, 5.1400000f, 35},
-{0.8121759f, -0.1833048f, -0.5538680f, 4.9900000f, 55},
-{0.4881208f, -0.1041763f, -0.8665364f, 3.2700000f, 27},
-{0.9631606f, -0.2260107f, 0.1457425f, 5.7700000f, 30},
-{0.9707413f, -0.2258167f, -0.0816583f, 6.3000000f, 50},
-{0.6355776f, -0.1407199f, -0.7591041f, 2.9300000f, 51},
-{0.5960657f, -0.1317490f, -0.7920529f, 4.4000000f, 46},
-{0.9551378f, -0.2265552f, 0.1907471f, 6.2400000f, 50},
-{0.6766815f, -0.1663759f, 0.7172316f, 6.3400000f, 50},
-{0.6996006f, -0.1719840f, 0.6935276f, 6.1300000f, 29},
-{0.7908117f, -0.1815014f, -0.5845290f, 5.9600000f, 23},
-{0.1847580f, -0.0326152f, -0.9822427f, 5.6400000f, 25},
-{0.5073841f, -0.1295074f, 0.8519326f, 4.3500000f, 45},
-{0.5197365f, -0.1325275f, 0.8439848f, 6.0500000f, 53},
-{0.4918115f, -0.1090733f, -0.8638428f, 6.1100000f, 37},
-{0.6559670f, -0.1500759f, -0.7397192f, 6.4200000f, 52},
-{0.9461214f, -0.2299618f, 0.2279732f, 4.6500000f, 30},
-{0.9202321f, -0.2180142f, -0.3250272f, 5.6400000f, 31},
-{0.9301685f, -0.2205754f, -0.2934842f, 6.1400000f, 25},
-{0.8818743f, -0.2076606f, -0.4232904f, 6.4000000f, 64},
-{0.6702818f, -0.1687933f, 0.7226556f, 5.8700000f, 18},
-{0.8773340f, -0.2159404f, 0.4285497f, 5.7300000f, 40},
-{0.9696793f, -0.2334334f, -0.0723243f, 6.4100000f, 26},
-{0.9154542f, -0.2178739f, -0.3383410f, 4.8300000f, 11},
-{0.9718379f, -0.2351572f, -0.0152371f, 5.4500000f, 24},
-{0.6647039f, -0.1686075f, 0.7278326f, 5.8600000f, 50},
-{0.9510677f, -0.2291652f, -0.2072525f, 4.0700000f, 54},
-{0.7293206f, -0.1705962f, -0.6625619f, 6.5200000f, 35},
-{0.8632053f, -0.2055052f, -0.4611336f, 6.0400000f, 45},
-{0.9716419f, -0.2364191f, -0.0042518f, 6.2100000f, 13},
-{0.8920596f, -0.2138421f, -0.3981221f, 6.2100000f, 21},
-{0.7232464f, -0.1695860f, -0.6694440f, 6.4600000f, 18},
-{0.8894460f, -0.2140776f, -0.4038026f, 3.8700000f, 52},
-{0.3170227f, -0.0869630f, 0.9444226f, 5.6800000f, 54},
-{0.9711511f, -0.2375493f, -0.0208794f, 6.0400000f, 46},
-{0.9009044f, -0.2171890f, -0.3757660f, 6.9100000f, 30},
-{0.9605126f, -0.2375991f, 0.1447832f, 6.2900000f, 20},
-{0.6837511f, -0.1756158f, 0.7082680f, 4.9000000f, 22},
-{0.8065254f, -0.2048626f, 0.5545701f, 5.8900000f, 45},
-{0.5735026f, -0.1344654f, -0.8080927f, 6.5700000f, 45},
-{0.9150429f, -0.2241000f, -0.3353739f, 5.7400000f, 23},
-{0.9552340f, -0.2400711f, 0.1728985f, 5.9200000f, 18},
-{0.9129398f, -0.2260284f, -0.3397823f, 4.6800000f, 32},
-{0.7264080f, -0.1758876f, -0.6643756f, 6.3200000f, 33},
-{0.5064121f, -0.1186769f, -0.8540858f, 6.4100000f, 23},
-{0.9415394f, -0.2352322f, -0.2411833f, 5.0000000f, 45},
-{0.6329182f, -0.1520622f, -0.7591388f, 6.2600000f, 50},
-{0.9057092f, -0.2248954f, -0.3593228f, 5.3000000f, 13},
-{0.9280280f, -0.2319713f, -0.2914675f, 4.3700000f, 13},
-{0.9479232f, -0.2426286f, 0.2063323f, 6.2700000f, 32},
-{0.8385959f, -0.2087487f, -0.5031708f, 6.3600000f, 13},
-{0.9602131f, -0.2438705f, -0.1360806f, 6.3400000f, 50},
-{0.7614588f, -0.2006412f, 0.6163795f, 6.0000000f, 52},
-{0.8687833f, -0.2278805f, 0.4396431f, 6.1000000f, 37},
-{0.3487929f, -0.0796440f, -0.9338096f, 5.4000000f, 17},
-{0.8996916f, -0.2295236f, -0.3713138f, 6.6100000f, 11},
-{0.7974586f, -0.2016461f, -0.5686815f, 6.2900000f, 52},
-{0.8693428f, -0.2307660f, 0.4370242f, 6.4000000f, 18},
-{0.9588862f, -0.2508884f, 0.1326360f, 6.2700000f, 23},
-{0.8891615f, -0.2281531f, -0.3966584f, 5.4600000f, 30},
-{0.6580867f, -0.1648930f, -0.7346647f, 4.9500000f, 61},
-{0.0470677f, -0.0220753f, 0.9986477f, 5.0700000f, 62},
-{0.9651908f, -0.2538884f, 0.0628292f, 5.9700000f, 48},
-{0.8669973f, -0.2230372f, -0.4456120f, 6.2300000f, 12},
-{0.7985801f, -0.2039019f, -0.5662984f, 6.2300000f, 38},
-{0.9588010f, -0.2539304f, 0.1273579f, 6.3500000f, 17},
-{0.8637623f, -0.2238935f, -0.4514270f, 6.3700000f, 12},
-{0.9278537f, -0.2497606f, 0.2769606f, 5.6800000f, 53},
-{0.8797751f, -0.2299774f, -0.4160604f, 5.5900000f, 13},
-{0.3164550f, -0.0935330f, 0.9439851f, 6.5000000f, 50},
-{0.8618012f, -0.2253861f, -0.4544224f, 1.5000000f, 12},
-{0.8033036f, -0.2093135f, -0.5575761f, 5.0600000f, 13},
-{0.8141881f, -0.2230676f, 0.5360396f, 6.5900000f, 29},
-{0.8460410f, -0.2216785f, -0.4848435f, 6.4200000f, 13},
-{0.9624311f, -0.2592334f, -0.0807740f, 6.3000000f, 40},
-{0.9057286f, -0.2412285f, -0.3485175f, 6.2600000f, 12},
-{0.9570126f, -0.2581994f, -0.1321363f, 5.9600000f, 19},
-{0.9084425f, -0.2439901f, -0.3394129f, 6.3100000f, 14},
-{0.6931503f, -0.1815106f, -0.6975647f, 6.2200000f, 20},
-{0.9538283f, -0.2585015f, -0.1529331f, 6.4900000f, 11},
-{0.8960052f, -0.2414323f, -0.3726729f, 6.5300000f, 12},
-{0.9605847f, -0.2649950f, 0.0839919f, 6.6300000f, 23},
-{0.8784004f, -0.2453089f, 0.4101662f, 5.1800000f, 45},
-{0.9172556f, -0.2562102f, 0.3049566f, 5.9400000f, 61},
-{0.9289896f, -0.2588980f, 0.2644809f, 5.7400000f, 51},
-{0.9591976f, -0.2656335f, 0.0968446f, 6.5900000f, 12},
-{0.5649346f, -0.1478390f, -0.8117835f, 6.2700000f, 52},
-{0.9224853f, -0.2582496f, 0.2869286f, 5.8200000f, 62},
-{0.9637054f, -0.2667234f, -0.0114220f, 6.1700000f, 45},
-{0.8559892f, -0.2322062f, -0.4619120f, 6.2700000f, 35},
-{0.5465237f, -0.1428766f, -0.8251655f, 6.4500000f, 32},
-{0.9610156f, -0.2662423f, -0.0745920f, 5.2000000f, 62},
-{0.8758175f, -0.2391790f, -0.4192100f, 5.6300000f, 12},
-{0.8135433f, -0.2211492f, -0.5378106f, 6.4000000f, 48},
-{0.4822638f, -0.1429026f, 0.8642919f, 6.4400000f, 48},
-{0.8384963f, -0.2384828f, 0.4899489f, 5.9300000f, 44},
-{0.5805124f, -0.1710284f, 0.7960871f, 6.1200000f, 23},
-{0.6450723f, -0.1884796f, 0.7405114f, 6.3800000f, 19},
-{0.8659179f, -0.2389946f, -0.4393949f, 3.4700000f, 57},
-{0.9498899f, -0.2692320f, 0.1588187f, 5.9700000f, 23},
-{0.9604850f, -0.2704927f, -0.0655918f, 4.9900000f, 11},
-{0.9441868f, -0.2691071f, 0.1899809f, 5.1300000f, 53},
-{0.8998514f, -0.2584886f, 0.3513560f, 3.7900000f, 37},
-{0.9382959f, -0.2684318f, 0.2180486f, 5.9800000f, 55},
-{0.6125156f, -0.1665842f, -0.7727059f, 5.1400000f, 61},
-{0.8912930f, -0.2514756f, -0.3773021f, 3.0200000f, 13},
-{0.9605316f, -0.2769557f, 0.0259734f, 6.5700000f, 20},
-{0.9579578f, -0.2750821f, -0.0815278f, 5.6200000f, 53},
-{0.9470708f, -0.2713669f, -0.1715136f, 6.4500000f, 19},
-{0.9314819f, -0.2660355f, -0.2481263f, 4.1200000f, 18},
-{0.7091494f, -0.1975312f, -0.6768224f, 6.4300000f, 20},
-{0.8857416f, -0.2594565f, 0.3848950f, 6.0200000f, 18},
-{0.7902381f, -0.2348045f, 0.5660306f, 5.5500000f, 48},
-{0.5245601f, -0.1432205f, -0.8392405f, 6.0200000f, 28},
-{0.3916574f, -0.1046543f, -0.9141400f, 5.1700000f, 53},
-{0.9469486f, -0.2789341f, 0.1596371f, 5.7800000f, 60},
-{0.8905879f, -0.2586765f, -0.3740851f, 6.0900000f, 50},
-{0.7933859f, -0.2401859f, 0.5593296f, 5.9100000f, 54},
-{0.7180880f, -0.2060667f, -0.6647452f, 5.2000000f, 20},
-{0.7099799f, -0.2034326f, -0.6741986f, 5.5400000f, 43},
-{0.7099986f, -0.2035218f, -0.6741520f, 6.7900000f, 50},
-{0.8436275f, -0.2555767f, 0.4722004f, 6.4800000f, 19},
-{0.9463210f, -0.2795422f, -0.1622736f, 6.4900000f, 10},
-{0.8829579f, -0.2672395f, 0.3859642f, 7.6800000f, 33},
-{0.6380884f, -0.1826526f, -0.7479848f, 4.9300000f, 24},
-{0.7941398f, -0.2436330f, 0.5567629f, 6.2800000f, 51},
-{0.4981027f, -0.1410897f, -0.8555626f, 5.5000000f, 19},
-{0.7586306f, -0.2341283f, 0.6079996f, 6.1600000f, 51},
-{0.9539233f, -0.2875826f, 0.0855956f, 6.1100000f, 19},
-{0.8025846f, -0.2359598f, -0.5478877f, 6.1400000f, 32},
-{0.9413003f, -0.2818590f, -0.1857667f, 5.3900000f, 10},
-{0.9384860f, -0.2806594f, -0.2011824f, 6.4800000f, 7},
-{0.8357822f, -0.2476096f, -0.4900588f, 6.3400000f, 13},
-{0.2959462f, -0.0989767f, 0.9500629f, 6.3500000f, 50},
-{0.9484073f, -0.2891655f, 0.1300263f, 5.7500000f, 50},
-{0.5477027f, -0.1578403f, -0.8216497f, 5.1700000f, 20},
-{0.9191257f, -0.2826137f, 0.2744767f, 5.4400000f, 48},
-{0.7594494f, -0.2250973f, -0.6103833f, 6.1100000f, 40},
-{0.8813397f, -0.2647150f, -0.3913647f, 6.0800000f, 52},
-{0.6215025f, -0.1819609f, -0.7619875f, 6.4600000f, 53},
-{0.8654199f, -0.2604687f, -0.4280240f, 6.6200000f, 12},
-{0.1920023f, -0.0483820f, -0.9802012f, 5.4500000f, 19},
-{0.8864014f, -0.2683661f, -0.3771898f, 5.7100000f, 12},
-{0.7429340f, -0.2240162f, -0.6307661f, 5.7900000f, 13},
-{0.8887535f, -0.2806991f, 0.3623883f, 6.4300000f, 49},
-{0.8619268f, -0.2651290f, -0.4321907f, 1.8400000f, 38},
-{0.9410662f, -0.2937327f, -0.1676769f, 6.2100000f, 6},
-{0.8729639f, -0.2703179f, -0.4060323f, 6.6500000f, 12},
-{0.7361086f, -0.2379517f, 0.6336585f, 4.9000000f, 54},
-{0.8225918f, -0.2638678f, 0.5037028f, 4.4100000f, 52},
-{0.6149230f, -0.1857196f, -0.7664058f, 5.9600000f, 50},
-{0.9184031f, -0.2876047f, -0.2716971f, 6.0300000f, 11},
-{0.8492118f, -0.2734084f, 0.4517601f, 5.7800000f, 24},
-{0.9513616f, -0.3010056f, -0.0656257f, 4.9200000f, 50},
-{0.7491710f, -0.2320922f, -0.6203838f, 4.8300000f, 12},
-{0.5917905f, -0.1962604f, 0.7818349f, 5.4700000f, 63},
-{0.8663187f, -0.2719653f, -0.4189591f, 5.6900000f, 12},
-{0.9103043f, -0.2876948f, -0.2976202f, 6.2300000f, 30},
-{0.8674217f, -0.2836847f, 0.4087818f, 5.8500000f, 35},
-{0.9518580f, -0.3064941f, 0.0052699f, 5.4500000f, 28},
-{0.8530696f, -0.2702956f, -0.4463323f, 5.4600000f, 48},
-{0.1415717f, -0.0553139f, 0.9883814f, 6.3100000f, 20},
-{0.9466228f, -0.3069144f, 0.0985334f, 6.0900000f, 21},
-{0.8447131f, -0.2777956f, 0.4574817f, 6.4300000f, 38},
-{0.3720185f, -0.1106120f, -0.9216112f, 6.4700000f, 50},
-{0.9465525f, -0.3081168f, 0.0954066f, 6.1600000f, 50},
-{0.9512032f, -0.3084453f, 0.0086005f, 4.1500000f, 22},
-{0.4779915f, -0.1643874f, 0.8628447f, 5.2000000f, 52},
-{0.8989976f, -0.2907727f, -0.3274973f, 5.8400000f, 20},
-{0.9116910f, -0.3022707f, 0.2783020f, 5.0000000f, 64},
-{0.8681940f, -0.2829452f, -0.4076532f, 5.9200000f, 12},
-{0.6488964f, -0.2070633f, -0.7321600f, 5.1400000f, 52},
-{0.8302931f, -0.2700523f, -0.4875295f, 6.1000000f, 28},
-{0.6420989f, -0.2205754f, 0.7342040f, 5.5800000f, 40},
-{0.8609257f, -0.2899147f, 0.4180388f, 6.8900000f, 21},
-{0.9328754f, -0.3081578f, -0.1865002f, 5.7800000f, 50},
-{0.8504559f, -0.2779787f, -0.4466013f, 6.5900000f, 25},
-{0.8593947f, -0.2904642f, 0.4207983f, 5.8200000f, 61},
-{0.7742262f, -0.2531621f, -0.5800713f, 5.9600000f, 13},
-{0.7335724f, -0.2392843f, -0.6360932f, 5.3100000f, 23},
-{0.9264619f, -0.3124341f, 0.2098888f, 5.6200000f, 46},
-{0.9464639f, -0.3182138f, 0.0542773f, 5.3500000f, 52},
-{0.8841573f, -0.2932562f, -0.3636848f, 6.0100000f, 52},
-{0.9474336f, -0.3178498f, -0.0366195f, 5.7500000f, 55},
-{0.9386186f, -0.3152343f, -0.1400804f, 5.9000000f, 53},
-{0.8850315f, -0.2952903f, -0.3598928f, 6.3600000f, 12},
-{0.8481117f, -0.2821498f, -0.4484396f, 6.1200000f, 10},
-{0.3345458f, -0.1034046f, -0.9366892f, 5.6900000f, 32},
-{0.3345515f, -0.1034784f, -0.9366790f, 3.7800000f, 50},
-{0.5790412f, -0.2038037f, 0.7894145f, 5.9200000f, 51},
-{0.8356968f, -0.2875564f, 0.4678913f, 5.7100000f, 61},
-{0.9341689f, -0.3147003f, -0.1682026f, 6.0300000f, 10},
-{0.6691354f, -0.2192243f, -0.7100693f, 4.4900000f, 30},
-{0.8138413f, -0.2714588f, -0.5137825f, 6.6000000f, 12},
-{0.1217689f, -0.0511078f, 0.9912418f, 4.9600000f, 64},
-{0.8241278f, -0.2755627f, -0.4948521f, 6.3300000f, 12},
-{0.9464743f, -0.3227669f, 0.0028168f, 6.4100000f, 45},
-{0.8545724f, -0.2869867f, -0.4328332f, 4.6600000f, 13},
-{0.6734640f, -0.2228030f, -0.7048440f, 4.8900000f, 20},
-{0.9368498f, -0.3210142f, 0.1387890f, 5.8200000f, 64},
-{0.6899412f, -0.2293123f, -0.6865836f, 5.1000000f, 65},
-{0.8568550f, -0.2900780f, -0.4262091f, 3.8500000f, 12},
-{0.8441915f, -0.2859552f, -0.4533986f, 5.5800000f, 54},
-{0.6121295f, -0.2183659f, 0.7600091f, 5.0500000f, 24},
-{0.9331729f, -0.3200349f, -0.1636034f, 5.9500000f, 50},
-{0.7126380f, -0.2524867f, 0.6545209f, 5.7800000f, 25},
-{0.4345578f, -0.1412663f, -0.8894961f, 6.0200000f, 20},
-{0.8753302f, -0.3005106f, -0.3788012f, 6.3200000f, 20},
-{0.8252496f, -0.2815407f, -0.4895896f, 5.3600000f, 13},
-{0.8082901f, -0.2865018f, 0.5143772f, 6.2400000f, 20},
-{0.9154222f, -0.3162853f, -0.2489294f, 5.4600000f, 22},
-{0.7193061f, -0.2440024f, -0.6504318f, 5.9400000f, 14},
-{0.9372542f, -0.3286656f, 0.1163337f, 6.6500000f, 18},
-{0.6680543f, -0.2260102f, -0.7089590f, 5.7200000f, 20},
-{0.6372914f, -0.2152051f, -0.7399638f, 4.7600000f, 18},
-{0.9035044f, -0.3203619f, 0.2846893f, 3.5800000f, 23},
-{0.8715689f, -0.3027167f, -0.3856556f, 4.7900000f, 53},
-{0.9392630f, -0.3304366f, -0.0927182f, 6.2900000f, 52},
-{0.8482178f, -0.2944818f, -0.4402352f, 4.6400000f, 63},
-{0.5891680f, -0.2009995f, -0.7826112f, 5.9700000f, 51},
-{0.8249507f, -0.2878972f, -0.4863862f, 6.3200000f, 29},
-{0.7477093f, -0.2593926f, -0.6112662f, 5.8000000f, 14},
-{0.7696892f, -0.2681283f, -0.5793839f, 5.0300000f, 12},
-{0.6656865f, -0.2300539f, -0.7098850f, 5.6600000f, 54},
-{0.4695036f, -0.1762099f, 0.8651684f, 6.3500000f, 28},
-{0.7547837f, -0.2641120f, -0.6004551f, 2.7000000f, 53},
-{0.8531754f, -0.3012807f, -0.4258188f, 6.4600000f, 12},
-{0.6899264f, -0.2547040f, 0.6775894f, 6.3500000f, 50},
-{0.6604449f, -0.2446063f, 0.7099157f, 5.7700000f, 27},
-{0.8712062f, -0.3176242f, 0.3743189f, 3.5300000f, 32},
-{0.9395485f, -0.3390612f, 0.0478135f, 5.8900000f, 49},
-{0.9327057f, -0.3385249f, 0.1243423f, 5.9100000f, 38},
-{0.9068987f, -0.3305996f, 0.2612253f, 6.4500000f, 22},
-{0.8639435f, -0.3087909f, -0.3978063f, 4.9800000f, 7},
-{0.8664599f, -0.3098395f, -0.3914674f, 4.4000000f, 9},
-{0.5326954f, -0.2014172f, 0.8219895f, 6.5300000f, 19},
-{0.5327189f, -0.2014792f, 0.8219591f, 5.4500000f, 18},
-{0.8913411f, -0.3201705f, -0.3209390f, 6.0900000f, 30},
-{0.8502928f, -0.3046722f, -0.4291585f, 5.2800000f, 42},
-{0.7692845f, -0.2735769f, -0.5773708f, 4.6600000f, 12},
-{0.9058164f, -0.3273125f, -0.2690039f, 5.7000000f, 31},
-{0.7002966f, -0.2482288f, -0.6693035f, 5.8500000f, 18},
-{0.7689714f, -0.2747135f, -0.5772481f, 5.1100000f, 12},
-{0.7341043f, -0.2619804f, -0.6264640f, 5.2500000f, 21},
-{0.7277054f, -0.2728865f, 0.6292676f, 6.4000000f, 50},
-{0.7503558f, -0.2807083f, 0.5984722f, 5.1300000f, 50},
-{0.7954940f, -0.2865065f, -0.5339507f, 6.3000000f, 52},
-{0.8777535f, -0.3279458f, 0.3492854f, 5.1000000f, 60},
-{0.9117752f, -0.3362360f, -0.2358206f, 5.4500000f, 45},
-{0.1449104f, -0.0635069f, 0.9874046f, 6.4100000f, 47},
-{0.9305305f, -0.3445907f, -0.1239767f, 6.5500000f, 35},
-{0.8751632f, -0.3223732f, -0.3607837f, 6.6100000f, 12},
-{0.8501521f, -0.3132865f, -0.4231938f, 6.0100000f, 12},
-{0.9365785f, -0.3504441f, 0.0030931f, 5.9900000f, 18},
-{0.8562567f, -0.3161940f, -0.4084676f, 5.8700000f, 64},
-{0.3834508f, -0.1335880f, -0.9138489f, 3.9800000f, 36},
-{0.5752914f, -0.2235837f, 0.7867974f, 5.8000000f, 55},
-{0.7079063f, -0.2722419f, 0.6517308f, 5.1900000f, 51},
-{0.9295982f, -0.3477167f, -0.1222302f, 6.4300000f, 9},
-{0.9360515f, -0.3514114f, -0.0178208f, 6.2300000f, 35},
-{0.8465042f, -0.3227196f, 0.4234178f, 5.0300000f, 48},
-{0.3725831f, -0.1494565f, 0.9158846f, 6.4700000f, 19},
-{0.8604742f, -0.3280240f, 0.3898518f, 6.0200000f, 21},
-{0.9337239f, -0.3510723f, -0.0700563f, 5.8200000f, 33},
-{0.8854041f, -0.3320301f, -0.3252931f, 4.9600000f, 17},
-{0.5822213f, -0.2129379f, -0.7846502f, 6.0500000f, 30},
-{0.5821916f, -0.2129415f, -0.7846712f, 6.6000000f, 40},
-{0.5790487f, -0.2126039f, -0.7870846f, 5.3900000f, 19},
-{0.8262813f, -0.3194845f, 0.4638845f, 5.7600000f, 30},
-{0.8988541f, -0.3471168f, 0.2675280f, 6.4100000f, 12},
-{0.6070658f, -0.2413150f, 0.7571249f, 4.6400000f, 21},
-{0.8092156f, -0.3066248f, -0.5011500f, 5.4300000f, 15},
-{0.9127896f, -0.3548269f, 0.2022698f, 5.3000000f, 25},
-{0.8234305f, -0.3232240f, 0.4663566f, 3.7900000f, 49},
-{0.8386291f, -0.3197593f, -0.4409707f, 5.3800000f, 52},
-{0.7940830f, -0.3029596f, -0.5269228f, 5.3900000f, 13},
-{0.8103949f, -0.3106961f, -0.4967173f, 6.6000000f, 12},
-{0.8973034f, -0.3474481f, -0.2722616f, 5.3300000f, 12},
-{0.8706432f, -0.3354587f, -0.3597887f, 6.1900000f, 18},
-{0.8187800f, -0.3146897f, -0.4801767f, 2.4500000f, 15},
-{0.9188044f, -0.3602991f, 0.1611923f, 4.9900000f, 46},
-{0.7725287f, -0.2964364f, -0.5615379f, 6.3100000f, 17},
-{0.3385789f, -0.1417666f, 0.9301971f, 5.6400000f, 52},
-{0.8815270f, -0.3421209f, -0.3253665f, 6.2400000f, 22},
-{0.9105798f, -0.3547380f, -0.2121445f, 5.7800000f, 30},
-{0.9281281f, -0.3648979f, -0.0736734f, 5.9700000f, 43},
-{0.8059521f, -0.3123251f, -0.5028859f, 5.3500000f, 48},
-{0.8642131f, -0.3440723f, 0.3670830f, 6.5400000f, 36},
-{0.9137826f, -0.3620920f, 0.1840943f, 6.3700000f, 22},
-{0.8714541f, -0.3474031f, 0.3462353f, 5.9300000f, 32},
-{0.9286260f, -0.3660686f, -0.0603952f, 6.7600000f, 20},
-{0.8752113f, -0.3418100f, -0.3423026f, 6.0500000f, 28},
-{0.9122101f, -0.3624978f, 0.1909660f, 6.4100000f, 16},
-{0.8455702f, -0.3306165f, -0.4191704f, 5.7800000f, 17},
-{0.7474341f, -0.2898606f, -0.5977651f, 6.9700000f, 30},
-{0.7474401f, -0.2898691f, -0.5977534f, 6.8400000f, 30},
-{0.6172509f, -0.2520840f, 0.7452885f, 5.7200000f, 19},
-{0.9188655f, -0.3672875f, 0.1441739f, 2.9000000f, 18},
-{0.8633889f, -0.3476929f, 0.3656079f, 5.2200000f, 35},
-{0.8040253f, -0.3155663f, -0.5039457f, 6.3100000f, 12},
-{0.0516669f, -0.0107416f, -0.9986066f, 6.4700000f, 33},
-{0.5979660f, -0.2474819f, 0.7623578f, 5.3600000f, 36},
-{0.8598992f, -0.3416668f, -0.3792588f, 6.5600000f, 21},
-{0.9203300f, -0.3720010f, 0.1208636f, 5.2500000f, 30},
-{0.7865856f, -0.3222481f, 0.5267250f, 4.1800000f, 30},
-{0.8920136f, -0.3564790f, -0.2779108f, 5.6300000f, 25},
-{0.9156924f, -0.3707231f, 0.1551510f, 4.3200000f, 53},
-{0.8555331f, -0.3412798f, -0.3893472f, 5.6100000f, 10},
-{0.7716878f, -0.3067214f, -0.5571534f, 5.9000000f, 12},
-{0.8158104f, -0.3351705f, 0.4712898f, 5.0500000f, 24},
-{0.8938815f, -0.3647332f, 0.2606637f, 6.2200000f, 19},
-{0.9120478f, -0.3678510f, -0.1812582f, 5.7900000f, 48},
-{0.8652184f, -0.3483200f, -0.3606526f, 5.9500000f, 15},
-{0.8166490f, -0.3374811f, 0.4681783f, 5.0100000f, 52},
-{0.5853939f, -0.2316704f, -0.7769446f, 5.1000000f, 50},
-{0.8121719f, -0.3280838f, -0.4824290f, 5.5400000f, 19},
-{0.9039999f, -0.3735097f, 0.2080255f, 4.5400000f, 51},
-{0.9250235f, -0.3799064f, -0.0016532f, 5.5900000f, 55},
-{0.9189793f, -0.3779709f, -0.1123168f, 5.8600000f, 38},
-{0.9117799f, -0.3747308f, -0.1680306f, 5.7500000f, 55},
-{0.9012272f, -0.3703784f, -0.2249652f, 6.0500000f, 37},
-{0.7477965f, -0.3035726f, -0.5904609f, 6.5800000f, 21},
-{0.8005208f, -0.3269106f, -0.5022907f, 6.3800000f, 13},
-{0.8005048f, -0.3269176f, -0.5023116f, 7.1300000f, 14},
-{0.7165081f, -0.3038752f, 0.6279140f, 6.5400000f, 22},
-{0.7969986f, -0.3263923f, -0.5081941f, 5.7700000f, 12},
-{0.8508097f, -0.3517937f, -0.3903384f, 4.8500000f, 25},
-{0.7372150f, -0.3019594f, -0.6044292f, 5.4300000f, 15},
-{0.9192514f, -0.3847747f, -0.0832189f, 6.2400000f, 50},
-{0.8801924f, -0.3727435f, 0.2938086f, 5.4200000f, 52},
-{0.6799288f, -0.2789631f, -0.6781419f, 3.2500000f, 55},
-{0.8467017f, -0.3630863f, 0.3889274f, 6.5400000f, 50},
-{0.9198234f, -0.3909077f, 0.0334071f, 5.2500000f, 30},
-{0.8067098f, -0.3370750f, -0.4853862f, 4.6500000f, 43},
-{0.7401766f, -0.3092685f, -0.5970691f, 6.6500000f, 44},
-{0.9132446f, -0.3881040f, -0.1239334f, 5.9000000f, 35},
-{0.5770404f, -0.2389983f, -0.7809636f, 5.8700000f, 50},
-{0.7469295f, -0.3148627f, -0.5856259f, 6.6800000f, 14},
-{0.8829497f, -0.3821246f, 0.2727281f, 5.2500000f, 21},
-{0.9169439f, -0.3948668f, 0.0573946f, 5.5900000f, 32},
-{0.4132256f, -0.1687499f, -0.8948565f, 6.3900000f, 55},
-{0.7625275f, -0.3225487f, -0.5608156f, 6.6100000f, 20},
-{0.7777653f, -0.3406059f, 0.5282696f, 2.8800000f, 22},
-{0.7777677f, -0.3406069f, 0.5282655f, 1.9800000f, 21},
-{0.5477287f, -0.2283200f, -0.8048996f, 5.9600000f, 61},
-{0.9013584f, -0.3923194f, 0.1834081f, 6.2800000f, 21},
-{0.5132930f, -0.2306382f, 0.8266416f, 5.9200000f, 52},
-{0.7622600f, -0.3250201f, -0.5597515f, 6.3000000f, 19},
-{0.7846762f, -0.3458585f, 0.5144562f, 5.3300000f, 50},
-{0.8921786f, -0.3850099f, -0.2361881f, 6.2100000f, 11},
-{0.6678729f, -0.2971234f, 0.6823954f, 6.3000000f, 30},
-{0.8703337f, -0.3753878f, -0.3187525f, 5.6600000f, 53},
-{0.8436732f, -0.3631758f, -0.3953718f, 5.8500000f, 27},
-{0.9150150f, -0.3991106f, 0.0588079f, 5.8100000f, 20},
-{0.8921517f, -0.3869855f, -0.2330399f, 4.9700000f, 62},
-{0.6318823f, -0.2830738f, 0.7215219f, 5.6500000f, 60},
-{0.9146856f, -0.4013602f, 0.0475423f, 6.5500000f, 27},
-{0.8148516f, -0.3624616f, 0.4523699f, 4.0600000f, 60},
-{0.8519611f, -0.3706790f, -0.3698098f, 4.4500000f, 36},
-{0.7041441f, -0.3033434f, -0.6419999f, 6.2600000f, 18},
-{0.6726254f, -0.2897537f, -0.6808949f, 6.5200000f, 48},
-{0.8465923f, -0.3694712f, -0.3831089f, 5.8300000f, 34},
-{0.8465857f, -0.3695050f, -0.3830910f, 5.8700000f, 36},
-{0.7452991f, -0.3234854f, -0.5829978f, 5.5400000f, 13},
-{0.8243118f, -0.3604757f, -0.4365401f, 6.6500000f, 20},
-{0.7728119f, -0.3368839f, -0.5378392f, 6.1100000f, 29},
-{0.5998184f, -0.2730317f, 0.7521115f, 5.9200000f, 25},
-{0.6977839f, -0.3154159f, 0.6431255f, 6.3800000f, 61},
-{0.8162888f, -0.3573986f, -0.4538047f, 5.7700000f, 51},
-{0.7217585f, -0.3137359f, -0.6169558f, 6.7600000f, 52},
-{0.9077450f, -0.4069019f, 0.1021270f, 5.9100000f, 40},
-{0.1791455f, -0.0702364f, -0.9813123f, 5.5300000f, 52},
-{0.9048453f, -0.4041726f, -0.1337892f, 6.2700000f, 52},
-{0.8881650f, -0.3957384f, -0.2335679f, 5.7000000f, 12},
-{0.8103333f, -0.3581601f, -0.4637686f, 4.6400000f, 18},
-{0.8477660f, -0.3780261f, -0.3720070f, 6.3400000f, 45},
-{0.7441416f, -0.3412708f, 0.5742712f, 5.5600000f, 50},
-{0.5822791f, -0.2551735f, -0.7719051f, 6.2800000f, 21},
-{0.8285485f, -0.3786469f, 0.4124730f, 6.2700000f, 30},
-{0.9091643f, -0.4108776f, -0.0678218f, 5.1300000f, 36},
-{0.8661992f, -0.3887555f, -0.3139556f, 5.7400000f, 12},
-{0.4916820f, -0.2314335f, 0.8394566f, 6.0600000f, 55},
-{0.7474198f, -0.3452179f, 0.5676163f, 4.9000000f, 33},
-{0.8278587f, -0.3825171f, 0.4102812f, 6.1700000f, 22},
-{0.8852177f, -0.4017777f, -0.2344446f, 6.5300000f, 19},
-{0.8435581f, -0.3812356f, -0.3782447f, 6.3700000f, 30},
-{0.5694916f, -0.2525473f, -0.7822398f, 4.9400000f, 53},
-{0.7104607f, -0.3322121f, 0.6203876f, 5.7300000f, 60},
-{0.7686648f, -0.3580328f, 0.5300632f, 6.1700000f, 36},
-{0.7638414f, -0.3455633f, -0.5450984f, 4.5300000f, 18},
-{0.8644432f, -0.4006959f, 0.3036127f, 5.0500000f, 55},
-{0.6033955f, -0.2852452f, 0.7446805f, 5.5600000f, 50},
-{0.6201687f, -0.2784926f, -0.7333707f, 5.7200000f, 19},
-{0.5354869f, -0.2384934f, -0.8101695f, 6.3900000f, 51},
-{0.7482895f, -0.3400168f, -0.5696063f, 6.6000000f, 51},
-{0.9038201f, -0.4181101f, 0.0910671f, 0.3800000f, 35},
-{0.8266421f, -0.3780301f, -0.4168405f, 4.7000000f, 18},
-{0.7175138f, -0.3260577f, -0.6155163f, 6.3800000f, 54},
-{0.4677853f, -0.2256496f, 0.8545520f, 4.9900000f, 23},
-{0.8667548f, -0.4001222f, -0.2977220f, 6.7200000f, 16},
-{0.8220183f, -0.3781803f, -0.4257530f, 4.5000000f, 16},
-{0.8220177f, -0.3782163f, -0.4257223f, 4.6200000f, 15},
-{0.9023191f, -0.4213176f, 0.0911685f, 6.0200000f, 20},
-{0.8324833f, -0.3925136f, 0.3910301f, 5.8900000f, 55},
-{0.7163989f, -0.3280056f, -0.6157799f, 6.5900000f, 20},
-{0.8788394f, -0.4134958f, 0.2380391f, 6.2400000f, 50},
-{0.7397039f, -0.3399586f, -0.5807464f, 5.8000000f, 12},
-{0.7238450f, -0.3319499f, -0.6048617f, 6.1900000f, 48},
-{0.8213946f, -0.3806182f, -0.4247832f, 6.5000000f, 17},
-{0.6155718f, -0.2815168f, -0.7360840f, 5.6800000f, 34},
-{0.8968081f, -0.4210106f, -0.1359605f, 6.0100000f, 23},
-{0.8758052f, -0.4101950f, -0.2543722f, 4.9400000f, 53},
-{0.8598798f, -0.4020044f, -0.3146414f, 5.9300000f, 50},
-{0.7179635f, -0.3327219f, -0.6114120f, 4.8400000f, 12},
-{0.7471419f, -0.3592740f, 0.5591969f, 6.0200000f, 37},
-{0.7159287f, -0.3328168f, -0.6137418f, 5.7300000f, 15},
-{0.7170092f, -0.3335728f, -0.6120678f, 5.7600000f, 12},
-{0.8779677f, -0.4181266f, 0.2331154f, 5.7700000f, 62},
-{0.9015531f, -0.4280246f, 0.0632211f, 5.9400000f, 20},
-{0.8748778f, -0.4175452f, 0.2454484f, 5.5600000f, 63},
-{0.7293380f, -0.3399667f, -0.5937076f, 6.0000000f, 16},
-{0.5724179f, -0.2794033f, 0.7708901f, 5.2700000f, 20},
-{0.8941847f, -0.4229020f, -0.1469271f, 3.9300000f, 50},
-{0.5499806f, -0.2535639f, -0.7957554f, 6.0600000f, 19},
-{0.8130057f, -0.3822393f, -0.4392207f, 6.7600000f, 13},
-{0.7881358f, -0.3814736f, 0.4830319f, 4.2800000f, 51},
-{0.7807858f, -0.3677359f, -0.5051177f, 6.5600000f, 42},
-{0.3712088f, -0.1864314f, 0.9096413f, 5.9200000f, 52},
-{0.8398942f, -0.3978833f, -0.3691431f, 6.1800000f, 61},
-{0.4082413f, -0.2045583f, 0.8896600f, 6.4900000f, 30},
-{0.8320908f, -0.4030101f, 0.3810614f, 6.2100000f, 50},
-{0.2563442f, -0.1132773f, -0.9599249f, 7.1600000f, 19},
-{0.2563434f, -0.1132792f, -0.9599249f, 7.2600000f, 19},
-{0.7174859f, -0.3393966f, -0.6082959f, 5.4200000f, 15},
-{0.9005226f, -0.4347966f, 0.0033064f, 6.1900000f, 50},
-{0.8091111f, -0.3951325f, 0.4349823f, 5.3100000f, 54},
-{0.6570111f, -0.3111408f, -0.6866788f, 6.4100000f, 17},
-{0.8177500f, -0.4008181f, 0.4130735f, 3.5700000f, 48},
-{0.7163957f, -0.3415753f, -0.6083613f, 6.5400000f, 17},
-{0.8758158f, -0.4282682f, 0.2225601f, 6.4300000f, 50},
-{0.8122852f, -0.3909337f, -0.4328551f, 5.6400000f, 51},
-{0.8977665f, -0.4384682f, 0.0419628f, 6.4700000f, 30},
-{0.7911623f, -0.3915108f, 0.4698739f, 1.1400000f, 50},
-{0.8407973f, -0.4153425f, 0.3472039f, 6.3300000f, 21},
-{0.8184984f, -0.3976695f, -0.4146315f, 6.5500000f, 23},
-{0.7973735f, -0.3869258f, -0.4631242f, 4.5900000f, 53},
-{0.7288373f, -0.3523337f, -0.5870751f, 5.6000000f, 15},
-{0.7178661f, -0.3467081f, -0.6037067f, 6.8900000f, 46},
-{0.8008349f, -0.3897646f, -0.4546945f, 3.9600000f, 22},
-{0.1477791f, -0.0821585f, 0.9856020f, 6.5600000f, 48},
-{0.6388764f, -0.3079970f, -0.7049644f, 5.0600000f, 46},
-{0.7088184f, -0.3559368f, 0.6090037f, 5.1800000f, 62},
-{0.2153132f, -0.0959424f, -0.9718206f, 6.1800000f, 60},
-{0.7106355f, -0.3455068f, -0.6128802f, 6.4000000f, 19},
-{0.6982884f, -0.3394410f, -0.6302167f, 5.1700000f, 51},
-{0.8484100f, -0.4235719f, 0.3174702f, 4.8800000f, 54},
-{0.8243342f, -0.4045808f, -0.3959640f, 5.6200000f, 11},
-{0.6024545f, -0.2909623f, -0.7432292f, 6.5700000f, 22},
-{0.4865234f, -0.2325029f, -0.8421623f, 6.4300000f, 12},
-{0.7274701f, -0.3554398f, -0.5868985f, 5.8000000f, 32},
-{0.8786581f, -0.4393760f, 0.1868384f, 5.3000000f, 21},
-{0.8718674f, -0.4322220f, -0.2302856f, 6.8900000f, 28},
-{0.8718718f, -0.4322558f, -0.2302054f, 6.0700000f, 22},
-{0.7257306f, -0.3561995f, -0.5885890f, 5.8800000f, 17},
-{0.4804726f, -0.2314640f, -0.8459140f, 6.2100000f, 50},
-{0.7445384f, -0.3773379f, 0.5507074f, 5.1400000f, 61},
-{0.8911410f, -0.4444846f, -0.0911106f, 5.4900000f, 55},
-{0.8705375f, -0.4337890f, -0.2323610f, 5.0400000f, 30},
-{0.7244318f, -0.3575515f, -0.5893687f, 6.5400000f, 13},
-{0.7248980f, -0.3584834f, -0.5882284f, 3.6100000f, 52},
-{0.7441150f, -0.3693145f, -0.5566863f, 5.3700000f, 40},
-{0.8760768f, -0.4403733f, -0.1963692f, 6.3900000f, 20},
-{0.6634733f, -0.3282752f, -0.6723381f, 6.0300000f, 16},
-{0.8182934f, -0.4194630f, 0.3929970f, 6.1800000f, 42},
-{0.7231367f, -0.3612258f, -0.5887184f, 5.8800000f, 17},
-{0.8305748f, -0.4195914f, -0.3661809f, 5.9000000f, 12},
-{0.2880870f, -0.1371328f, -0.9477344f, 3.9500000f, 50},
-{0.6853258f, -0.3437717f, -0.6419888f, 6.5700000f, 12},
-{0.8651930f, -0.4391353f, -0.2420771f, 6.3400000f, 51},
-{0.8570216f, -0.4355131f, -0.2753950f, 6.4300000f, 62},
-{0.5184542f, -0.2730464f, 0.8103400f, 6.0200000f, 36},
-{0.8722618f, -0.4441759f, -0.2046147f, 5.4800000f, 35},
-{0.8648544f, -0.4455885f, 0.2312527f, 6.0400000f, 50},
-{0.5102069f, -0.2532504f, -0.8219204f, 6.1200000f, 30},
-{0.6970654f, -0.3517187f, -0.6248150f, 6.3100000f, 18},
-{0.8865129f, -0.4564944f, 0.0755492f, 6.5300000f, 42},
-{0.8134206f, -0.4148460f, -0.4077374f, 4.5000000f, 10},
-{0.7079028f, -0.3584278f, -0.6086076f, 5.0800000f, 12},
-{0.3660305f, -0.1799738f, -0.9130340f, 6.3800000f, 46},
-{0.6263777f, -0.3175219f, -0.7119205f, 5.2300000f, 11},
-{0.3339405f, -0.1632647f, -0.9283471f, 6.1800000f, 20},
-{0.5030759f, -0.2692102f, 0.8212433f, 6.3800000f, 20},
-{0.7401765f, -0.3895838f, 0.5480540f, 6.0300000f, 22},
-{0.6888087f, -0.3515020f, -0.6340259f, 6.1400000f, 62},
-{0.8665174f, -0.4485685f, -0.2189380f, 6.2300000f, 18},
-{0.8177594f, -0.4213017f, -0.3921409f, 5.3300000f, 40},
-{0.8498831f, -0.4409454f, -0.2885584f, 5.1800000f, 53},
-{0.8169491f, -0.4220878f, -0.3929836f, 3.3400000f, 46},
-{0.6080906f, -0.3109692f, -0.7304272f, 4.7100000f, 50},
-{0.8761778f, -0.4569681f, -0.1532733f, 5.6100000f, 53},
-{0.8350750f, -0.4335708f, -0.3386239f, 6.5600000f, 43},
-{0.7299967f, -0.3769609f, -0.5700924f, 5.9300000f, 19},
-{0.8839659f, -0.4640433f, 0.0571671f, 6.1800000f, 51},
-{0.8411077f, -0.4382962f, -0.3169138f, 6.1200000f, 50},
-{0.7470301f, -0.3871823f, -0.5404035f, 5.6000000f, 55},
-{0.8333042f, -0.4428192f, 0.3309307f, 5.9900000f, 51},
-{0.8692643f, -0.4569547f, -0.1886051f, 6.1600000f, 50},
-{0.6213837f, -0.3208517f, -0.7147982f, 4.1100000f, 10},
-{0.5039421f, -0.2576583f, -0.8244117f, 6.3300000f, 50},
-{0.6468696f, -0.3348400f, -0.6851583f, 6.3200000f, 50},
-{0.6267644f, -0.3235492f, -0.7088598f, 5.8400000f, 11},
-{0.8831413f, -0.4680927f, 0.0308341f, 5.1400000f, 18},
-{0.8117612f, -0.4270882f, -0.3982955f, 6.4500000f, 20},
-{0.8812581f, -0.4691653f, 0.0571671f, 6.3100000f, 64},
-{0.5022743f, -0.2589980f, -0.8250094f, 5.5900000f, 45},
-{0.8668290f, -0.4593579f, -0.1939014f, 6.3600000f, 32},
-{0.8637820f, -0.4581777f, -0.2096517f, 5.1700000f, 40},
-{0.5943173f, -0.3243295f, 0.7359330f, 6.2500000f, 52},
-{0.5919853f, -0.3238060f, 0.7380400f, 5.4500000f, 54},
-{0.7855896f, -0.4243091f, 0.4503452f, 4.9700000f, 23},
-{0.8258041f, -0.4377715f, -0.3555329f, 5.6300000f, 48},
-{0.6432267f, -0.3373675f, -0.6873446f, 6.4500000f, 46},
-{0.4480973f, -0.2313174f, -0.8635398f, 5.7800000f, 31},
-{0.5756597f, -0.3009423f, -0.7602958f, 5.9100000f, 52},
-{0.8785026f, -0.4710407f, -0.0797108f, 5.7600000f, 35},
-{0.8591530f, -0.4583355f, -0.2275625f, 5.6900000f, 31},
-{0.6477355f, -0.3420240f, -0.6807777f, 6.3200000f, 12},
-{0.2397814f, -0.1387100f, 0.9608665f, 5.4100000f, 53},
-{0.4442779f, -0.2310629f, -0.8655790f, 6.7200000f, 50},
-{0.4821560f, -0.2684932f, 0.8339286f, 6.7200000f, 22},
-{0.6657448f, -0.3527603f, -0.6575287f, 6.0400000f, 12},
-{0.7375702f, -0.3932539f, -0.5489458f, 5.0100000f, 35},
-{0.6817037f, -0.3632954f, -0.6350564f, 3.7300000f, 51},
-{0.3638085f, -0.1887483f, -0.9121499f, 5.7900000f, 19},
-{0.1561816f, -0.0945730f, 0.9831904f, 5.4200000f, 20},
-{0.7133648f, -0.3941235f, 0.5794629f, 6.2300000f, 23},
-{0.7028252f, -0.3762398f, -0.6037221f, 4.4900000f, 12},
-{0.7158317f, -0.3848651f, -0.5826353f, 5.4300000f, 50},
-{0.8231437f, -0.4547044f, 0.3401151f, 5.3500000f, 20},
-{0.8651713f, -0.4772227f, 0.1540685f, 5.8600000f, 32},
-{0.5229487f, -0.2795072f, -0.8052331f, 5.7000000f, 11},
-{0.5849119f, -0.3144874f, -0.7476468f, 4.6300000f, 11},
-{0.5901869f, -0.3181262f, -0.7419401f, 4.2400000f, 10},
-{0.7272038f, -0.3955930f, -0.5609641f, 5.4900000f, 12},
-{0.7345946f, -0.4016166f, -0.5468774f, 6.1500000f, 54},
-{0.8710991f, -0.4848393f, 0.0782126f, 6.1700000f, 48},
-{0.6258906f, -0.3551100f, 0.6943758f, 6.3400000f, 50},
-{0.8395922f, -0.4701461f, 0.2721170f, 5.7800000f, 53},
-{0.7657705f, -0.4211092f, -0.4860685f, 6.4400000f, 54},
-{0.8620324f, -0.4840715f, 0.1502496f, 6.0500000f, 50},
-{0.8717511f, -0.4895541f, 0.0196676f, 6.3500000f, 37},
-{0.7589117f, -0.4223181f, -0.4956818f, 6.3300000f, 66},
-{0.5467584f, -0.2999878f, -0.7817049f, 6.3800000f, 18},
-{0.6487361f, -0.3587681f, -0.6711386f, 6.0200000f, 16},
-{0.8141701f, -0.4552963f, -0.3603224f, 4.2000000f, 37},
-{0.8632606f, -0.4888901f, 0.1255689f, 6.4100000f, 20},
-{0.8333502f, -0.4740102f, 0.2843268f, 5.9900000f, 50},
-{0.4815126f, -0.2638572f, -0.8357781f, 5.6300000f, 53},
-{0.4439036f, -0.2597732f, 0.8575940f, 5.7700000f, 32},
-{0.6765032f, -0.3765562f, -0.6328893f, 6.7800000f, 12},
-{0.0855994f, -0.0582261f, 0.9946268f, 6.4900000f, 23},
-{0.4269035f, -0.2507300f, 0.8688428f, 6.0100000f, 22},
-{0.8689616f, -0.4933547f, 0.0388190f, 5.2900000f, 50},
-{0.6525684f, -0.3653250f, -0.6638464f, 6.0900000f, 53},
-{0.3894458f, -0.2305776f, 0.8917207f, 6.4000000f, 41},
-{0.7568980f, -0.4267875f, -0.4949322f, 4.7900000f, 22},
-{0.6433294f, -0.3601527f, -0.6755866f, 5.3500000f, 12},
-{0.8438780f, -0.4851779f, 0.2290683f, 6.0200000f, 52},
-{0.6283089f, -0.3529751f, -0.6932796f, 5.0900000f, 12},
-{0.5491662f, -0.3068505f, -0.7773412f, 3.4700000f, 13},
-{0.6043903f, -0.3396305f, -0.7206688f, 6.2200000f, 15},
-{0.4651048f, -0.2756012f, 0.8412619f, 6.4900000f, 38},
-{0.4439166f, -0.2468525f, -0.8613953f, 5.7400000f, 53},
-{0.6218187f, -0.3513188f, -0.6999404f, 5.1700000f, 52},
-{0.8658925f, -0.4985892f, -0.0404854f, 4.9300000f, 52},
-{0.8008183f, -0.4581459f, -0.3857361f, 5.1100000f, 52},
-{0.7805155f, -0.4548713f, 0.4288213f, 5.8300000f, 48},
-{0.8130972f, -0.4732339f, 0.3390025f, 6.2500000f, 51},
-{0.4511880f, -0.2522767f, -0.8560291f, 6.2500000f, 60},
-{0.7916654f, -0.4617396f, 0.4000780f, 6.3400000f, 51},
-{0.8251615f, -0.4801992f, 0.2975184f, 5.5500000f, 53},
-{0.5734680f, -0.3252458f, -0.7518973f, 4.4100000f, 11},
-{0.7023715f, -0.4133914f, 0.5794669f, 6.3400000f, 50},
-{0.8257607f, -0.4761128f, -0.3023838f, 4.6100000f, 22},
-{0.7808710f, -0.4587299f, 0.4240370f, 6.3100000f, 21},
-{0.5525241f, -0.3137392f, -0.7721948f, 6.4400000f, 28},
-{0.8273872f, -0.4849643f, 0.2832669f, 5.9900000f, 19},
-{0.8642528f, -0.5026790f, -0.0195174f, 6.5100000f, 12},
-{0.8602003f, -0.5028115f, 0.0850643f, 5.6500000f, 21},
-{0.6161744f, -0.3522797f, -0.7044347f, 5.9900000f, 14},
-{0.4393987f, -0.2480475f, -0.8633662f, 5.6000000f, 40},
-{0.3999247f, -0.2244464f, -0.8886417f, 6.1400000f, 18},
-{0.6767412f, -0.3886459f, -0.6252805f, 5.2400000f, 35},
-{0.8632993f, -0.5045809f, -0.0106027f, 4.6800000f, 54},
-{0.5803785f, -0.3324027f, -0.7434173f, 6.3200000f, 12},
-{0.5803175f, -0.3324294f, -0.7434529f, 6.3400000f, 12},
-{0.8515616f, -0.5008327f, 0.1549499f, 6.2200000f, 40},
-{0.8603271f, -0.5081123f, 0.0407325f, 4.3900000f, 52},
-{0.6167281f, -0.3572412f, -0.7014450f, 6.6100000f, 51},
-{0.4450487f, -0.2539585f, -0.8587414f, 5.8100000f, 12},
-{0.5900524f, -0.3415199f, -0.7315752f, 6.0200000f, 22},
-{0.7592305f, -0.4540227f, 0.4662966f, 4.9400000f, 51},
-{0.8564678f, -0.5066818f, -0.0986733f, 6.3300000f, 40},
-{0.5884885f, -0.3414151f, -0.7328827f, 6.1200000f, 20},
-{0.4360878f, -0.2509389f, -0.8642089f, 6.3300000f, 15},
-{0.4410868f, -0.2537045f, -0.8608580f, 5.1700000f, 61},
-{0.6913537f, -0.4057094f, -0.5978545f, 5.9500000f, 23},
-{0.6884020f, -0.4059179f, -0.6011101f, 6.3400000f, 61},
-{0.5098127f, -0.2968124f, -0.8074611f, 5.8700000f, 15},
-{0.5135109f, -0.3006178f, -0.8037011f, 6.1000000f, 12},
-{0.8096264f, -0.4901019f, 0.3229632f, 6.1500000f, 19},
-{0.4004538f, -0.2319793f, -0.8864662f, 4.8200000f, 13},
-{0.7323513f, -0.4359989f, -0.5230358f, 5.8200000f, 52},
-{0.5004086f, -0.2933679f, -0.8145714f, 6.2800000f, 14},
-{0.6520715f, -0.3869665f, -0.6519661f, 5.5200000f, 19},
-{0.8324371f, -0.5055080f, 0.2269582f, 5.1200000f, 21},
-{0.7568706f, -0.4620714f, 0.4622087f, 6.2100000f, 20},
-{0.6573737f, -0.3933716f, -0.6427430f, 2.2500000f, 5},
-{0.6472676f, -0.3869663f, -0.6567357f, 6.2900000f, 48},
-{0.6189913f, -0.3836600f, 0.6853136f, 6.2600000f, 21},
-{0.8124685f, -0.4915236f, -0.3135275f, 6.1300000f, 13},
-{0.7863166f, -0.4833039f, 0.3848682f, 5.9900000f, 63},
-{0.7317010f, -0.4408244f, -0.5198919f, 5.3100000f, 61},
-{0.2572083f, -0.1474064f, -0.9550473f, 6.3400000f, 23},
-{0.8529923f, -0.5218274f, 0.0100112f, 6.4100000f, 50},
-{0.5271869f, -0.3308854f, 0.7826806f, 4.8400000f, 22},
-{0.8416710f, -0.5180948f, -0.1522096f, 6.2300000f, 19},
-{0.4437505f, -0.2828727f, 0.8503344f, 5.9300000f, 54},
-{0.7891035f, -0.4919543f, 0.3678270f, 5.3000000f, 41},
-{0.7201458f, -0.4402189f, -0.5362811f, 6.1400000f, 41},
-{0.5566792f, -0.3368271f, -0.7593786f, 5.9500000f, 45},
-{0.6037465f, -0.3675890f, -0.7073673f, 6.1900000f, 13},
-{0.5156945f, -0.3131364f, -0.7974991f, 5.5300000f, 53},
-{0.6235655f, -0.3949066f, 0.6746961f, 6.2700000f, 53},
-{0.3070145f, -0.2009301f, 0.9302522f, 5.3200000f, 47},
-{0.8011978f, -0.4972478f, -0.3329064f, 5.3800000f, 25},
-{0.8225356f, -0.5175106f, 0.2358347f, 6.2700000f, 33},
-{0.7775161f, -0.4836944f, -0.4018812f, 2.8100000f, 36},
-{0.4126398f, -0.2496944f, -0.8760029f, 6.3000000f, 12},
-{0.6046111f, -0.3729540f, -0.7038116f, 5.0500000f, 53},
-{0.8465402f, -0.5320293f, -0.0177336f, 4.3400000f, 42},
-{0.8312498f, -0.5242176f, -0.1849853f, 6.3200000f, 20},
-{0.7971436f, -0.5016239f, -0.3360589f, 6.3600000f, 27},
-{0.7602262f, -0.4864343f, 0.4306249f, 5.7300000f, 47},
-{0.8007626f, -0.5053739f, -0.3215221f, 4.4000000f, 15},
-{0.6554205f, -0.4230376f, 0.6256701f, 6.5800000f, 40},
-{0.8129045f, -0.5152632f, -0.2714591f, 5.6800000f, 12},
-{0.6821328f, -0.4288418f, -0.5922749f, 6.3700000f, 14},
-{0.7345644f, -0.4639761f, -0.4951175f, 6.6500000f, 55},
-{0.1063806f, -0.0776796f, 0.9912866f, 6.3200000f, 22},
-{0.8138178f, -0.5233648f, 0.2525666f, 6.2300000f, 21},
-{0.6962838f, -0.4400448f, -0.5670533f, 6.2000000f, 48},
-{0.4610494f, -0.3046896f, 0.8334253f, 5.8500000f, 49},
-{0.8280696f, -0.5340466f, 0.1705726f, 6.0700000f, 16},
-{0.8228182f, -0.5275472f, -0.2113390f, 5.5400000f, 36},
-{0.5731170f, -0.3621696f, -0.7350987f, 5.7000000f, 18},
-{0.6086169f, -0.3862338f, -0.6931153f, 5.2100000f, 12},
-{0.6333924f, -0.4027194f, -0.6607808f, 6.2600000f, 17},
-{0.5797261f, -0.3675093f, -0.7272239f, 4.2700000f, 11},
-{0.5795557f, -0.3675608f, -0.7273337f, 1.7800000f, 30},
-{0.7987215f, -0.5197452f, 0.3031646f, 5.6300000f, 38},
-{0.7987215f, -0.5197452f, 0.3031646f, 6.0200000f, 39},
-{0.7986989f, -0.5197801f, 0.3031646f, 6.2000000f, 45},
-{0.8247516f, -0.5318812f, -0.1920605f, 4.7200000f, 49},
-{0.8347831f, -0.5397871f, -0.1084765f, 5.3600000f, 46},
-{0.5856618f, -0.3721026f, -0.7200971f, 5.2300000f, 11},
-{0.8128943f, -0.5297591f, 0.2419878f, 6.5400000f, 27},
-{0.7264291f, -0.4769404f, 0.4948016f, 5.6400000f, 19},
-{0.2018256f, -0.1407126f, 0.9692607f, 5.5400000f, 48},
-{0.3950919f, -0.2478607f, -0.8845719f, 6.2800000f, 16},
-{0.4732393f, -0.3002109f, -0.8282016f, 5.6600000f, 23},
-{0.6742059f, -0.4337747f, -0.5977340f, 6.4400000f, 9},
-{0.4139032f, -0.2611830f, -0.8720479f, 4.7600000f, 35},
-{0.4099318f, -0.2760906f, 0.8693273f, 6.4500000f, 27},
-{0.8017966f, -0.5256642f, 0.2842524f, 6.0100000f, 48},
-{0.3261985f, -0.2036929f, -0.9230947f, 4.3500000f, 16},
-{0.7674850f, -0.5065197f, 0.3929435f, 6.5600000f, 24},
-{0.6586226f, -0.4250976f, -0.6208932f, 4.4500000f, 53},
-{0.6338472f, -0.4093940f, -0.6562273f, 4.7500000f, 25},
-{0.5674908f, -0.3656703f, -0.7377259f, 5.8200000f, 13},
-{0.7940930f, -0.5265210f, 0.3036312f, 6.4700000f, 20},
-{0.8099180f, -0.5326915f, -0.2455048f, 4.9900000f, 45},
-{0.7382770f, -0.4829616f, -0.4708451f, 6.5200000f, 21},
-{0.8115328f, -0.5389259f, 0.2257729f, 6.3800000f, 48},
-{0.5893352f, -0.3827188f, -0.7114846f, 5.7600000f, 37},
-{0.6761947f, -0.4427353f, -0.5888516f, 6.4300000f, 23},
-{0.5845091f, -0.3814548f, -0.7161294f, 6.0300000f, 15},
-{0.4175942f, -0.2865755f, 0.8622584f, 5.6400000f, 27},
-{0.2470794f, -0.1740882f, 0.9532288f, 5.9800000f, 60},
-{0.6915142f, -0.4555080f, -0.5606430f, 4.7800000f, 11},
-{0.7044722f, -0.4648888f, -0.5362811f, 6.3700000f, 52},
-{0.7078841f, -0.4693530f, -0.5278332f, 6.0600000f, 11},
-{0.6774281f, -0.4482666f, -0.5832223f, 5.0800000f, 11},
-{0.6775730f, -0.4483908f, -0.5829584f, 6.1100000f, 12},
-{0.6867124f, -0.4554736f, -0.5665421f, 5.7800000f, 51},
-{0.6419483f, -0.4250910f, -0.6381223f, 4.4400000f, 51},
-{0.5902379f, -0.3892025f, -0.7072062f, 5.1300000f, 12},
-{0.3789711f, -0.2636085f, 0.8870690f, 5.7100000f, 48},
-{0.4823550f, -0.3323301f, 0.8104877f, 6.2700000f, 55},
-{0.5388648f, -0.3552090f, -0.7638398f, 5.5100000f, 61},
-{0.8103827f, -0.5495216f, 0.2032383f, 7.1300000f, 67},
-{0.8171639f, -0.5538598f, 0.1596323f, 3.5200000f, 54},
-{0.5974819f, -0.3969598f, -0.6967340f, 5.8300000f, 12},
-{0.7248382f, -0.4883345f, -0.4859414f, 6.2100000f, 45},
-{0.8154289f, -0.5579614f, 0.1541260f, 6.2900000f, 48},
-{0.6865527f, -0.4630057f, -0.5605988f, 6.1600000f, 52},
-{0.4366102f, -0.3069544f, 0.8456657f, 5.8900000f, 34},
-{0.7735538f, -0.5262167f, -0.3531438f, 6.6000000f, 20},
-{0.5388267f, -0.3613546f, -0.7609787f, 6.4400000f, 53},
-{0.7947813f, -0.5431037f, -0.2708525f, 6.1600000f, 22},
-{0.4856725f, -0.3416055f, 0.8046290f, 6.4900000f, 30},
-{0.8069915f, -0.5566975f, -0.1971108f, 5.9800000f, 47},
-{0.4017249f, -0.2690964f, -0.8753309f, 5.1600000f, 22},
-{0.7137988f, -0.4904504f, -0.4999496f, 6.4500000f, 50},
-{0.7283063f, -0.5102735f, 0.4573739f, 5.1400000f, 36},
-{0.3983518f, -0.2860735f, 0.8714802f, 6.4100000f, 50},
-{0.7652091f, -0.5375486f, 0.3542548f, 5.8300000f, 51},
-{0.8089566f, -0.5625100f, -0.1707971f, 6.3200000f, 33},
-{0.6781991f, -0.4673780f, -0.5671012f, 5.5800000f, 52},
-{0.6609845f, -0.4551744f, -0.5965868f, 6.7000000f, 20},
-{0.7469783f, -0.5256428f, 0.4070909f, 5.9800000f, 19},
-{0.8176284f, -0.5716151f, 0.0688472f, 6.0500000f, 48},
-{0.6711423f, -0.4636603f, -0.5784352f, 4.4500000f, 27},
-{0.8185021f, -0.5742842f, 0.0158721f, 6.1800000f, 39},
-{0.8157201f, -0.5726864f, -0.0814312f, 6.1300000f, 52},
-{0.6848546f, -0.4772727f, -0.5506224f, 6.4300000f, 19},
-{0.4266024f, -0.2930039f, -0.8556630f, 6.4200000f, 35},
-{0.5920343f, -0.4255569f, 0.6843951f, 4.2500000f, 54},
-{0.7632900f, -0.5367312f, -0.3595942f, 6.1300000f, 50},
-{0.4846914f, -0.3515300f, 0.8009375f, 5.5100000f, 23},
-{0.8157732f, -0.5783303f, -0.0069425f, 6.5000000f, 22},
-{0.7669398f, -0.5437943f, -0.3407214f, 5.5800000f, 42},
-{0.3559293f, -0.2453444f, -0.9017320f, 5.0700000f, 51},
-{0.7811565f, -0.5567308f, -0.2825693f, 5.7500000f, 51},
-{0.6845045f, -0.4854787f, -0.5438419f, 4.8300000f, 52},
-{0.6639936f, -0.4707864f, -0.5809240f, 5.2000000f, 12},
-{0.7695054f, -0.5558189f, 0.3145263f, 5.9500000f, 29},
-{0.8086471f, -0.5794861f, -0.1014180f, 6.1500000f, 28},
-{0.6393838f, -0.4535612f, -0.6208628f, 6.1600000f, 23},
-{0.5998072f, -0.4386443f, 0.6691955f, 6.0200000f, 55},
-{0.8066796f, -0.5801920f, -0.1124517f, 5.9600000f, 61},
-{0.7914936f, -0.5686411f, -0.2240203f, 6.1100000f, 47},
-{0.7953299f, -0.5774169f, 0.1844993f, 6.0800000f, 62},
-{0.7319722f, -0.5261288f, -0.4329032f, 5.9000000f, 33},
-{0.6603362f, -0.4845404f, 0.5737393f, 6.0600000f, 50},
-{0.4560601f, -0.3229086f, -0.8293005f, 5.9700000f, 11},
-{0.5490038f, -0.3935072f, -0.7373920f, 4.8200000f, 11},
-{0.8061330f, -0.5889565f, -0.0572688f, 6.0100000f, 32},
-{0.6414351f, -0.4629864f, -0.6117227f, 6.3200000f, 61},
-{0.8068963f, -0.5893882f, -0.0392404f, 5.6100000f, 33},
-{0.3592086f, -0.2541652f, -0.8979806f, 6.1200000f, 46},
-{0.7689602f, -0.5681271f, 0.2931412f, 6.1400000f, 36},
-{0.5011624f, -0.3605198f, -0.7866777f, 5.8500000f, 20},
-{0.2737939f, -0.1913863f, -0.9425541f, 5.3700000f, 19},
-{0.2734999f, -0.1915275f, -0.9426107f, 5.6500000f, 20},
-{0.3064274f, -0.2346418f, 0.9225213f, 5.8800000f, 48},
-{0.7094026f, -0.5271451f, 0.4678313f, 5.5700000f, 55},
-{0.8043736f, -0.5929903f, 0.0366825f, 5.7300000f, 55},
-{0.7970842f, -0.5893449f, 0.1316413f, 5.1300000f, 47},
-{0.4248111f, -0.3044527f, -0.8525515f, 1.8600000f, 53},
-{0.7433724f, -0.5446560f, -0.3882618f, 5.6800000f, 22},
-{0.5589563f, -0.4197271f, 0.7151203f, 6.3200000f, 45},
-{0.7148498f, -0.5327356f, 0.4529707f, 6.3200000f, 26},
-{0.7148368f, -0.5327421f, 0.4529837f, 6.3000000f, 23},
-{0.7297105f, -0.5432328f, 0.4152358f, 7.0200000f, 30},
-{0.7296921f, -0.5432439f, 0.4152534f, 7.8100000f, 37},
-{0.8042012f, -0.5932333f, -0.0365323f, 3.9000000f, 20},
-{0.7368421f, -0.5405799f, -0.4060013f, 5.2800000f, 55},
-{0.7523441f, -0.5532500f, -0.3576210f, 6.0100000f, 33},
-{0.7713654f, -0.5689940f, -0.2850286f, 6.4400000f, 50},
-{0.2118483f, -0.1463172f, -0.9662875f, 4.0700000f, 35},
-{0.7824736f, -0.5828750f, 0.2190705f, 5.5000000f, 63},
-{0.7832170f, -0.5791624f, -0.2261460f, 5.9800000f, 25},
-{0.8021836f, -0.5960438f, -0.0351175f, 5.5900000f, 25},
-{0.6065881f, -0.4445789f, -0.6590906f, 5.9800000f, 13},
-{0.3876906f, -0.2981983f, 0.8722234f, 3.3600000f, 45},
-{0.7860355f, -0.5853505f, -0.1987788f, 5.5400000f, 52},
-{0.7966975f, -0.5964759f, -0.0974140f, 6.5900000f, 34},
-{0.5990803f, -0.4427502f, -0.6671394f, 5.4700000f, 13},
-{0.6246460f, -0.4634521f, -0.6285138f, 6.5300000f, 19},
-{0.6246331f, -0.4634848f, -0.6285024f, 7.2500000f, 22},
-{0.7272948f, -0.5511137f, 0.4090428f, 6.1000000f, 30},
-{0.5145813f, -0.3790933f, -0.7690867f, 5.1700000f, 12},
-{0.7025977f, -0.5239227f, -0.4815200f, 6.7300000f, 19},
-{0.2774382f, -0.2184988f, 0.9355674f, 6.3100000f, 50},
-{0.7726111f, -0.5854967f, 0.2454907f, 5.9500000f, 25},
-{0.2433982f, -0.1737318f, -0.9542403f, 5.2900000f, 20},
-{0.7555159f, -0.5670254f, -0.3281432f, 6.5600000f, 22},
-{0.6909924f, -0.5172733f, -0.5049336f, 6.3300000f, 48},
-{0.7970888f, -0.6033075f, -0.0258765f, 6.3900000f, 25},
-{0.7915099f, -0.5982253f, -0.1250543f, 6.4300000f, 50},
-{0.7188724f, -0.5411767f, -0.4362915f, 6.6200000f, 22},
-{0.1906358f, -0.1342816f, -0.9724333f, 4.3500000f, 52},
-{0.5030978f, -0.3737015f, -0.7792559f, 6.0500000f, 20},
-{0.7881574f, -0.5985061f, -0.1435214f, 6.0000000f, 32},
-{0.6551383f, -0.4936298f, -0.5719470f, 5.7500000f, 13},
-{0.7340881f, -0.5561857f, -0.3895794f, 6.5100000f, 22},
-{0.7526882f, -0.5717788f, -0.3263886f, 6.6700000f, 18},
-{0.3601073f, -0.2661251f, -0.8941477f, 5.9700000f, 48},
-{0.3289916f, -0.2428565f, -0.9125707f, 3.7700000f, 51},
-{0.6285524f, -0.4881339f, 0.6055139f, 6.1800000f, 20},
-{0.4590290f, -0.3442000f, -0.8190352f, 6.5300000f, 20},
-{0.4822362f, -0.3621006f, -0.7977038f, 5.0900000f, 29},
-{0.4720740f, -0.3706802f, 0.7998389f, 6.2400000f, 50},
-{0.2041704f, -0.1665347f, 0.9646661f, 6.3100000f, 22},
-{0.7102411f, -0.5423332f, -0.4488122f, 6.7000000f, 14},
-{0.3282585f, -0.2625225f, 0.9073744f, 5.4700000f, 22},
-{0.7206334f, -0.5605350f, 0.4080295f, 5.7500000f, 30},
-{0.5739018f, -0.4369059f, -0.6926399f, 5.7900000f, 12},
-{0.7500733f, -0.5838899f, 0.3105843f, 5.3500000f, 55},
-{0.5520976f, -0.4201227f, -0.7201980f, 5.3300000f, 12},
-{0.5786610f, -0.4418599f, -0.6855007f, 4.9900000f, 12},
-{0.6188772f, -0.4875186f, 0.6158869f, 5.9000000f, 52},
-{0.7767164f, -0.6063463f, 0.1704579f, 6.8300000f, 19},
-{0.6728921f, -0.5185553f, -0.5275572f, 5.6500000f, 52},
-{0.5548518f, -0.4248303f, -0.7153032f, 5.9900000f, 15},
-{0.6465831f, -0.4983556f, -0.5775569f, 6.6900000f, 62},
-{0.6310102f, -0.4990724f, 0.5939300f, 6.2400000f, 35},
-{0.7366045f, -0.5791737f, 0.3492445f, 5.3300000f, 53},
-{0.7488612f, -0.5825266f, -0.3160216f, 5.4200000f, 20},
-{0.4578179f, -0.3500440f, -0.8172343f, 6.3600000f, 40},
-{0.7169455f, -0.5652027f, 0.4080870f, 6.3600000f, 49},
-{0.2750183f, -0.2058928f, -0.9391342f, 5.5300000f, 20},
-{0.5764682f, -0.4449563f, -0.6853454f, 6.3000000f, 14},
-{0.7741185f, -0.6084332f, 0.1747844f, 6.4600000f, 21},
-{0.6141852f, -0.4773129f, -0.6284497f, 6.3100000f, 14},
-{0.7598221f, -0.5966069f, -0.2583226f, 6.3800000f, 30},
-{0.5476007f, -0.4246861f, -0.7209544f, 6.3900000f, 12},
-{0.7624080f, -0.6050991f, 0.2293231f, 6.2800000f, 50},
-{0.6281600f, -0.5029362f, 0.5936920f, 5.7800000f, 22},
-{0.7806566f, -0.6194343f, 0.0829242f, 5.8700000f, 45},
-{0.2161339f, -0.1808923f, 0.9594603f, 6.1500000f, 47},
-{0.7735127f, -0.6165022f, 0.1469798f, 6.0300000f, 33},
-{0.7205646f, -0.5684553f, -0.3970456f, 6.1900000f, 28},
-{0.4683623f, -0.3642602f, -0.8049542f, 6.3400000f, 53},
-{0.7821286f, -0.6222818f, -0.0322539f, 5.8100000f, 21},
-{0.6769874f, -0.5330156f, -0.5075258f, 6.3800000f, 50},
-{0.6559284f, -0.5169840f, -0.5499869f, 6.3600000f, 50},
-{0.4764345f, -0.3724993f, -0.7964009f, 5.6900000f, 50},
-{0.7339090f, -0.5907285f, 0.3352871f, 6.5800000f, 40},
-{0.6212466f, -0.4912108f, -0.6105446f, 6.4900000f, 12},
-{0.6245565f, -0.4951875f, -0.6039192f, 5.9600000f, 15},
-{0.5540542f, -0.4387707f, -0.7074632f, 6.2400000f, 53},
-{0.3244433f, -0.2703040f, 0.9064614f, 5.6400000f, 41},
-{0.7778571f, -0.6266155f, 0.0478667f, 6.3300000f, 49},
-{0.1530174f, -0.1115107f, -0.9819119f, 5.6900000f, 48},
-{0.7492132f, -0.6073958f, 0.2641022f, 6.3200000f, 30},
-{0.7723734f, -0.6246191f, 0.1152839f, 5.9900000f, 38},
-{0.7723558f, -0.6246328f, 0.1153272f, 7.2500000f, 45},
-{0.6667593f, -0.5328785f, -0.5210303f, 6.4300000f, 45},
-{0.7743087f, -0.6240635f, -0.1048370f, 5.7200000f, 21},
-{0.6289395f, -0.5024728f, -0.5932589f, 6.3000000f, 55},
-{0.4594339f, -0.3799755f, 0.8028319f, 5.6600000f, 48},
-{0.3848867f, -0.3205902f, 0.8654965f, 6.4800000f, 22},
-{0.7047250f, -0.5680324f, -0.4250905f, 5.9600000f, 21},
-{0.3316081f, -0.2787786f, 0.9012872f, 4.6000000f, 51},
-{0.6138538f, -0.4935953f, -0.6160740f, 6.4700000f, 41},
-{0.4635039f, -0.3854921f, 0.7978471f, 6.4200000f, 50},
-{0.7631593f, -0.6240643f, 0.1677247f, 5.8800000f, 23},
-{0.5217782f, -0.4177491f, -0.7437965f, 5.0100000f, 51},
-{0.4652885f, -0.3879849f, 0.7955969f, 5.9100000f, 51},
-{0.6478483f, -0.5355501f, 0.5417367f, 5.9400000f, 52},
-{0.7687518f, -0.6317783f, 0.0993825f, 4.1600000f, 21},
-{0.7720373f, -0.6333222f, -0.0534930f, 6.1900000f, 50},
-{0.7606382f, -0.6275050f, 0.1663337f, 6.5300000f, 21},
-{0.5097834f, -0.4123298f, -0.7550530f, 5.8000000f, 18},
-{0.4129083f, -0.3323627f, -0.8479633f, 4.8600000f, 50},
-{0.4154958f, -0.3342364f, -0.8459606f, 5.2600000f, 13},
-{0.7673431f, -0.6344537f, -0.0930223f, 6.5100000f, 21},
-{0.2345138f, -0.1843841f, -0.9544662f, 6.1200000f, 48},
-{0.7682121f, -0.6375367f, 0.0582852f, 4.4400000f, 51},
-{0.6537382f, -0.5364852f, -0.5336760f, 6.4800000f, 30},
-{0.6953550f, -0.5725443f, -0.4343667f, 5.2700000f, 20},
-{0.5937951f, -0.4865856f, -0.6408134f, 6.5500000f, 44},
-{0.5317393f, -0.4502236f, 0.7173228f, 5.3700000f, 48},
-{0.6493270f, -0.5463243f, 0.5290597f, 6.1000000f, 35},
-{0.7601933f, -0.6345502f, 0.1394708f, 6.4500000f, 51},
-{0.7309827f, -0.6061824f, -0.3133802f, 6.3300000f, 55},
-{0.5829995f, -0.4790729f, -0.6562017f, 4.1400000f, 26},
-{0.7195295f, -0.6043279f, 0.3421477f, 6.3900000f, 48},
-{0.7203697f, -0.6064375f, 0.3366023f, 6.4400000f, 49},
-{0.7207134f, -0.6071659f, 0.3345471f, 6.3000000f, 28},
-{0.7157909f, -0.5960218f, -0.3638700f, 5.0500000f, 46},
-{0.7505312f, -0.6299100f, -0.1997907f, 4.9800000f, 54},
-{0.3732835f, -0.3058374f, -0.8758555f, 5.4700000f, 50},
-{0.6743212f, -0.5643619f, -0.4762212f, 4.8900000f, 44},
-{0.6259198f, -0.5222760f, -0.5791824f, 6.1300000f, 31},
-{0.4640936f, -0.3851213f, -0.7976833f, 6.4700000f, 18},
-{0.5176071f, -0.4460119f, 0.7301755f, 6.2200000f, 48},
-{0.7538695f, -0.6383482f, -0.1555390f, 6.6300000f, 21},
-{0.6296239f, -0.5288012f, -0.5691599f, 3.9700000f, 47},
-{0.5883938f, -0.4951299f, -0.6392489f, 5.2000000f, 19},
-{0.4667258f, -0.3895403f, -0.7939933f, 5.4800000f, 15},
-{0.7384009f, -0.6291047f, -0.2428814f, 4.8800000f, 49},
-{0.4616717f, -0.3872513f, -0.7980574f, 5.1900000f, 14},
-{0.3877914f, -0.3231530f, -0.8632439f, 6.3600000f, 20},
-{0.5423091f, -0.4574289f, -0.7047408f, 5.7100000f, 60},
-{0.5371085f, -0.4531960f, -0.7114267f, 3.8400000f, 33},
-{0.7483195f, -0.6400481f, -0.1742306f, 6.4500000f, 25},
-{0.4807586f, -0.4044541f, -0.7780026f, 3.6200000f, 13},
-{0.4606901f, -0.3875594f, -0.7984750f, 5.6100000f, 17},
-{0.7042478f, -0.6083463f, 0.3659915f, 4.6600000f, 21},
-{0.7385165f, -0.6374985f, 0.2195199f, 5.6400000f, 23},
-{0.6030014f, -0.5249592f, 0.6006722f, 6.3300000f, 37},
-{0.5231806f, -0.4437613f, -0.7275699f, 4.7700000f, 25},
-{0.5195982f, -0.4402162f, -0.7322755f, 5.9000000f, 11},
-{0.7555925f, -0.6523538f, 0.0592822f, 4.3000000f, 13},
-{0.4221846f, -0.3565421f, -0.8334494f, 6.3400000f, 23},
-{0.5416340f, -0.4623880f, -0.7020184f, 5.2300000f, 16},
-{0.4023177f, -0.3394335f, -0.8502502f, 4.3300000f, 11},
-{0.7525650f, -0.6541660f, 0.0755830f, 6.3700000f, 19},
-{0.7503807f, -0.6504205f, -0.1178215f, 4.6200000f, 41},
-{0.2677483f, -0.2228553f, -0.9373614f, 5.2000000f, 20},
-{0.7152749f, -0.6255421f, 0.3115749f, 3.9400000f, 50},
-{0.5092812f, -0.4359931f, -0.7419856f, 5.5100000f, 11},
-{0.6277485f, -0.5406641f, -0.5600126f, 6.4200000f, 20},
-{0.6456029f, -0.5679585f, 0.5105096f, 6.1300000f, 45},
-{0.7409385f, -0.6483572f, 0.1750517f, 5.6600000f, 21},
-{0.4581441f, -0.3923823f, -0.7975839f, 5.5200000f, 18},
-{0.4581025f, -0.3927280f, -0.7974377f, 4.8600000f, 13},
-{0.6352679f, -0.5502459f, -0.5419079f, 3.6800000f, 11},
-{0.7480857f, -0.6561786f, 0.0989821f, 6.1300000f, 26},
-{0.2928992f, -0.2656391f, 0.9185020f, 6.2000000f, 18},
-{0.4439496f, -0.3803373f, -0.8113275f, 6.2900000f, 52},
-{0.7506177f, -0.6602854f, -0.0244176f, 6.4100000f, 32},
-{0.7029040f, -0.6159963f, -0.3556326f, 6.1100000f, 25},
-{0.6548410f, -0.5827590f, 0.4812225f, 6.5700000f, 23},
-{0.6547979f, -0.5828742f, 0.4811418f, 4.0200000f, 47},
-{0.5038883f, -0.4367576f, -0.7452110f, 5.1600000f, 10},
-{0.5656837f, -0.4934773f, -0.6606679f, 4.0700000f, 45},
-{0.7484011f, -0.6623720f, -0.0340467f, 5.7000000f, 50},
-{0.6019173f, -0.5272404f, -0.5997609f, 5.7600000f, 12},
-{0.7348847f, -0.6508288f, -0.1906995f, 6.2500000f, 55},
-{0.7296444f, -0.6508513f, 0.2097892f, 5.8700000f, 21},
-{0.7420249f, -0.6609846f, 0.1117965f, 3.3800000f, 45},
-{0.6813781f, -0.6018879f, -0.4164791f, 6.1000000f, 22},
-{0.7302777f, -0.6482285f, -0.2156254f, 4.3200000f, 48},
-{0.4499158f, -0.3935365f, -0.8016887f, 1.9600000f, 21},
-{0.7453294f, -0.6666940f, -0.0017938f, 5.2900000f, 23},
-{0.5206031f, -0.4607054f, -0.7188344f, 3.9100000f, 21},
-{0.5654514f, -0.5020165f, -0.6544036f, 6.2100000f, 19},
-{0.4063128f, -0.3566039f, -0.8412750f, 6.2100000f, 17},
-{0.6234442f, -0.5555661f, -0.5501488f, 6.3700000f, 14},
-{0.2854051f, -0.2478913f, -0.9257936f, 6.3200000f, 53},
-{0.7380308f, -0.6670570f, 0.1017122f, 4.3600000f, 20},
-{0.7395586f, -0.6663789f, -0.0948275f, 6.0900000f, 50},
-{0.5369006f, -0.4771437f, -0.6957526f, 5.4600000f, 13},
-{0.3281518f, -0.2865173f, -0.9001246f, 6.0500000f, 24},
-{0.5190721f, -0.4645729f, -0.7174512f, 5.7500000f, 32},
-{0.5678087f, -0.5098011f, -0.6462942f, 6.3600000f, 40},
-{0.4259442f, -0.3791969f, -0.8214507f, 4.4900000f, 13},
-{0.6150017f, -0.5662002f, 0.5488080f, 6.2500000f, 37},
-{0.7384202f, -0.6728635f, -0.0446123f, 5.3100000f, 19},
-{0.5559515f, -0.5012255f, -0.6630920f, 6.4300000f, 12},
-{0.1710083f, -0.1451860f, -0.9745138f, 5.4700000f, 18},
-{0.4661621f, -0.4197465f, -0.7787848f, 6.3000000f, 18},
-{0.6957084f, -0.6417096f, 0.3227980f, 6.1600000f, 22},
-{0.3418436f, -0.3226350f, 0.8826379f, 5.7300000f, 32},
-{0.3743760f, -0.3524806f, 0.8576713f, 6.2500000f, 35},
-{0.6892240f, -0.6301665f, -0.3575757f, 6.4700000f, 27},
-{0.5286241f, -0.4927201f, 0.6912188f, 5.1500000f, 50},
-{0.5139121f, -0.4800420f, 0.7109529f, 5.9900000f, 50},
-{0.7080536f, -0.6546612f, 0.2647240f, 6.3800000f, 41},
-{0.5431117f, -0.5071987f, 0.6691630f, 5.9900000f, 50},
-{0.6308680f, -0.5773671f, -0.5183173f, 5.2100000f, 45},
-{0.6476100f, -0.5936159f, -0.4777253f, 5.8700000f, 48},
-{0.5682156f, -0.5190947f, -0.6384917f, 5.4800000f, 22},
-{0.6537299f, -0.6009249f, -0.4599200f, 6.1700000f, 19},
-{0.5744082f, -0.5257644f, -0.6273969f, 6.3900000f, 25},
-{0.6596092f, -0.6072415f, -0.4429147f, 4.0100000f, 53},
-{0.6155449f, -0.5769074f, 0.5369193f, 5.6600000f, 28},
-{0.5245586f, -0.4798070f, -0.7032948f, 4.9300000f, 22},
-{0.6429365f, -0.6020529f, 0.4734606f, 6.2300000f, 63},
-{0.6421886f, -0.6019840f, 0.4745620f, 5.9500000f, 48},
-{0.7274290f, -0.6758209f, -0.1187987f, 5.5400000f, 24},
-{0.1453420f, -0.1254632f, -0.9813943f, 6.0500000f, 25},
-{0.5479096f, -0.5036082f, -0.6679625f, 6.0000000f, 11},
-{0.7269835f, -0.6803189f, 0.0930657f, 6.3300000f, 25},
-{0.5158764f, -0.4750309f, -0.7128936f, 5.1000000f, 10},
-{0.5904317f, -0.5599480f, 0.5812475f, 6.1400000f, 24},
-{0.7117873f, -0.6667296f, -0.2209764f, 6.1300000f, 50},
-{0.5489801f, -0.5095415f, -0.6625619f, 6.5500000f, 21},
-{0.3076924f, -0.2987610f, 0.9033644f, 5.5800000f, 47},
-{0.6238588f, -0.5932886f, 0.5087326f, 5.3900000f, 47},
-{0.6225377f, -0.5827389f, -0.5223621f, 6.5000000f, 52},
-{0.5941821f, -0.5572103f, -0.5800555f, 6.4200000f, 48},
-{0.5800615f, -0.5447140f, -0.6056528f, 5.8200000f, 60},
-{0.4057245f, -0.3770554f, -0.8325965f, 5.5900000f, 18},
-{0.3084534f, -0.2840849f, -0.9078283f, 5.3500000f, 35},
-{0.7221789f, -0.6871110f, -0.0795997f, 6.0000000f, 42},
-{0.4914767f, -0.4608955f, -0.7389357f, 5.9100000f, 13},
-{0.6364715f, -0.6128202f, 0.4683539f, 5.2200000f, 48},
-{0.6888407f, -0.6616234f, 0.2962313f, 6.6400000f, 36},
-{0.4503130f, -0.4224286f, -0.7866208f, 6.3900000f, 20},
-{0.1494208f, -0.1321034f, -0.9799092f, 5.7900000f, 55},
-{0.2347133f, -0.2147707f, -0.9480418f, 6.1100000f, 20},
-{0.5012395f, -0.4875760f, 0.7148627f, 5.7400000f, 51},
-{0.5482372f, -0.5317816f, 0.6454799f, 5.8900000f, 33},
-{0.7172967f, -0.6890253f, 0.1035834f, 3.1100000f, 49},
-{0.5596525f, -0.5303715f, -0.6367850f, 6.4700000f, 50},
-{0.4140105f, -0.3896779f, -0.8226460f, 6.0300000f, 20},
-{0.7047992f, -0.6801809f, 0.2015243f, 5.4100000f, 55},
-{0.4998265f, -0.4736756f, -0.7251240f, 5.3300000f, 29},
-{0.7168906f, -0.6892268f, -0.1050444f, 6.9100000f, 27},
-{0.7168867f, -0.6892331f, -0.1050299f, 6.6700000f, 22},
-{0.6873492f, -0.6591825f, -0.3050074f, 5.7500000f, 52},
-{0.6014964f, -0.5856620f, 0.5433251f, 5.4500000f, 27},
-{0.6460670f, -0.6213171f, -0.4433537f, 4.8900000f, 23},
-{0.7155126f, -0.6946827f, 0.0738764f, 6.1400000f, 48},
-{0.6840771f, -0.6671939f, 0.2947724f, 6.1700000f, 51},
-{0.6662943f, -0.6430491f, -0.3775445f, 6.3900000f, 27},
-{0.3668491f, -0.3475543f, -0.8629182f, 5.7800000f, 15},
-{0.6901095f, -0.6737339f, 0.2642565f, 5.2000000f, 25},
-{0.5104725f, -0.4900460f, -0.7065924f, 6.2600000f, 13},
-{0.6162911f, -0.6055130f, 0.5035269f, 6.2900000f, 36},
-{0.6922120f, -0.6717867f, -0.2637141f, 5.9600000f, 50},
-{0.6882549f, -0.6739106f, 0.2686069f, 5.6700000f, 30},
-{0.5773354f, -0.5696200f, 0.5849931f, 6.5100000f, 22},
-{0.7046025f, -0.6906002f, 0.1631155f, 6.1900000f, 48},
-{0.3855182f, -0.3687311f, -0.8458209f, 6.3800000f, 15},
-{0.4743982f, -0.4711252f, 0.7436312f, 3.1400000f, 27},
-{0.4340226f, -0.4162066f, -0.7989972f, 5.7100000f, 36},
-{0.3681266f, -0.3525482f, -0.8603444f, 3.8400000f, 18},
-{0.6965720f, -0.6874330f, 0.2054830f, 4.2500000f, 25},
-{0.7125743f, -0.7010806f, 0.0269039f, 6.5900000f, 22},
-{0.4493797f, -0.4351878f, -0.7801727f, 4.6900000f, 15},
-{0.5980951f, -0.5957163f, 0.5361010f, 5.2000000f, 48},
-{0.2661133f, -0.2720901f, 0.9247436f, 4.7600000f, 63},
-{0.6743829f, -0.6695743f, 0.3112524f, 6.3800000f, 64},
-{0.6839182f, -0.6763900f, -0.2734090f, 5.8600000f, 36},
-{0.5257983f, -0.5287431f, 0.6663084f, 3.9700000f, 35},
-{0.5589437f, -0.5614533f, 0.6102066f, 6.4400000f, 55},
-{0.0667297f, -0.0763277f, 0.9948473f, 6.3300000f, 32},
-{0.3714207f, -0.3617378f, -0.8550979f, 4.9200000f, 12},
-{0.4826825f, -0.4740411f, -0.7364120f, 5.8700000f, 48},
-{0.6703919f, -0.6684349f, -0.3221326f, 6.1800000f, 36},
-{0.6309698f, -0.6269174f, -0.4570031f, 6.2500000f, 48},
-{0.5399486f, -0.5479073f, 0.6389468f, 6.3600000f, 29},
-{0.5943349f, -0.6016496f, 0.5336514f, 5.8200000f, 22},
-{0.4867390f, -0.4819697f, -0.7285536f, 5.1800000f, 20},
-{0.6199322f, -0.6298298f, 0.4679727f, 6.0700000f, 28},
-{0.6989899f, -0.7083443f, 0.0982921f, 6.0700000f, 51},
-{0.5355003f, -0.5359210f, -0.6527083f, 4.4500000f, 48},
-{0.4055082f, -0.4199405f, 0.8119194f, 5.7500000f, 22},
-{0.5177638f, -0.5194383f, -0.6797827f, 6.0700000f, 12},
-{0.4731647f, -0.4883747f, 0.7332158f, 3.6000000f, 21},
-{0.6359446f, -0.6513260f, 0.4139431f, 5.4500000f, 20},
-{0.7009881f, -0.7131232f, 0.0084260f, 5.6700000f, 50},
-{0.6357653f, -0.6424021f, -0.4279276f, 6.2000000f, 51},
-{0.3660229f, -0.3641167f, -0.8564148f, 5.1600000f, 33},
-{0.6929224f, -0.7097335f, 0.1270309f, 5.8500000f, 53},
-{0.5374125f, -0.5437655f, -0.6445982f, 5.5500000f, 15},
-{0.6134668f, -0.6361794f, 0.4679041f, 6.3800000f, 21},
-{0.5475345f, -0.5576941f, -0.6238455f, 6.2700000f, 51},
-{0.4570976f, -0.4791687f, 0.7493058f, 5.9500000f, 36},
-{0.3625938f, -0.3650119f, -0.8574917f, 5.7900000f, 48},
-{0.4338296f, -0.4404803f, -0.7859828f, 5.2300000f, 19},
-{0.5842258f, -0.6098639f, 0.5354870f, 6.4600000f, 28},
-{0.6345675f, -0.6522363f, -0.4146227f, 6.7400000f, 18},
-{0.3498144f, -0.3709491f, 0.8602480f, 6.4500000f, 22},
-{0.2673718f, -0.2877096f, 0.9196388f, 5.1400000f, 55},
-{0.2713315f, -0.2740484f, -0.9226466f, 5.8800000f, 61},
-{0.4251031f, -0.4367108f, -0.7928247f, 6.4000000f, 16},
-{0.5377539f, -0.5693054f, 0.6218618f, 4.5600000f, 47},
-{0.6857218f, -0.7224316f, 0.0887591f, 4.9700000f, 52},
-{0.4742897f, -0.4918065f, -0.7301888f, 3.7500000f, 52},
-{0.2889307f, -0.2951665f, -0.9107117f, 4.0000000f, 22},
-{0.2620274f, -0.2869231f, 0.9214211f, 4.8000000f, 36},
-{0.6294895f, -0.6717955f, 0.3904276f, 6.4000000f, 34},
-{0.6849650f, -0.7281286f, 0.0255275f, 6.1700000f, 61},
-{0.4218470f, -0.4558392f, 0.7837446f, 4.4800000f, 30},
-{0.5747482f, -0.6167106f, 0.5378964f, 6.5000000f, 32},
-{0.5926708f, -0.6355708f, 0.4947637f, 5.4300000f, 48},
-{0.3855631f, -0.4020615f, -0.8304744f, 6.4400000f, 28},
-{0.6710048f, -0.7179718f, 0.1851187f, 5.2400000f, 18},
-{0.2999833f, -0.3300195f, 0.8950403f, 4.6700000f, 33},
-{0.5639248f, -0.6092589f, 0.5574875f, 5.9300000f, 39},
-{0.6074038f, -0.6558694f, 0.4482142f, 5.9800000f, 45},
-{0.6281058f, -0.6816159f, 0.3753437f, 5.1400000f, 49},
-{0.6222080f, -0.6675185f, -0.4089942f, 4.5800000f, 54},
-{0.4016403f, -0.4253419f, -0.8110298f, 6.1100000f, 12},
-{0.6740730f, -0.7273171f, -0.1289783f, 5.6000000f, 19},
-{0.4326739f, -0.4609323f, -0.7748127f, 6.7300000f, 54},
-{0.3069604f, -0.3238270f, -0.8949365f, 6.3700000f, 53},
-{0.2084877f, -0.2357630f, 0.9491832f, 6.5500000f, 48},
-{0.5022866f, -0.5386207f, -0.6764583f, 2.2100000f, 54},
-{0.6625897f, -0.7216555f, 0.2004700f, 6.4800000f, 32},
-{0.6642339f, -0.7197709f, -0.2017997f, 5.7700000f, 46},
-{0.6148313f, -0.6635217f, -0.4262881f, 6.1500000f, 24},
-{0.6465515f, -0.6998744f, -0.3035573f, 5.7300000f, 22},
-{0.5775365f, -0.6338426f, 0.5144853f, 5.9500000f, 66},
-{0.6253725f, -0.6845603f, 0.3745482f, 6.0100000f, 45},
-{0.6715470f, -0.7302486f, -0.1255449f, 5.4600000f, 48},
-{0.2419057f, -0.2541111f, -0.9364343f, 4.7100000f, 12},
-{0.2204488f, -0.2305790f, -0.9477529f, 4.4800000f, 39},
-{0.5873877f, -0.6406843f, -0.4944687f, 5.5900000f, 24},
-{0.1925222f, -0.2212309f, 0.9560293f, 5.9600000f, 30},
-{0.6215576f, -0.6805930f, -0.3878910f, 6.5300000f, 21},
-{0.4475227f, -0.4873242f, -0.7498257f, 6.4800000f, 29},
-{0.3164168f, -0.3587256f, 0.8781778f, 5.1300000f, 39},
-{0.6663221f, -0.7395496f, 0.0952956f, 6.3500000f, 29},
-{0.6454230f, -0.7186625f, 0.2587535f, 6.5100000f, 49},
-{0.6669112f, -0.7420787f, 0.0674445f, 6.1400000f, 20},
-{0.4833567f, -0.5453915f, 0.6847733f, 5.3200000f, 18},
-{0.6355313f, -0.7056949f, -0.3132006f, 5.7300000f, 49},
-{0.4905078f, -0.5403543f, -0.6836808f, 5.0000000f, 15},
-{0.6629018f, -0.7390323f, -0.1199684f, 6.1100000f, 23},
-{0.5227099f, -0.5789176f, -0.6258025f, 6.0000000f, 16},
-{0.6185785f, -0.6968544f, 0.3629802f, 6.4800000f, 22},
-{0.4707139f, -0.5207362f, -0.7122235f, 5.7900000f, 12},
-{0.3659304f, -0.4027402f, -0.8389846f, 3.4400000f, 12},
-{0.3600991f, -0.4136326f, 0.8362037f, 5.2700000f, 55},
-{0.4930076f, -0.5499967f, -0.6741269f, 5.5700000f, 18},
-{0.3850540f, -0.4436898f, 0.8092421f, 4.8300000f, 25},
-{0.3185150f, -0.3515093f, -0.8803348f, 3.9700000f, 13},
-{0.5418682f, -0.6191800f, 0.5683265f, 5.9700000f, 46},
-{0.6608870f, -0.7493984f, 0.0403788f, 3.8800000f, 19},
-{0.1770639f, -0.2108858f, 0.9613405f, 6.5000000f, 48},
-{0.5279843f, -0.5938040f, -0.6071486f, 6.3100000f, 20},
-{0.4962150f, -0.5574780f, -0.6655742f, 6.2900000f, 52},
-{0.6363241f, -0.7270591f, 0.2578308f, 5.3400000f, 51},
-{0.4557143f, -0.5131706f, -0.7273104f, 5.9200000f, 19},
-{0.4774969f, -0.5403610f, -0.6928252f, 5.8500000f, 15},
-{0.3471984f, -0.3887525f, -0.8534194f, 5.5400000f, 46},
-{0.4854198f, -0.5506411f, -0.6790891f, 5.2500000f, 14},
-{0.6356365f, -0.7274576f, -0.2584022f, 6.3500000f, 20},
-{0.4455243f, -0.5194351f, 0.7291744f, 5.9700000f, 21},
-{0.5308436f, -0.6050626f, -0.5933838f, 5.8600000f, 40},
-{0.0707779f, -0.0687594f, -0.9951194f, 5.4200000f, 28},
-{0.3848710f, -0.4361666f, -0.8134083f, 5.2700000f, 48},
-{0.4701564f, -0.5372603f, -0.7002173f, 6.2500000f, 18},
-{0.6505947f, -0.7530235f, -0.0983983f, 5.2400000f, 52},
-{0.5219889f, -0.5984286f, -0.6077917f, 4.9400000f, 50},
-{0.6485547f, -0.7506181f, -0.1262903f, 5.4700000f, 19},
-{0.5274430f, -0.6054276f, -0.5960380f, 4.6200000f, 35},
-{0.2461525f, -0.2762756f, -0.9290214f, 1.6800000f, 22},
-{0.5284449f, -0.6211037f, 0.5787713f, 5.7500000f, 28},
-{0.6345172f, -0.7372062f, -0.2321959f, 5.8400000f, 50},
-{0.4788504f, -0.5511942f, -0.6832915f, 6.0400000f, 21},
-{0.6368736f, -0.7447395f, 0.1993869f, 6.4100000f, 22},
-{0.5177680f, -0.6107742f, 0.5990585f, 3.8200000f, 23},
-{0.3526717f, -0.4031789f, -0.8444344f, 6.0200000f, 17},
-{0.4731220f, -0.5461148f, -0.6913134f, 5.1200000f, 53},
-{0.3636065f, -0.4167487f, -0.8331331f, 6.3200000f, 48},
-{0.5102755f, -0.5919601f, -0.6238607f, 5.3300000f, 55},
-{0.1692115f, -0.1882668f, -0.9674312f, 6.1400000f, 51},
-{0.3621282f, -0.4173281f, -0.8334869f, 4.3400000f, 61},
-{0.4006661f, -0.4805958f, 0.7800605f, 6.1300000f, 33},
-{0.3497434f, -0.4232244f, 0.8357994f, 5.4700000f, 64},
-{0.3387260f, -0.3934232f, -0.8546829f, 2.2500000f, 28},
-{0.3868453f, -0.4517588f, -0.8039059f, 6.3300000f, 53},
-{0.5026188f, -0.6042709f, 0.6182484f, 6.1200000f, 32},
-{0.6330794f, -0.7515508f, -0.1854237f, 6.6200000f, 22},
-{0.4089589f, -0.4792385f, -0.7765843f, 5.2600000f, 17},
-{0.6246885f, -0.7415350f, -0.2447245f, 5.7800000f, 54},
-{0.5275048f, -0.6345652f, 0.5648590f, 3.1300000f, 57},
-{0.6337192f, -0.7537220f, -0.1740779f, 4.7900000f, 48},
-{0.5355960f, -0.6465814f, 0.5432029f, 6.1600000f, 53},
-{0.4121410f, -0.4855646f, -0.7709519f, 5.8700000f, 16},
-{0.6342200f, -0.7590793f, -0.1468456f, 4.8000000f, 48},
-{0.5341018f, -0.6353814f, -0.5576968f, 6.3900000f, 18},
-{0.6157351f, -0.7420298f, 0.2650700f, 6.5300000f, 21},
-{0.2514273f, -0.2925349f, -0.9226092f, 5.3900000f, 34},
-{0.2544695f, -0.2975816f, -0.9201578f, 6.1100000f, 52},
-{0.6196428f, -0.7445438f, -0.2483893f, 6.3300000f, 36},
-{0.5531923f, -0.6635890f, -0.5036148f, 6.8200000f, 19},
-{0.5159237f, -0.6175487f, -0.5936803f, 6.0500000f, 53},
-{0.3712802f, -0.4406882f, -0.8172790f, 6.2800000f, 15},
-{0.5824873f, -0.7034393f, -0.4072858f, 4.7200000f, 61},
-{0.1584478f, -0.2025488f, 0.9663686f, 6.2900000f, 25},
-{0.1892911f, -0.2205055f, -0.9568418f, 5.2900000f, 21},
-{0.1875212f, -0.2185080f, -0.9576482f, 5.8600000f, 20},
-{0.2738649f, -0.3434846f, 0.8983409f, 6.2800000f, 52},
-{0.5709464f, -0.7021111f, 0.4255117f, 6.4100000f, 45},
-{0.6268049f, -0.7661356f, -0.1419571f, 6.5300000f, 25},
-{0.3891660f, -0.4845803f, 0.7834103f, 6.3100000f, 42},
-{0.4745246f, -0.5748688f, -0.6665975f, 5.5800000f, 61},
-{0.5042932f, -0.6248379f, 0.5960419f, 6.6700000f, 30},
-{0.3042641f, -0.3656647f, -0.8796094f, 4.8100000f, 46},
-{0.4980733f, -0.6075074f, -0.6187550f, 6.5400000f, 51},
-{0.4412992f, -0.5372465f, -0.7187637f, 5.7500000f, 46},
-{0.5627537f, -0.6990183f, 0.4412274f, 4.4600000f, 52},
-{0.3698339f, -0.4479803f, -0.8139635f, 5.6300000f, 23},
-{0.5622929f, -0.6894700f, -0.4565718f, 4.6900000f, 48},
-{0.3647190f, -0.4428856f, -0.8190436f, 2.5000000f, 12},
-{0.5082515f, -0.6262217f, -0.5912080f, 6.4800000f, 21},
-{0.5981134f, -0.7488528f, 0.2854468f, 6.2900000f, 49},
-{0.4912832f, -0.6081568f, -0.6235272f, 6.0600000f, 27},
-{0.6222950f, -0.7781418f, -0.0851126f, 5.5900000f, 55},
-{0.4023222f, -0.4967895f, -0.7689844f, 6.0800000f, 27},
-{0.3184620f, -0.3913670f, -0.8633735f, 6.3000000f, 51},
-{0.6212175f, -0.7835824f, -0.0093568f, 6.0100000f, 52},
-{0.3111551f, -0.3845704f, -0.8690731f, 5.9900000f, 50},
-{0.4291395f, -0.5525792f, 0.7144896f, 5.4100000f, 50},
-{0.6110208f, -0.7767711f, -0.1525786f, 6.5400000f, 22},
-{0.5513422f, -0.6977864f, -0.4572920f, 6.1000000f, 16},
-{0.4791084f, -0.6048909f, -0.6360520f, 6.2000000f, 27},
-{0.3430555f, -0.4462449f, 0.8265461f, 6.4500000f, 33},
-{0.6120231f, -0.7804484f, -0.1277811f, 1.9800000f, 53},
-{0.5744184f, -0.7306550f, -0.3690349f, 4.6900000f, 52},
-{0.6131203f, -0.7832074f, -0.1032941f, 5.3800000f, 42},
-{0.0880618f, -0.1224232f, 0.9885634f, 4.2900000f, 53},
-{0.3117233f, -0.3899711f, -0.8664590f, 5.7700000f, 24},
-{0.3772948f, -0.4756082f, -0.7946354f, 5.1100000f, 16},
-{0.6064286f, -0.7794011f, 0.1574112f, 5.4100000f, 39},
-{0.6077273f, -0.7812694f, 0.1424274f, 5.7100000f, 50},
-{0.5053817f, -0.6447689f, -0.5734652f, 6.6500000f, 23},
-{0.2733824f, -0.3612415f, 0.8914968f, 3.6700000f, 30},
-{0.6120393f, -0.7907210f, -0.0129684f, 6.2700000f, 30},
-{0.6115642f, -0.7909030f, -0.0214853f, 4.6000000f, 36},
-{0.6105079f, -0.7913907f, -0.0313187f, 6.1400000f, 30},
-{0.2807944f, -0.3553455f, -0.8915627f, 6.0500000f, 23},
-{0.6090438f, -0.7904314f, -0.0654515f, 6.2600000f, 46},
-{0.5772985f, -0.7470043f, -0.3297135f, 5.6600000f, 61},
-{0.5046463f, -0.6619635f, 0.5541989f, 5.8500000f, 48},
-{0.5065598f, -0.6556779f, -0.5598961f, 4.5100000f, 53},
-{0.4843358f, -0.6270625f, -0.6100914f, 6.1900000f, 27},
-{0.5623287f, -0.7317276f, -0.3851769f, 6.2400000f, 50},
-{0.1808207f, -0.2463677f, 0.9521590f, 5.7200000f, 37},
-{0.4936668f, -0.6523894f, 0.5750489f, 5.3700000f, 61},
-{0.5501554f, -0.7163830f, -0.4290972f, 5.4800000f, 53},
-{0.2045132f, -0.2776021f, 0.9386754f, 4.5600000f, 44},
-{0.5883122f, -0.7693181f, -0.2490749f, 5.8500000f, 53},
-{0.5550026f, -0.7346442f, 0.3902179f, 4.3100000f, 55},
-{0.1587712f, -0.2187572f, 0.9627757f, 6.4600000f, 19},
-{0.3713263f, -0.4966181f, 0.7845299f, 3.1700000f, 36},
-{0.2903454f, -0.3742548f, -0.8807002f, 5.9200000f, 51},
-{0.2075760f, -0.2635611f, -0.9420444f, 5.4700000f, 52},
-{0.3887951f, -0.5212289f, 0.7597097f, 6.7600000f, 24},
-{0.5933205f, -0.7870770f, 0.1687618f, 5.0700000f, 52},
-{0.5243561f, -0.6880459f, -0.5016408f, 7.0000000f, 22},
-{0.5243108f, -0.6880591f, -0.5016701f, 6.1800000f, 20},
-{0.5903371f, -0.7830128f, 0.1959414f, 4.9700000f, 50},
-{0.2565502f, -0.3298798f, -0.9084940f, 5.9100000f, 20},
-{0.3871701f, -0.5049652f, -0.7714334f, 5.4500000f, 18},
-{0.5948599f, -0.7868907f, -0.1641486f, 6.1400000f, 30},
-{0.4676389f, -0.6133084f, -0.6365270f, 3.6000000f, 33},
-{0.6018180f, -0.7985066f, -0.0142240f, 4.5700000f, 23},
-{0.5935760f, -0.7872016f, -0.1672754f, 6.1300000f, 50},
-{0.5219087f, -0.6896907f, -0.5019343f, 5.9300000f, 29},
-{0.4985466f, -0.6588880f, -0.5633098f, 5.8700000f, 54},
-{0.4796278f, -0.6452604f, 0.5946396f, 6.1800000f, 54},
-{0.5255352f, -0.7057342f, 0.4751337f, 6.5300000f, 23},
-{0.3251236f, -0.4252056f, -0.8446862f, 5.8800000f, 62},
-{0.5990906f, -0.8000201f, 0.0325301f, 6.1100000f, 37},
-{0.1176857f, -0.1455266f, -0.9823299f, 5.3600000f, 33},
-{0.5692587f, -0.7577681f, -0.3189547f, 5.7400000f, 25},
-{0.4056267f, -0.5498103f, 0.7301888f, 6.5200000f, 30},
-{0.5334815f, -0.7099391f, -0.4597650f, 6.4600000f, 29},
-{0.3640071f, -0.4956489f, 0.7885626f, 4.5000000f, 22},
-{0.4781538f, -0.6475065f, 0.5933838f, 4.5500000f, 48},
-{0.5930917f, -0.7944992f, -0.1304349f, 6.1200000f, 50},
-{0.5844191f, -0.7821337f, -0.2161509f, 5.9400000f, 55},
-{0.3295520f, -0.4342540f, -0.8383430f, 3.1300000f, 55},
-{0.5457272f, -0.7374070f, 0.3980109f, 6.2500000f, 57},
-{0.5929397f, -0.7964684f, -0.1185773f, 6.2400000f, 50},
-{0.1690656f, -0.2368828f, 0.9567149f, 6.4200000f, 32},
-{0.4645049f, -0.6182223f, -0.6340634f, 5.3500000f, 48},
-{0.5583357f, -0.7491217f, -0.3564798f, 5.0100000f, 50},
-{0.4552995f, -0.6213101f, 0.6377116f, 4.8100000f, 49},
-{0.5566482f, -0.7484126f, -0.3605847f, 5.9100000f, 20},
-{0.4522051f, -0.6188415f, 0.6422972f, 6.7600000f, 32},
-{0.4654775f, -0.6240880f, -0.6275706f, 6.4300000f, 30},
-{0.2523219f, -0.3334731f, -0.9083663f, 6.2700000f, 51},
-{0.5914032f, -0.8032233f, -0.0712363f, 5.5600000f, 51},
-{0.4776425f, -0.6553716f, 0.5851032f, 5.4100000f, 48},
-{0.2894158f, -0.3849174f, -0.8764001f, 6.1000000f, 66},
-{0.3908723f, -0.5269902f, -0.7546523f, 5.1200000f, 14},
-{0.5697752f, -0.7833773f, 0.2483471f, 6.3600000f, 21},
-{0.3760644f, -0.5089026f, -0.7743344f, 5.0100000f, 11},
-{0.5008119f, -0.6938503f, 0.5174546f, 5.5600000f, 62},
-{0.1771695f, -0.2342707f, -0.9558913f, 5.4700000f, 54},
-{0.5591493f, -0.7665157f, -0.3159204f, 6.3100000f, 22},
-{0.4886266f, -0.6676031f, -0.5617385f, 6.4900000f, 37},
-{0.2223413f, -0.3159639f, 0.9223509f, 5.9400000f, 55},
-{0.3075859f, -0.4173709f, -0.8550979f, 4.0800000f, 15},
-{0.5602228f, -0.7785089f, 0.2829739f, 5.6900000f, 51},
-{0.5793519f, -0.8063401f, 0.1190250f, 5.0000000f, 51},
-{0.5380379f, -0.7443751f, -0.3955010f, 6.5300000f, 32},
-{0.4422974f, -0.6221525f, 0.6459871f, 5.2500000f, 30},
-{0.5307707f, -0.7373096f, -0.4179199f, 5.7000000f, 51},
-{0.3979884f, -0.5499089f, -0.7343061f, 6.1700000f, 20},
-{0.5747082f, -0.8046587f, -0.1491135f, 6.4000000f, 21},
-{0.4959380f, -0.6899483f, -0.5272730f, 5.6300000f, 50},
-{0.5771802f, -0.8125843f, 0.0810543f, 4.6800000f, 53},
-{0.4718877f, -0.6583467f, -0.5864313f, 5.9800000f, 52},
-{0.3864345f, -0.5359361f, -0.7506270f, 4.3500000f, 25},
-{0.3677456f, -0.5097591f, -0.7777588f, 6.1900000f, 50},
-{0.2004737f, -0.2923646f, 0.9350579f, 5.6900000f, 49},
-{0.1716070f, -0.2519284f, 0.9524091f, 5.1700000f, 50},
-{0.3565874f, -0.4962667f, -0.7915584f, 5.4500000f, 22},
-{0.2662609f, -0.3667626f, -0.8913980f, 6.5600000f, 22},
-{0.4259527f, -0.5973015f, -0.6795551f, 5.5000000f, 48},
-{0.1138482f, -0.1712149f, 0.9786338f, 6.2300000f, 52},
-{0.4532915f, -0.6394865f, -0.6209540f, 6.7000000f, 35},
-{0.5740244f, -0.8187015f, -0.0149608f, 3.9100000f, 52},
-{0.5665661f, -0.8075643f, -0.1638377f, 6.3100000f, 20},
-{0.1031288f, -0.1577475f, 0.9820795f, 6.1700000f, 30},
-{0.5649662f, -0.8093708f, -0.1604124f, 6.3700000f, 22},
-{0.5562684f, -0.7967005f, -0.2362917f, 5.0600000f, 15},
-{0.4853530f, -0.7034716f, 0.5191918f, 5.8900000f, 56},
-{0.4354138f, -0.6335606f, 0.6395434f, 5.6200000f, 48},
-{0.5609925f, -0.8097986f, 0.1717954f, 3.5200000f, 36},
-{0.5106183f, -0.7404714f, 0.4370024f, 6.2400000f, 52},
-{0.3741061f, -0.5479995f, 0.7481585f, 6.3900000f, 21},
-{0.3276670f, -0.4817705f, 0.8127309f, 6.4700000f, 25},
-{0.2820800f, -0.4004300f, -0.8718295f, 4.5200000f, 19},
-{0.4613469f, -0.6757496f, 0.5749101f, 6.1400000f, 33},
-{0.5260172f, -0.7602558f, -0.3812048f, 4.7700000f, 16},
-{0.2355311f, -0.3512075f, 0.9061889f, 6.1700000f, 33},
-{0.1129756f, -0.1525200f, -0.9818219f, 5.1100000f, 15},
-{0.4857934f, -0.7172105f, 0.4996137f, 5.6400000f, 22},
-{0.5240494f, -0.7642099f, -0.3759727f, 4.9400000f, 39},
-{0.3191872f, -0.4588584f, -0.8291975f, 5.3200000f, 23},
-{0.3125341f, -0.4506701f, -0.8361931f, 5.8000000f, 50},
-{0.2450741f, -0.3699976f, 0.8961253f, 6.3400000f, 32},
-{0.5434727f, -0.8037000f, 0.2422888f, 5.3500000f, 62},
-{0.4647526f, -0.6805999f, -0.5663823f, 6.4100000f, 20},
-{0.3270308f, -0.4749295f, -0.8170023f, 6.0000000f, 14},
-{0.5274464f, -0.7856633f, 0.3233165f, 6.5000000f, 50},
-{0.2985269f, -0.4532920f, 0.8398857f, 5.2000000f, 63},
-{0.5009542f, -0.7441067f, -0.4419843f, 4.7900000f, 28},
-{0.3548787f, -0.5234564f, -0.7746318f, 6.1500000f, 16},
-{0.5055943f, -0.7627965f, 0.4031327f, 2.9800000f, 41},
-{0.4373141f, -0.6499545f, -0.6215428f, 6.8200000f, 32},
-{0.3440986f, -0.5087254f, -0.7891734f, 5.5600000f, 20},
-{0.5475555f, -0.8285747f, 0.1168200f, 5.7900000f, 61},
-{0.5388696f, -0.8171481f, 0.2046669f, 5.6300000f, 54},
-{0.4809735f, -0.7223041f, -0.4969319f, 6.4500000f, 10},
-{0.5502377f, -0.8344265f, 0.0311588f, 5.6500000f, 34},
-{0.5356112f, -0.8203083f, 0.2005365f, 6.4500000f, 27},
-{0.3766932f, -0.5833389f, 0.7195957f, 5.0900000f, 40},
-{0.5354228f, -0.8210106f, 0.1981516f, 6.0200000f, 68},
-{0.3027509f, -0.4560004f, -0.8369023f, 6.4600000f, 18},
-{0.2647342f, -0.3971274f, -0.8787523f, 3.6900000f, 45},
-{0.2214168f, -0.3488802f, 0.9106356f, 6.3100000f, 29},
-{0.4007040f, -0.6083154f, -0.6851194f, 5.5500000f, 12},
-{0.2990926f, -0.4515514f, -0.8406218f, 6.2200000f, 35},
-{0.2745425f, -0.4350814f, 0.8575142f, 3.8000000f, 32},
-{0.5015729f, -0.7860624f, 0.3612901f, 6.0900000f, 27},
-{0.2321853f, -0.3544843f, -0.9057764f, 3.0100000f, 26},
-{0.2321746f, -0.3545017f, -0.9057723f, 6.2600000f, 17},
-{0.4317214f, -0.6742102f, -0.5992138f, 5.9700000f, 51},
-{0.5339143f, -0.8421398f, 0.0757377f, 6.2400000f, 37},
-{0.3107647f, -0.4978429f, 0.8096776f, 4.5900000f, 23},
-{0.3064168f, -0.4748588f, -0.8249957f, 6.0600000f, 50},
-{0.5196793f, -0.8239074f, 0.2260752f, 6.4600000f, 60},
-{0.4365934f, -0.6843585f, -0.5839860f, 6.3700000f, 50},
-{0.3848834f, -0.6038649f, -0.6980057f, 5.0800000f, 17},
-{0.5316085f, -0.8444523f, -0.0655192f, 6.0100000f, 28},
-{0.4830000f, -0.7720866f, 0.4130294f, 5.3200000f, 25},
-{0.5295432f, -0.8422037f, -0.1013746f, 6.4200000f, 38},
-{0.1404487f, -0.2128871f, -0.9669298f, 5.4500000f, 48},
-{0.5178949f, -0.8246225f, -0.2275578f, 4.1200000f, 47},
-{0.3776721f, -0.5968414f, -0.7079154f, 5.7300000f, 50},
-{0.4737189f, -0.7637576f, 0.4384801f, 3.8800000f, 52},
-{0.5286813f, -0.8477396f, 0.0428202f, 6.0200000f, 20},
-{0.5291785f, -0.8485095f, 0.0013187f, 6.3500000f, 49},
-{0.5107558f, -0.8173273f, -0.2666544f, 6.0800000f, 50},
-{0.5230381f, -0.8411682f, -0.1373581f, 5.0500000f, 21},
-{0.3711273f, -0.5900822f, -0.7169850f, 5.6200000f, 52},
-{0.2504841f, -0.4130153f, 0.8756004f, 6.2700000f, 50},
-{0.3725707f, -0.5943893f, -0.7126657f, 4.5800000f, 45},
-{0.2778355f, -0.4412024f, -0.8533158f, 5.7900000f, 52},
-{0.2567512f, -0.4066442f, -0.8767664f, 5.5700000f, 51},
-{0.5207300f, -0.8473870f, 0.1038052f, 5.9500000f, 62},
-{0.4703479f, -0.7598267f, -0.4488165f, 6.3000000f, 41},
-{0.3329814f, -0.5526254f, 0.7640213f, 5.2700000f, 23},
-{0.1489900f, -0.2538965f, 0.9556875f, 5.8300000f, 53},
-{0.4763789f, -0.7789429f, -0.4078126f, 4.8800000f, 52},
-{0.3046262f, -0.4922704f, -0.8153973f, 6.4800000f, 11},
-{0.4842729f, -0.7943662f, -0.3666907f, 6.2400000f, 22},
-{0.2748741f, -0.4630635f, 0.8426247f, 5.9300000f, 45},
-{0.4909960f, -0.8081025f, -0.3254123f, 4.9400000f, 61},
-{0.3302429f, -0.5380463f, -0.7755294f, 5.9300000f, 12},
-{0.3705126f, -0.6063622f, -0.7035945f, 5.7100000f, 13},
-{0.5071889f, -0.8477307f, 0.1552803f, 5.8500000f, 52},
-{0.3354990f, -0.5520973f, -0.7633014f, 5.7200000f, 20},
-{0.3836137f, -0.6492047f, 0.6567905f, 5.1400000f, 36},
-{0.3564148f, -0.6047605f, 0.7122030f, 6.3000000f, 50},
-{0.3990054f, -0.6646475f, -0.6316949f, 6.4100000f, 61},
-{0.4624402f, -0.7755583f, -0.4297189f, 6.2800000f, 24},
-{0.4321191f, -0.7233906f, -0.5384971f, 5.8400000f, 51},
-{0.4578096f, -0.7687453f, -0.4465883f, 6.3200000f, 24},
-{0.0495051f, -0.0936685f, 0.9943719f, 6.3700000f, 50},
-{0.3256007f, -0.5438506f, -0.7734409f, 6.3700000f, 12},
-{0.4476805f, -0.7633200f, 0.4657518f, 6.3000000f, 33},
-{0.4947933f, -0.8418672f, 0.2154976f, 5.2600000f, 19},
-{0.5017329f, -0.8528509f, 0.1446009f, 6.0400000f, 53},
-{0.2739805f, -0.4738873f, 0.8368784f, 5.4800000f, 55},
-{0.3049200f, -0.5118296f, -0.8031527f, 3.5400000f, 15},
-{0.3188310f, -0.5368748f, -0.7810968f, 6.1200000f, 13},
-{0.4358542f, -0.7519132f, 0.4946288f, 5.7300000f, 49},
-{0.3430681f, -0.5807229f, -0.7382853f, 6.0500000f, 13},
-{0.1707854f, -0.2846893f, -0.9432838f, 6.3500000f, 19},
-{0.5001899f, -0.8639006f, 0.0590402f, 6.7000000f, 30},
-{0.4665719f, -0.8008603f, -0.3754111f, 6.2100000f, 14},
-{0.4175119f, -0.7149991f, -0.5607675f, 5.2300000f, 31},
-{0.2276297f, -0.3835754f, -0.8950165f, 6.5800000f, 50},
-{0.1840868f, -0.3094068f, -0.9329413f, 6.2000000f, 13},
-{0.4942818f, -0.8579646f, 0.1399364f, 4.7000000f, 62},
-{0.4211282f, -0.7369085f, 0.5287881f, 5.3600000f, 43},
-{0.4538570f, -0.8088878f, 0.3737838f, 5.6600000f, 12},
-{0.2851650f, -0.4967861f, -0.8196856f, 6.5200000f, 50},
-{0.2843434f, -0.5161779f, 0.8079042f, 5.7400000f, 35},
-{0.2995921f, -0.5277795f, -0.7947914f, 6.2000000f, 12},
-{0.4261906f, -0.7596309f, -0.4912458f, 6.5400000f, 51},
-{0.2707784f, -0.4784369f, -0.8353306f, 6.2000000f, 51},
-{0.2932581f, -0.5355082f, 0.7919789f, 6.1400000f, 25},
-{0.4807714f, -0.8645153f, -0.1465338f, 6.1200000f, 50},
-{0.2493374f, -0.4407023f, -0.8623296f, 5.9400000f, 29},
-{0.4835196f, -0.8735506f, 0.0558409f, 6.4500000f, 34},
-{0.4415870f, -0.7941089f, -0.4176028f, 6.7000000f, 20},
-{0.4611709f, -0.8323883f, -0.3073289f, 5.8600000f, 20},
-{0.3423918f, -0.6135283f, -0.7115834f, 6.1200000f, 20},
-{0.4426495f, -0.8014448f, -0.4021786f, 5.7000000f, 28},
-{0.2456318f, -0.4385996f, -0.8644625f, 6.1900000f, 26},
-{0.2308878f, -0.4115354f, -0.8816629f, 6.4200000f, 53},
-{0.3807363f, -0.6896314f, -0.6159938f, 6.4300000f, 51},
-{0.4604013f, -0.8451522f, 0.2715664f, 6.3700000f, 32},
-{0.4683169f, -0.8547341f, -0.2238502f, 4.6000000f, 19},
-{0.2423675f, -0.4353218f, -0.8670369f, 6.1400000f, 17},
-{0.3902255f, -0.7131554f, -0.5823516f, 6.2700000f, 51},
-{0.4718546f, -0.8762375f, 0.0977807f, 6.2100000f, 51},
-{0.3852072f, -0.7201428f, 0.5770700f, 4.4800000f, 27},
-{0.4519797f, -0.8441174f, 0.2884098f, 3.5200000f, 20},
-{0.3271722f, -0.6037589f, -0.7269343f, 5.0800000f, 51},
-{0.4523961f, -0.8433470f, -0.2900063f, 5.6000000f, 57},
-{0.2947202f, -0.5434761f, -0.7859858f, 6.5200000f, 51},
-{0.3989739f, -0.7524584f, 0.5240478f, 6.2400000f, 34},
-{0.4627032f, -0.8693486f, 0.1736052f, 4.3700000f, 53},
-{0.4696992f, -0.8828027f, 0.0064868f, 4.4900000f, 20},
-{0.4578669f, -0.8645016f, 0.2073521f, 1.3500000f, 17},
-{0.0710480f, -0.1239669f, -0.9897395f, 5.5200000f, 20},
-{0.3764878f, -0.7082818f, -0.5971547f, 6.3600000f, 50},
-{0.4606430f, -0.8733331f, -0.1584214f, 6.5300000f, 22},
-{0.4525366f, -0.8564240f, -0.2484927f, 6.2700000f, 20},
-{0.3473850f, -0.6743572f, 0.6515874f, 6.3200000f, 53},
-{0.4520391f, -0.8678197f, -0.2062753f, 6.2400000f, 25},
-{0.4572217f, -0.8794855f, -0.1321122f, 5.9100000f, 21},
-{0.2982662f, -0.5665408f, -0.7681594f, 4.8600000f, 13},
-{0.4526065f, -0.8703605f, -0.1939585f, 5.3100000f, 35},
-{0.3836645f, -0.7333369f, -0.5612651f, 6.1300000f, 38},
-{0.3630747f, -0.7065682f, 0.6074028f, 5.8500000f, 53},
-{0.4500114f, -0.8699090f, -0.2018615f, 3.6100000f, 50},
-{0.2032492f, -0.3851297f, -0.9002027f, 5.2800000f, 50},
-{0.4541402f, -0.8811065f, -0.1319392f, 5.6500000f, 52},
-{0.0804857f, -0.1453895f, -0.9860953f, 6.6000000f, 46},
-{0.4430873f, -0.8662102f, 0.2309838f, 6.4400000f, 37},
-{0.2289318f, -0.4368147f, -0.8699328f, 5.6000000f, 62},
-{0.4536191f, -0.8835638f, -0.1163818f, 6.2500000f, 22},
-{0.3503729f, -0.6776135f, -0.6465901f, 5.9800000f, 52},
-{0.1788011f, -0.3416820f, -0.9226503f, 5.8100000f, 20},
-{0.4029162f, -0.7911800f, -0.4601008f, 6.2800000f, 21},
-{0.4493965f, -0.8897021f, 0.0804550f, 5.7700000f, 50},
-{0.4273316f, -0.8444158f, -0.3230320f, 6.4400000f, 36},
-{0.3976745f, -0.7961321f, 0.4561016f, 6.0400000f, 43},
-{0.2469880f, -0.4825876f, -0.8403012f, 6.4000000f, 63},
-{0.2209897f, -0.4487560f, 0.8658993f, 6.2500000f, 60},
-{0.2414493f, -0.4727230f, -0.8474876f, 5.7200000f, 12},
-{0.2796019f, -0.5510261f, -0.7862525f, 6.1600000f, 52},
-{0.4000204f, -0.7964195f, -0.4535412f, 6.2500000f, 29},
-{0.4142881f, -0.8354472f, 0.3611002f, 6.0200000f, 39},
-{0.3762692f, -0.7498660f, -0.5441714f, 6.3800000f, 41},
-{0.3768914f, -0.7651436f, 0.5220231f, 6.4600000f, 48},
-{0.3442386f, -0.6886666f, -0.6381521f, 5.9000000f, 51},
-{0.1253212f, -0.2627955f, 0.9566782f, 6.4000000f, 32},
-{0.2837414f, -0.5652626f, -0.7745767f, 5.2800000f, 27},
-{0.2379250f, -0.4721457f, -0.8488051f, 6.1000000f, 14},
-{0.3435272f, -0.6885825f, -0.6386261f, 6.3500000f, 48},
-{0.2866840f, -0.5716637f, -0.7687736f, 5.7800000f, 23},
-{0.1399306f, -0.2928553f, 0.9458621f, 6.6600000f, 27},
-{0.2220431f, -0.4422203f, -0.8689868f, 6.4100000f, 12},
-{0.3300808f, -0.6674033f, -0.6675474f, 3.8500000f, 22},
-{0.3814295f, -0.7841295f, 0.4895431f, 5.3500000f, 20},
-{0.1849244f, -0.3689235f, -0.9108778f, 5.1600000f, 20},
-{0.1811485f, -0.3799280f, 0.9071052f, 5.8200000f, 28},
-{0.3829677f, -0.7892898f, 0.4799556f, 6.4900000f, 40},
-{0.4165229f, -0.8565424f, 0.3047027f, 6.5500000f, 29},
-{0.3590446f, -0.7308687f, -0.5804464f, 6.1900000f, 50},
-{0.4000662f, -0.8251710f, 0.3987980f, 5.9700000f, 41},
-{0.3997799f, -0.8259724f, 0.3974237f, 3.4400000f, 30},
-{0.3936136f, -0.8133079f, 0.4284840f, 5.8400000f, 52},
-{0.3178970f, -0.6597797f, 0.6809055f, 3.4500000f, 22},
-{0.4300268f, -0.8831685f, -0.1873242f, 6.0800000f, 50},
-{0.4232616f, -0.8743738f, 0.2373186f, 5.4100000f, 61},
-{0.3225549f, -0.6578716f, -0.6805610f, 5.6000000f, 54},
-{0.1532393f, -0.3064682f, -0.9394652f, 3.3200000f, 18},
-{0.2653653f, -0.5397492f, -0.7989068f, 6.1600000f, 12},
-{0.3987141f, -0.8288677f, 0.3924352f, 5.8200000f, 38},
-{0.4108458f, -0.8494970f, -0.3309994f, 6.5700000f, 33},
-{0.3815613f, -0.8015043f, 0.4604365f, 6.5200000f, 20},
-{0.4278358f, -0.8932622f, -0.1379824f, 5.2400000f, 32},
-{0.2315667f, -0.4750538f, -0.8489409f, 6.2200000f, 25},
-{0.2922640f, -0.6195715f, 0.7285005f, 6.4300000f, 51},
-{0.2754310f, -0.5689326f, -0.7748893f, 6.3000000f, 64},
-{0.2820562f, -0.6010784f, 0.7477627f, 6.0000000f, 50},
-{0.1516738f, -0.3292201f, 0.9319921f, 5.9600000f, 27},
-{0.3874631f, -0.8216476f, 0.4180521f, 6.4000000f, 50},
-{0.3831162f, -0.8043636f, -0.4541158f, 5.3400000f, 20},
-{0.2126625f, -0.4413049f, -0.8717939f, 3.4000000f, 53},
-{0.2491482f, -0.5358049f, 0.8067455f, 6.4500000f, 39},
-{0.2459094f, -0.5304936f, 0.8112368f, 6.0000000f, 53},
-{0.3497815f, -0.7385501f, -0.5763650f, 6.3000000f, 52},
-{0.3994370f, -0.8540159f, 0.3333270f, 4.7900000f, 36},
-{0.4169636f, -0.8868962f, -0.1988881f, 6.0000000f, 29},
-{0.3267715f, -0.6887220f, -0.6472112f, 5.9600000f, 19},
-{0.3976346f, -0.8524549f, 0.3394221f, 2.6100000f, 51},
-{0.3976188f, -0.8524696f, 0.3394038f, 3.8000000f, 47},
-{0.4229021f, -0.9021503f, -0.0853155f, 6.3700000f, 50},
-{0.4175219f, -0.8952767f, -0.1554192f, 6.3200000f, 31},
-{0.2400386f, -0.5068132f, -0.8279625f, 5.8100000f, 36},
-{0.0384500f, -0.0924744f, 0.9949724f, 5.5000000f, 30},
-{0.2434591f, -0.5198082f, -0.8188572f, 4.5700000f, 53},
-{0.4181935f, -0.9074789f, 0.0399526f, 6.6600000f, 12},
-{0.1913666f, -0.4061227f, -0.8935565f, 5.6700000f, 21},
-{0.2912144f, -0.6264967f, -0.7229772f, 5.6500000f, 55},
-{0.3113583f, -0.6845983f, 0.6590760f, 5.7600000f, 37},
-{0.4019161f, -0.8731258f, -0.2758890f, 6.5100000f, 33},
-{0.3096129f, -0.6819708f, 0.6626128f, 3.0500000f, 60},
-{0.4012287f, -0.8787727f, 0.2584069f, 6.1200000f, 21},
-{0.3856235f, -0.8410947f, -0.3792812f, 6.5000000f, 23},
-{0.1680249f, -0.3779742f, 0.9104412f, 4.9700000f, 20},
-{0.3873904f, -0.8461339f, -0.3660411f, 6.5100000f, 20},
-{0.2345645f, -0.5083042f, -0.8286171f, 4.5000000f, 13},
-{0.3405228f, -0.7568583f, 0.5578618f, 5.9000000f, 26},
-{0.3932866f, -0.8651386f, -0.3112248f, 6.1300000f, 21},
-{0.4080177f, -0.9058362f, 0.1139402f, 6.0700000f, 53},
-{0.3546508f, -0.7937297f, 0.4941821f, 6.3900000f, 48},
-{0.4077287f, -0.9076965f, 0.0992184f, 6.5400000f, 36},
-{0.3150504f, -0.6939345f, -0.6474551f, 4.8300000f, 51},
-{0.3378376f, -0.7600747f, 0.5551146f, 5.5000000f, 51},
-{0.4080014f, -0.9104106f, -0.0684651f, 5.9700000f, 19},
-{0.3555194f, -0.7912357f, -0.4975460f, 6.2700000f, 30},
-{0.0489994f, -0.1198849f, 0.9915779f, 5.2600000f, 32},
-{0.4055196f, -0.9131520f, 0.0413186f, 6.3200000f, 49},
-{0.3221632f, -0.7192643f, -0.6155239f, 5.3300000f, 28},
-{0.3123618f, -0.6988934f, -0.6434113f, 6.2700000f, 48},
-{0.3970220f, -0.9050135f, 0.1527223f, 5.6100000f, 63},
-{0.1729912f, -0.3838846f, -0.9070318f, 4.9900000f, 18},
-{0.3316520f, -0.7619744f, 0.5562392f, 4.7400000f, 30},
-{0.2275104f, -0.5100880f, -0.8294873f, 6.3500000f, 54},
-{0.3968664f, -0.9098879f, -0.1208347f, 5.5700000f, 55},
-{0.3006333f, -0.6855661f, -0.6630375f, 6.1800000f, 48},
-{0.3845181f, -0.8852817f, -0.2615762f, 3.8100000f, 54},
-{0.2168698f, -0.4928158f, -0.8426743f, 5.9500000f, 32},
-{0.2937853f, -0.6876611f, 0.6639371f, 6.0200000f, 22},
-{0.3723811f, -0.8668274f, 0.3315757f, 6.1500000f, 50},
-{0.2572812f, -0.6065826f, 0.7522392f, 6.4400000f, 39},
-{0.2992681f, -0.6895719f, -0.6594916f, 6.1300000f, 51},
-{0.3136249f, -0.7378095f, 0.5977262f, 4.2100000f, 49},
-{0.3864579f, -0.9065860f, 0.1695645f, 6.0400000f, 20},
-{0.1118929f, -0.2524858f, -0.9611092f, 4.0000000f, 32},
-{0.2735411f, -0.6492082f, 0.7097210f, 6.3500000f, 50},
-{0.3380802f, -0.7883409f, -0.5140237f, 4.2500000f, 54},
-{0.1245885f, -0.2822742f, -0.9512092f, 6.1900000f, 22},
-{0.1580874f, -0.3812098f, 0.9108718f, 6.3200000f, 52},
-{0.2373292f, -0.5511826f, -0.7999204f, 5.5800000f, 53},
-{0.1654334f, -0.4015869f, 0.9007551f, 6.1200000f, 27},
-{0.3874828f, -0.9210350f, -0.0393906f, 6.0500000f, 21},
-{0.2177676f, -0.5093578f, -0.8325454f, 4.6600000f, 29},
-{0.2583394f, -0.6088434f, -0.7500469f, 6.1000000f, 54},
-{0.2126874f, -0.5174703f, 0.8288478f, 4.8400000f, 38},
-{0.2973802f, -0.7188854f, 0.6283063f, 5.7700000f, 24},
-{0.2115793f, -0.4977147f, -0.8411387f, 3.8200000f, 32},
-{0.1704801f, -0.3988247f, -0.9010413f, 6.0100000f, 22},
-{0.3846922f, -0.9227826f, -0.0220039f, 5.2100000f, 19},
-{0.3386612f, -0.8124153f, -0.4746473f, 5.5800000f, 55},
-{0.3348623f, -0.8043560f, -0.4907939f, 5.5600000f, 19},
-{0.3814838f, -0.9243087f, 0.0111165f, 5.0900000f, 16},
-{0.1707858f, -0.4066641f, -0.8974723f, 5.2900000f, 60},
-{0.0591630f, -0.1541818f, 0.9862696f, 6.5200000f, 44},
-{0.3764034f, -0.9198042f, -0.1108185f, 6.2000000f, 55},
-{0.3698122f, -0.9039039f, -0.2149342f, 5.5800000f, 19},
-{0.3168524f, -0.7828274f, 0.5355238f, 5.9000000f, 20},
-{0.3422391f, -0.8350533f, -0.4307649f, 6.5100000f, 37},
-{0.0893498f, -0.2300350f, 0.9690720f, 4.8400000f, 48},
-{0.3624894f, -0.8994141f, 0.2442450f, 5.4600000f, 61},
-{0.1863134f, -0.4534522f, -0.8715896f, 6.4300000f, 62},
-{0.1613913f, -0.3903313f, -0.9064184f, 6.1900000f, 14},
-{0.3321642f, -0.8201770f, -0.4658076f, 6.0500000f, 37},
-{0.2186761f, -0.5532058f, 0.8038309f, 6.4500000f, 21},
-{0.2813717f, -0.7073403f, 0.6484595f, 4.7500000f, 27},
-{0.3664328f, -0.9162827f, 0.1617186f, 3.8500000f, 11},
-{0.2307373f, -0.5665584f, -0.7910575f, 4.8900000f, 36},
-{0.2653142f, -0.6563322f, -0.7062835f, 5.7400000f, 16},
-{0.2653700f, -0.6563465f, -0.7062492f, 6.0900000f, 18},
-{0.3018744f, -0.7616224f, 0.5734136f, 5.5800000f, 22},
-{0.1303800f, -0.3160711f, -0.9397341f, 4.7400000f, 21},
-{0.2706171f, -0.6745415f, -0.6868479f, 5.9100000f, 46},
-{0.1854717f, -0.4591932f, -0.8687588f, 3.3200000f, 14},
-{0.1966012f, -0.5066169f, 0.8394566f, 5.1600000f, 31},
-{0.1120664f, -0.2740404f, -0.9551665f, 4.9300000f, 54},
-{0.2528781f, -0.6334291f, -0.7313140f, 5.0200000f, 54},
-{0.2004621f, -0.5011488f, -0.8418223f, 6.0000000f, 22},
-{0.3391439f, -0.8611323f, -0.3787249f, 5.0800000f, 54},
-{0.3605793f, -0.9248382f, 0.1210657f, 5.0800000f, 48},
-{0.1964973f, -0.4951696f, -0.8462836f, 6.1400000f, 17},
-{0.3581678f, -0.9214634f, 0.1504029f, 5.6700000f, 22},
-{0.3342034f, -0.8589772f, -0.3878999f, 6.1000000f, 37},
-{0.2875482f, -0.7525873f, 0.5923921f, 6.2800000f, 33},
-{0.1882456f, -0.4792071f, -0.8572771f, 6.2300000f, 52},
-{0.3432778f, -0.8901840f, -0.2995543f, 6.4900000f, 27},
-{0.2832090f, -0.7302982f, -0.6216568f, 5.3800000f, 30},
-{0.2673941f, -0.6891600f, -0.6734678f, 6.0800000f, 48},
-{0.3523731f, -0.9214467f, -0.1636129f, 6.5700000f, 30},
-{0.3439810f, -0.8993643f, -0.2698536f, 6.0300000f, 61},
-{0.3236450f, -0.8439679f, -0.4277523f, 6.2900000f, 35},
-{0.3486790f, -0.9147763f, -0.2039787f, 5.7000000f, 37},
-{0.1990244f, -0.5157057f, -0.8333288f, 4.4500000f, 53},
-{0.3478589f, -0.9205008f, -0.1779674f, 6.5200000f, 30},
-{0.0646463f, -0.1597041f, -0.9850459f, 7.0700000f, 15},
-{0.3159921f, -0.8365617f, -0.4475640f, 4.8900000f, 62},
-{0.3435333f, -0.9133908f, -0.2184082f, 4.8200000f, 35},
-{0.1868701f, -0.4889697f, -0.8520494f, 5.0800000f, 51},
-{0.2048296f, -0.5559244f, 0.8056010f, 5.5200000f, 53},
-{0.2945724f, -0.7954793f, 0.5295656f, 4.7100000f, 42},
-{0.2372755f, -0.6287747f, -0.7405017f, 3.8400000f, 34},
-{0.2726692f, -0.7403621f, 0.6144229f, 5.8500000f, 39},
-{0.1905899f, -0.5060279f, -0.8411963f, 5.4500000f, 20},
-{0.0891624f, -0.2305107f, -0.9689762f, 6.3000000f, 52},
-{0.3357759f, -0.9050895f, -0.2608977f, 4.9100000f, 48},
-{0.3397422f, -0.9189354f, -0.2003323f, 6.0400000f, 20},
-{0.1919556f, -0.5136933f, -0.8362250f, 5.9100000f, 13},
-{0.0786955f, -0.2035959f, -0.9758871f, 4.1100000f, 60},
-{0.2607365f, -0.7052248f, -0.6592984f, 6.1100000f, 20},
-{0.1229424f, -0.3462420f, 0.9300546f, 5.7500000f, 53},
-{0.1797367f, -0.4855766f, -0.8555174f, 4.6600000f, 54},
-{0.1373751f, -0.3876308f, 0.9115209f, 5.1200000f, 52},
-{0.1876027f, -0.5084510f, -0.8404064f, 5.9200000f, 61},
-{0.2007680f, -0.5464562f, -0.8130669f, 4.2800000f, 42},
-{0.1176411f, -0.3371952f, 0.9340557f, 5.0000000f, 53},
-{0.3362564f, -0.9417597f, -0.0045088f, 6.2600000f, 51},
-{0.2797660f, -0.7777186f, -0.5629251f, 6.3700000f, 48},
-{0.2833568f, -0.8022694f, 0.5254263f, 6.0200000f, 64},
-{0.1447601f, -0.3987444f, -0.9055647f, 5.5200000f, 19},
-{0.0979439f, -0.2664789f, -0.9588514f, 6.0700000f, 53},
-{0.1769888f, -0.5119922f, 0.8405587f, 5.8000000f, 20},
-{0.1768172f, -0.4944658f, -0.8510225f, 6.4200000f, 30},
-{0.2953872f, -0.8462150f, 0.4434710f, 5.5100000f, 24},
-{0.3243827f, -0.9226977f, -0.2083385f, 6.2400000f, 52},
-{0.2266130f, -0.6539426f, 0.7218072f, 5.1800000f, 35},
-{0.3014785f, -0.8683708f, 0.3937547f, 5.0800000f, 23},
-{0.3271290f, -0.9413479f, 0.0827696f, 5.7900000f, 53},
-{0.2827399f, -0.8064759f, -0.5192830f, 5.6400000f, 20},
-{0.1233629f, -0.3637629f, 0.9232866f, 6.0000000f, 35},
-{0.1483408f, -0.4202609f, -0.8951960f, 4.8200000f, 14},
-{0.3054619f, -0.8901740f, 0.3380582f, 6.2700000f, 25},
-{0.1715567f, -0.4890452f, -0.8552211f, 5.3800000f, 12},
-{0.1466428f, -0.4196655f, -0.8957549f, 2.7600000f, 10},
-{0.1665399f, -0.4804976f, -0.8610380f, 4.5700000f, 54},
-{0.3204897f, -0.9462568f, 0.0434111f, 6.2800000f, 54},
-{0.1702768f, -0.5116847f, 0.8421310f, 6.3400000f, 61},
-{0.2733657f, -0.8154076f, 0.5102761f, 5.2400000f, 21},
-{0.1442570f, -0.4180835f, -0.8968813f, 5.7700000f, 12},
-{0.1524274f, -0.4434039f, -0.8832660f, 4.8200000f, 15},
-{0.0682889f, -0.1924549f, -0.9789268f, 5.9700000f, 14},
-{0.3149531f, -0.9425939f, 0.1110016f, 6.3700000f, 51},
-{0.2986137f, -0.8977747f, 0.3237752f, 5.4900000f, 53},
-{0.3059247f, -0.9199338f, 0.2452181f, 5.4800000f, 44},
-{0.1687015f, -0.4974065f, -0.8509563f, 6.2100000f, 30},
-{0.1154551f, -0.3368489f, -0.9344533f, 6.2600000f, 25},
-{0.1151175f, -0.3368782f, -0.9344844f, 6.4600000f, 26},
-{0.1024252f, -0.2993371f, -0.9486339f, 6.2700000f, 36},
-{0.3004793f, -0.9094527f, -0.2874162f, 5.4200000f, 23},
-{0.1284945f, -0.4004135f, 0.9072807f, 6.3900000f, 21},
-{0.2078114f, -0.6280877f, -0.7498802f, 2.6900000f, 45},
-{0.1609471f, -0.4829805f, -0.8607124f, 6.2500000f, 20},
-{0.3003212f, -0.9192865f, -0.2544003f, 6.6700000f, 20},
-{0.1411469f, -0.4235318f, -0.8948175f, 5.3400000f, 16},
-{0.1394998f, -0.4199330f, -0.8967698f, 5.2300000f, 17},
-{0.1786332f, -0.5413913f, -0.8215751f, 5.2300000f, 18},
-{0.1394321f, -0.4219330f, -0.8958411f, 4.8500000f, 13},
-{0.2657295f, -0.8295571f, 0.4911445f, 6.1500000f, 51},
-{0.3062076f, -0.9519645f, -0.0007175f, 5.9300000f, 62},
-{0.2659242f, -0.8213153f, -0.5047034f, 5.8800000f, 21},
-{0.1712252f, -0.5242126f, -0.8341961f, 6.3600000f, 61},
-{0.2986665f, -0.9366455f, 0.1830125f, 5.3400000f, 22},
-{0.1631867f, -0.5029089f, -0.8487949f, 6.0000000f, 20},
-{0.3029350f, -0.9504856f, -0.0693357f, 6.6100000f, 22},
-{0.2659576f, -0.8421643f, 0.4690691f, 6.0400000f, 33},
-{0.0582142f, -0.1721388f, -0.9833511f, 5.4700000f, 50},
-{0.2908365f, -0.9171800f, -0.2723875f, 3.1100000f, 52},
-{0.2988034f, -0.9437334f, -0.1417171f, 5.8600000f, 48},
-{0.0582100f, -0.1734179f, -0.9831266f, 4.4500000f, 12},
-{0.1628926f, -0.5260991f, 0.8346770f, 5.6700000f, 52},
-{0.1504681f, -0.4875521f, 0.8600304f, 5.5800000f, 52},
-{0.2971526f, -0.9467912f, -0.1236400f, 5.7900000f, 23},
-{0.2496393f, -0.7911527f, -0.5583526f, 5.6100000f, 21},
-{0.1576222f, -0.4954001f, -0.8542447f, 5.9100000f, 19},
-{0.2957853f, -0.9539068f, -0.0507237f, 5.9500000f, 52},
-{0.1764178f, -0.5816933f, 0.7940464f, 6.6500000f, 48},
-{0.1766191f, -0.5825249f, 0.7933917f, 6.4400000f, 52},
-{0.0985227f, -0.3300231f, 0.9388174f, 5.9300000f, 49},
-{0.2913721f, -0.9564424f, 0.0178935f, 6.3800000f, 23},
-{0.2898584f, -0.9570631f, 0.0035149f, 6.3100000f, 55},
-{0.1656154f, -0.5553246f, 0.8149761f, 5.1000000f, 53},
-{0.2372421f, -0.7921711f, 0.5622999f, 3.8300000f, 50},
-{0.2071383f, -0.6990445f, 0.6844199f, 4.7100000f, 21},
-{0.2863290f, -0.9576475f, -0.0304464f, 6.1200000f, 50},
-{0.1590868f, -0.5245624f, -0.8363765f, 5.2500000f, 19},
-{0.2691213f, -0.9011934f, -0.3397413f, 5.2400000f, 36},
-{0.2767295f, -0.9275070f, -0.2512999f, 6.3800000f, 53},
-{0.2849997f, -0.9579715f, -0.0326464f, 5.4500000f, 48},
-{0.2537104f, -0.8662653f, 0.4303667f, 6.2000000f, 28},
-{0.2763439f, -0.9373756f, -0.2120403f, 5.6600000f, 44},
-{0.2319980f, -0.7955616f, 0.5596952f, 5.7200000f, 47},
-{0.1552251f, -0.5198086f, -0.8400620f, 3.7800000f, 51},
-{0.2307408f, -0.8012569f, 0.5520381f, 5.0300000f, 51},
-{0.2517912f, -0.8725416f, 0.4186553f, 4.5000000f, 21},
-{0.2517612f, -0.8725566f, 0.4186421f, 6.3000000f, 22},
-{0.2632821f, -0.9061244f, -0.3310909f, 6.4400000f, 50},
-{0.1009303f, -0.3391042f, -0.9353189f, 5.9900000f, 16},
-{0.2087200f, -0.7162799f, -0.6658672f, 6.1100000f, 20},
-{0.2040584f, -0.7144787f, 0.6692387f, 6.0300000f, 52},
-{0.2768446f, -0.9608286f, 0.0128618f, 5.9100000f, 32},
-{0.1402360f, -0.4771986f, -0.8675341f, 5.9300000f, 54},
-{0.2739285f, -0.9556958f, 0.1077439f, 5.8100000f, 65},
-{0.0582034f, -0.1917454f, -0.9797173f, 6.3300000f, 52},
-{0.2538351f, -0.8893520f, 0.3802903f, 6.1400000f, 52},
-{0.2466150f, -0.8682403f, 0.4305111f, 6.3500000f, 50},
-{0.1414854f, -0.4876841f, -0.8614790f, 5.9200000f, 50},
-{0.0548749f, -0.2046056f, 0.9773051f, 6.2000000f, 49},
-{0.2181204f, -0.7697741f, -0.5998928f, 4.6000000f, 51},
-{0.1768782f, -0.6285446f, -0.7573941f, 5.9100000f, 24},
-{0.1615885f, -0.5957548f, 0.7867435f, 6.1700000f, 50},
-{0.1409804f, -0.5066988f, -0.8505180f, 6.1100000f, 43},
-{0.1987224f, -0.7347981f, 0.6485222f, 5.0500000f, 41},
-{0.2106852f, -0.7801121f, 0.5890984f, 6.0000000f, 62},
-{0.0704239f, -0.2508000f, -0.9654739f, 6.1300000f, 51},
-{0.1806010f, -0.6769058f, 0.7135698f, 5.4700000f, 55},
-{0.2547359f, -0.9454874f, 0.2028870f, 6.5500000f, 35},
-{0.2215967f, -0.8160571f, -0.5338031f, 5.7100000f, 32},
-{0.1599921f, -0.6015762f, 0.7826293f, 6.4300000f, 49},
-{0.2511965f, -0.9296047f, -0.2696949f, 5.8900000f, 62},
-{0.1885010f, -0.7077346f, 0.6808665f, 6.0200000f, 39},
-{0.1137339f, -0.4327330f, 0.8943192f, 6.3900000f, 22},
-{0.2474687f, -0.9199521f, -0.3040515f, 4.0800000f, 50},
-{0.1977911f, -0.7491386f, 0.6321946f, 5.0800000f, 30},
-{0.2504308f, -0.9377842f, -0.2405104f, 5.8800000f, 55},
-{0.1283230f, -0.4725786f, -0.8718960f, 6.1600000f, 18},
-{0.2559471f, -0.9646295f, 0.0630953f, 4.8400000f, 51},
-{0.1917875f, -0.7156357f, -0.6716272f, 5.8100000f, 18},
-{0.1925339f, -0.7204951f, -0.6661963f, 4.3900000f, 23},
-{0.2542225f, -0.9612876f, 0.1062882f, 4.9900000f, 25},
-{0.1389921f, -0.5359151f, 0.8327522f, 2.3700000f, 21},
-{0.1653474f, -0.6186323f, -0.7680849f, 6.1500000f, 23},
-{0.2470057f, -0.9374180f, -0.2454296f, 6.3400000f, 50},
-{0.2213014f, -0.8358199f, -0.5024248f, 6.0700000f, 38},
-{0.2510173f, -0.9676213f, -0.0264435f, 4.7400000f, 60},
-{0.2337018f, -0.9090555f, 0.3449660f, 4.4200000f, 21},
-{0.1150476f, -0.4591116f, 0.8808976f, 1.7900000f, 50},
-{0.2250538f, -0.8766326f, -0.4252835f, 6.2300000f, 31},
-{0.2451029f, -0.9694081f, 0.0131332f, 6.1400000f, 30},
-{0.0435164f, -0.1602085f, -0.9861235f, 6.7100000f, 37},
-{0.2408441f, -0.9526516f, -0.1856047f, 5.5000000f, 47},
-{0.2435727f, -0.9698826f, 0.0000145f, 5.9500000f, 53},
-{0.2121083f, -0.8392960f, -0.5005919f, 6.4600000f, 61},
-{0.2377455f, -0.9466500f, -0.2175565f, 6.3400000f, 45},
-{0.1882783f, -0.7625091f, 0.6189759f, 6.0000000f, 23},
-{0.2356702f, -0.9634080f, 0.1276897f, 4.6300000f, 32},
-{0.1655551f, -0.6704825f, -0.7232183f, 5.6700000f, 28},
-{0.0300930f, -0.1108179f, -0.9933850f, 6.1900000f, 21},
-{0.1969353f, -0.8033402f, -0.5620152f, 5.4300000f, 22},
-{0.2110739f, -0.8680269f, -0.4494186f, 4.9400000f, 33},
-{0.2310300f, -0.9543563f, -0.1892859f, 6.0900000f, 30},
-{0.1569650f, -0.6423126f, -0.7501976f, 6.1300000f, 19},
-{0.2086826f, -0.8685578f, -0.4495096f, 5.7100000f, 20},
-{0.1473245f, -0.6147929f, -0.7748066f, 6.3000000f, 48},
-{0.2294772f, -0.9727157f, 0.0341243f, 5.5200000f, 49},
-{0.2050623f, -0.8648613f, -0.4582187f, 6.7700000f, 21},
-{0.1517503f, -0.6376805f, -0.7552055f, 6.3200000f, 52},
-{0.2078894f, -0.8944418f, 0.3959240f, 6.4600000f, 25},
-{0.1249130f, -0.5252277f, -0.8417438f, 6.0200000f, 52},
-{0.1951000f, -0.8308349f, -0.5212000f, 6.5900000f, 31},
-{0.1100280f, -0.4631039f, -0.8794479f, 4.6100000f, 48},
-{0.1046269f, -0.4392062f, -0.8922730f, 6.4100000f, 23},
-{0.1711458f, -0.7307833f, -0.6608062f, 5.1500000f, 20},
-{0.1954996f, -0.8452314f, -0.4973568f, 6.5400000f, 42},
-{0.0819372f, -0.3468330f, -0.9343410f, 5.5700000f, 12},
-{0.0843906f, -0.3780455f, 0.9219326f, 6.0600000f, 30},
-{0.1975814f, -0.8603279f, -0.4698910f, 6.4900000f, 21},
-{0.2012750f, -0.8862434f, 0.4172063f, 5.6800000f, 23},
-{0.1767529f, -0.7862070f, 0.5921460f, 5.7400000f, 63},
-{0.1960187f, -0.8615902f, -0.4682297f, 5.4400000f, 21},
-{0.1554021f, -0.6961326f, 0.7008920f, 3.0100000f, 51},
-{0.1588707f, -0.7113541f, 0.6846425f, 5.8900000f, 62},
-{0.1210691f, -0.5306368f, -0.8389081f, 3.9100000f, 44},
-{0.1110930f, -0.4866837f, -0.8664856f, 5.1300000f, 19},
-{0.1846820f, -0.8311587f, -0.5244689f, 5.8100000f, 22},
-{0.0766796f, -0.3621733f, 0.9289514f, 6.4000000f, 23},
-{0.2025024f, -0.9471767f, 0.2486946f, 6.3000000f, 25},
-{0.1140654f, -0.5243785f, -0.8438106f, 6.8800000f, 17},
-{0.1952345f, -0.9118196f, -0.3612042f, 4.4800000f, 22},
-{0.1177466f, -0.5629055f, 0.8180912f, 6.6300000f, 24},
-{0.1667429f, -0.7935968f, 0.5851503f, 6.4100000f, 40},
-{0.1762513f, -0.8336078f, -0.5234820f, 6.3800000f, 61},
-{0.1962261f, -0.9333120f, -0.3007058f, 6.1300000f, 20},
-{0.1927502f, -0.9181726f, -0.3461307f, 6.4000000f, 50},
-{0.0699065f, -0.3253343f, -0.9430115f, 6.3500000f, 52},
-{0.1351308f, -0.6433515f, -0.7535506f, 5.3600000f, 23},
-{0.1513257f, -0.7383463f, 0.6572254f, 6.3300000f, 52},
-{0.1036590f, -0.4940335f, -0.8632414f, 4.6000000f, 26},
-{0.1357121f, -0.6517243f, -0.7462155f, 6.1100000f, 48},
-{0.1466459f, -0.7088269f, -0.6899706f, 5.8000000f, 55},
-{0.0902771f, -0.4316931f, -0.8974916f, 5.2300000f, 18},
-{0.2003939f, -0.9797147f, 0.0012169f, 5.4200000f, 20},
-{0.1862798f, -0.9178149f, 0.3505933f, 2.5600000f, 24},
-{0.1972713f, -0.9702693f, 0.1402196f, 5.7900000f, 53},
-{0.1911932f, -0.9448078f, 0.2660515f, 3.3400000f, 22},
-{0.1215178f, -0.5927107f, -0.7961956f, 5.7600000f, 52},
-{0.1056143f, -0.5135268f, -0.8515491f, 5.7400000f, 11},
-{0.1786537f, -0.9023361f, 0.3922658f, 4.6300000f, 63},
-{0.1152617f, -0.5938921f, 0.7962455f, 6.5000000f, 36},
-{0.1446898f, -0.7257497f, -0.6725713f, 6.2100000f, 54},
-{0.1862482f, -0.9551597f, 0.2301771f, 5.3200000f, 53},
-{0.1861873f, -0.9570333f, 0.2223096f, 6.6700000f, 29},
-{0.1220363f, -0.6381982f, 0.7601383f, 5.8800000f, 50},
-{0.1878163f, -0.9813491f, -0.0409747f, 4.4700000f, 27},
-{0.1853143f, -0.9753819f, -0.1195352f, 6.1400000f, 28},
-{0.1355588f, -0.7049683f, -0.6961634f, 6.3100000f, 33},
-{0.1851667f, -0.9820807f, 0.0350836f, 5.1800000f, 60},
-{0.1463474f, -0.7744598f, -0.6154628f, 6.2700000f, 23},
-{0.1536222f, -0.8219308f, -0.5484797f, 6.4500000f, 34},
-{0.1546685f, -0.8382239f, 0.5229325f, 4.8700000f, 40},
-{0.1546624f, -0.8382250f, 0.5229325f, 4.4100000f, 40},
-{0.1494143f, -0.8006421f, -0.5802134f, 6.6800000f, 48},
-{0.1509527f, -0.8240626f, 0.5460167f, 3.4800000f, 53},
-{0.1767943f, -0.9620940f, 0.2076509f, 6.6600000f, 22},
-{0.0747928f, -0.3969374f, -0.9147933f, 6.0600000f, 62},
-{0.1394215f, -0.7735488f, 0.6182103f, 4.7800000f, 21},
-{0.1782274f, -0.9835677f, 0.0288036f, 5.9100000f, 50},
-{0.1717986f, -0.9582145f, -0.2287143f, 3.5600000f, 48},
-{0.0660693f, -0.3834649f, 0.9211892f, 6.2100000f, 48},
-{0.0790988f, -0.4404396f, -0.8942910f, 5.9900000f, 36},
-{0.0363611f, -0.1989554f, -0.9793338f, 6.3500000f, 28},
-{0.1678282f, -0.9802043f, 0.1050395f, 4.0500000f, 19},
-{0.0458038f, -0.2571735f, -0.9652791f, 6.2700000f, 19},
-{0.0901272f, -0.5360164f, 0.8393828f, 6.4300000f, 27},
-{0.0592798f, -0.3367512f, -0.9397258f, 6.4100000f, 14},
-{0.1006948f, -0.5861112f, -0.8039491f, 3.8900000f, 15},
-{0.0699007f, -0.4275014f, 0.9013082f, 6.0200000f, 21},
-{0.1171734f, -0.7160576f, 0.6881365f, 4.9900000f, 47},
-{0.1188052f, -0.7173526f, -0.6865061f, 6.1200000f, 48},
-{0.1594500f, -0.9872033f, 0.0022980f, 6.0500000f, 53},
-{0.1520357f, -0.9429977f, -0.2960415f, 5.0900000f, 35},
-{0.1295755f, -0.8002814f, -0.5854569f, 5.0000000f, 56},
-{0.0388819f, -0.2320485f, -0.9719268f, 6.4300000f, 25},
-{0.0913590f, -0.5630553f, -0.8213539f, 5.7900000f, 24},
-{0.1541182f, -0.9710073f, 0.1827360f, 3.9400000f, 34},
-{0.1562221f, -0.9874164f, 0.0245679f, 5.3900000f, 48},
-{0.0721537f, -0.4475111f, -0.8913628f, 5.1100000f, 15},
-{0.1518520f, -0.9755539f, -0.1588569f, 4.8300000f, 55},
-{0.1162759f, -0.7418517f, -0.6604059f, 6.1200000f, 12},
-{0.1491838f, -0.9687470f, 0.1981753f, 5.8000000f, 54},
-{0.1464866f, -0.9484811f, -0.2809366f, 4.0800000f, 25},
-{0.0487571f, -0.3094568f, -0.9496627f, 5.5900000f, 12},
-{0.0830904f, -0.5551699f, 0.8275762f, 5.7500000f, 50},
-{0.1433821f, -0.9482568f, 0.2832854f, 5.5700000f, 32},
-{0.1214575f, -0.8005016f, -0.5868946f, 5.2200000f, 50},
-{0.1481917f, -0.9866648f, 0.0673188f, 6.3700000f, 33},
-{0.1207567f, -0.7973291f, -0.5913409f, 5.8900000f, 63},
-{0.1217961f, -0.8254244f, 0.5512172f, 6.3200000f, 37},
-{0.0698970f, -0.4638148f, -0.8831705f, 5.1700000f, 37},
-{0.1443507f, -0.9881295f, 0.0525635f, 6.5000000f, 50},
-{0.0706838f, -0.4814069f, -0.8736425f, 5.3000000f, 13},
-{0.1398703f, -0.9693841f, -0.2018187f, 5.9400000f, 34},
-{0.0872278f, -0.5977116f, -0.7969518f, 5.8100000f, 50},
-{0.1392735f, -0.9889995f, 0.0498279f, 4.9500000f, 47},
-{0.1396249f, -0.9901906f, -0.0052360f, 6.2500000f, 52},
-{0.1145487f, -0.8144119f, -0.5688689f, 6.4500000f, 55},
-{0.0636121f, -0.4685859f, 0.8811247f, 5.8300000f, 35},
-{0.1040639f, -0.7663989f, 0.6338797f, 5.3100000f, 22},
-{0.1026158f, -0.7439225f, -0.6603403f, 5.0800000f, 19},
-{0.0722429f, -0.5436971f, 0.8361665f, 6.2800000f, 24},
-{0.0436860f, -0.3138559f, -0.9484651f, 6.0900000f, 13},
-{0.1270896f, -0.9556197f, 0.2657805f, 5.7400000f, 54},
-{0.0755113f, -0.5777531f, 0.8127111f, 6.4100000f, 50},
-{0.1210815f, -0.9087740f, -0.3993359f, 5.7600000f, 20},
-{0.0189041f, -0.1530781f, 0.9880333f, 6.1500000f, 22},
-{0.0883504f, -0.6806479f, 0.7272638f, 6.3500000f, 52},
-{0.0935555f, -0.7232614f, 0.6842078f, 5.9400000f, 34},
-{0.1289868f, -0.9902676f, -0.0522730f, 4.7700000f, 53},
-{0.1218620f, -0.9409642f, 0.3158100f, 5.5200000f, 50},
-{0.0439278f, -0.3502227f, 0.9356358f, 3.8400000f, 60},
-{0.0849027f, -0.6646480f, 0.7423170f, 6.4200000f, 49},
-{0.0826591f, -0.6536258f, 0.7522904f, 6.5600000f, 49},
-{0.1191152f, -0.9613863f, 0.2480888f, 6.2000000f, 40},
-{0.0611887f, -0.4852097f, -0.8722543f, 6.3800000f, 23},
-{0.0582038f, -0.4800340f, 0.8753169f, 5.4800000f, 38},
-{0.1159193f, -0.9371000f, -0.3292512f, 6.2400000f, 37},
-{0.0640951f, -0.5176857f, -0.8531666f, 5.1300000f, 43},
-{0.0641278f, -0.5187857f, -0.8524957f, 5.1500000f, 22},
-{0.1058407f, -0.8704274f, -0.4807847f, 5.8100000f, 38},
-{0.1058258f, -0.8704104f, -0.4808187f, 5.6400000f, 38},
-{0.1087011f, -0.8978743f, -0.4266214f, 6.1600000f, 61},
-{0.1177534f, -0.9872047f, -0.1075222f, 5.9500000f, 54},
-{0.0912742f, -0.7654956f, -0.6369345f, 5.6400000f, 56},
-{0.0508251f, -0.4189489f, -0.9065862f, 5.9000000f, 51},
-{0.1012068f, -0.8519601f, -0.5137326f, 5.0400000f, 62},
-{0.1016379f, -0.8587881f, -0.5021481f, 3.5400000f, 47},
-{0.1121265f, -0.9560471f, -0.2709271f, 6.0500000f, 39},
-{0.0908410f, -0.7953981f, 0.5992410f, 6.4000000f, 50},
-{0.0887266f, -0.7674772f, -0.6349066f, 5.3900000f, 22},
-{0.1104052f, -0.9753195f, 0.1912135f, 6.5500000f, 22},
-{0.1114543f, -0.9923348f, 0.0533817f, 5.7700000f, 35},
-{0.1054331f, -0.9515114f, 0.2889807f, 5.9500000f, 14},
-{0.0625730f, -0.5732372f, 0.8169968f, 5.6300000f, 50},
-{0.0950381f, -0.8503535f, -0.5175583f, 5.9800000f, 50},
-{0.1017541f, -0.9314887f, 0.3492490f, 6.4500000f, 49},
-{0.0650072f, -0.5879260f, -0.8062984f, 4.6200000f, 19},
-{0.0368378f, -0.3511761f, 0.9355845f, 5.2000000f, 50},
-{0.0717711f, -0.6539306f, -0.7531425f, 5.5000000f, 51},
-{0.0741078f, -0.6827284f, -0.7269044f, 5.7100000f, 63},
-{0.1038176f, -0.9764183f, 0.1892859f, 6.5600000f, 24},
-{0.0913345f, -0.8800077f, 0.4660950f, 5.8000000f, 30},
-{0.0723595f, -0.6863422f, -0.7236702f, 5.2500000f, 27},
-{0.0479207f, -0.4517627f, -0.8908502f, 3.1300000f, 19},
-{0.1005321f, -0.9846630f, -0.1425905f, 4.7000000f, 19},
-{0.0860901f, -0.8396453f, -0.5362688f, 5.7400000f, 50},
-{0.0813762f, -0.7969825f, -0.5984955f, 6.3100000f, 21},
-{0.1004020f, -0.9948430f, 0.0143791f, 4.3000000f, 48},
-{0.0499764f, -0.4830281f, -0.8741775f, 5.8300000f, 12},
-{0.0857928f, -0.8527551f, -0.5152168f, 6.2900000f, 36},
-{0.0611340f, -0.6315312f, 0.7729366f, 6.1400000f, 49},
-{0.0489836f, -0.4866699f, -0.8722116f, 5.1500000f, 50},
-{0.0675815f, -0.6881676f, -0.7223975f, 5.4400000f, 52},
-{0.0682998f, -0.7206348f, 0.6899425f, 5.5900000f, 32},
-{0.0939949f, -0.9835213f, 0.1544374f, 6.1700000f, 51},
-{0.0271326f, -0.2725561f, -0.9617572f, 5.6500000f, 31},
-{0.0639101f, -0.6811205f, 0.7293767f, 6.1000000f, 35},
-{0.0399515f, -0.4310733f, 0.9014320f, 6.4600000f, 25},
-{0.0778672f, -0.8290255f, 0.5537630f, 6.2700000f, 52},
-{0.0929035f, -0.9855704f, 0.1414916f, 5.3600000f, 64},
-{0.0940660f, -0.9951918f, -0.0272916f, 6.2200000f, 49},
-{0.0387393f, -0.3987962f, -0.9162210f, 5.9600000f, 50},
-{0.0653504f, -0.7027330f, 0.7084459f, 6.4400000f, 40},
-{0.0474083f, -0.4951090f, -0.8675365f, 5.1500000f, 20},
-{0.0906336f, -0.9709359f, -0.2215154f, 5.4800000f, 37},
-{0.0840261f, -0.9147409f, -0.3952071f, 6.4200000f, 45},
-{0.0853633f, -0.9684872f, -0.2339780f, 6.2100000f, 21},
-{0.0847052f, -0.9604614f, -0.2652149f, 6.1900000f, 63},
-{0.0383318f, -0.4271838f, -0.9033519f, 5.1700000f, 42},
-{0.0451706f, -0.5284279f, 0.8477757f, 6.3700000f, 19},
-{0.0721073f, -0.8331210f, -0.5483703f, 4.7000000f, 19},
-{0.0779946f, -0.9280847f, 0.3641093f, 5.2600000f, 51},
-{0.0683079f, -0.8242386f, 0.5621074f, 5.3300000f, 48},
-{0.0517218f, -0.6130517f, -0.7883479f, 5.9600000f, 61},
-{0.0720294f, -0.8733109f, -0.4818089f, 6.4400000f, 40},
-{0.0392093f, -0.4692226f, -0.8822091f, 4.9400000f, 43},
-{0.0454876f, -0.5692932f, 0.8208752f, 6.2700000f, 55},
-{0.0683050f, -0.8476403f, 0.5261562f, 5.7300000f, 34},
-{0.0596053f, -0.7300642f, -0.6807741f, 5.5500000f, 20},
-{0.0678862f, -0.8499308f, -0.5225027f, 5.2200000f, 55},
-{0.0301646f, -0.3936701f, 0.9187568f, 5.3000000f, 53},
-{0.0722883f, -0.9229726f, 0.3780158f, 6.5900000f, 32},
-{0.0736252f, -0.9385512f, -0.3371957f, 6.2200000f, 50},
-{0.0102245f, -0.1231779f, -0.9923319f, 6.3300000f, 50},
-{0.0577540f, -0.7985439f, -0.5991595f, 5.9800000f, 53},
-{0.0145948f, -0.1955115f, -0.9805928f, 6.3900000f, 50},
-{0.0698096f, -0.9932376f, -0.0927664f, 6.0700000f, 48},
-{0.0342701f, -0.4757642f, -0.8789050f, 5.0300000f, 40},
-{0.0622417f, -0.9025471f, 0.4260688f, 6.0200000f, 55},
-{0.0339377f, -0.4817574f, -0.8756472f, 6.1000000f, 22},
-{0.0633066f, -0.9508257f, -0.3031877f, 4.7300000f, 48},
-{0.0634969f, -0.9875914f, 0.1436366f, 4.8500000f, 24},
-{0.0423676f, -0.6556094f, -0.7539107f, 6.2600000f, 51},
-{0.0612583f, -0.9916232f, 0.1137138f, 4.0300000f, 61},
-{0.0408775f, -0.6707419f, 0.7405636f, 3.7100000f, 50},
-{0.0445208f, -0.7141845f, -0.6985402f, 5.2900000f, 16},
-{0.0262544f, -0.4174960f, -0.9082994f, 3.6400000f, 27},
-{0.0321868f, -0.5636406f, 0.8253928f, 5.2700000f, 52},
-{0.0286729f, -0.4866856f, -0.8731065f, 4.1100000f, 45},
-{0.0453649f, -0.7702961f, -0.6360707f, 4.9100000f, 43},
-{0.0465280f, -0.8268202f, -0.5605386f, 6.1700000f, 48},
-{0.0482487f, -0.8671774f, -0.4956566f, 6.4800000f, 45},
-{0.0306833f, -0.5539429f, -0.8319891f, 5.4100000f, 55},
-{0.0491723f, -0.9370899f, 0.3456076f, 4.5300000f, 45},
-{0.0521614f, -0.9882862f, 0.1434207f, 5.3200000f, 21},
-{0.0499074f, -0.9844785f, -0.1682600f, 6.2600000f, 37},
-{0.0215288f, -0.4191328f, -0.9076697f, 4.7200000f, 54},
-{0.0479941f, -0.9678948f, 0.2467312f, 5.8800000f, 30},
-{0.0443728f, -0.9033639f, -0.4265731f, 5.1100000f, 64},
-{0.0478902f, -0.9988371f, 0.0055608f, 6.1500000f, 37},
-{0.0461817f, -0.9667300f, 0.2515955f, 2.1400000f, 23},
-{0.0450239f, -0.9590288f, 0.2797080f, 6.0400000f, 23},
-{0.0368507f, -0.8190069f, 0.5725991f, 5.7000000f, 35},
-{0.0209758f, -0.4657344f, -0.8846759f, 4.3200000f, 13},
-{0.0151656f, -0.3453885f, -0.9383372f, 4.9700000f, 46},
-{0.0409246f, -0.9688543f, -0.2442262f, 6.1300000f, 50},
-{0.0405703f, -0.9987020f, 0.0307953f, 3.6100000f, 39},
-{0.0199658f, -0.4790335f, -0.8775696f, 5.7000000f, 22},
-{0.0365530f, -0.8924488f, -0.4496655f, 6.4800000f, 48},
-{0.0386954f, -0.9763575f, 0.2126704f, 6.3500000f, 30},
-{0.0389703f, -0.9959227f, -0.0813587f, 5.6400000f, 50},
-{0.0322150f, -0.8344664f, 0.5501164f, 6.2700000f, 20},
-{0.0273965f, -0.7087168f, -0.7049609f, 4.4600000f, 53},
-{0.0368707f, -0.9781291f, -0.2047049f, 6.3500000f, 31},
-{0.0316426f, -0.8726464f, -0.4873263f, 5.8500000f, 37},
-{0.0151352f, -0.4256068f, -0.9047816f, 4.9000000f, 14},
-{0.0242257f, -0.7906538f, 0.6117840f, 6.4500000f, 48},
-{0.0195905f, -0.5730669f, -0.8192744f, 5.5700000f, 22},
-{0.0262047f, -0.8467913f, -0.5312795f, 4.2800000f, 19},
-{0.0234390f, -0.8194837f, -0.5726229f, 6.1700000f, 22},
-{0.0159381f, -0.5918729f, 0.8058737f, 2.4400000f, 20},
-{0.0268809f, -0.9995922f, 0.0096331f, 6.3000000f, 30},
-{0.0139534f, -0.5504496f, -0.8347518f, 6.0600000f, 20},
-{0.0195974f, -0.8061950f, -0.5913253f, 6.4600000f, 37},
-{0.0210441f, -0.9112600f, -0.4112934f, 5.3000000f, 44},
-{0.0213555f, -0.9889296f, 0.1468408f, 5.5800000f, 50},
-{0.0147374f, -0.6884887f, 0.7250973f, 6.5400000f, 23},
-{0.0144639f, -0.6885859f, 0.7250105f, 7.0300000f, 21},
-{0.0166565f, -0.8010139f, 0.5984139f, 6.4900000f, 63},
-{0.0100049f, -0.4582129f, -0.8887862f, 5.9100000f, 23},
-{0.0181710f, -0.9627718f, 0.2697042f, 5.5300000f, 23},
-{0.0167604f, -0.8866666f, -0.4621055f, 5.9300000f, 55},
-{0.0096716f, -0.5504160f, 0.8348345f, 5.8400000f, 51},
-{0.0166406f, -0.9569264f, -0.2898532f, 5.1800000f, 20},
-{0.0139966f, -0.7845343f, -0.6199274f, 6.1300000f, 50},
-{0.0064715f, -0.4763605f, 0.8792262f, 6.2200000f, 48},
-{0.0097387f, -0.6828538f, -0.7304901f, 6.2600000f, 35},
-{0.0107905f, -0.8415856f, -0.5400159f, 6.2100000f, 20},
-{0.0091674f, -0.7621207f, 0.6473701f, 6.6200000f, 36},
-{0.0048465f, -0.4763500f, -0.8792424f, 5.5700000f, 13},
-{0.0069356f, -0.8454768f, 0.5339671f, 6.4200000f, 29},
-{0.0034531f, -0.4776873f, 0.8785232f, 6.7600000f, 50},
-{0.0042966f, -0.5637580f, -0.8259289f, 5.4400000f, 18},
-{0.0056304f, -0.7765455f, -0.6300360f, 6.7900000f, 51},
-{0.0023328f, -0.4436778f, -0.8961833f, 5.6100000f, 23},
-{0.0043550f, -0.9128871f, -0.4081888f, 6.4300000f, 20},
-{0.0041159f, -0.9999487f, 0.0092598f, 6.1700000f, 52},
-{0.0025810f, -0.8370708f, 0.5470885f, 5.9600000f, 51},
-{0.0022807f, -0.6387190f, -0.7694367f, 6.0500000f, 51},
-{0.0003495f, -0.2116988f, -0.9773349f, 4.9100000f, 19},
-{0.0001687f, -0.8286958f, 0.5596992f, 6.5000000f, 29},
-{0.0002250f, -0.9979657f, 0.0637534f, 5.3700000f, 21},
-{-0.0002150f, -0.1589669f, 0.9872839f, 6.1700000f, 62},
-{-0.0031912f, -0.9861248f, -0.1659752f, 5.5500000f, 48},
-{-0.0029013f, -0.9387127f, -0.3446884f, 6.2800000f, 50},
-{-0.0037853f, -0.9933371f, 0.1151828f, 4.6600000f, 25},
-{-0.0035342f, -0.9491934f, -0.3146736f, 5.2600000f, 11},
-{-0.0044942f, -0.9999817f, -0.0040482f, 6.3100000f, 48},
-{-0.0035726f, -0.5519780f, -0.8338510f, 6.1600000f, 20},
-{-0.0058508f, -0.8085653f, 0.5883774f, 5.5900000f, 50},
-{-0.0067388f, -0.7307801f, 0.6825796f, 5.2100000f, 30},
-{-0.0009998f, -0.0981278f, -0.9951733f, 6.0500000f, 53},
-{-0.0036052f, -0.3336046f, -0.9427062f, 6.4200000f, 51},
-{-0.0041457f, -0.3614742f, -0.9323729f, 5.8900000f, 19},
-{-0.0124030f, -0.9938521f, -0.1100186f, 6.2200000f, 55},
-{-0.0060562f, -0.4588077f, -0.8885149f, 4.3300000f, 20},
-{-0.0119480f, -0.7480985f, -0.6634802f, 5.1500000f, 36},
-{-0.0045544f, -0.2791867f, -0.9602260f, 6.4400000f, 46},
-{-0.0173659f, -0.9305165f, 0.3658380f, 5.8700000f, 30},
-{-0.0086055f, -0.4564820f, -0.8896910f, 4.7200000f, 12},
-{-0.0076997f, -0.3798491f, -0.9250164f, 5.3500000f, 20},
-{-0.0052230f, -0.2506494f, -0.9680638f, 5.0400000f, 54},
-{-0.0015000f, -0.0769268f, 0.9970356f, 6.2700000f, 36},
-{-0.0111169f, -0.5144566f, -0.8574443f, 5.9600000f, 62},
-{-0.0224602f, -0.9881512f, 0.1518311f, 4.1200000f, 48},
-{-0.0051909f, -0.2264927f, 0.9739990f, 5.8000000f, 49},
-{-0.0112398f, -0.4548924f, 0.8904755f, 6.1300000f, 52},
-{-0.0110757f, -0.4311126f, -0.9022302f, 6.3300000f, 16},
-{-0.0214250f, -0.8257603f, -0.5636142f, 6.2300000f, 18},
-{-0.0261296f, -0.9984053f, -0.0500410f, 6.3700000f, 48},
-{-0.0106354f, -0.3849674f, -0.9228689f, 6.2300000f, 43},
-{-0.0120841f, -0.4336349f, -0.9010076f, 6.0600000f, 48},
-{-0.0134492f, -0.4477696f, -0.8940478f, 4.1500000f, 32},
-{-0.0090519f, -0.2648452f, -0.9642485f, 5.1800000f, 52},
-{-0.0229863f, -0.6511818f, -0.7585736f, 4.4700000f, 16},
-{-0.0230149f, -0.6525303f, -0.7574131f, 6.3700000f, 19},
-{-0.0243886f, -0.6776283f, -0.7350001f, 5.3400000f, 19},
-{-0.0237877f, -0.6519623f, -0.7578782f, 2.6000000f, 12},
-{-0.0188114f, -0.5124054f, -0.8585376f, 6.2200000f, 53},
-{-0.0337160f, -0.9180268f, -0.3950824f, 4.0200000f, 32},
-{-0.0280701f, -0.7227370f, -0.6905529f, 5.7500000f, 22},
-{-0.0294308f, -0.7567809f, -0.6530058f, 5.4800000f, 13},
-{-0.0422376f, -0.9985586f, 0.0331164f, 5.9500000f, 53},
-{-0.0112943f, -0.2642818f, 0.9643794f, 6.3500000f, 36},
-{-0.0366113f, -0.8350531f, -0.5489499f, 6.1700000f, 20},
-{-0.0436413f, -0.9939108f, 0.1011769f, 5.7200000f, 32},
-{-0.0411250f, -0.9302728f, -0.3645563f, 3.0000000f, 52},
-{-0.0372140f, -0.8068264f, -0.5896154f, 6.0600000f, 25},
-{-0.0439533f, -0.9562637f, 0.2891850f, 6.3900000f, 24},
-{-0.0417440f, -0.8877853f, 0.4583609f, 6.0100000f, 24},
-{-0.0236373f, -0.4884684f, -0.8722614f, 6.0800000f, 32},
-{-0.0446207f, -0.9234853f, -0.3810300f, 5.4600000f, 22},
-{-0.0343251f, -0.7114776f, -0.7018699f, 6.6100000f, 50},
-{-0.0318733f, -0.6333819f, -0.7731827f, 6.2300000f, 46},
-{-0.0315437f, -0.6199163f, -0.7840336f, 3.9600000f, 13},
-{-0.0069177f, -0.1440175f, 0.9895510f, 6.0000000f, 55},
-{-0.0465160f, -0.8985811f, 0.4363351f, 5.6600000f, 54},
-{-0.0278661f, -0.5431275f, 0.8391877f, 6.4300000f, 55},
-{-0.0460545f, -0.8773082f, 0.4777125f, 6.4900000f, 35},
-{-0.0496406f, -0.9350989f, 0.3508930f, 5.5700000f, 50},
-{-0.0261070f, -0.4833544f, -0.8750354f, 5.9200000f, 18},
-{-0.0192011f, -0.3439754f, -0.9387823f, 6.1700000f, 36},
-{-0.0114091f, -0.2141523f, 0.9767337f, 5.1400000f, 25},
-{-0.0478534f, -0.8288808f, -0.5573748f, 6.5000000f, 64},
-{-0.0467002f, -0.7965230f, -0.6028019f, 5.7600000f, 14},
-{-0.0132219f, -0.2172918f, -0.9760171f, 6.3500000f, 52},
-{-0.0576361f, -0.9823133f, 0.1781535f, 5.8500000f, 22},
-{-0.0502237f, -0.8446341f, -0.5329829f, 6.3300000f, 20},
-{-0.0438449f, -0.7146401f, -0.6981168f, 5.3100000f, 53},
-{-0.0276949f, -0.4439067f, -0.8956449f, 6.2200000f, 11},
-{-0.0382455f, -0.5945093f, 0.8031787f, 6.1600000f, 50},
-{-0.0617543f, -0.9426089f, -0.3281386f, 5.8300000f, 47},
-{-0.0357219f, -0.5397774f, -0.8410495f, 2.8000000f, 12},
-{-0.0652287f, -0.9835797f, -0.1682743f, 6.1100000f, 35},
-{-0.0517310f, -0.7633172f, -0.6439493f, 6.2600000f, 50},
-{-0.0223635f, -0.3379989f, 0.9408808f, 5.7100000f, 52},
-{-0.0366008f, -0.5429309f, 0.8389794f, 3.3100000f, 23},
-{-0.0635078f, -0.9207111f, -0.3850427f, 6.5400000f, 33},
-{-0.0660913f, -0.9567473f, -0.2833133f, 2.5900000f, 18},
-{-0.0674254f, -0.9640260f, 0.2571141f, 5.1000000f, 23},
-{-0.0228106f, -0.3183867f, -0.9476864f, 6.2200000f, 20},
-{-0.0205125f, -0.2991571f, 0.9539834f, 6.2900000f, 50},
-{-0.0533345f, -0.7567090f, 0.6515726f, 5.6600000f, 61},
-{-0.0651119f, -0.9116112f, 0.4058639f, 4.9500000f, 48},
-{-0.0602919f, -0.8359150f, 0.5455373f, 5.0000000f, 50},
-{-0.0323180f, -0.4323393f, -0.9011317f, 6.0600000f, 20},
-{-0.0717105f, -0.9618585f, -0.2639806f, 6.0500000f, 22},
-{-0.0311006f, -0.4049194f, -0.9138233f, 4.1100000f, 65},
-{-0.0456837f, -0.5974036f, 0.8006384f, 5.8100000f, 56},
-{-0.0667917f, -0.8725979f, 0.4838510f, 5.7000000f, 24},
-{-0.0156845f, -0.1955273f, -0.9805728f, 4.2600000f, 15},
-{-0.0628044f, -0.8075405f, -0.5864588f, 6.1500000f, 20},
-{-0.0746356f, -0.9623818f, 0.2612487f, 6.3400000f, 54},
-{-0.0790684f, -0.9962300f, -0.0356941f, 6.9900000f, 33},
-{-0.0791043f, -0.9962235f, -0.0357958f, 6.5400000f, 32},
-{-0.0352275f, -0.4370015f, -0.8987707f, 4.0400000f, 12},
-{-0.0697552f, -0.8610219f, 0.5037614f, 6.2300000f, 29},
-{-0.0813727f, -0.9965890f, 0.0137392f, 5.9000000f, 25},
-{-0.0476535f, -0.5736440f, -0.8177174f, 5.0000000f, 61},
-{-0.0045679f, -0.0619934f, 0.9980661f, 6.3300000f, 34},
-{-0.0745594f, -0.8956365f, 0.4384932f, 6.4800000f, 25},
-{-0.0774795f, -0.9170005f, 0.3912889f, 6.2700000f, 25},
-{-0.0026839f, -0.0400419f, 0.9991944f, 6.2800000f, 32},
-{-0.0210206f, -0.2552472f, 0.9666473f, 5.3800000f, 21},
-{-0.0748997f, -0.8784711f, 0.4718884f, 6.3300000f, 38},
-{-0.0867442f, -0.9961626f, 0.0116401f, 3.8900000f, 22},
-{-0.0566602f, -0.6538170f, 0.7545283f, 5.2900000f, 60},
-{-0.0816286f, -0.9247315f, -0.3717639f, 5.9700000f, 43},
-{-0.0388756f, -0.4341662f, -0.8999936f, 6.2100000f, 19},
-{-0.0791932f, -0.8904877f, 0.4480625f, 5.5400000f, 52},
-{-0.0794862f, -0.8952575f, 0.4384016f, 6.1500000f, 30},
-{-0.0885288f, -0.9943963f, 0.0577818f, 4.9600000f, 50},
-{-0.0831986f, -0.9248537f, -0.3711112f, 5.2100000f, 18},
-{-0.0859526f, -0.9482805f, 0.3055753f, 4.7400000f, 48},
-{-0.0802827f, -0.8869465f, 0.4548413f, 7.1300000f, 33},
-{-0.0890512f, -0.9724742f, -0.2153224f, 5.1400000f, 51},
-{-0.0470959f, -0.5038542f, -0.8625039f, 3.5900000f, 53},
-{-0.0483183f, -0.5297333f, 0.8467868f, 5.5500000f, 55},
-{-0.0540126f, -0.5620134f, -0.8253627f, 5.9200000f, 54},
-{-0.0384630f, -0.3972425f, -0.9169073f, 5.1500000f, 25},
-{-0.0367078f, -0.3777981f, -0.9251600f, 5.7400000f, 50},
-{-0.0877347f, -0.9037198f, 0.4190383f, 6.1900000f, 20},
-{-0.0551247f, -0.5517506f, -0.8321854f, 5.3900000f, 19},
-{-0.0882319f, -0.8956327f, 0.4359555f, 4.8100000f, 40},
-{-0.0977413f, -0.9909069f, 0.0924671f, 6.4000000f, 38},
-{-0.0080757f, -0.0719256f, -0.9973773f, 6.3300000f, 50},
-{-0.0405612f, -0.3987980f, -0.9161413f, 6.3600000f, 48},
-{-0.0935511f, -0.9146421f, -0.3932912f, 5.6800000f, 51},
-{-0.0845896f, -0.8189057f, -0.5676602f, 5.3200000f, 19},
-{-0.0802767f, -0.7763242f, -0.6252010f, 6.4000000f, 32},
-{-0.0825112f, -0.7934221f, -0.6030533f, 5.7900000f, 19},
-{-0.0763210f, -0.7328091f, 0.6761405f, 6.0600000f, 33},
-{-0.0650491f, -0.6182517f, 0.7832837f, 4.8000000f, 46},
-{-0.0950720f, -0.8929916f, 0.4399174f, 5.1800000f, 23},
-{-0.0818003f, -0.7546711f, -0.6509840f, 6.2500000f, 52},
-{-0.0960223f, -0.8968366f, 0.4318147f, 6.4200000f, 27},
-{-0.0478756f, -0.4321244f, -0.9005423f, 6.3000000f, 48},
-{-0.0820149f, -0.7446197f, -0.6624312f, 6.1100000f, 45},
-{-0.1079138f, -0.9776662f, -0.1803427f, 5.9500000f, 21},
-{-0.0988319f, -0.8914042f, -0.4423017f, 6.0900000f, 51},
-{-0.0906749f, -0.8159911f, -0.5709086f, 5.7300000f, 19},
-{-0.1005096f, -0.9085265f, 0.4055582f, 6.0300000f, 50},
-{-0.0597740f, -0.5446214f, 0.8365492f, 5.8100000f, 63},
-{-0.0482649f, -0.4388160f, 0.8972798f, 6.3200000f, 48},
-{-0.0874414f, -0.7720052f, 0.6295728f, 5.0200000f, 49},
-{-0.0526264f, -0.4528468f, -0.8900338f, 4.8600000f, 14},
-{-0.0527491f, -0.4524676f, -0.8902194f, 1.3300000f, 10},
-{-0.0527694f, -0.4524695f, -0.8902172f, 1.7300000f, 11},
-{-0.0733817f, -0.6311643f, -0.7721701f, 4.8200000f, 13},
-{-0.1021707f, -0.8829791f, 0.4581584f, 4.9500000f, 30},
-{-0.0794499f, -0.6762401f, -0.7323845f, 6.2600000f, 43},
-{-0.1000563f, -0.8497651f, -0.5175791f, 5.5500000f, 19},
-{-0.0556264f, -0.4628890f, -0.8846691f, 6.0000000f, 18},
-{-0.1032845f, -0.8746622f, 0.4736015f, 4.3600000f, 51},
-{-0.1048435f, -0.8862044f, 0.4512756f, 5.0000000f, 24},
-{-0.0651301f, -0.5406120f, -0.8387471f, 5.5000000f, 64},
-{-0.0356561f, -0.3081271f, 0.9506768f, 6.2400000f, 48},
-{-0.1192183f, -0.9815157f, 0.1497127f, 6.3700000f, 48},
-{-0.1167739f, -0.9571463f, -0.2650186f, 6.3500000f, 43},
-{-0.0788230f, -0.6410370f, -0.7634517f, 3.9100000f, 12},
-{-0.0546810f, -0.4403365f, -0.8961661f, 6.0400000f, 20},
-{-0.0676415f, -0.5592661f, 0.8262239f, 5.7000000f, 62},
-{-0.1210515f, -0.9908889f, -0.0590402f, 6.2200000f, 28},
-{-0.0614717f, -0.4930855f, -0.8678064f, 6.2200000f, 52},
-{-0.0960284f, -0.7716482f, -0.6287588f, 5.4400000f, 18},
-{-0.0702279f, -0.5606981f, -0.8250368f, 6.1500000f, 50},
-{-0.1117898f, -0.8900600f, 0.4419234f, 6.5400000f, 22},
-{-0.1125246f, -0.8924986f, 0.4367887f, 6.6500000f, 20},
-{-0.1131671f, -0.8923128f, 0.4370024f, 5.2900000f, 21},
-{-0.1169618f, -0.9052461f, 0.4084721f, 5.4800000f, 35},
-{-0.0737280f, -0.5619458f, -0.8238817f, 5.8000000f, 61},
-{-0.0994858f, -0.7565628f, -0.6463090f, 6.0200000f, 62},
-{-0.1208096f, -0.9263845f, 0.3566746f, 5.6900000f, 23},
-{-0.1252256f, -0.9555323f, -0.2669767f, 2.9500000f, 19},
-{-0.1277170f, -0.9674969f, -0.2182615f, 6.3500000f, 40},
-{-0.1219285f, -0.9171181f, -0.3795100f, 5.6300000f, 60},
-{-0.0682806f, -0.5194306f, 0.8517803f, 5.3500000f, 25},
-{-0.0813211f, -0.6166902f, 0.7829943f, 6.2100000f, 36},
-{-0.0678402f, -0.5140550f, 0.8550703f, 6.0800000f, 48},
-{-0.0740583f, -0.5412538f, -0.8375916f, 1.6300000f, 63},
-{-0.0742619f, -0.5407503f, -0.8378987f, 6.4200000f, 23},
-{-0.0465199f, -0.3520284f, 0.9348326f, 4.9500000f, 63},
-{-0.1226827f, -0.9011615f, 0.4157606f, 5.4600000f, 22},
-{-0.0805826f, -0.5953167f, 0.7994401f, 6.2100000f, 38},
-{-0.0718203f, -0.5163950f, -0.8533335f, 5.4800000f, 37},
-{-0.0409047f, -0.2895242f, -0.9562963f, 5.8800000f, 51},
-{-0.1351934f, -0.9819429f, 0.1323285f, 6.0500000f, 55},
-{-0.0641365f, -0.4573682f, -0.8869616f, 5.9500000f, 28},
-{-0.1371262f, -0.9867921f, -0.0862429f, 6.1900000f, 49},
-{-0.0439416f, -0.3081071f, -0.9503363f, 3.8700000f, 15},
-{-0.1189836f, -0.8446068f, -0.5219983f, 6.4600000f, 23},
-{-0.1342033f, -0.9527945f, -0.2723456f, 4.3100000f, 32},
-{-0.1385944f, -0.9677598f, -0.2103154f, 5.7400000f, 32},
-{-0.1413876f, -0.9736871f, 0.1787259f, 6.2600000f, 48},
-{-0.1378389f, -0.9398744f, -0.3124685f, 6.2600000f, 32},
-{-0.1431959f, -0.9705509f, -0.1937159f, 5.5800000f, 48},
-{-0.1330403f, -0.9017638f, 0.4112448f, 6.2900000f, 24},
-{-0.1452286f, -0.9781693f, -0.1486389f, 5.4800000f, 20},
-{-0.0986916f, -0.6606241f, -0.7442015f, 6.3800000f, 33},
-{-0.1223452f, -0.8273126f, 0.5482567f, 5.4200000f, 50},
-{-0.1226633f, -0.8259357f, 0.5502581f, 6.2400000f, 50},
-{-0.1101091f, -0.7424813f, 0.6607553f, 4.2600000f, 40},
-{-0.1379961f, -0.9128159f, -0.3843490f, 2.6500000f, 45},
-{-0.0502961f, -0.3418086f, 0.9384227f, 3.8700000f, 16},
-{-0.1097371f, -0.7191289f, -0.6861570f, 5.7700000f, 41},
-{-0.1398216f, -0.9123627f, 0.3847652f, 4.8100000f, 20},
-{-0.0767350f, -0.4916569f, -0.8674014f, 6.2200000f, 43},
-{-0.1447950f, -0.9378902f, 0.3152718f, 6.5600000f, 29},
-{-0.1448976f, -0.9378759f, 0.3152672f, 5.0200000f, 52},
-{-0.1417042f, -0.9170740f, 0.3726864f, 5.8500000f, 51},
-{-0.1173155f, -0.7457901f, -0.6557699f, 5.1300000f, 27},
-{-0.0515816f, -0.3377441f, 0.9398235f, 4.9400000f, 53},
-{-0.1231210f, -0.7769166f, -0.6174478f, 5.8000000f, 20},
-{-0.1473916f, -0.9312076f, -0.3333590f, 6.2000000f, 30},
-{-0.0582445f, -0.3558404f, -0.9327300f, 2.6900000f, 12},
-{-0.1594154f, -0.9845324f, -0.0726821f, 5.8700000f, 23},
-{-0.0802768f, -0.5013483f, 0.8615135f, 5.5000000f, 64},
-{-0.1535287f, -0.9434367f, 0.2938642f, 5.6800000f, 55},
-{-0.1107285f, -0.6669904f, -0.7367924f, 3.8600000f, 22},
-{-0.1461006f, -0.8800596f, -0.4518293f, 5.4500000f, 31},
-{-0.0451601f, -0.2611662f, -0.9642369f, 6.4900000f, 18},
-{-0.1650919f, -0.9846147f, 0.0572591f, 6.3300000f, 21},
-{-0.0664833f, -0.3881784f, -0.9191831f, 6.2500000f, 11},
-{-0.1665667f, -0.9854989f, 0.0323654f, 5.7100000f, 63},
-{-0.1659568f, -0.9785987f, 0.1216672f, 7.0800000f, 64},
-{-0.1602367f, -0.9388209f, -0.3048597f, 6.0000000f, 26},
-{-0.1474991f, -0.8570872f, -0.4936046f, 5.8900000f, 52},
-{-0.1273103f, -0.7453509f, 0.6544036f, 6.3700000f, 27},
-{-0.1564165f, -0.9094581f, 0.3852529f, 6.3800000f, 51},
-{-0.1694752f, -0.9799672f, -0.1046056f, 4.6600000f, 52},
-{-0.0719122f, -0.4085986f, -0.9098768f, 6.2600000f, 18},
-{-0.1585233f, -0.9196260f, 0.3593861f, 5.4600000f, 49},
-{-0.1380705f, -0.7976481f, 0.5871065f, 6.4500000f, 20},
-{-0.1363901f, -0.7759813f, -0.6158334f, 4.6400000f, 18},
-{-0.1250809f, -0.6851599f, -0.7175728f, 5.8400000f, 54},
-{-0.1227772f, -0.6703330f, -0.7318330f, 2.1700000f, 21},
-{-0.0666488f, -0.3588620f, -0.9310080f, 6.3300000f, 37},
-{-0.1745079f, -0.9586700f, -0.2247196f, 6.0800000f, 33},
-{-0.1745229f, -0.9586728f, -0.2246960f, 5.9800000f, 35},
-{-0.0955936f, -0.5164894f, -0.8509410f, 4.9300000f, 16},
-{-0.1774259f, -0.9673516f, 0.1809721f, 6.1900000f, 27},
-{-0.1807683f, -0.9834788f, -0.0096089f, 3.6500000f, 30},
-{-0.1807683f, -0.9834788f, -0.0096089f, 3.6800000f, 30},
-{-0.1723440f, -0.9339782f, -0.3130211f, 6.0300000f, 33},
-{-0.1788498f, -0.9676968f, 0.1776955f, 4.8800000f, 20},
-{-0.1807452f, -0.9763628f, 0.1185195f, 5.5900000f, 22},
-{-0.0845348f, -0.4469781f, -0.8905416f, 5.3100000f, 11},
-{-0.1255687f, -0.6679073f, -0.7335750f, 4.6600000f, 50},
-{-0.1090608f, -0.5768201f, -0.8095581f, 6.0800000f, 19},
-{-0.0826896f, -0.4509281f, 0.8887217f, 6.0700000f, 22},
-{-0.1051429f, -0.5518107f, -0.8273149f, 6.0000000f, 17},
-{-0.1024177f, -0.5334770f, -0.8395909f, 6.4000000f, 50},
-{-0.1446999f, -0.7542811f, -0.6404076f, 6.4400000f, 28},
-{-0.1892402f, -0.9819031f, -0.0073836f, 5.9300000f, 48},
-{-0.1549729f, -0.7976692f, -0.5828441f, 6.3900000f, 20},
-{-0.1690096f, -0.8693105f, -0.4644728f, 5.4800000f, 54},
-{-0.0901302f, -0.4739393f, 0.8759327f, 6.3800000f, 50},
-{-0.0757452f, -0.3805511f, -0.9216526f, 6.1600000f, 36},
-{-0.1018149f, -0.5045859f, -0.8573370f, 4.6900000f, 50},
-{-0.1384068f, -0.7046245f, 0.6959511f, 6.3300000f, 36},
-{-0.0754862f, -0.3687066f, -0.9264757f, 3.0500000f, 12},
-{-0.1509866f, -0.7592054f, 0.6330957f, 5.9500000f, 40},
-{-0.1372759f, -0.6880925f, 0.7125195f, 4.9900000f, 37},
-{-0.1959651f, -0.9714776f, 0.1335249f, 5.2200000f, 30},
-{-0.1138072f, -0.5546917f, -0.8242360f, 4.6500000f, 13},
-{-0.1981917f, -0.9660495f, 0.1657361f, 5.6700000f, 51},
-{-0.1705576f, -0.8241950f, -0.5400118f, 5.8600000f, 53},
-{-0.1937236f, -0.9386523f, 0.2853120f, 5.1200000f, 53},
-{-0.0313971f, -0.1599093f, 0.9866323f, 6.4000000f, 25},
-{-0.1085887f, -0.5139565f, -0.8509155f, 1.2500000f, 10},
-{-0.2027072f, -0.9737357f, 0.1036750f, 6.3400000f, 20},
-{-0.2001698f, -0.9576022f, 0.2071956f, 6.0700000f, 23},
-{-0.2050012f, -0.9737129f, -0.0992860f, 6.2600000f, 37},
-{-0.1907607f, -0.8994846f, -0.3931129f, 6.4400000f, 18},
-{-0.2068970f, -0.9763761f, 0.0623163f, 6.4100000f, 63},
-{-0.0937602f, -0.4476825f, 0.8892634f, 5.8900000f, 29},
-{-0.1879066f, -0.8757602f, -0.4446743f, 5.6600000f, 45},
-{-0.2031108f, -0.9506987f, 0.2343457f, 6.5600000f, 21},
-{-0.0736119f, -0.3337760f, -0.9397738f, 5.5500000f, 48},
-{-0.0812198f, -0.3856378f, 0.9190685f, 5.4300000f, 55},
-{-0.1917090f, -0.8870017f, 0.4200901f, 6.3100000f, 47},
-{-0.2053651f, -0.9477822f, 0.2439959f, 5.7000000f, 21},
-{-0.1398271f, -0.6481407f, 0.7485733f, 6.2700000f, 26},
-{-0.1043359f, -0.4840381f, 0.8688044f, 5.8500000f, 35},
-{-0.1099596f, -0.4939552f, -0.8625063f, 6.7500000f, 23},
-{-0.1892107f, -0.8661642f, 0.4625569f, 5.7800000f, 22},
-{-0.0212165f, -0.0867429f, -0.9960048f, 5.4600000f, 50},
-{-0.1470515f, -0.6588609f, -0.7377521f, 6.2400000f, 20},
-{-0.1381590f, -0.6110085f, -0.7794747f, 5.7300000f, 25},
-{-0.2005730f, -0.8993395f, 0.3885344f, 6.4300000f, 50},
-{-0.1860299f, -0.8273873f, -0.5299275f, 4.9100000f, 20},
-{-0.1722766f, -0.7742381f, 0.6089960f, 5.8900000f, 23},
-{-0.1120842f, -0.4923792f, -0.8631337f, 5.7200000f, 22},
-{-0.2191680f, -0.9611444f, -0.1678299f, 6.4100000f, 48},
-{-0.2229962f, -0.9733598f, 0.0533236f, 6.0200000f, 54},
-{-0.1763117f, -0.7645016f, -0.6200415f, 5.9800000f, 18},
-{-0.1510479f, -0.6531119f, -0.7420441f, 6.3300000f, 20},
-{-0.2033036f, -0.8812184f, -0.4267573f, 6.1500000f, 20},
-{-0.1390343f, -0.5973461f, -0.7898399f, 6.2400000f, 48},
-{-0.1983231f, -0.8642199f, 0.4623763f, 4.9400000f, 40},
-{-0.2158698f, -0.9312339f, 0.2936047f, 6.3200000f, 60},
-{-0.1379504f, -0.5851105f, -0.7991342f, 5.9300000f, 52},
-{-0.2179821f, -0.9356126f, 0.2776919f, 6.3000000f, 27},
-{-0.1165158f, -0.4913322f, -0.8631435f, 5.7600000f, 19},
-{-0.1564812f, -0.6630602f, -0.7320279f, 4.3300000f, 53},
-{-0.1774609f, -0.7472649f, -0.6403927f, 4.2700000f, 27},
-{-0.1176604f, -0.4918079f, -0.8627172f, 5.9000000f, 15},
-{-0.2297834f, -0.9723049f, -0.0426943f, 6.1100000f, 35},
-{-0.0243744f, -0.1120026f, 0.9934089f, 5.8500000f, 20},
-{-0.0244510f, -0.1120795f, 0.9933984f, 5.2800000f, 21},
-{-0.2147980f, -0.9069506f, 0.3623567f, 4.9000000f, 48},
-{-0.1260255f, -0.5212587f, -0.8440421f, 6.5800000f, 37},
-{-0.2313930f, -0.9706287f, -0.0658579f, 6.4400000f, 50},
-{-0.1221783f, -0.5025932f, -0.8558461f, 4.6200000f, 14},
-{-0.1291275f, -0.5317859f, -0.8369766f, 4.0300000f, 12},
-{-0.1291413f, -0.5316405f, -0.8370668f, 5.1700000f, 15},
-{-0.2272720f, -0.9497894f, 0.2150526f, 6.2500000f, 27},
-{-0.2309465f, -0.9562307f, -0.1796846f, 6.0000000f, 22},
-{-0.2323871f, -0.9614295f, -0.1471381f, 4.7900000f, 63},
-{-0.1713378f, -0.7005306f, -0.6927483f, 5.8900000f, 41},
-{-0.1953613f, -0.8103370f, 0.5524382f, 6.2600000f, 27},
-{-0.1307443f, -0.5442928f, 0.8286443f, 1.7700000f, 20},
-{-0.1801873f, -0.7318908f, -0.6571670f, 5.4700000f, 60},
-{-0.0761951f, -0.3026466f, -0.9500523f, 5.9300000f, 48},
-{-0.1380724f, -0.5542931f, -0.8207893f, 5.3200000f, 9},
-{-0.1613358f, -0.6600525f, 0.7336903f, 5.8400000f, 65},
-{-0.2398199f, -0.9690069f, 0.0592628f, 3.3800000f, 63},
-{-0.2335747f, -0.9387654f, -0.2533030f, 6.1700000f, 20},
-{-0.2201987f, -0.8750049f, -0.4311367f, 6.6200000f, 33},
-{-0.1557675f, -0.6125143f, -0.7749598f, 5.1600000f, 18},
-{-0.1898382f, -0.7613051f, 0.6199807f, 5.6000000f, 30},
-{-0.1899007f, -0.7612492f, 0.6200301f, 2.9000000f, 20},
-{-0.0996350f, -0.4035502f, 0.9095164f, 5.2400000f, 30},
-{-0.1425863f, -0.5687802f, 0.8100360f, 5.8200000f, 25},
-{-0.2316032f, -0.9027981f, -0.3623748f, 6.3100000f, 45},
-{-0.1708206f, -0.6710325f, 0.7214817f, 6.1200000f, 50},
-{-0.2426302f, -0.9228278f, 0.2991981f, 4.7800000f, 61},
-{-0.2571911f, -0.9656061f, -0.0381795f, 5.7900000f, 23},
-{-0.2202294f, -0.8141816f, -0.5372219f, 6.0200000f, 30},
-{-0.0898007f, -0.3223358f, -0.9423563f, 3.6200000f, 52},
-{-0.2233454f, -0.8295536f, 0.5118180f, 4.9000000f, 49},
-{-0.2610644f, -0.9642290f, -0.0459103f, 5.9900000f, 52},
-{-0.2482111f, -0.9159904f, 0.3152028f, 6.2000000f, 36},
-{-0.0636415f, -0.2426372f, 0.9680274f, 6.0100000f, 50},
-{-0.1026642f, -0.3836950f, 0.9177354f, 5.3200000f, 52},
-{-0.2520159f, -0.9218470f, 0.2944249f, 5.9600000f, 50},
-{-0.0906233f, -0.3208616f, -0.9427806f, 6.0300000f, 11},
-{-0.1450581f, -0.5345477f, 0.8325965f, 4.9300000f, 32},
-{-0.2630939f, -0.9458541f, 0.1901094f, 2.8300000f, 48},
-{-0.1814985f, -0.6376482f, -0.7486408f, 4.8500000f, 20},
-{-0.1183694f, -0.4284230f, 0.8957915f, 6.0000000f, 36},
-{-0.2590438f, -0.9068517f, -0.3324401f, 5.5800000f, 37},
-{-0.1361914f, -0.4855462f, 0.8635374f, 6.5300000f, 23},
-{-0.2750170f, -0.9605745f, -0.0407712f, 6.5900000f, 30},
-{-0.2111896f, -0.7268995f, -0.6534646f, 6.2600000f, 63},
-{-0.1740490f, -0.5921946f, -0.7867735f, 6.4300000f, 61},
-{-0.1925310f, -0.6470868f, -0.7377063f, 4.7100000f, 15},
-{-0.2181148f, -0.7295000f, -0.6482713f, 5.5900000f, 50},
-{-0.1922386f, -0.6396489f, -0.7442403f, 4.2700000f, 11},
-{-0.2294811f, -0.7779340f, 0.5849419f, 5.2500000f, 19},
-{-0.1530148f, -0.5051891f, -0.8493353f, 5.9900000f, 38},
-{-0.1995076f, -0.6749138f, 0.7104140f, 5.6300000f, 51},
-{-0.2662561f, -0.8938031f, 0.3608651f, 5.9900000f, 34},
-{-0.2382080f, -0.7926689f, -0.5611889f, 6.5400000f, 20},
-{-0.2489564f, -0.8381792f, 0.4852590f, 6.5400000f, 23},
-{-0.2636295f, -0.8846564f, 0.3845549f, 5.6000000f, 65},
-{-0.0814860f, -0.2803475f, 0.9564337f, 6.3100000f, 30},
-{-0.1769034f, -0.5819079f, -0.7937811f, 5.7100000f, 18},
-{-0.1251849f, -0.4087171f, -0.9040349f, 5.5100000f, 10},
-{-0.1338954f, -0.4492983f, 0.8832910f, 6.1400000f, 47},
-{-0.2560030f, -0.8482127f, 0.4636784f, 4.8000000f, 55},
-{-0.2881362f, -0.9439732f, -0.1609100f, 5.1900000f, 52},
-{-0.2588106f, -0.8479425f, 0.4626128f, 6.1900000f, 54},
-{-0.2924252f, -0.9484564f, -0.1221388f, 5.5500000f, 53},
-{-0.2734173f, -0.8798019f, -0.3888336f, 4.9500000f, 51},
-{-0.2943026f, -0.9443164f, -0.1471477f, 6.3200000f, 50},
-{-0.2928644f, -0.9401829f, 0.1740301f, 5.7800000f, 50},
-{-0.2954275f, -0.9404809f, -0.1679828f, 5.9400000f, 55},
-{-0.2869877f, -0.9130326f, 0.2898439f, 5.9100000f, 55},
-{-0.2995873f, -0.9508929f, -0.0777824f, 4.3800000f, 21},
-{-0.2376381f, -0.7577825f, 0.6076955f, 6.0200000f, 53},
-{-0.1899920f, -0.5937729f, -0.7818803f, 6.0600000f, 20},
-{-0.1152523f, -0.3554488f, -0.9275630f, 5.9100000f, 33},
-{-0.2342473f, -0.7463426f, 0.6229774f, 6.2800000f, 17},
-{-0.2866954f, -0.9094431f, 0.3011959f, 5.2200000f, 35},
-{-0.2866954f, -0.9094431f, 0.3011959f, 5.2200000f, 35},
-{-0.2278408f, -0.7102087f, -0.6661023f, 5.7900000f, 37},
-{-0.2355121f, -0.7463434f, 0.6224995f, 5.9100000f, 29},
-{-0.1415249f, -0.4363137f, -0.8885950f, 6.3300000f, 28},
-{-0.2254795f, -0.7003262f, -0.6772756f, 5.2500000f, 51},
-{-0.1397930f, -0.4444711f, 0.8848183f, 6.5400000f, 21},
-{-0.1640280f, -0.5026611f, -0.8487795f, 4.6000000f, 18},
-{-0.0686475f, -0.2043162f, -0.9764950f, 5.8500000f, 38},
-{-0.1281928f, -0.3898145f, -0.9119272f, 5.9000000f, 20},
-{-0.2777347f, -0.8591996f, -0.4296970f, 6.5000000f, 25},
-{-0.2495528f, -0.7674368f, -0.5905626f, 4.8500000f, 43},
-{-0.1649552f, -0.5007322f, -0.8497394f, 6.1600000f, 40},
-{-0.2975726f, -0.9150417f, -0.2723036f, 5.0400000f, 35},
-{-0.2347955f, -0.7136274f, -0.6600053f, 6.2200000f, 50},
-{-0.2726893f, -0.8408323f, 0.4675913f, 4.2600000f, 39},
-{-0.2822617f, -0.8669100f, 0.4108470f, 6.3300000f, 51},
-{-0.2052717f, -0.6189474f, -0.7581343f, 5.8900000f, 19},
-{-0.3049814f, -0.9310506f, 0.2003275f, 5.7700000f, 60},
-{-0.2949648f, -0.8998082f, 0.3214670f, 6.5300000f, 48},
-{-0.1717962f, -0.5119473f, -0.8416627f, 5.8900000f, 50},
-{-0.1644414f, -0.4897113f, -0.8562370f, 4.9200000f, 37},
-{-0.3009695f, -0.9067728f, -0.2952634f, 6.2800000f, 19},
-{-0.2324594f, -0.6951680f, -0.6802235f, 6.1600000f, 54},
-{-0.2973957f, -0.8991537f, 0.3210584f, 6.1100000f, 48},
-{-0.1306155f, -0.3834155f, -0.9142932f, 4.8000000f, 18},
-{-0.1193991f, -0.3495904f, -0.9292634f, 6.3700000f, 52},
-{-0.3023706f, -0.9013156f, -0.3101649f, 5.3300000f, 46},
-{-0.2182501f, -0.6455496f, -0.7318693f, 5.8900000f, 51},
-{-0.2416285f, -0.7251294f, 0.6448280f, 4.9200000f, 48},
-{-0.3132349f, -0.9291267f, 0.1964881f, 5.6700000f, 60},
-{-0.2618112f, -0.7694871f, -0.5825329f, 6.1900000f, 51},
-{-0.1396109f, -0.4012085f, -0.9052848f, 6.0700000f, 35},
-{-0.3094551f, -0.8989778f, -0.3099621f, 5.2200000f, 51},
-{-0.1385779f, -0.3956241f, -0.9078974f, 4.8700000f, 52},
-{-0.0932642f, -0.2806350f, 0.9552726f, 6.5900000f, 22},
-{-0.2447914f, -0.7156564f, 0.6541506f, 5.7900000f, 27},
-{-0.3273025f, -0.9448598f, -0.0106366f, 6.6800000f, 31},
-{-0.2836807f, -0.8136482f, -0.5074465f, 5.1000000f, 51},
-{-0.3086643f, -0.8934069f, 0.3264206f, 6.4500000f, 48},
-{-0.2456376f, -0.7011202f, -0.6693972f, 5.8400000f, 20},
-{-0.0514454f, -0.1573432f, 0.9862031f, 6.2500000f, 50},
-{-0.3084381f, -0.8889805f, 0.3384961f, 6.4500000f, 30},
-{-0.3243264f, -0.9316657f, 0.1637421f, 5.2200000f, 40},
-{-0.1050218f, -0.2912507f, -0.9508646f, 6.0400000f, 53},
-{-0.3213844f, -0.9169602f, 0.2364236f, 5.3300000f, 53},
-{-0.3317195f, -0.9433041f, 0.0118098f, 6.3700000f, 30},
-{-0.3306692f, -0.9389207f, 0.0953197f, 4.8000000f, 61},
-{-0.2128654f, -0.5963405f, -0.7739937f, 6.1900000f, 20},
-{-0.2521218f, -0.7165206f, 0.6504097f, 4.7300000f, 33},
-{-0.1205305f, -0.3476951f, 0.9298282f, 6.2000000f, 19},
-{-0.3196116f, -0.8975118f, -0.3038437f, 4.7400000f, 46},
-{-0.3111517f, -0.8675614f, -0.3879714f, 3.0000000f, 48},
-{-0.3366091f, -0.9394452f, 0.0643194f, 6.6200000f, 21},
-{-0.2779961f, -0.7800215f, 0.5606109f, 5.8200000f, 54},
-{-0.2166261f, -0.6096893f, 0.7624645f, 5.1500000f, 20},
-{-0.1813494f, -0.4943460f, -0.8501379f, 6.1800000f, 33},
-{-0.2766064f, -0.7696734f, 0.5754058f, 6.0200000f, 30},
-{-0.2156853f, -0.5875601f, -0.7799057f, 5.4800000f, 16},
-{-0.2019995f, -0.5489817f, -0.8110581f, 6.0200000f, 10},
-{-0.2811736f, -0.7663049f, -0.5776835f, 2.7500000f, 22},
-{-0.2441202f, -0.6620579f, -0.7085793f, 5.7700000f, 51},
-{-0.1101874f, -0.2913077f, -0.9502624f, 6.0500000f, 16},
-{-0.3444069f, -0.9374168f, 0.0513192f, 6.2600000f, 23},
-{-0.2624162f, -0.7178947f, 0.6447983f, 5.6000000f, 51},
-{-0.3301434f, -0.8889355f, -0.3174886f, 6.2100000f, 22},
-{-0.1814754f, -0.4815630f, -0.8574169f, 6.1800000f, 12},
-{-0.1816375f, -0.4817596f, -0.8572722f, 4.5300000f, 13},
-{-0.2171718f, -0.5787728f, -0.7860397f, 5.8300000f, 12},
-{-0.3487222f, -0.9365182f, 0.0364208f, 5.6900000f, 22},
-{-0.2455133f, -0.6490611f, -0.7200298f, 6.1600000f, 24},
-{-0.2397612f, -0.6324779f, -0.7365367f, 6.3800000f, 16},
-{-0.3494490f, -0.9326377f, 0.0898456f, 5.8700000f, 22},
-{-0.1601187f, -0.4170782f, -0.8946551f, 4.5300000f, 46},
-{-0.1054273f, -0.2706921f, -0.9568756f, 5.0500000f, 50},
-{-0.2982689f, -0.7857664f, -0.5418549f, 6.2200000f, 61},
-{-0.3401834f, -0.8976819f, -0.2800757f, 5.3700000f, 50},
-{-0.2525159f, -0.6748158f, 0.6934403f, 6.3500000f, 27},
-{-0.2386227f, -0.6226754f, -0.7452077f, 6.4800000f, 48},
-{-0.3550638f, -0.9333012f, -0.0536528f, 5.8900000f, 53},
-{-0.1620558f, -0.4154819f, -0.8950490f, 5.3100000f, 32},
-{-0.1288790f, -0.3278705f, -0.9358906f, 5.6700000f, 20},
-{-0.3593371f, -0.9293919f, -0.0843059f, 5.7500000f, 33},
-{-0.1067886f, -0.2666362f, -0.9578629f, 6.6300000f, 19},
-{-0.2857525f, -0.7453828f, 0.6022873f, 6.0700000f, 63},
-{-0.3519864f, -0.9109117f, 0.2152798f, 6.4400000f, 50},
-{-0.2057585f, -0.5365440f, 0.8184033f, 2.2700000f, 21},
-{-0.2058121f, -0.5365787f, 0.8183671f, 3.9500000f, 21},
-{-0.3567445f, -0.9150809f, -0.1880432f, 0.9800000f, 11},
-{-0.3318923f, -0.8522302f, 0.4044145f, 5.7800000f, 23},
-{-0.2882550f, -0.7305623f, -0.6190216f, 5.0900000f, 50},
-{-0.3672360f, -0.9300210f, -0.0140931f, 5.9700000f, 27},
-{-0.2815656f, -0.7063317f, -0.6494739f, 5.6900000f, 53},
-{-0.2440891f, -0.6110006f, -0.7530596f, 6.3100000f, 20},
-{-0.2084727f, -0.5345325f, 0.8190325f, 4.0100000f, 25},
-{-0.2458895f, -0.6136284f, -0.7503323f, 6.2800000f, 13},
-{-0.3622708f, -0.9112722f, -0.1958130f, 5.2500000f, 60},
-{-0.2853024f, -0.7129010f, -0.6406050f, 6.4000000f, 48},
-{-0.1392248f, -0.3412734f, -0.9295961f, 6.2000000f, 20},
-{-0.2552437f, -0.6456869f, 0.7196799f, 5.8800000f, 50},
-{-0.3612907f, -0.9004035f, -0.2423688f, 4.7600000f, 50},
-{-0.1702209f, -0.4154201f, -0.8935608f, 6.1100000f, 20},
-{-0.1648951f, -0.4186196f, 0.8930662f, 6.5000000f, 46},
-{-0.2402100f, -0.5840947f, -0.7753274f, 5.0600000f, 21},
-{-0.3655151f, -0.8998172f, 0.2381756f, 4.9800000f, 44},
-{-0.1110372f, -0.2813982f, 0.9531452f, 5.7900000f, 61},
-{-0.1582853f, -0.3963600f, 0.9043476f, 6.6600000f, 30},
-{-0.1585555f, -0.3965258f, 0.9042275f, 7.0400000f, 30},
-{-0.2267484f, -0.5612807f, 0.7959580f, 6.3400000f, 30},
-{-0.2852136f, -0.7020740f, 0.6524916f, 6.4700000f, 48},
-{-0.3796279f, -0.9250728f, -0.0110923f, 6.4300000f, 50},
-{-0.2383396f, -0.5884691f, 0.7725920f, 6.8000000f, 31},
-{-0.3519258f, -0.8526391f, -0.3862057f, 4.9700000f, 67},
-{-0.3727783f, -0.9087391f, 0.1876956f, 5.6500000f, 50},
-{-0.0928408f, -0.2154531f, -0.9720908f, 6.4800000f, 36},
-{-0.2391255f, -0.5862394f, 0.7740428f, 6.4300000f, 30},
-{-0.0429747f, -0.0911968f, -0.9949052f, 5.5800000f, 20},
-{-0.1885247f, -0.4639802f, 0.8655523f, 5.4000000f, 21},
-{-0.3796902f, -0.9166343f, 0.1249677f, 6.1700000f, 55},
-{-0.3804174f, -0.9188623f, 0.1047599f, 6.5100000f, 50},
-{-0.3826205f, -0.9188666f, -0.0963621f, 6.0900000f, 32},
-{-0.3023956f, -0.7207349f, -0.6237773f, 3.8800000f, 49},
-{-0.3437751f, -0.8142756f, -0.4677327f, 6.4700000f, 21},
-{-0.0729212f, -0.1829060f, 0.9804223f, 5.7700000f, 42},
-{-0.3098498f, -0.7291789f, -0.6101567f, 6.1600000f, 51},
-{-0.1717964f, -0.3970219f, -0.9015873f, 6.3700000f, 20},
-{-0.3732923f, -0.8789239f, -0.2968934f, 6.0100000f, 30},
-{-0.3886293f, -0.9159421f, -0.1000868f, 4.6900000f, 62},
-{-0.2876885f, -0.6838548f, 0.6705058f, 6.0800000f, 52},
-{-0.3493220f, -0.8170141f, -0.4587616f, 5.6900000f, 21},
-{-0.3456232f, -0.8085907f, -0.4761572f, 6.4500000f, 33},
-{-0.3813964f, -0.8892035f, -0.2526933f, 5.5500000f, 51},
-{-0.3888175f, -0.9053421f, -0.1708114f, 5.2100000f, 50},
-{-0.3920094f, -0.9122985f, -0.1184906f, 6.6800000f, 67},
-{-0.3589147f, -0.8373938f, 0.4122521f, 6.1100000f, 48},
-{-0.2695159f, -0.6162989f, -0.7399573f, 6.3300000f, 18},
-{-0.3380378f, -0.7707417f, -0.5400812f, 6.4400000f, 52},
-{-0.3984620f, -0.9149620f, 0.0638163f, 4.9400000f, 21},
-{-0.3914945f, -0.8931726f, -0.2213027f, 5.9100000f, 22},
-{-0.4014999f, -0.9158000f, 0.0103991f, 3.3700000f, 23},
-{-0.3119403f, -0.7143147f, 0.6264564f, 6.3700000f, 30},
-{-0.2269982f, -0.5213032f, 0.8226267f, 5.6000000f, 20},
-{-0.3202270f, -0.7295264f, 0.6043558f, 4.9800000f, 32},
-{-0.4035229f, -0.9114420f, -0.0802666f, 5.7300000f, 46},
-{-0.2627118f, -0.6009305f, 0.7548940f, 4.7000000f, 25},
-{-0.2038447f, -0.4514484f, -0.8687012f, 5.6300000f, 36},
-{-0.3985560f, -0.8998697f, 0.1771659f, 6.4900000f, 51},
-{-0.1133886f, -0.2454001f, -0.9627678f, 6.3400000f, 18},
-{-0.2894211f, -0.6559341f, 0.6971269f, 6.8400000f, 27},
-{-0.3418399f, -0.7602587f, -0.5524059f, 6.5000000f, 50},
-{-0.2964461f, -0.6573198f, -0.6928567f, 5.9800000f, 48},
-{-0.1459113f, -0.3173737f, -0.9370079f, 6.1000000f, 53},
-{-0.3699990f, -0.8232212f, -0.4305899f, 5.7800000f, 27},
-{-0.2886096f, -0.6377521f, -0.7141266f, 5.9000000f, 18},
-{-0.2225650f, -0.4876598f, -0.8441876f, 6.4200000f, 51},
-{-0.3733464f, -0.8289431f, 0.4164924f, 5.7400000f, 62},
-{-0.2314244f, -0.5030467f, -0.8326985f, 6.0100000f, 45},
-{-0.1500083f, -0.3216571f, -0.9348980f, 6.5900000f, 50},
-{-0.2659429f, -0.5926947f, 0.7602548f, 6.4900000f, 51},
-{-0.3325055f, -0.7341960f, 0.5919428f, 4.8200000f, 27},
-{-0.3670916f, -0.7990326f, -0.4762254f, 5.8300000f, 35},
-{-0.4023478f, -0.8815292f, 0.2470272f, 6.5200000f, 29},
-{-0.1894004f, -0.4053314f, -0.8943343f, 5.7900000f, 33},
-{-0.0934339f, -0.2130673f, 0.9725597f, 6.5700000f, 55},
-{-0.2568043f, -0.5514304f, -0.7937103f, 2.3000000f, 11},
-{-0.2618638f, -0.5764953f, 0.7740029f, 6.4800000f, 62},
-{-0.2825009f, -0.6058597f, -0.7437252f, 6.0000000f, 65},
-{-0.3308863f, -0.7121825f, -0.6191206f, 6.2700000f, 64},
-{-0.3234144f, -0.6950683f, -0.6420928f, 5.6000000f, 52},
-{-0.3977101f, -0.8623204f, 0.3134170f, 6.4800000f, 53},
-{-0.4135614f, -0.8911793f, 0.1864574f, 5.5700000f, 30},
-{-0.1323085f, -0.2930878f, 0.9468865f, 5.5000000f, 52},
-{-0.2331698f, -0.4887500f, -0.8406874f, 5.3800000f, 19},
-{-0.2558417f, -0.5379228f, -0.8032335f, 5.0100000f, 18},
-{-0.2536241f, -0.5469694f, 0.7978091f, 5.4600000f, 23},
-{-0.3630901f, -0.7763487f, 0.5152168f, 6.2100000f, 45},
-{-0.3997506f, -0.8507173f, 0.3412911f, 5.7500000f, 21},
-{-0.3751960f, -0.7986734f, 0.4704772f, 6.2300000f, 53},
-{-0.3958308f, -0.8344162f, -0.3834940f, 6.5900000f, 20},
-{-0.3626876f, -0.7624297f, -0.5358718f, 6.0500000f, 50},
-{-0.2696794f, -0.5757911f, 0.7718404f, 6.3200000f, 37},
-{-0.3942498f, -0.8355668f, 0.3826162f, 5.6200000f, 49},
-{-0.4255134f, -0.8959946f, -0.1270117f, 5.0100000f, 61},
-{-0.2475992f, -0.5136985f, -0.8214673f, 6.0000000f, 10},
-{-0.2835902f, -0.5885338f, -0.7571028f, 6.4100000f, 60},
-{-0.2296493f, -0.4904995f, 0.8406375f, 6.2900000f, 22},
-{-0.2460102f, -0.5231637f, 0.8159526f, 4.6600000f, 62},
-{-0.3296186f, -0.6840056f, -0.6507595f, 5.9800000f, 50},
-{-0.4267300f, -0.8925357f, 0.1458816f, 6.1600000f, 33},
-{-0.3251457f, -0.6691158f, -0.6682546f, 5.9800000f, 18},
-{-0.2766075f, -0.5654691f, -0.7770025f, 6.4700000f, 20},
-{-0.4338591f, -0.8988648f, 0.0617115f, 5.3600000f, 52},
-{-0.3229764f, -0.6735003f, 0.6648936f, 6.3000000f, 46},
-{-0.3550340f, -0.7383381f, 0.5734176f, 5.9800000f, 45},
-{-0.1823088f, -0.3843814f, 0.9049942f, 5.8500000f, 22},
-{-0.4366477f, -0.8962031f, -0.0784784f, 6.5100000f, 21},
-{-0.4035206f, -0.8296048f, 0.3859105f, 6.1300000f, 54},
-{-0.4236382f, -0.8638307f, -0.2726301f, 5.6000000f, 40},
-{-0.4016193f, -0.8165430f, -0.4146800f, 6.2100000f, 50},
-{-0.4000824f, -0.8058283f, -0.4365488f, 5.8100000f, 21},
-{-0.3733720f, -0.7514394f, -0.5439964f, 4.2300000f, 33},
-{-0.2692865f, -0.5526597f, 0.7887027f, 6.0200000f, 21},
-{-0.4309307f, -0.8682470f, -0.2458572f, 6.1900000f, 22},
-{-0.2157219f, -0.4271572f, -0.8780665f, 6.5100000f, 50},
-{-0.2850360f, -0.5676254f, -0.7723703f, 4.6500000f, 48},
-{-0.4368901f, -0.8768568f, -0.2006220f, 5.5100000f, 48},
-{-0.3651074f, -0.7248318f, -0.5842221f, 5.1500000f, 20},
-{-0.2919735f, -0.5763836f, -0.7632387f, 5.9100000f, 23},
-{-0.2928580f, -0.5770050f, -0.7624300f, 5.4500000f, 52},
-{-0.2485785f, -0.5028499f, 0.8278591f, 6.5000000f, 37},
-{-0.4462617f, -0.8832086f, -0.1441979f, 6.0500000f, 55},
-{-0.3369587f, -0.6741762f, 0.6572254f, 5.8700000f, 25},
-{-0.3501465f, -0.6998620f, 0.6225678f, 5.9400000f, 49},
-{-0.4339417f, -0.8569824f, -0.2779853f, 5.4300000f, 62},
-{-0.4045883f, -0.8051197f, 0.4336940f, 5.9500000f, 45},
-{-0.4471493f, -0.8875937f, 0.1106113f, 6.3300000f, 40},
-{-0.0895677f, -0.1864097f, 0.9783808f, 5.9100000f, 47},
-{-0.4303411f, -0.8513612f, 0.2999844f, 4.5000000f, 36},
-{-0.3520313f, -0.6984425f, 0.6230988f, 5.5000000f, 50},
-{-0.2608850f, -0.5198699f, 0.8134336f, 5.7000000f, 19},
-{-0.0728450f, -0.1318973f, -0.9885832f, 5.9500000f, 52},
-{-0.3780046f, -0.7345843f, -0.5634700f, 6.5300000f, 43},
-{-0.3506356f, -0.6771316f, -0.6469525f, 3.4100000f, 12},
-{-0.2947999f, -0.5814596f, 0.7582861f, 1.8600000f, 13},
-{-0.3830355f, -0.7401751f, -0.5526524f, 4.1900000f, 64},
-{-0.3445786f, -0.6646412f, -0.6629613f, 3.0400000f, 12},
-{-0.1710146f, -0.3223438f, -0.9310470f, 5.7500000f, 55},
-{-0.3905107f, -0.7611174f, 0.5178819f, 5.6200000f, 50},
-{-0.4390091f, -0.8444829f, -0.3067891f, 4.9700000f, 50},
-{-0.4045390f, -0.7762161f, -0.4835667f, 6.1800000f, 20},
-{-0.3643561f, -0.6975172f, -0.6170206f, 6.4400000f, 51},
-{-0.3529496f, -0.6856370f, 0.6366541f, 7.4000000f, 66},
-{-0.4423576f, -0.8545195f, 0.2722429f, 4.0700000f, 55},
-{-0.4292777f, -0.8271592f, 0.3626685f, 4.9100000f, 54},
-{-0.4410063f, -0.8420006f, -0.3107225f, 6.5300000f, 45},
-{-0.0545026f, -0.1137749f, 0.9920105f, 5.9800000f, 49},
-{-0.3697656f, -0.7122089f, 0.5966841f, 6.3800000f, 27},
-{-0.4612102f, -0.8821043f, 0.0957975f, 6.0100000f, 50},
-{-0.3308015f, -0.6235467f, -0.7083501f, 5.7700000f, 12},
-{-0.2944403f, -0.5532957f, -0.7792104f, 5.2500000f, 19},
-{-0.3806639f, -0.7188731f, -0.5816498f, 6.3500000f, 36},
-{-0.4278445f, -0.8102792f, -0.4004956f, 6.4500000f, 45},
-{-0.4018197f, -0.7570938f, -0.5151212f, 4.5600000f, 15},
-{-0.4018484f, -0.7570814f, -0.5151170f, 6.0600000f, 18},
-{-0.4050561f, -0.7616794f, -0.5057410f, 6.1200000f, 37},
-{-0.2199575f, -0.4236245f, 0.8787269f, 5.9600000f, 43},
-{-0.3827044f, -0.7268240f, 0.5703194f, 6.6500000f, 25},
-{-0.3834535f, -0.7276434f, 0.5687692f, 5.8700000f, 62},
-{-0.2419239f, -0.4624547f, 0.8529997f, 6.4600000f, 23},
-{-0.2889843f, -0.5338062f, -0.7946943f, 5.8900000f, 15},
-{-0.1926832f, -0.3518884f, -0.9159955f, 5.7100000f, 52},
-{-0.3865007f, -0.7284989f, 0.5656029f, 4.7400000f, 55},
-{-0.4600835f, -0.8625051f, 0.2107324f, 6.0400000f, 21},
-{-0.4103010f, -0.7619453f, -0.5010912f, 4.7300000f, 14},
-{-0.3925756f, -0.7264574f, -0.5640426f, 5.5400000f, 34},
-{-0.3260652f, -0.6008603f, -0.7298276f, 6.1000000f, 12},
-{-0.3919517f, -0.7228628f, -0.5690722f, 6.1900000f, 51},
-{-0.4511111f, -0.8376728f, 0.3079010f, 5.7000000f, 45},
-{-0.1995240f, -0.3775054f, 0.9042565f, 4.6500000f, 63},
-{-0.1720251f, -0.3270120f, 0.9292311f, 6.4000000f, 52},
-{-0.4244541f, -0.7795017f, -0.4606689f, 6.0400000f, 52},
-{-0.4159554f, -0.7727418f, 0.4794281f, 5.9000000f, 27},
-{-0.2976714f, -0.5414435f, -0.7862765f, 5.7100000f, 19},
-{-0.3312151f, -0.6003666f, -0.7279124f, 2.5500000f, 12},
-{-0.4798291f, -0.8773191f, -0.0086732f, 5.1500000f, 52},
-{-0.4762627f, -0.8683818f, -0.1381552f, 6.1900000f, 38},
-{-0.2866087f, -0.5153045f, -0.8076613f, 6.1400000f, 21},
-{-0.4552607f, -0.8325422f, 0.3156122f, 2.6800000f, 40},
-{-0.2910182f, -0.5220522f, -0.8017293f, 6.0000000f, 46},
-{-0.4159520f, -0.7523962f, -0.5107680f, 6.5100000f, 48},
-{-0.2819519f, -0.5201022f, 0.8062238f, 5.7000000f, 20},
-{-0.3412358f, -0.6135521f, -0.7121180f, 5.8300000f, 51},
-{-0.1094364f, -0.1885096f, -0.9759548f, 6.0900000f, 19},
-{-0.2281769f, -0.4047492f, -0.8855018f, 4.7100000f, 51},
-{-0.2151813f, -0.3783262f, -0.9003146f, 6.2000000f, 50},
-{-0.4696759f, -0.8487729f, 0.2428767f, 6.1600000f, 36},
-{-0.4865014f, -0.8734874f, 0.0183346f, 5.9100000f, 28},
-{-0.4115621f, -0.7411425f, 0.5304002f, 6.3200000f, 34},
-{-0.4514713f, -0.8023645f, -0.3903652f, 6.1400000f, 50},
-{-0.4319911f, -0.7747819f, 0.4616239f, 5.0100000f, 53},
-{-0.3672890f, -0.6473893f, -0.6678217f, 3.8300000f, 12},
-{-0.3608636f, -0.6334316f, -0.6845012f, 3.8700000f, 12},
-{-0.4549954f, -0.7999747f, -0.3911774f, 5.1500000f, 18},
-{-0.3221171f, -0.5619459f, -0.7618776f, 5.9100000f, 48},
-{-0.2466064f, -0.4258965f, -0.8705156f, 6.4900000f, 31},
-{-0.2068572f, -0.3551667f, -0.9116286f, 5.9700000f, 32},
-{-0.4788568f, -0.8406756f, 0.2529044f, 6.0000000f, 55},
-{-0.4598250f, -0.8074001f, 0.3696837f, 5.7600000f, 20},
-{-0.2341755f, -0.4158702f, 0.8787570f, 6.3700000f, 53},
-{-0.4531975f, -0.7849479f, -0.4224557f, 5.7700000f, 37},
-{-0.4988694f, -0.8656220f, -0.0427524f, 6.4000000f, 38},
-{-0.3880832f, -0.6633494f, -0.6398117f, 6.1300000f, 51},
-{-0.3619012f, -0.6160858f, -0.6996183f, 4.3400000f, 36},
-{-0.1328035f, -0.2181445f, -0.9668382f, 5.5000000f, 66},
-{-0.4989812f, -0.8527078f, 0.1546194f, 5.9900000f, 22},
-{-0.4478978f, -0.7666772f, 0.4599932f, 6.2300000f, 27},
-{-0.5060255f, -0.8620973f, 0.0269524f, 4.2600000f, 23},
-{-0.4552136f, -0.7698776f, -0.4472908f, 5.4800000f, 53},
-{-0.2884100f, -0.4826783f, -0.8269470f, 5.9200000f, 52},
-{-0.2600835f, -0.4336085f, -0.8627515f, 0.6100000f, 11},
-{-0.4414673f, -0.7418311f, -0.5047704f, 6.1800000f, 38},
-{-0.3896503f, -0.6519724f, -0.6504650f, 6.1100000f, 20},
-{-0.5022654f, -0.8481861f, 0.1682552f, 6.2000000f, 38},
-{-0.3546658f, -0.6008833f, 0.7163459f, 6.2700000f, 52},
-{-0.4785419f, -0.7973335f, -0.3677729f, 6.3000000f, 35},
-{-0.5042406f, -0.8430393f, 0.1871527f, 6.3000000f, 48},
-{-0.5091429f, -0.8506035f, 0.1313289f, 6.2600000f, 49},
-{-0.5128942f, -0.8541902f, 0.0854314f, 6.2400000f, 34},
-{-0.5142725f, -0.8538383f, -0.0805227f, 6.3900000f, 50},
-{-0.5034191f, -0.8341159f, -0.2254329f, 6.2800000f, 46},
-{-0.3115348f, -0.5095007f, -0.8020942f, 6.1700000f, 25},
-{-0.1540928f, -0.2455220f, -0.9570655f, 6.0200000f, 42},
-{-0.3219499f, -0.5411760f, 0.7768377f, 6.1500000f, 22},
-{-0.2754966f, -0.4477330f, -0.8506684f, 6.4200000f, 10},
-{-0.1843262f, -0.3134136f, 0.9315556f, 6.3400000f, 55},
-{-0.5169578f, -0.8550717f, 0.0400882f, 6.2800000f, 50},
-{-0.5003442f, -0.8226521f, -0.2699983f, 6.5600000f, 24},
-{-0.3955394f, -0.6451666f, -0.6536885f, 4.3600000f, 12},
-{-0.3831975f, -0.6242103f, -0.6808239f, 6.2000000f, 48},
-{-0.4735629f, -0.7699788f, -0.4276340f, 3.2700000f, 52},
-{-0.4267491f, -0.6917531f, -0.5825486f, 2.0600000f, 50},
-{-0.2426944f, -0.3874949f, -0.8893521f, 6.4000000f, 48},
-{-0.5191259f, -0.8412479f, -0.1510308f, 5.4600000f, 32},
-{-0.2233643f, -0.3703179f, 0.9016502f, 3.6500000f, 20},
-{-0.2769191f, -0.4391520f, -0.8546703f, 6.3400000f, 15},
-{-0.1871145f, -0.2922595f, -0.9378553f, 6.0500000f, 54},
-{-0.3928729f, -0.6234793f, -0.6759619f, 6.1700000f, 19},
-{-0.2002396f, -0.3112127f, -0.9290052f, 6.0600000f, 26},
-{-0.3408228f, -0.5371371f, -0.7715722f, 6.0000000f, 19},
-{-0.3264406f, -0.5128370f, -0.7939992f, 4.7500000f, 49},
-{-0.5260760f, -0.8336994f, -0.1678968f, 6.4700000f, 48},
-{-0.3819392f, -0.6116460f, 0.6928287f, 5.2700000f, 64},
-{-0.3451432f, -0.5508013f, 0.7599303f, 5.2500000f, 61},
-{-0.5202371f, -0.8100286f, -0.2705678f, 4.9100000f, 62},
-{-0.2716913f, -0.4315776f, 0.8601887f, 6.4600000f, 50},
-{-0.0888108f, -0.1289432f, -0.9876671f, 4.9100000f, 22},
-{-0.4879217f, -0.7629541f, 0.4240677f, 4.8300000f, 39},
-{-0.1397367f, -0.2259442f, 0.9640658f, 6.4500000f, 27},
-{-0.1328766f, -0.1953111f, -0.9716982f, 6.4700000f, 52},
-{-0.5427279f, -0.8395721f, 0.0237730f, 6.4300000f, 37},
-{-0.3356466f, -0.5106170f, -0.7915881f, 5.5600000f, 55},
-{-0.5003186f, -0.7674261f, -0.4009221f, 6.3400000f, 50},
-{-0.4580679f, -0.7104305f, 0.5342868f, 6.1100000f, 54},
-{-0.3285508f, -0.4979660f, -0.8025486f, 6.1100000f, 15},
-{-0.4889015f, -0.7473571f, -0.4499253f, 5.0800000f, 53},
-{-0.5451200f, -0.8373033f, 0.0420403f, 5.0100000f, 20},
-{-0.4960678f, -0.7550475f, -0.4287424f, 6.2400000f, 50},
-{-0.5400402f, -0.8245088f, -0.1689434f, 4.1900000f, 52},
-{-0.3031839f, -0.4539611f, -0.8378537f, 5.0700000f, 14},
-{-0.5507121f, -0.8345648f, 0.0147572f, 5.9100000f, 37},
-{-0.4237726f, -0.6359610f, -0.6449576f, 5.6100000f, 48},
-{-0.3390646f, -0.5057564f, -0.7932500f, 6.3900000f, 53},
-{-0.2336402f, -0.3442971f, -0.9093249f, 5.7500000f, 11},
-{-0.1149427f, -0.1824405f, 0.9764751f, 4.8200000f, 53},
-{-0.5518448f, -0.8309471f, -0.0706705f, 6.3600000f, 39},
-{-0.5381859f, -0.8124425f, 0.2242613f, 5.5400000f, 36},
-{-0.4873011f, -0.7291485f, -0.4804999f, 6.0800000f, 21},
-{-0.3945106f, -0.5868355f, -0.7070965f, 6.3100000f, 39},
-{-0.2967031f, -0.4375293f, -0.8488436f, 6.3900000f, 65},
-{-0.0906263f, -0.1242930f, -0.9880982f, 6.4200000f, 18},
-{-0.3402024f, -0.5166223f, 0.7857250f, 6.6900000f, 31},
-{-0.3402324f, -0.5165615f, 0.7857519f, 4.5400000f, 28},
-{-0.5464119f, -0.8189488f, 0.1753763f, 5.2900000f, 51},
-{-0.5542061f, -0.8303428f, 0.0581932f, 6.4500000f, 64},
-{-0.5303639f, -0.7907421f, -0.3056815f, 5.4300000f, 21},
-{-0.5145080f, -0.7723235f, 0.3725559f, 6.3900000f, 27},
-{-0.1914232f, -0.2945782f, 0.9362590f, 5.2400000f, 62},
-{-0.4143222f, -0.6236542f, 0.6628669f, 6.2400000f, 53},
-{-0.1021604f, -0.1427247f, -0.9844760f, 5.0600000f, 14},
-{-0.4711850f, -0.6965591f, -0.5411009f, 6.5500000f, 30},
-{-0.5561841f, -0.8244605f, -0.1045188f, 4.0800000f, 36},
-{-0.0797941f, -0.1069400f, -0.9910584f, 4.3200000f, 52},
-{-0.5269882f, -0.7837856f, 0.3285782f, -0.0400000f, 51},
-{-0.5580211f, -0.8245166f, -0.0937270f, 6.4400000f, 29},
-{-0.5603348f, -0.8268207f, -0.0489127f, 6.1500000f, 21},
-{-0.5292460f, -0.7841227f, 0.3241146f, 5.9800000f, 28},
-{-0.5372258f, -0.7885533f, -0.2992860f, 6.2200000f, 45},
-{-0.3385553f, -0.5053383f, 0.7937339f, 6.5800000f, 24},
-{-0.5269184f, -0.7771834f, 0.3440102f, 6.2500000f, 38},
-{-0.4310850f, -0.6366899f, 0.6393682f, 6.3800000f, 32},
-{-0.4774107f, -0.6920678f, -0.5414066f, 6.5400000f, 30},
-{-0.2802153f, -0.4007159f, -0.8722993f, 5.2300000f, 20},
-{-0.3494915f, -0.5173387f, 0.7811634f, 4.7500000f, 29},
-{-0.3887886f, -0.5743283f, 0.7204099f, 4.1800000f, 20},
-{-0.5445984f, -0.7963096f, 0.2632557f, 5.8000000f, 63},
-{-0.5628484f, -0.8188730f, -0.1124662f, 6.4700000f, 45},
-{-0.3973712f, -0.5706612f, -0.7186389f, 3.5500000f, 12},
-{-0.5430195f, -0.7854029f, -0.2971064f, 5.9000000f, 20},
-{-0.5200125f, -0.7495019f, -0.4096754f, 5.8700000f, 35},
-{-0.4563811f, -0.6554354f, -0.6017647f, 5.9400000f, 22},
-{-0.3245973f, -0.4621767f, -0.8252449f, 4.3300000f, 16},
-{-0.5565914f, -0.8015015f, -0.2186353f, 4.5200000f, 22},
-{-0.3526268f, -0.5161974f, 0.7805092f, 6.2000000f, 22},
-{-0.4610561f, -0.6708617f, 0.5808371f, 4.8100000f, 50},
-{-0.4203120f, -0.5993674f, -0.6812463f, 5.5600000f, 48},
-{-0.3785543f, -0.5517277f, 0.7431643f, 6.3200000f, 35},
-{-0.4086970f, -0.5798572f, -0.7047924f, 4.7700000f, 30},
-{-0.5563270f, -0.7999158f, 0.2250219f, 5.4100000f, 35},
-{-0.5716751f, -0.8199217f, -0.0302671f, 5.1400000f, 49},
-{-0.4649631f, -0.6606151f, -0.5894040f, 4.0500000f, 20},
-{-0.5724252f, -0.8199295f, 0.0067049f, 6.1900000f, 27},
-{-0.4442223f, -0.6407715f, 0.6261616f, 6.8600000f, 49},
-{-0.5496557f, -0.7867906f, 0.2807830f, 4.8600000f, 53},
-{-0.3128393f, -0.4360977f, -0.8437716f, 4.9200000f, 48},
-{-0.3278983f, -0.4729718f, 0.8177899f, 6.5300000f, 25},
-{-0.4464770f, -0.6388507f, 0.6265207f, 6.3300000f, 22},
-{-0.4950165f, -0.7060057f, 0.5064728f, 6.4400000f, 25},
-{-0.3925134f, -0.5470205f, -0.7393929f, 6.0900000f, 11},
-{-0.4868143f, -0.6804245f, -0.5477539f, 5.5600000f, 18},
-{-0.3823283f, -0.5294374f, -0.7573118f, 6.0200000f, 52},
-{-0.4574178f, -0.6351790f, -0.6223477f, 4.4200000f, 17},
-{-0.2235153f, -0.3045438f, -0.9259017f, 5.6100000f, 23},
-{-0.3547712f, -0.4891679f, -0.7967761f, 6.0000000f, 51},
-{-0.5243221f, -0.7276819f, -0.4422278f, 4.7700000f, 54},
-{-0.2430880f, -0.3295409f, -0.9123108f, 6.3600000f, 23},
-{-0.5763459f, -0.7974598f, -0.1785589f, 6.2100000f, 47},
-{-0.5850149f, -0.8107330f, 0.0216695f, 6.2700000f, 41},
-{-0.5792334f, -0.8018234f, 0.1468600f, 6.8600000f, 30},
-{-0.5792367f, -0.8018158f, 0.1468887f, 5.1200000f, 20},
-{-0.5284066f, -0.7332381f, 0.4279583f, 6.2200000f, 35},
-{-0.5817643f, -0.8006197f, 0.1433823f, 5.9500000f, 23},
-{-0.1544372f, -0.2019712f, -0.9671385f, 6.0700000f, 50},
-{-0.5429048f, -0.7417175f, -0.3938394f, 5.3200000f, 48},
-{-0.2607933f, -0.3488687f, -0.9001541f, 5.8500000f, 53},
-{-0.5854166f, -0.8043660f, 0.1014036f, 5.1000000f, 25},
-{-0.5806222f, -0.7941797f, -0.1793221f, 6.4900000f, 34},
-{-0.5830084f, -0.8002006f, 0.1406420f, 6.1900000f, 54},
-{-0.4225655f, -0.5703528f, -0.7043693f, 4.5600000f, 12},
-{-0.4238287f, -0.5718318f, -0.7024085f, 4.3500000f, 34},
-{-0.5639328f, -0.7656223f, -0.3095195f, 6.6100000f, 22},
-{-0.4448346f, -0.5999359f, -0.6649806f, 6.3200000f, 52},
-{-0.5377925f, -0.7281461f, -0.4249500f, 6.4800000f, 47},
-{-0.4702112f, -0.6306548f, -0.6173944f, 6.3500000f, 17},
-{-0.4171348f, -0.5575787f, -0.7177078f, 5.8300000f, 21},
-{-0.4647912f, -0.6310805f, 0.6210528f, 6.2700000f, 52},
-{-0.3130436f, -0.4127001f, -0.8553844f, 6.4500000f, 20},
-{-0.3656858f, -0.4978360f, 0.7864052f, 4.0500000f, 37},
-{-0.5631558f, -0.7578984f, 0.3293107f, 5.3900000f, 30},
-{-0.5965902f, -0.7959812f, -0.1024405f, 6.1700000f, 22},
-{-0.5293742f, -0.7013990f, -0.4772866f, 4.9700000f, 18},
-{-0.2466293f, -0.3177378f, -0.9155417f, 5.8300000f, 51},
-{-0.6022294f, -0.7977240f, -0.0309213f, 4.8100000f, 42},
-{-0.6018425f, -0.7936530f, -0.0888846f, 5.4200000f, 55},
-{-0.4525892f, -0.6035872f, 0.6563883f, 6.6300000f, 31},
-{-0.4332219f, -0.5638553f, -0.7031259f, 5.5000000f, 18},
-{-0.4043289f, -0.5252766f, -0.7487340f, 5.3700000f, 21},
-{-0.5315480f, -0.7020363f, 0.4739217f, 7.6200000f, 21},
-{-0.5316316f, -0.7019557f, 0.4739473f, 7.1200000f, 21},
-{-0.4864281f, -0.6439126f, 0.5905626f, 6.1000000f, 50},
-{-0.4745821f, -0.6132536f, -0.6314205f, 6.3900000f, 53},
-{-0.6081495f, -0.7936907f, 0.0144663f, 5.9400000f, 25},
-{-0.4885944f, -0.6300056f, -0.6036294f, 5.9700000f, 51},
-{-0.3895015f, -0.5139404f, 0.7642996f, 5.5900000f, 43},
-{-0.3532178f, -0.4498754f, -0.8202739f, 6.9300000f, 35},
-{-0.5169264f, -0.6747174f, 0.5268239f, 6.0600000f, 20},
-{-0.4528480f, -0.5922292f, 0.6664783f, 6.3500000f, 45},
-{-0.6092580f, -0.7885958f, 0.0831947f, 6.0200000f, 54},
-{-0.4008589f, -0.5102478f, -0.7608938f, 4.4200000f, 12},
-{-0.3736782f, -0.4717181f, -0.7986530f, 5.8700000f, 36},
-{-0.3879815f, -0.4899572f, -0.7806486f, 5.8700000f, 50},
-{-0.5404458f, -0.6845686f, -0.4891668f, 6.0900000f, 50},
-{-0.5306675f, -0.6802629f, 0.5056030f, 3.5800000f, 53},
-{-0.1482780f, -0.1976225f, 0.9689990f, 4.2500000f, 54},
-{-0.4636816f, -0.5822321f, -0.6678362f, 6.6000000f, 22},
-{-0.3135993f, -0.3897369f, -0.8658872f, 6.4000000f, 52},
-{-0.5511580f, -0.7033181f, 0.4489638f, 6.0100000f, 27},
-{-0.5715010f, -0.7279351f, 0.3788101f, 5.9200000f, 32},
-{-0.4833124f, -0.6181760f, 0.6198932f, 3.0300000f, 27},
-{-0.2758121f, -0.3569611f, 0.8924721f, 6.0900000f, 34},
-{-0.3052397f, -0.3916979f, 0.8679870f, 6.2700000f, 30},
-{-0.5893021f, -0.7352734f, -0.3348075f, 6.5000000f, 24},
-{-0.4774357f, -0.5920889f, -0.6492195f, 5.8700000f, 17},
-{-0.4675867f, -0.5799696f, -0.6670816f, 2.3100000f, 11},
-{-0.4956198f, -0.6267854f, 0.6012496f, 6.4300000f, 38},
-{-0.3506239f, -0.4467054f, 0.8231143f, 5.7600000f, 55},
-{-0.2577168f, -0.3132708f, -0.9140260f, 6.0400000f, 37},
-{-0.4398454f, -0.5416319f, -0.7163595f, 5.5500000f, 53},
-{-0.5253835f, -0.6593453f, 0.5378065f, 6.3300000f, 35},
-{-0.4942464f, -0.6081519f, -0.6211858f, 6.1300000f, 51},
-{-0.5425071f, -0.6778867f, 0.4961407f, 4.4600000f, 32},
-{-0.5013548f, -0.6266798f, 0.5965868f, 6.0300000f, 55},
-{-0.4854955f, -0.5956123f, -0.6399532f, 5.7400000f, 18},
-{-0.4413641f, -0.5385940f, -0.7177146f, 5.4100000f, 48},
-{-0.3389425f, -0.4250993f, 0.8392905f, 6.4800000f, 36},
-{-0.4068436f, -0.5084600f, 0.7589115f, 5.7400000f, 61},
-{-0.4206086f, -0.5107535f, -0.7498128f, 4.0500000f, 15},
-{-0.5785711f, -0.7137432f, 0.3947483f, 6.3800000f, 50},
-{-0.6195603f, -0.7583264f, -0.2026971f, 6.2000000f, 35},
-{-0.5074916f, -0.6138518f, -0.6046802f, 6.0200000f, 53},
-{-0.4492898f, -0.5393341f, -0.7122201f, 6.0700000f, 37},
-{-0.4208838f, -0.5042128f, -0.7540731f, 6.3900000f, 33},
-{-0.3287860f, -0.3932295f, -0.8586445f, -0.0100000f, 42},
-{-0.3287944f, -0.3932279f, -0.8586420f, 1.3300000f, 51},
-{-0.3645640f, -0.4323718f, -0.8247107f, 6.3000000f, 50},
-{-0.6046602f, -0.7319919f, 0.3139648f, 5.9100000f, 52},
-{-0.2953554f, -0.3442726f, -0.8912023f, 3.1900000f, 20},
-{-0.4608161f, -0.5579804f, 0.6901495f, 5.7000000f, 52},
-{-0.3499293f, -0.4099741f, -0.8423009f, 6.2200000f, 34},
-{-0.5236816f, -0.6184700f, -0.5858774f, 5.6700000f, 20},
-{-0.3741686f, -0.4528820f, 0.8092563f, 5.8500000f, 21},
-{-0.4564354f, -0.5496002f, 0.6997188f, 5.3900000f, 21},
-{-0.4459720f, -0.5224892f, -0.7267146f, 2.3000000f, 11},
-{-0.1281018f, -0.1424464f, -0.9814779f, 3.8300000f, 53},
-{-0.5239289f, -0.6136588f, -0.5906956f, 4.0000000f, 13},
-{-0.5972156f, -0.7094362f, 0.3742110f, 6.1000000f, 40},
-{-0.6272312f, -0.7428413f, 0.2340252f, 5.9100000f, 30},
-{-0.5672230f, -0.6650039f, -0.4858270f, 6.3700000f, 20},
-{-0.6189038f, -0.7328492f, 0.2826484f, 4.9400000f, 19},
-{-0.6189215f, -0.7328378f, 0.2826391f, 5.8800000f, 26},
-{-0.6281452f, -0.7410220f, 0.2373186f, 4.8300000f, 22},
-{-0.6281452f, -0.7410220f, 0.2373186f, 4.4300000f, 22},
-{-0.1115098f, -0.1406420f, 0.9837608f, 6.2600000f, 53},
-{-0.6417089f, -0.7536944f, 0.1419667f, 4.8600000f, 47},
-{-0.6351508f, -0.7454755f, 0.2021131f, 5.5600000f, 48},
-{-0.3188632f, -0.3626724f, -0.8756683f, 5.3600000f, 29},
-{-0.6055092f, -0.7095660f, 0.3603812f, 6.3800000f, 48},
-{-0.6015468f, -0.6967347f, -0.3907713f, 5.7300000f, 19},
-{-0.5376211f, -0.6203368f, -0.5710917f, 4.0500000f, 53},
-{-0.3539184f, -0.4038331f, -0.8435998f, 6.1100000f, 50},
-{-0.6510843f, -0.7552206f, -0.0757039f, 3.8800000f, 32},
-{-0.3841854f, -0.4373796f, -0.8130810f, 6.1000000f, 12},
-{-0.5413325f, -0.6173438f, -0.5708290f, 4.9200000f, 20},
-{-0.5852869f, -0.6767270f, 0.4466316f, 4.8100000f, 63},
-{-0.0293618f, -0.0228743f, -0.9993071f, 6.4800000f, 20},
-{-0.3123436f, -0.3655351f, 0.8768270f, 6.2500000f, 32},
-{-0.4985230f, -0.5748008f, 0.6489060f, 5.7300000f, 54},
-{-0.4567121f, -0.5140231f, -0.7260815f, 5.7400000f, 21},
-{-0.4135054f, -0.4632055f, -0.7838711f, 5.2100000f, 48},
-{-0.6599512f, -0.7512397f, -0.0101615f, 6.0700000f, 61},
-{-0.6026901f, -0.6812073f, -0.4155974f, 4.9400000f, 32},
-{-0.4122501f, -0.4610564f, -0.7857969f, 6.0700000f, 21},
-{-0.6109757f, -0.6898946f, -0.3882708f, 5.8100000f, 45},
-{-0.2794785f, -0.3083841f, -0.9092805f, 5.9100000f, 12},
-{-0.6609436f, -0.7503311f, 0.0125176f, 5.6900000f, 19},
-{-0.6314130f, -0.7184588f, 0.2917782f, 4.6000000f, 48},
-{-0.6412813f, -0.7250703f, -0.2510605f, 6.3300000f, 51},
-{-0.6198908f, -0.6995409f, -0.3554967f, 6.4000000f, 37},
-{-0.5870501f, -0.6694810f, 0.4551564f, 5.1200000f, 22},
-{-0.5870545f, -0.6694859f, 0.4551435f, 2.7000000f, 50},
-{-0.6249245f, -0.7104296f, 0.3236651f, 6.1300000f, 50},
-{-0.5270150f, -0.5900297f, -0.6116536f, 5.9400000f, 53},
-{-0.4926745f, -0.5494082f, -0.6748500f, 6.3000000f, 48},
-{-0.5549262f, -0.6315018f, 0.5415370f, 6.2800000f, 61},
-{-0.6630692f, -0.7478290f, 0.0330292f, 3.7200000f, 20},
-{-0.6399606f, -0.7227082f, 0.2610428f, 5.6300000f, 65},
-{-0.6236916f, -0.6973876f, -0.3530712f, 6.0600000f, 55},
-{-0.6076360f, -0.6785604f, -0.4127159f, 5.6300000f, 20},
-{-0.3826649f, -0.4208567f, -0.8224641f, 6.2300000f, 51},
-{-0.6011186f, -0.6690957f, -0.4369980f, 5.2400000f, 45},
-{-0.6045594f, -0.6716767f, -0.4282036f, 5.7700000f, 19},
-{-0.6562066f, -0.7293351f, -0.1935542f, 6.3500000f, 50},
-{-0.5473388f, -0.6045046f, -0.5787871f, 6.0400000f, 63},
-{-0.2027142f, -0.2150619f, -0.9553300f, 5.6000000f, 47},
-{-0.6163538f, -0.6767013f, -0.4027201f, 5.6800000f, 51},
-{-0.6719756f, -0.7404255f, 0.0147960f, 6.1400000f, 19},
-{-0.6538128f, -0.7177860f, -0.2393997f, 5.3100000f, 21},
-{-0.6106732f, -0.6759146f, 0.4125745f, 6.1400000f, 32},
-{-0.0896780f, -0.0882444f, -0.9920538f, 5.6500000f, 48},
-{-0.6078439f, -0.6616721f, -0.4389942f, 4.4100000f, 54},
-{-0.3190476f, -0.3403955f, -0.8844996f, 5.8700000f, 43},
-{-0.5025805f, -0.5406517f, -0.6746174f, 4.3200000f, 15},
-{-0.5314789f, -0.5845402f, 0.6130603f, 6.1600000f, 32},
-{-0.6576548f, -0.7134012f, -0.2419689f, 5.1500000f, 34},
-{-0.6522661f, -0.7063695f, -0.2749382f, 2.7500000f, 23},
-{-0.5929920f, -0.6472884f, 0.4789345f, 5.8000000f, 24},
-{-0.4667815f, -0.5124843f, 0.7207461f, 5.7400000f, 37},
-{-0.6183780f, -0.6732864f, 0.4053322f, 5.8500000f, 40},
-{-0.6785551f, -0.7339496f, -0.0296808f, 4.9400000f, 48},
-{-0.6787992f, -0.7343102f, 0.0044894f, 6.1800000f, 53},
-{-0.4207919f, -0.4610750f, 0.7812452f, 6.5100000f, 35},
-{-0.4450467f, -0.4870112f, 0.7515009f, 5.6900000f, 36},
-{-0.3026405f, -0.3169535f, -0.8988599f, 6.0900000f, 13},
-{-0.1773276f, -0.1806363f, -0.9674324f, 5.3400000f, 54},
-{-0.5388762f, -0.5855447f, 0.6055988f, 5.4800000f, 50},
-{-0.5955633f, -0.6355892f, -0.4912543f, 6.2900000f, 41},
-{-0.5525585f, -0.5881492f, -0.5905587f, 5.0300000f, 17},
-{-0.6426025f, -0.6928048f, 0.3272362f, 4.5500000f, 48},
-{-0.0884317f, -0.0848190f, -0.9924644f, 5.6500000f, 48},
-{-0.3478600f, -0.3615537f, -0.8650274f, 5.2000000f, 52},
-{-0.1611292f, -0.1608529f, -0.9737370f, 5.9300000f, 48},
-{-0.6329146f, -0.6650034f, -0.3964715f, 5.3000000f, 52},
-{-0.5809460f, -0.6088111f, -0.5402322f, 5.8200000f, 52},
-{-0.6607928f, -0.7000628f, 0.2706751f, 6.4000000f, 39},
-{-0.3355570f, -0.3452618f, -0.8764678f, 5.1100000f, 14},
-{-0.3473384f, -0.3743043f, 0.8597978f, 5.4600000f, 54},
-{-0.6484410f, -0.6869369f, 0.3280882f, 6.0100000f, 52},
-{-0.6788721f, -0.7130001f, -0.1753954f, 5.8000000f, 47},
-{-0.1833467f, -0.1834534f, -0.9657789f, 6.2000000f, 19},
-{-0.4359343f, -0.4502881f, -0.7792316f, 5.3800000f, 22},
-{-0.0875324f, -0.0794124f, -0.9929913f, 5.9100000f, 19},
-{-0.5874976f, -0.6097277f, -0.5320514f, 5.3200000f, 20},
-{-0.4826543f, -0.4974812f, -0.7208032f, 5.6400000f, 19},
-{-0.4433969f, -0.4550669f, -0.7722133f, 6.6400000f, 62},
-{-0.5444737f, -0.5608893f, -0.6236598f, 6.3600000f, 20},
-{-0.5945364f, -0.6128983f, -0.5204633f, 6.0600000f, 53},
-{-0.1850724f, -0.2007279f, 0.9620065f, 2.0800000f, 54},
-{-0.6851926f, -0.7047938f, -0.1837846f, 5.4600000f, 54},
-{-0.6118508f, -0.6268409f, -0.4823993f, 6.2900000f, 19},
-{-0.4771028f, -0.4848822f, -0.7329817f, 6.3500000f, 43},
-{-0.6733627f, -0.6959493f, 0.2494740f, 5.7700000f, 20},
-{-0.6546041f, -0.6692381f, -0.3515875f, 5.7400000f, 54},
-{-0.5871089f, -0.6080841f, 0.5343564f, 6.1200000f, 22},
-{-0.6969438f, -0.7142888f, -0.0637243f, 4.4900000f, 30},
-{-0.5149396f, -0.5215805f, -0.6802875f, 2.6800000f, 12},
-{-0.5531206f, -0.5598547f, -0.6169443f, 6.1500000f, 52},
-{-0.6995201f, -0.7146070f, 0.0029234f, 5.5300000f, 51},
-{-0.6491639f, -0.6660364f, 0.3673987f, 6.4900000f, 21},
-{-0.6700247f, -0.6866298f, 0.2821461f, 5.7100000f, 45},
-{-0.5244132f, -0.5282639f, -0.6677784f, 3.1300000f, 12},
-{-0.6299432f, -0.6373900f, -0.4437404f, 5.6500000f, 24},
-{-0.6890732f, -0.6998405f, -0.1881527f, 6.6000000f, 21},
-{-0.5692816f, -0.5731115f, -0.5894588f, 6.4700000f, 18},
-{-0.5172478f, -0.5197289f, -0.6799534f, 6.1000000f, 35},
-{-0.4507364f, -0.4651916f, 0.7618619f, 5.6300000f, 37},
-{-0.6910911f, -0.6977978f, -0.1883384f, 5.8700000f, 53},
-{-0.7026715f, -0.7095731f, -0.0525248f, 6.0900000f, 38},
-{-0.7029669f, -0.7067498f, 0.0796383f, 5.9300000f, 62},
-{-0.5606032f, -0.5546824f, -0.6148589f, 5.8900000f, 52},
-{-0.7040589f, -0.6981040f, -0.1301993f, 4.9200000f, 19},
-{-0.5937175f, -0.5836058f, -0.5539890f, 6.2200000f, 28},
-{-0.5465385f, -0.5483779f, 0.6329118f, 5.6400000f, 30},
-{-0.2853103f, -0.2913917f, 0.9130656f, 4.6000000f, 64},
-{-0.7110305f, -0.7028254f, -0.0217276f, 5.5200000f, 60},
-{-0.6304044f, -0.6189202f, -0.4685381f, 5.8500000f, 24},
-{-0.6578999f, -0.6529049f, 0.3753437f, 6.3800000f, 50},
-{-0.3167618f, -0.3037548f, -0.8985516f, 5.1700000f, 48},
-{-0.7126823f, -0.7014827f, 0.0024532f, 5.7100000f, 60},
-{-0.6116518f, -0.5959055f, -0.5203639f, 5.4400000f, 13},
-{-0.0881850f, -0.0959509f, 0.9914721f, 5.6400000f, 39},
-{-0.4810810f, -0.4783808f, 0.7346515f, 6.3700000f, 19},
-{-0.2481332f, -0.2331247f, -0.9402568f, 6.5200000f, 54},
-{-0.7145751f, -0.6976392f, -0.0517889f, 6.6100000f, 25},
-{-0.6466822f, -0.6348923f, 0.4227457f, 4.8100000f, 54},
-{-0.7155205f, -0.6976379f, 0.0364935f, 4.4000000f, 50},
-{-0.5431195f, -0.5339705f, 0.6479944f, 3.5000000f, 48},
-{-0.6536240f, -0.6308117f, -0.4181534f, 3.2900000f, 63},
-{-0.5596134f, -0.5370485f, -0.6311986f, 6.4100000f, 66},
-{-0.4933692f, -0.4718035f, -0.7307450f, 4.7200000f, 15},
-{-0.4933692f, -0.4718035f, -0.7307450f, 4.8200000f, 15},
-{-0.5464558f, -0.5216649f, -0.6551731f, 5.1500000f, 48},
-{-0.3535846f, -0.3491334f, 0.8678040f, 5.9300000f, 24},
-{-0.5855333f, -0.5698953f, 0.5765155f, 5.5100000f, 48},
-{-0.7163589f, -0.6911357f, 0.0957155f, 6.5000000f, 30},
-{-0.3121999f, -0.2912669f, -0.9042648f, 6.1700000f, 53},
-{-0.5098736f, -0.4962201f, 0.7027052f, 6.6500000f, 36},
-{-0.5913778f, -0.5730433f, 0.5673568f, 6.5900000f, 48},
-{-0.6610134f, -0.6284029f, -0.4100866f, 6.6700000f, 18},
-{-0.5893642f, -0.5581546f, -0.5840490f, 6.2700000f, 55},
-{-0.6424366f, -0.6179876f, 0.4531739f, 4.5400000f, 52},
-{-0.4795486f, -0.4494148f, -0.7536972f, 5.7700000f, 48},
-{-0.4841186f, -0.4683659f, 0.7390958f, 4.7600000f, 39},
-{-0.6353832f, -0.6000385f, -0.4860473f, 5.9600000f, 20},
-{-0.6739636f, -0.6370479f, -0.3740896f, 6.1700000f, 51},
-{-0.2884933f, -0.2655195f, -0.9199299f, 5.7600000f, 36},
-{-0.6999732f, -0.6606216f, -0.2713238f, 5.2000000f, 55},
-{-0.3412779f, -0.3143024f, -0.8858574f, 6.2800000f, 20},
-{-0.5654744f, -0.5263839f, -0.6349478f, 5.7900000f, 18},
-{-0.5523093f, -0.5121084f, -0.6577989f, 5.8500000f, 17},
-{-0.5214434f, -0.4826788f, -0.7036462f, 4.0500000f, 13},
-{-0.4828031f, -0.4604506f, 0.7449070f, 5.5700000f, 21},
-{-0.2396536f, -0.2147208f, -0.9468163f, 6.0100000f, 18},
-{-0.2934570f, -0.2834788f, 0.9129747f, 6.1300000f, 22},
-{-0.5848430f, -0.5521650f, 0.5941991f, 6.3500000f, 38},
-{-0.7270158f, -0.6799030f, 0.0958120f, 6.1600000f, 50},
-{-0.3632589f, -0.3307044f, -0.8710210f, 6.3000000f, 42},
-{-0.6919299f, -0.6489705f, 0.3163390f, 6.0200000f, 23},
-{-0.6616471f, -0.6207759f, 0.4205476f, 4.9300000f, 35},
-{-0.4211301f, -0.3986667f, 0.8146866f, 5.2500000f, 47},
-{-0.5874985f, -0.5377540f, -0.6047034f, 5.9800000f, 48},
-{-0.4286790f, -0.3884753f, -0.8156723f, 5.5400000f, 42},
-{-0.6566996f, -0.6102607f, 0.4430886f, 5.6700000f, 52},
-{-0.7145011f, -0.6611143f, 0.2289456f, 6.1000000f, 46},
-{-0.6638365f, -0.6158412f, 0.4243355f, 5.8100000f, 51},
-{-0.6653495f, -0.6080269f, -0.4331435f, 5.7600000f, 50},
-{-0.5271529f, -0.4763958f, -0.7036738f, 6.4400000f, 51},
-{-0.5270667f, -0.4765268f, -0.7036497f, 7.3900000f, 50},
-{-0.2574493f, -0.2271352f, -0.9392175f, 5.8100000f, 35},
-{-0.3701609f, -0.3303329f, -0.8682517f, 6.3200000f, 54},
-{-0.5042020f, -0.4542445f, -0.7344673f, 3.8700000f, 19},
-{-0.5043071f, -0.4542396f, -0.7343982f, 5.6900000f, 23},
-{-0.4701876f, -0.4372121f, 0.7666611f, 6.3900000f, 50},
-{-0.4590516f, -0.4122994f, -0.7869440f, 3.4100000f, 48},
-{-0.5003866f, -0.4484920f, -0.7405864f, 6.3300000f, 52},
-{-0.5408069f, -0.4834310f, -0.6883475f, 4.8200000f, 13},
-{-0.7065475f, -0.6349419f, -0.3124731f, 4.5400000f, 20},
-{-0.6045619f, -0.5390079f, -0.5864941f, 6.1000000f, 18},
-{-0.7029571f, -0.6325475f, 0.3251693f, 5.8900000f, 64},
-{-0.6823751f, -0.6074846f, -0.4066038f, 6.4700000f, 19},
-{-0.7089927f, -0.6310238f, -0.3148623f, 6.0800000f, 23},
-{-0.6791103f, -0.6035874f, -0.4177217f, 6.4500000f, 44},
-{-0.6739718f, -0.5968656f, -0.4353315f, 5.8400000f, 45},
-{-0.7034359f, -0.6293587f, 0.3302810f, 6.6800000f, 45},
-{-0.6469958f, -0.5692923f, -0.5072501f, 4.9100000f, 31},
-{-0.3885090f, -0.3359243f, -0.8580300f, 5.7300000f, 10},
-{-0.7206599f, -0.6344442f, -0.2795172f, 6.1700000f, 19},
-{-0.5055266f, -0.4398479f, -0.7422780f, 5.9500000f, 23},
-{-0.3896124f, -0.3358745f, -0.8575491f, 5.0900000f, 8},
-{-0.6882545f, -0.6114280f, 0.3904633f, 6.3000000f, 22},
-{-0.3519549f, -0.3015331f, -0.8861182f, 4.8600000f, 52},
-{-0.5739547f, -0.4986382f, -0.6495660f, 5.1600000f, 45},
-{-0.5566634f, -0.4831543f, -0.6757868f, 6.0400000f, 13},
-{-0.7490803f, -0.6578225f, -0.0784108f, 6.2800000f, 52},
-{-0.4111825f, -0.3526959f, -0.8405561f, 4.0700000f, 23},
-{-0.2941855f, -0.2492448f, -0.9226765f, 2.8900000f, 21},
-{-0.2796130f, -0.2545733f, 0.9257478f, 6.1700000f, 28},
-{-0.5871244f, -0.5213039f, 0.6192957f, 6.2000000f, 52},
-{-0.6368640f, -0.5629463f, 0.5267786f, 5.9900000f, 55},
-{-0.7495920f, -0.6562760f, 0.0861028f, 5.3300000f, 50},
-{-0.6552356f, -0.5772276f, 0.4873136f, 5.2600000f, 22},
-{-0.5554487f, -0.4906783f, 0.6713506f, 6.1300000f, 62},
-{-0.7027278f, -0.6088114f, -0.3681336f, 5.5000000f, 55},
-{-0.7541734f, -0.6566432f, 0.0064965f, 5.6300000f, 24},
-{-0.3870635f, -0.3282102f, -0.8616611f, 5.4600000f, 7},
-{-0.6294957f, -0.5496119f, 0.5492376f, 3.4700000f, 48},
-{-0.5747502f, -0.4902040f, -0.6552574f, 6.2800000f, 20},
-{-0.5280738f, -0.4488966f, -0.7208536f, 4.2700000f, 18},
-{-0.3059880f, -0.2552149f, -0.9171895f, 6.2800000f, 13},
-{-0.7490325f, -0.6453697f, -0.1498277f, 2.6100000f, 18},
-{-0.6591028f, -0.5637647f, -0.4977479f, 4.3400000f, 49},
-{-0.5912335f, -0.5007819f, -0.6321871f, 5.5900000f, 17},
-{-0.6548951f, -0.5559402f, -0.5119013f, 6.1800000f, 46},
-{-0.6115043f, -0.5152690f, -0.6004667f, 6.2000000f, 46},
-{-0.7616173f, -0.6479770f, 0.0080527f, 5.8900000f, 55},
-{-0.2891734f, -0.2544067f, 0.9228521f, 5.1300000f, 39},
-{-0.7129945f, -0.6067612f, 0.3513969f, 5.7000000f, 48},
-{-0.2699660f, -0.2370353f, 0.9332377f, 6.5100000f, 21},
-{-0.7637525f, -0.6447738f, 0.0308050f, 5.0600000f, 38},
-{-0.5953153f, -0.4934875f, -0.6340897f, 3.2200000f, 11},
-{-0.5966523f, -0.4936449f, -0.6327091f, 6.2000000f, 21},
-{-0.6087666f, -0.5040557f, -0.6126427f, 6.4800000f, 20},
-{-0.5355816f, -0.4409568f, -0.7202149f, 5.0000000f, 38},
-{-0.5191224f, -0.4286802f, -0.7394222f, 5.6500000f, 43},
-{-0.3951041f, -0.3223156f, -0.8602357f, 5.6700000f, 37},
-{-0.7315880f, -0.6090225f, -0.3063830f, 6.1700000f, 48},
-{-0.6447894f, -0.5434281f, 0.5375245f, 6.3200000f, 22},
-{-0.7445776f, -0.6191304f, -0.2495632f, 6.3000000f, 30},
-{-0.4030947f, -0.3282341f, -0.8542699f, 4.5100000f, 15},
-{-0.6258843f, -0.5168266f, -0.5840883f, 3.5600000f, 55},
-{-0.7679471f, -0.6399145f, -0.0276890f, 6.3500000f, 50},
-{-0.7671537f, -0.6373180f, -0.0728079f, 5.5400000f, 51},
-{-0.5628440f, -0.4611680f, -0.6859524f, 3.3700000f, 12},
-{-0.6663106f, -0.5583995f, 0.4941863f, 5.5100000f, 50},
-{-0.7688749f, -0.6392774f, 0.0124836f, 5.3500000f, 53},
-{-0.6973374f, -0.5793777f, 0.4219503f, 6.3900000f, 50},
-{-0.6336008f, -0.5169517f, -0.5755961f, 4.5400000f, 14},
-{-0.2973338f, -0.2359914f, -0.9251490f, 5.8900000f, 48},
-{-0.2364013f, -0.2035197f, 0.9501022f, 5.0200000f, 54},
-{-0.4722097f, -0.3959268f, 0.7875658f, 5.6600000f, 24},
-{-0.5483842f, -0.4573290f, 0.7000893f, 6.1900000f, 33},
-{-0.7541831f, -0.6195665f, 0.2175896f, 6.2800000f, 20},
-{-0.6471805f, -0.5343962f, 0.5436710f, 5.3700000f, 19},
-{-0.6115818f, -0.4919514f, -0.6196382f, 5.3700000f, 20},
-{-0.7608397f, -0.6168308f, -0.2016003f, 5.7200000f, 46},
-{-0.7762865f, -0.6301494f, -0.0170598f, 6.1200000f, 30},
-{-0.6162118f, -0.4940762f, -0.6133284f, 7.0300000f, 22},
-{-0.7666228f, -0.6197012f, -0.1681071f, 4.9400000f, 35},
-{-0.6213856f, -0.4972157f, -0.6055217f, 4.6000000f, 20},
-{-0.3514563f, -0.2756967f, -0.8946898f, 5.7100000f, 55},
-{-0.5960378f, -0.4886191f, 0.6371737f, 5.5000000f, 54},
-{-0.6691789f, -0.5457447f, 0.5043434f, 5.5800000f, 40},
-{-0.6691789f, -0.5457447f, 0.5043434f, 6.0800000f, 43},
-{-0.0931522f, -0.0632587f, -0.9936403f, 5.5700000f, 22},
-{-0.2383017f, -0.1803679f, -0.9542954f, 5.4900000f, 13},
-{-0.3625016f, -0.2971755f, 0.8833342f, 5.9800000f, 20},
-{-0.5470830f, -0.4426832f, 0.7104447f, 6.0100000f, 52},
-{-0.6186315f, -0.4987717f, 0.6070600f, 4.3100000f, 32},
-{-0.6189287f, -0.4989000f, 0.6066515f, 6.5000000f, 41},
-{-0.2394676f, -0.1996438f, 0.9501566f, 3.0500000f, 23},
-{-0.6421318f, -0.5048392f, -0.5768918f, 5.4500000f, 14},
-{-0.3470031f, -0.2844236f, 0.8936957f, 5.7900000f, 54},
-{-0.5030457f, -0.3914224f, -0.7705411f, 6.1000000f, 42},
-{-0.7538569f, -0.6007735f, 0.2660282f, 5.1700000f, 61},
-{-0.7375202f, -0.5872370f, 0.3334915f, 6.2700000f, 40},
-{-0.6468852f, -0.5132206f, 0.5640426f, 5.4600000f, 54},
-{-0.5572488f, -0.4298952f, -0.7103970f, 5.2400000f, 54},
-{-0.7608057f, -0.5930356f, -0.2635971f, 5.6400000f, 55},
-{-0.4019669f, -0.3228145f, 0.8568625f, 3.2900000f, 52},
-{-0.7127319f, -0.5586105f, 0.4242258f, 6.0200000f, 61},
-{-0.7893098f, -0.6131529f, 0.0321473f, 5.1700000f, 28},
-{-0.6880998f, -0.5384330f, 0.4864243f, 3.6800000f, 30},
-{-0.4606476f, -0.3646414f, 0.8092221f, 6.4500000f, 22},
-{-0.7504116f, -0.5726701f, -0.3300476f, 6.2200000f, 25},
-{-0.7666241f, -0.5846809f, -0.2653972f, 5.8200000f, 46},
-{-0.6347959f, -0.4780346f, -0.6070561f, 6.2500000f, 27},
-{-0.5367439f, -0.4165601f, 0.7337463f, 6.1500000f, 20},
-{-0.6833457f, -0.5156940f, -0.5168156f, 6.4600000f, 17},
-{-0.3661979f, -0.2869295f, 0.8851952f, 6.5000000f, 25},
-{-0.3858064f, -0.3018137f, 0.8718153f, 5.9000000f, 55},
-{-0.7505701f, -0.5670170f, -0.3393172f, 6.2200000f, 28},
-{-0.1966146f, -0.1385615f, -0.9706407f, 6.1800000f, 52},
-{-0.7868950f, -0.5987844f, 0.1491758f, 6.5700000f, 34},
-{-0.4512326f, -0.3495496f, 0.8210994f, 6.4300000f, 23},
-{-0.6788455f, -0.5191183f, 0.5193120f, 6.4600000f, 24},
-{-0.6362160f, -0.4861380f, 0.5990818f, 6.3700000f, 50},
-{-0.7596379f, -0.5692560f, -0.3144803f, 5.5200000f, 22},
-{-0.6021295f, -0.4581602f, 0.6538572f, 5.0200000f, 54},
-{-0.7732147f, -0.5778073f, -0.2613001f, 5.5000000f, 12},
-{-0.7351019f, -0.5481693f, -0.3989180f, 7.0000000f, 23},
-{-0.3500557f, -0.2536542f, -0.9017320f, 6.5100000f, 33},
-{-0.6164389f, -0.4560298f, -0.6419033f, 5.8200000f, 62},
-{-0.3704318f, -0.2859066f, 0.8837634f, 6.3800000f, 55},
-{-0.6396991f, -0.4847959f, 0.5964545f, 6.3800000f, 36},
-{-0.7678895f, -0.5777975f, 0.2765786f, 6.2200000f, 19},
-{-0.3338989f, -0.2409927f, -0.9112815f, 4.1100000f, 51},
-{-0.8010817f, -0.5983866f, -0.0141997f, 5.5100000f, 50},
-{-0.6284932f, -0.4635839f, -0.6245689f, 6.3600000f, 19},
-{-0.6032262f, -0.4554583f, 0.6547335f, 5.0200000f, 25},
-{-0.7114951f, -0.5234979f, -0.4687480f, 5.1500000f, 54},
-{-0.6104469f, -0.4470182f, -0.6538572f, 2.7800000f, 12},
-{-0.7922566f, -0.5852856f, -0.1725404f, 4.6200000f, 51},
-{-0.6840521f, -0.5111314f, 0.5204012f, 4.1400000f, 16},
-{-0.8024851f, -0.5919314f, -0.0750657f, 6.5100000f, 37},
-{-0.7954939f, -0.5862566f, -0.1532733f, 5.1700000f, 16},
-{-0.5910663f, -0.4298816f, -0.6825265f, 4.5400000f, 13},
-{-0.2458613f, -0.1715896f, -0.9539964f, 5.6500000f, 17},
-{-0.7678670f, -0.5688142f, 0.2946705f, 6.4500000f, 33},
-{-0.5862119f, -0.4251203f, -0.6896582f, 5.4300000f, 54},
-{-0.3462547f, -0.2634692f, 0.9003842f, 5.7900000f, 50},
-{-0.2004635f, -0.1378907f, -0.9699487f, 5.9500000f, 19},
-{-0.7864243f, -0.5738560f, -0.2285302f, 3.9100000f, 48},
-{-0.7923409f, -0.5820234f, 0.1828790f, 3.8000000f, 30},
-{-0.7923366f, -0.5820202f, 0.1829076f, 3.8000000f, 30},
-{-0.6796202f, -0.4929127f, -0.5432803f, 6.2400000f, 18},
-{-0.8063002f, -0.5907891f, 0.0291235f, 6.5600000f, 30},
-{-0.2833902f, -0.1980789f, -0.9383255f, 6.4400000f, 21},
-{-0.7196425f, -0.5291700f, 0.4495485f, 2.2300000f, 20},
-{-0.7175294f, -0.5164284f, -0.4673899f, 3.5800000f, 53},
-{-0.7698168f, -0.5616002f, 0.3032940f, 6.1200000f, 48},
-{-0.7931523f, -0.5768407f, 0.1953566f, 6.0700000f, 50},
-{-0.6104729f, -0.4352318f, -0.6617372f, 4.3300000f, 54},
-{-0.5066772f, -0.3586645f, -0.7839885f, 5.4400000f, 20},
-{-0.8104161f, -0.5857727f, 0.0098028f, 6.5100000f, 48},
-{-0.6271374f, -0.4587851f, 0.6294560f, 5.1100000f, 61},
-{-0.7322571f, -0.5248489f, -0.4339736f, 6.1900000f, 17},
-{-0.7979458f, -0.5771214f, 0.1738201f, 5.2600000f, 50},
-{-0.4328953f, -0.3032808f, -0.8488948f, 5.9500000f, 36},
-{-0.7784141f, -0.5630207f, 0.2776314f, 5.9300000f, 33},
-{-0.6351961f, -0.4508058f, -0.6271364f, 6.5700000f, 19},
-{-0.7497182f, -0.5357483f, -0.3884539f, 5.7800000f, 50},
-{-0.6352178f, -0.4501547f, -0.6275819f, 6.0400000f, 23},
-{-0.6338915f, -0.4613032f, 0.6207906f, 6.4200000f, 52},
-{-0.7207813f, -0.5128877f, -0.4662837f, 6.3200000f, 51},
-{-0.7607665f, -0.5412900f, -0.3581054f, 5.8400000f, 49},
-{-0.4753171f, -0.3476513f, 0.8082155f, 5.9700000f, 54},
-{-0.7187967f, -0.5096116f, -0.4728925f, 3.6600000f, 12},
-{-0.7026637f, -0.5063577f, 0.4998656f, 6.5200000f, 35},
-{-0.7733214f, -0.5469935f, -0.3205808f, 5.3800000f, 48},
-{-0.8093585f, -0.5737650f, -0.1254294f, 6.5000000f, 36},
-{-0.8093567f, -0.5737549f, -0.1254871f, 6.4800000f, 36},
-{-0.4974122f, -0.3611645f, 0.7887594f, 6.7400000f, 34},
-{-0.4682248f, -0.3403361f, 0.8154366f, 5.7400000f, 22},
-{-0.7533798f, -0.5306883f, -0.3883154f, 6.3400000f, 20},
-{-0.6818968f, -0.4785047f, -0.5532179f, 4.6700000f, 48},
-{-0.5679812f, -0.3941266f, -0.7225383f, 6.2300000f, 55},
-{-0.7042698f, -0.4919605f, -0.5118388f, 6.3400000f, 52},
-{-0.6200748f, -0.4430030f, 0.6474994f, 5.2400000f, 47},
-{-0.7591785f, -0.5301932f, -0.3775490f, 4.9600000f, 53},
-{-0.5979301f, -0.4140715f, -0.6863122f, 4.6400000f, 35},
-{-0.1745676f, -0.1322461f, 0.9757239f, 4.9600000f, 55},
-{-0.6712164f, -0.4751818f, 0.5689207f, 6.1100000f, 50},
-{-0.4719690f, -0.3381043f, 0.8142056f, 5.8700000f, 51},
-{-0.1312820f, -0.1014815f, 0.9861372f, 6.5800000f, 40},
-{-0.5577914f, -0.3968781f, 0.7289421f, 5.7500000f, 32},
-{-0.8015176f, -0.5603257f, 0.2088174f, 6.2500000f, 47},
-{-0.5469819f, -0.3737556f, -0.7490778f, 6.0400000f, 52},
-{-0.6560492f, -0.4620634f, 0.5967385f, 6.0000000f, 19},
-{-0.6560731f, -0.4620445f, 0.5967268f, 5.0700000f, 17},
-{-0.5196025f, -0.3686768f, 0.7707728f, 5.8400000f, 48},
-{-0.4180122f, -0.2821696f, -0.8635080f, 6.4800000f, 40},
-{-0.6631016f, -0.4530230f, -0.5958745f, 5.2400000f, 48},
-{-0.7822259f, -0.5378770f, -0.3143423f, 4.7400000f, 60},
-{-0.6903027f, -0.4714077f, -0.5488688f, 4.7500000f, 15},
-{-0.7896881f, -0.5478942f, 0.2760521f, 6.0100000f, 48},
-{-0.4338786f, -0.3061858f, 0.8473486f, 6.4500000f, 51},
-{-0.7749897f, -0.5348708f, 0.3366068f, 4.5200000f, 21},
-{-0.8029881f, -0.5529625f, 0.2223569f, 5.3300000f, 20},
-{-0.2876783f, -0.2058594f, 0.9353412f, 5.6200000f, 55},
-{-0.7814959f, -0.5375508f, 0.3167069f, 5.8100000f, 22},
-{-0.6340985f, -0.4261902f, -0.6451984f, 5.9400000f, 20},
-{-0.7995692f, -0.5422909f, -0.2580884f, 6.3100000f, 50},
-{-0.8034264f, -0.5415440f, -0.2474594f, 5.4100000f, 30},
-{-0.7404894f, -0.5053959f, 0.4430016f, 3.8400000f, 19},
-{-0.8036038f, -0.5462482f, 0.2362917f, 6.4800000f, 45},
-{-0.3601882f, -0.2341474f, -0.9030169f, 6.1800000f, 25},
-{-0.3601899f, -0.2341447f, -0.9030169f, 6.3900000f, 30},
-{-0.8283121f, -0.5585458f, 0.0438809f, 5.8800000f, 42},
-{-0.8244797f, -0.5547152f, 0.1119122f, 2.6500000f, 52},
-{-0.6990561f, -0.4715711f, 0.5375327f, 5.5600000f, 49},
-{-0.7371520f, -0.4869241f, -0.4685210f, 6.5100000f, 32},
-{-0.5045547f, -0.3440388f, 0.7918724f, 5.5100000f, 19},
-{-0.7933178f, -0.5315730f, 0.2967777f, 6.1400000f, 20},
-{-0.8286591f, -0.5516462f, 0.0949240f, 5.5800000f, 20},
-{-0.6983069f, -0.4589782f, -0.5492781f, 5.6100000f, 17},
-{-0.8329693f, -0.5531005f, 0.0155570f, 6.3300000f, 50},
-{-0.6432273f, -0.4200215f, -0.6401879f, 6.4200000f, 45},
-{-0.8341057f, -0.5515941f, -0.0034131f, 5.4000000f, 18},
-{-0.6767847f, -0.4416815f, -0.5889652f, 6.0100000f, 46},
-{-0.5226098f, -0.3366753f, -0.7832807f, 6.0700000f, 52},
-{-0.8313070f, -0.5462917f, -0.1024405f, 6.2400000f, 50},
-{-0.8042976f, -0.5314030f, 0.2659253f, 3.6700000f, 22},
-{-0.8280856f, -0.5457972f, 0.1279830f, 4.4300000f, 40},
-{-0.5101874f, -0.3246654f, -0.7964302f, 5.7700000f, 19},
-{-0.8117045f, -0.5307178f, 0.2438736f, 5.7100000f, 23},
-{-0.5741764f, -0.3659375f, -0.7324010f, 5.8400000f, 21},
-{-0.6009870f, -0.3818702f, -0.7021323f, 6.1200000f, 29},
-{-0.4859159f, -0.3062543f, -0.8185927f, 5.7300000f, 12},
-{-0.8150127f, -0.5281554f, 0.2383404f, 6.0000000f, 52},
-{-0.8403037f, -0.5407780f, -0.0380632f, 5.5300000f, 25},
-{-0.3613707f, -0.2237429f, -0.9051797f, 6.5400000f, 25},
-{-0.7133418f, -0.4631021f, 0.5260037f, 6.4400000f, 55},
-{-0.4734114f, -0.3116241f, 0.8238762f, 5.9200000f, 53},
-{-0.7986469f, -0.5149888f, 0.3113676f, 4.0900000f, 60},
-{-0.7406217f, -0.4783355f, 0.4718841f, 5.8500000f, 40},
-{-0.8416522f, -0.5381556f, -0.0448351f, 3.5300000f, 20},
-{-0.5782715f, -0.3630128f, -0.7306325f, 6.0100000f, 52},
-{-0.7142049f, -0.4508113f, -0.5354256f, 3.9500000f, 19},
-{-0.4075644f, -0.2512749f, -0.8779249f, 6.1900000f, 53},
-{-0.7710649f, -0.4866077f, -0.4106968f, 4.6400000f, 13},
-{-0.3844985f, -0.2528886f, 0.8878109f, 5.1900000f, 22},
-{-0.4760192f, -0.3102144f, 0.8229050f, 5.8600000f, 23},
-{-0.8434544f, -0.5358319f, 0.0383248f, 5.2300000f, 48},
-{-0.7567397f, -0.4839785f, 0.4394428f, 4.6300000f, 43},
-{-0.5533476f, -0.3428951f, -0.7590978f, 6.6000000f, 53},
-{-0.3290092f, -0.1986799f, -0.9231897f, 5.0900000f, 45},
-{-0.8427206f, -0.5326601f, 0.0780724f, 3.7100000f, 22},
-{-0.7484278f, -0.4667015f, -0.4712171f, 6.4000000f, 51},
-{-0.8157114f, -0.5161946f, 0.2610708f, 5.2000000f, 67},
-{-0.8452417f, -0.5319681f, -0.0507576f, 5.1100000f, 23},
-{-0.8225245f, -0.5157686f, -0.2396586f, 6.1900000f, 48},
-{-0.3939826f, -0.2387414f, -0.8875698f, 2.8500000f, 32},
-{-0.4368823f, -0.2654284f, -0.8594659f, 6.1500000f, 19},
-{-0.7902480f, -0.4973328f, 0.3580058f, 4.7600000f, 55},
-{-0.4303625f, -0.2597692f, -0.8644698f, 5.7700000f, 45},
-{-0.6876054f, -0.4328756f, 0.5829387f, 4.8200000f, 51},
-{-0.8006378f, -0.4938327f, -0.3392761f, 5.0300000f, 12},
-{-0.1753049f, -0.1181797f, 0.9773954f, 4.3200000f, 23},
-{-0.7739941f, -0.4761101f, -0.4174354f, 4.5900000f, 12},
-{-0.4349372f, -0.2610784f, -0.8617817f, 5.7600000f, 23},
-{-0.7819021f, -0.4796353f, -0.3982199f, 5.3900000f, 16},
-{-0.7902838f, -0.4846186f, -0.3749617f, 5.4200000f, 12},
-{-0.8221508f, -0.5046786f, -0.2633773f, 4.1500000f, 48},
-{-0.8112856f, -0.5023488f, 0.2991009f, 6.3600000f, 50},
-{-0.7629992f, -0.4652799f, -0.4487169f, 6.1400000f, 16},
-{-0.8283468f, -0.5115891f, 0.2282942f, 6.1000000f, 40},
-{-0.7756393f, -0.4722530f, -0.4187610f, 5.8700000f, 18},
-{-0.8183842f, -0.5035636f, 0.2768954f, 6.0900000f, 35},
-{-0.6268786f, -0.3891547f, 0.6749680f, 4.6200000f, 38},
-{-0.8101885f, -0.4916103f, -0.3192396f, 5.9400000f, 15},
-{-0.7344264f, -0.4434424f, -0.5137867f, 6.2100000f, 54},
-{-0.7711413f, -0.4656336f, -0.4341963f, 5.6200000f, 23},
-{-0.6743955f, -0.4047839f, -0.6175279f, 6.0300000f, 16},
-{-0.8446078f, -0.5141776f, 0.1491950f, 6.2900000f, 27},
-{-0.3655593f, -0.2132556f, -0.9060289f, 5.7500000f, 17},
-{-0.5769559f, -0.3430369f, -0.7412473f, 6.3100000f, 31},
-{-0.4767062f, -0.2970795f, 0.8273421f, 5.8100000f, 48},
-{-0.7411710f, -0.4443214f, -0.5032336f, 6.2900000f, 36},
-{-0.8008563f, -0.4879978f, 0.3471130f, 5.4400000f, 60},
-{-0.7283457f, -0.4337864f, -0.5304167f, 5.1200000f, 23},
-{-0.7283501f, -0.4337388f, -0.5304495f, 5.6200000f, 19},
-{-0.8336550f, -0.4997230f, -0.2351515f, 6.3700000f, 37},
-{-0.7529810f, -0.4484883f, -0.4815370f, 3.8800000f, 12},
-{-0.6975432f, -0.4135330f, -0.5851700f, 5.8000000f, 50},
-{-0.8358351f, -0.4994613f, -0.2278552f, 6.1300000f, 22},
-{-0.8115801f, -0.4892706f, 0.3192993f, 6.2600000f, 18},
-{-0.6232214f, -0.3795518f, 0.6837657f, 5.3700000f, 63},
-{-0.8263222f, -0.4942825f, 0.2699563f, 3.8500000f, 36},
-{-0.8139186f, -0.4809987f, -0.3258478f, 5.8500000f, 13},
-{-0.6935630f, -0.4064569f, -0.5947799f, 6.3100000f, 50},
-{-0.6755789f, -0.4067584f, 0.6149315f, 5.4500000f, 30},
-{-0.5091667f, -0.2942638f, -0.8088004f, 6.1000000f, 15},
-{-0.6304890f, -0.3806730f, 0.6764405f, 5.7500000f, 19},
-{-0.4047834f, -0.2309351f, -0.8847708f, 6.4100000f, 38},
-{-0.8328780f, -0.4943138f, 0.2489341f, 5.5400000f, 51},
-{-0.8374503f, -0.4923612f, -0.2371867f, 4.8800000f, 15},
-{-0.7933180f, -0.4645997f, -0.3934383f, 5.4300000f, 15},
-{-0.6600987f, -0.3830115f, -0.6461980f, 4.9900000f, 50},
-{-0.7768697f, -0.4537311f, -0.4365794f, 2.8900000f, 11},
-{-0.6696567f, -0.3867564f, -0.6340184f, 6.4900000f, 51},
-{-0.5175089f, -0.2954613f, -0.8030487f, 6.1300000f, 25},
-{-0.7677355f, -0.4540903f, 0.4520888f, 4.1500000f, 52},
-{-0.6863250f, -0.3957643f, -0.6101874f, 3.4100000f, 12},
-{-0.4424067f, -0.2662760f, 0.8563722f, 6.3100000f, 20},
-{-0.6621260f, -0.3919768f, 0.6387044f, 6.3100000f, 50},
-{-0.4167475f, -0.2336925f, -0.8784699f, 6.2500000f, 19},
-{-0.6691240f, -0.3828427f, -0.6369495f, 6.2100000f, 20},
-{-0.8071138f, -0.4644235f, -0.3645247f, 2.3200000f, 10},
-{-0.8353490f, -0.4807027f, -0.2666777f, 5.4700000f, 38},
-{-0.2773639f, -0.1507060f, -0.9488714f, 5.7000000f, 51},
-{-0.7516512f, -0.4281911f, -0.5016701f, 6.3300000f, 54},
-{-0.6930399f, -0.4043243f, 0.5968397f, 5.6200000f, 55},
-{-0.7779296f, -0.4513885f, 0.4371201f, 2.0000000f, 10},
-{-0.8601511f, -0.4926464f, -0.1320594f, 5.5500000f, 20},
-{-0.4970199f, -0.2933809f, 0.8166388f, 4.9500000f, 30},
-{-0.4856817f, -0.2705167f, -0.8312244f, 4.6300000f, 27},
-{-0.5753463f, -0.3215007f, -0.7520731f, 4.6500000f, 48},
-{-0.8652876f, -0.4952958f, 0.0771976f, 5.8300000f, 50},
-{-0.5567385f, -0.3244416f, 0.7647090f, 6.0500000f, 30},
-{-0.7634610f, -0.4290624f, -0.4827348f, 6.0300000f, 53},
-{-0.8270435f, -0.4715539f, 0.3059999f, 5.1200000f, 48},
-{-0.6938288f, -0.3869604f, -0.6073412f, 4.8900000f, 16},
-{-0.7256983f, -0.4145818f, 0.5490755f, 5.4100000f, 40},
-{-0.7968952f, -0.4447159f, -0.4088836f, 5.0000000f, 55},
-{-0.7409544f, -0.4125299f, -0.5299110f, 6.0100000f, 34},
-{-0.7538389f, -0.4289220f, 0.4977479f, 4.9900000f, 20},
-{-0.8029063f, -0.4528992f, 0.3875871f, 4.8300000f, 23},
-{-0.8032788f, -0.4456696f, -0.3951224f, 6.2100000f, 50},
-{-0.7358225f, -0.4066288f, -0.5414963f, 6.1000000f, 29},
-{-0.7073939f, -0.3896504f, -0.5897172f, 5.9000000f, 33},
-{-0.8708065f, -0.4838804f, 0.0869239f, 6.0800000f, 49},
-{-0.8603836f, -0.4751124f, -0.1844136f, 5.0700000f, 35},
-{-0.8603836f, -0.4751124f, -0.1844136f, 4.7700000f, 35},
-{-0.4954880f, -0.2651219f, -0.8271650f, 6.1600000f, 32},
-{-0.6240168f, -0.3370880f, -0.7049644f, 4.7200000f, 20},
-{-0.5249324f, -0.2967153f, 0.7977506f, 5.9300000f, 55},
-{-0.6053862f, -0.3397327f, 0.7197842f, 4.7600000f, 19},
-{-0.7007199f, -0.3911244f, 0.5966685f, 5.8300000f, 22},
-{-0.8337616f, -0.4553527f, -0.3122428f, 2.6200000f, 11},
-{-0.8337542f, -0.4553251f, -0.3123027f, 4.9200000f, 12},
-{-0.4537886f, -0.2570332f, 0.8532349f, 4.0100000f, 38},
-{-0.7191448f, -0.3880632f, -0.5764006f, 4.2300000f, 12},
-{-0.8127463f, -0.4408032f, -0.3809673f, 5.9200000f, 18},
-{-0.8739234f, -0.4757780f, -0.0994645f, 6.5300000f, 32},
-{-0.8742169f, -0.4746775f, -0.1021077f, 6.4100000f, 50},
-{-0.7198818f, -0.3857007f, -0.5770660f, 5.7300000f, 31},
-{-0.8692943f, -0.4738071f, 0.1408340f, 6.2900000f, 23},
-{-0.8308517f, -0.4473363f, -0.3310222f, 3.9600000f, 11},
-{-0.4943902f, -0.2592580f, -0.8296768f, 5.5700000f, 19},
-{-0.4441627f, -0.2483486f, 0.8608383f, 6.1900000f, 61},
-{-0.8551009f, -0.4591898f, -0.2407222f, 6.3200000f, 44},
-{-0.8330276f, -0.4457066f, -0.3277355f, 4.3200000f, 43},
-{-0.8092283f, -0.4308859f, -0.3993581f, 6.3300000f, 17},
-{-0.6881056f, -0.3636799f, -0.6278914f, 7.0500000f, 27},
-{-0.6879925f, -0.3636073f, -0.6280574f, 6.6500000f, 20},
-{-0.7960156f, -0.4226849f, -0.4332397f, 5.3800000f, 62},
-{-0.8651771f, -0.4619292f, -0.1951664f, 5.7800000f, 19},
-{-0.8182033f, -0.4317167f, -0.3796894f, 5.8800000f, 19},
-{-0.8690641f, -0.4639152f, 0.1717858f, 5.6300000f, 27},
-{-0.8184744f, -0.4380807f, 0.3717324f, 6.1400000f, 54},
-{-0.7566964f, -0.3958927f, -0.5202687f, 6.1900000f, 50},
-{-0.7482686f, -0.3900359f, -0.5366248f, 5.5400000f, 18},
-{-0.8443020f, -0.4485690f, 0.2931551f, 5.0000000f, 48},
-{-0.8442812f, -0.4485264f, 0.2932803f, 6.2500000f, 51},
-{-0.8741147f, -0.4624944f, 0.1483992f, 5.7300000f, 63},
-{-0.8833425f, -0.4648392f, 0.0602549f, 5.9100000f, 55},
-{-0.8450594f, -0.4402851f, -0.3033540f, 6.4700000f, 34},
-{-0.8449491f, -0.4456010f, 0.2958053f, 6.1400000f, 20},
-{-0.8798852f, -0.4620154f, 0.1111028f, 5.9700000f, 51},
-{-0.6726121f, -0.3453233f, -0.6544806f, 5.8600000f, 30},
-{-0.8858252f, -0.4619095f, -0.0441958f, 5.3700000f, 54},
-{-0.7807221f, -0.4019546f, -0.4784407f, 5.1300000f, 53},
-{-0.7114413f, -0.3744197f, 0.5946942f, 4.7600000f, 51},
-{-0.5195028f, -0.2607811f, -0.8137015f, 5.8100000f, 32},
-{-0.1993243f, -0.0925796f, -0.9755505f, 4.6800000f, 65},
-{-0.1989227f, -0.0922876f, -0.9756602f, 5.2700000f, 53},
-{-0.5460670f, -0.2744043f, -0.7915258f, 5.8300000f, 60},
-{-0.6261592f, -0.3302410f, 0.7063041f, 4.2600000f, 19},
-{-0.5333578f, -0.2674400f, -0.8024994f, 4.9400000f, 48},
-{-0.3321648f, -0.1797351f, 0.9259383f, 5.4400000f, 20},
-{-0.8446703f, -0.4304894f, -0.3181367f, 6.3000000f, 18},
-{-0.8447583f, -0.4304491f, -0.3179574f, 4.0100000f, 13},
-{-0.8008679f, -0.4067283f, -0.4395255f, 4.5900000f, 12},
-{-0.7902040f, -0.4014788f, -0.4630253f, 5.6700000f, 19},
-{-0.4170962f, -0.2046983f, -0.8855108f, 3.8500000f, 42},
-{-0.8776429f, -0.4471814f, -0.1725452f, 4.9400000f, 23},
-{-0.8772473f, -0.4494174f, 0.1687044f, 6.5300000f, 30},
-{-0.8837188f, -0.4496864f, -0.1297042f, 5.4300000f, 24},
-{-0.1995835f, -0.1111761f, 0.9735534f, 5.5600000f, 23},
-{-0.8525877f, -0.4368625f, 0.2867847f, 6.0800000f, 20},
-{-0.4698389f, -0.2470677f, 0.8474721f, 6.3300000f, 21},
-{-0.3655756f, -0.1761525f, -0.9139611f, 5.7500000f, 24},
-{-0.4975613f, -0.2605797f, 0.8273639f, 6.4900000f, 50},
-{-0.8164721f, -0.4176600f, 0.3986646f, 5.7000000f, 64},
-{-0.5012738f, -0.2449525f, -0.8298933f, 5.6300000f, 23},
-{-0.8909228f, -0.4493465f, -0.0659111f, 6.2500000f, 21},
-{-0.8197959f, -0.4098002f, -0.3999980f, 6.4100000f, 15},
-{-0.7437860f, -0.3803620f, 0.5496426f, 6.2900000f, 52},
-{-0.7512579f, -0.3730434f, -0.5444723f, 5.9200000f, 50},
-{-0.6162516f, -0.3030497f, -0.7269077f, 5.1400000f, 18},
-{-0.7166158f, -0.3659221f, 0.5937700f, 5.6300000f, 53},
-{-0.8900537f, -0.4473747f, 0.0875228f, 5.4800000f, 55},
-{-0.8806032f, -0.4397804f, -0.1764405f, 5.2200000f, 53},
-{-0.6764283f, -0.3321111f, -0.6573789f, 6.1400000f, 52},
-{-0.6579337f, -0.3359816f, 0.6739729f, 5.8700000f, 54},
-{-0.8369647f, -0.4151088f, -0.3566157f, 6.4100000f, 20},
-{-0.7975356f, -0.4030608f, 0.4488642f, 6.5000000f, 33},
-{-0.8548864f, -0.4231999f, -0.3001185f, 6.3200000f, 52},
-{-0.8157824f, -0.4027715f, -0.4150594f, 6.0500000f, 17},
-{-0.5518546f, -0.2670196f, -0.7900361f, 5.4400000f, 62},
-{-0.8948800f, -0.4444900f, -0.0402287f, 2.7400000f, 60},
-{-0.8906259f, -0.4429585f, 0.1028263f, 6.3100000f, 52},
-{-0.5797985f, -0.2796148f, -0.7652773f, 4.9900000f, 39},
-{-0.5435387f, -0.2611544f, -0.7977243f, 6.3300000f, 28},
-{-0.8901166f, -0.4359593f, -0.1327850f, 5.5000000f, 42},
-{-0.8749587f, -0.4274156f, -0.2275153f, 6.0900000f, 20},
-{-0.5043116f, -0.2382120f, -0.8300150f, 6.4900000f, 38},
-{-0.7442630f, -0.3683227f, 0.5571454f, 5.6400000f, 40},
-{-0.7442654f, -0.3683239f, 0.5571414f, 6.6600000f, 41},
-{-0.8498538f, -0.4168987f, 0.3224034f, 5.6900000f, 53},
-{-0.8425389f, -0.4064832f, -0.3534114f, 6.6100000f, 19},
-{-0.8999752f, -0.4344757f, -0.0357135f, 6.1800000f, 29},
-{-0.7974458f, -0.3898452f, 0.4605441f, 6.1400000f, 52},
-{-0.3464005f, -0.1757041f, 0.9214851f, 6.2100000f, 48},
-{-0.8019267f, -0.3812188f, -0.4599846f, 4.7800000f, 20},
-{-0.6796244f, -0.3194629f, -0.6603440f, 5.4500000f, 23},
-{-0.5842558f, -0.2729397f, -0.7642965f, 4.0200000f, 48},
-{-0.5220942f, -0.2422927f, -0.8177481f, 5.7700000f, 50},
-{-0.7862005f, -0.3802899f, 0.4871019f, 5.7800000f, 23},
-{-0.9016842f, -0.4285289f, -0.0576947f, 3.2400000f, 49},
-{-0.8513041f, -0.4009185f, -0.3384460f, 6.2900000f, 55},
-{-0.7912231f, -0.3708676f, -0.4862337f, 5.4900000f, 36},
-{-0.8808312f, -0.4153956f, -0.2271188f, 5.9400000f, 54},
-{-0.2168311f, -0.1118849f, 0.9697763f, 5.4800000f, 18},
-{-0.7093836f, -0.3287458f, -0.6234589f, 6.1200000f, 19},
-{-0.8301106f, -0.3842831f, -0.4040332f, 4.5500000f, 25},
-{-0.2277159f, -0.1153562f, 0.9668704f, 6.3900000f, 52},
-{-0.6043762f, -0.2739453f, -0.7481199f, 5.3300000f, 16},
-{-0.8272969f, -0.3805651f, -0.4132192f, 2.8900000f, 11},
-{-0.6759447f, -0.3063317f, -0.6702683f, 5.8800000f, 43},
-{-0.4539236f, -0.2183245f, 0.8638795f, 5.4000000f, 64},
-{-0.8454811f, -0.3939325f, 0.3605260f, 6.0500000f, 48},
-{-0.2560571f, -0.1268874f, 0.9582976f, 5.9800000f, 23},
-{-0.4176103f, -0.1829560f, -0.8900162f, 6.1500000f, 21},
-{-0.5931500f, -0.2791574f, 0.7551452f, 5.9100000f, 56},
-{-0.6971099f, -0.3253702f, 0.6388834f, 5.4600000f, 33},
-{-0.6256681f, -0.2926184f, 0.7231279f, 3.8900000f, 15},
-{-0.9099471f, -0.4143352f, 0.0179614f, 4.8200000f, 30},
-{-0.7119212f, -0.3168871f, -0.6266983f, 5.4000000f, 45},
-{-0.8594540f, -0.3920381f, 0.3280928f, 3.7500000f, 29},
-{-0.9106191f, -0.4118860f, -0.0335089f, 6.2300000f, 19},
-{-0.7678089f, -0.3420714f, -0.5417164f, 6.4700000f, 20},
-{-0.3163792f, -0.1335327f, -0.9391875f, 4.9100000f, 39},
-{-0.6510343f, -0.2867898f, -0.7027845f, 6.3300000f, 22},
-{-0.7357361f, -0.3255406f, -0.5938988f, 5.4200000f, 18},
-{-0.3301080f, -0.1571765f, 0.9307654f, 6.4100000f, 50},
-{-0.2074749f, -0.0823023f, -0.9747720f, 3.8900000f, 48},
-{-0.7810216f, -0.3555343f, 0.5134206f, 4.8500000f, 50},
-{-0.8588285f, -0.3819112f, -0.3414050f, 4.5000000f, 50},
-{-0.8054093f, -0.3558157f, -0.4740370f, 6.6300000f, 40},
-{-0.8054224f, -0.3558145f, -0.4740156f, 5.8400000f, 40},
-{-0.7567064f, -0.3434298f, 0.5562835f, 5.2000000f, 62},
-{-0.7577451f, -0.3433830f, 0.5548969f, 5.3900000f, 55},
-{-0.4043272f, -0.1717204f, -0.8983494f, 5.2700000f, 34},
-{-0.7703081f, -0.3472344f, 0.5348399f, 6.4000000f, 24},
-{-0.9071534f, -0.4030373f, 0.1209694f, 5.8500000f, 22},
-{-0.8462639f, -0.3697822f, -0.3835343f, 5.0200000f, 12},
-{-0.8462544f, -0.3697854f, -0.3835522f, 5.9200000f, 12},
-{-0.4961698f, -0.2099646f, -0.8424550f, 5.6900000f, 19},
-{-0.6333130f, -0.2714873f, -0.7247133f, 4.4700000f, 14},
-{-0.2218644f, -0.1064127f, 0.9692536f, 4.9500000f, 35},
-{-0.8887027f, -0.3891116f, 0.2424863f, 4.5700000f, 19},
-{-0.8760945f, -0.3762943f, -0.3014316f, 4.4200000f, 12},
-{-0.8673182f, -0.3780435f, 0.3237936f, 6.7000000f, 67},
-{-0.5131259f, -0.2131998f, -0.8314130f, 6.0600000f, 48},
-{-0.8992704f, -0.3901200f, 0.1977857f, 6.1100000f, 48},
-{-0.7372132f, -0.3119988f, -0.5993108f, 5.7900000f, 51},
-{-0.7277581f, -0.3186937f, 0.6072911f, 5.5400000f, 25},
-{-0.9177359f, -0.3950734f, 0.0409601f, 6.0700000f, 48},
-{-0.4574908f, -0.1875762f, -0.8692050f, 5.2000000f, 50},
-{-0.3243560f, -0.1481396f, 0.9342633f, 5.2500000f, 52},
-{-0.5217335f, -0.2311414f, 0.8211990f, 5.7400000f, 22},
-{-0.9142981f, -0.3893919f, -0.1115027f, 5.2300000f, 63},
-{-0.9120229f, -0.3880626f, -0.1327465f, 4.6300000f, 23},
-{-0.4329654f, -0.1932593f, 0.8804498f, 5.6700000f, 48},
-{-0.6442531f, -0.2678304f, -0.7163831f, 5.3500000f, 11},
-{-0.4357006f, -0.1940054f, 0.8789351f, 2.7400000f, 48},
-{-0.0610616f, -0.0118724f, -0.9980634f, 6.5700000f, 45},
-{-0.8325105f, -0.3473650f, -0.4315829f, 0.9600000f, 61},
-{-0.3334347f, -0.1308031f, -0.9336551f, 5.5000000f, 51},
-{-0.9214061f, -0.3884278f, 0.0116062f, 5.3900000f, 54},
-{-0.9132031f, -0.3838049f, -0.1369451f, 6.4800000f, 32},
-{-0.1194764f, -0.0400381f, -0.9920294f, 6.5700000f, 54},
-{-0.0735904f, -0.0193833f, -0.9971002f, 6.0400000f, 22},
-{-0.8981887f, -0.3730448f, -0.2325826f, 5.6800000f, 42},
-{-0.8384139f, -0.3463970f, -0.4207983f, 4.7900000f, 12},
-{-0.7079748f, -0.2871370f, -0.6452318f, 5.3300000f, 11},
-{-0.7741390f, -0.3152047f, -0.5489580f, 4.2300000f, 12},
-{-0.9187927f, -0.3782379f, -0.1129431f, 6.5000000f, 27},
-{-0.8362075f, -0.3404841f, -0.4299159f, 6.1000000f, 51},
-{-0.6861509f, -0.2889892f, 0.6675944f, 5.0400000f, 66},
-{-0.8925843f, -0.3645371f, -0.2653411f, 4.2800000f, 48},
-{-0.8599959f, -0.3552552f, 0.3663343f, 2.7700000f, 47},
-{-0.9248426f, -0.3787714f, 0.0346185f, 3.8200000f, 20},
-{-0.5749529f, -0.2419143f, 0.7816052f, 6.2900000f, 49},
-{-0.4016765f, -0.1546988f, -0.9026208f, 5.5200000f, 48},
-{-0.8663632f, -0.3563818f, 0.3498668f, 5.2500000f, 48},
-{-0.8684857f, -0.3502887f, -0.3507568f, 4.4500000f, 27},
-{-0.8573008f, -0.3497562f, 0.3777645f, 5.7600000f, 55},
-{-0.6698928f, -0.2635965f, -0.6940897f, 4.9400000f, 10},
-{-0.6067056f, -0.2509956f, 0.7542609f, 6.4500000f, 21},
-{-0.7561308f, -0.3091616f, 0.5767888f, 6.2500000f, 55},
-{-0.9238474f, -0.3704715f, 0.0962125f, 5.6300000f, 19},
-{-0.9095748f, -0.3647020f, 0.1991636f, 4.8400000f, 57},
-{-0.6619857f, -0.2569944f, -0.7040801f, 6.4600000f, 52},
-{-0.3333453f, -0.1415253f, 0.9321220f, 5.0000000f, 20},
-{-0.6484935f, -0.2627053f, 0.7144523f, 5.6500000f, 24},
-{-0.2206993f, -0.0769888f, -0.9722986f, 4.2400000f, 50},
-{-0.7035122f, -0.2687331f, -0.6579158f, 5.4700000f, 9},
-{-0.8257884f, -0.3174729f, -0.4661379f, 2.8200000f, 10},
-{-0.7676059f, -0.2932161f, -0.5699171f, 4.1600000f, 56},
-{-0.4829731f, -0.1784695f, -0.8572547f, 6.1800000f, 17},
-{-0.6867890f, -0.2701758f, 0.6747784f, 4.2000000f, 19},
-{-0.8916720f, -0.3447904f, 0.2933266f, 6.4100000f, 22},
-{-0.4523465f, -0.1817772f, 0.8731207f, 5.9400000f, 22},
-{-0.9337403f, -0.3567553f, -0.0292349f, 5.7500000f, 52},
-{-0.3572926f, -0.1275981f, -0.9252355f, 5.9100000f, 17},
-{-0.1754567f, -0.0765473f, 0.9815067f, 5.5600000f, 30},
-{-0.6899562f, -0.2564668f, -0.6768938f, 5.8300000f, 12},
-{-0.9227321f, -0.3488631f, -0.1638903f, 2.5600000f, 9},
-{-0.9007105f, -0.3425226f, 0.2672057f, 6.3000000f, 19},
-{-0.4768016f, -0.1715612f, -0.8621061f, 6.1800000f, 32},
-{-0.7515156f, -0.2769259f, -0.5987790f, 5.9100000f, 19},
-{-0.9324599f, -0.3485088f, -0.0951846f, 6.0900000f, 20},
-{-0.2768209f, -0.1125906f, 0.9543026f, 6.3000000f, 52},
-{-0.9097763f, -0.3410566f, 0.2366168f, 6.3100000f, 35},
-{-0.3756446f, -0.1305040f, -0.9175292f, 6.0300000f, 20},
-{-0.6414939f, -0.2456471f, 0.7267345f, 5.7900000f, 48},
-{-0.5633201f, -0.2156980f, 0.7975869f, 5.5300000f, 19},
-{-0.5630404f, -0.2154876f, 0.7978412f, 5.0800000f, 19},
-{-0.5630503f, -0.2154726f, 0.7978383f, 6.5300000f, 21},
-{-0.6393665f, -0.2284910f, -0.7341678f, 5.6500000f, 5},
-{-0.6261597f, -0.2227500f, -0.7471991f, 5.6500000f, 11},
-{-0.9289872f, -0.3397236f, -0.1468695f, 6.3500000f, 33},
-{-0.8860974f, -0.3199977f, -0.3353100f, 6.2600000f, 49},
-{-0.2010375f, -0.0826087f, 0.9760941f, 6.3400000f, 51},
-{-0.7915787f, -0.2812524f, -0.5424945f, 5.8700000f, 43},
-{-0.8637182f, -0.3075421f, -0.3992603f, 6.0900000f, 30},
-{-0.9380280f, -0.3387052f, 0.0733639f, 6.9300000f, 23},
-{-0.9381016f, -0.3384542f, 0.0735815f, 5.7700000f, 21},
-{-0.9043488f, -0.3221427f, -0.2799593f, 4.9600000f, 47},
-{-0.6567118f, -0.2291519f, -0.7184838f, 6.2300000f, 35},
-{-0.4234254f, -0.1605976f, 0.8915825f, 6.1600000f, 55},
-{-0.5235753f, -0.1957394f, 0.8291894f, 5.2900000f, 51},
-{-0.6161440f, -0.2280765f, 0.7538884f, 4.9000000f, 62},
-{-0.9413151f, -0.3370782f, -0.0174427f, 6.2400000f, 27},
-{-0.8959749f, -0.3177434f, -0.3102709f, 5.5700000f, 34},
-{-0.9190316f, -0.3306151f, 0.2146501f, 6.0800000f, 23},
-{-0.3725713f, -0.1234567f, -0.9197549f, 5.1300000f, 20},
-{-0.9420157f, -0.3349351f, 0.0206128f, 5.7400000f, 32},
-{-0.7146176f, -0.2469058f, -0.6544916f, 6.2000000f, 24},
-{-0.5716018f, -0.1949696f, -0.7970309f, 5.9600000f, 48},
-{-0.8539875f, -0.3065708f, 0.4203805f, 6.0600000f, 52},
-{-0.7147053f, -0.2464475f, -0.6545686f, 6.1200000f, 16},
-{-0.7464356f, -0.2577715f, -0.6135045f, 6.0500000f, 19},
-{-0.8023427f, -0.2776596f, -0.5283478f, 6.4600000f, 18},
-{-0.8019580f, -0.2868004f, 0.5240313f, 2.8100000f, 40},
-{-0.8400136f, -0.2990672f, 0.4526984f, 5.9200000f, 32},
-{-0.7339171f, -0.2501674f, -0.6314919f, 5.7100000f, 13},
-{-0.5098466f, -0.1697187f, -0.8433576f, 5.7400000f, 12},
-{-0.8462194f, -0.2901864f, -0.4468832f, 6.5800000f, 22},
-{-0.3415789f, -0.1098910f, -0.9334066f, 1.9200000f, 52},
-{-0.8400156f, -0.2851333f, -0.4615981f, 6.0200000f, 23},
-{-0.5082908f, -0.1668104f, -0.8448756f, 5.5800000f, 10},
-{-0.7343851f, -0.2568303f, 0.6282649f, 3.5300000f, 47},
-{-0.7417563f, -0.2453244f, -0.6241902f, 5.4800000f, 50},
-{-0.7833484f, -0.2702575f, 0.5597555f, 5.9900000f, 32},
-{-0.4038125f, -0.1451460f, 0.9032542f, 4.8300000f, 50},
-{-0.9474719f, -0.3193429f, 0.0178063f, 6.0300000f, 19},
-{-0.8642055f, -0.2855786f, -0.4142388f, 6.7100000f, 46},
-{-0.5321295f, -0.1858974f, 0.8260027f, 6.1600000f, 22},
-{-0.9119040f, -0.3078866f, 0.2713611f, 5.5600000f, 63},
-{-0.9374736f, -0.3144401f, 0.1492333f, 5.1500000f, 55},
-{-0.4916453f, -0.1555224f, -0.8567950f, 3.7600000f, 55},
-{-0.6902865f, -0.2336659f, 0.6847662f, 6.0500000f, 54},
-{-0.3842569f, -0.1169477f, -0.9157892f, 6.3200000f, 52},
-{-0.9493055f, -0.3122841f, 0.0360236f, 6.1000000f, 23},
-{-0.4097685f, -0.1254776f, -0.9035182f, 6.1300000f, 18},
-{-0.9467670f, -0.3086588f, 0.0914437f, 5.2400000f, 19},
-{-0.9269309f, -0.2991672f, -0.2264908f, 6.0300000f, 20},
-{-0.6141211f, -0.1918704f, -0.7655331f, 6.4700000f, 25},
-{-0.5189813f, -0.1754215f, 0.8365917f, 4.8500000f, 32},
-{-0.1800011f, -0.0674056f, 0.9813542f, 6.3200000f, 49},
-{-0.9246209f, -0.2997661f, 0.2349819f, 6.3500000f, 45},
-{-0.9233482f, -0.2935094f, -0.2475486f, 6.1000000f, 25},
-{-0.7935652f, -0.2495885f, -0.5549412f, 2.2900000f, 52},
-{-0.7034414f, -0.2308377f, 0.6722232f, 5.8700000f, 64},
-{-0.9411873f, -0.2975079f, -0.1601731f, 4.6500000f, 37},
-{-0.7678391f, -0.2384326f, -0.5946201f, 6.1100000f, 19},
-{-0.7238263f, -0.2228106f, -0.6530168f, 5.2200000f, 8},
-{-0.9277426f, -0.2944013f, 0.2293939f, 5.9100000f, 21},
-{-0.7539354f, -0.2309689f, -0.6150080f, 3.0800000f, 11},
-{-0.9539400f, -0.2990762f, -0.0234919f, 6.3200000f, 31},
-{-0.7313177f, -0.2224760f, -0.6447316f, 6.4900000f, 30},
-{-0.9465165f, -0.2969681f, 0.1261605f, 5.4900000f, 23},
-{-0.5349140f, -0.1584276f, -0.8299203f, 5.9400000f, 61},
-{-0.7540943f, -0.2293450f, -0.6154208f, 3.5700000f, 12},
-{-0.4401051f, -0.1274217f, -0.8888595f, 6.0200000f, 20},
-{-0.6620074f, -0.2111568f, 0.7191377f, 4.8200000f, 22},
-{-0.9553401f, -0.2947454f, 0.0212235f, 5.5100000f, 22},
-{-0.6922867f, -0.2193569f, 0.6874749f, 6.1300000f, 50},
-{-0.7015511f, -0.2087804f, -0.6813492f, 5.9600000f, 63},
-{-0.8282842f, -0.2585766f, 0.4970749f, 5.7200000f, 61},
-{-0.8046674f, -0.2509406f, 0.5380885f, 6.1300000f, 50},
-{-0.7324401f, -0.2168544f, -0.6453725f, 5.4500000f, 10},
-{-0.7344228f, -0.2176157f, -0.6428582f, 6.3200000f, 11},
-{-0.7165790f, -0.2122774f, -0.6644191f, 4.7300000f, 11},
-{-0.7330715f, -0.2164616f, -0.6447872f, 6.4500000f, 9},
-{-0.7104848f, -0.2219660f, 0.6677893f, 6.2900000f, 53},
-{-0.7328672f, -0.2159494f, -0.6451910f, 6.5900000f, 30},
-{-0.7182940f, -0.2112408f, -0.6628960f, 5.8800000f, 35},
-{-0.2041414f, -0.0711895f, 0.9763495f, 5.9800000f, 34},
-{-0.9239316f, -0.2821143f, 0.2583835f, 6.5200000f, 19},
-{-0.9026705f, -0.2698699f, -0.3351958f, 5.8800000f, 43},
-{-0.8688301f, -0.2666439f, 0.4171754f, 5.0400000f, 50},
-{-0.7171123f, -0.2104344f, -0.6644300f, 3.6200000f, 54},
-{-0.7261928f, -0.2117576f, -0.6540663f, 5.7700000f, 8},
-{-0.8358769f, -0.2452195f, -0.4910980f, 6.3500000f, 27},
-{-0.6266353f, -0.1792459f, -0.7584188f, 6.3300000f, 13},
-{-0.5959128f, -0.1695300f, -0.7849506f, 5.9400000f, 19},
-{-0.3501968f, -0.0945505f, -0.9318918f, 5.7900000f, 20},
-{-0.9590164f, -0.2832697f, -0.0067679f, 6.2500000f, 30},
-{-0.9444591f, -0.2767533f, -0.1772136f, 6.5700000f, 22},
-{-0.8146638f, -0.2453087f, 0.5254964f, 5.3200000f, 30},
-{-0.9545633f, -0.2800609f, -0.1018569f, 5.2500000f, 52},
-{-0.9437791f, -0.2795228f, 0.1764883f, 4.3800000f, 18},
-{-0.8107478f, -0.2326186f, -0.5371933f, 6.3700000f, 55},
-{-0.7457316f, -0.2117238f, -0.6317099f, 6.1500000f, 10},
-{-0.9276951f, -0.2658809f, -0.2620862f, 6.3700000f, 50},
-{-0.5666982f, -0.1555096f, -0.8091167f, 3.1300000f, 53},
-{-0.6481976f, -0.1941809f, 0.7362972f, 6.0000000f, 52},
-{-0.8964408f, -0.2616282f, 0.3576935f, 5.4100000f, 48},
-{-0.8097323f, -0.2276627f, -0.5408358f, 5.4800000f, 55},
-{-0.6278580f, -0.1732357f, -0.7588042f, 5.5500000f, 19},
-{-0.9333691f, -0.2708744f, 0.2354767f, 6.3400000f, 33},
-{-0.8867076f, -0.2509130f, -0.3883199f, 5.5800000f, 20},
-{-0.8648952f, -0.2519507f, 0.4341396f, 6.0800000f, 45},
-{-0.9112192f, -0.2640009f, 0.3162010f, 5.3500000f, 54},
-{-0.9130069f, -0.2572079f, -0.3166425f, 6.2700000f, 16},
-{-0.5831840f, -0.1573961f, -0.7969460f, 4.0600000f, 54},
-{-0.9510164f, -0.2662667f, -0.1570665f, 6.1900000f, 48},
-{-0.5759372f, -0.1540436f, -0.8028493f, 5.6500000f, 25},
-{-0.7766451f, -0.2121990f, -0.5931223f, 6.0900000f, 23},
-{-0.9503770f, -0.2650446f, 0.1628955f, 3.2000000f, 52},
-{-0.6547490f, -0.1740572f, -0.7355324f, 6.0000000f, 48},
-{-0.9349457f, -0.2613347f, 0.2399598f, 6.3700000f, 50},
-{-0.9392204f, -0.2574115f, -0.2271660f, 6.5900000f, 33},
-{-0.6888070f, -0.1828323f, -0.7015107f, 6.6500000f, 54},
-{-0.5265754f, -0.1366965f, -0.8390664f, 6.1100000f, 12},
-{-0.8703105f, -0.2433362f, 0.4281905f, 6.2800000f, 45},
-{-0.6174695f, -0.1767456f, 0.7664806f, 6.5600000f, 62},
-{-0.8773777f, -0.2445350f, 0.4128086f, 6.3200000f, 50},
-{-0.8760391f, -0.2348978f, -0.4211633f, 5.8600000f, 63},
-{-0.8892324f, -0.2376108f, -0.3909052f, 5.7500000f, 34},
-{-0.8007401f, -0.2122563f, -0.5601451f, 5.9700000f, 52},
-{-0.6108315f, -0.1586307f, -0.7757069f, 6.4500000f, 27},
-{-0.7101803f, -0.1974956f, 0.6757510f, 6.3400000f, 53},
-{-0.5865890f, -0.1485751f, -0.7961399f, 5.2900000f, 36},
-{-0.4042115f, -0.1158517f, 0.9072990f, 4.8900000f, 36},
-{-0.8222061f, -0.2131027f, -0.5277920f, 5.0300000f, 18},
-{-0.9601036f, -0.2550601f, 0.1146530f, 6.5900000f, 27},
-{-0.9650114f, -0.2537962f, -0.0658821f, 4.8200000f, 54},
-{-0.4058636f, -0.1155750f, 0.9065965f, 6.4100000f, 31},
-{-0.5387757f, -0.1333044f, -0.8318357f, 5.7300000f, 15},
-{-0.9251236f, -0.2398850f, -0.2942813f, 6.2600000f, 50},
-{-0.1313650f, -0.0439743f, 0.9903583f, 4.2300000f, 45},
-{-0.6634984f, -0.1663669f, -0.7294464f, 6.0600000f, 22},
-{-0.8288788f, -0.2209736f, 0.5139364f, 3.9200000f, 20},
-{-0.8925451f, -0.2351194f, 0.3848145f, 5.6500000f, 53},
-{-0.9349028f, -0.2437417f, 0.2579666f, 6.3100000f, 19},
-{-0.7660599f, -0.1915447f, -0.6135657f, 5.9100000f, 34},
-{-0.8602922f, -0.2258539f, 0.4570419f, 6.5500000f, 35},
-{-0.9576203f, -0.2477243f, 0.1469559f, 6.3300000f, 24},
-{-0.5300757f, -0.1436252f, 0.8356982f, 6.0300000f, 51},
-{-0.6928953f, -0.1692674f, -0.7008885f, 6.2800000f, 22},
-{-0.8063275f, -0.2100075f, 0.5529311f, 5.2500000f, 23},
-{-0.8741019f, -0.2247904f, 0.4305986f, 5.7500000f, 47},
-{-0.8062888f, -0.1979565f, -0.5574151f, 4.8700000f, 11},
-{-0.2790925f, -0.0796596f, 0.9569544f, 6.3000000f, 30},
-{-0.8223316f, -0.2115724f, 0.5282119f, 6.3600000f, 50},
-{-0.9401984f, -0.2382123f, 0.2434786f, 4.9800000f, 63},
-{-0.7005614f, -0.1688043f, -0.6933389f, 6.1900000f, 24},
-{-0.9384915f, -0.2375911f, 0.2505677f, 6.5200000f, 45},
-{-0.9153574f, -0.2250239f, -0.3338937f, 6.3000000f, 16},
-{-0.9427136f, -0.2365528f, 0.2352316f, 5.9300000f, 21},
-{-0.9431847f, -0.2353081f, 0.2345907f, 6.0800000f, 51},
-{-0.9134377f, -0.2282607f, 0.3369401f, 6.3500000f, 54},
-{-0.7791618f, -0.1858441f, -0.5986392f, 5.9800000f, 22},
-{-0.3428346f, -0.0933978f, 0.9347413f, 6.4000000f, 50},
-{-0.7903469f, -0.1988758f, 0.5794827f, 6.6900000f, 64},
-{-0.8012807f, -0.1906211f, -0.5671092f, 6.1300000f, 9},
-{-0.4741545f, -0.1242189f, 0.8716347f, 6.1300000f, 51},
-{-0.9715604f, -0.2364742f, 0.0122606f, 6.0100000f, 38},
-{-0.9113633f, -0.2179720f, -0.3491491f, 6.3000000f, 23},
-{-0.7967575f, -0.1990540f, 0.5705742f, 6.0400000f, 25},
-{-0.9147594f, -0.2251591f, 0.3354379f, 6.1700000f, 19},
-{-0.9717799f, -0.2353751f, 0.0155667f, 5.6400000f, 11},
-{-0.8785508f, -0.2073299f, -0.4303054f, 6.2900000f, 20},
-{-0.9478067f, -0.2302692f, 0.2205414f, 4.9100000f, 24},
-{-0.4834015f, -0.1069352f, -0.8688428f, 6.3900000f, 18},
-{-0.3461933f, -0.0730648f, -0.9353137f, 6.2200000f, 51},
-{-0.9585350f, -0.2294089f, 0.1690628f, 6.3700000f, 55},
-{-0.9564472f, -0.2286592f, 0.1814489f, 6.3700000f, 48},
-{-0.4153833f, -0.1069325f, 0.9033395f, 6.1000000f, 45},
-{-0.9732433f, -0.2296988f, -0.0059971f, 6.3800000f, 29},
-{-0.7009950f, -0.1712622f, 0.6922971f, 6.4300000f, 23},
-{-0.6396433f, -0.1570227f, 0.7524628f, 6.0900000f, 51},
-{-0.9013136f, -0.2151319f, 0.3759682f, 5.5600000f, 53},
-{-0.9350041f, -0.2147958f, -0.2821880f, 5.9900000f, 50},
-{-0.8479108f, -0.1926730f, -0.4938871f, 5.9700000f, 20},
-{-0.9744663f, -0.2239584f, -0.0160660f, 6.0600000f, 21},
-{-0.3857365f, -0.0797213f, -0.9191583f, 5.8900000f, 50},
-{-0.5646697f, -0.1373123f, 0.8138142f, 5.8300000f, 37},
-{-0.5646687f, -0.1373164f, 0.8138142f, 5.8000000f, 37},
-{-0.7093342f, -0.1549679f, -0.6876263f, 5.0800000f, 48},
-{-0.9745882f, -0.2209366f, -0.0369441f, 6.3600000f, 45},
-{-0.2794798f, -0.0535749f, -0.9586557f, 6.2500000f, 20},
-{-0.6653045f, -0.1424822f, -0.7328497f, 5.8400000f, 61},
-{-0.9627856f, -0.2143261f, -0.1646459f, 5.5600000f, 35},
-{-0.7405731f, -0.1717294f, 0.6496618f, 6.3400000f, 22},
-{-0.7889549f, -0.1820237f, 0.5868710f, 5.3900000f, 25},
-{-0.9464951f, -0.2081943f, -0.2465809f, 2.4300000f, 22},
-{-0.2456288f, -0.0639014f, 0.9672554f, 6.2100000f, 30},
-{-0.7182522f, -0.1521670f, -0.6789396f, 3.3300000f, 33},
-{-0.7657713f, -0.1618270f, -0.6224198f, 5.6700000f, 21},
-{-0.7795514f, -0.1647213f, -0.6042901f, 6.3000000f, 51},
-{-0.6154500f, -0.1412819f, 0.7754100f, 6.4600000f, 21},
-{-0.5606054f, -0.1134962f, -0.8202684f, 6.0900000f, 61},
-{-0.9539732f, -0.2081597f, 0.2158811f, 6.5700000f, 21},
-{-0.8885181f, -0.1879421f, -0.4185849f, 6.5400000f, 20},
-{-0.8777017f, -0.1848941f, -0.4421017f, 6.1400000f, 19},
-{-0.7389852f, -0.1653351f, 0.6531196f, 5.0800000f, 53},
-{-0.8342085f, -0.1735979f, -0.5234118f, 6.0100000f, 11},
-{-0.9686546f, -0.2069838f, 0.1373533f, 6.3300000f, 50},
-{-0.8911328f, -0.1932668f, 0.4105243f, 6.1900000f, 28},
-{-0.7700447f, -0.1550526f, -0.6188617f, 6.6000000f, 45},
-{-0.9619133f, -0.2024293f, 0.1836988f, 5.3300000f, 62},
-{-0.9789440f, -0.2040366f, 0.0061426f, 6.6500000f, 36},
-{-0.5958546f, -0.1307074f, 0.7923843f, 6.2900000f, 19},
-{-0.4010543f, -0.0911418f, 0.9115090f, 3.1700000f, 16},
-{-0.8278604f, -0.1634641f, -0.5365880f, 5.5300000f, 7},
-{-0.7794886f, -0.1529355f, -0.6074606f, 5.9600000f, 37},
-{-0.6318540f, -0.1352559f, 0.7631949f, 6.0400000f, 25},
-{-0.3376150f, -0.0592067f, -0.9394204f, 6.5300000f, 40},
-{-0.8862665f, -0.1748828f, -0.4288913f, 5.1100000f, 51},
-{-0.8862537f, -0.1748936f, -0.4289132f, 5.0700000f, 50},
-{-0.8518095f, -0.1661215f, -0.4968141f, 6.2100000f, 19},
-{-0.9542994f, -0.1883579f, -0.2320214f, 5.9900000f, 51},
-{-0.8116432f, -0.1564509f, -0.5628129f, 6.1200000f, 40},
-{-0.9497224f, -0.1904269f, 0.2485255f, 3.4800000f, 65},
-{-0.9497277f, -0.1904065f, 0.2485208f, 5.3900000f, 45},
-{-0.5170884f, -0.0930234f, -0.8508621f, 5.9100000f, 52},
-{-0.8391745f, -0.1590883f, -0.5200741f, 5.5500000f, 36},
-{-0.8900778f, -0.1769196f, 0.4200725f, 3.1400000f, 23},
-{-0.3393481f, -0.0566377f, -0.9389542f, 5.4100000f, 19},
-{-0.9811091f, -0.1896571f, 0.0381456f, 6.1700000f, 22},
-{-0.9772657f, -0.1868064f, -0.1002749f, 6.0900000f, 50},
-{-0.9818453f, -0.1885035f, 0.0211266f, 5.8800000f, 15},
-{-0.9821033f, -0.1881828f, 0.0077715f, 4.7300000f, 52},
-{-0.6913906f, -0.1248576f, -0.7116106f, 5.4800000f, 48},
-{-0.3975442f, -0.0665439f, -0.9151669f, 4.7800000f, 52},
-{-0.7852833f, -0.1560363f, 0.5991517f, 3.1600000f, 53},
-{-0.8983099f, -0.1758615f, 0.4026313f, 5.9600000f, 52},
-{-0.7092933f, -0.1289004f, -0.6930279f, 5.7600000f, 19},
-{-0.4462020f, -0.0937381f, 0.8900095f, 5.5600000f, 30},
-{-0.8390702f, -0.1542253f, -0.5217047f, 6.3600000f, 15},
-{-0.6336129f, -0.1131346f, -0.7653335f, 6.2700000f, 38},
-{-0.9002482f, -0.1668037f, -0.4021564f, 5.2000000f, 50},
-{-0.9002266f, -0.1668133f, -0.4022008f, 6.8000000f, 36},
-{-0.8251594f, -0.1493867f, -0.5447895f, 5.9100000f, 53},
-{-0.7107432f, -0.1272160f, -0.6918527f, 6.6500000f, 19},
-{-0.9468709f, -0.1741250f, -0.2703997f, 6.4300000f, 62},
-{-0.1869362f, -0.0234042f, -0.9820932f, 5.8800000f, 63},
-{-0.9041855f, -0.1692205f, 0.3921900f, 6.4500000f, 52},
-{-0.8232378f, -0.1550874f, 0.5461020f, 4.8200000f, 11},
-{-0.9387442f, -0.1736329f, 0.2976757f, 6.0000000f, 21},
-{-0.9661090f, -0.1763702f, 0.1884860f, 5.0300000f, 54},
-{-0.9784031f, -0.1774532f, 0.1060086f, 6.5100000f, 30},
-{-0.9454139f, -0.1671770f, -0.2797220f, 6.0200000f, 22},
-{-0.7820314f, -0.1461001f, 0.6058727f, 4.6500000f, 22},
-{-0.6354549f, -0.1211908f, 0.7625680f, 7.4800000f, 52},
-{-0.5231475f, -0.0853953f, -0.8479530f, 5.8800000f, 48},
-{-0.9823022f, -0.1732432f, -0.0711976f, 6.3200000f, 49},
-{-0.4767975f, -0.0754782f, -0.8757666f, 5.7000000f, 12},
-{-0.9334068f, -0.1621922f, -0.3200711f, 6.5200000f, 43},
-{-0.5594453f, -0.0908233f, -0.8238762f, 5.8000000f, 48},
-{-0.8619999f, -0.1566196f, 0.4821063f, 5.6500000f, 50},
-{-0.7664049f, -0.1407020f, 0.6267587f, 5.9400000f, 47},
-{-0.9207916f, -0.1582071f, -0.3565296f, 4.3900000f, 31},
-{-0.9668181f, -0.1668754f, -0.1934306f, 4.3300000f, 22},
-{-0.5039741f, -0.0791193f, -0.8600873f, 5.7700000f, 18},
-{-0.4810297f, -0.0924358f, 0.8718177f, 6.3200000f, 51},
-{-0.9725020f, -0.1676380f, -0.1616708f, 6.4600000f, 31},
-{-0.7963225f, -0.1309143f, -0.5905352f, 6.4100000f, 14},
-{-0.6791367f, -0.1097883f, -0.7257547f, 5.2500000f, 12},
-{-0.9365295f, -0.1638085f, 0.3099667f, 5.0000000f, 62},
-{-0.9078836f, -0.1518869f, -0.3907401f, 3.2700000f, 12},
-{-0.8171751f, -0.1344278f, -0.5604945f, 6.4700000f, 37},
-{-0.8887067f, -0.1560500f, 0.4311017f, 5.3800000f, 23},
-{-0.7904832f, -0.1290393f, -0.5987363f, 5.9300000f, 51},
-{-0.8967567f, -0.1544804f, 0.4146844f, 5.1200000f, 22},
-{-0.8312943f, -0.1441125f, 0.5368252f, 5.3900000f, 40},
-{-0.8728424f, -0.1407444f, -0.4672656f, 5.3500000f, 55},
-{-0.7125329f, -0.1121637f, -0.6926154f, 5.1200000f, 17},
-{-0.5744809f, -0.0876514f, -0.8138114f, 2.8500000f, 53},
-{-0.5582179f, -0.0849375f, -0.8253353f, 3.3400000f, 11},
-{-0.9442264f, -0.1598876f, 0.2878759f, 6.3500000f, 62},
-{-0.6813047f, -0.1190548f, 0.7222533f, 5.5900000f, 60},
-{-0.9865041f, -0.1613032f, -0.0281252f, 6.2900000f, 45},
-{-0.8643313f, -0.1465011f, 0.4811120f, 6.3500000f, 40},
-{-0.6568367f, -0.1141639f, 0.7453403f, 6.4300000f, 34},
-{-0.6440664f, -0.0962564f, -0.7588894f, 5.2300000f, 48},
-{-0.7556699f, -0.1273824f, 0.6424459f, 5.5100000f, 39},
-{-0.8260706f, -0.1269784f, -0.5490755f, 6.1600000f, 20},
-{-0.4501679f, -0.0630099f, -0.8907180f, 6.2400000f, 17},
-{-0.9252306f, -0.1436467f, -0.3511608f, 5.8500000f, 48},
-{-0.9420929f, -0.1466084f, -0.3016073f, 6.2100000f, 19},
-{-0.9046769f, -0.1388256f, -0.4028488f, 6.1900000f, 51},
-{-0.6354380f, -0.0923087f, -0.7666144f, 6.1900000f, 18},
-{-0.9758951f, -0.1547412f, 0.1538961f, 5.7700000f, 51},
-{-0.7099528f, -0.1033864f, -0.6966192f, 5.2900000f, 17},
-{-0.6445206f, -0.0928577f, -0.7589273f, 5.9200000f, 19},
-{-0.5876591f, -0.0989819f, 0.8030313f, 5.6700000f, 54},
-{-0.9095083f, -0.1436045f, 0.3900929f, 5.7400000f, 30},
-{-0.9483246f, -0.1479738f, 0.2806853f, 5.7100000f, 23},
-{-0.9516436f, -0.1483286f, 0.2690225f, 6.3500000f, 19},
-{-0.6136946f, -0.0863584f, -0.7848064f, 5.7500000f, 52},
-{-0.7871030f, -0.1257976f, 0.6038574f, 5.4700000f, 20},
-{-0.7871145f, -0.1257818f, 0.6038458f, 4.5200000f, 19},
-{-0.9049544f, -0.1337531f, -0.4039400f, 4.1700000f, 23},
-{-0.5706182f, -0.0785582f, -0.8174494f, 5.9400000f, 48},
-{-0.7721034f, -0.1221625f, 0.6236447f, 6.4900000f, 38},
-{-0.9889750f, -0.1479577f, -0.0060795f, 6.4400000f, 33},
-{-0.9036472f, -0.1313447f, -0.4076400f, 6.4400000f, 20},
-{-0.7895461f, -0.1234573f, 0.6011450f, 6.2800000f, 45},
-{-0.8729240f, -0.1251877f, -0.4715207f, 4.2900000f, 35},
-{-0.9857838f, -0.1445498f, -0.0856488f, 4.5400000f, 33},
-{-0.8719071f, -0.1239937f, -0.4737125f, 6.0000000f, 19},
-{-0.9461583f, -0.1417983f, 0.2909944f, 5.9800000f, 64},
-{-0.9698483f, -0.1404701f, -0.1991541f, 6.2100000f, 37},
-{-0.9805395f, -0.1451578f, 0.1321795f, 6.0600000f, 19},
-{-0.9867636f, -0.1452067f, 0.0721986f, 4.3400000f, 52},
-{-0.8821753f, -0.1317830f, 0.4521061f, 6.4100000f, 25},
-{-0.5062488f, -0.0641823f, -0.8599958f, 3.6200000f, 18},
-{-0.8094337f, -0.1103929f, -0.5767413f, 6.0200000f, 50},
-{-0.9293825f, -0.1355063f, 0.3433455f, 5.5400000f, 15},
-{-0.7864808f, -0.1055386f, -0.6085306f, 6.3900000f, 22},
-{-0.9811485f, -0.1377241f, -0.1355715f, 6.3700000f, 35},
-{-0.5679834f, -0.0712914f, -0.8199466f, 5.9500000f, 17},
-{-0.8135582f, -0.1187941f, 0.5692197f, 5.9400000f, 20},
-{-0.9907481f, -0.1355908f, 0.0057693f, 5.4400000f, 28},
-{-0.7952174f, -0.1019990f, -0.5976835f, 2.6900000f, 12},
-{-0.6587516f, -0.0962874f, 0.7461736f, 5.8500000f, 24},
-{-0.6624902f, -0.0818082f, -0.7445899f, 2.9500000f, 12},
-{-0.4936844f, -0.0744681f, 0.8664469f, 5.6500000f, 21},
-{-0.9888122f, -0.1311015f, -0.0711541f, 6.3700000f, 50},
-{-0.6898664f, -0.0852601f, -0.7188985f, 6.0300000f, 38},
-{-0.5145486f, -0.0767124f, 0.8540228f, 6.5100000f, 24},
-{-0.9915365f, -0.1287928f, -0.0163617f, 5.3100000f, 49},
-{-0.8388923f, -0.1037834f, -0.5343114f, 6.4400000f, 52},
-{-0.3813139f, -0.0586841f, 0.9225811f, 6.4300000f, 50},
-{-0.9197405f, -0.1153070f, -0.3752089f, 4.8100000f, 19},
-{-0.8940078f, -0.1108000f, -0.4341352f, 6.0500000f, 19},
-{-0.9702552f, -0.1261289f, 0.2066311f, 6.3900000f, 21},
-{-0.8257372f, -0.0998947f, -0.5551388f, 6.1700000f, 32},
-{-0.7514967f, -0.0885354f, -0.6537692f, 5.8400000f, 19},
-{-0.9910777f, -0.1245213f, 0.0475326f, 5.5900000f, 48},
-{-0.5246476f, -0.0561111f, -0.8494683f, 6.2800000f, 15},
-{-0.8906374f, -0.1143369f, 0.4401046f, 4.4100000f, 53},
-{-0.7944288f, -0.0918893f, -0.6003659f, 1.6300000f, 12},
-{-0.8488629f, -0.1082776f, 0.5174048f, 5.6100000f, 48},
-{-0.1686509f, -0.0300287f, 0.9852183f, 5.7200000f, 55},
-{-0.6032102f, -0.0651745f, -0.7949149f, 6.1000000f, 19},
-{-0.7720728f, -0.0993443f, 0.6277216f, 6.4300000f, 36},
-{-0.9712365f, -0.1181776f, 0.2067212f, 6.4200000f, 19},
-{-0.8729487f, -0.1078549f, 0.4757394f, 5.6200000f, 21},
-{-0.9905834f, -0.1150597f, -0.0742004f, 5.6200000f, 25},
-{-0.8481929f, -0.0939848f, -0.5212827f, 5.7000000f, 7},
-{-0.6064262f, -0.0786713f, 0.7912384f, 2.7900000f, 42},
-{-0.6970289f, -0.0743063f, -0.7131825f, 4.5900000f, 20},
-{-0.8202334f, -0.1006454f, 0.5631054f, 6.5600000f, 45},
-{-0.7987289f, -0.0849483f, -0.5956643f, 6.4800000f, 20},
-{-0.5274169f, -0.0677274f, 0.8469029f, 6.4000000f, 52},
-{-0.9376896f, -0.1094067f, 0.3298005f, 5.6400000f, 36},
-{-0.9533865f, -0.1100717f, 0.2809599f, 5.6900000f, 50},
-{-0.9602861f, -0.1106277f, 0.2561488f, 6.4800000f, 64},
-{-0.9764787f, -0.1079193f, -0.1866622f, 5.5500000f, 18},
-{-0.9220930f, -0.0997304f, -0.3738963f, 6.5700000f, 18},
-{-0.7906304f, -0.0811924f, -0.6068866f, 4.2900000f, 50},
-{-0.6404775f, -0.0632132f, -0.7653709f, 5.9300000f, 50},
-{-0.9799909f, -0.1090072f, 0.1665393f, 5.8100000f, 22},
-{-0.5921114f, -0.0567705f, -0.8038540f, 5.2500000f, 25},
-{-0.7467482f, -0.0879815f, 0.6592620f, 5.7400000f, 51},
-{-0.9528500f, -0.1066547f, 0.2840804f, 6.4000000f, 28},
-{-0.0908863f, 0.0006220f, -0.9958611f, 6.4500000f, 35},
-{-0.7509918f, -0.0745618f, -0.6560883f, 1.8700000f, 31},
-{-0.5667382f, -0.0691433f, 0.8209915f, 4.8800000f, 26},
-{-0.5669234f, -0.0689399f, 0.8208807f, 4.8700000f, 24},
-{-0.9702372f, -0.1065367f, 0.2174619f, 2.0800000f, 25},
-{-0.7848988f, -0.0774902f, -0.6147595f, 6.2600000f, 42},
-{-0.7499165f, -0.0717409f, -0.6576309f, 6.1000000f, 18},
-{-0.9284875f, -0.0976153f, 0.3583046f, 6.1000000f, 27},
-{-0.5328581f, -0.0618227f, 0.8439432f, 6.1700000f, 45},
-{-0.9630791f, -0.0944873f, -0.2520928f, 3.5400000f, 30},
-{-0.9638370f, -0.0944909f, -0.2491782f, 5.9400000f, 30},
-{-0.7909912f, -0.0841602f, 0.6060115f, 6.1000000f, 49},
-{-0.8766536f, -0.0916308f, 0.4723158f, 6.3800000f, 55},
-{-0.3119496f, -0.0213646f, -0.9498584f, 6.4900000f, 37},
-{-0.3696380f, -0.0454431f, 0.9280639f, 5.0500000f, 50},
-{-0.9859300f, -0.0956073f, -0.1371180f, 4.6200000f, 18},
-{-0.9830055f, -0.0939673f, -0.1577033f, 5.7500000f, 50},
-{-0.6590962f, -0.0565238f, -0.7499315f, 4.7700000f, 33},
-{-0.8546219f, -0.0875189f, 0.5118221f, 6.0200000f, 25},
-{-0.9069503f, -0.0892536f, 0.4116734f, 5.7700000f, 22},
-{-0.7037864f, -0.0576402f, -0.7080694f, 5.7900000f, 20},
-{-0.4685930f, -0.0513365f, 0.8819213f, 5.2300000f, 40},
-{-0.6580638f, -0.0673466f, 0.7499443f, 5.3700000f, 51},
-{-0.9952375f, -0.0908291f, 0.0353889f, 6.2600000f, 50},
-{-0.6476001f, -0.0507824f, -0.7602863f, 6.2400000f, 63},
-{-0.9689653f, -0.0891917f, 0.2305451f, 6.1200000f, 36},
-{-0.9957512f, -0.0862560f, -0.0322394f, 6.1900000f, 52},
-{-0.8375521f, -0.0775929f, 0.5408195f, 6.3700000f, 45},
-{-0.7752069f, -0.0593484f, -0.6289134f, 2.4100000f, 11},
-{-0.9779851f, -0.0794814f, -0.1929454f, 4.2600000f, 22},
-{-0.4488204f, -0.0279753f, -0.8931840f, 3.6200000f, 52},
-{-0.8163185f, -0.0612002f, -0.5743506f, 5.5400000f, 55},
-{-0.8520733f, -0.0747028f, 0.5180643f, 6.0300000f, 62},
-{-0.6390355f, -0.0442794f, -0.7679017f, 5.1500000f, 43},
-{-0.5514016f, -0.0363099f, -0.8334494f, 6.0100000f, 48},
-{-0.8368797f, -0.0617687f, -0.5438907f, 6.4000000f, 61},
-{-0.6917919f, -0.0621515f, 0.7194173f, 3.8000000f, 13},
-{-0.9618658f, -0.0791502f, 0.2618196f, 6.3400000f, 21},
-{-0.9907134f, -0.0799792f, 0.1099560f, 5.9500000f, 47},
-{-0.8515396f, -0.0719299f, 0.5193327f, 6.2800000f, 50},
-{-0.9067699f, -0.0749816f, 0.4149050f, 6.3600000f, 51},
-{-0.8955223f, -0.0653833f, -0.4401873f, 6.3600000f, 29},
-{-0.9585214f, -0.0755285f, 0.2748310f, 5.5200000f, 34},
-{-0.9353380f, -0.0677433f, -0.3472085f, 4.8700000f, 36},
-{-0.3604764f, -0.0363749f, 0.9320588f, 4.8000000f, 35},
-{-0.7499226f, -0.0501385f, -0.6596228f, 5.8700000f, 21},
-{-0.3472409f, -0.0354832f, 0.9371044f, 6.4200000f, 39},
-{-0.7231333f, -0.0612740f, 0.6879852f, 6.5900000f, 52},
-{-0.9738934f, -0.0689126f, -0.2162929f, 6.3900000f, 30},
-{-0.9902301f, -0.0701844f, -0.1204930f, 6.3000000f, 11},
-{-0.9068380f, -0.0694855f, 0.4157121f, 5.5200000f, 54},
-{-0.9942340f, -0.0718199f, 0.0796287f, 2.7700000f, 52},
-{-0.9664863f, -0.0702677f, 0.2469144f, 6.2400000f, 35},
-{-0.5381562f, -0.0456553f, 0.8416077f, 6.7700000f, 50},
-{-0.2999435f, -0.0300088f, 0.9534849f, 5.8600000f, 49},
-{-0.6161180f, -0.0502121f, 0.7860517f, 5.9900000f, 50},
-{-0.9088030f, -0.0661005f, 0.4119562f, 5.7100000f, 42},
-{-0.9967226f, -0.0672216f, 0.0450046f, 6.1700000f, 21},
-{-0.9967298f, -0.0671201f, 0.0449949f, 6.5600000f, 20},
-{-0.9662635f, -0.0663462f, 0.2488636f, 6.1900000f, 23},
-{-0.7163616f, -0.0529415f, 0.6957178f, 6.3400000f, 54},
-{-0.7879635f, -0.0443242f, -0.6141245f, 6.4300000f, 19},
-{-0.5785927f, -0.0287155f, -0.8151109f, 6.1100000f, 29},
-{-0.7663409f, -0.0415538f, -0.6410888f, 3.0300000f, 32},
-{-0.8961740f, -0.0486919f, -0.4410229f, 4.5400000f, 37},
-{-0.9289507f, -0.0496598f, -0.3668576f, 6.1800000f, 46},
-{-0.5891415f, -0.0412269f, 0.8069775f, 5.7500000f, 22},
-{-0.8509314f, -0.0532689f, 0.5225688f, 6.2300000f, 20},
-{-0.9718613f, -0.0525774f, -0.2296109f, 5.9400000f, 19},
-{-0.9049755f, -0.0455934f, -0.4230137f, 6.3500000f, 14},
-{-0.6097866f, -0.0253711f, -0.7921595f, 5.9200000f, 12},
-{-0.8836820f, -0.0522747f, 0.4651597f, 3.4200000f, 45},
-{-0.5021454f, -0.0184311f, -0.8645868f, 5.7800000f, 50},
-{-0.7769733f, -0.0478790f, 0.6277102f, 6.5200000f, 50},
-{-0.7721434f, -0.0473109f, 0.6336847f, 6.6800000f, 53},
-{-0.9511753f, -0.0534565f, 0.3039869f, 5.7200000f, 21},
-{-0.8624619f, -0.0407670f, -0.5044774f, 4.8300000f, 18},
-{-0.9974906f, -0.0527418f, 0.0472324f, 3.7500000f, 20},
-{-0.7983082f, -0.0353493f, -0.6012108f, 3.2100000f, 52},
-{-0.7663563f, -0.0328345f, -0.6415761f, 4.8100000f, 22},
-{-0.6031866f, -0.0232160f, -0.7972621f, 6.0900000f, 19},
-{-0.9965048f, -0.0507568f, 0.0663465f, 6.2200000f, 19},
-{-0.4301569f, -0.0125664f, -0.9026667f, 6.4900000f, 50},
-{-0.2449143f, -0.0024615f, -0.9695416f, 6.0700000f, 52},
-{-0.3055931f, -0.0241334f, 0.9518563f, 4.5800000f, 35},
-{-0.3054626f, -0.0240851f, 0.9518994f, 5.7900000f, 40},
-{-0.9350746f, -0.0473143f, 0.3512789f, 5.6900000f, 45},
-{-0.9983283f, -0.0465779f, 0.0342212f, 6.4700000f, 50},
-{-0.7140157f, -0.0257398f, -0.6996564f, 6.1100000f, 46},
-{-0.6730830f, -0.0378227f, 0.7385992f, 6.4300000f, 22},
-{-0.9429312f, -0.0461239f, 0.3297776f, 6.1200000f, 21},
-{-0.7741142f, -0.0285659f, -0.6324012f, 5.9600000f, 62},
-{-0.9005881f, -0.0439673f, 0.4324442f, 5.1200000f, 52},
-{-0.8702064f, -0.0333983f, -0.4915541f, 6.6600000f, 20},
-{-0.1647668f, 0.0039153f, -0.9863248f, 6.3500000f, 53},
-{-0.8362751f, -0.0283753f, -0.5475754f, 5.9000000f, 16},
-{-0.8326155f, -0.0278814f, -0.5531492f, 5.8400000f, 48},
-{-0.7656372f, -0.0237992f, -0.6428322f, 6.2000000f, 38},
-{-0.9775397f, -0.0395825f, 0.2070011f, 6.1700000f, 51},
-{-0.8297428f, -0.0260032f, -0.5575399f, 6.0600000f, 51},
-{-0.8189487f, -0.0252656f, -0.5733103f, 6.4500000f, 19},
-{-0.8249629f, -0.0253310f, -0.5646189f, 6.0300000f, 32},
-{-0.8711117f, -0.0365802f, 0.4897206f, 5.5000000f, 51},
-{-0.9243570f, -0.0370991f, 0.3797208f, 5.9800000f, 29},
-{-0.6315661f, -0.0301383f, 0.7747361f, 5.0200000f, 22},
-{-0.8357456f, -0.0243420f, -0.5485770f, 6.1700000f, 18},
-{-0.8373251f, -0.0241626f, -0.5461710f, 5.6000000f, 53},
-{-0.9993009f, -0.0349327f, -0.0133223f, 6.3500000f, 50},
-{-0.8363187f, -0.0227823f, -0.5477701f, 6.3800000f, 19},
-{-0.9942688f, -0.0319120f, -0.1020354f, 6.2100000f, 38},
-{-0.8360153f, -0.0222021f, -0.5482567f, 5.9600000f, 19},
-{-0.8367769f, -0.0220275f, -0.5471007f, 6.4200000f, 20},
-{-0.6633773f, -0.0288042f, 0.7477305f, 6.6800000f, 10},
-{-0.9638472f, -0.0337636f, 0.2643079f, 6.4600000f, 50},
-{-0.9869604f, -0.0298957f, -0.1581629f, 6.1800000f, 51},
-{-0.9992181f, -0.0323182f, 0.0227746f, 5.9500000f, 55},
-{-0.8333178f, -0.0201718f, -0.5524261f, 5.9600000f, 19},
-{-0.7646707f, -0.0292643f, 0.6437564f, 6.4600000f, 40},
-{-0.9939024f, -0.0293392f, 0.1062882f, 5.7700000f, 33},
-{-0.8136869f, -0.0172870f, -0.5810463f, 6.0600000f, 19},
-{-0.9195063f, -0.0204651f, -0.3925422f, 6.2000000f, 7},
-{-0.7657862f, -0.0264798f, 0.6425499f, 6.0400000f, 54},
-{-0.6861213f, -0.0239099f, 0.7270941f, 6.3800000f, 50},
-{-0.7234051f, -0.0101329f, -0.6903495f, 4.8600000f, 52},
-{-0.9808796f, -0.0246717f, 0.1930453f, 6.3800000f, 35},
-{-0.7656269f, -0.0223833f, 0.6428953f, 5.1600000f, 51},
-{-0.7693925f, -0.0103069f, -0.6386932f, 6.4300000f, 53},
-{-0.9551382f, -0.0170194f, -0.2956710f, 6.5200000f, 24},
-{-0.8833902f, -0.0127272f, -0.4684653f, 5.8000000f, 27},
-{-0.9693736f, -0.0155807f, -0.2450959f, 5.8900000f, 21},
-{-0.7628149f, -0.0073394f, -0.6465753f, 4.8800000f, 60},
-{-0.7786172f, -0.0069195f, -0.6274611f, 6.2900000f, 20},
-{-0.9998017f, -0.0161134f, 0.0116983f, 5.8200000f, 12},
-{-0.8982318f, -0.0179527f, 0.4391553f, 5.4600000f, 32},
-{-0.9975652f, -0.0139513f, -0.0683297f, 5.4700000f, 49},
-{-0.9239669f, -0.0167463f, 0.3821056f, 5.5800000f, 53},
-{-0.5462820f, -0.0154300f, 0.8374592f, 3.7500000f, 52},
-{-0.9999177f, -0.0127769f, 0.0011587f, 5.9700000f, 23},
-{-0.9935070f, -0.0132948f, 0.1129913f, 6.2900000f, 19},
-{-0.8177224f, -0.0038297f, -0.5756001f, 5.7400000f, 48},
-{-0.8890750f, -0.0052307f, -0.4577317f, 6.0100000f, 13},
-{-0.8682184f, -0.0034600f, -0.4961702f, 5.1600000f, 61},
-{-0.8682209f, -0.0034411f, -0.4961660f, 7.0400000f, 48},
-{-0.7958898f, -0.0130123f, 0.6053017f, 3.8600000f, 51},
-{-0.9814190f, -0.0109273f, 0.1915656f, 6.3600000f, 21},
-{-0.9135087f, -0.0110084f, 0.4066702f, 6.3000000f, 42},
-{-0.9897015f, -0.0042033f, -0.1430848f, 3.3400000f, 50},
-{-0.5594939f, -0.0112435f, 0.8287582f, 6.1000000f, 30},
-{-0.9259764f, -0.0008350f, -0.3775804f, 4.7600000f, 19},
-{-0.2253450f, -0.0103807f, 0.9742237f, 5.0400000f, 36},
-{-0.7026956f, -0.0097917f, 0.7114233f, 6.0200000f, 65},
-{-0.8724735f, -0.0085087f, 0.4885874f, 3.7000000f, 48},
-{-0.9417008f, 0.0000068f, -0.3364516f, 6.2100000f, 50},
-{-0.6225981f, -0.0092190f, 0.7824874f, 2.2300000f, 55},
-{-0.9984601f, -0.0016918f, -0.0554488f, 5.8700000f, 55},
-{-0.8643490f, -0.0056447f, 0.5028607f, 4.4100000f, 32},
-{-0.8128497f, 0.0064020f, -0.5824383f, 6.3000000f, 17},
-{-0.9999390f, 0.0011271f, 0.0109857f, 6.3700000f, 23},
-{-0.9991853f, 0.0021072f, -0.0403013f, 4.6200000f, 32},
-{-0.8060417f, -0.0045546f, 0.5918412f, 6.0000000f, 45},
-{-0.9970940f, 0.0011457f, 0.0761728f, 4.6400000f, 12},
-{-0.9575671f, 0.0002368f, 0.2882102f, 4.6700000f, 50},
-{-0.9986873f, 0.0028107f, 0.0511449f, 3.9700000f, 15},
-{-0.9570846f, 0.0057839f, -0.2897511f, 6.2800000f, 53},
-{-0.9321688f, 0.0077553f, -0.3619410f, 5.7700000f, 10},
-{-0.2024871f, -0.0086859f, 0.9792464f, 6.2400000f, 55},
-{-0.7011981f, -0.0034522f, 0.7129582f, 6.4800000f, 19},
-{-0.9940141f, 0.0038240f, 0.1091849f, 6.3400000f, 12},
-{-0.9426056f, 0.0018988f, 0.3339028f, 6.5000000f, 18},
-{-0.0611040f, 0.0148904f, -0.9980203f, 5.2800000f, 53},
-{-0.9654946f, 0.0040162f, 0.2603922f, 6.2600000f, 45},
-{-0.9997113f, 0.0076483f, 0.0227794f, 4.4500000f, 22},
-{-0.9154670f, 0.0113915f, -0.4022319f, 5.3400000f, 33},
-{-0.3088659f, -0.0064878f, 0.9510835f, 5.4500000f, 32},
-{-0.8366286f, 0.0022146f, 0.5477660f, 5.9900000f, 56},
-{-0.9317261f, 0.0123122f, -0.3629531f, 6.7400000f, 10},
-{-0.7008919f, -0.0001937f, 0.7132674f, 5.6700000f, 60},
-{-0.9297870f, 0.0060788f, 0.3680479f, 5.1800000f, 48},
-{-0.9297849f, 0.0061126f, 0.3680524f, 4.9600000f, 25},
-{-0.2734842f, 0.0134494f, -0.9617825f, 5.8600000f, 52},
-{-0.9966478f, 0.0120537f, -0.0809189f, 6.7600000f, 19},
-{-0.9906114f, 0.0133281f, -0.1360566f, 5.9400000f, 35},
-{-0.9906122f, 0.0133209f, -0.1360518f, 5.2400000f, 32},
-{-0.2558627f, -0.0062047f, 0.9666932f, 6.3600000f, 50},
-{-0.9159561f, 0.0154817f, -0.4009798f, 5.9700000f, 4},
-{-0.8356779f, 0.0058281f, 0.5491889f, 6.1500000f, 55},
-{-0.9345666f, 0.0097259f, 0.3556553f, 5.2800000f, 13},
-{-0.8278893f, 0.0174864f, -0.5606189f, 6.0000000f, 52},
-{-0.4467194f, 0.0152192f, -0.8945446f, 6.4100000f, 52},
-{-0.9209739f, 0.0100534f, 0.3894946f, 6.2100000f, 13},
-{-0.8792714f, 0.0192689f, -0.4759312f, 4.6900000f, 34},
-{-0.6437428f, 0.0186326f, -0.7650151f, 3.6600000f, 12},
-{-0.9418866f, 0.0133370f, 0.3356662f, 6.5000000f, 20},
-{-0.4640273f, 0.0173801f, -0.8856504f, 4.3500000f, 27},
-{-0.8694239f, 0.0220391f, -0.4935751f, 2.9900000f, 50},
-{-0.9992359f, 0.0201531f, 0.0334895f, 6.1400000f, 10},
-{-0.8089043f, 0.0225771f, -0.5875067f, 5.9500000f, 45},
-{-0.7360621f, 0.0219422f, -0.6765583f, 5.7700000f, 25},
-{-0.7360621f, 0.0219422f, -0.6765583f, 5.7700000f, 25},
-{-0.3031051f, 0.0166477f, -0.9528117f, 5.8500000f, 35},
-{-0.9987657f, 0.0237770f, 0.0436097f, 4.0300000f, 50},
-{-0.6630221f, 0.0091135f, 0.7485444f, 6.2100000f, 22},
-{-0.9137634f, 0.0186221f, 0.4058196f, 6.3400000f, 30},
-{-0.9906853f, 0.0264755f, -0.1335730f, 5.8500000f, 18},
-{-0.9980214f, 0.0272381f, -0.0566686f, 5.7700000f, 51},
-{-0.9996127f, 0.0267141f, 0.0077957f, 6.3400000f, 48},
-{-0.9778287f, 0.0244170f, 0.2079781f, 7.0400000f, 23},
-{-0.7160187f, 0.0265733f, -0.6975751f, 6.1500000f, 17},
-{-0.5151495f, 0.0224018f, -0.8568075f, 6.3800000f, 54},
-{-0.4690192f, 0.0213698f, -0.8829294f, 5.4900000f, 40},
-{-0.9358680f, 0.0293700f, -0.3511245f, 6.2800000f, 10},
-{-0.9292066f, 0.0223172f, 0.3688862f, 6.1500000f, 53},
-{-0.7649371f, 0.0157560f, 0.6439122f, 6.5200000f, 37},
-{-0.9254254f, 0.0243611f, 0.3781460f, 5.0600000f, 63},
-{-0.8861144f, 0.0312664f, -0.4624107f, 4.5700000f, 47},
-{-0.7435894f, 0.0162685f, 0.6684386f, 6.3400000f, 30},
-{-0.8456355f, 0.0215038f, 0.5333275f, 5.7100000f, 50},
-{-0.9565328f, 0.0325950f, -0.2897975f, 5.5200000f, 51},
-{-0.9879020f, 0.0315063f, 0.1518455f, 4.6400000f, 48},
-{-0.9855939f, 0.0316193f, 0.1661473f, 3.7300000f, 24},
-{-0.8151779f, 0.0333585f, -0.5782493f, 6.5800000f, 11},
-{-0.9090760f, 0.0353270f, -0.4151299f, 6.6100000f, 13},
-{-0.3536144f, 0.0222501f, -0.9351266f, 6.7300000f, 17},
-{-0.8606755f, 0.0263900f, 0.5084696f, 5.0400000f, 37},
-{-0.9735251f, 0.0331740f, 0.2261602f, 6.6300000f, 22},
-{-0.8538245f, 0.0372726f, -0.5192250f, 6.4300000f, 50},
-{-0.6877161f, 0.0332589f, -0.7252175f, 6.0700000f, 51},
-{-0.8761470f, 0.0288479f, 0.4811800f, 3.8300000f, 19},
-{-0.8714674f, 0.0384110f, -0.4889469f, 5.5300000f, 51},
-{-0.8974935f, 0.0306550f, 0.4399609f, 5.8600000f, 23},
-{-0.8975234f, 0.0306561f, 0.4399000f, 5.9000000f, 23},
-{-0.7179245f, 0.0352066f, -0.6952301f, 4.5300000f, 50},
-{-0.9684054f, 0.0361939f, 0.2467406f, 6.3700000f, 25},
-{-0.9770291f, 0.0414764f, -0.2090307f, 6.3900000f, 50},
-{-0.7579186f, 0.0367148f, -0.6513152f, 5.8600000f, 32},
-{-0.9340537f, 0.0357127f, 0.3553426f, 4.3600000f, 12},
-{-0.8452302f, 0.0403036f, -0.5328804f, 6.1600000f, 11},
-{-0.0591065f, -0.0072011f, 0.9982257f, 4.3600000f, 21},
-{-0.6314356f, 0.0189934f, 0.7751957f, 6.2900000f, 50},
-{-0.7254482f, 0.0236853f, 0.6878691f, 5.0000000f, 48},
-{-0.6463385f, 0.0200438f, 0.7627875f, 6.3200000f, 22},
-{-0.8043846f, 0.0282186f, 0.5934384f, 5.4800000f, 52},
-{-0.9387167f, 0.0363969f, 0.3427626f, 5.1000000f, 28},
-{-0.9967038f, 0.0416145f, 0.0696404f, 5.7300000f, 32},
-{-0.4637785f, 0.0289144f, -0.8854792f, 6.4700000f, 54},
-{-0.9975865f, 0.0431195f, 0.0544225f, 5.6900000f, 35},
-{-0.9490581f, 0.0466104f, -0.3116348f, 6.3600000f, 24},
-{-0.8612099f, 0.0344768f, 0.5070788f, 6.3800000f, 51},
-{-0.9972354f, 0.0464688f, 0.0579851f, 5.5100000f, 52},
-{-0.9240069f, 0.0473067f, -0.3794382f, 4.9800000f, 50},
-{-0.8890099f, 0.0464743f, -0.4555233f, 6.5100000f, 19},
-{-0.9579960f, 0.0424343f, 0.2836248f, 6.0900000f, 19},
-{-0.7572855f, 0.0436980f, -0.6516205f, 5.4700000f, 12},
-{-0.4537899f, 0.0310987f, -0.8905659f, 5.6000000f, 50},
-{-0.7823792f, 0.0328769f, 0.6219340f, 6.4000000f, 52},
-{-0.8034428f, 0.0350205f, 0.5943511f, 5.5800000f, 48},
-{-0.3771439f, 0.0297067f, -0.9256781f, 6.3300000f, 19},
-{-0.1736338f, 0.0000429f, 0.9848103f, 6.0400000f, 37},
-{-0.1735765f, 0.0001161f, 0.9848204f, 5.6800000f, 37},
-{-0.0524640f, -0.0067208f, 0.9986002f, 5.7900000f, 22},
-{-0.9322646f, 0.0560535f, -0.3574082f, 3.8600000f, 18},
-{-0.9959324f, 0.0572798f, -0.0695533f, 6.5900000f, 22},
-{-0.8332999f, 0.0427660f, 0.5511646f, 5.8800000f, 23},
-{-0.8523519f, 0.0443094f, 0.5210883f, 4.9700000f, 63},
-{-0.9361516f, 0.0583441f, -0.3467219f, 5.4400000f, 53},
-{-0.5831145f, 0.0268020f, 0.8119477f, 5.9500000f, 51},
-{-0.7201090f, 0.0499708f, -0.6920592f, 5.4600000f, 48},
-{-0.5579692f, 0.0417703f, -0.8288098f, 5.3300000f, 13},
-{-0.9264083f, 0.0537205f, 0.3726684f, 6.1200000f, 54},
-{-0.6285107f, 0.0467478f, -0.7763949f, 6.0600000f, 19},
-{-0.9418848f, 0.0626218f, -0.3300476f, 5.3800000f, 10},
-{-0.9399124f, 0.0624907f, -0.3356480f, 5.9500000f, 9},
-{-0.7518668f, 0.0417397f, 0.6579924f, 6.3600000f, 50},
-{-0.9523742f, 0.0645645f, -0.2980182f, 6.0700000f, 20},
-{-0.7783571f, 0.0444709f, 0.6262448f, 6.0400000f, 19},
-{-0.4932176f, 0.0239462f, 0.8695763f, 6.4900000f, 21},
-{-0.4660068f, 0.0400943f, -0.8838722f, 6.1800000f, 39},
-{-0.2581884f, 0.0266831f, -0.9657260f, 5.4700000f, 20},
-{-0.9967119f, 0.0695512f, -0.0415705f, 6.3600000f, 24},
-{-0.8710575f, 0.0560743f, 0.4879697f, 6.5600000f, 38},
-{-0.8143446f, 0.0627557f, -0.5769789f, 3.1100000f, 63},
-{-0.8276357f, 0.0636891f, -0.5576405f, 6.1600000f, 13},
-{-0.9966767f, 0.0701023f, 0.0414881f, 6.0100000f, 64},
-{-0.8856780f, 0.0673718f, -0.4593861f, 6.1900000f, 25},
-{-0.8827569f, 0.0671302f, -0.4650094f, 6.4000000f, 40},
-{-0.1761955f, 0.0226688f, -0.9840941f, 5.9500000f, 52},
-{-0.9554972f, 0.0718162f, -0.2861251f, 5.7500000f, 54},
-{-0.7440280f, 0.0607345f, -0.6653824f, 6.3000000f, 10},
-{-0.9959271f, 0.0735077f, -0.0522101f, 6.0000000f, 43},
-{-0.9507538f, 0.0726349f, -0.3013161f, 6.5400000f, 7},
-{-0.8885790f, 0.0701408f, -0.4533295f, 4.6500000f, 53},
-{-0.9868209f, 0.0750800f, -0.1433439f, 6.3100000f, 28},
-{-0.9970706f, 0.0744451f, 0.0175542f, 6.6300000f, 32},
-{-0.7395530f, 0.0505690f, 0.6711961f, 5.5900000f, 17},
-{-0.9076894f, 0.0742070f, -0.4130294f, 6.5100000f, 51},
-{-0.7028976f, 0.0477442f, 0.7096869f, 6.2900000f, 42},
-{-0.9511593f, 0.0778722f, -0.2987169f, 6.8400000f, 10},
-{-0.5495207f, 0.0352590f, 0.8347358f, 6.3700000f, 31},
-{-0.4313353f, 0.0261864f, 0.9018116f, 5.0300000f, 35},
-{-0.9682201f, 0.0764060f, 0.2381427f, 6.3000000f, 15},
-{-0.9473739f, 0.0750937f, 0.3111971f, 5.9900000f, 19},
-{-0.7533292f, 0.0563566f, 0.6552244f, 6.1100000f, 48},
-{-0.9155976f, 0.0725750f, 0.3954921f, 6.6300000f, 55},
-{-0.4898045f, 0.0498101f, -0.8704082f, 4.3600000f, 54},
-{-0.8003805f, 0.0732688f, -0.5949981f, 6.4500000f, 52},
-{-0.9885196f, 0.0828273f, 0.1263673f, 5.3900000f, 52},
-{-0.9658370f, 0.0851226f, -0.2447715f, 5.3900000f, 54},
-{-0.8778384f, 0.0806427f, -0.4721192f, 2.7000000f, 53},
-{-0.9071654f, 0.0760904f, 0.4138372f, 5.2700000f, 53},
-{-0.9158704f, 0.0862661f, -0.3920963f, 6.2500000f, 65},
-{-0.7912540f, 0.0772694f, -0.6065860f, 5.1000000f, 54},
-{-0.9514305f, 0.0890362f, -0.2947075f, 5.7500000f, 38},
-{-0.8823638f, 0.0849749f, -0.4628320f, 6.1600000f, 23},
-{-0.3615378f, 0.0241454f, 0.9320448f, 5.9500000f, 51},
-{-0.9941279f, 0.0907716f, 0.0589095f, 4.8600000f, 48},
-{-0.8656613f, 0.0752344f, 0.4949448f, 5.9900000f, 54},
-{-0.9238009f, 0.0820340f, 0.3739817f, 4.9500000f, 61},
-{-0.9954964f, 0.0928313f, -0.0192168f, 3.2600000f, 50},
-{-0.8117654f, 0.0813290f, -0.5782928f, 5.3400000f, 20},
-{-0.4515083f, 0.0504952f, -0.8908370f, 6.1400000f, 23},
-{-0.8053217f, 0.0699667f, 0.5886948f, 4.3300000f, 52},
-{-0.9911358f, 0.0931445f, 0.0947309f, 6.1300000f, 13},
-{-0.8071995f, 0.0829948f, -0.5844149f, 5.5500000f, 50},
-{-0.7166272f, 0.0762797f, -0.6932726f, 5.2500000f, 12},
-{-0.8636327f, 0.0791730f, 0.4978656f, 5.6300000f, 25},
-{-0.8720379f, 0.0801930f, 0.4828239f, 5.1200000f, 27},
-{-0.9804890f, 0.0988885f, -0.1698894f, 6.3300000f, 19},
-{-0.8281462f, 0.0876689f, -0.5536136f, 1.8500000f, 19},
-{-0.6222303f, 0.0542603f, 0.7809515f, 6.3000000f, 51},
-{-0.9731919f, 0.0988675f, -0.2076603f, 5.7300000f, 18},
-{-0.9142633f, 0.0886174f, 0.3953095f, 5.4100000f, 60},
-{-0.9732961f, 0.0962401f, 0.2084049f, 5.8900000f, 22},
-{-0.9871225f, 0.1022631f, -0.1230097f, 4.6800000f, 49},
-{-0.9472731f, 0.0946200f, 0.3061384f, 5.2500000f, 53},
-{-0.6437070f, 0.0594836f, 0.7629567f, 6.4000000f, 51},
-{-0.9530426f, 0.0961694f, 0.2871608f, 6.2200000f, 50},
-{-0.8673563f, 0.0950867f, -0.4885197f, 5.6000000f, 50},
-{-0.8238858f, 0.0915461f, -0.5593135f, 6.1500000f, 50},
-{-0.9936108f, 0.1046884f, -0.0421663f, 6.3800000f, 36},
-{-0.6515652f, 0.0614333f, 0.7561010f, 5.0500000f, 62},
-{-0.9869450f, 0.1067881f, -0.1205652f, 6.3100000f, 50},
-{-0.8421311f, 0.0956137f, -0.5307290f, 6.3000000f, 15},
-{-0.6660323f, 0.0785305f, -0.7417775f, 5.4600000f, 50},
-{-0.9237215f, 0.0958579f, 0.3708771f, 3.8400000f, 52},
-{-0.9371220f, 0.1040801f, -0.3331213f, 4.8100000f, 52},
-{-0.7139821f, 0.0844211f, -0.6950558f, 3.5100000f, 13},
-{-0.9940533f, 0.1086471f, -0.0073400f, 6.1500000f, 36},
-{-0.3052683f, 0.0441553f, -0.9512421f, 5.8900000f, 50},
-{-0.9900749f, 0.1090721f, 0.0886287f, 6.7400000f, 19},
-{-0.7757453f, 0.0813858f, 0.6257760f, 6.3600000f, 54},
-{-0.9839969f, 0.1105758f, 0.1397252f, 5.6500000f, 48},
-{-0.7672365f, 0.0814184f, 0.6361755f, 5.1200000f, 23},
-{-0.8825867f, 0.0965615f, 0.4601266f, 6.2700000f, 20},
-{-0.6517996f, 0.0824329f, -0.7538979f, 4.1300000f, 48},
-{-0.9599027f, 0.1090418f, 0.2582570f, 6.3700000f, 19},
-{-0.8749502f, 0.1067523f, -0.4722987f, 5.9200000f, 39},
-{-0.5475650f, 0.0719546f, -0.8336637f, 5.7600000f, 50},
-{-0.8969889f, 0.1090639f, -0.4283876f, 6.3100000f, 28},
-{-0.7924429f, 0.0988854f, -0.6018770f, 5.6400000f, 22},
-{-0.5943949f, 0.0619403f, 0.8017843f, 6.3200000f, 23},
-{-0.1674589f, 0.0312143f, -0.9853848f, 6.2700000f, 18},
-{-0.9026295f, 0.1107090f, -0.4159369f, 2.8100000f, 51},
-{-0.8977170f, 0.1106367f, -0.4264547f, 6.2700000f, 23},
-{-0.7353265f, 0.0942464f, -0.6711278f, 6.3600000f, 48},
-{-0.4693232f, 0.0646509f, -0.8806566f, 4.6400000f, 17},
-{-0.8619468f, 0.0981302f, 0.4974114f, 5.8300000f, 22},
-{-0.9929554f, 0.1184394f, 0.0034228f, 5.2100000f, 40},
-{-0.9531656f, 0.1167878f, -0.2789911f, 6.2000000f, 18},
-{-0.3186767f, 0.0289434f, 0.9474215f, 4.2200000f, 20},
-{-0.7905728f, 0.1015552f, -0.6038883f, 6.6300000f, 18},
-{-0.6789737f, 0.0891776f, -0.7287263f, 5.7000000f, 52},
-{-0.5152026f, 0.0539416f, 0.8553693f, 4.9800000f, 21},
-{-0.8892670f, 0.1039994f, 0.4454080f, 6.5300000f, 13},
-{-0.9905081f, 0.1209099f, 0.0653789f, 6.0700000f, 53},
-{-0.8959984f, 0.1138132f, -0.4292242f, 6.5000000f, 23},
-{-0.2955767f, 0.0272334f, 0.9549308f, 3.5700000f, 37},
-{-0.9867622f, 0.1210718f, 0.1078981f, 5.7300000f, 18},
-{-0.9007443f, 0.1160539f, -0.4185585f, 6.5900000f, 12},
-{-0.9647546f, 0.1235808f, -0.2323279f, 4.7000000f, 23},
-{-0.7580636f, 0.1033364f, -0.6439419f, 6.0400000f, 23},
-{-0.9645015f, 0.1260372f, -0.2320592f, 5.9600000f, 19},
-{-0.9466330f, 0.1254601f, -0.2968934f, 5.6600000f, 50},
-{-0.7114237f, 0.0992139f, -0.6957248f, 4.9600000f, 16},
-{-0.9916242f, 0.1291562f, -0.0002570f, 5.3900000f, 50},
-{-0.8492009f, 0.1158731f, -0.5152001f, 5.3400000f, 23},
-{-0.7302213f, 0.1024201f, -0.6754901f, 5.7200000f, 52},
-{-0.7094035f, 0.0998054f, -0.6977002f, 5.0700000f, 13},
-{-0.5346152f, 0.0786869f, -0.8414243f, 6.4400000f, 45},
-{-0.9885494f, 0.1311910f, -0.0745581f, 6.2800000f, 48},
-{-0.9889020f, 0.1305646f, 0.0708930f, 6.6900000f, 12},
-{-0.7770097f, 0.1104350f, -0.6197258f, 5.1600000f, 23},
-{-0.9068793f, 0.1177629f, 0.4046008f, 5.9000000f, 16},
-{-0.9442511f, 0.1303468f, -0.3023237f, 5.1400000f, 20},
-{-0.4110266f, 0.0468033f, 0.9104211f, 4.8200000f, 51},
-{-0.9778576f, 0.1349425f, -0.1599530f, 5.7200000f, 12},
-{-0.9370820f, 0.1312327f, -0.3235046f, 6.6800000f, 41},
-{-0.7787010f, 0.1129583f, -0.6171427f, 6.2200000f, 35},
-{-0.5031003f, 0.0611157f, 0.8620644f, 6.4300000f, 50},
-{-0.9263609f, 0.1248099f, 0.3553562f, 6.5000000f, 48},
-{-0.7388180f, 0.1087808f, -0.6650674f, 4.6400000f, 48},
-{-0.7872590f, 0.1155095f, -0.6057068f, 6.3200000f, 20},
-{-0.7873217f, 0.1155070f, -0.6056258f, 5.6500000f, 19},
-{-0.6207450f, 0.0942113f, -0.7783314f, 6.2200000f, 52},
-{-0.9478887f, 0.1293109f, 0.2911799f, 5.7700000f, 22},
-{-0.9632796f, 0.1368663f, -0.2309980f, 6.3700000f, 24},
-{-0.9901485f, 0.1389360f, -0.0173991f, 5.9400000f, 24},
-{-0.9881778f, 0.1393923f, 0.0638308f, 6.4300000f, 20},
-{-0.9639306f, 0.1385682f, -0.2272368f, 5.5000000f, 53},
-{-0.8296350f, 0.1238541f, -0.5443951f, 5.2800000f, 12},
-{-0.9038027f, 0.1346375f, -0.4062184f, 5.4900000f, 54},
-{-0.9633146f, 0.1424647f, -0.2274398f, 5.7600000f, 22},
-{-0.9868930f, 0.1447711f, -0.0712992f, 6.3600000f, 20},
-{-0.1240888f, 0.0286282f, -0.9918581f, 7.1600000f, 51},
-{-0.9047411f, 0.1374215f, -0.4031860f, 6.5100000f, 33},
-{-0.9068939f, 0.1305642f, 0.4006200f, 5.8400000f, 55},
-{-0.9791224f, 0.1436603f, 0.1438093f, 6.4200000f, 18},
-{-0.8523278f, 0.1229425f, 0.5083527f, 5.4800000f, 18},
-{-0.9333930f, 0.1451433f, -0.3281935f, 6.4800000f, 30},
-{-0.9761054f, 0.1504114f, -0.1568271f, 5.1400000f, 48},
-{-0.8490436f, 0.1245621f, 0.5134289f, 6.5900000f, 14},
-{-0.8696334f, 0.1377170f, -0.4741010f, 6.3700000f, 51},
-{-0.9791838f, 0.1516148f, -0.1349518f, 3.8500000f, 53},
-{-0.6080238f, 0.0859663f, 0.7892508f, 6.5600000f, 19},
-{-0.9263884f, 0.1397999f, 0.3496578f, 6.5700000f, 23},
-{-0.9706928f, 0.1485007f, 0.1889526f, 6.4000000f, 21},
-{-0.9387650f, 0.1453705f, 0.3123902f, 5.7800000f, 20},
-{-0.5384865f, 0.0770575f, 0.8391033f, 4.7700000f, 37},
-{-0.4118500f, 0.0565019f, 0.9094983f, 6.5900000f, 28},
-{-0.9053489f, 0.1413961f, 0.4004379f, 5.6100000f, 49},
-{-0.9447280f, 0.1491514f, 0.2919637f, 6.2100000f, 42},
-{-0.3267761f, 0.0620921f, -0.9430599f, 4.0100000f, 50},
-{-0.6040991f, 0.0901350f, 0.7917954f, 5.3600000f, 50},
-{-0.8148234f, 0.1262323f, 0.5657988f, 6.1000000f, 15},
-{-0.9748814f, 0.1564270f, 0.1585458f, 5.3900000f, 35},
-{-0.6833844f, 0.1181587f, -0.7204334f, 5.8600000f, 27},
-{-0.9805536f, 0.1581638f, 0.1161844f, 5.4500000f, 33},
-{-0.9232714f, 0.1541161f, -0.3518780f, 5.9400000f, 28},
-{-0.9569547f, 0.1604684f, -0.2418419f, 6.4700000f, 19},
-{-0.9108993f, 0.1545236f, -0.3826028f, 5.8100000f, 18},
-{-0.7226510f, 0.1260686f, -0.6796191f, 5.3700000f, 62},
-{-0.9673055f, 0.1584457f, 0.1980280f, 6.4200000f, 19},
-{-0.9865578f, 0.1633236f, 0.0054008f, 5.7500000f, 21},
-{-0.2344736f, 0.0496500f, -0.9708538f, 6.3900000f, 38},
-{-0.9477132f, 0.1549817f, 0.2789632f, 6.2900000f, 48},
-{-0.4407876f, 0.0824414f, -0.8938175f, 6.3700000f, 25},
-{-0.8235592f, 0.1327238f, 0.5514841f, 5.4200000f, 18},
-{-0.9204915f, 0.1577146f, -0.3575214f, 5.8600000f, 44},
-{-0.9848172f, 0.1665473f, -0.0489611f, 6.4900000f, 39},
-{-0.9859373f, 0.1663975f, -0.0154746f, 6.6600000f, 31},
-{-0.7694143f, 0.1250946f, 0.6263809f, 0.0300000f, 20},
-{-0.9743358f, 0.1645779f, 0.1535703f, 6.4000000f, 66},
-{-0.7193528f, 0.1163809f, 0.6848263f, 6.2000000f, 30},
-{-0.4389242f, 0.0845632f, -0.8945360f, 5.7800000f, 50},
-{-0.6593963f, 0.1207542f, -0.7420343f, 6.4900000f, 52},
-{-0.2138256f, 0.0279118f, 0.9764730f, 5.6400000f, 54},
-{-0.9790238f, 0.1726650f, -0.1081632f, 5.8400000f, 54},
-{-0.9809432f, 0.1712682f, 0.0917478f, 6.3800000f, 38},
-{-0.7591387f, 0.1274052f, 0.6383388f, 6.0400000f, 64},
-{-0.9768025f, 0.1716214f, 0.1280744f, 6.2800000f, 48},
-{-0.9106857f, 0.1682103f, -0.3773021f, 6.2300000f, 20},
-{-0.4431311f, 0.0890458f, -0.8920233f, 4.7900000f, 25},
-{-0.4097034f, 0.0652969f, 0.9098788f, 6.0600000f, 30},
-{-0.9565688f, 0.1760307f, -0.2323562f, 6.4200000f, 32},
-{-0.4768363f, 0.0952633f, -0.8738147f, 6.0400000f, 53},
-{-0.8454532f, 0.1492030f, 0.5127839f, 6.3600000f, 50},
-{-0.7442315f, 0.1297275f, 0.6552024f, 6.2500000f, 19},
-{-0.4551547f, 0.0752654f, 0.8872256f, 5.7400000f, 20},
-{-0.7720161f, 0.1368336f, 0.6206993f, 6.4500000f, 26},
-{-0.9710746f, 0.1811762f, -0.1555294f, 4.7200000f, 32},
-{-0.7770774f, 0.1502804f, -0.6112009f, 5.1300000f, 22},
-{-0.5607017f, 0.1125355f, -0.8203349f, 6.2200000f, 53},
-{-0.9305601f, 0.1763358f, -0.3208793f, 6.3500000f, 64},
-{-0.9756002f, 0.1834673f, -0.1205989f, 6.1500000f, 50},
-{-0.1181731f, 0.0125004f, 0.9929143f, 6.1700000f, 22},
-{-0.8012397f, 0.1562109f, -0.5775925f, 6.3200000f, 50},
-{-0.3178502f, 0.0700657f, -0.9455486f, 6.0600000f, 19},
-{-0.6037041f, 0.1061234f, 0.7901134f, 6.0000000f, 20},
-{-0.8101366f, 0.1586611f, -0.5643628f, 4.8700000f, 12},
-{-0.8375150f, 0.1540465f, 0.5242502f, 6.4100000f, 18},
-{-0.7695838f, 0.1529168f, -0.6199654f, 5.4300000f, 53},
-{-0.9731117f, 0.1870469f, -0.1344138f, 4.9000000f, 48},
-{-0.8078326f, 0.1502152f, 0.5699490f, 6.4700000f, 15},
-{-0.9777347f, 0.1894179f, -0.0903091f, 6.3100000f, 37},
-{-0.8891072f, 0.1761555f, -0.4224425f, 5.8300000f, 15},
-{-0.4143423f, 0.0892623f, -0.9057333f, 5.7300000f, 28},
-{-0.6305623f, 0.1311141f, -0.7649839f, 6.5400000f, 30},
-{-0.9154019f, 0.1833792f, -0.3583453f, 6.3600000f, 35},
-{-0.8883168f, 0.1793447f, -0.4227633f, 3.1700000f, 18},
-{-0.9802944f, 0.1942443f, 0.0359460f, 5.0200000f, 19},
-{-0.7600808f, 0.1452624f, 0.6333846f, 6.4500000f, 55},
-{-0.4505927f, 0.0813552f, 0.8890149f, 6.0900000f, 50},
-{-0.7887751f, 0.1519001f, 0.5956175f, 6.0100000f, 48},
-{-0.8332309f, 0.1614355f, 0.5288334f, 5.7000000f, 31},
-{-0.9298450f, 0.1892636f, -0.3155432f, 6.4200000f, 64},
-{-0.9107833f, 0.1867223f, -0.3682508f, 5.3700000f, 54},
-{-0.8990820f, 0.1774931f, 0.4001846f, 6.3100000f, 36},
-{-0.9758672f, 0.1962081f, 0.0958409f, 5.8300000f, 21},
-{-0.5560774f, 0.1046490f, 0.8245159f, 5.0400000f, 19},
-{-0.7539211f, 0.1593686f, -0.6373418f, 5.2400000f, 45},
-{-0.7553730f, 0.1479929f, 0.6383649f, 5.0600000f, 24},
-{-0.7553619f, 0.1479851f, 0.6383798f, 6.0200000f, 31},
-{-0.7559683f, 0.1482523f, 0.6375995f, 5.1400000f, 28},
-{-0.7559713f, 0.1482529f, 0.6375958f, 5.3700000f, 30},
-{-0.9647831f, 0.1994531f, -0.1714992f, 5.7100000f, 32},
-{-0.7771663f, 0.1537891f, 0.6102143f, 4.3600000f, 24},
-{-0.7772564f, 0.1539127f, 0.6100683f, 5.7300000f, 30},
-{-0.9089917f, 0.1832642f, 0.3743638f, 6.5100000f, 19},
-{-0.9793714f, 0.2013701f, 0.0167835f, 5.9000000f, 22},
-{-0.5790116f, 0.1111944f, 0.8077013f, 6.1100000f, 22},
-{-0.9178647f, 0.1853310f, 0.3509656f, 4.1900000f, 36},
-{-0.7226691f, 0.1563841f, -0.6732707f, 5.4900000f, 23},
-{-0.9773132f, 0.2040601f, -0.0567315f, 4.2200000f, 44},
-{-0.8756685f, 0.1784552f, 0.4487299f, 4.8300000f, 53},
-{-0.7004050f, 0.1535349f, -0.6970365f, 5.8100000f, 48},
-{-0.9758656f, 0.2051284f, -0.0748917f, 5.2000000f, 50},
-{-0.9275900f, 0.1916304f, 0.3207094f, 6.1700000f, 55},
-{-0.7193280f, 0.1580997f, -0.6764405f, 5.6100000f, 19},
-{-0.9301468f, 0.1935626f, 0.3120263f, 4.3600000f, 25},
-{-0.8170093f, 0.1784605f, -0.5483135f, 6.6200000f, 51},
-{-0.5640409f, 0.1119986f, 0.8181163f, 6.2300000f, 45},
-{-0.9327363f, 0.2014730f, -0.2990177f, 6.4700000f, 45},
-{-0.7344393f, 0.1501466f, 0.6618572f, 6.0700000f, 16},
-{-0.4601513f, 0.1066926f, -0.8814065f, 4.2200000f, 12},
-{-0.4750594f, 0.0929949f, 0.8750260f, 5.9900000f, 47},
-{-0.9754280f, 0.2075338f, 0.0739586f, 6.2100000f, 55},
-{-0.9242556f, 0.2031755f, -0.3232201f, 6.7500000f, 21},
-{-0.9195898f, 0.2024724f, -0.3366890f, 5.2400000f, 54},
-{-0.8966956f, 0.1917166f, 0.3989758f, 6.1500000f, 38},
-{-0.6762302f, 0.1406048f, 0.7231480f, 6.5200000f, 22},
-{-0.8317397f, 0.1766337f, 0.5263170f, 6.0600000f, 13},
-{-0.3231665f, 0.0616035f, 0.9443349f, 6.4400000f, 52},
-{-0.9741104f, 0.2145434f, -0.0712750f, 5.9900000f, 52},
-{-0.5895175f, 0.1218641f, 0.7985100f, 5.8800000f, 12},
-{-0.9765512f, 0.2147906f, 0.0145875f, 6.2500000f, 21},
-{-0.9222462f, 0.1997758f, 0.3309856f, 5.8800000f, 21},
-{-0.6009194f, 0.1405571f, -0.7868542f, 5.1700000f, 48},
-{-0.9054938f, 0.2042348f, -0.3719799f, 6.6100000f, 27},
-{-0.9704677f, 0.2166288f, -0.1061339f, 6.8000000f, 35},
-{-0.6409531f, 0.1352647f, 0.7555677f, 6.4000000f, 21},
-{-0.8851357f, 0.1931526f, 0.4233519f, 6.5900000f, 21},
-{-0.6837871f, 0.1592848f, -0.7120839f, 5.5400000f, 60},
-{-0.6246495f, 0.1476657f, -0.7668167f, 6.3100000f, 14},
-{-0.9653316f, 0.2183216f, -0.1430752f, 5.8300000f, 32},
-{-0.6558219f, 0.1545514f, -0.7389259f, 6.1900000f, 22},
-{-0.6445520f, 0.1377927f, 0.7520412f, 6.1200000f, 27},
-{-0.6832945f, 0.1608735f, -0.7121996f, 6.1900000f, 21},
-{-0.8314910f, 0.1833223f, 0.5244194f, 6.6400000f, 20},
-{-0.9577255f, 0.2156571f, 0.1904045f, 6.5500000f, 55},
-{-0.8207099f, 0.1810643f, 0.5418957f, 5.9100000f, 13},
-{-0.9739182f, 0.2220212f, -0.0467965f, 6.1000000f, 32},
-{-0.8230281f, 0.1820151f, 0.5380477f, 5.2500000f, 23},
-{-0.8801261f, 0.2051154f, -0.4281423f, 6.2900000f, 48},
-{-0.8547785f, 0.1997652f, -0.4790068f, 6.1300000f, 51},
-{-0.8494034f, 0.1988152f, -0.4888623f, 6.6300000f, 18},
-{-0.8153445f, 0.1810561f, 0.5499383f, 3.4500000f, 18},
-{-0.3823644f, 0.0970194f, -0.9189041f, 4.4400000f, 35},
-{-0.6487422f, 0.1573618f, -0.7445608f, 6.6000000f, 22},
-{-0.9455385f, 0.2184324f, 0.2413385f, 6.1400000f, 18},
-{-0.9628465f, 0.2268607f, -0.1464955f, 6.3400000f, 27},
-{-0.4669927f, 0.1184095f, -0.8762973f, 6.4800000f, 53},
-{-0.8543255f, 0.1956601f, 0.4815030f, 6.1800000f, 51},
-{-0.9067856f, 0.2104874f, 0.3652875f, 5.4800000f, 19},
-{-0.9099538f, 0.2184676f, -0.3524996f, 5.6900000f, 51},
-{-0.7831710f, 0.1794001f, 0.5953644f, 6.0900000f, 16},
-{-0.9060640f, 0.2182377f, -0.3625194f, 4.8300000f, 52},
-{-0.2687497f, 0.0544071f, 0.9616722f, 5.2700000f, 50},
-{-0.7309859f, 0.1691590f, 0.6610936f, 6.2800000f, 19},
-{-0.9411207f, 0.2290652f, -0.2486382f, 5.1000000f, 15},
-{-0.9047001f, 0.2218739f, -0.3637164f, 4.9900000f, 53},
-{-0.8749813f, 0.2151792f, -0.4337115f, 2.0200000f, 12},
-{-0.7288424f, 0.1826725f, -0.6598633f, 5.3600000f, 50},
-{-0.5869753f, 0.1343904f, 0.7983728f, 5.5100000f, 49},
-{-0.2463668f, 0.0505382f, 0.9678581f, 5.3500000f, 21},
-{-0.4965615f, 0.1128198f, 0.8606384f, 4.6600000f, 49},
-{-0.9349355f, 0.2310124f, -0.2693120f, 5.7900000f, 34},
-{-0.4866706f, 0.1272369f, -0.8642699f, 5.1400000f, 52},
-{-0.8942969f, 0.2230147f, -0.3879401f, 5.9300000f, 18},
-{-0.7778228f, 0.1963681f, -0.5970186f, 5.3800000f, 18},
-{-0.4028862f, 0.1080630f, -0.9088482f, 6.0100000f, 50},
-{-0.7770803f, 0.1855806f, 0.6014200f, 5.5800000f, 12},
-{-0.8590737f, 0.2071177f, 0.4680755f, 5.6200000f, 54},
-{-0.8966998f, 0.2183777f, 0.3850203f, 4.5900000f, 44},
-{-0.6081503f, 0.1585860f, -0.7778198f, 4.8700000f, 20},
-{-0.9644009f, 0.2380325f, 0.1152020f, 5.5700000f, 50},
-{-0.7614301f, 0.1954253f, -0.6180883f, 6.3100000f, 23},
-{-0.6162664f, 0.1457549f, 0.7739323f, 4.9200000f, 47},
-{-0.7311569f, 0.1763396f, 0.6590250f, 7.3000000f, 35},
-{-0.7771888f, 0.1883927f, 0.6004047f, 4.3000000f, 64},
-{-0.8056839f, 0.1966839f, 0.5587386f, 6.0200000f, 48},
-{-0.9674534f, 0.2421999f, 0.0733011f, 4.6200000f, 25},
-{-0.9674308f, 0.2422989f, 0.0732720f, 4.9800000f, 25},
-{-0.9698891f, 0.2435218f, -0.0034907f, 6.2200000f, 19},
-{-0.9689418f, 0.2435012f, 0.0431157f, 6.1500000f, 48},
-{-0.9141697f, 0.2336208f, -0.3312327f, 5.0800000f, 20},
-{-0.7264372f, 0.1773214f, 0.6639625f, 5.4400000f, 50},
-{-0.9227669f, 0.2303496f, 0.3089340f, 6.6300000f, 19},
-{-0.9221498f, 0.2303594f, 0.3107640f, 5.6900000f, 51},
-{-0.9666187f, 0.2457668f, -0.0724355f, 4.8300000f, 52},
-{-0.9047630f, 0.2328508f, -0.3566293f, 3.5100000f, 51},
-{-0.8298450f, 0.2159845f, -0.5144977f, 6.1200000f, 53},
-{-0.7736530f, 0.2026875f, -0.6003155f, 4.8700000f, 32},
-{-0.5227656f, 0.1249542f, 0.8432690f, 6.2200000f, 55},
-{-0.6391970f, 0.1557751f, 0.7531011f, 5.7700000f, 33},
-{-0.8900240f, 0.2315920f, -0.3927117f, 6.6200000f, 20},
-{-0.7570216f, 0.1999607f, -0.6220402f, 6.4900000f, 20},
-{-0.6991084f, 0.1721542f, 0.6939815f, 4.0400000f, 65},
-{-0.9679846f, 0.2470811f, 0.0442345f, 5.5700000f, 19},
-{-0.9005455f, 0.2346165f, -0.3660230f, 6.1400000f, 22},
-{-0.1711858f, 0.0345443f, 0.9846330f, 6.3900000f, 28},
-{-0.3720461f, 0.1057959f, -0.9221653f, 5.8800000f, 38},
-{-0.8137487f, 0.2067666f, 0.5431948f, 5.2200000f, 39},
-{-0.9619789f, 0.2505618f, 0.1086982f, 6.2100000f, 35},
-{-0.9221521f, 0.2447052f, -0.2995913f, 6.3700000f, 43},
-{-0.9237872f, 0.2399615f, 0.2983884f, 5.3800000f, 38},
-{-0.9483277f, 0.2514298f, -0.1935400f, 5.5300000f, 15},
-{-0.9389354f, 0.2462448f, 0.2403410f, 5.8900000f, 30},
-{-0.8883274f, 0.2397446f, -0.3916592f, 6.3600000f, 50},
-{-0.7710805f, 0.2104135f, -0.6009667f, 6.6900000f, 19},
-{-0.7710749f, 0.2104782f, -0.6009512f, 6.4000000f, 18},
-{-0.9101673f, 0.2385728f, 0.3386421f, 6.5000000f, 17},
-{-0.9397389f, 0.2478292f, 0.2355238f, 5.2300000f, 38},
-{-0.9516190f, 0.2518358f, 0.1760683f, 6.7500000f, 12},
-{-0.7601070f, 0.1966891f, 0.6193147f, 5.8900000f, 17},
-{-0.5164081f, 0.1305515f, 0.8463326f, 5.6600000f, 51},
-{-0.9331234f, 0.2483867f, 0.2599709f, 4.0200000f, 51},
-{-0.7370804f, 0.2049128f, -0.6439901f, 6.2300000f, 20},
-{-0.8139288f, 0.2140744f, 0.5400853f, 3.2400000f, 19},
-{-0.7335678f, 0.1923681f, 0.6518227f, 6.2200000f, 13},
-{-0.3116685f, 0.0753981f, 0.9471947f, 4.8200000f, 50},
-{-0.8667018f, 0.2312528f, 0.4419843f, 5.2700000f, 52},
-{-0.8981797f, 0.2475264f, -0.3633235f, 6.2400000f, 55},
-{-0.8903882f, 0.2384469f, 0.3877524f, 6.2900000f, 63},
-{-0.5101096f, 0.1306734f, 0.8501251f, 6.4600000f, 22},
-{-0.7490405f, 0.1979225f, 0.6322697f, 6.4100000f, 15},
-{-0.9325103f, 0.2566737f, -0.2540534f, 6.3200000f, 46},
-{-0.4059107f, 0.1020079f, 0.9082020f, 5.6300000f, 48},
-{-0.7162121f, 0.2023807f, -0.6678939f, 4.7500000f, 19},
-{-0.6052170f, 0.1734194f, -0.7769415f, 5.9300000f, 50},
-{-0.4489461f, 0.1146227f, 0.8861766f, 6.4500000f, 45},
-{-0.8178342f, 0.2191954f, 0.5320720f, 4.9300000f, 52},
-{-0.9613379f, 0.2651577f, -0.0743019f, 4.0200000f, 51},
-{-0.8492560f, 0.2379622f, -0.4713155f, 2.6000000f, 22},
-{-0.8855208f, 0.2474987f, -0.3931887f, 5.6500000f, 53},
-{-0.6110825f, 0.1608656f, 0.7750487f, 6.3000000f, 48},
-{-0.7607607f, 0.2156142f, -0.6121713f, 5.7400000f, 30},
-{-0.9104137f, 0.2485985f, 0.3306745f, 6.3900000f, 51},
-{-0.2388464f, 0.0568499f, 0.9693918f, 6.2200000f, 21},
-{-0.9013016f, 0.2473151f, 0.3556553f, 6.6900000f, 12},
-{-0.7322037f, 0.1972781f, 0.6518889f, 6.6500000f, 64},
-{-0.8646839f, 0.2369158f, 0.4429365f, 5.6900000f, 15},
-{-0.9112813f, 0.2572798f, -0.3215175f, 6.0500000f, 46},
-{-0.8017787f, 0.2182893f, 0.5563278f, 6.0100000f, 50},
-{-0.9104521f, 0.2572745f, -0.3238624f, 6.3700000f, 35},
-{-0.8736026f, 0.2405551f, 0.4230269f, 6.7200000f, 52},
-{-0.8919791f, 0.2466344f, 0.3788730f, 6.4000000f, 24},
-{-0.9529398f, 0.2658863f, 0.1456370f, 6.3000000f, 52},
-{-0.9617875f, 0.2708369f, -0.0401512f, 5.4200000f, 21},
-{-0.6138028f, 0.1651236f, 0.7719976f, 5.3800000f, 12},
-{-0.8239346f, 0.2378879f, -0.5143356f, 5.5000000f, 20},
-{-0.8026182f, 0.2218505f, 0.5537024f, 6.3900000f, 15},
-{-0.5945369f, 0.1770461f, -0.7843345f, 5.1600000f, 37},
-{-0.9613324f, 0.2735555f, 0.0317403f, 5.8300000f, 24},
-{-0.6584408f, 0.1808704f, 0.7305762f, 5.0100000f, 27},
-{-0.9064807f, 0.2551275f, 0.3364562f, 6.0900000f, 51},
-{-0.9010240f, 0.2612744f, -0.3462535f, 3.7700000f, 49},
-{-0.5444410f, 0.1477258f, 0.8256883f, 5.4800000f, 45},
-{-0.9594237f, 0.2759184f, 0.0580964f, 6.7300000f, 25},
-{-0.9580518f, 0.2765425f, -0.0752398f, 6.9000000f, 35},
-{-0.3638746f, 0.1145169f, -0.9243815f, 5.3300000f, 48},
-{-0.8961215f, 0.2557249f, 0.3627272f, 6.5200000f, 32},
-{-0.6445092f, 0.1937504f, -0.7396409f, 5.9700000f, 20},
-{-0.3382226f, 0.0888520f, 0.9368622f, 6.5200000f, 20},
-{-0.9577965f, 0.2789909f, -0.0692100f, 5.4200000f, 51},
-{-0.7659692f, 0.2284121f, -0.6009319f, 4.9300000f, 38},
-{-0.7659692f, 0.2284121f, -0.6009319f, 4.9900000f, 38},
-{-0.0350477f, 0.0378381f, -0.9986691f, 5.4700000f, 30},
-{-0.5897201f, 0.1638672f, 0.7908083f, 6.3100000f, 48},
-{-0.9293223f, 0.2738963f, -0.2476708f, 5.9700000f, 19},
-{-0.9596358f, 0.2811172f, -0.0085035f, 6.5300000f, 31},
-{-0.7729503f, 0.2321719f, -0.5904609f, 6.1600000f, 45},
-{-0.5576673f, 0.1728091f, -0.8118770f, 6.4900000f, 51},
-{-0.8582992f, 0.2580737f, -0.4435318f, 3.3200000f, 51},
-{-0.9315961f, 0.2733446f, 0.2396068f, 2.9900000f, 20},
-{-0.9570929f, 0.2846323f, -0.0543838f, 3.4400000f, 19},
-{-0.8164658f, 0.2378428f, 0.5261315f, 5.5600000f, 60},
-{-0.8252455f, 0.2404264f, 0.5110431f, 6.0600000f, 62},
-{-0.9216789f, 0.2768311f, -0.2717951f, 6.0300000f, 18},
-{-0.8498533f, 0.2578609f, -0.4596272f, 6.0400000f, 53},
-{-0.9142689f, 0.2757801f, -0.2967453f, 6.2900000f, 18},
-{-0.7375291f, 0.2267116f, -0.6361231f, 4.5900000f, 51},
-{-0.9484902f, 0.2826220f, 0.1431472f, 6.0900000f, 67},
-{-0.8312475f, 0.2453787f, 0.4988155f, 6.3100000f, 60},
-{-0.9573204f, 0.2888118f, 0.0111990f, 6.5600000f, 19},
-{-0.8777446f, 0.2693728f, -0.3962356f, 6.3000000f, 19},
-{-0.2169602f, 0.0560626f, 0.9745693f, 6.5400000f, 32},
-{-0.9397785f, 0.2827369f, 0.1920319f, 5.0900000f, 18},
-{-0.9054312f, 0.2780209f, -0.3207783f, 5.5400000f, 12},
-{-0.8734832f, 0.2613930f, 0.4107321f, 5.7700000f, 24},
-{-0.5725087f, 0.1666543f, 0.8027828f, 5.3800000f, 20},
-{-0.6179618f, 0.1806022f, 0.7651837f, 6.4300000f, 53},
-{-0.8409115f, 0.2515991f, 0.4791302f, 5.5500000f, 30},
-{-0.7711953f, 0.2412038f, -0.5891337f, 4.1100000f, 22},
-{-0.7501219f, 0.2352956f, -0.6180235f, 6.4600000f, 50},
-{-0.7735989f, 0.2424559f, -0.5854569f, 6.5600000f, 20},
-{-0.7294749f, 0.2298742f, -0.6442238f, 5.8800000f, 16},
-{-0.7188037f, 0.2138863f, 0.6614937f, 6.4900000f, 13},
-{-0.7447055f, 0.2349060f, -0.6246863f, 4.1100000f, 50},
-{-0.9152864f, 0.2796346f, 0.2899228f, 6.0700000f, 45},
-{-0.8071386f, 0.2445608f, 0.5373241f, 5.2300000f, 30},
-{-0.7733981f, 0.2338770f, 0.5892003f, 5.2800000f, 16},
-{-0.8884696f, 0.2718868f, 0.3697287f, 6.2300000f, 33},
-{-0.8908017f, 0.2798577f, -0.3579832f, 2.8900000f, 32},
-{-0.9062701f, 0.2848839f, -0.3122750f, 6.1300000f, 51},
-{-0.9496618f, 0.2948703f, 0.1058013f, 5.2200000f, 30},
-{-0.9144190f, 0.2824917f, 0.2898903f, 6.4800000f, 35},
-{-0.7401718f, 0.2370377f, -0.6292526f, 6.3600000f, 17},
-{-0.9538738f, 0.3001148f, 0.0074709f, 6.3400000f, 15},
-{-0.8366303f, 0.2690758f, -0.4771247f, 6.3000000f, 19},
-{-0.6168139f, 0.2027037f, -0.7605602f, 6.1300000f, 48},
-{-0.7860282f, 0.2443440f, 0.5678517f, 6.7400000f, 41},
-{-0.7651524f, 0.2492161f, -0.5936608f, 6.5700000f, 42},
-{-0.3415328f, 0.1183915f, -0.9323834f, 6.2700000f, 26},
-{-0.5828112f, 0.1793796f, 0.7925617f, 5.8100000f, 51},
-{-0.8911518f, 0.2915602f, -0.3476222f, 6.4100000f, 48},
-{-0.8666777f, 0.2867451f, -0.4082242f, 5.8000000f, 51},
-{-0.3938054f, 0.1379087f, -0.9087896f, 5.5300000f, 25},
-{-0.9448273f, 0.3100877f, -0.1055795f, 5.3400000f, 13},
-{-0.8499614f, 0.2741820f, 0.4498776f, 6.3600000f, 35},
-{-0.6721722f, 0.2270656f, -0.7047168f, 5.9200000f, 48},
-{-0.9295620f, 0.3076857f, -0.2030864f, 5.5100000f, 54},
-{-0.8130508f, 0.2632614f, 0.5192705f, 5.9800000f, 19},
-{-0.7245807f, 0.2332828f, 0.6485075f, 6.1800000f, 23},
-{-0.9094994f, 0.2980318f, 0.2898068f, 6.7300000f, 19},
-{-0.8837779f, 0.2897668f, 0.3673852f, 5.9300000f, 22},
-{-0.9479620f, 0.3158581f, 0.0400204f, 5.1500000f, 18},
-{-0.9442972f, 0.3147438f, 0.0961208f, 6.4900000f, 22},
-{-0.6736356f, 0.2331411f, -0.7013276f, 5.4000000f, 53},
-{-0.3883631f, 0.1220096f, 0.9133936f, 6.2500000f, 20},
-{-0.8655514f, 0.2961476f, -0.4038780f, 6.2500000f, 39},
-{-0.8593040f, 0.2939542f, -0.4185541f, 4.8500000f, 48},
-{-0.6131130f, 0.1994393f, 0.7644059f, 6.7500000f, 44},
-{-0.6130826f, 0.1994491f, 0.7644278f, 6.5700000f, 44},
-{-0.5201805f, 0.1682017f, 0.8373293f, 5.1200000f, 48},
-{-0.7969770f, 0.2765493f, -0.5369806f, 6.2500000f, 40},
-{-0.5722247f, 0.2030757f, -0.7945559f, 6.3800000f, 37},
-{-0.7357207f, 0.2453063f, 0.6313002f, 4.3900000f, 12},
-{-0.8886112f, 0.3018303f, 0.3453528f, 6.0000000f, 48},
-{-0.9138510f, 0.3117011f, 0.2602283f, 5.5700000f, 48},
-{-0.8822729f, 0.3007369f, 0.3621488f, 5.6400000f, 24},
-{-0.8151805f, 0.2783571f, 0.5079352f, 5.8500000f, 60},
-{-0.9414207f, 0.3265329f, 0.0842817f, 5.5900000f, 23},
-{-0.9017336f, 0.3177053f, -0.2931551f, 4.9600000f, 48},
-{-0.8390866f, 0.2887160f, 0.4610604f, 6.5400000f, 18},
-{-0.8801021f, 0.3039744f, 0.3647188f, 4.7700000f, 14},
-{-0.9146006f, 0.3169174f, 0.2511356f, 5.6300000f, 19},
-{-0.8354212f, 0.2876178f, 0.4683454f, 6.1600000f, 36},
-{-0.5067282f, 0.1693522f, 0.8453085f, 4.9900000f, 52},
-{-0.3611874f, 0.1183247f, 0.9249556f, 3.0700000f, 49},
-{-0.6074875f, 0.2071656f, 0.7668385f, 6.2700000f, 48},
-{-0.2219142f, 0.0690796f, 0.9726161f, 5.1300000f, 29},
-{-0.9423349f, 0.3327885f, 0.0354518f, 6.1900000f, 21},
-{-0.7433068f, 0.2572780f, 0.6174974f, 4.3600000f, 50},
-{-0.9236652f, 0.3262557f, 0.2009972f, 5.2800000f, 30},
-{-0.7741031f, 0.2804761f, -0.5675364f, 5.5900000f, 13},
-{-0.9113444f, 0.3272136f, -0.2497651f, 6.0600000f, 53},
-{-0.8679075f, 0.3061777f, 0.3911417f, 5.4300000f, 10},
-{-0.9416810f, 0.3359735f, 0.0189405f, 5.1000000f, 52},
-{-0.3552710f, 0.1365359f, -0.9247381f, 6.3400000f, 52},
-{-0.9413829f, 0.3372879f, 0.0059195f, 6.4100000f, 50},
-{-0.6440177f, 0.2244493f, 0.7313438f, 6.0000000f, 36},
-{-0.8117345f, 0.2971999f, -0.5027518f, 6.5800000f, 60},
-{-0.8077965f, 0.2861086f, 0.5153705f, 6.6800000f, 23},
-{-0.9281231f, 0.3326741f, 0.1670795f, 6.3200000f, 49},
-{-0.8868496f, 0.3175745f, 0.3356251f, 6.5800000f, 18},
-{-0.8728347f, 0.3204274f, -0.3680840f, 5.5800000f, 30},
-{-0.5632157f, 0.1969687f, 0.8024907f, 3.7700000f, 49},
-{-0.5553731f, 0.2100011f, -0.8046492f, 5.0500000f, 20},
-{-0.7860568f, 0.2919351f, -0.5448748f, 6.4800000f, 45},
-{-0.9183625f, 0.3326919f, 0.2143044f, 5.5300000f, 30},
-{-0.9208839f, 0.3346435f, 0.1999665f, 6.0200000f, 22},
-{-0.9358682f, 0.3431661f, -0.0799235f, 5.0100000f, 48},
-{-0.6960774f, 0.2608067f, -0.6689216f, 6.3400000f, 51},
-{-0.7857612f, 0.2823623f, 0.5503188f, 6.6000000f, 12},
-{-0.9386877f, 0.3444168f, 0.0155716f, 5.4900000f, 19},
-{-0.6782655f, 0.2557486f, -0.6888749f, 4.0100000f, 19},
-{-0.7472086f, 0.2683489f, 0.6080034f, 6.2200000f, 20},
-{-0.8874309f, 0.3301134f, -0.3217011f, 6.2600000f, 15},
-{-0.9001740f, 0.3350996f, -0.2781996f, 3.9300000f, 30},
-{-0.6107282f, 0.2181564f, 0.7611957f, 6.3100000f, 51},
-{-0.9090753f, 0.3386541f, -0.2426839f, 4.6100000f, 12},
-{-0.6814329f, 0.2589201f, -0.6845506f, 4.2900000f, 32},
-{-0.8925935f, 0.3330539f, -0.3038945f, 5.8700000f, 49},
-{-0.7476132f, 0.2708105f, 0.6064125f, 6.3100000f, 48},
-{-0.7673212f, 0.2813756f, 0.5762342f, 6.3100000f, 19},
-{-0.9274851f, 0.3483647f, -0.1356964f, 6.3100000f, 13},
-{-0.7217124f, 0.2766300f, -0.6345132f, 3.9700000f, 18},
-{-0.9361144f, 0.3516680f, 0.0044069f, 5.8300000f, 48},
-{-0.6903444f, 0.2662318f, -0.6727148f, 6.1700000f, 61},
-{-0.5476748f, 0.1982780f, 0.8128580f, 6.2600000f, 21},
-{-0.2710090f, 0.0927211f, 0.9581007f, 4.4500000f, 52},
-{-0.9288206f, 0.3522540f, -0.1149323f, 6.3200000f, 50},
-{-0.9214678f, 0.3482243f, 0.1721536f, 6.3500000f, 36},
-{-0.8374277f, 0.3235633f, -0.4404790f, 6.0400000f, 12},
-{-0.5026707f, 0.1836240f, 0.8447511f, 5.9100000f, 61},
-{-0.9033993f, 0.3428836f, 0.2574888f, 6.6400000f, 31},
-{-0.8388171f, 0.3171647f, 0.4424843f, 5.1800000f, 16},
-{-0.7802032f, 0.2938680f, 0.5521997f, 6.0600000f, 50},
-{-0.8174839f, 0.3181827f, -0.4800832f, 5.9300000f, 53},
-{-0.4063126f, 0.1474207f, 0.9017634f, 6.5200000f, 19},
-{-0.8543636f, 0.3334246f, -0.3986112f, 5.0300000f, 20},
-{-0.8631846f, 0.3378222f, -0.3752178f, 5.4300000f, 54},
-{-0.8761155f, 0.3353519f, 0.3463536f, 6.4000000f, 19},
-{-0.5000560f, 0.1855305f, 0.8458856f, 6.4300000f, 52},
-{-0.9305880f, 0.3620105f, -0.0543548f, 6.5200000f, 29},
-{-0.9107335f, 0.3558128f, -0.2096707f, 5.6900000f, 53},
-{-0.7815539f, 0.2983162f, 0.5478877f, 6.3700000f, 48},
-{-0.8925312f, 0.3442574f, 0.2913330f, 6.2500000f, 22},
-{-0.5494265f, 0.2214298f, -0.8056670f, 5.6900000f, 54},
-{-0.3860651f, 0.1417925f, 0.9115090f, 4.5900000f, 22},
-{-0.8113989f, 0.3119815f, 0.4942664f, 4.9700000f, 13},
-{-0.9118751f, 0.3544714f, 0.2069632f, 5.1600000f, 48},
-{-0.8231140f, 0.3175032f, 0.4708237f, 6.5300000f, 15},
-{-0.8725785f, 0.3451260f, -0.3456804f, 5.5900000f, 53},
-{-0.7508026f, 0.2885883f, 0.5941484f, 6.3600000f, 51},
-{-0.9298419f, 0.3639253f, 0.0543354f, 3.3600000f, 33},
-{-0.8986508f, 0.3548262f, -0.2579245f, 5.7200000f, 18},
-{-0.9042643f, 0.3580692f, -0.2325779f, 6.7000000f, 21},
-{-0.8182116f, 0.3261920f, -0.4734222f, 5.6700000f, 19},
-{-0.5973007f, 0.2274799f, 0.7690805f, 6.5100000f, 19},
-{-0.6785159f, 0.2602597f, 0.6869360f, 5.8400000f, 47},
-{-0.3518106f, 0.1478545f, -0.9243205f, 5.9600000f, 54},
-{-0.8737262f, 0.3414131f, 0.3464673f, 6.3100000f, 20},
-{-0.8762048f, 0.3428371f, 0.3387151f, 5.1600000f, 50},
-{-0.8446664f, 0.3302986f, 0.4212381f, 6.1900000f, 37},
-{-0.9295701f, 0.3685981f, 0.0059098f, 4.6600000f, 32},
-{-0.5358492f, 0.2216183f, -0.8147091f, 6.1300000f, 50},
-{-0.9058565f, 0.3586616f, 0.2253573f, 5.7400000f, 36},
-{-0.8734314f, 0.3450227f, 0.3436233f, 5.6300000f, 20},
-{-0.8741870f, 0.3464608f, 0.3402382f, 5.8100000f, 60},
-{-0.6813028f, 0.2801116f, -0.6762869f, 5.7100000f, 20},
-{-0.5308136f, 0.2214321f, -0.8180493f, 6.3000000f, 35},
-{-0.0164977f, -0.0031362f, 0.9998590f, 6.3800000f, 61},
-{-0.7494833f, 0.2958024f, 0.5922632f, 5.1500000f, 19},
-{-0.8992131f, 0.3613218f, 0.2467030f, 6.3200000f, 14},
-{-0.9254046f, 0.3755170f, 0.0511207f, 5.8500000f, 16},
-{-0.8374173f, 0.3463132f, -0.4228467f, 5.5200000f, 53},
-{-0.7839336f, 0.3256982f, -0.5285536f, 6.6000000f, 33},
-{-0.9249769f, 0.3784965f, 0.0340322f, 5.8000000f, 20},
-{-0.4928587f, 0.1935918f, 0.8482998f, 6.6000000f, 18},
-{-0.9181390f, 0.3772975f, -0.1211090f, 6.6100000f, 37},
-{-0.7317210f, 0.2941809f, 0.6148512f, 6.3400000f, 13},
-{-0.9250355f, 0.3798563f, 0.0042954f, 6.2500000f, 52},
-{-0.8415394f, 0.3430190f, 0.4173120f, 4.4400000f, 60},
-{-0.8404724f, 0.3436323f, 0.4189547f, 5.8100000f, 50},
-{-0.8950809f, 0.3678677f, 0.2519990f, 5.5600000f, 50},
-{-0.5673008f, 0.2275696f, 0.7914429f, 5.7500000f, 21},
-{-0.8676270f, 0.3564959f, 0.3466037f, 6.3300000f, 15},
-{-0.8628947f, 0.3613991f, -0.3532753f, 6.1300000f, 22},
-{-0.5554269f, 0.2383336f, -0.7966794f, 5.7500000f, 30},
-{-0.9224009f, 0.3828964f, 0.0506656f, 6.0900000f, 55},
-{-0.4284683f, 0.1697327f, 0.8874715f, 6.3800000f, 55},
-{-0.9225619f, 0.3852698f, -0.0211363f, 5.0300000f, 61},
-{-0.9212884f, 0.3842109f, 0.0600807f, 6.0500000f, 20},
-{-0.6523184f, 0.2814727f, -0.7037427f, 5.6100000f, 20},
-{-0.8149735f, 0.3405836f, 0.4688508f, 3.0800000f, 53},
-{-0.8148820f, 0.3406845f, 0.4689364f, 5.1100000f, 18},
-{-0.7442044f, 0.3112375f, 0.5910086f, 6.2500000f, 19},
-{-0.5725296f, 0.2362866f, 0.7850978f, 3.7900000f, 25},
-{-0.8239166f, 0.3470338f, 0.4480278f, 5.8700000f, 50},
-{-0.7026768f, 0.3060492f, -0.6423233f, 5.8900000f, 23},
-{-0.1691334f, 0.0629590f, 0.9835802f, 6.0500000f, 23},
-{-0.6133838f, 0.2705878f, -0.7419856f, 4.9000000f, 50},
-{-0.1077860f, 0.0366566f, 0.9934981f, 6.5300000f, 23},
-{-0.7593597f, 0.3214366f, 0.5657308f, 4.7400000f, 13},
-{-0.5886425f, 0.2478103f, 0.7694739f, 5.5300000f, 51},
-{-0.5190438f, 0.2182570f, 0.8264124f, 6.3700000f, 52},
-{-0.9093101f, 0.3958040f, 0.1284302f, 4.4500000f, 53},
-{-0.9027059f, 0.3977722f, -0.1640099f, 5.1200000f, 49},
-{-0.8391172f, 0.3737233f, -0.3952382f, 5.6500000f, 27},
-{-0.9084864f, 0.4020958f, -0.1138920f, 6.3400000f, 50},
-{-0.8951744f, 0.3964998f, -0.2035943f, 6.2700000f, 50},
-{-0.5081869f, 0.2327511f, -0.8292002f, 6.1800000f, 50},
-{-0.3786099f, 0.1762840f, -0.9086135f, 6.3900000f, 21},
-{-0.7156110f, 0.3096973f, 0.6260898f, 6.6100000f, 23},
-{-0.8620335f, 0.3774272f, 0.3383000f, 5.0000000f, 18},
-{-0.9133898f, 0.4039007f, 0.0508254f, 6.3800000f, 36},
-{-0.8721994f, 0.3903135f, -0.2948280f, 6.1100000f, 30},
-{-0.8390388f, 0.3766683f, -0.3926002f, 4.6000000f, 19},
-{-0.7971689f, 0.3501332f, 0.4918623f, 5.3800000f, 38},
-{-0.5988160f, 0.2594204f, 0.7577074f, 5.9600000f, 64},
-{-0.8681728f, 0.3913340f, -0.3051783f, 5.6400000f, 53},
-{-0.6761849f, 0.2964257f, 0.6744671f, 5.3500000f, 22},
-{-0.8960693f, 0.3995806f, 0.1933782f, 6.6800000f, 23},
-{-0.9052117f, 0.4072536f, -0.1213929f, 4.9500000f, 10},
-{-0.9121894f, 0.4095795f, -0.0124545f, 4.3600000f, 15},
-{-0.4570467f, 0.1967606f, 0.8674062f, 6.2900000f, 54},
-{-0.8844245f, 0.3949894f, 0.2485490f, 6.3800000f, 50},
-{-0.3003981f, 0.1259725f, 0.9454586f, 6.0700000f, 52},
-{-0.5738158f, 0.2504853f, 0.7797388f, 5.7300000f, 37},
-{-0.8432545f, 0.3760511f, 0.3840670f, 6.3200000f, 19},
-{-0.6108968f, 0.2677359f, 0.7450655f, 6.6700000f, 29},
-{-0.8848269f, 0.4012511f, -0.2368099f, 5.4700000f, 35},
-{-0.3939079f, 0.1870939f, -0.8999069f, 6.0900000f, 60},
-{-0.8943898f, 0.4023066f, 0.1954897f, 5.9800000f, 40},
-{-0.7303989f, 0.3244502f, 0.6010404f, 6.0500000f, 18},
-{-0.8555739f, 0.3837401f, 0.3474721f, 7.1400000f, 32},
-{-0.5377086f, 0.2516094f, -0.8047125f, 6.2600000f, 50},
-{-0.9087860f, 0.4131444f, -0.0584788f, 5.4600000f, 33},
-{-0.6443514f, 0.2994398f, -0.7036669f, 6.2500000f, 32},
-{-0.3197281f, 0.1363097f, 0.9376532f, 4.6800000f, 50},
-{-0.8738844f, 0.3949871f, 0.2833924f, 5.6600000f, 48},
-{-0.7087302f, 0.3302166f, -0.6234248f, 6.6100000f, 22},
-{-0.5843737f, 0.2599712f, 0.7687147f, 6.5200000f, 49},
-{-0.7946128f, 0.3586006f, 0.4898939f, 6.4300000f, 15},
-{-0.7147808f, 0.3217727f, 0.6209274f, 6.5000000f, 15},
-{-0.6486043f, 0.2909219f, 0.7033327f, 5.1700000f, 49},
-{-0.5840081f, 0.2613669f, 0.7685193f, 4.4800000f, 34},
-{-0.8371819f, 0.3895990f, -0.3838477f, 6.3400000f, 19},
-{-0.9068959f, 0.4172054f, 0.0589870f, 6.3500000f, 13},
-{-0.8502581f, 0.3887925f, 0.3548260f, 6.4800000f, 50},
-{-0.8366848f, 0.3906786f, -0.3838343f, 5.9700000f, 51},
-{-0.9037642f, 0.4175658f, 0.0940697f, 5.1700000f, 13},
-{-0.8696809f, 0.4028779f, 0.2852098f, 6.3800000f, 54},
-{-0.8711781f, 0.4095894f, -0.2707125f, 6.2000000f, 52},
-{-0.5936365f, 0.2703637f, 0.7579573f, 6.4700000f, 46},
-{-0.7846610f, 0.3632986f, 0.5023158f, 4.6900000f, 48},
-{-0.8617124f, 0.4022657f, 0.3092475f, 4.3700000f, 41},
-{-0.9049194f, 0.4254450f, 0.0108402f, 5.6700000f, 23},
-{-0.7519293f, 0.3496323f, 0.5588914f, 6.1000000f, 23},
-{-0.8482259f, 0.3976615f, 0.3498259f, 6.5000000f, 10},
-{-0.6655413f, 0.3083753f, 0.6796760f, 5.4000000f, 19},
-{-0.5215565f, 0.2395768f, 0.8188906f, 5.8200000f, 36},
-{-0.8286403f, 0.3893178f, 0.4022274f, 6.6400000f, 16},
-{-0.8781230f, 0.4145791f, 0.2387971f, 6.0100000f, 15},
-{-0.6305973f, 0.2926243f, 0.7188311f, 6.2000000f, 48},
-{-0.8626217f, 0.4070612f, 0.3003081f, 4.3700000f, 48},
-{-0.8672178f, 0.4160519f, -0.2735582f, 5.0600000f, 31},
-{-0.8354649f, 0.3951380f, 0.3819219f, 6.3600000f, 50},
-{-0.7234378f, 0.3513866f, -0.5942770f, 6.1600000f, 18},
-{-0.6610640f, 0.3106739f, 0.6829905f, 6.1600000f, 62},
-{-0.8818313f, 0.4216200f, 0.2112111f, 6.3400000f, 19},
-{-0.1420823f, 0.0787778f, -0.9867151f, 6.3900000f, 53},
-{-0.6338723f, 0.2984015f, 0.7135562f, 5.0600000f, 35},
-{-0.8708635f, 0.4226730f, -0.2508869f, 5.4900000f, 35},
-{-0.8823807f, 0.4235553f, 0.2049516f, 5.2700000f, 40},
-{-0.2818705f, 0.1458296f, -0.9483052f, 5.4100000f, 24},
-{-0.6889025f, 0.3284359f, 0.6461758f, 6.2300000f, 26},
-{-0.4459910f, 0.2084825f, 0.8704178f, 6.5100000f, 25},
-{-0.7855275f, 0.3781262f, 0.4898644f, 6.4900000f, 31},
-{-0.7606702f, 0.3658542f, 0.5362197f, 5.9400000f, 25},
-{-0.5740283f, 0.2732289f, 0.7719051f, 5.9600000f, 41},
-{-0.5740613f, 0.2734033f, 0.7718188f, 6.2000000f, 42},
-{-0.7743807f, 0.3741766f, 0.5102219f, 6.0500000f, 21},
-{-0.8098829f, 0.3937603f, 0.4347902f, 5.4900000f, 48},
-{-0.7742875f, 0.3861299f, -0.5013807f, 5.5200000f, 18},
-{-0.7999800f, 0.3898811f, 0.4560973f, 6.2800000f, 17},
-{-0.5116331f, 0.2442237f, 0.8237635f, 6.4800000f, 65},
-{-0.5028856f, 0.2562883f, -0.8254831f, 5.3500000f, 27},
-{-0.8736167f, 0.4287764f, 0.2300969f, 6.2600000f, 19},
-{-0.7439323f, 0.3622643f, 0.5615419f, 6.0500000f, 18},
-{-0.3723325f, 0.1935935f, -0.9076839f, 6.4500000f, 54},
-{-0.6706673f, 0.3262011f, 0.6661818f, 5.8400000f, 60},
-{-0.8493029f, 0.4251216f, -0.3129796f, 4.8600000f, 51},
-{-0.8950173f, 0.4456055f, -0.0194883f, 6.4800000f, 13},
-{-0.7140278f, 0.3493223f, 0.6067440f, 4.8900000f, 47},
-{-0.7827221f, 0.3851965f, 0.4888454f, 6.8200000f, 32},
-{-0.8876908f, 0.4409674f, 0.1324871f, 5.9100000f, 23},
-{-0.7404765f, 0.3637043f, 0.5651670f, 6.5700000f, 61},
-{-0.5582281f, 0.2872547f, -0.7783740f, 6.2500000f, 51},
-{-0.4768342f, 0.2306219f, 0.8481996f, 6.2200000f, 40},
-{-0.6800478f, 0.3346864f, 0.6523189f, 6.3400000f, 64},
-{-0.3824412f, 0.2012582f, -0.9017948f, 6.0500000f, 32},
-{-0.8791262f, 0.4395621f, 0.1841801f, 2.7200000f, 53},
-{-0.4893123f, 0.2377556f, 0.8390743f, 6.2700000f, 52},
-{-0.4305079f, 0.2249724f, -0.8740998f, 6.2100000f, 15},
-{-0.6327690f, 0.3119613f, 0.7087196f, 2.8700000f, 19},
-{-0.7237138f, 0.3594908f, 0.5890710f, 6.4300000f, 19},
-{-0.7332012f, 0.3649883f, 0.5737591f, 6.0900000f, 50},
-{-0.4586220f, 0.2406458f, -0.8554270f, 5.4200000f, 20},
-{-0.8704682f, 0.4437650f, -0.2129735f, 6.1100000f, 26},
-{-0.8090363f, 0.4062764f, 0.4247350f, 6.6200000f, 27},
-{-0.7436114f, 0.3724811f, 0.5552477f, 4.9900000f, 37},
-{-0.7505452f, 0.3765963f, 0.5430075f, 6.1800000f, 53},
-{-0.8459396f, 0.4281878f, 0.3178701f, 3.8200000f, 62},
-{-0.6109006f, 0.3187944f, -0.7246865f, 5.9400000f, 61},
-{-0.7902838f, 0.4078668f, -0.4572704f, 6.0500000f, 32},
-{-0.8053248f, 0.4094929f, 0.4286811f, 5.9500000f, 50},
-{-0.8776838f, 0.4522145f, -0.1586607f, 6.0400000f, 55},
-{-0.8745429f, 0.4480399f, 0.1855666f, 6.4400000f, 38},
-{-0.6990347f, 0.3541165f, 0.6212504f, 5.7700000f, 18},
-{-0.8707623f, 0.4470388f, 0.2047665f, 5.7200000f, 42},
-{-0.3169505f, 0.1551153f, 0.9356718f, 5.9200000f, 22},
-{-0.8399021f, 0.4324775f, 0.3279142f, 5.0000000f, 23},
-{-0.5979977f, 0.3028787f, 0.7420668f, 6.1200000f, 62},
-{-0.5302415f, 0.2837969f, -0.7989388f, 5.7400000f, 48},
-{-0.5302809f, 0.2838874f, -0.7988805f, 6.5000000f, 22},
-{-0.7258951f, 0.3727859f, 0.5780198f, 6.5300000f, 34},
-{-0.7421370f, 0.3815840f, 0.5510230f, 6.4400000f, 10},
-{-0.6948316f, 0.3688395f, -0.6173868f, 5.3300000f, 20},
-{-0.8739541f, 0.4587389f, -0.1605081f, 5.3900000f, 30},
-{-0.8780045f, 0.4584814f, 0.1374878f, 6.5100000f, 12},
-{-0.6930031f, 0.3586754f, 0.6253789f, 6.1100000f, 45},
-{-0.7801184f, 0.4057146f, 0.4762467f, 6.3800000f, 15},
-{-0.8748423f, 0.4592213f, 0.1541643f, 0.7700000f, 27},
-{-0.4276637f, 0.2338319f, -0.8731703f, 6.2400000f, 24},
-{-0.8842923f, 0.4661605f, -0.0268603f, 6.1300000f, 55},
-{-0.8703519f, 0.4580436f, 0.1807862f, 5.1100000f, 38},
-{-0.8346811f, 0.4447426f, -0.3248254f, 5.9200000f, 45},
-{-0.8719246f, 0.4601757f, 0.1672898f, 6.2500000f, 21},
-{-0.3283558f, 0.1650470f, 0.9300226f, 6.3400000f, 30},
-{-0.7436749f, 0.3894658f, 0.5433820f, 4.2300000f, 36},
-{-0.8168421f, 0.4300724f, 0.3844564f, 4.9500000f, 12},
-{-0.6911395f, 0.3619592f, 0.6255491f, 5.1200000f, 62},
-{-0.6725312f, 0.3524195f, 0.6507705f, 5.6900000f, 11},
-{-0.6993749f, 0.3671152f, 0.6132709f, 6.0600000f, 64},
-{-0.8647069f, 0.4600552f, 0.2015718f, 6.1300000f, 40},
-{-0.8818403f, 0.4712215f, 0.0175494f, 3.9000000f, 36},
-{-0.8567058f, 0.4608386f, -0.2316960f, 6.4800000f, 20},
-{-0.8680525f, 0.4628156f, 0.1796846f, 6.5400000f, 17},
-{-0.8002234f, 0.4256058f, 0.4224952f, 5.5700000f, 21},
-{-0.8357694f, 0.4460875f, 0.3201491f, 6.2300000f, 7},
-{-0.8791302f, 0.4739155f, -0.0503412f, 5.6500000f, 25},
-{-0.5332000f, 0.2794270f, 0.7985100f, 5.0300000f, 53},
-{-0.5988404f, 0.3161447f, 0.7358279f, 6.2000000f, 32},
-{-0.8139163f, 0.4432780f, -0.3755594f, 6.1800000f, 52},
-{-0.3136951f, 0.1787260f, -0.9325515f, 5.7500000f, 20},
-{-0.8775171f, 0.4733672f, 0.0767287f, 6.5300000f, 19},
-{-0.6698945f, 0.3685124f, -0.6445463f, 4.1300000f, 50},
-{-0.3007098f, 0.1535059f, 0.9412808f, 3.8300000f, 47},
-{-0.7099360f, 0.3785598f, 0.5938715f, 6.1000000f, 54},
-{-0.8711642f, 0.4736764f, -0.1292427f, 5.7900000f, 55},
-{-0.7355215f, 0.4038759f, -0.5439598f, 6.4600000f, 52},
-{-0.4869989f, 0.2726255f, -0.8297634f, 6.5300000f, 54},
-{-0.4738156f, 0.2656302f, -0.8396067f, 5.2600000f, 19},
-{-0.3360105f, 0.1918190f, -0.9221185f, 6.3900000f, 20},
-{-0.6018797f, 0.3199746f, 0.7316810f, 5.6200000f, 9},
-{-0.2802524f, 0.1627699f, -0.9460257f, 3.9600000f, 20},
-{-0.5914214f, 0.3148617f, 0.7423495f, 5.9100000f, 12},
-{-0.8033623f, 0.4337499f, 0.4080074f, 4.5800000f, 19},
-{-0.8694467f, 0.4751539f, -0.1352448f, 5.7100000f, 17},
-{-0.8694502f, 0.4751968f, -0.1350719f, 6.4900000f, 18},
-{-0.8687395f, 0.4729066f, 0.1471429f, 4.7100000f, 49},
-{-0.8772479f, 0.4800139f, 0.0047754f, 5.6100000f, 20},
-{-0.7884008f, 0.4362985f, -0.4336678f, 4.7000000f, 45},
-{-0.8706104f, 0.4760118f, 0.1242990f, 6.1500000f, 22},
-{-0.8723430f, 0.4802027f, -0.0917768f, 6.5100000f, 32},
-{-0.5915993f, 0.3179443f, 0.7408925f, 6.2900000f, 10},
-{-0.7998486f, 0.4366275f, 0.4118236f, 5.5200000f, 20},
-{-0.8705972f, 0.4791757f, 0.1115846f, 3.7100000f, 48},
-{-0.3649522f, 0.2115199f, -0.9066803f, 5.7600000f, 50},
-{-0.7786729f, 0.4358398f, -0.4513448f, 4.5200000f, 52},
-{-0.6869223f, 0.3874097f, -0.6148589f, 6.5500000f, 34},
-{-0.7005475f, 0.3835584f, 0.6017608f, 5.7600000f, 41},
-{-0.7575726f, 0.4160846f, 0.5029487f, 6.5700000f, 16},
-{-0.4726741f, 0.2547483f, 0.8436128f, 5.1400000f, 15},
-{-0.8379723f, 0.4645992f, 0.2862691f, 5.3600000f, 45},
-{-0.8567977f, 0.4760962f, 0.1980660f, 5.2800000f, 21},
-{-0.4436996f, 0.2398825f, 0.8634738f, 6.0600000f, 23},
-{-0.3634973f, 0.2138458f, -0.9067192f, 5.3100000f, 52},
-{-0.6848401f, 0.3790729f, 0.6223325f, 4.9400000f, 15},
-{-0.8427040f, 0.4765363f, -0.2505255f, 5.0200000f, 23},
-{-0.7151846f, 0.3976853f, 0.5747672f, 3.8900000f, 50},
-{-0.8145492f, 0.4561850f, 0.3583363f, 6.4800000f, 22},
-{-0.7560387f, 0.4318491f, -0.4918454f, 6.2800000f, 51},
-{-0.7817173f, 0.4465771f, -0.4353009f, 4.8300000f, 46},
-{-0.5336510f, 0.2946823f, 0.7927036f, 4.9200000f, 24},
-{-0.7040645f, 0.3932330f, 0.5913214f, 6.0200000f, 15},
-{-0.5715496f, 0.3313879f, -0.7506751f, 6.1700000f, 50},
-{-0.8337561f, 0.4705486f, 0.2888508f, 5.5300000f, 19},
-{-0.7122661f, 0.4101366f, -0.5696183f, 4.3700000f, 13},
-{-0.7240762f, 0.4174350f, -0.5490552f, 5.3000000f, 24},
-{-0.4489042f, 0.2637524f, -0.8537680f, 5.1300000f, 66},
-{-0.4609348f, 0.2538421f, 0.8503548f, 6.0900000f, 49},
-{-0.6331110f, 0.3671554f, -0.6814450f, 6.1400000f, 60},
-{-0.6643777f, 0.3729521f, 0.6476952f, 5.4500000f, 15},
-{-0.6975078f, 0.4037824f, -0.5919819f, 5.9500000f, 48},
-{-0.6123315f, 0.3564033f, -0.7057101f, 5.8100000f, 28},
-{-0.7314249f, 0.4237293f, -0.5342950f, 5.6600000f, 37},
-{-0.5505661f, 0.3075487f, 0.7760739f, 6.4300000f, 21},
-{-0.4525583f, 0.2506593f, 0.8557809f, 4.9600000f, 55},
-{-0.4799844f, 0.2669273f, 0.8356822f, 6.1200000f, 24},
-{-0.8189358f, 0.4669075f, 0.3336789f, 3.4700000f, 60},
-{-0.8671277f, 0.4975052f, 0.0240444f, 6.1700000f, 48},
-{-0.8579627f, 0.4942974f, -0.1398932f, 5.8800000f, 38},
-{-0.6442431f, 0.3642602f, 0.6725068f, 6.4300000f, 23},
-{-0.6688086f, 0.3917603f, -0.6318377f, 6.2900000f, 22},
-{-0.7449992f, 0.4242223f, 0.5147929f, 5.4900000f, 19},
-{-0.7982309f, 0.4570355f, 0.3923594f, 5.6700000f, 30},
-{-0.6838898f, 0.3891879f, 0.6171122f, 6.3200000f, 15},
-{-0.8042144f, 0.4708791f, -0.3626459f, 6.0100000f, 47},
-{-0.3379512f, 0.2061784f, -0.9183025f, 6.0700000f, 43},
-{-0.8257529f, 0.4770129f, 0.3009832f, 5.3700000f, 64},
-{-0.6050629f, 0.3470197f, 0.7165725f, 5.9200000f, 25},
-{-0.6913886f, 0.3988517f, 0.6024111f, 5.1900000f, 13},
-{-0.8542571f, 0.4980964f, 0.1488115f, 5.9100000f, 55},
-{-0.8416989f, 0.4956831f, -0.2141055f, 5.7100000f, 23},
-{-0.7711933f, 0.4572566f, -0.4429191f, 4.5800000f, 64},
-{-0.5335076f, 0.3057179f, 0.7886103f, 6.1500000f, 15},
-{-0.6937434f, 0.4150256f, -0.5886204f, 4.7700000f, 55},
-{-0.7642605f, 0.4461580f, 0.4656703f, 4.6400000f, 24},
-{-0.3874274f, 0.2202646f, 0.8952003f, 5.9600000f, 23},
-{-0.6885439f, 0.4025743f, 0.6031925f, 6.2000000f, 50},
-{-0.7826779f, 0.4598603f, 0.4194565f, 5.8800000f, 14},
-{-0.7812476f, 0.4602971f, 0.4216382f, 5.2200000f, 32},
-{-0.7985933f, 0.4786031f, -0.3649490f, 6.4500000f, 36},
-{-0.7267421f, 0.4380818f, -0.5290844f, 4.9900000f, 51},
-{-0.5535441f, 0.3239837f, 0.7672180f, 5.0500000f, 51},
-{-0.8515613f, 0.5117708f, -0.1137282f, 6.7200000f, 34},
-{-0.8144139f, 0.4858414f, 0.3173139f, 5.9600000f, 53},
-{-0.3493958f, 0.2190517f, -0.9110098f, 6.4500000f, 55},
-{-0.8249105f, 0.4932100f, 0.2761639f, 5.6700000f, 19},
-{-0.3467007f, 0.2181742f, -0.9122492f, 3.5600000f, 46},
-{-0.2919297f, 0.1663422f, 0.9418638f, 6.3300000f, 48},
-{-0.8562315f, 0.5164439f, 0.0123818f, 5.6800000f, 54},
-{-0.7159718f, 0.4367524f, -0.5446390f, 6.5300000f, 18},
-{-0.8499526f, 0.5114016f, 0.1266847f, 5.5200000f, 50},
-{-0.7438332f, 0.4452779f, 0.4984373f, 5.7100000f, 46},
-{-0.8406650f, 0.5105798f, -0.1805287f, 6.3400000f, 31},
-{-0.8191843f, 0.4927184f, 0.2935398f, 5.8000000f, 41},
-{-0.5332103f, 0.3312060f, -0.7784532f, 4.9400000f, 61},
-{-0.4871689f, 0.3031917f, -0.8189879f, 6.2600000f, 38},
-{-0.8372593f, 0.5102633f, -0.1965404f, 6.5500000f, 21},
-{-0.3670702f, 0.2150898f, 0.9049839f, 5.2700000f, 61},
-{-0.7857678f, 0.4767062f, 0.3941068f, 6.4500000f, 25},
-{-0.7240343f, 0.4376348f, 0.5331511f, 5.6400000f, 11},
-{-0.8030627f, 0.4880698f, 0.3418744f, 5.1000000f, 52},
-{-0.8228531f, 0.5014917f, 0.2672430f, 6.3400000f, 62},
-{-0.8501809f, 0.5220296f, -0.0683926f, 6.4700000f, 50},
-{-0.3687937f, 0.2179700f, 0.9035930f, 6.5700000f, 47},
-{-0.6689726f, 0.4065951f, 0.6222186f, 6.1900000f, 45},
-{-0.5702785f, 0.3442855f, 0.7458217f, 6.1600000f, 22},
-{-0.3238488f, 0.1923224f, 0.9263553f, 4.5100000f, 53},
-{-0.2026417f, 0.1165359f, 0.9722940f, 6.2000000f, 63},
-{-0.5280658f, 0.3207903f, 0.7862824f, 6.1400000f, 61},
-{-0.7793766f, 0.4817757f, 0.4005800f, 5.0700000f, 13},
-{-0.6893696f, 0.4239510f, 0.5873969f, 5.3600000f, 50},
-{-0.8479193f, 0.5299931f, 0.0118389f, 5.9900000f, 51},
-{-0.4643364f, 0.2990150f, -0.8336556f, 6.3700000f, 17},
-{-0.4733790f, 0.2882671f, 0.8323547f, 6.2100000f, 34},
-{-0.8370299f, 0.5222137f, 0.1633212f, 6.4300000f, 33},
-{-0.8341349f, 0.5238691f, -0.1725690f, 6.1800000f, 19},
-{-0.3764912f, 0.2278840f, 0.8979550f, 6.2600000f, 22},
-{-0.8121917f, 0.5080477f, 0.2867614f, 6.4200000f, 63},
-{-0.5108440f, 0.3137512f, 0.8003740f, 5.8500000f, 35},
-{-0.1026486f, 0.0752008f, -0.9918710f, 6.1700000f, 20},
-{-0.7001337f, 0.4361764f, 0.5652990f, 6.1100000f, 15},
-{-0.8317784f, 0.5229798f, 0.1861096f, 6.3100000f, 13},
-{-0.4008332f, 0.2445416f, 0.8829112f, 5.3900000f, 53},
-{-0.5437044f, 0.3370836f, 0.7686093f, 6.5400000f, 23},
-{-0.6809067f, 0.4388074f, -0.5863566f, 5.3200000f, 53},
-{-0.3199735f, 0.1939515f, 0.9273617f, 6.2800000f, 63},
-{-0.7879439f, 0.5017018f, 0.3569871f, 6.4800000f, 35},
-{-0.6301277f, 0.4107686f, -0.6589448f, 6.2200000f, 51},
-{-0.3834608f, 0.2548873f, -0.8876882f, 6.0900000f, 30},
-{-0.6760532f, 0.4283195f, 0.5995786f, 4.9300000f, 12},
-{-0.8340902f, 0.5373713f, -0.1246021f, 6.4900000f, 11},
-{-0.8402320f, 0.5420376f, 0.0143354f, 3.2300000f, 19},
-{-0.7509371f, 0.4809756f, 0.4524996f, 5.5200000f, 23},
-{-0.8216003f, 0.5333751f, -0.2012061f, 6.3400000f, 50},
-{-0.7843382f, 0.5047856f, 0.3605621f, 6.2200000f, 50},
-{-0.5180111f, 0.3438943f, -0.7831993f, 5.6500000f, 54},
-{-0.8211681f, 0.5354744f, -0.1973579f, 5.8500000f, 37},
-{-0.7797090f, 0.5032188f, 0.3725919f, 6.2600000f, 11},
-{-0.8371777f, 0.5467214f, 0.0151402f, 6.2700000f, 19},
-{-0.7489507f, 0.4854456f, 0.4510160f, 5.4900000f, 53},
-{-0.7506681f, 0.4875439f, 0.4458680f, 5.9200000f, 17},
-{-0.8356066f, 0.5490562f, -0.0172876f, 5.4700000f, 55},
-{-0.5639345f, 0.3664449f, 0.7400649f, 6.9200000f, 17},
-{-0.7404335f, 0.4960982f, -0.4534807f, 5.7300000f, 50},
-{-0.7610811f, 0.5022059f, 0.4105420f, 6.5600000f, 21},
-{-0.8040795f, 0.5336057f, 0.2621471f, 4.9500000f, 22},
-{-0.7183367f, 0.4838101f, -0.4999202f, 6.3000000f, 54},
-{-0.5217154f, 0.3405238f, 0.7822126f, 6.0100000f, 52},
-{-0.3931805f, 0.2543153f, 0.8835909f, 5.7500000f, 35},
-{-0.6737642f, 0.4561512f, -0.5813501f, 6.3900000f, 64},
-{-0.6798591f, 0.4604795f, -0.5707454f, 6.5300000f, 32},
-{-0.5718171f, 0.3759709f, 0.7291578f, 4.8300000f, 25},
-{-0.7309657f, 0.4849249f, 0.4801427f, 5.1800000f, 27},
-{-0.3759130f, 0.2609016f, -0.8891680f, 6.2700000f, 50},
-{-0.6065899f, 0.4004029f, 0.6868233f, 6.1400000f, 54},
-{-0.6692512f, 0.4433177f, 0.5962988f, 6.4500000f, 20},
-{-0.5720628f, 0.3773193f, 0.7282680f, 3.7900000f, 52},
-{-0.6666326f, 0.4434689f, 0.5991129f, 4.9700000f, 22},
-{-0.6180439f, 0.4104719f, 0.6704734f, 6.7100000f, 19},
-{-0.8110116f, 0.5489929f, -0.2021558f, 6.3200000f, 19},
-{-0.7493170f, 0.5019318f, 0.4319590f, 4.7800000f, 13},
-{-0.4602263f, 0.3028826f, 0.8345381f, 4.3000000f, 23},
-{-0.7613370f, 0.5111313f, 0.3988869f, 5.1500000f, 43},
-{-0.4094779f, 0.2696464f, 0.8715611f, 5.7900000f, 55},
-{-0.6907100f, 0.4632416f, 0.5552719f, 5.6600000f, 50},
-{-0.7337548f, 0.4938455f, 0.4666053f, 4.5200000f, 53},
-{-0.5678883f, 0.3937135f, -0.7228365f, 6.3100000f, 61},
-{-0.7700814f, 0.5210332f, 0.3681020f, 6.1300000f, 51},
-{-0.8084562f, 0.5538120f, -0.1992254f, 4.2400000f, 43},
-{-0.7734322f, 0.5316812f, -0.3451344f, 5.8700000f, 50},
-{-0.5659070f, 0.3936758f, -0.7244092f, 6.1300000f, 35},
-{-0.1800568f, 0.1134848f, 0.9770879f, 4.3900000f, 19},
-{-0.5586639f, 0.3749527f, 0.7398007f, 3.9800000f, 53},
-{-0.6451054f, 0.4353612f, 0.6279329f, 6.2700000f, 21},
-{-0.7516171f, 0.5107265f, 0.4174089f, 5.3200000f, 48},
-{-0.8075764f, 0.5553173f, -0.1986030f, 3.5700000f, 48},
-{-0.5307419f, 0.3570585f, 0.7686496f, 6.3100000f, 22},
-{-0.5802426f, 0.3914154f, 0.7142216f, 5.9100000f, 35},
-{-0.6606909f, 0.4476157f, 0.6026007f, 6.4800000f, 16},
-{-0.4696664f, 0.3305108f, -0.8186428f, 6.2700000f, 60},
-{-0.6299534f, 0.4286050f, 0.6476546f, 5.2400000f, 53},
-{-0.7207859f, 0.4931860f, 0.4870681f, 6.2200000f, 49},
-{-0.7765078f, 0.5406590f, -0.3236101f, 5.2800000f, 53},
-{-0.6063818f, 0.4147515f, 0.6784411f, 6.2900000f, 54},
-{-0.6495425f, 0.4455285f, 0.6161160f, 4.8100000f, 12},
-{-0.7167807f, 0.5040813f, -0.4817962f, 6.3000000f, 24},
-{-0.6746948f, 0.4762315f, -0.5639065f, 6.4600000f, 53},
-{-0.5452801f, 0.3878089f, -0.7431513f, 6.2700000f, 40},
-{-0.6242775f, 0.4295221f, 0.6525247f, 5.8400000f, 9},
-{-0.8197420f, 0.5725072f, -0.0160806f, 6.0600000f, 50},
-{-0.6572342f, 0.4537201f, 0.6018150f, 5.5800000f, 22},
-{-0.6739044f, 0.4659885f, 0.5733302f, 5.1700000f, 35},
-{-0.7987025f, 0.5565956f, 0.2286388f, 6.2100000f, 61},
-{-0.8141040f, 0.5723476f, -0.0982487f, 6.6300000f, 55},
-{-0.8018062f, 0.5648963f, -0.1949334f, 4.7600000f, 19},
-{-0.7963500f, 0.5576276f, 0.2342608f, 5.9500000f, 25},
-{-0.7955633f, 0.5610869f, -0.2286057f, 6.1000000f, 20},
-{-0.7949758f, 0.5618940f, -0.2286671f, 3.0800000f, 38},
-{-0.5677228f, 0.3932076f, 0.7232417f, 6.4500000f, 12},
-{-0.7919835f, 0.5563142f, 0.2515486f, 6.1300000f, 48},
-{-0.6046133f, 0.4330934f, -0.6684854f, 5.5900000f, 20},
-{-0.7791182f, 0.5473534f, 0.3055799f, 5.8000000f, 55},
-{-0.4674269f, 0.3224964f, 0.8231088f, 5.7600000f, 22},
-{-0.6534510f, 0.4567232f, 0.6036603f, 6.5700000f, 20},
-{-0.3244092f, 0.2219648f, 0.9195055f, 5.9300000f, 43},
-{-0.6324657f, 0.4439000f, 0.6347755f, 6.2300000f, 21},
-{-0.1492246f, 0.1179474f, -0.9817436f, 5.7700000f, 46},
-{-0.5604685f, 0.3922074f, 0.7294165f, 6.5000000f, 18},
-{-0.6054122f, 0.4394005f, -0.6636289f, 5.6400000f, 25},
-{-0.8029469f, 0.5781100f, -0.1451381f, 6.3000000f, 45},
-{-0.7410001f, 0.5288267f, 0.4138372f, 5.5400000f, 18},
-{-0.4585424f, 0.3382159f, -0.8217961f, 1.9400000f, 12},
-{-0.4853913f, 0.3414763f, 0.8048535f, 6.1800000f, 54},
-{-0.3817661f, 0.2663526f, 0.8850486f, 5.7200000f, 19},
-{-0.7858574f, 0.5650685f, 0.2512482f, 6.1700000f, 38},
-{-0.8075948f, 0.5823397f, 0.0931188f, 5.3100000f, 48},
-{-0.6130989f, 0.4375211f, 0.6577880f, 6.3900000f, 45},
-{-0.6208564f, 0.4437865f, 0.6462128f, 2.2000000f, 38},
-{-0.6945338f, 0.4982618f, 0.5189971f, 6.0900000f, 52},
-{-0.5674648f, 0.4051050f, 0.7168498f, 5.5800000f, 50},
-{-0.6233178f, 0.4603826f, -0.6320781f, 6.0900000f, 53},
-{-0.6127308f, 0.4401093f, 0.6564029f, 5.9300000f, 57},
-{-0.7153586f, 0.5266695f, -0.4592181f, 5.8500000f, 48},
-{-0.5938485f, 0.4272147f, 0.6817856f, 6.2000000f, 50},
-{-0.8072706f, 0.5898867f, 0.0186497f, 6.1500000f, 19},
-{-0.2950650f, 0.2067986f, 0.9328296f, 5.5500000f, 64},
-{-0.3580347f, 0.2534793f, 0.8986431f, 5.6900000f, 55},
-{-0.6849600f, 0.4970212f, 0.5327286f, 4.4300000f, 52},
-{-0.6425680f, 0.4657401f, 0.6084344f, 5.9000000f, 12},
-{-0.6435305f, 0.4800369f, -0.5961821f, 6.2500000f, 52},
-{-0.8044368f, 0.5936691f, -0.0209376f, 6.1100000f, 51},
-{-0.7921876f, 0.5847628f, 0.1746173f, 6.3300000f, 55},
-{-0.7491704f, 0.5527146f, 0.3650348f, 5.6600000f, 46},
-{-0.1244108f, 0.1028393f, -0.9868870f, 5.9100000f, 55},
-{-0.7559752f, 0.5594944f, 0.3398051f, 6.4100000f, 50},
-{-0.7621509f, 0.5707844f, -0.3055014f, 5.2500000f, 18},
-{-0.4798078f, 0.3503310f, 0.8043958f, 6.5100000f, 19},
-{-0.7664669f, 0.5691594f, 0.2976341f, 6.2200000f, 50},
-{-0.6572420f, 0.4987759f, -0.5650270f, 6.1000000f, 18},
-{-0.4079772f, 0.2993740f, 0.8625137f, 6.4400000f, 22},
-{-0.7721804f, 0.5857274f, -0.2462943f, 6.4100000f, 50},
-{-0.7896667f, 0.5957321f, 0.1467305f, 6.2500000f, 49},
-{-0.7966966f, 0.6026188f, -0.0460991f, 6.1300000f, 19},
-{-0.7648034f, 0.5808330f, -0.2787630f, 4.7800000f, 32},
-{-0.6614099f, 0.4944753f, 0.5639425f, 6.3900000f, 31},
-{-0.7968516f, 0.6019985f, 0.0512369f, 6.2100000f, 48},
-{-0.7387785f, 0.5644388f, -0.3682598f, 6.1600000f, 61},
-{-0.6264164f, 0.4702057f, 0.6216985f, 5.6200000f, 23},
-{-0.4414925f, 0.3278563f, 0.8352213f, 6.3600000f, 19},
-{-0.5215471f, 0.3895936f, 0.7590820f, 5.6900000f, 30},
-{-0.7573112f, 0.5804494f, -0.2992628f, 6.7400000f, 27},
-{-0.7572383f, 0.5805159f, -0.2993184f, 5.9400000f, 23},
-{-0.7941318f, 0.6074342f, -0.0194495f, 4.9100000f, 52},
-{-0.6924287f, 0.5358779f, -0.4830914f, 6.3900000f, 25},
-{-0.7467061f, 0.5696189f, 0.3434594f, 6.5500000f, 23},
-{-0.6858821f, 0.5234250f, 0.5055612f, 4.0100000f, 35},
-{-0.6395227f, 0.4878034f, 0.5941874f, 5.8800000f, 21},
-{-0.7782680f, 0.5988062f, 0.1890240f, 6.0800000f, 21},
-{-0.7637635f, 0.5917510f, -0.2578683f, 6.1200000f, 45},
-{-0.2863665f, 0.2316089f, -0.9297051f, 6.1100000f, 52},
-{-0.7401834f, 0.5729476f, 0.3519369f, 6.1800000f, 21},
-{-0.7749003f, 0.6011645f, 0.1952710f, 7.1100000f, 18},
-{-0.5518233f, 0.4234225f, 0.7184737f, 6.4100000f, 52},
-{-0.7229019f, 0.5692424f, -0.3916324f, 6.3600000f, 20},
-{-0.4436678f, 0.3387548f, 0.8297012f, 5.9100000f, 19},
-{-0.5208898f, 0.3999035f, 0.7541559f, 4.9500000f, 12},
-{-0.7790070f, 0.6107921f, -0.1417075f, 5.6500000f, 42},
-{-0.5679963f, 0.4514743f, -0.6881506f, 5.1100000f, 50},
-{-0.6320338f, 0.4893140f, 0.6009202f, 6.1900000f, 35},
-{-0.3959715f, 0.3194517f, -0.8609049f, 4.7600000f, 31},
-{-0.7095068f, 0.5541779f, 0.4353009f, 6.3400000f, 20},
-{-0.3607508f, 0.2757691f, 0.8909603f, 4.2200000f, 27},
-{-0.5158938f, 0.4005770f, 0.7572263f, 5.4400000f, 62},
-{-0.7695189f, 0.6078021f, 0.1960032f, 4.0300000f, 16},
-{-0.6154701f, 0.4936359f, -0.6144267f, 6.4400000f, 28},
-{-0.4828470f, 0.3750466f, 0.7913273f, 6.1800000f, 50},
-{-0.7641874f, 0.6089244f, -0.2126704f, 6.1300000f, 36},
-{-0.6790987f, 0.5440120f, -0.4928244f, 6.4000000f, 18},
-{-0.7708617f, 0.6125855f, 0.1746746f, 6.5600000f, 22},
-{-0.7625985f, 0.6063267f, 0.2254140f, 5.3800000f, 23},
-{-0.3808802f, 0.3128261f, -0.8700977f, 4.8800000f, 35},
-{-0.4320468f, 0.3368694f, 0.8365731f, 6.1400000f, 55},
-{-0.5728022f, 0.4510410f, 0.6844411f, 6.6000000f, 14},
-{-0.7302768f, 0.5817560f, 0.3581281f, 6.4800000f, 13},
-{-0.1862495f, 0.1591400f, -0.9695285f, 6.0000000f, 34},
-{-0.2015014f, 0.1716858f, -0.9643242f, 6.5500000f, 45},
-{-0.7501997f, 0.6049926f, -0.2668039f, 6.1900000f, 27},
-{-0.6393181f, 0.5080965f, 0.5771571f, 4.6100000f, 52},
-{-0.5840599f, 0.4637783f, 0.6661710f, 6.4900000f, 50},
-{-0.2381384f, 0.1827493f, 0.9538830f, 6.2700000f, 54},
-{-0.5299336f, 0.4351633f, -0.7278758f, 3.1100000f, 50},
-{-0.5369461f, 0.4267812f, 0.7276996f, 5.7800000f, 19},
-{-0.7536310f, 0.6065216f, 0.2533218f, 4.6800000f, 23},
-{-0.3705011f, 0.3104927f, -0.8753989f, 6.2200000f, 51},
-{-0.7748985f, 0.6315790f, -0.0253046f, 4.8900000f, 55},
-{-0.6988495f, 0.5666159f, 0.4365270f, 6.4100000f, 25},
-{-0.3892982f, 0.3267854f, -0.8611958f, 5.1200000f, 38},
-{-0.4819773f, 0.3862747f, 0.7864412f, 6.1100000f, 29},
-{-0.7002792f, 0.5765903f, -0.4208951f, 6.3600000f, 30},
-{-0.7735488f, 0.6337344f, 0.0016920f, 6.2200000f, 18},
-{-0.2048972f, 0.1593741f, 0.9657210f, 5.2000000f, 20},
-{-0.6930663f, 0.5666540f, 0.4456033f, 5.5900000f, 19},
-{-0.3185393f, 0.2719421f, -0.9080640f, 5.1500000f, 19},
-{-0.7479314f, 0.6140846f, 0.2519896f, 3.6300000f, 35},
-{-0.7569545f, 0.6229780f, 0.1972771f, 5.4300000f, 22},
-{-0.7705908f, 0.6371390f, -0.0156152f, 4.3200000f, 47},
-{-0.6585174f, 0.5405755f, 0.5235770f, 6.3200000f, 18},
-{-0.7329675f, 0.6037285f, 0.3134815f, 6.2500000f, 66},
-{-0.6588428f, 0.5409068f, 0.5228251f, 6.4900000f, 30},
-{-0.6066326f, 0.4973782f, 0.6201708f, 6.2000000f, 50},
-{-0.7482561f, 0.6238292f, -0.2257210f, 5.2200000f, 16},
-{-0.7679329f, 0.6399311f, -0.0276987f, 6.2200000f, 17},
-{-0.7180468f, 0.5946624f, 0.3616427f, 4.8200000f, 20},
-{-0.7489023f, 0.6213736f, 0.2303045f, 5.7200000f, 53},
-{-0.6448053f, 0.5426400f, -0.5383010f, 5.4700000f, 51},
-{-0.7029280f, 0.5821931f, 0.4085871f, 5.0400000f, 15},
-{-0.7051638f, 0.5843216f, 0.4016370f, 5.9100000f, 50},
-{-0.7566027f, 0.6299862f, 0.1751281f, 5.0500000f, 42},
-{-0.7676550f, 0.6408071f, 0.0084890f, 5.1600000f, 51},
-{-0.7086195f, 0.5956305f, -0.3782627f, 6.3700000f, 48},
-{-0.7394305f, 0.6154328f, 0.2729193f, 5.9700000f, 13},
-{-0.7289886f, 0.6119651f, -0.3067153f, 5.1000000f, 62},
-{-0.1190149f, 0.0898825f, 0.9888158f, 5.4600000f, 49},
-{-0.6907298f, 0.5826794f, -0.4282255f, 6.5100000f, 37},
-{-0.7133151f, 0.5941887f, 0.3716469f, 6.0800000f, 20},
-{-0.6636014f, 0.5518706f, 0.5050466f, 5.6800000f, 52},
-{-0.7353617f, 0.6200094f, -0.2735535f, 5.8000000f, 47},
-{-0.7376674f, 0.6169954f, 0.2741597f, 3.7700000f, 19},
-{-0.7517016f, 0.6299891f, 0.1950856f, 6.4200000f, 38},
-{-0.1230803f, 0.0939815f, 0.9879366f, 5.9600000f, 50},
-{-0.6573257f, 0.5584150f, -0.5060589f, 5.7600000f, 60},
-{-0.6849700f, 0.5819338f, -0.4383711f, 6.2800000f, 52},
-{-0.5827612f, 0.4870696f, 0.6505018f, 6.0600000f, 16},
-{-0.5365368f, 0.4477599f, 0.7152897f, 6.5800000f, 15},
-{-0.3082822f, 0.2702571f, -0.9120983f, 3.4200000f, 27},
-{-0.7181517f, 0.6066346f, 0.3409584f, 6.4500000f, 45},
-{-0.5936188f, 0.5109684f, -0.6217137f, 6.2900000f, 51},
-{-0.4298701f, 0.3575297f, 0.8290864f, 6.4800000f, 32},
-{-0.6632412f, 0.5595074f, 0.4970539f, 6.0800000f, 22},
-{-0.7379067f, 0.6261780f, 0.2517832f, 5.9900000f, 54},
-{-0.5559446f, 0.4667065f, 0.6878304f, 5.9500000f, 52},
-{-0.4842511f, 0.4210952f, -0.7669288f, 4.5100000f, 27},
-{-0.6449766f, 0.5462224f, 0.5344589f, 5.5100000f, 48},
-{-0.5924386f, 0.5015658f, 0.6304350f, 6.5100000f, 16},
-{-0.7252077f, 0.6192217f, 0.3010618f, 6.2200000f, 48},
-{-0.5361831f, 0.4556490f, 0.7105573f, 1.2500000f, 22},
-{-0.3767446f, 0.3169629f, 0.8704011f, 6.0100000f, 36},
-{-0.5677219f, 0.4846304f, 0.6654511f, 5.6700000f, 18},
-{-0.6185415f, 0.5300137f, 0.5800792f, 6.6600000f, 12},
-{-0.7302342f, 0.6317591f, 0.2600739f, 4.4300000f, 27},
-{-0.4849343f, 0.4149421f, 0.7698453f, 5.3900000f, 12},
-{-0.0883615f, 0.0672231f, 0.9938175f, 6.1900000f, 23},
-{-0.6707952f, 0.5894117f, -0.4501417f, 6.5000000f, 48},
-{-0.6151356f, 0.5319239f, 0.5819495f, 6.4700000f, 37},
-{-0.5829274f, 0.5172515f, -0.6266151f, 5.5000000f, 18},
-{-0.2862220f, 0.2606741f, -0.9220228f, 5.4100000f, 50},
-{-0.6061139f, 0.5377076f, -0.5860856f, 6.4900000f, 33},
-{-0.6800235f, 0.6021366f, -0.4183295f, 4.1400000f, 34},
-{-0.7011392f, 0.6212252f, -0.3499758f, 5.9300000f, 20},
-{-0.3723481f, 0.3198791f, 0.8712257f, 6.1500000f, 22},
-{-0.6802154f, 0.5958769f, 0.4268932f, 4.9100000f, 52},
-{-0.4109845f, 0.3548305f, 0.8397541f, 6.3200000f, 12},
-{-0.7133884f, 0.6282176f, 0.3105151f, 6.3800000f, 65},
-{-0.6446999f, 0.5686877f, 0.5108389f, 4.2200000f, 49},
-{-0.5511084f, 0.4983433f, -0.6692783f, 5.1100000f, 31},
-{-0.4161033f, 0.3628835f, 0.8337707f, 5.7800000f, 63},
-{-0.2999605f, 0.2588809f, 0.9181527f, 5.5800000f, 28},
-{-0.7456229f, 0.6658446f, -0.0264096f, 6.2700000f, 52},
-{-0.7176980f, 0.6385755f, 0.2777245f, 5.1400000f, 37},
-{-0.7176619f, 0.6386181f, 0.2777199f, 4.2700000f, 51},
-{-0.6206218f, 0.5501025f, 0.5587628f, 2.4600000f, 50},
-{-0.7359069f, 0.6607360f, -0.1478813f, 3.7700000f, 21},
-{-0.7411137f, 0.6657615f, -0.0866728f, 4.4200000f, 63},
-{-0.5153136f, 0.4700651f, -0.7165827f, 4.8900000f, 55},
-{-0.7396284f, 0.6648258f, 0.1046731f, 5.5800000f, 20},
-{-0.7425000f, 0.6673581f, 0.0576802f, 6.4000000f, 20},
-{-0.4025377f, 0.3541102f, 0.8441382f, 4.5100000f, 38},
-{-0.6153401f, 0.5500810f, 0.5645949f, 4.9200000f, 53},
-{-0.3544386f, 0.3116286f, 0.8816240f, 3.4300000f, 50},
-{-0.5139684f, 0.4572926f, 0.7257547f, 6.3000000f, 23},
-{-0.3486889f, 0.3241304f, -0.8794063f, 6.2800000f, 22},
-{-0.3486771f, 0.3241431f, -0.8794063f, 6.5900000f, 22},
-{-0.6742839f, 0.6140533f, -0.4102193f, 5.8600000f, 17},
-{-0.4501667f, 0.3995128f, 0.7985859f, 6.3300000f, 50},
-{-0.5988396f, 0.5364047f, 0.5946942f, 4.5300000f, 15},
-{-0.7031779f, 0.6406377f, -0.3084221f, 6.2100000f, 53},
-{-0.6238189f, 0.5714662f, -0.5331757f, 4.9000000f, 47},
-{-0.5214720f, 0.4668507f, 0.7142250f, 6.4000000f, 53},
-{-0.2606465f, 0.2276804f, 0.9382031f, 6.4100000f, 48},
-{-0.4672087f, 0.4337837f, -0.7704205f, 5.0500000f, 51},
-{-0.4992280f, 0.4488040f, 0.7411790f, 5.5700000f, 55},
-{-0.6236504f, 0.5754124f, -0.5291132f, 6.3600000f, 55},
-{-0.5933979f, 0.5485874f, -0.5890083f, 5.5200000f, 53},
-{-0.4535657f, 0.4079625f, 0.7923665f, 6.2700000f, 47},
-{-0.7207383f, 0.6582975f, 0.2172111f, 5.9800000f, 35},
-{-0.7309126f, 0.6686148f, 0.1368250f, 6.3300000f, 21},
-{-0.7338717f, 0.6723811f, 0.0966227f, 6.2100000f, 50},
-{-0.7205754f, 0.6643266f, -0.1985982f, 5.8800000f, 51},
-{-0.5132621f, 0.4659625f, 0.7207225f, 4.8400000f, 13},
-{-0.4571553f, 0.4142021f, 0.7870487f, 6.2900000f, 18},
-{-0.6146440f, 0.5730645f, -0.5420423f, 6.0400000f, 22},
-{-0.6628753f, 0.6171776f, -0.4238965f, 4.1100000f, 60},
-{-0.6992569f, 0.6442208f, 0.3098699f, 6.5200000f, 21},
-{-0.7309179f, 0.6781913f, -0.0762598f, 5.9900000f, 35},
-{-0.5061811f, 0.4634707f, 0.7273071f, 6.3300000f, 14},
-{-0.5296483f, 0.4856805f, 0.6954043f, 5.0400000f, 24},
-{-0.7286758f, 0.6803636f, -0.0783383f, 5.5500000f, 19},
-{-0.3879459f, 0.3707615f, -0.8438210f, 3.6500000f, 51},
-{-0.5708972f, 0.5402010f, -0.6182712f, 5.3500000f, 52},
-{-0.6456269f, 0.5992715f, 0.4733282f, 5.7700000f, 35},
-{-0.6742405f, 0.6343730f, -0.3781146f, 6.3300000f, 50},
-{-0.7239438f, 0.6789571f, -0.1221581f, 4.7300000f, 23},
-{-0.6342181f, 0.5987899f, -0.4890992f, 6.3500000f, 51},
-{-0.4721373f, 0.4503311f, -0.7578181f, 6.2400000f, 15},
-{-0.3236273f, 0.2947105f, 0.8991168f, 6.4500000f, 10},
-{-0.7160698f, 0.6741611f, -0.1809721f, 6.3800000f, 41},
-{-0.6507381f, 0.6075047f, 0.4554974f, 4.5900000f, 47},
-{-0.6143988f, 0.5729612f, 0.5424293f, 6.4400000f, 13},
-{-0.6512426f, 0.6186185f, -0.4395386f, 6.4100000f, 64},
-{-0.7225709f, 0.6855344f, -0.0890730f, 6.4400000f, 31},
-{-0.6326836f, 0.5958114f, 0.4946920f, 6.3400000f, 52},
-{-0.6946972f, 0.6638574f, -0.2769280f, 5.7800000f, 50},
-{-0.5199875f, 0.4902114f, 0.6995040f, 4.7800000f, 15},
-{-0.0986271f, 0.0846731f, 0.9915156f, 5.7500000f, 20},
-{-0.5127442f, 0.4836506f, 0.7093487f, 5.4500000f, 50},
-{-0.5368091f, 0.5069257f, 0.6744348f, 6.6600000f, 21},
-{-0.6055686f, 0.5741528f, 0.5510311f, 5.4700000f, 55},
-{-0.7219133f, 0.6918971f, -0.0109372f, 6.5500000f, 29},
-{-0.6363527f, 0.6058493f, 0.4774953f, 6.5600000f, 12},
-{-0.6386393f, 0.6090187f, 0.4703574f, 5.0100000f, 54},
-{-0.5490590f, 0.5227324f, 0.6521388f, 6.7000000f, 18},
-{-0.7180611f, 0.6914785f, 0.0790294f, 6.0500000f, 46},
-{-0.6999528f, 0.6736482f, 0.2372008f, 5.1700000f, 50},
-{-0.7031559f, 0.6769182f, 0.2176086f, 5.5800000f, 24},
-{-0.6460041f, 0.6281475f, -0.4337159f, 5.7000000f, 37},
-{-0.7177641f, 0.6949851f, -0.0425489f, 6.5700000f, 18},
-{-0.7090959f, 0.6901679f, -0.1443994f, 5.5100000f, 55},
-{-0.1221984f, 0.1096007f, 0.9864356f, 5.3900000f, 51},
-{-0.7157404f, 0.6983196f, 0.0080915f, 6.0500000f, 52},
-{-0.6866789f, 0.6728958f, -0.2751060f, 5.8700000f, 22},
-{-0.2655670f, 0.2689918f, -0.9258065f, 6.3700000f, 22},
-{-0.4870880f, 0.4696777f, 0.7363071f, 5.6700000f, 18},
-{-0.1560386f, 0.1625972f, -0.9742762f, 5.1500000f, 27},
-{-0.4515534f, 0.4368794f, 0.7779691f, 6.6300000f, 15},
-{-0.5080727f, 0.4931239f, 0.7061806f, 5.9600000f, 6},
-{-0.6914134f, 0.6836038f, -0.2337376f, 6.0100000f, 30},
-{-0.4545218f, 0.4405585f, 0.7741564f, 5.8100000f, 30},
-{-0.4692152f, 0.4548269f, 0.7569475f, 5.9000000f, 48},
-{-0.4468359f, 0.4482354f, -0.7742239f, 5.7600000f, 35},
-{-0.5388287f, 0.5256985f, 0.6582589f, 3.9400000f, 21},
-{-0.3924949f, 0.3799668f, 0.8375996f, 6.2300000f, 12},
-{-0.6992274f, 0.6897225f, 0.1880527f, 5.4800000f, 46},
-{-0.5730134f, 0.5729884f, -0.5859521f, 6.1100000f, 35},
-{-0.6590104f, 0.6491545f, 0.3798733f, 5.3100000f, 53},
-{-0.6698855f, 0.6675609f, -0.3249859f, 6.2500000f, 19},
-{-0.7079676f, 0.7022655f, 0.0748675f, 5.2300000f, 36},
-{-0.5082636f, 0.5008880f, 0.7005565f, 5.5500000f, 50},
-{-0.5293765f, 0.5225527f, 0.6683556f, 6.1600000f, 17},
-{-0.6772935f, 0.6763879f, 0.2894356f, 6.6600000f, 34},
-{-0.7008321f, 0.7012298f, 0.1308098f, 5.9900000f, 31},
-{-0.5979417f, 0.6047199f, -0.5260985f, 4.6700000f, 46},
-{-0.4530681f, 0.4471824f, 0.7712050f, 5.6100000f, 15},
-{-0.7042183f, 0.7076888f, -0.0570364f, 6.2100000f, 41},
-{-0.5121506f, 0.5221244f, -0.6819735f, 6.6400000f, 43},
-{-0.1758581f, 0.1679631f, 0.9699806f, 6.0500000f, 45},
-{-0.6659024f, 0.6685906f, 0.3309994f, 5.6500000f, 63},
-{-0.6353135f, 0.6451188f, -0.4244979f, 6.0500000f, 27},
-{-0.5551753f, 0.5671904f, -0.6083383f, 5.9400000f, 50},
-{-0.4778833f, 0.4771610f, 0.7375262f, 4.7400000f, 11},
-{-0.5546519f, 0.5692004f, -0.6069367f, 5.3000000f, 33},
-{-0.3604399f, 0.3586306f, 0.8610849f, 5.5100000f, 54},
-{-0.6252553f, 0.6427958f, -0.4425713f, 6.2500000f, 50},
-{-0.5688322f, 0.5748956f, 0.5881539f, 5.9700000f, 45},
-{-0.1668170f, 0.1801433f, -0.9693918f, 6.5800000f, 51},
-{-0.4872804f, 0.4923313f, 0.7212265f, 5.3700000f, 11},
-{-0.6977204f, 0.7161884f, 0.0161387f, 6.5000000f, 16},
-{-0.4130827f, 0.4324048f, -0.8014916f, 5.1600000f, 52},
-{-0.6973848f, 0.7161981f, 0.0267343f, 6.2500000f, 35},
-{-0.6747667f, 0.6928488f, 0.2542644f, 6.3100000f, 61},
-{-0.6925735f, 0.7176611f, -0.0728320f, 7.3100000f, 23},
-{-0.6925680f, 0.7176659f, -0.0728369f, 5.8900000f, 44},
-{-0.6589050f, 0.6847335f, -0.3114229f, 4.8400000f, 25},
-{-0.2000700f, 0.2171399f, -0.9554173f, 5.6800000f, 38},
-{-0.4965334f, 0.5070506f, 0.7045241f, 6.1900000f, 34},
-{-0.5447051f, 0.5595460f, 0.6246636f, 6.0700000f, 48},
-{-0.4864652f, 0.4985357f, 0.7175052f, 6.4800000f, 13},
-{-0.3848653f, 0.3921605f, 0.8355171f, 5.8300000f, 18},
-{-0.6896480f, 0.7177673f, 0.0958940f, 5.6100000f, 55},
-{-0.6915611f, 0.7204922f, 0.0513241f, 6.4200000f, 50},
-{-0.6917365f, 0.7210632f, 0.0396038f, 6.3300000f, 45},
-{-0.5215173f, 0.5516096f, -0.6509583f, 5.5300000f, 53},
-{-0.5968271f, 0.6290345f, -0.4981094f, 5.6800000f, 50},
-{-0.5195471f, 0.5373886f, 0.6642923f, 6.3300000f, 33},
-{-0.4443742f, 0.4578918f, 0.7699783f, 6.3700000f, 50},
-{-0.3186107f, 0.3433113f, -0.8835296f, 5.7600000f, 50},
-{-0.4755756f, 0.4912776f, 0.7297083f, 6.3200000f, 30},
-{-0.6592506f, 0.6943815f, -0.2884841f, 4.0700000f, 21},
-{-0.5848126f, 0.6184851f, -0.5248528f, 5.1800000f, 52},
-{-0.6863809f, 0.7197956f, 0.1038052f, 5.9400000f, 38},
-{-0.4156679f, 0.4296607f, 0.8016308f, 5.9000000f, 50},
-{-0.4981931f, 0.5201087f, 0.6937511f, 3.7200000f, 54},
-{-0.6206464f, 0.6605073f, -0.4225260f, 4.5000000f, 60},
-{-0.2134819f, 0.2357373f, -0.9480788f, 6.2000000f, 51},
-{-0.6126338f, 0.6477949f, 0.4528151f, 6.1200000f, 50},
-{-0.6545468f, 0.7003414f, -0.2847637f, 6.1700000f, 20},
-{-0.5875201f, 0.6218556f, 0.5177989f, 5.8200000f, 37},
-{-0.5346178f, 0.5678685f, 0.6258668f, 5.2100000f, 55},
-{-0.5346076f, 0.5679156f, 0.6258327f, 6.0300000f, 57},
-{-0.6358502f, 0.6852150f, -0.3552112f, 5.3000000f, 20},
-{-0.6580381f, 0.7029489f, 0.2699050f, 6.3400000f, 52},
-{-0.4624457f, 0.4898854f, 0.7390239f, 4.5500000f, 54},
-{-0.6754400f, 0.7273054f, 0.1216865f, 6.1500000f, 55},
-{-0.6384249f, 0.6939779f, -0.3328790f, 6.2500000f, 31},
-{-0.2287417f, 0.2570538f, -0.9389359f, 5.0200000f, 61},
-{-0.6652794f, 0.7234543f, -0.1844374f, 4.5100000f, 48},
-{-0.5876087f, 0.6337179f, 0.5031079f, 5.5900000f, 19},
-{-0.6747900f, 0.7362213f, 0.0513483f, 6.4500000f, 35},
-{-0.6654227f, 0.7311725f, -0.1503310f, 6.2700000f, 50},
-{-0.6639724f, 0.7267710f, 0.1759108f, 4.6900000f, 30},
-{-0.6635773f, 0.7274744f, 0.1744884f, 6.0700000f, 22},
-{-0.2188016f, 0.2313526f, 0.9479461f, 5.8700000f, 33},
-{-0.5140353f, 0.5720307f, -0.6391780f, 5.8300000f, 35},
-{-0.6227808f, 0.6828293f, 0.3819532f, 6.6800000f, 21},
-{-0.6515486f, 0.7216421f, -0.2339168f, 6.4800000f, 30},
-{-0.4735590f, 0.5166934f, 0.7132810f, 6.6300000f, 14},
-{-0.5204519f, 0.5833817f, -0.6235347f, 5.2600000f, 35},
-{-0.5417160f, 0.5967228f, 0.5920015f, 6.5400000f, 11},
-{-0.4007589f, 0.4383489f, 0.8045139f, 5.7300000f, 19},
-{-0.4536310f, 0.4972975f, 0.7395365f, 6.4600000f, 16},
-{-0.5407559f, 0.6075447f, -0.5817839f, 5.9600000f, 50},
-{-0.3043509f, 0.3306363f, 0.8933365f, 6.5400000f, 17},
-{-0.5956971f, 0.6691149f, -0.4443312f, 5.4200000f, 55},
-{-0.1716463f, 0.2014491f, -0.9643422f, 6.6300000f, 21},
-{-0.1419642f, 0.1489317f, 0.9786039f, 5.9100000f, 18},
-{-0.2482612f, 0.2698245f, 0.9303554f, 7.3300000f, 67},
-{-0.3976959f, 0.4565505f, -0.7958641f, 5.7500000f, 26},
-{-0.5755253f, 0.6444630f, 0.5034263f, 3.2000000f, 48},
-{-0.6386390f, 0.7185583f, 0.2753437f, 6.2700000f, 27},
-{-0.5081937f, 0.5807350f, -0.6359922f, 6.2100000f, 52},
-{-0.6528346f, 0.7397035f, -0.1632351f, 6.7700000f, 19},
-{-0.3350218f, 0.3714379f, 0.8659066f, 5.6400000f, 10},
-{-0.5332024f, 0.5997077f, 0.5966957f, 6.0500000f, 30},
-{-0.6606016f, 0.7507350f, 0.0016096f, 6.3800000f, 61},
-{-0.6313391f, 0.7206016f, -0.2866082f, 6.0400000f, 45},
-{-0.6509879f, 0.7389314f, 0.1737675f, 4.4900000f, 35},
-{-0.5327657f, 0.6116900f, -0.5848043f, 6.1200000f, 53},
-{-0.2916162f, 0.3414538f, -0.8935151f, 6.3100000f, 18},
-{-0.5739303f, 0.6496901f, 0.4985046f, 6.1700000f, 46},
-{-0.6201496f, 0.7110892f, -0.3313104f, 5.2400000f, 49},
-{-0.6350102f, 0.7288776f, -0.2559285f, 5.2800000f, 63},
-{-0.0713327f, 0.0947218f, -0.9929448f, 6.4500000f, 53},
-{-0.5197867f, 0.5916174f, 0.6162878f, 3.7200000f, 32},
-{-0.6538883f, 0.7510424f, 0.0914630f, 3.9200000f, 40},
-{-0.6538676f, 0.7565780f, -0.0068455f, 6.4800000f, 50},
-{-0.2866773f, 0.3232048f, 0.9018619f, 6.3900000f, 42},
-{-0.6360110f, 0.7395942f, -0.2202056f, 6.4000000f, 22},
-{-0.5519706f, 0.6459226f, -0.5273637f, 4.7100000f, 21},
-{-0.4400655f, 0.5045158f, 0.7428366f, 6.4600000f, 14},
-{-0.6243870f, 0.7307727f, -0.2758843f, 5.4300000f, 18},
-{-0.4844125f, 0.5596814f, 0.6723848f, 6.4300000f, 52},
-{-0.6217492f, 0.7296600f, -0.2846475f, 7.0500000f, 32},
-{-0.3911276f, 0.4655774f, -0.7938872f, 4.3900000f, 25},
-{-0.6476372f, 0.7595264f, -0.0607098f, 5.8200000f, 15},
-{-0.5747719f, 0.6783876f, -0.4576325f, 6.4000000f, 48},
-{-0.5033823f, 0.5863563f, 0.6346593f, 4.2300000f, 19},
-{-0.4789112f, 0.5577038f, 0.6779459f, 6.1900000f, 17},
-{-0.4543213f, 0.5421993f, -0.7068325f, 6.0000000f, 35},
-{-0.5328881f, 0.6234817f, 0.5721021f, 4.4300000f, 12},
-{-0.3836408f, 0.4453681f, 0.8089913f, 6.1300000f, 21},
-{-0.5801718f, 0.6899736f, -0.4328245f, 6.5600000f, 45},
-{-0.6342468f, 0.7483193f, 0.1942914f, 5.9600000f, 55},
-{-0.3664807f, 0.4262173f, 0.8270615f, 5.9800000f, 53},
-{-0.4962220f, 0.5953729f, -0.6318978f, 4.8200000f, 20},
-{-0.4267388f, 0.5143441f, -0.7438711f, 6.3800000f, 53},
-{-0.3394409f, 0.3950314f, 0.8536569f, 6.4200000f, 12},
-{-0.4665163f, 0.5484133f, 0.6939780f, 5.0000000f, 7},
-{-0.4875305f, 0.5754953f, 0.6565967f, 6.1500000f, 25},
-{-0.2326881f, 0.2880605f, -0.9289119f, 6.4100000f, 35},
-{-0.5065309f, 0.6003010f, 0.6189226f, 5.8300000f, 31},
-{-0.5951480f, 0.7107381f, 0.3750336f, 6.2900000f, 16},
-{-0.2116704f, 0.2644482f, -0.9408841f, 6.0900000f, 52},
-{-0.6380468f, 0.7676561f, -0.0600033f, 5.8700000f, 47},
-{-0.4184970f, 0.4964533f, 0.7605225f, 5.7600000f, 16},
-{-0.2981342f, 0.3508645f, 0.8876993f, 2.4400000f, 27},
-{-0.6339123f, 0.7627381f, 0.1280071f, 5.8200000f, 62},
-{-0.3359527f, 0.3977692f, 0.8537654f, 5.6600000f, 61},
-{-0.5845841f, 0.7033437f, 0.4044367f, 5.5700000f, 51},
-{-0.5400473f, 0.6483862f, 0.5366043f, 5.6800000f, 48},
-{-0.6131242f, 0.7454123f, -0.2616090f, 4.2800000f, 47},
-{-0.1476642f, 0.1694248f, 0.9744180f, 5.9500000f, 55},
-{-0.5375833f, 0.6484812f, 0.5389587f, 6.0400000f, 21},
-{-0.4872912f, 0.5860254f, 0.6473960f, 6.4000000f, 38},
-{-0.2738483f, 0.3245437f, 0.9053610f, 5.1800000f, 13},
-{-0.5893349f, 0.7213634f, -0.3637571f, 5.6000000f, 61},
-{-0.5981825f, 0.7262127f, 0.3388109f, 4.0800000f, 51},
-{-0.1013384f, 0.1138980f, 0.9883106f, 6.1500000f, 23},
-{-0.6256637f, 0.7653538f, -0.1509253f, 5.9900000f, 60},
-{-0.0898489f, 0.1213205f, -0.9885386f, 6.3800000f, 13},
-{-0.4411704f, 0.5464882f, -0.7118422f, 6.3100000f, 27},
-{-0.6285978f, 0.7686349f, 0.1185965f, 5.1600000f, 23},
-{-0.3130991f, 0.3749885f, 0.8725552f, 6.1100000f, 45},
-{-0.4739435f, 0.5874345f, -0.6559712f, 5.7700000f, 20},
-{-0.2660367f, 0.3357852f, -0.9035888f, 4.2200000f, 36},
-{-0.5471003f, 0.6678213f, 0.5046741f, 6.0500000f, 51},
-{-0.5939900f, 0.7345645f, -0.3280103f, 5.4100000f, 50},
-{-0.5861032f, 0.7246280f, -0.3624877f, 6.3800000f, 50},
-{-0.4140223f, 0.5022790f, 0.7591451f, 5.6900000f, 50},
-{-0.4948127f, 0.6044444f, 0.6243455f, 6.6300000f, 21},
-{-0.6168631f, 0.7630664f, -0.1928978f, 5.4900000f, 31},
-{-0.3711632f, 0.4676902f, -0.8021869f, 6.1200000f, 31},
-{-0.5015561f, 0.6159739f, 0.6074683f, 6.5800000f, 36},
-{-0.5737432f, 0.7083874f, 0.4111034f, 5.7100000f, 31},
-{-0.6180551f, 0.7660325f, 0.1766410f, 6.3500000f, 35},
-{-0.6257484f, 0.7787031f, -0.0453920f, 6.3600000f, 30},
-{-0.5007909f, 0.6173505f, 0.6067016f, 6.4700000f, 55},
-{-0.5685221f, 0.7028393f, 0.4275507f, 6.1500000f, 22},
-{-0.6187083f, 0.7724008f, -0.1435166f, 5.7000000f, 30},
-{-0.2247490f, 0.2896098f, -0.9303838f, 5.3400000f, 65},
-{-0.5713370f, 0.7079709f, 0.4151520f, 6.3200000f, 50},
-{-0.5630606f, 0.6988480f, 0.4411056f, 5.6800000f, 28},
-{-0.6243907f, 0.7799480f, -0.0426313f, 5.4900000f, 54},
-{-0.5014807f, 0.6326072f, -0.5901909f, 5.6300000f, 52},
-{-0.1040914f, 0.1398317f, -0.9846888f, 6.4700000f, 20},
-{-0.4639474f, 0.5886553f, -0.6619953f, 5.5100000f, 20},
-{-0.6229712f, 0.7821892f, 0.0093277f, 6.4600000f, 21},
-{-0.5767257f, 0.7293886f, -0.3679397f, 3.7400000f, 44},
-{-0.6207990f, 0.7837333f, 0.0192556f, 6.1300000f, 35},
-{-0.4081367f, 0.5081871f, 0.7583998f, 6.5800000f, 19},
-{-0.5779395f, 0.7347380f, -0.3551704f, 5.7800000f, 55},
-{-0.4283924f, 0.5353271f, 0.7279456f, 5.6000000f, 30},
-{-0.4999213f, 0.6272690f, 0.5971703f, 5.9400000f, 10},
-{-0.5858235f, 0.7394235f, 0.3317587f, 6.0700000f, 28},
-{-0.3744262f, 0.4835999f, -0.7911613f, 6.3900000f, 52},
-{-0.6047019f, 0.7755978f, -0.1810627f, 6.6100000f, 33},
-{-0.5754837f, 0.7413969f, -0.3451799f, 4.5100000f, 45},
-{-0.5258934f, 0.6795887f, -0.5114639f, 6.5000000f, 20},
-{-0.4926956f, 0.6269859f, 0.6034400f, 5.3100000f, 13},
-{-0.4078217f, 0.5166699f, 0.7528171f, 5.3100000f, 26},
-{-0.5465685f, 0.6974928f, 0.4634292f, 5.4100000f, 21},
-{-0.3739709f, 0.4733170f, 0.7975693f, 6.0300000f, 16},
-{-0.6079662f, 0.7810608f, 0.1425522f, 6.4000000f, 61},
-{-0.5204213f, 0.6669382f, 0.5332495f, 5.8000000f, 30},
-{-0.5825688f, 0.7523868f, 0.3074535f, 6.4400000f, 55},
-{-0.5761263f, 0.7507773f, -0.3231284f, 6.5700000f, 30},
-{-0.5669222f, 0.7321792f, 0.3775086f, 5.9300000f, 64},
-{-0.3111550f, 0.3961954f, 0.8638355f, 6.1000000f, 63},
-{-0.5578446f, 0.7266579f, 0.4009709f, 4.5700000f, 61},
-{-0.3477182f, 0.4485922f, 0.8233208f, 6.1200000f, 18},
-{-0.2427579f, 0.3100693f, 0.9191984f, 5.4400000f, 17},
-{-0.4200394f, 0.5446945f, 0.7258614f, 5.2400000f, 50},
-{-0.4551686f, 0.6045687f, -0.6536958f, 5.2900000f, 50},
-{-0.5093412f, 0.6774139f, -0.5307372f, 5.9700000f, 22},
-{-0.5912197f, 0.7786210f, 0.2102585f, 6.0800000f, 19},
-{-0.6015513f, 0.7950929f, -0.0772217f, 2.9100000f, 40},
-{-0.3737579f, 0.5018687f, -0.7800210f, 6.4100000f, 54},
-{-0.1145414f, 0.1619773f, -0.9801243f, 6.1800000f, 34},
-{-0.5505027f, 0.7342344f, -0.3972992f, 6.4300000f, 27},
-{-0.4355076f, 0.5852992f, -0.6839284f, 5.5700000f, 51},
-{-0.3660082f, 0.4784592f, 0.7981947f, 6.0200000f, 22},
-{-0.2041396f, 0.2628435f, 0.9429954f, 3.2300000f, 11},
-{-0.1031369f, 0.1283089f, 0.9863567f, 5.9700000f, 46},
-{-0.5508961f, 0.7340693f, 0.3970589f, 6.7000000f, 19},
-{-0.4476577f, 0.6065415f, -0.6570464f, 6.3200000f, 51},
-{-0.3665059f, 0.4839855f, 0.7946266f, 6.1600000f, 42},
-{-0.2984538f, 0.3924452f, 0.8700069f, 5.5300000f, 11},
-{-0.5209771f, 0.7097651f, -0.4741480f, 6.4100000f, 18},
-{-0.5564429f, 0.7578517f, -0.3406348f, 5.6900000f, 31},
-{-0.3849008f, 0.5151789f, 0.7657951f, 5.7500000f, 20},
-{-0.5452561f, 0.7454415f, -0.3834224f, 6.4000000f, 47},
-{-0.4159985f, 0.5586049f, 0.7175694f, 6.2500000f, 51},
-{-0.2619670f, 0.3674281f, -0.8923956f, 6.2000000f, 20},
-{-0.5466926f, 0.7426459f, 0.3867870f, 6.4700000f, 37},
-{-0.5899113f, 0.8067007f, -0.0351951f, 5.7700000f, 49},
-{-0.4162804f, 0.5624766f, 0.7143743f, 4.0200000f, 48},
-{-0.5284836f, 0.7286203f, -0.4356806f, 5.7300000f, 27},
-{-0.1316041f, 0.1905486f, -0.9728163f, 3.7600000f, 50},
-{-0.4631587f, 0.6303796f, 0.6229812f, 4.9000000f, 50},
-{-0.4908093f, 0.6806177f, -0.5439354f, 6.1100000f, 27},
-{-0.5201542f, 0.7114603f, 0.4725080f, 6.3100000f, 30},
-{-0.5368307f, 0.7351675f, 0.4139343f, 6.1100000f, 24},
-{-0.3676751f, 0.4989683f, 0.7847583f, 6.1500000f, 19},
-{-0.5536794f, 0.7696757f, -0.3178655f, 4.6800000f, 12},
-{-0.5080437f, 0.7007506f, 0.5008395f, 6.3600000f, 48},
-{-0.4128006f, 0.5683799f, 0.7117162f, 5.5300000f, 65},
-{-0.5822395f, 0.8129888f, 0.0068116f, 6.2500000f, 22},
-{-0.5782422f, 0.8088104f, -0.1070595f, 4.6900000f, 27},
-{-0.5777913f, 0.8080059f, 0.1152550f, 6.1800000f, 22},
-{-0.4449733f, 0.6178226f, 0.6483008f, 5.0100000f, 25},
-{-0.5488210f, 0.7676933f, 0.3308209f, 5.4500000f, 31},
-{-0.4874204f, 0.6903335f, -0.5346597f, 6.2800000f, 48},
-{-0.3559664f, 0.5083491f, -0.7841359f, 6.2100000f, 37},
-{-0.5758785f, 0.8113265f, 0.1005643f, 5.6700000f, 29},
-{-0.3338402f, 0.4792614f, -0.8117014f, 6.3300000f, 50},
-{-0.4141369f, 0.5777410f, 0.7033533f, 6.2000000f, 27},
-{-0.5677099f, 0.8067839f, -0.1637229f, 6.0800000f, 50},
-{-0.5217313f, 0.7365268f, 0.4304936f, 6.1600000f, 49},
-{-0.3417224f, 0.4775109f, 0.8094499f, 6.1500000f, 51},
-{-0.5413580f, 0.7661339f, 0.3463672f, 5.8500000f, 32},
-{-0.5747250f, 0.8174097f, 0.0391484f, 5.1000000f, 50},
-{-0.5528315f, 0.7901977f, -0.2645090f, 3.6800000f, 30},
-{-0.2720230f, 0.3810807f, 0.8836181f, 4.7300000f, 12},
-{-0.0809446f, 0.1281716f, -0.9884432f, 5.2900000f, 48},
-{-0.3102685f, 0.4388573f, 0.8432898f, 5.6200000f, 6},
-{-0.5145188f, 0.7470108f, -0.4210050f, 6.4900000f, 50},
-{-0.5512701f, 0.7987263f, -0.2411174f, 5.1800000f, 41},
-{-0.4171310f, 0.5967494f, 0.6854866f, 5.1100000f, 61},
-{-0.5223450f, 0.7601114f, -0.3865053f, 5.2400000f, 49},
-{-0.1803899f, 0.2712004f, -0.9454681f, 6.0100000f, 18},
-{-0.5656584f, 0.8243345f, 0.0224304f, 5.6700000f, 52},
-{-0.5390048f, 0.7891033f, -0.2946010f, 4.7300000f, 48},
-{-0.5627005f, 0.8207147f, 0.0989724f, 5.3000000f, 62},
-{-0.3285511f, 0.4723785f, 0.8178709f, 6.2000000f, 50},
-{-0.4298978f, 0.6230075f, 0.6534903f, 6.1100000f, 22},
-{-0.5543836f, 0.8107947f, 0.1878051f, 6.0900000f, 15},
-{-0.5333263f, 0.7849500f, -0.3153040f, 6.2200000f, 23},
-{-0.0157081f, 0.0465927f, -0.9987905f, 6.5700000f, 30},
-{-0.5467667f, 0.8035871f, -0.2351468f, 5.8800000f, 30},
-{-0.4610074f, 0.6708849f, 0.5808490f, 6.0700000f, 36},
-{-0.3947695f, 0.5751455f, 0.7164947f, 6.1700000f, 64},
-{-0.4425363f, 0.6591328f, -0.6080342f, 6.3000000f, 45},
-{-0.4259358f, 0.6219568f, 0.6570756f, 5.6900000f, 20},
-{-0.3547773f, 0.5166629f, 0.7792256f, 4.6700000f, 13},
-{-0.5442468f, 0.8070057f, -0.2292098f, 5.9900000f, 30},
-{-0.3673603f, 0.5514415f, -0.7489718f, 6.4500000f, 51},
-{-0.3655846f, 0.5351659f, 0.7615414f, 6.0900000f, 48},
-{-0.4662391f, 0.6974247f, -0.5442608f, 4.3400000f, 20},
-{-0.4234641f, 0.6225630f, 0.6580983f, 5.4900000f, 62},
-{-0.4405607f, 0.6496567f, 0.6195583f, 5.6500000f, 20},
-{-0.5502426f, 0.8172032f, 0.1714992f, 2.3900000f, 52},
-{-0.4898386f, 0.7271962f, 0.4808783f, 4.7300000f, 36},
-{-0.4898531f, 0.7271836f, 0.4808825f, 6.0800000f, 42},
-{-0.5488369f, 0.8214313f, -0.1550121f, 5.0900000f, 48},
-{-0.2880283f, 0.4220623f, 0.8595947f, 6.0800000f, 51},
-{-0.5319821f, 0.7925068f, 0.2982079f, 4.3400000f, 45},
-{-0.5388846f, 0.8028652f, 0.2549723f, 5.9400000f, 40},
-{-0.5020031f, 0.7487872f, 0.4327939f, 4.1300000f, 35},
-{-0.2907683f, 0.4290865f, 0.8551834f, 4.0800000f, 62},
-{-0.1815808f, 0.2640083f, 0.9472740f, 4.5600000f, 51},
-{-0.5445737f, 0.8248839f, -0.1516777f, 6.0000000f, 63},
-{-0.5405431f, 0.8208283f, -0.1845375f, 5.5800000f, 21},
-{-0.4480950f, 0.6753425f, 0.5857674f, 6.4000000f, 48},
-{-0.5080071f, 0.7680489f, 0.3899098f, 5.2900000f, 50},
-{-0.5272472f, 0.8044917f, -0.2735022f, 2.8700000f, 20},
-{-0.3728873f, 0.5756430f, -0.7277295f, 5.5800000f, 40},
-{-0.1708485f, 0.2510816f, 0.9527690f, 5.1700000f, 50},
-{-0.4965936f, 0.7531237f, 0.4315085f, 6.2800000f, 53},
-{-0.4767244f, 0.7322479f, -0.4863608f, 5.0100000f, 22},
-{-0.2570603f, 0.3843124f, 0.8866927f, 5.9500000f, 9},
-{-0.5468400f, 0.8359245f, 0.0468643f, 5.6400000f, 21},
-{-0.4025255f, 0.6097477f, 0.6827745f, 6.5400000f, 40},
-{-0.5235161f, 0.7990902f, 0.2956108f, 6.2100000f, 33},
-{-0.2415209f, 0.3791179f, -0.8932733f, 5.6200000f, 50},
-{-0.5445885f, 0.8356760f, -0.0711976f, 6.1700000f, 27},
-{-0.1969839f, 0.3115526f, -0.9295872f, 5.5300000f, 52},
-{-0.2675344f, 0.4020940f, 0.8756402f, 4.2900000f, 22},
-{-0.3579641f, 0.5449138f, 0.7582418f, 4.2300000f, 13},
-{-0.4369493f, 0.6737329f, 0.5959524f, 6.4700000f, 55},
-{-0.5280625f, 0.8263834f, -0.1955515f, 6.3100000f, 23},
-{-0.4239568f, 0.6559020f, 0.6245424f, 6.1200000f, 18},
-{-0.2676317f, 0.4098488f, 0.8720076f, 5.5200000f, 61},
-{-0.5178370f, 0.8145527f, -0.2614359f, 6.3800000f, 50},
-{-0.5052972f, 0.7889604f, 0.3495943f, 6.2900000f, 12},
-{-0.1861497f, 0.2839705f, 0.9405897f, 6.2900000f, 20},
-{-0.4649893f, 0.7287989f, 0.5026302f, 5.0400000f, 21},
-{-0.5125233f, 0.8056247f, 0.2971342f, 5.2900000f, 32},
-{-0.4055064f, 0.6344894f, 0.6580180f, 6.4800000f, 22},
-{-0.5068048f, 0.8086736f, -0.2986568f, 6.1600000f, 30},
-{-0.2594553f, 0.4045960f, 0.8769179f, 6.1700000f, 61},
-{-0.5000032f, 0.7968416f, 0.3391758f, 5.7700000f, 18},
-{-0.4113003f, 0.6523866f, 0.6365719f, 6.1700000f, 19},
-{-0.4927652f, 0.7909166f, 0.3628130f, 6.8900000f, 64},
-{-0.5127678f, 0.8310256f, -0.2155591f, 5.0800000f, 31},
-{-0.2581389f, 0.4262030f, -0.8670151f, 5.9000000f, 31},
-{-0.4194945f, 0.6840726f, -0.5967152f, 3.0100000f, 18},
-{-0.4627844f, 0.7442058f, 0.4816517f, 5.5300000f, 36},
-{-0.5165127f, 0.8395794f, -0.1682887f, 6.5900000f, 19},
-{-0.4730481f, 0.7649096f, 0.4371943f, 5.0800000f, 13},
-{-0.2978475f, 0.4767328f, 0.8270506f, 5.7100000f, 16},
-{-0.4933332f, 0.8020846f, 0.3365749f, 5.6800000f, 20},
-{-0.5188886f, 0.8464452f, 0.1195207f, 6.1500000f, 40},
-{-0.5207517f, 0.8512340f, -0.0649484f, 5.7100000f, 52},
-{-0.2181990f, 0.3479121f, 0.9117820f, 6.3700000f, 21},
-{-0.2867689f, 0.4783662f, -0.8300177f, 6.1900000f, 20},
-{-0.5196937f, 0.8530541f, -0.0470871f, 6.2000000f, 35},
-{-0.4908446f, 0.8032653f, 0.3373965f, 6.3900000f, 50},
-{-0.4489754f, 0.7466793f, -0.4908066f, 6.4100000f, 48},
-{-0.4115563f, 0.6875242f, -0.5982741f, 5.4600000f, 22},
-{-0.4122025f, 0.6931025f, -0.5913527f, 6.1800000f, 31},
-{-0.3055759f, 0.5183424f, -0.7987143f, 4.4000000f, 30},
-{-0.2605220f, 0.4445007f, -0.8570574f, 6.1200000f, 33},
-{-0.1164296f, 0.2055131f, -0.9717039f, 6.4100000f, 25},
-{-0.2857212f, 0.4703294f, 0.8349573f, 5.8000000f, 18},
-{-0.4786579f, 0.7997790f, 0.3622708f, 6.4000000f, 55},
-{-0.5001979f, 0.8402564f, 0.2092156f, 5.5400000f, 22},
-{-0.2465899f, 0.4077502f, 0.8791662f, 6.1300000f, 48},
-{-0.2157990f, 0.3574461f, 0.9086601f, 5.8600000f, 12},
-{-0.5050901f, 0.8593724f, -0.0797688f, 6.3300000f, 35},
-{-0.3375739f, 0.5676173f, 0.7509024f, 6.4200000f, 18},
-{-0.4718380f, 0.8068881f, -0.3553879f, 6.1200000f, 64},
-{-0.3982184f, 0.6848834f, -0.6102105f, 5.5000000f, 50},
-{-0.1191306f, 0.2128609f, -0.9697928f, 5.9500000f, 33},
-{-0.2921743f, 0.5081153f, -0.8102179f, 6.0100000f, 19},
-{-0.5030784f, 0.8619225f, -0.0632599f, 6.2200000f, 52},
-{-0.2277146f, 0.3814333f, 0.8959100f, 4.9100000f, 62},
-{-0.2064077f, 0.3475784f, 0.9146503f, 6.4300000f, 12},
-{-0.4960733f, 0.8603652f, 0.1169741f, 6.0000000f, 13},
-{-0.4405122f, 0.7694632f, -0.4624666f, 5.4200000f, 18},
-{-0.2779833f, 0.4982089f, -0.8212875f, 4.6900000f, 54},
-{-0.2312589f, 0.3961091f, 0.8886039f, 5.9300000f, 63},
-{-0.2687291f, 0.4625735f, 0.8448730f, 6.5900000f, 20},
-{-0.4958731f, 0.8683308f, 0.0105590f, 5.5800000f, 54},
-{-0.4178900f, 0.7270755f, 0.5447285f, 6.4600000f, 35},
-{-0.4829321f, 0.8457267f, 0.2269866f, 5.6000000f, 34},
-{-0.4904974f, 0.8595268f, 0.1436174f, 5.6500000f, 55},
-{-0.4723950f, 0.8366439f, -0.2772541f, 6.2800000f, 47},
-{-0.1315351f, 0.2229684f, 0.9659108f, 6.3500000f, 55},
-{-0.4739380f, 0.8414764f, -0.2594231f, 6.3700000f, 22},
-{-0.4833321f, 0.8544896f, 0.1903616f, 6.3700000f, 15},
-{-0.4300796f, 0.7702206f, -0.4709477f, 7.1000000f, 30},
-{-0.2298225f, 0.4007046f, 0.8869146f, 6.6600000f, 10},
-{-0.1455023f, 0.2501234f, 0.9572185f, 5.0300000f, 35},
-{-0.4853539f, 0.8690915f, -0.0954549f, 5.5400000f, 50},
-{-0.4871690f, 0.8727142f, -0.0321909f, 4.6900000f, 17},
-{-0.2975146f, 0.5250176f, 0.7973967f, 5.7800000f, 15},
-{-0.4778220f, 0.8559847f, 0.1974245f, 5.8000000f, 19},
-{-0.4263882f, 0.7723876f, -0.4707553f, 6.4700000f, 55},
-{-0.2607864f, 0.4612984f, 0.8480532f, 5.5600000f, 9},
-{-0.3477605f, 0.6206216f, 0.7027741f, 5.6000000f, 20},
-{-0.4366301f, 0.7926971f, -0.4254239f, 5.9600000f, 14},
-{-0.2505856f, 0.4607937f, -0.8513965f, 5.6200000f, 54},
-{-0.4817316f, 0.8761759f, 0.0158237f, 5.3000000f, 25},
-{-0.3733075f, 0.6883704f, -0.6219226f, 4.4600000f, 53},
-{-0.4050254f, 0.7350156f, 0.5437890f, 6.3800000f, 45},
-{-0.4765221f, 0.8747296f, 0.0881748f, 4.8400000f, 54},
-{-0.4779819f, 0.8783519f, 0.0055802f, 2.9600000f, 42},
-{-0.4291504f, 0.7837781f, 0.4489118f, 5.7800000f, 52},
-{-0.2194000f, 0.3953266f, 0.8919532f, 5.2900000f, 65},
-{-0.2080828f, 0.3745815f, 0.9035431f, 4.2900000f, 23},
-{-0.4648670f, 0.8600825f, -0.2101352f, 4.2700000f, 19},
-{-0.4188921f, 0.7681297f, 0.4842583f, 5.7000000f, 19},
-{-0.1255988f, 0.2431046f, -0.9618342f, 6.5500000f, 52},
-{-0.3288808f, 0.6011697f, 0.7283079f, 6.1300000f, 64},
-{-0.3371646f, 0.6199689f, 0.7084904f, 6.4400000f, 20},
-{-0.0628998f, 0.1070086f, 0.9922665f, 6.9800000f, 36},
-{-0.3372268f, 0.6213099f, 0.7072850f, 5.1400000f, 55},
-{-0.3311057f, 0.6242517f, -0.7075866f, 1.7400000f, 17},
-{-0.2199522f, 0.4009546f, 0.8893011f, 5.2700000f, 54},
-{-0.3182197f, 0.5851944f, 0.7458443f, 6.2700000f, 12},
-{-0.2234685f, 0.4079551f, 0.8852313f, 5.1100000f, 9},
-{-0.3353769f, 0.6190180f, 0.7101683f, 6.1900000f, 23},
-{-0.4277205f, 0.7961238f, 0.4280678f, 3.7600000f, 35},
-{-0.4011013f, 0.7574153f, -0.5152084f, 4.5000000f, 22},
-{-0.1107970f, 0.2172677f, -0.9698035f, 6.1500000f, 50},
-{-0.3880251f, 0.7331097f, -0.5585577f, 4.9900000f, 61},
-{-0.2639722f, 0.4873166f, 0.8323708f, 6.3900000f, 20},
-{-0.4445099f, 0.8314158f, 0.3334047f, 5.7500000f, 32},
-{-0.4483235f, 0.8387543f, 0.3090262f, 6.3500000f, 61},
-{-0.3919868f, 0.7427750f, -0.5427999f, 6.3700000f, 22},
-{-0.4367715f, 0.8200516f, 0.3697918f, 5.7800000f, 17},
-{-0.4441740f, 0.8440870f, -0.3003775f, 5.8100000f, 12},
-{-0.3096982f, 0.5947136f, -0.7418913f, 6.4300000f, 53},
-{-0.4225874f, 0.7971751f, 0.4311980f, 6.1100000f, 31},
-{-0.2445855f, 0.4559590f, 0.8557332f, 6.3200000f, 46},
-{-0.2818433f, 0.5268770f, 0.8018510f, 6.1400000f, 23},
-{-0.3831033f, 0.7353730f, -0.5589799f, 5.3700000f, 25},
-{-0.3023625f, 0.5703110f, 0.7637553f, 6.4200000f, 55},
-{-0.4087955f, 0.7853027f, -0.4649579f, 6.4400000f, 25},
-{-0.3934245f, 0.7569437f, -0.5217791f, 4.9200000f, 36},
-{-0.3258013f, 0.6171755f, 0.7162038f, 6.1100000f, 42},
-{-0.3890004f, 0.7411460f, 0.5471575f, 5.5800000f, 48},
-{-0.4582800f, 0.8822267f, 0.1079608f, 3.5300000f, 22},
-{-0.4600761f, 0.8871188f, -0.0367455f, 6.2700000f, 21},
-{-0.4517311f, 0.8735757f, -0.1811199f, 5.4600000f, 17},
-{-0.4585920f, 0.8862590f, -0.0651032f, 6.0100000f, 50},
-{-0.3865135f, 0.7423801f, 0.5472468f, 4.2900000f, 35},
-{-0.4337930f, 0.8361273f, 0.3357302f, 6.1800000f, 40},
-{-0.4453912f, 0.8589715f, 0.2525760f, 6.3300000f, 50},
-{-0.4279794f, 0.8313297f, -0.3545766f, 6.0900000f, 36},
-{-0.4499132f, 0.8700446f, 0.2014958f, 5.7800000f, 61},
-{-0.4293228f, 0.8291625f, 0.3580104f, 6.4600000f, 23},
-{-0.3947698f, 0.7653439f, 0.5083360f, 6.3200000f, 28},
-{-0.4368567f, 0.8560402f, 0.2763177f, 5.9500000f, 51},
-{-0.4392500f, 0.8660900f, -0.2386370f, 6.0300000f, 32},
-{-0.2888408f, 0.5618124f, 0.7752018f, 5.4000000f, 25},
-{-0.4058143f, 0.8047567f, -0.4332222f, 6.1700000f, 23},
-{-0.2415681f, 0.4683053f, 0.8499029f, 3.3500000f, 51},
-{-0.4111523f, 0.8080938f, 0.4218272f, 5.9200000f, 50},
-{-0.4504115f, 0.8909868f, -0.0572010f, 6.3900000f, 37},
-{-0.1402981f, 0.2689560f, 0.9528794f, 4.7900000f, 47},
-{-0.2319669f, 0.4528726f, 0.8608703f, 5.0400000f, 6},
-{-0.4059069f, 0.8118157f, -0.4197557f, 5.5800000f, 36},
-{-0.1007317f, 0.2108135f, -0.9723224f, 5.5100000f, 33},
-{-0.2487238f, 0.4871666f, 0.8371411f, 5.2400000f, 38},
-{-0.1415330f, 0.2726226f, 0.9516540f, 6.3700000f, 19},
-{-0.1560680f, 0.3018859f, 0.9404827f, 5.5000000f, 32},
-{-0.3711233f, 0.7346727f, 0.5679116f, 5.3300000f, 52},
-{-0.2333499f, 0.4577199f, 0.8579279f, 6.3000000f, 50},
-{-0.3367841f, 0.6802596f, -0.6510171f, 6.2300000f, 45},
-{-0.3991431f, 0.8033057f, -0.4420234f, 5.4300000f, 18},
-{-0.2217040f, 0.4352672f, 0.8725765f, 5.3500000f, 51},
-{-0.4156736f, 0.8364525f, -0.3571592f, 5.3200000f, 50},
-{-0.0765609f, 0.1642322f, -0.9834461f, 5.1000000f, 65},
-{-0.3929452f, 0.7850642f, 0.4788196f, 5.8900000f, 52},
-{-0.2033978f, 0.4007962f, 0.8933038f, 5.7900000f, 63},
-{-0.3189091f, 0.6508666f, -0.6889627f, 6.1000000f, 48},
-{-0.3435952f, 0.6882301f, 0.6389692f, 4.4900000f, 53},
-{-0.3337220f, 0.6813241f, -0.6514807f, 4.7900000f, 48},
-{-0.3135612f, 0.6276828f, 0.7125263f, 5.5300000f, 20},
-{-0.3326475f, 0.6853904f, -0.6477543f, 5.1000000f, 48},
-{-0.3244566f, 0.6560556f, 0.6814096f, 5.7100000f, 22},
-{-0.2017496f, 0.4038746f, 0.8922905f, 6.1100000f, 18},
-{-0.4335129f, 0.8888003f, 0.1486628f, 6.2100000f, 21},
-{-0.3979220f, 0.8215246f, -0.4083570f, 6.1500000f, 51},
-{-0.1294186f, 0.2564323f, 0.9578587f, 6.0800000f, 50},
-{-0.2405343f, 0.4879342f, 0.8390849f, 4.1900000f, 30},
-{-0.4361629f, 0.8998402f, -0.0070443f, 6.1500000f, 25},
-{-0.4269820f, 0.8832711f, -0.1936969f, 5.3400000f, 50},
-{-0.4003346f, 0.8299487f, -0.3884807f, 6.1700000f, 45},
-{-0.3467137f, 0.7106324f, 0.6122019f, 4.1300000f, 53},
-{-0.4325415f, 0.8950874f, -0.1082885f, 4.1600000f, 48},
-{-0.4296226f, 0.8894762f, -0.1557449f, 5.7900000f, 53},
-{-0.2622143f, 0.5513525f, -0.7919937f, 5.3700000f, 43},
-{-0.2159473f, 0.4553051f, -0.8637500f, 2.8600000f, 53},
-{-0.3860419f, 0.7958613f, 0.4664510f, 6.3700000f, 49},
-{-0.4326137f, 0.8979854f, -0.0804212f, 5.7500000f, 46},
-{-0.0391023f, 0.0963254f, -0.9945815f, 5.7700000f, 50},
-{-0.2364006f, 0.4870732f, 0.8407583f, 5.8800000f, 48},
-{-0.4302251f, 0.9027121f, 0.0041500f, 6.3900000f, 33},
-{-0.4160894f, 0.8823688f, -0.2197611f, 5.9500000f, 47},
-{-0.2320021f, 0.5009692f, -0.8337895f, 6.3400000f, 53},
-{-0.3373924f, 0.7148621f, 0.6124856f, 6.1700000f, 29},
-{-0.1963750f, 0.4126891f, 0.8894518f, 5.7500000f, 53},
-{-0.4193832f, 0.9014060f, -0.1076330f, 5.3700000f, 18},
-{-0.4186520f, 0.9025271f, 0.1008730f, 5.3700000f, 15},
-{-0.4146679f, 0.8987620f, 0.1423986f, 6.1700000f, 36},
-{-0.1266463f, 0.2865134f, -0.9496688f, 5.2900000f, 23},
-{-0.3901931f, 0.8521901f, -0.3485993f, 5.1300000f, 52},
-{-0.3732371f, 0.8096294f, 0.4529837f, 6.4700000f, 64},
-{-0.4160322f, 0.9092870f, -0.0106948f, 3.8400000f, 20},
-{-0.2644279f, 0.5713574f, 0.7769354f, 6.4200000f, 52},
-{-0.4071880f, 0.8885391f, 0.2114148f, 5.0100000f, 12},
-{-0.2959533f, 0.6549431f, -0.6953137f, 6.6200000f, 35},
-{-0.3673922f, 0.7998862f, 0.4745577f, 4.8100000f, 19},
-{-0.2879193f, 0.6247363f, 0.7258147f, 4.5700000f, 16},
-{-0.2947095f, 0.6552486f, -0.6955541f, 5.6200000f, 33},
-{-0.1002751f, 0.2110363f, 0.9723212f, 6.6600000f, 21},
-{-0.1034639f, 0.2375254f, -0.9658555f, 6.0400000f, 43},
-{-0.1403508f, 0.3196334f, -0.9370892f, 5.7800000f, 33},
-{-0.3082444f, 0.6751961f, 0.6701460f, 6.4100000f, 15},
-{-0.3755167f, 0.8386434f, -0.3945434f, 5.5300000f, 49},
-{-0.4057104f, 0.9062873f, -0.1185002f, 5.9300000f, 46},
-{-0.2241633f, 0.5090882f, -0.8310114f, 5.3200000f, 43},
-{-0.3813720f, 0.8531669f, 0.3558954f, 6.0400000f, 37},
-{-0.4056592f, 0.9123574f, -0.0551777f, 5.7800000f, 20},
-{-0.3953819f, 0.8927732f, -0.2159379f, 5.7600000f, 46},
-{-0.2219735f, 0.4927821f, 0.8413641f, 6.1600000f, 18},
-{-0.3182911f, 0.7140827f, 0.6235196f, 6.2200000f, 35},
-{-0.1901512f, 0.4221364f, 0.8863652f, 6.0400000f, 21},
-{-0.2502019f, 0.5590716f, 0.7904669f, 4.4300000f, 48},
-{-0.4015254f, 0.9155323f, 0.0240396f, 4.6600000f, 11},
-{-0.1783974f, 0.4169021f, -0.8912727f, 4.4800000f, 19},
-{-0.2629429f, 0.5941808f, 0.7601383f, 4.5700000f, 19},
-{-0.3682200f, 0.8486533f, -0.3797387f, 6.2900000f, 20},
-{-0.3794863f, 0.8694197f, 0.3163850f, 6.2600000f, 50},
-{-0.3824907f, 0.8856857f, -0.2631762f, 6.5700000f, 42},
-{-0.3824798f, 0.8856959f, -0.2631575f, 6.3500000f, 41},
-{-0.0305037f, 0.0606345f, 0.9976938f, 5.2700000f, 19},
-{-0.1547295f, 0.3673164f, -0.9171355f, 5.5500000f, 24},
-{-0.3950889f, 0.9154431f, 0.0766078f, 5.7500000f, 37},
-{-0.3141650f, 0.7291472f, 0.6079842f, 6.4600000f, 12},
-{-0.0831280f, 0.1860272f, 0.9790218f, 6.7600000f, 19},
-{-0.3899867f, 0.9171745f, 0.0818612f, 4.7900000f, 50},
-{-0.3021762f, 0.7175631f, -0.6275291f, 5.4700000f, 49},
-{-0.3018716f, 0.7063754f, 0.6402401f, 6.1400000f, 12},
-{-0.2182861f, 0.5079933f, 0.8332430f, 6.5700000f, 15},
-{-0.3327193f, 0.7816557f, 0.5275531f, 5.9800000f, 52},
-{-0.2842918f, 0.6802049f, -0.6756474f, 3.9700000f, 46},
-{-0.1313094f, 0.3020389f, 0.9442088f, 5.4700000f, 52},
-{-0.3874016f, 0.9219110f, 0.0003539f, 4.5900000f, 36},
-{-0.3873748f, 0.9219223f, 0.0003491f, 4.4200000f, 33},
-{-0.2839877f, 0.6835673f, -0.6723740f, 4.1100000f, 64},
-{-0.1658510f, 0.3864392f, 0.9072807f, 5.4600000f, 10},
-{-0.3812831f, 0.9107423f, 0.1586559f, 5.5800000f, 55},
-{-0.3421367f, 0.8236183f, -0.4523223f, 5.9500000f, 31},
-{-0.3446742f, 0.8236673f, 0.4503019f, 5.7900000f, 52},
-{-0.3754448f, 0.9066837f, -0.1922651f, 6.4000000f, 33},
-{-0.3816733f, 0.9210618f, 0.0772701f, 5.4800000f, 32},
-{-0.3711058f, 0.8991451f, -0.2319884f, 6.3700000f, 18},
-{-0.1701842f, 0.4025311f, 0.8994476f, 6.2900000f, 50},
-{-0.3115492f, 0.7496626f, 0.5839034f, 6.5600000f, 22},
-{-0.3409214f, 0.8322348f, -0.4372161f, 6.4300000f, 51},
-{-0.2021814f, 0.4831624f, 0.8518666f, 3.7500000f, 35},
-{-0.2587908f, 0.6211702f, 0.7397127f, 4.3600000f, 60},
-{-0.3750557f, 0.9127404f, -0.1619818f, 4.8200000f, 20},
-{-0.3223896f, 0.7786056f, 0.5383664f, 5.6500000f, 19},
-{-0.2489785f, 0.6018919f, 0.7587726f, 6.4000000f, 52},
-{-0.3205817f, 0.7885596f, -0.5247868f, 4.2900000f, 20},
-{-0.0797271f, 0.2061889f, -0.9752588f, 6.1500000f, 51},
-{-0.0769959f, 0.1785858f, 0.9809071f, 5.8300000f, 22},
-{-0.2778770f, 0.6749185f, 0.6835711f, 4.5100000f, 12},
-{-0.3773417f, 0.9258791f, -0.0190036f, 6.1600000f, 50},
-{-0.3757069f, 0.9218678f, -0.0948902f, 6.1400000f, 37},
-{-0.1851758f, 0.4641565f, -0.8661805f, 4.8100000f, 64},
-{-0.3711422f, 0.9150245f, -0.1580623f, 6.3800000f, 28},
-{-0.3274160f, 0.8060258f, 0.4930732f, 6.3500000f, 25},
-{-0.2412047f, 0.5917304f, 0.7692044f, 3.7700000f, 21},
-{-0.3492507f, 0.8708924f, 0.3457895f, 6.4200000f, 31},
-{-0.3572963f, 0.8930972f, 0.2733437f, 6.3200000f, 50},
-{-0.2865204f, 0.7131015f, 0.6398378f, 5.8800000f, 26},
-{-0.2192452f, 0.5447942f, 0.8094015f, 6.3500000f, 48},
-{-0.3662949f, 0.9304691f, -0.0074321f, 5.8900000f, 46},
-{-0.0742644f, 0.1790285f, 0.9810370f, 5.5000000f, 23},
-{-0.3432636f, 0.8792162f, -0.3303771f, 5.2000000f, 34},
-{-0.2000616f, 0.5203750f, -0.8301718f, 6.2300000f, 25},
-{-0.2023402f, 0.5115530f, 0.8350880f, 5.7100000f, 48},
-{-0.1271957f, 0.3190140f, 0.9391759f, 6.6000000f, 29},
-{-0.3337309f, 0.8649774f, -0.3747504f, 5.9700000f, 50},
-{-0.3609864f, 0.9325688f, 0.0020508f, 4.0200000f, 19},
-{-0.1240774f, 0.3121230f, 0.9419045f, 6.3400000f, 20},
-{-0.0889285f, 0.2208546f, 0.9712440f, 5.6800000f, 22},
-{-0.2753172f, 0.7218191f, -0.6349628f, 6.2800000f, 23},
-{-0.3072240f, 0.8065457f, -0.5050717f, 5.8200000f, 51},
-{-0.2738007f, 0.7224944f, -0.6348504f, 5.8600000f, 21},
-{-0.2763935f, 0.7188264f, 0.6378833f, 5.7300000f, 12},
-{-0.2910359f, 0.7594783f, 0.5817997f, 6.1000000f, 50},
-{-0.3485048f, 0.9151191f, 0.2027351f, 6.4000000f, 21},
-{-0.2303012f, 0.5990954f, 0.7668416f, 6.2900000f, 13},
-{-0.2003444f, 0.5209862f, 0.8297201f, 6.3800000f, 23},
-{-0.3454773f, 0.9128133f, 0.2177553f, 6.3000000f, 55},
-{-0.2885095f, 0.7596232f, 0.5828678f, 6.3000000f, 55},
-{-0.3504409f, 0.9342716f, -0.0657853f, 5.0300000f, 52},
-{-0.2160122f, 0.5866299f, -0.7805153f, 6.6500000f, 31},
-{-0.3467190f, 0.9319258f, -0.1063026f, 6.2300000f, 40},
-{-0.2193845f, 0.5819150f, 0.7830999f, 4.6300000f, 28},
-{-0.3086257f, 0.8337086f, -0.4579084f, 6.4700000f, 51},
-{-0.1011895f, 0.2628132f, 0.9595259f, 5.0800000f, 33},
-{-0.2910324f, 0.7873788f, -0.5434472f, 5.6600000f, 22},
-{-0.2460012f, 0.6605214f, 0.7093623f, 6.4000000f, 42},
-{-0.3266953f, 0.8840809f, 0.3341724f, 5.8200000f, 48},
-{-0.3038607f, 0.8318375f, -0.4644514f, 6.3100000f, 50},
-{-0.1865444f, 0.5182536f, -0.8346343f, 5.9700000f, 54},
-{-0.1903675f, 0.5134709f, 0.8367245f, 5.2100000f, 64},
-{-0.2679602f, 0.7288996f, 0.6300021f, 4.8800000f, 9},
-{-0.2968163f, 0.8196293f, -0.4900081f, 5.8700000f, 53},
-{-0.3228762f, 0.8844925f, 0.3367849f, 6.2100000f, 22},
-{-0.0892521f, 0.2362509f, 0.9675844f, 5.7900000f, 61},
-{-0.2723964f, 0.7440732f, 0.6100453f, 6.0300000f, 43},
-{-0.1546172f, 0.4171454f, 0.8955910f, 5.1900000f, 23},
-{-0.3024591f, 0.8384668f, -0.4533122f, 4.1700000f, 18},
-{-0.3384293f, 0.9400236f, -0.0426749f, 6.3100000f, 36},
-{-0.0516868f, 0.1545989f, -0.9866244f, 4.1500000f, 29},
-{-0.3275637f, 0.9108199f, 0.2512154f, 5.7100000f, 44},
-{-0.2433673f, 0.6733502f, 0.6981203f, 4.4600000f, 52},
-{-0.2010349f, 0.5546468f, 0.8074354f, 5.9300000f, 50},
-{-0.3300337f, 0.9250751f, 0.1879194f, 3.4000000f, 18},
-{-0.2268186f, 0.6460201f, -0.7288425f, 5.9800000f, 40},
-{-0.2336209f, 0.6658899f, -0.7085280f, 2.1000000f, 65},
-{-0.2916374f, 0.8277843f, -0.4792919f, 6.1700000f, 65},
-{-0.2879113f, 0.8076938f, 0.5145268f, 6.3400000f, 55},
-{-0.2389857f, 0.6816574f, -0.6915411f, 6.0700000f, 50},
-{-0.2565070f, 0.7191305f, 0.6457983f, 5.2500000f, 12},
-{-0.2919539f, 0.8216788f, 0.4894966f, 4.7900000f, 21},
-{-0.3233229f, 0.9124875f, 0.2506569f, 5.9000000f, 50},
-{-0.2510413f, 0.7050222f, 0.6632661f, 5.9400000f, 49},
-{-0.2488139f, 0.7175191f, -0.6505828f, 4.8500000f, 50},
-{-0.3264887f, 0.9356852f, -0.1337844f, 6.4500000f, 25},
-{-0.1646597f, 0.4800770f, -0.8616341f, 6.3000000f, 33},
-{-0.3274392f, 0.9407838f, -0.0878029f, 6.4100000f, 20},
-{-0.1957958f, 0.5555796f, 0.8080813f, 6.1200000f, 52},
-{-0.3126812f, 0.9028209f, -0.2952032f, 4.6900000f, 54},
-{-0.2848755f, 0.8157771f, 0.5033426f, 2.9400000f, 42},
-{-0.2607410f, 0.7458633f, 0.6129454f, 6.4300000f, 11},
-{-0.2239279f, 0.6419058f, 0.7333575f, 6.3900000f, 21},
-{-0.3208200f, 0.9279349f, 0.1897667f, 6.5100000f, 48},
-{-0.2510648f, 0.7300418f, 0.6356142f, 5.9500000f, 55},
-{-0.1940916f, 0.5769953f, -0.7933504f, 4.8500000f, 52},
-{-0.2423488f, 0.7047475f, 0.6667818f, 5.0800000f, 50},
-{-0.2235228f, 0.6649363f, -0.7126691f, 5.5100000f, 52},
-{-0.2159396f, 0.6466253f, -0.7316049f, 6.6200000f, 39},
-{-0.2097237f, 0.6311115f, -0.7468026f, 6.4800000f, 51},
-{-0.3014184f, 0.8939688f, 0.3316123f, 6.2500000f, 46},
-{-0.1960558f, 0.5760749f, 0.7935363f, 6.5500000f, 52},
-{-0.2220011f, 0.6705659f, -0.7078537f, 6.5600000f, 29},
-{-0.0525794f, 0.1677340f, -0.9844291f, 5.3500000f, 16},
-{-0.0682017f, 0.2152650f, -0.9741712f, 6.7300000f, 24},
-{-0.3073646f, 0.9279358f, 0.2108604f, 4.1900000f, 36},
-{-0.2256372f, 0.6760247f, 0.7014831f, 5.7600000f, 30},
-{-0.2888252f, 0.8699089f, 0.3997981f, 3.9500000f, 48},
-{-0.2590200f, 0.7891870f, -0.5568595f, 6.2800000f, 51},
-{-0.1522978f, 0.4712185f, -0.8687684f, 6.3700000f, 50},
-{-0.2950064f, 0.9019292f, -0.3154282f, 5.2600000f, 47},
-{-0.2449489f, 0.7514758f, -0.6126044f, 6.7100000f, 34},
-{-0.1055876f, 0.3312987f, -0.9375993f, 6.3400000f, 22},
-{-0.3010656f, 0.9226562f, -0.2409668f, 5.6600000f, 20},
-{-0.2823475f, 0.8681598f, -0.4081402f, 6.3000000f, 45},
-{-0.1943363f, 0.6030710f, -0.7736529f, 3.4900000f, 23},
-{-0.3027672f, 0.9388323f, -0.1640912f, 6.1900000f, 29},
-{-0.1628701f, 0.4967353f, 0.8524831f, 6.3600000f, 19},
-{-0.2448342f, 0.7555594f, 0.6076069f, 5.9000000f, 48},
-{-0.2953416f, 0.9309174f, -0.2148632f, 4.0100000f, 60},
-{-0.2572807f, 0.8158041f, -0.5179482f, 6.3300000f, 30},
-{-0.2975792f, 0.9372133f, 0.1818732f, 6.5400000f, 30},
-{-0.1778952f, 0.5540511f, 0.8132531f, 6.1200000f, 15},
-{-0.1391955f, 0.4331321f, 0.8905174f, 6.0600000f, 50},
-{-0.2733963f, 0.8671463f, 0.4163072f, 3.4800000f, 48},
-{-0.2308474f, 0.7438703f, -0.6271893f, 5.4200000f, 60},
-{-0.1549743f, 0.5049145f, -0.8491433f, 6.4600000f, 51},
-{-0.1113674f, 0.3479727f, 0.9308664f, 6.1900000f, 35},
-{-0.1691118f, 0.5344832f, 0.8280875f, 5.4300000f, 51},
-{-0.1332762f, 0.4370519f, -0.8895072f, 6.1200000f, 50},
-{-0.2225061f, 0.7096199f, 0.6685287f, 5.9200000f, 13},
-{-0.2815184f, 0.9017953f, 0.3278913f, 6.4000000f, 50},
-{-0.1901066f, 0.6045042f, 0.7735853f, 6.2100000f, 44},
-{-0.2594186f, 0.8399702f, -0.4766048f, 5.9700000f, 48},
-{-0.1218830f, 0.3846897f, 0.9149636f, 3.5200000f, 50},
-{-0.2484019f, 0.8192145f, -0.5168986f, 4.4600000f, 20},
-{-0.1398498f, 0.4530410f, 0.8804521f, 5.6000000f, 48},
-{-0.2864226f, 0.9427525f, 0.1708210f, 5.1600000f, 37},
-{-0.2879869f, 0.9510834f, -0.1118206f, 3.7400000f, 62},
-{-0.2126352f, 0.6958604f, 0.6859771f, 4.9400000f, 60},
-{-0.1932788f, 0.6486683f, -0.7361201f, 6.0400000f, 40},
-{-0.0965384f, 0.3293709f, -0.9392524f, 6.0500000f, 42},
-{-0.0370913f, 0.1132855f, 0.9928699f, 4.7400000f, 53},
-{-0.2756828f, 0.9165490f, 0.2897186f, 5.6400000f, 51},
-{-0.2815103f, 0.9424797f, -0.1802330f, 5.8000000f, 19},
-{-0.1839986f, 0.6101222f, 0.7706461f, 6.4600000f, 18},
-{-0.2196282f, 0.7319234f, 0.6450206f, 6.3400000f, 17},
-{-0.1435256f, 0.4773612f, 0.8669064f, 6.0100000f, 52},
-{-0.2026917f, 0.6806570f, 0.7040044f, 5.8100000f, 23},
-{-0.2727250f, 0.9303860f, -0.2449549f, 3.2700000f, 23},
-{-0.2796583f, 0.9527807f, -0.1183221f, 6.1900000f, 53},
-{-0.2703263f, 0.9238202f, -0.2710718f, 5.5600000f, 52},
-{-0.2159908f, 0.7305380f, 0.6478134f, 5.8100000f, 50},
-{-0.2266509f, 0.7807522f, -0.5822846f, 6.4000000f, 52},
-{-0.2693075f, 0.9179111f, 0.2913979f, 6.1200000f, 34},
-{-0.2798156f, 0.9598739f, 0.0185818f, 6.1100000f, 27},
-{-0.2786754f, 0.9589466f, -0.0525490f, 5.7200000f, 50},
-{-0.2755778f, 0.9489829f, 0.1532589f, 4.9000000f, 21},
-{-0.2231102f, 0.7659955f, 0.6028870f, 5.9100000f, 35},
-{-0.2383401f, 0.8292330f, -0.5055361f, 6.1000000f, 53},
-{-0.2353041f, 0.8199053f, -0.5219073f, 4.2100000f, 48},
-{-0.2362102f, 0.8292223f, -0.5065522f, 6.4800000f, 54},
-{-0.1890460f, 0.6680375f, -0.7197135f, 5.7000000f, 20},
-{-0.2228692f, 0.7739438f, 0.5927397f, 5.7400000f, 17},
-{-0.2662395f, 0.9417853f, 0.2053217f, 6.5100000f, 23},
-{-0.2048748f, 0.7191390f, 0.6639770f, 5.5900000f, 12},
-{-0.1769810f, 0.6216398f, 0.7630476f, 4.9500000f, 55},
-{-0.2698176f, 0.9613021f, -0.0556472f, 6.3100000f, 49},
-{-0.2364135f, 0.8474755f, -0.4752830f, 1.1600000f, 23},
-{-0.2519754f, 0.9004264f, 0.3545993f, 5.4900000f, 42},
-{-0.2685490f, 0.9609711f, 0.0664529f, 6.2800000f, 51},
-{-0.1789995f, 0.6354805f, 0.7510817f, 5.4300000f, 14},
-{-0.2182764f, 0.7949308f, -0.5660746f, 6.1300000f, 38},
-{-0.2078198f, 0.7453103f, 0.6335009f, 6.1800000f, 12},
-{-0.2660476f, 0.9635530f, -0.0280040f, 6.1600000f, 48},
-{-0.2655631f, 0.9640385f, -0.0102924f, 6.3700000f, 30},
-{-0.0239061f, 0.0770338f, 0.9967418f, 5.9000000f, 55},
-{-0.2612548f, 0.9514789f, 0.1625845f, 6.4300000f, 42},
-{-0.2620866f, 0.9565511f, 0.1277522f, 6.3300000f, 21},
-{-0.2567285f, 0.9448636f, 0.2032810f, 5.7500000f, 28},
-{-0.2288661f, 0.8481666f, -0.4777381f, 5.5100000f, 25},
-{-0.2539206f, 0.9409899f, -0.2237463f, 6.0700000f, 55},
-{-0.2610714f, 0.9651732f, 0.0168029f, 5.4300000f, 51},
-{-0.2345124f, 0.8766911f, -0.4200197f, 5.6500000f, 50},
-{-0.1591217f, 0.5853793f, 0.7949914f, 6.2900000f, 52},
-{-0.1319340f, 0.4851795f, 0.8644040f, 6.4300000f, 19},
-{-0.2341776f, 0.8802588f, -0.4126805f, 6.2900000f, 51},
-{-0.1596927f, 0.6052681f, -0.7798390f, 4.1200000f, 48},
-{-0.0278105f, 0.0945122f, 0.9951352f, 4.7100000f, 54},
-{-0.1665205f, 0.6338930f, -0.7552818f, 5.6800000f, 53},
-{-0.2561545f, 0.9666304f, 0.0032434f, 6.2100000f, 44},
-{-0.2554510f, 0.9653934f, 0.0525393f, 5.8300000f, 54},
-{-0.1409748f, 0.5269067f, 0.8381500f, 5.0000000f, 44},
-{-0.2191000f, 0.8279191f, 0.5162801f, 6.6000000f, 19},
-{-0.2253417f, 0.8608385f, -0.4562655f, 5.5500000f, 53},
-{-0.1801130f, 0.6789805f, 0.7117196f, 6.5000000f, 23},
-{-0.2358485f, 0.9019397f, -0.3617737f, 6.2800000f, 25},
-{-0.2510892f, 0.9603952f, -0.1208106f, 6.2100000f, 55},
-{-0.1989676f, 0.7545504f, 0.6253524f, 6.5400000f, 13},
-{-0.2519564f, 0.9660368f, -0.0573656f, 5.9400000f, 50},
-{-0.2016896f, 0.7879076f, -0.5818273f, 6.4700000f, 51},
-{-0.1370997f, 0.5255033f, 0.8396725f, 6.2000000f, 51},
-{-0.1853567f, 0.7157118f, 0.6733495f, 3.6200000f, 16},
-{-0.2469725f, 0.9643980f, -0.0945572f, 6.1500000f, 62},
-{-0.2336062f, 0.9154445f, -0.3277035f, 5.9700000f, 50},
-{-0.2108593f, 0.8235046f, 0.5266673f, 6.5700000f, 32},
-{-0.1819595f, 0.7113262f, 0.6789004f, 5.1000000f, 23},
-{-0.2040962f, 0.8109934f, -0.5483013f, 5.1100000f, 30},
-{-0.1776416f, 0.6963232f, 0.6953973f, 6.3900000f, 12},
-{-0.0923982f, 0.3766747f, -0.9217259f, 5.5200000f, 34},
-{-0.1410056f, 0.5524819f, 0.8215115f, 6.5000000f, 19},
-{-0.1839262f, 0.7375736f, -0.6497356f, 5.7900000f, 50},
-{-0.2417338f, 0.9687309f, -0.0559038f, 6.6800000f, 38},
-{-0.2419054f, 0.9680100f, 0.0666222f, 4.5300000f, 16},
-{-0.1471059f, 0.5973326f, -0.7883867f, 5.3700000f, 55},
-{-0.2142804f, 0.8558513f, 0.4707467f, 2.4200000f, 62},
-{-0.2402404f, 0.9638503f, 0.1152261f, 6.4100000f, 32},
-{-0.1205921f, 0.4782862f, 0.8698850f, 6.7400000f, 12},
-{-0.1275834f, 0.5056889f, 0.8532298f, 6.4300000f, 48},
-{-0.0944534f, 0.3756762f, 0.9219251f, 5.2400000f, 53},
-{-0.1548370f, 0.6231404f, 0.7666300f, 4.6500000f, 50},
-{-0.2303397f, 0.9370986f, 0.2622781f, 2.4900000f, 19},
-{-0.2355595f, 0.9656323f, -0.1098451f, 5.4300000f, 32},
-{-0.2265308f, 0.9295018f, -0.2910501f, 6.1400000f, 50},
-{-0.2273969f, 0.9311421f, 0.2850704f, 6.4400000f, 48},
-{-0.2363810f, 0.9713927f, 0.0228085f, 6.3900000f, 49},
-{-0.0444400f, 0.1940156f, -0.9799913f, 6.1200000f, 23},
-{-0.1694157f, 0.7177977f, -0.6753257f, 4.2800000f, 35},
-{-0.2201386f, 0.9223193f, 0.3175943f, 6.1300000f, 36},
-{-0.2133748f, 0.9005617f, -0.3787608f, 4.4700000f, 49},
-{-0.1831491f, 0.7761868f, -0.6033163f, 5.6100000f, 21},
-{-0.1517455f, 0.6464417f, -0.7477208f, 6.3300000f, 54},
-{-0.2173694f, 0.9147520f, 0.3405573f, 6.3000000f, 37},
-{-0.1487415f, 0.6347231f, -0.7582892f, 5.8300000f, 36},
-{-0.0672029f, 0.2945750f, -0.9532625f, 6.1500000f, 53},
-{-0.2260956f, 0.9602876f, 0.1634886f, 4.5200000f, 61},
-{-0.2064928f, 0.8788915f, 0.4300122f, 4.7600000f, 48},
-{-0.1174363f, 0.4950054f, 0.8609172f, 4.8500000f, 10},
-{-0.1909541f, 0.8183386f, 0.5420871f, 6.0200000f, 24},
-{-0.2118887f, 0.9083527f, 0.3605531f, 5.9900000f, 25},
-{-0.1581310f, 0.6755426f, 0.7201644f, 6.6600000f, 12},
-{-0.1380900f, 0.5883840f, 0.7967028f, 6.1100000f, 50},
-{-0.1987930f, 0.8671066f, -0.4567357f, 5.6000000f, 49},
-{-0.1151718f, 0.4907805f, 0.8636376f, 6.4000000f, 12},
-{-0.1561785f, 0.6718676f, 0.7240180f, 5.3300000f, 55},
-{-0.1473772f, 0.6352828f, 0.7580869f, 5.7000000f, 35},
-{-0.1596556f, 0.6943775f, 0.7016765f, 6.5600000f, 22},
-{-0.2218989f, 0.9743626f, 0.0371282f, 5.4000000f, 48},
-{-0.1002909f, 0.4326419f, 0.8959703f, 6.2600000f, 13},
-{-0.0906340f, 0.4104759f, -0.9073561f, 6.4700000f, 50},
-{-0.0391991f, 0.1852117f, -0.9819165f, 6.4100000f, 54},
-{-0.0979124f, 0.4237117f, 0.9004896f, 6.2100000f, 50},
-{-0.2044989f, 0.9120090f, -0.3555556f, 3.6600000f, 51},
-{-0.1922278f, 0.8625113f, -0.4681055f, 5.8700000f, 52},
-{-0.1631473f, 0.7352269f, -0.6578939f, 5.8100000f, 34},
-{-0.2159621f, 0.9646757f, 0.1508678f, 5.1200000f, 64},
-{-0.2111866f, 0.9492034f, -0.2332662f, 6.4200000f, 20},
-{-0.2016637f, 0.9080211f, -0.3671913f, 4.6900000f, 42},
-{-0.1666925f, 0.7544456f, -0.6348429f, 5.8300000f, 64},
-{-0.0568598f, 0.2457893f, 0.9676542f, 4.4100000f, 42},
-{-0.1526141f, 0.6935517f, -0.7040560f, 3.9000000f, 51},
-{-0.2131622f, 0.9620093f, 0.1705869f, 5.3900000f, 19},
-{-0.1109700f, 0.4978286f, 0.8601467f, 5.7000000f, 25},
-{-0.1873465f, 0.8588286f, -0.4767753f, 6.5100000f, 31},
-{-0.2034305f, 0.9312595f, 0.3022775f, 5.7100000f, 54},
-{-0.1554848f, 0.7079708f, 0.6889135f, 5.9400000f, 35},
-{-0.2066192f, 0.9666044f, 0.1516059f, 5.1600000f, 25},
-{-0.1861871f, 0.8725709f, 0.4516130f, 6.1700000f, 48},
-{-0.1345439f, 0.6504024f, -0.7475792f, 6.8000000f, 48},
-{-0.0955153f, 0.4706288f, -0.8771462f, 6.1200000f, 48},
-{-0.1337582f, 0.6367933f, 0.7593439f, 4.5200000f, 30},
-{-0.1770947f, 0.8526597f, 0.4915372f, 6.3500000f, 48},
-{-0.1097527f, 0.5309478f, 0.8402671f, 5.5600000f, 53},
-{-0.1980040f, 0.9612285f, 0.1919225f, 5.8200000f, 48},
-{-0.1969183f, 0.9749224f, -0.1036798f, 4.2200000f, 61},
-{-0.1475476f, 0.7413772f, -0.6546675f, 5.7700000f, 52},
-{-0.1939132f, 0.9675838f, -0.1618000f, 6.1200000f, 55},
-{-0.1258505f, 0.6218843f, 0.7729305f, 6.3100000f, 20},
-{-0.1717111f, 0.8508576f, 0.4965448f, 6.4100000f, 36},
-{-0.1796106f, 0.8949673f, 0.4083791f, 6.3600000f, 52},
-{-0.1924594f, 0.9803322f, -0.0436824f, 5.5500000f, 23},
-{-0.1889637f, 0.9696866f, -0.1549211f, 4.2100000f, 50},
-{-0.1689468f, 0.8645564f, 0.4732855f, 6.4900000f, 45},
-{-0.0876481f, 0.4612347f, -0.8829385f, 5.6600000f, 37},
-{-0.0534572f, 0.2664481f, 0.9623657f, 5.8400000f, 20},
-{-0.1733886f, 0.8912801f, 0.4189943f, 6.6000000f, 35},
-{-0.1363272f, 0.7123160f, -0.6884917f, 5.9200000f, 51},
-{-0.1417375f, 0.7435429f, -0.6534940f, 6.4700000f, 50},
-{-0.0985095f, 0.5242301f, -0.8458597f, 3.9900000f, 31},
-{-0.0352781f, 0.1957488f, -0.9800193f, 6.3300000f, 50},
-{-0.1860533f, 0.9764445f, -0.1092717f, 5.0600000f, 63},
-{-0.0629925f, 0.3212981f, 0.9448807f, 5.5600000f, 30},
-{-0.1855119f, 0.9809726f, 0.0572543f, 3.6900000f, 49},
-{-0.1124540f, 0.5881798f, 0.8008737f, 5.5400000f, 37},
-{-0.0887886f, 0.4615787f, 0.8826447f, 6.5300000f, 10},
-{-0.0720123f, 0.3917224f, -0.9172610f, 6.1300000f, 52},
-{-0.1807131f, 0.9671880f, -0.1785780f, 6.3400000f, 21},
-{-0.1306776f, 0.6928623f, 0.7091299f, 6.4300000f, 50},
-{-0.1804916f, 0.9715584f, -0.1532877f, 4.3900000f, 15},
-{-0.1407227f, 0.7623345f, -0.6316986f, 5.5300000f, 35},
-{-0.1202380f, 0.6447420f, 0.7548845f, 4.8500000f, 62},
-{-0.1279513f, 0.6892722f, 0.7131145f, 6.4800000f, 19},
-{-0.0084370f, 0.0601500f, -0.9981537f, 5.4900000f, 52},
-{-0.1524206f, 0.8392019f, -0.5220231f, 4.4100000f, 51},
-{-0.1346601f, 0.7335249f, 0.6661891f, 6.0200000f, 27},
-{-0.1762024f, 0.9734819f, -0.1458960f, 4.9800000f, 20},
-{-0.1732299f, 0.9606465f, -0.2171401f, 5.0800000f, 45},
-{-0.0469919f, 0.2493832f, 0.9672641f, 6.3800000f, 22},
-{-0.1755882f, 0.9807880f, -0.0849918f, 5.5500000f, 33},
-{-0.1676653f, 0.9365723f, -0.3077672f, 5.9300000f, 53},
-{-0.1254022f, 0.6941753f, 0.7087983f, 6.5000000f, 25},
-{-0.1478082f, 0.8323144f, -0.5342335f, 6.3700000f, 52},
-{-0.0669373f, 0.3667402f, 0.9279122f, 4.7500000f, 50},
-{-0.1445195f, 0.8083992f, 0.5706180f, 6.3200000f, 18},
-{-0.1162074f, 0.6506854f, 0.7504028f, 5.4400000f, 50},
-{-0.1162081f, 0.6539311f, 0.7475760f, 6.3200000f, 51},
-{-0.1292913f, 0.7308850f, 0.6701424f, 5.7900000f, 60},
-{-0.1100122f, 0.6374552f, -0.7625931f, 6.0500000f, 35},
-{-0.1714138f, 0.9807251f, 0.0937849f, 5.0500000f, 52},
-{-0.1702831f, 0.9828081f, -0.0713572f, 6.1700000f, 50},
-{-0.1564491f, 0.9019112f, 0.4025914f, 4.6000000f, 25},
-{-0.0811218f, 0.4628791f, 0.8827017f, 6.4500000f, 51},
-{-0.1466866f, 0.8498143f, 0.5062596f, 5.5900000f, 60},
-{-0.1524593f, 0.8932926f, -0.4228292f, 5.6400000f, 44},
-{-0.1224038f, 0.7074156f, 0.6961182f, 6.1300000f, 25},
-{-0.1334944f, 0.7746301f, 0.6181645f, 5.7700000f, 35},
-{-0.0797967f, 0.4593049f, 0.8846872f, 6.3900000f, 52},
-{-0.1405646f, 0.8380714f, 0.5271412f, 5.3200000f, 16},
-{-0.1476820f, 0.8818036f, 0.4478978f, 6.6200000f, 35},
-{-0.0806183f, 0.4943127f, -0.8655378f, 6.0900000f, 63},
-{-0.1567360f, 0.9533037f, -0.2581587f, 5.2000000f, 23},
-{-0.1515458f, 0.9222804f, 0.3555737f, 6.2900000f, 19},
-{-0.1512663f, 0.9280444f, -0.3403704f, 3.9700000f, 50},
-{-0.1567219f, 0.9643419f, 0.2132672f, 5.0800000f, 53},
-{-0.0810292f, 0.4913425f, 0.8671890f, 5.5600000f, 53},
-{-0.0961487f, 0.6054348f, -0.7900659f, 6.1500000f, 24},
-{-0.1154088f, 0.7236887f, -0.6804083f, 6.1000000f, 53},
-{-0.1584504f, 0.9873538f, 0.0050857f, 6.3100000f, 52},
-{-0.0997233f, 0.6335337f, -0.7672615f, 5.7500000f, 60},
-{-0.1326463f, 0.8325968f, 0.5377616f, 6.6900000f, 34},
-{-0.1488125f, 0.9430266f, -0.2975832f, 6.1900000f, 48},
-{-0.0861292f, 0.5648896f, -0.8206592f, 5.5900000f, 50},
-{-0.1159659f, 0.7444385f, 0.6575433f, 6.7200000f, 18},
-{-0.1290217f, 0.8345537f, 0.5356057f, 5.5700000f, 19},
-{-0.0710781f, 0.4596450f, 0.8852539f, 4.9800000f, 61},
-{-0.1381034f, 0.9072750f, 0.3972146f, 4.4000000f, 38},
-{-0.1392631f, 0.9331308f, -0.3314705f, 4.3900000f, 55},
-{-0.0908134f, 0.6189106f, -0.7801939f, 5.5200000f, 34},
-{-0.0594746f, 0.4117074f, -0.9093733f, 6.4500000f, 54},
-{-0.0764684f, 0.5314750f, -0.8436154f, 5.6300000f, 48},
-{-0.0921142f, 0.6382747f, -0.7642777f, 6.2000000f, 19},
-{-0.1437460f, 0.9893720f, 0.0219118f, 4.9400000f, 20},
-{-0.1424001f, 0.9896153f, 0.0195901f, 6.2500000f, 47},
-{-0.1047041f, 0.7248781f, 0.6808736f, 5.7500000f, 19},
-{-0.1147157f, 0.8165465f, -0.5657668f, 6.3200000f, 52},
-{-0.1272388f, 0.8960820f, 0.4252616f, 5.9800000f, 20},
-{-0.1384474f, 0.9841181f, 0.1111028f, 4.2800000f, 51},
-{-0.1364522f, 0.9735789f, -0.1830983f, 6.3700000f, 40},
-{-0.0478283f, 0.3326934f, 0.9418214f, 5.6000000f, 26},
-{-0.0614205f, 0.4515552f, -0.8901267f, 5.6800000f, 20},
-{-0.0977720f, 0.7187280f, -0.6883827f, 6.4300000f, 52},
-{-0.1332445f, 0.9793819f, -0.1518455f, 6.1800000f, 50},
-{-0.1237156f, 0.9118242f, 0.3914986f, 6.3500000f, 49},
-{-0.1308667f, 0.9664819f, 0.2208771f, 4.5500000f, 47},
-{-0.1322949f, 0.9893637f, -0.0604775f, 6.2500000f, 53},
-{-0.0850548f, 0.6487528f, 0.7562311f, 6.1700000f, 53},
-{-0.0680295f, 0.5173169f, 0.8530857f, 4.9100000f, 13},
-{-0.0996853f, 0.7744563f, 0.6247242f, 6.0500000f, 49},
-{-0.1254935f, 0.9870900f, -0.0995224f, 6.3900000f, 50},
-{-0.0906397f, 0.7238365f, -0.6839920f, 6.0200000f, 51},
-{-0.0967742f, 0.7684735f, 0.6325213f, 5.2200000f, 50},
-{-0.1236373f, 0.9899785f, -0.0682378f, 6.4900000f, 38},
-{-0.1152631f, 0.9287467f, -0.3523408f, 6.2900000f, 29},
-{-0.1082715f, 0.8729296f, 0.4756796f, 6.4100000f, 21},
-{-0.1220270f, 0.9923985f, -0.0159545f, 6.3800000f, 51},
-{-0.0268836f, 0.2299317f, -0.9728354f, 5.8100000f, 42},
-{-0.0984319f, 0.8136953f, 0.5728971f, 6.6500000f, 18},
-{-0.0949693f, 0.8015427f, -0.5903474f, 4.3700000f, 19},
-{-0.0067380f, 0.0464900f, 0.9988960f, 5.5800000f, 27},
-{-0.1099435f, 0.9386143f, -0.3269797f, 4.7100000f, 21},
-{-0.1067162f, 0.9177030f, 0.3826655f, 5.3200000f, 65},
-{-0.0808485f, 0.7017480f, 0.7078229f, 6.2400000f, 48},
-{-0.1061005f, 0.9285301f, 0.3557731f, 6.0600000f, 63},
-{-0.0968743f, 0.8487187f, 0.5198960f, 4.9800000f, 54},
-{-0.1125432f, 0.9935600f, -0.0131332f, 5.8700000f, 22},
-{-0.0484857f, 0.4465298f, -0.8934542f, 7.4000000f, 32},
-{-0.1060182f, 0.9611983f, -0.2546723f, 5.9600000f, 50},
-{-0.0843490f, 0.7587116f, 0.6459426f, 5.5900000f, 21},
-{-0.0920995f, 0.8288111f, 0.5518966f, 5.6300000f, 50},
-{-0.0814316f, 0.7458520f, -0.6611155f, 4.7100000f, 22},
-{-0.0865177f, 0.7829885f, 0.6159900f, 6.1800000f, 57},
-{-0.1058537f, 0.9878462f, -0.1138198f, 6.3900000f, 45},
-{-0.0343104f, 0.3130753f, 0.9491084f, 5.8400000f, 49},
-{-0.0953403f, 0.9045076f, 0.4156636f, 6.4500000f, 61},
-{-0.1027740f, 0.9940281f, 0.0366825f, 5.6800000f, 36},
-{-0.0859078f, 0.8351737f, 0.5432355f, 6.3500000f, 36},
-{-0.0863143f, 0.8605783f, -0.5019511f, 6.5200000f, 51},
-{-0.0241489f, 0.2554880f, -0.9665106f, 6.0000000f, 50},
-{-0.0948510f, 0.9699796f, -0.2239258f, 5.6500000f, 49},
-{-0.0688178f, 0.7098306f, -0.7010026f, 4.7400000f, 22},
-{-0.0931422f, 0.9526480f, 0.2894588f, 6.2600000f, 21},
-{-0.0673281f, 0.6855874f, 0.7248703f, 3.8200000f, 48},
-{-0.0698923f, 0.7106879f, 0.7000270f, 5.8000000f, 18},
-{-0.0911652f, 0.9444833f, 0.3156582f, 5.5300000f, 21},
-{-0.0664095f, 0.6889534f, 0.7217569f, 6.5800000f, 45},
-{-0.0693583f, 0.7248442f, 0.6854125f, 4.2900000f, 18},
-{-0.0628663f, 0.6998043f, -0.7115629f, 6.0900000f, 28},
-{-0.0578545f, 0.6338248f, 0.7713099f, 5.3000000f, 19},
-{-0.0855554f, 0.9674488f, -0.2381662f, 5.0000000f, 30},
-{-0.0869521f, 0.9913764f, 0.0980413f, 4.1300000f, 37},
-{-0.0862655f, 0.9819885f, 0.1680975f, 5.9700000f, 22},
-{-0.0230392f, 0.2528323f, 0.9672358f, 5.9500000f, 23},
-{-0.0247959f, 0.2744730f, 0.9612751f, 5.9800000f, 48},
-{-0.0688432f, 0.7887315f, 0.6108709f, 6.5300000f, 32},
-{-0.0192753f, 0.2133122f, 0.9767939f, 3.2100000f, 51},
-{-0.0716220f, 0.8456957f, -0.5288375f, 5.3100000f, 51},
-{-0.0610711f, 0.7126676f, 0.6988385f, 4.1400000f, 19},
-{-0.0675025f, 0.7987109f, 0.5979166f, 6.2300000f, 31},
-{-0.0752790f, 0.9115767f, -0.4041795f, 6.6000000f, 61},
-{-0.0808341f, 0.9804979f, -0.1791361f, 5.8900000f, 49},
-{-0.0763889f, 0.9481310f, -0.3085651f, 5.3400000f, 55},
-{-0.0525003f, 0.6471598f, 0.7605445f, 6.2600000f, 24},
-{-0.0763387f, 0.9573346f, -0.2787164f, 4.8200000f, 40},
-{-0.0780690f, 0.9889270f, 0.1262086f, 5.8900000f, 23},
-{-0.0782183f, 0.9964522f, 0.0310619f, 4.5000000f, 27},
-{-0.0426485f, 0.5391435f, 0.8411334f, 6.2400000f, 48},
-{-0.0547279f, 0.7050854f, 0.7070074f, 6.5700000f, 55},
-{-0.0739841f, 0.9650874f, -0.2512623f, 5.2800000f, 54},
-{-0.0732523f, 0.9697904f, -0.2326816f, 4.4900000f, 19},
-{-0.0331094f, 0.4289902f, 0.9027021f, 6.5600000f, 62},
-{-0.0361378f, 0.4730257f, 0.8803072f, 6.4000000f, 52},
-{-0.0713087f, 0.9811992f, 0.1793412f, 5.0600000f, 62},
-{-0.0682051f, 0.9647910f, -0.2540205f, 6.3600000f, 67},
-{-0.0493250f, 0.7064145f, -0.7060776f, 6.0900000f, 51},
-{-0.0237731f, 0.3492402f, -0.9367316f, 6.0700000f, 48},
-{-0.0147904f, 0.2209074f, -0.9751826f, 5.7500000f, 51},
-{-0.0306339f, 0.4436483f, -0.8956773f, 5.7200000f, 52},
-{-0.0608273f, 0.8694168f, 0.4903208f, 4.9300000f, 50},
-{-0.0656096f, 0.9502768f, -0.3044164f, 5.2400000f, 19},
-{-0.0609392f, 0.8986069f, -0.4345020f, 6.1700000f, 34},
-{-0.0372395f, 0.5608524f, 0.8270778f, 6.5100000f, 44},
-{-0.0468237f, 0.7666594f, -0.6403443f, 6.3100000f, 27},
-{-0.0582174f, 0.9528700f, -0.2977405f, 5.2900000f, 32},
-{-0.0419795f, 0.6880838f, 0.7244159f, 4.9500000f, 45},
-{-0.0592328f, 0.9963899f, 0.0608163f, 5.0400000f, 35},
-{-0.0230167f, 0.3935546f, 0.9190131f, 5.9500000f, 12},
-{-0.0358627f, 0.6448166f, -0.7634955f, 5.1800000f, 13},
-{-0.0209541f, 0.3803996f, -0.9245848f, 6.8900000f, 32},
-{-0.0293614f, 0.5194064f, 0.8540228f, 4.8700000f, 51},
-{-0.0546795f, 0.9830167f, -0.1751806f, 5.7300000f, 51},
-{-0.0304273f, 0.5371539f, 0.8429353f, 5.5100000f, 53},
-{-0.0371362f, 0.6831248f, 0.7293568f, 6.0700000f, 13},
-{-0.0525779f, 0.9983830f, -0.0216113f, 5.4900000f, 48},
-{-0.0199114f, 0.3772034f, 0.9259164f, 5.0400000f, 21},
-{-0.0497354f, 0.9939507f, -0.0979206f, 6.0700000f, 54},
-{-0.0487189f, 0.9980650f, 0.0386349f, 6.4600000f, 35},
-{-0.0426958f, 0.8829811f, -0.4674627f, 4.5700000f, 20},
-{-0.0210178f, 0.4240520f, 0.9053939f, 6.4100000f, 20},
-{-0.0226975f, 0.4656107f, 0.8846985f, 5.4300000f, 23},
-{-0.0242261f, 0.4997322f, 0.8658411f, 6.3400000f, 20},
-{-0.0242876f, 0.5150183f, 0.8568350f, 6.3300000f, 32},
-{-0.0442987f, 0.9686941f, -0.2442732f, 6.2400000f, 52},
-{-0.0459724f, 0.9987662f, 0.0187806f, 5.7700000f, 25},
-{-0.0215763f, 0.4818740f, -0.8759748f, 6.5900000f, 55},
-{-0.0362082f, 0.8038168f, 0.5937739f, 5.9000000f, 41},
-{-0.0395193f, 0.8750572f, 0.4824036f, 5.9700000f, 22},
-{-0.0403252f, 0.9078418f, -0.4173693f, 6.4200000f, 23},
-{-0.0421346f, 0.9893084f, -0.1396196f, 5.9400000f, 50},
-{-0.0260752f, 0.6203036f, 0.7839283f, 6.4400000f, 33},
-{-0.0400450f, 0.9711437f, -0.2351091f, 5.7200000f, 54},
-{-0.0372220f, 0.9861158f, 0.1618335f, 5.7900000f, 63},
-{-0.0360466f, 0.9551587f, -0.2938920f, 5.1800000f, 19},
-{-0.0048036f, 0.1394168f, -0.9902221f, 5.1100000f, 47},
-{-0.0350063f, 0.9980788f, 0.0511207f, 5.5500000f, 54},
-{-0.0075319f, 0.2146127f, 0.9766702f, 6.5500000f, 35},
-{-0.0308523f, 0.9288084f, 0.3692737f, 6.1100000f, 62},
-{-0.0309621f, 0.9443256f, 0.3275523f, 5.0800000f, 62},
-{-0.0317816f, 0.9708266f, -0.2376671f, 5.8700000f, 53},
-{-0.0082564f, 0.2494877f, 0.9683428f, 6.3900000f, 53},
-{-0.0316170f, 0.9812924f, 0.1899095f, 5.3000000f, 24},
-{-0.0309960f, 0.9920550f, -0.1219271f, 5.7500000f, 50},
-{-0.0308203f, 0.9982923f, -0.0496245f, 5.9300000f, 49},
-{-0.0301695f, 0.9988789f, 0.0364790f, 6.2800000f, 21},
-{-0.0265641f, 0.9147794f, -0.4030795f, 6.2400000f, 23},
-{-0.0219459f, 0.8910706f, -0.4533338f, 6.3500000f, 22},
-{-0.0131667f, 0.5371464f, 0.8433862f, 4.5400000f, 42},
-{-0.0179814f, 0.7691894f, -0.6387678f, 6.0300000f, 38},
-{-0.0227891f, 0.9997385f, 0.0019053f, 5.6100000f, 65},
-{-0.0210862f, 0.9921701f, 0.1231011f, 6.2100000f, 19},
-{-0.0178329f, 0.8651572f, -0.5011835f, 6.1000000f, 16},
-{-0.0178262f, 0.8648291f, -0.5017498f, 6.8300000f, 18},
-{-0.0181110f, 0.8989556f, 0.4376651f, 6.5400000f, 55},
-{-0.0104296f, 0.5384901f, 0.8425673f, 6.0000000f, 10},
-{-0.0131234f, 0.6773161f, 0.7355751f, 6.0000000f, 48},
-{-0.0140362f, 0.9185959f, -0.3949488f, 6.3100000f, 45},
-{-0.0133217f, 0.9227914f, 0.3850695f, 6.1500000f, 62},
-{-0.0018303f, 0.1185439f, 0.9929471f, 6.5900000f, 23},
-{-0.0094337f, 0.7353471f, 0.6776250f, 5.9700000f, 38},
-{-0.0112813f, 0.9034415f, -0.4285628f, 6.2600000f, 53},
-{-0.0070270f, 0.5633981f, 0.8261557f, 5.5500000f, 31},
-{-0.0056367f, 0.4841109f, -0.8749885f, 5.9700000f, 21},
-{-0.0015223f, 0.1421025f, -0.9898508f, 5.7300000f, 50},
-{-0.0046652f, 0.4430205f, -0.8964993f, 5.0000000f, 21},
-{-0.0053230f, 0.4996147f, 0.8662314f, 6.4700000f, 19},
-{-0.0088543f, 0.9052188f, 0.4248535f, 4.6600000f, 63},
-{-0.0069668f, 0.9696234f, -0.2445036f, 6.2600000f, 50},
-{-0.0043202f, 0.6240200f, 0.7813964f, 4.8000000f, 67},
-{-0.0057834f, 0.9990737f, -0.0426410f, 4.8600000f, 49},
-{-0.0043481f, 0.8444881f, 0.5355566f, 6.5200000f, 16},
-{-0.0029220f, 0.6258599f, -0.7799300f, 5.1300000f, 50},
-{-0.0036852f, 0.6894447f, 0.7243290f, 6.5400000f, 14},
-{-0.0024349f, 0.5627275f, 0.8266389f, 4.8800000f, 11},
-{-0.0029819f, 0.9928295f, 0.1195015f, 4.0100000f, 34},
-{-0.0020512f, 0.8786898f, -0.4773888f, 5.6200000f, 55},
-{-0.0018629f, 0.8317152f, 0.5551993f, 6.5800000f, 40},
-{-0.0018629f, 0.8317152f, 0.5551993f, 6.5800000f, 40},
-{-0.0001570f, 0.4317272f, -0.9020042f, 4.5000000f, 19},
-{0.0010093f, 0.7228525f, -0.6910016f, 6.2900000f, 43},
-{0.0015497f, 0.8916514f, 0.4527200f, 6.4600000f, 37},
-{0.0011385f, 0.5066387f, 0.8621577f, 6.1900000f, 49},
-{0.0022372f, 0.7039699f, 0.7102263f, 6.3800000f, 19},
-{0.0031876f, 0.6795619f, -0.7336113f, 5.7100000f, 48},
-{0.0037657f, 0.6472742f, -0.7622480f, 5.5300000f, 62},
-{0.0037083f, 0.6430220f, 0.7658387f, 6.2200000f, 47},
-{0.0015733f, 0.2260650f, -0.9741110f, 4.7800000f, 53},
-{0.0033923f, 0.4813891f, 0.8765005f, 5.5500000f, 30},
-{0.0055771f, 0.7388199f, 0.6738798f, 6.2500000f, 19},
-{0.0079450f, 0.9986229f, -0.0518566f, 5.1000000f, 17},
-{0.0084301f, 0.8903164f, 0.4552644f, 5.7500000f, 45},
-{0.0085054f, 0.9945113f, -0.1042826f, 4.4100000f, 63},
-{0.0090082f, 0.9730412f, -0.2304555f, 7.1000000f, 37},
-{0.0089594f, 0.8805995f, -0.4737766f, 5.0100000f, 14},
-{0.0103585f, 0.9877513f, 0.1556922f, 6.3200000f, 26},
-{0.0107671f, 0.9889945f, 0.1475601f, 5.6300000f, 30},
-{0.0045992f, 0.4051332f, 0.9142461f, 5.8600000f, 48},
-{0.0121398f, 0.9398892f, -0.3412638f, 6.2500000f, 36},
-{0.0124835f, 0.9144886f, -0.4044190f, 6.4400000f, 45},
-{0.0066412f, 0.4439297f, 0.8960370f, 6.2400000f, 13},
-{0.0156328f, 0.9578759f, -0.2867568f, 4.5500000f, 19},
-{0.0066670f, 0.3952934f, 0.9185307f, 6.2900000f, 64},
-{0.0085758f, 0.4649518f, 0.8852944f, 5.8800000f, 21},
-{0.0182005f, 0.9635932f, -0.2667525f, 5.7800000f, 52},
-{0.0165980f, 0.8767258f, -0.4807040f, 6.4000000f, 20},
-{0.0193721f, 0.9861225f, -0.1648850f, 4.9400000f, 53},
-{0.0079575f, 0.3879702f, 0.9216375f, 5.6700000f, 51},
-{0.0149310f, 0.7419166f, 0.6703259f, 6.0100000f, 19},
-{0.0063755f, 0.3238180f, -0.9460979f, 7.3100000f, 32},
-{0.0175729f, 0.8223563f, 0.5687014f, 6.1200000f, 42},
-{0.0068069f, 0.3326996f, -0.9430083f, 5.5900000f, 18},
-{0.0192376f, 0.8935648f, 0.4485219f, 6.2500000f, 54},
-{0.0106877f, 0.4798876f, 0.8772649f, 5.8000000f, 18}
-};
\ No newline at end of file
@@ -11,8 +11,19 @@ struct s_star {
   uint8_t mk;
 };
 
-extern const s_star stars[];
-extern const uint16_t num_stars;
+//rate of change of a star's x, y, z in mas/yr, only stars that move
+//significantly are listed, sorted by index into stars[]
+struct s_proper_motion {
+  uint16_t star;
+  int16_t dx;
+  int16_t dy;
+  int16_t dz;
+};
+
+//stars are read from the "STAR" section of the catalog blob, and proper
+//motions from "PMOT", these structures are also the on-disk layout
+static_assert(sizeof(s_star) == 20, "s_star must match model/make_star_list.py");
+static_assert(sizeof(s_proper_motion) == 8, "s_proper_motion must match model/make_star_list.py");
 
 #endif
 
@@ -0,0 +1,73 @@
+#ifndef __HOST_CATALOG_H__
+#define __HOST_CATALOG_H__
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../pico_planetarium/star_catalog.h"
+#include "../pico_planetarium/catalog_blob.h"
+
+//on the host the whole catalog is mapped into memory, so tiles are read
+//in place rather than copied through the cache
+class c_star_catalog_mmap : public c_star_catalog
+{
+    public:
+    c_star_catalog_mmap():c_star_catalog(0){}
+
+    private:
+    bool file_open(const char* filename)
+    {
+        fd = ::open(filename, O_RDONLY);
+        if(fd < 0) return false;
+        struct stat st;
+        fstat(fd, &st);
+        size = st.st_size;
+        data = (const uint8_t*)mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        position = 0;
+        return data != MAP_FAILED;
+    }
+
+    void file_close()
+    {
+        munmap((void*)data, size);
+        ::close(fd);
+    }
+
+    void file_read(void* buffer, uint32_t element_size, uint32_t num_elements)
+    {
+        memcpy(buffer, data + position, element_size*num_elements);
+        position += element_size*num_elements;
+    }
+
+    void file_seek(uint32_t offset)
+    {
+        position = offset;
+    }
+
+    const uint8_t *file_map()
+    {
+        return data;
+    }
+
+    int fd;
+    size_t size;
+    size_t position;
+    const uint8_t *data;
+};
+
+//the blob is normally built in from catalog_blob_data.cpp like on the device,
+//this maps a blob file written by write_blob in model/catalog_blob.py instead
+inline bool attach_catalog_blob(const char* filename)
+{
+  int fd = open(filename, O_RDONLY);
+  if(fd < 0) return false;
+  struct stat st;
+  fstat(fd, &st);
+  void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  return data != MAP_FAILED && catalog_blob.attach(data, st.st_size);
+}
+
+#endif
@@ -0,0 +1,257 @@
+//Exercise c_kv_store over a simulated flash part: check values survive a
+//reopen, erases are spread over every sector, and a power cut at any point
+//leaves either the old or the new value, never garbage
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../pico_planetarium/kv_store.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool pass)
+{
+  printf("%-40s %s\n", name, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+//NOR flash: erase sets a sector to ones, programming can only clear bits
+struct s_flash
+{
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> erases;
+  uint32_t programs = 0;
+  int32_t bytes_until_power_cut = -1; //-1 never
+  bool misuse = false;
+
+  s_flash(uint8_t num_sectors):data(num_sectors*c_kv_store::sector_size, 0xff), erases(num_sectors, 0){}
+
+  //true while there is power
+  bool consume(uint32_t bytes)
+  {
+    if(bytes_until_power_cut < 0) return true;
+    if((int32_t)bytes > bytes_until_power_cut)
+    {
+      bytes_until_power_cut = 0;
+      return false;
+    }
+    bytes_until_power_cut -= bytes;
+    return true;
+  }
+};
+
+class c_kv_store_sim : public c_kv_store
+{
+  s_flash &flash;
+
+  public:
+  c_kv_store_sim(s_flash &flash):c_kv_store(flash.erases.size()), flash(flash){}
+
+  private:
+  bool flash_read(uint32_t offset, void *data, uint32_t size)
+  {
+    if(offset + size > flash.data.size()) return false;
+    memcpy(data, &flash.data[offset], size);
+    return true;
+  }
+
+  bool flash_program(uint32_t offset, const void *data, uint32_t size)
+  {
+    if(offset % page_size || size % page_size || offset + size > flash.data.size()) flash.misuse = true;
+    const uint8_t *p = (const uint8_t*)data;
+    for(uint32_t idx = 0; idx < size; ++idx)
+    {
+      if(!flash.consume(1)) return false;
+      flash.data[offset + idx] &= p[idx];
+    }
+    flash.programs++;
+    return true;
+  }
+
+  bool flash_erase(uint32_t offset)
+  {
+    if(offset % sector_size) flash.misuse = true;
+    //an interrupted erase leaves the sector half erased
+    const bool complete = flash.consume(sector_size);
+    memset(&flash.data[offset], 0xff, complete ? sector_size : sector_size/2);
+    flash.erases[offset/sector_size]++;
+    return complete;
+  }
+};
+
+struct s_value
+{
+  float latitude, longitude;
+  uint32_t count;
+  uint8_t padding[28];
+};
+
+int main()
+{
+  const uint8_t num_sectors = 4;
+
+  //empty flash
+  {
+    s_flash flash(num_sectors);
+    c_kv_store_sim store(flash);
+    s_value value;
+    check("empty flash has no store", !store.open() && !store.get(1, &value, sizeof(value)));
+  }
+
+  //values survive a reopen
+  {
+    s_flash flash(num_sectors);
+    s_value value = {51.5f, -0.1f, 1};
+    bool flags[17] = {true, false, true};
+    {
+      c_kv_store_sim store(flash);
+      store.open();
+      store.set(1, &value, sizeof(value));
+      store.set(2, flags, sizeof(flags));
+      check("set is dirty", store.is_dirty() && flash.programs == 0);
+      check("commit", store.commit() && !store.is_dirty());
+    }
+    c_kv_store_sim store(flash);
+    s_value read = {};
+    bool read_flags[17] = {};
+    check("reopen", store.open());
+    check("values survive reopen", store.get(1, &read, sizeof(read)) && !memcmp(&read, &value, sizeof(value)) &&
+      store.get(2, read_flags, sizeof(read_flags)) && !memcmp(read_flags, flags, sizeof(flags)));
+    check("wrong size reads as missing", !store.get(1, &read, sizeof(read) - 4));
+    const uint32_t programs = flash.programs;
+    store.set(1, &value, sizeof(value));
+    check("same value is not a change", !store.is_dirty() && store.commit() && flash.programs == programs);
+    check("flash used correctly", !flash.misuse);
+  }
+
+  //lots of small changes, erases spread over every sector
+  {
+    s_flash flash(num_sectors);
+    c_kv_store_sim store(flash);
+    store.open();
+    const uint32_t num_commits = 10000;
+    s_value value = {};
+    for(uint32_t count = 0; count < num_commits; ++count)
+    {
+      value.count = count;
+      store.set(1, &value, sizeof(value));
+      if(!store.commit()) break;
+    }
+    c_kv_store_sim reopened(flash);
+    s_value read = {};
+    reopened.open();
+    check("last of many commits", reopened.get(1, &read, sizeof(read)) && read.count == num_commits-1);
+
+    uint32_t min_erases = flash.erases[0], max_erases = flash.erases[0], total = 0;
+    for(uint32_t erases : flash.erases)
+    {
+      if(erases < min_erases) min_erases = erases;
+      if(erases > max_erases) max_erases = erases;
+      total += erases;
+    }
+    printf("%u commits, %u erases, %u to %u per sector\n", num_commits, total, min_erases, max_erases);
+    check("erases are levelled", max_erases - min_erases <= 1);
+    check("about one erase per sector of records", total <= num_commits*(sizeof(value) + 8)/(c_kv_store::sector_size - 64) + 1);
+    check("flash used correctly", !flash.misuse);
+  }
+
+  //deferred commit
+  {
+    s_flash flash(num_sectors);
+    c_kv_store_sim store(flash);
+    store.open();
+    s_value value = {};
+    uint32_t now = 1000;
+    bool committed = false;
+    for(int change = 0; change < 20; ++change, now += 100)
+    {
+      value.count = change;
+      store.set(1, &value, sizeof(value));
+      committed |= store.poll(now);
+    }
+    check("no commit while changing", !committed && flash.programs == 0);
+    check("no commit before the delay", !store.poll(now + c_kv_store::commit_delay_ms - 200));
+    check("commit once settled", store.poll(now + c_kv_store::commit_delay_ms + 200) && !store.is_dirty());
+    check("nothing more to commit", !store.poll(now + 10000));
+    check("no commit to wake for", store.ms_until_commit(now + 10000) == 0xffffffff);
+  }
+
+  //a loop that redraws on every clock tick and only polls between redraws,
+  //sleeping until the next tick or the commit, as pico_planetarium.ino does
+  {
+    s_flash flash(num_sectors);
+    c_kv_store_sim store(flash);
+    store.open();
+    s_value value = {};
+    value.count = 1;
+    store.set(1, &value, sizeof(value));
+    const uint32_t changed = 1000;
+    uint32_t now = changed, next_tick = changed, passes = 0;
+    bool committed = false;
+    while(!committed && passes++ < 100)
+    {
+      if(now >= next_tick) next_tick += 1000;
+      else committed = store.poll(now);
+      uint32_t sleep_ms = next_tick - now;
+      const uint32_t commit_ms = store.ms_until_commit(now);
+      if(commit_ms < sleep_ms) sleep_ms = commit_ms;
+      printf("pass %u at %5u ms: %s, sleep %u ms\n", passes, now, committed?"committed":"waiting", sleep_ms);
+      now += sleep_ms;
+    }
+    check("commit with no further changes", committed && !store.is_dirty());
+    check("commit on time", now - changed <= c_kv_store::commit_delay_ms + 1000);
+  }
+
+  //power cut at every point of a run of commits, including compactions
+  {
+    int bad = 0, recovered_new = 0, trials = 0;
+    for(int32_t cut = 0; cut < 12*(int32_t)c_kv_store::sector_size; cut += 37)
+    {
+      s_flash flash(num_sectors);
+      s_value value = {};
+      {
+        c_kv_store_sim store(flash);
+        store.open();
+        for(value.count = 0; value.count < 150; ++value.count)
+        {
+          store.set(1, &value, sizeof(value));
+          store.commit();
+        }
+      }
+
+      //more commits, through a compaction, with the power failing part way
+      flash.bytes_until_power_cut = cut;
+      uint32_t last_committed = value.count - 1;
+      {
+        c_kv_store_sim store(flash);
+        store.open();
+        for(uint32_t more = 0; more < 100; ++more, ++value.count)
+        {
+          store.set(1, &value, sizeof(value));
+          if(!store.commit()) break;
+          last_committed = value.count;
+        }
+      }
+
+      //power back, the value must be one that was committed or being committed
+      flash.bytes_until_power_cut = -1;
+      c_kv_store_sim store(flash);
+      s_value read = {};
+      store.open();
+      const bool ok = store.get(1, &read, sizeof(read));
+      if(!ok || (read.count != last_committed && read.count != last_committed + 1)) bad++;
+      if(ok && read.count == last_committed + 1) recovered_new++;
+
+      //and the store must keep working
+      value.count = 1000;
+      store.set(1, &value, sizeof(value));
+      c_kv_store_sim again(flash);
+      if(!store.commit() || !again.open() || !again.get(1, &read, sizeof(read)) || read.count != 1000) bad++;
+      trials++;
+    }
+    printf("%d power cuts, %d recovered the value being written\n", trials, recovered_new);
+    check("power cuts never corrupt", bad == 0);
+  }
+
+  return failures;
+}
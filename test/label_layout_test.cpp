@@ -0,0 +1,81 @@
+//Place labels near the edges of the screen with c_label_layout and check
+//that the cells it claims agree with what draw_string actually draws
+
+#include <cstdio>
+#include <cstring>
+#include "../pico_planetarium/label_layout.h"
+#include "../pico_planetarium/font_8x5.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool pass)
+{
+  printf("%-40s %s\n", name, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+static const uint16_t width = 64;
+static const uint16_t height = 48;
+static uint16_t pixels[width*height];
+
+//pixels of a colour in a rectangle
+static int count(uint16_t colour, int x0, int y0, int x1, int y1)
+{
+  int n = 0;
+  for(int y = y0; y < y1; ++y)
+    for(int x = x0; x < x1; ++x)
+      n += pixels[y*width + x] == colour;
+  return n;
+}
+
+int main()
+{
+  c_frame_buffer frame_buffer(pixels, width, height);
+  c_label_layout labels(frame_buffer, width, height);
+  const uint16_t planet = 0xf800, star = 0x07e0;
+
+  //a planet near the top edge, its label starts above the screen
+  frame_buffer.clear(0);
+  labels.clear();
+  labels.add(10, -4, "Mars", planet, planet_label);
+  labels.draw(font_8x5);
+  check("label above the screen is clipped", count(planet, 0, 0, width, 4) > 0);
+
+  //and it still keeps lower priority labels off the part that is drawn
+  frame_buffer.clear(0);
+  labels.clear();
+  labels.add(10, -4, "Mars", planet, planet_label);
+  labels.add(12, 0, "Vega", star, star_label);
+  labels.draw(font_8x5);
+  check("clipped label blocks overlaps", count(star, 0, 0, width, height) == 0);
+
+  //one that is entirely above or left of the screen claims no cells
+  frame_buffer.clear(0);
+  labels.clear();
+  labels.add(0, -20, "Mars", planet, planet_label);
+  labels.add(-24, 0, "Moon", planet, planet_label);
+  labels.add(-18, 20, "Sun", planet, planet_label);
+  labels.add(0, 0, "Vega", star, star_label);
+  labels.add(0, 20, "Deneb", star, star_label);
+  labels.draw(font_8x5);
+  check("off screen labels drawn nowhere", count(planet, 0, 0, width, height) == 0);
+  check("off screen labels claim nothing", count(star, 0, 0, width, 8) > 0 && count(star, 0, 20, width, 28) > 0);
+
+  //a label hanging off the left edge only claims the cells it covers
+  frame_buffer.clear(0);
+  labels.clear();
+  labels.add(-18, 30, "Venus", planet, planet_label);
+  labels.add(16, 30, "Altair", star, star_label);
+  labels.draw(font_8x5);
+  check("label left of the screen is clipped", count(planet, 0, 30, 12, 38) > 0);
+  check("cells right of it are free", count(star, 16, 30, width, 38) > 0);
+
+  //and one hanging off the bottom right corner
+  frame_buffer.clear(0);
+  labels.clear();
+  labels.add(50, 44, "Jupiter", planet, planet_label);
+  labels.draw(font_8x5);
+  check("label off the corner is clipped", count(planet, 50, 44, width, height) > 0);
+
+  return failures;
+}
@@ -0,0 +1,168 @@
+//Stream frames through c_live_view into a reference decoder, and check the
+//viewer ends up with the same pixels, and that only changed tiles are sent
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../pico_planetarium/live_view.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool pass)
+{
+  printf("%-40s %s\n", name, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+class c_live_view_memory : public c_live_view
+{
+  public:
+  std::vector<uint8_t> stream;
+  c_live_view_memory(uint16_t width, uint16_t height):c_live_view(width, height){}
+
+  private:
+  bool stream_write(const uint8_t *data, uint32_t size)
+  {
+    stream.insert(stream.end(), data, data + size);
+    return true;
+  }
+};
+
+//what a viewer would do with the stream
+class c_viewer
+{
+  public:
+  uint16_t width = 0, height = 0;
+  std::vector<uint16_t> pixels;
+  int tiles = 0, frames = 0, observers = 0;
+  float field = 0;
+  double julian_date = 0;
+  uint32_t settings = 0;
+
+  static uint16_t get16(const uint8_t *p){return p[0] | p[1] << 8;}
+  static uint32_t get32(const uint8_t *p){return get16(p) | (uint32_t)get16(p+2) << 16;}
+
+  bool decode(const std::vector<uint8_t> &stream)
+  {
+    size_t idx = 0;
+    while(idx < stream.size())
+    {
+      const uint8_t *p = &stream[idx];
+      switch(p[0])
+      {
+        case live_view_size:
+          width = get16(p+1);
+          height = get16(p+3);
+          pixels.assign(width*height, 0);
+          idx += 5;
+          break;
+
+        case live_view_tile:
+        {
+          const uint16_t x = get16(p+1), y = get16(p+3);
+          const uint8_t w = p[5], h = p[6];
+          const uint16_t length = get16(p+7);
+          const uint8_t *data = p + 9, *end = data + length;
+          std::vector<uint16_t> tile;
+          while(data < end)
+          {
+            const uint8_t c = *data++;
+            if(c < 128) for(int i = 0; i <= c; ++i, data += 2) tile.push_back(get16(data));
+            else {tile.insert(tile.end(), c - 125, get16(data)); data += 2;}
+          }
+          if(tile.size() != (size_t)w*h) return false;
+          for(int row = 0; row < h; ++row) memcpy(&pixels[(y+row)*width + x], &tile[row*w], w*2);
+          tiles++;
+          idx += 9 + length;
+          break;
+        }
+
+        case live_view_frame:
+          frames++;
+          idx++;
+          break;
+
+        case live_view_observer:
+        {
+          uint32_t raw = get32(p+1);
+          memcpy(&field, &raw, 4);
+          uint64_t raw_date = get32(p+21) | (uint64_t)get32(p+25) << 32;
+          memcpy(&julian_date, &raw_date, 8);
+          settings = get32(p+29);
+          observers++;
+          idx += 33;
+          break;
+        }
+
+        default:
+          return false;
+      }
+    }
+    return true;
+  }
+};
+
+int main()
+{
+  const uint16_t width = 480, height = 320;
+  std::vector<uint16_t> frame(width*height, 0x0a28);
+
+  //sparse stars and a few lines, roughly what the sky looks like
+  srand(1);
+  for(int star = 0; star < 800; ++star) frame[rand()%(width*height)] = rand();
+  for(int x = 0; x < width; ++x) frame[(160 + (int)(40*sin(x*0.02)))*width + x] = 0x1f00;
+
+  c_live_view_memory live_view(width, height);
+  c_viewer viewer;
+
+  live_view.update(frame.data(), 1000000);
+  const size_t first_size = live_view.stream.size();
+  printf("first frame %zu bytes, raw %u bytes\n", first_size, width*height*2);
+  check("first frame decodes", viewer.decode(live_view.stream) && viewer.pixels == frame);
+  check("first frame is compressed", first_size < width*height*2/4);
+  check("first frame is complete", !live_view.pending());
+
+  //nothing changed, nothing sent
+  live_view.stream.clear();
+  live_view.update(frame.data(), 1000000);
+  check("unchanged frame sends nothing", live_view.stream.empty());
+
+  //change a small area, only the tiles it touches are sent
+  for(int y = 300; y < 310; ++y) for(int x = 250; x < 270; ++x) frame[y*width + x] = 0xffff;
+  live_view.stream.clear();
+  viewer.tiles = 0;
+  live_view.update(frame.data(), 1000000);
+  check("small change decodes", viewer.decode(live_view.stream) && viewer.pixels == frame);
+  printf("small change %zu bytes in %d tiles\n", live_view.stream.size(), viewer.tiles);
+  check("small change sends only its tiles", viewer.tiles == 4);
+
+  //noise is the worst case for the encoder, and a tight budget spreads the
+  //frame over several updates
+  for(auto &p : frame) p = rand();
+  int updates = 0;
+  do
+  {
+    live_view.stream.clear();
+    const uint32_t sent = live_view.update(frame.data(), 8192);
+    if(sent > 8192) check("update kept to budget", false);
+    viewer.decode(live_view.stream);
+    updates++;
+  } while(live_view.pending() && updates < 1000);
+  printf("noisy frame took %d updates\n", updates);
+  check("budgeted updates converge", viewer.pixels == frame);
+
+  //observer state for a mirroring renderer
+  s_observer observer = {};
+  observer.field = 42.5f;
+  observer.julian_date = 2460809.4166666665;
+  s_settings settings = {};
+  settings.planets = true;
+  live_view.stream.clear();
+  live_view.send_observer(observer, settings);
+  check("observer decodes", viewer.decode(live_view.stream) && viewer.field == 42.5f &&
+    viewer.julian_date == observer.julian_date && viewer.settings == 1u << 5);
+
+  return failures;
+}
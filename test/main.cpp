@@ -1,6 +1,7 @@
 #include "bmp_lib.h"
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 class c_bmp_writer_stdio : public c_bmp_writer
 {
@@ -23,11 +24,19 @@ class c_bmp_writer_stdio : public c_bmp_writer
     FILE* f;
 };
 
+#include "host_catalog.h"
 #include "../pico_planetarium/planetarium.h"
 #include "../pico_planetarium/frame_buffer.h"
+#include "../pico_planetarium/playback.h"
+#include "../pico_planetarium/catalog_blob.h"
 
 int main()
 {
+  if(!catalog_blob.attach(catalog_blob_data, catalog_blob_size))
+  {
+    fprintf(stderr, "catalog blob doesn't match catalog_blob.h\n");
+    return 1;
+  }
 
   const uint16_t width = 1280;
   const uint16_t height = 720;
@@ -69,42 +78,46 @@ int main()
     .ecliptic = true,
     .alt_az_grid = false,
     .ra_dec_grid = false,
+    .antialiased_lines = false,
+    .proper_motion = true,
   };
 
   c_frame_buffer frame_buffer((uint16_t*)image, width, height);
   c_planetarium planetarium(frame_buffer, width, height);
 
-  uint16_t count = 0;
-  for(uint8_t hour = 0; hour < 24; hour ++)
-  {
-    for(uint8_t minute = 0; minute < 59; minute +=2)
-    {
+  //use a tiled catalog from model/make_star_tiles.py if there is one
+  c_star_catalog_mmap star_catalog;
+  if(star_catalog.open("stars.bin")) planetarium.set_star_catalog(&star_catalog);
 
-      observer.hour = hour;
-      observer.min = minute;
+  //animate one day at 3600x, 30 frames per second of playback
+  c_playback playback;
+  playback.start(observer, playback_3600x);
+  const float frame_time = 1.0f/30.0f;
 
-      char filename[20];
-      snprintf(filename, 20, "frame_%03u.bmp", count++);
-      output_file.open(filename, width, height);
+  for(uint16_t count = 0; count < 717; count++)
+  {
 
-      planetarium.update(observer, settings);
+    char filename[20];
+    snprintf(filename, 20, "frame_%03u.bmp", count);
+    output_file.open(filename, width, height);
 
-      for(uint16_t y=0; y<height; y++)
+    planetarium.update(observer, settings);
+
+    for(uint16_t y=0; y<height; y++)
+    {
+      uint16_t row[width];
+      for(uint16_t x=0; x<width; x++)
       {
-        uint16_t row[width];
-        for(uint16_t x=0; x<width; x++)
-        {
-          uint16_t pixel = image[y][x];
-          pixel = ((pixel & 0xff) << 8) | ((pixel & 0xff00) >> 8); 
-          row[x] = pixel;
-        }
-        output_file.write_row_rgb565(row);
+        uint16_t pixel = image[y][x];
+        pixel = ((pixel & 0xff) << 8) | ((pixel & 0xff00) >> 8); 
+        row[x] = pixel;
       }
-      output_file.close();
-
-      printf("%u %u %u\n", count, hour, minute);
-      if(hour == 23 && minute == 52) return 0;
+      output_file.write_row_rgb565(row);
     }
+    output_file.close();
+
+    printf("%u %u %u\n", count+1, observer.hour, observer.min);
+    playback.advance(frame_time, observer);
   }
 
   return 0;
@@ -0,0 +1,168 @@
+//Drive c_remote_api with raw HTTP requests, through a stand-in for the
+//socket and the request parsing that WebServer does on the device
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../pico_planetarium/remote_api.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool pass)
+{
+  printf("%-40s %s\n", name, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+static std::string url_decode(const std::string &text)
+{
+  std::string decoded;
+  for(size_t idx = 0; idx < text.size(); ++idx)
+  {
+    if(text[idx] == '+') decoded += ' ';
+    else if(text[idx] == '%' && idx + 2 < text.size())
+    {
+      decoded += (char)strtol(text.substr(idx + 1, 2).c_str(), nullptr, 16);
+      idx += 2;
+    }
+    else decoded += text[idx];
+  }
+  return decoded;
+}
+
+class c_mock_socket
+{
+  c_remote_api &api;
+
+  public:
+
+  c_mock_socket(c_remote_api &api):api(api){}
+
+  //one request in, one response out, as a client would see it
+  std::string exchange(const std::string &request)
+  {
+    const size_t line_end = request.find("\r\n");
+    const size_t space1 = request.find(' ');
+    const size_t space2 = request.find(' ', space1 + 1);
+    if(line_end == std::string::npos || space2 > line_end) return "HTTP/1.1 400 Bad Request\r\n\r\n";
+    const std::string method = request.substr(0, space1);
+    std::string uri = request.substr(space1 + 1, space2 - space1 - 1);
+
+    //arguments from the query string and a form body, like WebServer
+    std::string form;
+    const size_t query = uri.find('?');
+    if(query != std::string::npos)
+    {
+      form = uri.substr(query + 1);
+      uri = uri.substr(0, query);
+    }
+    const size_t body = request.find("\r\n\r\n");
+    if(body != std::string::npos && body + 4 < request.size())
+    {
+      form += (form.empty() ? "" : "&") + request.substr(body + 4);
+    }
+
+    std::vector<std::string> names, values;
+    size_t start = 0;
+    while(start < form.size())
+    {
+      size_t end = form.find('&', start);
+      if(end == std::string::npos) end = form.size();
+      const std::string pair = form.substr(start, end - start);
+      const size_t equals = pair.find('=');
+      names.push_back(url_decode(pair.substr(0, equals)));
+      values.push_back(equals == std::string::npos ? "" : url_decode(pair.substr(equals + 1)));
+      start = end + 1;
+    }
+    std::vector<s_api_arg> args;
+    for(size_t idx = 0; idx < names.size(); ++idx) args.push_back({names[idx].c_str(), values[idx].c_str()});
+
+    const e_api_method api_method = method == "GET" ? api_get : method == "POST" ? api_post : api_other;
+    char response[512];
+    const uint16_t status = api.handle(api_method, uri.c_str(), args.data(), args.size(), response, sizeof(response));
+    return "HTTP/1.1 " + std::to_string(status) + "\r\nContent-Type: application/json\r\n\r\n" + response;
+  }
+};
+
+static bool has(const std::string &response, const char *text)
+{
+  return response.find(text) != std::string::npos;
+}
+
+int main()
+{
+  s_observer observer = {};
+  observer.field = 60.0f;
+  observer.latitude = 51.5f;
+  s_settings settings = {};
+  c_remote_api api(observer, settings);
+  api.set_time(1750000000.0, true);
+  c_mock_socket socket(api);
+  std::string response;
+
+  response = socket.exchange("GET /api/observer HTTP/1.1\r\nHost: pico\r\n\r\n");
+  check("get observer", has(response, "HTTP/1.1 200") && has(response, "\"latitude\":51.5000") && has(response, "\"internet_time\":true"));
+  check("get changes nothing", api.take_changes() == 0);
+
+  //several fields in one request, and another request, are one render
+  response = socket.exchange("POST /api/observer?latitude=-33.9&longitude=18.4 HTTP/1.1\r\n\r\n");
+  check("post observer", has(response, "HTTP/1.1 200") && has(response, "\"latitude\":-33.9000"));
+  response = socket.exchange("POST /api/observer HTTP/1.1\r\nContent-Type: application/x-www-form-urlencoded\r\n\r\nalt=45&az=180&field=30");
+  check("post observer form body", has(response, "HTTP/1.1 200") && observer.az == 180.0f && observer.field == 30.0f);
+  check("changes are batched", api.take_changes() == api_observer_changed && api.take_changes() == 0);
+
+  //all or nothing
+  response = socket.exchange("POST /api/observer?latitude=10&alt=91 HTTP/1.1\r\n\r\n");
+  check("out of range rejected", has(response, "HTTP/1.1 400") && has(response, "alt"));
+  response = socket.exchange("POST /api/observer?latitude=abc HTTP/1.1\r\n\r\n");
+  check("not a number rejected", has(response, "HTTP/1.1 400"));
+  response = socket.exchange("POST /api/observer?height=10 HTTP/1.1\r\n\r\n");
+  check("unknown field rejected", has(response, "HTTP/1.1 400") && has(response, "height"));
+  check("rejected requests change nothing", observer.latitude == -33.9f && api.take_changes() == 0);
+
+  response = socket.exchange("POST /api/observer?latitude=-33.9 HTTP/1.1\r\n\r\n");
+  check("same value is not a change", has(response, "HTTP/1.1 200") && api.take_changes() == 0);
+
+  //settings
+  response = socket.exchange("POST /api/settings?star_names=toggle&planets=1&ecliptic=off HTTP/1.1\r\n\r\n");
+  check("post settings", has(response, "HTTP/1.1 200") && has(response, "\"star_names\":true") && has(response, "\"planets\":true"));
+  check("settings applied", settings.star_names && settings.planets && !settings.ecliptic);
+  check("settings change", api.take_changes() == api_settings_changed);
+  response = socket.exchange("POST /api/settings?star_names=toggle&stars=1 HTTP/1.1\r\n\r\n");
+  check("unknown setting rejected", has(response, "HTTP/1.1 400") && settings.star_names);
+  response = socket.exchange("POST /api/settings?moon=maybe HTTP/1.1\r\n\r\n");
+  check("bad flag rejected", has(response, "HTTP/1.1 400") && api.take_changes() == 0);
+  response = socket.exchange("GET /api/settings HTTP/1.1\r\n\r\n");
+  check("get settings", has(response, "\"proper_motion\":false}"));
+
+  //time
+  response = socket.exchange("POST /api/time?offset=3600 HTTP/1.1\r\n\r\n");
+  check("jump time", has(response, "HTTP/1.1 200") && !api.internet_time_requested() && api.requested_time() == 1750003600.0);
+  response = socket.exchange("POST /api/time?julian_date=2451545.0 HTTP/1.1\r\n\r\n");
+  check("set julian date", api.requested_time() == 946728000.0 && api.take_changes() == api_time_changed);
+  response = socket.exchange("POST /api/time?unix=-5 HTTP/1.1\r\n\r\n");
+  check("time before 1970 rejected", has(response, "HTTP/1.1 400"));
+  response = socket.exchange("POST /api/time?ntp=1 HTTP/1.1\r\n\r\n");
+  check("back to internet time", api.internet_time_requested() && api.take_changes() == api_time_changed);
+  response = socket.exchange("GET /api/time HTTP/1.1\r\n\r\n");
+  check("get time not allowed", has(response, "HTTP/1.1 405"));
+
+  //profile
+  api.profile.frames = 12;
+  api.profile.render_us = 45000;
+  response = socket.exchange("GET /api/profile HTTP/1.1\r\n\r\n");
+  check("get profile", has(response, "\"frames\":12") && has(response, "\"render_us\":45000"));
+
+  response = socket.exchange("GET /api/stars HTTP/1.1\r\n\r\n");
+  check("unknown path", has(response, "HTTP/1.1 404"));
+  response = socket.exchange("DELETE /api/observer HTTP/1.1\r\n\r\n");
+  check("unknown method", has(response, "HTTP/1.1 405"));
+
+  //a response that doesn't fit is an error, not a truncated document
+  char small[64];
+  check("response too long", api.handle(api_get, "/api/settings", nullptr, 0, small, sizeof(small)) == 500);
+
+  return failures;
+}
@@ -0,0 +1,740 @@
+//Long running sky chart renderer, so charts don't pay for process start up
+//and catalog loading every time.
+//
+//  ./render_server [--threads n] [--socket path] [--blob file] [--stars stars.bin]
+//                  [--cache-mb n]
+//
+//Requests are read from stdin, or from each connection to a unix socket,
+//one per line as space separated key=value pairs:
+//
+//  id=<text>             echoed in the reply
+//  width=, height=       pixels, 16 to 4096 (default 1280x720)
+//  format=               bmp, ppm or rgb565 (raw, little endian)
+//  field=, alt=, az=     view in degrees
+//  lat=, lon=            location in degrees
+//  mag=                  faintest star magnitude
+//  jd= or unix=          time, as a julian date or seconds since 1970
+//                        (default now)
+//  settings=<hex>        one bit per s_settings field in declaration order,
+//                        as the live view observer message
+//  out=<file>            write the image there instead of in the reply
+//
+//Each reply is one line, "ok id=.. format=.. bytes=n cached=0|1
+//render_ms=.. latency_ms=..", followed by n bytes of image unless out= was
+//given, or "error id=.. <reason>". Requests are spread over a pool of
+//threads, so replies can come back in a different order, match them up by
+//id. The line "stats" replies with throughput, latency and cache figures.
+//
+//Each worker renders into a warm c_planetarium taken from a pool, keyed on
+//resolution, so frame buffers and the pose are reused. Its time dependent
+//caches are cleared first, so a chart only depends on its request and not
+//on what that renderer drew before. Nothing else is shared between renders
+//except the catalog blob and the mapped star catalog, which are only read.
+//
+//Charts that would look the same are only rendered once, see
+//quantise(). Encoded charts are kept in an LRU cache of --cache-mb
+//megabytes (default 256, 0 turns it off).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <list>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "bmp_lib.h"
+#include "host_catalog.h"
+#include "../pico_planetarium/planetarium.h"
+#include "../pico_planetarium/frame_buffer.h"
+#include "../pico_planetarium/catalog_blob.h"
+
+typedef std::chrono::steady_clock clock_type;
+
+static double ms_since(clock_type::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+//replies go back to where the request came from, stdout or a socket
+class c_connection
+{
+  int read_fd;
+  int write_fd;
+  bool owned;
+  std::mutex mutex;
+
+  public:
+
+  c_connection(int read_fd, int write_fd, bool owned):read_fd(read_fd), write_fd(write_fd), owned(owned){}
+  ~c_connection(){if(owned) close(read_fd);}
+
+  void send(const std::string &line, const std::vector<uint8_t> &payload = {})
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    write_all(line.data(), line.size());
+    write_all(payload.data(), payload.size());
+  }
+
+  //false at the end of the input
+  bool read_line(std::string &line)
+  {
+    line.clear();
+    char c;
+    while(true)
+    {
+      const ssize_t n = read(read_fd, &c, 1);
+      if(n <= 0) return !line.empty();
+      if(c == '\n') return true;
+      if(c != '\r') line += c;
+    }
+  }
+
+  private:
+
+  void write_all(const void *data, size_t size)
+  {
+    const uint8_t *p = (const uint8_t*)data;
+    while(size)
+    {
+      const ssize_t n = write(write_fd, p, size);
+      if(n <= 0) return;
+      p += n;
+      size -= n;
+    }
+  }
+};
+
+enum e_format {format_bmp, format_ppm, format_rgb565};
+static const char * const format_names[] = {"bmp", "ppm", "rgb565"};
+
+struct s_request
+{
+  std::string id;
+  uint16_t width = 1280;
+  uint16_t height = 720;
+  e_format format = format_bmp;
+  s_observer observer;
+  s_settings settings;
+  std::string out;
+  std::shared_ptr<c_connection> connection;
+  clock_type::time_point received;
+};
+
+//same defaults as main.cpp
+static s_request default_request()
+{
+  s_request request;
+  request.observer = {};
+  request.observer.field = 90.0f;
+  request.observer.alt = 30.0f;
+  request.observer.az = 180.0f;
+  request.observer.smallest_magnitude = 8.0f;
+  request.observer.latitude = 51.0f;
+  request.observer.longitude = 0.0f;
+  request.observer.julian_date = unix_to_julian_date(
+    std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+  request.settings = {};
+  request.settings.constellation_lines = true;
+  request.settings.constellation_names = true;
+  request.settings.planets = true;
+  request.settings.sun = true;
+  request.settings.ecliptic = true;
+  request.settings.proper_motion = true;
+  return request;
+}
+
+static bool parse_number(const std::string &text, double &value)
+{
+  char *end;
+  value = strtod(text.c_str(), &end);
+  return !text.empty() && *end == 0;
+}
+
+//returns an empty string, or what was wrong with the request
+static std::string parse_request(const std::string &line, s_request &request)
+{
+  std::istringstream fields(line);
+  std::string field;
+  while(fields >> field)
+  {
+    const size_t equals = field.find('=');
+    if(equals == std::string::npos) return "expected key=value: " + field;
+    const std::string key = field.substr(0, equals);
+    const std::string text = field.substr(equals + 1);
+    double value = 0.0;
+    const bool is_number = parse_number(text, value);
+
+    if(key == "id") request.id = text;
+    else if(key == "out") request.out = text;
+    else if(key == "format")
+    {
+      const char * const *name = std::find_if(std::begin(format_names), std::end(format_names),
+        [&](const char *n){return text == n;});
+      if(name == std::end(format_names)) return "unknown format " + text;
+      request.format = (e_format)(name - format_names);
+    }
+    else if(key == "settings")
+    {
+      char *end;
+      const unsigned long bits = strtoul(text.c_str(), &end, 16);
+      if(text.empty() || *end) return "bad settings " + text;
+      bool *flags = (bool*)&request.settings;
+      for(uint8_t idx = 0; idx < sizeof(s_settings); ++idx) flags[idx] = (bits >> idx) & 1;
+    }
+    else if(!is_number) return "bad value for " + key;
+    else if(key == "width" || key == "height")
+    {
+      if(value < 16 || value > 4096) return key + " out of range";
+      (key == "width" ? request.width : request.height) = value;
+    }
+    else if(key == "field") request.observer.field = value;
+    else if(key == "alt") request.observer.alt = value;
+    else if(key == "az") request.observer.az = value;
+    else if(key == "lat") request.observer.latitude = value;
+    else if(key == "lon") request.observer.longitude = value;
+    else if(key == "mag") request.observer.smallest_magnitude = value;
+    else if(key == "jd") request.observer.julian_date = value;
+    else if(key == "unix") request.observer.julian_date = unix_to_julian_date(value);
+    else return "unknown key " + key;
+  }
+  if(request.observer.field <= 0.0f || request.observer.field > 180.0f) return "field out of range";
+  return "";
+}
+
+//encoders take the frame buffer, which is RGB565 with the bytes swapped
+
+class c_bmp_writer_memory : public c_bmp_writer
+{
+  public:
+  std::vector<uint8_t> &data;
+  c_bmp_writer_memory(std::vector<uint8_t> &data):data(data){}
+
+  private:
+  bool file_open(const char *filename){return true;}
+  void file_close(){}
+  void file_write(const void *p, uint32_t element_size, uint32_t num_elements)
+  {
+    data.insert(data.end(), (const uint8_t*)p, (const uint8_t*)p + element_size*num_elements);
+  }
+};
+
+static void encode(const uint16_t *pixels, uint16_t width, uint16_t height, e_format format, std::vector<uint8_t> &data)
+{
+  data.clear();
+  std::vector<uint16_t> row(width);
+  if(format == format_bmp)
+  {
+    data.reserve(54 + ((width*3 + 3) & ~3)*height);
+    c_bmp_writer_memory writer(data);
+    writer.open("", width, height);
+    for(uint16_t y = 0; y < height; ++y)
+    {
+      for(uint16_t x = 0; x < width; ++x) row[x] = __builtin_bswap16(pixels[y*width + x]);
+      writer.write_row_rgb565(row.data());
+    }
+    writer.close();
+  }
+  else if(format == format_ppm)
+  {
+    char header[32];
+    const int length = snprintf(header, sizeof(header), "P6\n%u %u\n255\n", width, height);
+    data.assign(header, header + length);
+    data.reserve(length + width*height*3);
+    for(uint32_t idx = 0; idx < (uint32_t)width*height; ++idx)
+    {
+      const uint16_t pixel = __builtin_bswap16(pixels[idx]);
+      data.push_back((pixel >> 11) << 3);
+      data.push_back(((pixel >> 5) & 0x3f) << 2);
+      data.push_back((pixel & 0x1f) << 3);
+    }
+  }
+  else
+  {
+    data.resize((uint32_t)width*height*2);
+    for(uint32_t idx = 0; idx < (uint32_t)width*height; ++idx)
+    {
+      const uint16_t pixel = __builtin_bswap16(pixels[idx]);
+      data[idx*2] = pixel;
+      data[idx*2 + 1] = pixel >> 8;
+    }
+  }
+}
+
+//a planetarium with its own frame buffer, kept warm between requests
+struct s_renderer
+{
+  uint16_t width, height;
+  std::vector<uint16_t> pixels;
+  c_frame_buffer frame_buffer;
+  c_planetarium planetarium;
+  uint64_t last_used = 0;
+
+  s_renderer(uint16_t width, uint16_t height):
+    width(width), height(height), pixels((uint32_t)width*height),
+    frame_buffer(pixels.data(), width, height), planetarium(frame_buffer, width, height){}
+};
+
+class c_renderer_pool
+{
+  std::mutex mutex;
+  std::vector<std::unique_ptr<s_renderer>> idle;
+  size_t max_idle;
+  uint64_t clock = 0;
+  c_star_catalog *star_catalog;
+
+  public:
+
+  std::atomic<uint32_t> cold_starts{0};
+
+  c_renderer_pool(size_t max_idle, c_star_catalog *star_catalog):max_idle(max_idle), star_catalog(star_catalog){}
+
+  std::unique_ptr<s_renderer> acquire(uint16_t width, uint16_t height)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for(auto it = idle.begin(); it != idle.end(); ++it)
+      {
+        if((*it)->width != width || (*it)->height != height) continue;
+        std::unique_ptr<s_renderer> renderer = std::move(*it);
+        idle.erase(it);
+        return renderer;
+      }
+    }
+    cold_starts++;
+    std::unique_ptr<s_renderer> renderer(new s_renderer(width, height));
+    if(star_catalog) renderer->planetarium.set_star_catalog(star_catalog);
+    return renderer;
+  }
+
+  void release(std::unique_ptr<s_renderer> renderer)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    renderer->last_used = ++clock;
+    idle.push_back(std::move(renderer));
+
+    //drop the least recently used once there are too many resolutions
+    if(idle.size() > max_idle)
+    {
+      auto oldest = std::min_element(idle.begin(), idle.end(),
+        [](const std::unique_ptr<s_renderer> &a, const std::unique_ptr<s_renderer> &b){return a->last_used < b->last_used;});
+      idle.erase(oldest);
+    }
+  }
+
+  size_t num_idle()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle.size();
+  }
+};
+
+//Requests that differ by less than can be seen share a cache entry.
+//Everything that moves the sky is rounded to a quarter of a pixel at the
+//centre of the view, where the orthographic projection is most sensitive,
+//so each value moves the chart by an eighth of a pixel at most. The field
+//is rounded on a log scale, so the corners move by a quarter of a pixel at
+//most. The chart is rendered from the rounded values, so an entry never
+//depends on which of its requests came first.
+struct s_render_key
+{
+  uint16_t width, height;
+  uint8_t format;
+  uint32_t settings;
+  int32_t field, alt, az, latitude, longitude, magnitude;
+  int64_t time;
+
+  bool operator==(const s_render_key &other) const
+  {
+    return width == other.width && height == other.height && format == other.format &&
+      settings == other.settings && field == other.field && alt == other.alt && az == other.az &&
+      latitude == other.latitude && longitude == other.longitude && magnitude == other.magnitude &&
+      time == other.time;
+  }
+};
+
+struct s_render_key_hash
+{
+  size_t operator()(const s_render_key &key) const
+  {
+    //FNV-1a over the fields, not the struct, so padding doesn't matter
+    uint64_t hash = 14695981039346656037ull;
+    auto add = [&](uint64_t value){hash = (hash ^ value)*1099511628211ull;};
+    add(key.width); add(key.height); add(key.format); add(key.settings);
+    add(key.field); add(key.alt); add(key.az); add(key.latitude); add(key.longitude);
+    add(key.magnitude); add(key.time);
+    return hash;
+  }
+};
+
+static s_render_key quantise(s_request &request)
+{
+  s_observer &observer = request.observer;
+  s_render_key key;
+  key.width = request.width;
+  key.height = request.height;
+  key.format = request.format;
+
+  key.settings = 0;
+  const bool *flags = (const bool*)&request.settings;
+  for(uint8_t idx = 0; idx < sizeof(s_settings); ++idx) key.settings |= (uint32_t)flags[idx] << idx;
+
+  //a relative change of 1/(width+height) moves the corners by half a pixel
+  const double field_step = 1.0/(request.width + request.height);
+  key.field = lround(log(observer.field)/field_step);
+  observer.field = exp(key.field*field_step);
+
+  //degrees per pixel at the centre, quarter pixel steps
+  const double step = 0.25*(180.0/M_PI)*2.0*sin(observer.field*M_PI/360.0)/request.height;
+  auto round_to_step = [&](float &value, double step){
+    const int32_t idx = lround(value/step);
+    value = idx*step;
+    return idx;
+  };
+  key.alt = round_to_step(observer.alt, step);
+  key.az = round_to_step(observer.az, step);
+  key.latitude = round_to_step(observer.latitude, step);
+  key.longitude = round_to_step(observer.longitude, step);
+  key.magnitude = round_to_step(observer.smallest_magnitude, 0.01);
+
+  //the sky turns 360.9856 degrees a day, faster than anything moves across it
+  const double days = step/360.98564736629;
+  key.time = llround(observer.julian_date/days);
+  observer.julian_date = key.time*days;
+  return key;
+}
+
+typedef std::shared_ptr<const std::vector<uint8_t>> t_chart;
+
+class c_render_cache
+{
+  std::mutex mutex;
+  std::list<std::pair<s_render_key, t_chart>> entries; //most recently used first
+  std::unordered_map<s_render_key, decltype(entries)::iterator, s_render_key_hash> index;
+  size_t capacity;
+  size_t bytes = 0;
+  uint64_t hits = 0, misses = 0, evictions = 0;
+
+  public:
+
+  c_render_cache(size_t capacity):capacity(capacity){}
+
+  t_chart find(const s_render_key &key)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if(it == index.end())
+    {
+      misses++;
+      return nullptr;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+  }
+
+  void insert(const s_render_key &key, t_chart chart)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(chart->size() > capacity || index.count(key)) return;
+    entries.emplace_front(key, chart);
+    index[key] = entries.begin();
+    bytes += chart->size();
+    while(bytes > capacity)
+    {
+      bytes -= entries.back().second->size();
+      index.erase(entries.back().first);
+      entries.pop_back();
+      evictions++;
+    }
+  }
+
+  std::string report()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    char line[256];
+    snprintf(line, sizeof(line), "cache_hits=%llu cache_misses=%llu cache_hit_rate=%.3f cache_entries=%zu cache_mb=%.1f cache_evictions=%llu",
+      (unsigned long long)hits, (unsigned long long)misses, hits + misses ? (double)hits/(hits + misses) : 0.0,
+      index.size(), bytes/1048576.0, (unsigned long long)evictions);
+    return line;
+  }
+};
+
+class c_stats
+{
+  std::mutex mutex;
+  clock_type::time_point start = clock_type::now();
+  uint64_t requests = 0;
+  uint64_t renders = 0;
+  uint64_t errors = 0;
+  double queue_ms = 0.0, render_ms = 0.0, encode_ms = 0.0;
+  std::vector<double> latencies; //the most recent, for percentiles
+  size_t next_latency = 0;
+  static const size_t max_latencies = 4096;
+
+  public:
+
+  void error()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    errors++;
+  }
+
+  //render and encode times are only for charts that weren't in the cache
+  void record(double queue, bool rendered, double render, double encode, double latency)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    requests++;
+    queue_ms += queue;
+    if(rendered)
+    {
+      renders++;
+      render_ms += render;
+      encode_ms += encode;
+    }
+    if(latencies.size() < max_latencies) latencies.push_back(latency);
+    else latencies[next_latency++ % max_latencies] = latency;
+  }
+
+  std::string report(uint32_t cold_starts, size_t idle_renderers, const std::string &cache)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<double> sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&](double p){return sorted.empty() ? 0.0 : sorted[std::min(sorted.size()-1, (size_t)(p*sorted.size()))];};
+    const double uptime = ms_since(start)*1.0e-3;
+    const double n = requests ? requests : 1;
+    const double r = renders ? renders : 1;
+
+    char line[768];
+    snprintf(line, sizeof(line),
+      "stats requests=%llu renders=%llu errors=%llu cold_starts=%u idle_renderers=%zu uptime_s=%.1f charts_per_s=%.2f "
+      "queue_ms=%.2f render_ms=%.2f encode_ms=%.2f latency_ms_p50=%.2f latency_ms_p95=%.2f latency_ms_p99=%.2f latency_ms_max=%.2f %s\n",
+      (unsigned long long)requests, (unsigned long long)renders, (unsigned long long)errors, cold_starts, idle_renderers,
+      uptime, requests/uptime, queue_ms/n, render_ms/r, encode_ms/r, percentile(0.5), percentile(0.95), percentile(0.99),
+      sorted.empty() ? 0.0 : sorted.back(), cache.c_str());
+    return line;
+  }
+};
+
+class c_render_server
+{
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::condition_variable drained;
+  std::deque<s_request> queue;
+  uint32_t busy = 0;
+  bool stopping = false;
+  std::vector<std::thread> workers;
+  c_renderer_pool pool;
+  c_render_cache cache;
+  c_stats stats;
+
+  public:
+
+  c_render_server(uint32_t num_threads, c_star_catalog *star_catalog, size_t cache_bytes):
+    pool(num_threads*2, star_catalog), cache(cache_bytes)
+  {
+    for(uint32_t idx = 0; idx < num_threads; ++idx) workers.emplace_back(&c_render_server::worker, this);
+  }
+
+  ~c_render_server()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    ready.notify_all();
+    for(std::thread &worker : workers) worker.join();
+  }
+
+  //handle every request from a connection until it closes
+  void serve(std::shared_ptr<c_connection> connection)
+  {
+    std::string line;
+    while(connection->read_line(line))
+    {
+      if(line.empty()) continue;
+      if(line == "stats")
+      {
+        connection->send(report());
+        continue;
+      }
+
+      s_request request = default_request();
+      const std::string problem = parse_request(line, request);
+      if(!problem.empty())
+      {
+        stats.error();
+        connection->send("error id=" + request.id + " " + problem + "\n");
+        continue;
+      }
+      request.connection = connection;
+      request.received = clock_type::now();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(request));
+      }
+      ready.notify_one();
+    }
+  }
+
+  void wait_until_idle()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    drained.wait(lock, [&]{return queue.empty() && !busy;});
+  }
+
+  std::string report()
+  {
+    return stats.report(pool.cold_starts, pool.num_idle(), cache.report());
+  }
+
+  private:
+
+  void worker()
+  {
+    while(true)
+    {
+      s_request request;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [&]{return stopping || !queue.empty();});
+        if(queue.empty()) return;
+        request = std::move(queue.front());
+        queue.pop_front();
+        busy++;
+      }
+
+      const double queue_ms = ms_since(request.received);
+      const s_render_key key = quantise(request);
+      t_chart chart = cache.find(key);
+      const bool rendered = !chart;
+      double render_ms = 0.0, encode_ms = 0.0;
+      if(rendered)
+      {
+        std::unique_ptr<s_renderer> renderer = pool.acquire(request.width, request.height);
+        const clock_type::time_point render_start = clock_type::now();
+        renderer->planetarium.invalidate_caches();
+        renderer->planetarium.update(request.observer, request.settings);
+        render_ms = ms_since(render_start);
+        const clock_type::time_point encode_start = clock_type::now();
+        std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>();
+        encode(renderer->pixels.data(), request.width, request.height, request.format, *data);
+        encode_ms = ms_since(encode_start);
+        pool.release(std::move(renderer));
+        chart = data;
+        cache.insert(key, chart);
+      }
+
+      const std::vector<uint8_t> no_payload;
+      const std::vector<uint8_t> *payload = chart.get();
+      if(!request.out.empty())
+      {
+        FILE *f = fopen(request.out.c_str(), "wb");
+        const bool written = f && fwrite(chart->data(), 1, chart->size(), f) == chart->size();
+        if(f) fclose(f);
+        if(!written)
+        {
+          stats.error();
+          request.connection->send("error id=" + request.id + " can't write " + request.out + "\n");
+          finished();
+          continue;
+        }
+        payload = &no_payload;
+      }
+
+      const double latency_ms = ms_since(request.received);
+      char line[256];
+      snprintf(line, sizeof(line), "ok id=%s format=%s bytes=%zu cached=%d render_ms=%.2f latency_ms=%.2f\n",
+        request.id.c_str(), format_names[request.format], payload->size(), !rendered, render_ms, latency_ms);
+      request.connection->send(line, *payload);
+      stats.record(queue_ms, rendered, render_ms, encode_ms, latency_ms);
+      finished();
+    }
+  }
+
+  void finished()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    busy--;
+    if(queue.empty() && !busy) drained.notify_all();
+  }
+};
+
+int main(int argc, char **argv)
+{
+  uint32_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+  const char *socket_path = nullptr;
+  const char *blob_path = nullptr;
+  const char *stars_path = nullptr;
+  size_t cache_mb = 256;
+  for(int arg = 1; arg + 1 < argc; arg += 2)
+  {
+    if(!strcmp(argv[arg], "--threads")) num_threads = std::max(1, atoi(argv[arg+1]));
+    else if(!strcmp(argv[arg], "--socket")) socket_path = argv[arg+1];
+    else if(!strcmp(argv[arg], "--blob")) blob_path = argv[arg+1];
+    else if(!strcmp(argv[arg], "--stars")) stars_path = argv[arg+1];
+    else if(!strcmp(argv[arg], "--cache-mb")) cache_mb = atoi(argv[arg+1]);
+    else
+    {
+      fprintf(stderr, "usage: %s [--threads n] [--socket path] [--blob file] [--stars stars.bin] [--cache-mb n]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  //loaded once, and only read from then on, built in unless another blob is given
+  if(blob_path ? !attach_catalog_blob(blob_path) : !catalog_blob.attach(catalog_blob_data, catalog_blob_size))
+  {
+    fprintf(stderr, "can't load %s\n", blob_path ? blob_path : "the built in catalog blob");
+    return 1;
+  }
+  c_star_catalog_mmap star_catalog;
+  if(stars_path && !star_catalog.open(stars_path))
+  {
+    fprintf(stderr, "can't load %s\n", stars_path);
+    return 1;
+  }
+
+  c_render_server server(num_threads, stars_path ? &star_catalog : nullptr, cache_mb*1048576);
+
+  if(!socket_path)
+  {
+    //stdin until it closes, replies on stdout
+    server.serve(std::make_shared<c_connection>(STDIN_FILENO, STDOUT_FILENO, false));
+    server.wait_until_idle();
+    fprintf(stderr, "%s", server.report().c_str());
+    return 0;
+  }
+
+  const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, socket_path, sizeof(address.sun_path) - 1);
+  unlink(socket_path);
+  if(listener < 0 || bind(listener, (sockaddr*)&address, sizeof(address)) || listen(listener, 16))
+  {
+    perror(socket_path);
+    return 1;
+  }
+  fprintf(stderr, "listening on %s with %u threads\n", socket_path, num_threads);
+
+  while(true)
+  {
+    const int fd = accept(listener, nullptr, nullptr);
+    if(fd < 0) continue;
+    std::thread(&c_render_server::serve, &server, std::make_shared<c_connection>(fd, fd, true)).detach();
+  }
+}
@@ -0,0 +1,174 @@
+//Run the SNTP client against a stand-in server on a local UDP socket. Time
+//is simulated so hours of polling run in a moment: the server answers with
+//"true" time, while the client's timer runs fast like a poor crystal.
+
+#include <arpa/inet.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../pico_planetarium/sntp_clock.h"
+
+static int failures = 0;
+
+static void check(const char *name, double value, double bound)
+{
+  bool pass = fabs(value) < bound;
+  printf("%-28s %.6g (bound %.3g) %s\n", name, value, bound, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+//simulated true time, microseconds
+static uint64_t true_us = 0;
+static const double start_time = 1747094400.0; //2025-05-13
+static const double crystal_error = 37.0e-6; //local timer runs 37ppm fast
+static const double network_delay = 0.015; //each way, seconds
+
+//the server's time jumps by server_step after 6 hours, which the client
+//should slew out rather than step
+static const double server_step = 0.2;
+static const uint64_t step_at_us = 6*3600*1000000ull;
+
+static double true_time()
+{
+  return start_time + true_us*1.0e-6 + (true_us >= step_at_us ? server_step : 0.0);
+}
+
+static int bind_socket(sockaddr_in &address)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  bind(fd, (sockaddr*)&address, sizeof(address));
+  socklen_t length = sizeof(address);
+  getsockname(fd, (sockaddr*)&address, &length);
+  return fd;
+}
+
+static void write_timestamp(uint8_t *data, double unix_time)
+{
+  const double ntp_time = unix_time + 2208988800.0;
+  const uint32_t seconds = (uint32_t)ntp_time;
+  const uint32_t fraction = (ntp_time - floor(ntp_time))*4294967296.0;
+  for(int idx = 0; idx < 4; ++idx)
+  {
+    data[idx] = seconds >> (24 - 8*idx);
+    data[idx+4] = fraction >> (24 - 8*idx);
+  }
+}
+
+//stand-in SNTP server. Loopback is instant, so the network delay is
+//simulated: a request is held until it would have arrived, and the reply
+//is stamped with the time it is sent.
+class c_server
+{
+  public:
+  int fd;
+  sockaddr_in address;
+  int requests = 0;
+  uint8_t request[48];
+  sockaddr_in client;
+  uint64_t arrives_us = 0;
+  bool pending = false;
+  uint64_t replied_us = 0;
+
+  c_server(){fd = bind_socket(address);}
+  ~c_server(){close(fd);}
+
+  void serve()
+  {
+    socklen_t length = sizeof(client);
+    if(!pending && recvfrom(fd, request, sizeof(request), MSG_DONTWAIT, (sockaddr*)&client, &length) == 48)
+    {
+      requests++;
+      pending = true;
+      arrives_us = true_us + network_delay*1.0e6;
+    }
+
+    if(pending && true_us >= arrives_us)
+    {
+      uint8_t reply[48] = {0};
+      reply[0] = 0b00100100; //version 4, server
+      reply[1] = 2; //stratum
+      memcpy(reply + 24, request + 40, 8); //originate = client's transmit
+      write_timestamp(reply + 32, true_time());
+      write_timestamp(reply + 40, true_time() + 0.0002);
+      sendto(fd, reply, sizeof(reply), 0, (sockaddr*)&client, sizeof(client));
+      pending = false;
+      replied_us = true_us;
+    }
+  }
+
+  //has the last reply had time to get back to the client
+  bool in_flight() const
+  {
+    return true_us < replied_us + network_delay*1.0e6;
+  }
+};
+
+class c_sntp_clock_udp : public c_sntp_clock
+{
+  public:
+  int fd;
+  sockaddr_in address;
+  sockaddr_in server;
+
+  c_sntp_clock_udp(const sockaddr_in &server_address):server(server_address){fd = bind_socket(address);}
+  ~c_sntp_clock_udp(){close(fd);}
+
+  private:
+  bool udp_send(const uint8_t *packet, uint16_t size)
+  {
+    return sendto(fd, packet, size, 0, (sockaddr*)&server, sizeof(server)) == size;
+  }
+
+  int udp_receive(uint8_t *packet, uint16_t size)
+  {
+    int received = recv(fd, packet, size, MSG_DONTWAIT);
+    return received < 0 ? 0 : received;
+  }
+
+  uint64_t local_us()
+  {
+    return 5000000 + true_us*(1.0 + crystal_error);
+  }
+};
+
+int main()
+{
+  c_server server;
+  c_sntp_clock_udp clock(server.address);
+
+  //step through time 1ms at a time around an exchange, faster in between
+  true_us = 0;
+  double worst_error_settled = 0.0;
+  double last_time = 0.0;
+  bool monotonic = true;
+  const uint64_t hours = 12;
+  for(; true_us < hours*3600*1000000ull; true_us += (clock.is_waiting() || server.pending) ? 1000 : 100000)
+  {
+    server.serve();
+    if(!server.in_flight()) clock.poll();
+
+    if(!clock.is_synchronised()) continue;
+    const double now = clock.time();
+    if(last_time != 0.0 && now <= last_time) monotonic = false;
+    last_time = now;
+    const bool slewing = true_us >= step_at_us && true_us < step_at_us + 3600*1000000ull;
+    if(true_us > 2*3600*1000000ull && !slewing) worst_error_settled = fmax(worst_error_settled, fabs(now - true_time()));
+  }
+
+  printf("%d requests in %u hours, poll interval %us, offset %.6fs, delay %.6fs\n",
+    server.requests, (unsigned)hours, clock.poll_interval(), clock.last_offset(), clock.last_delay());
+  check("clock error once settled", worst_error_settled, 0.002);
+  check("frequency error (ppm)", clock.frequency_ppm() + crystal_error*1.0e6, 1.0);
+  check("measured delay error", clock.last_delay() - 2*network_delay, 0.001);
+  check("poll interval short of max", (double)(c_sntp_clock::max_poll_interval - clock.poll_interval()), 1.0);
+  check("time went backwards", monotonic?0.0:1.0, 0.5);
+
+  return failures;
+}
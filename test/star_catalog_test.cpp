@@ -0,0 +1,144 @@
+//Read a tiled star catalog through c_star_catalog's cache, from a file held
+//in memory but not mapped, so every tile goes through the cache or is
+//streamed like it would be from LittleFS on the device
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../pico_planetarium/star_catalog.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool pass)
+{
+  printf("%-40s %s\n", name, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+class c_memory_catalog : public c_star_catalog
+{
+  public:
+  c_memory_catalog(uint32_t cache_size, const std::vector<uint8_t> &file):c_star_catalog(cache_size), file(file){}
+  uint32_t reads = 0;
+
+  private:
+  bool file_open(const char* filename){position = 0; return true;}
+  void file_close(){}
+
+  void file_read(void* data, uint32_t element_size, uint32_t num_elements)
+  {
+    memcpy(data, file.data() + position, element_size*num_elements);
+    position += element_size*num_elements;
+    reads++;
+  }
+
+  void file_seek(uint32_t offset){position = offset;}
+
+  const std::vector<uint8_t> &file;
+  uint32_t position = 0;
+};
+
+//tile t holds sizes[t] stars, star n of tile t has x = t and y = n, and
+//magnitudes get fainter along the tile as make_star_tiles.py sorts them
+static std::vector<uint8_t> make_catalog(const std::vector<uint32_t> &sizes)
+{
+  std::vector<uint8_t> file;
+  uint32_t num_stars = 0;
+  for(uint32_t size : sizes) num_stars += size;
+  s_catalog_header header = {{'P', 'S', 'T', 'C'}, 1, (uint16_t)sizes.size(), num_stars};
+  file.insert(file.end(), (uint8_t*)&header, (uint8_t*)(&header + 1));
+
+  uint32_t offset = sizeof(header) + sizes.size()*sizeof(s_catalog_tile);
+  for(uint32_t size : sizes)
+  {
+    s_catalog_tile tile = {0.0f, 0.0f, 1.0f, -1.0f, 0.0f, offset, size};
+    file.insert(file.end(), (uint8_t*)&tile, (uint8_t*)(&tile + 1));
+    offset += size*sizeof(s_catalog_star);
+  }
+  for(uint16_t t = 0; t < sizes.size(); ++t)
+  {
+    for(uint32_t n = 0; n < sizes[t]; ++n)
+    {
+      s_catalog_star star = {(int16_t)t, (int16_t)n, 0, (uint8_t)(n*255/sizes[t]), 30};
+      file.insert(file.end(), (uint8_t*)&star, (uint8_t*)(&star + 1));
+    }
+  }
+  return file;
+}
+
+//read a whole tile a chunk at a time, false if any star is missing or out of order
+static bool read_all(c_star_catalog &catalog, uint16_t tile, uint32_t expected)
+{
+  uint32_t first = 0, count;
+  while(const s_catalog_star *stars = catalog.read_tile(tile, first, count))
+  {
+    if(count == 0) return false;
+    for(uint32_t idx = 0; idx < count; ++idx)
+    {
+      if(stars[idx].x != tile || stars[idx].y != (int16_t)(first + idx)) return false;
+    }
+    first += count;
+  }
+  return first == expected;
+}
+
+int main()
+{
+  //the Milky Way tile holds far more stars than fit in its slot
+  const std::vector<uint8_t> file = make_catalog({3000, 100, 5, 0, 400, 100, 100, 100});
+  c_memory_catalog catalog(1024, file);
+  check("open", catalog.open("stars.bin") && catalog.num_tiles() == 8);
+
+  catalog.reserve(2);
+  check("tile larger than its slot", read_all(catalog, 0, 3000));
+  check("faint stars streamed", catalog.stars_streamed() == 3000 - 512);
+  check("small tile", read_all(catalog, 2, 5));
+  check("empty tile", read_all(catalog, 3, 0));
+
+  uint32_t count;
+  check("past the end", !catalog.read_tile(2, 5, count) && count == 0);
+  const s_catalog_star *stars = catalog.read_tile(0, 2999, count);
+  check("last star", stars && count == 1 && stars[0].y == 2999);
+
+  //bright stars come from the cache the second time round
+  catalog.reads = 0;
+  stars = catalog.read_tile(0, 0, count);
+  check("cached band", stars && count == 512 && catalog.reads == 0);
+
+  //every tile in view gets a slot, so a frame never reads a tile twice
+  catalog.reserve(6);
+  const uint16_t view[] = {0, 1, 2, 4, 5, 6};
+  for(uint16_t tile : view) catalog.read_tile(tile, 0, count);
+  catalog.reads = 0;
+  for(uint16_t tile : view) catalog.read_tile(tile, 0, count);
+  check("no evictions within a view", catalog.reads == 0);
+  check("slots shrink to fit the view", catalog.read_tile(4, 0, count) && count == 1024/6);
+  check("rest of a shrunk slot streamed", read_all(catalog, 4, 400));
+
+  //a smaller view keeps the slots it has, until it needs half as many
+  catalog.reads = 0;
+  catalog.reserve(4);
+  for(uint16_t tile : view) catalog.read_tile(tile, 0, count);
+  check("slots kept for a smaller view", catalog.reads == 0);
+  catalog.reserve(2);
+  catalog.read_tile(0, 0, count);
+  check("slots grow for a small view", count == 512);
+
+  //more tiles than the cache can cover, then they take turns
+  catalog.reserve(8);
+  for(uint16_t tile = 0; tile < 8; ++tile) catalog.read_tile(tile, 0, count);
+  catalog.reads = 0;
+  for(uint16_t tile = 0; tile < 8; ++tile) catalog.read_tile(tile, 0, count);
+  check("whole sky in view", catalog.reads == 0 && read_all(catalog, 0, 3000));
+
+  //with no cache at all everything is streamed
+  c_memory_catalog uncached(0, file);
+  uncached.open("stars.bin");
+  uncached.reserve(8);
+  check("no cache", read_all(uncached, 0, 3000) && read_all(uncached, 4, 400));
+  check("all streamed", uncached.stars_streamed() == 3400);
+
+  catalog.close();
+  check("close", !catalog.is_open());
+  return failures;
+}
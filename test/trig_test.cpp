@@ -0,0 +1,55 @@
+//Check the fast trig functions against libm and the error bounds
+//documented in fast_trig.cpp
+
+#include <cmath>
+#include <cstdio>
+#include "../pico_planetarium/fast_trig.h"
+
+static int failures = 0;
+
+static void check(const char *name, double max_error, double bound)
+{
+  bool pass = max_error < bound;
+  printf("%-12s max error %.3g (bound %.3g) %s\n", name, max_error, bound, pass?"PASS":"FAIL");
+  if(!pass) failures++;
+}
+
+int main()
+{
+  const double to_radians = M_PI/180.0;
+  double sin_error = 0, cos_error = 0, tan_error = 0, atan2_error = 0, asin_error = 0;
+
+  for(double degrees = -720.0; degrees <= 720.0; degrees += 0.0137)
+  {
+    sin_error = fmax(sin_error, fabs(fast_sind(degrees) - sin(degrees*to_radians)));
+    cos_error = fmax(cos_error, fabs(fast_cosd(degrees) - cos(degrees*to_radians)));
+    if(fabs(cos(degrees*to_radians)) > 0.1)
+    {
+      const double t = tan(degrees*to_radians);
+      tan_error = fmax(tan_error, fabs(fast_tand(degrees) - t)/fmax(1.0, fabs(t)));
+    }
+  }
+
+  for(double angle = -180.0; angle < 180.0; angle += 0.0131)
+  {
+    for(double r = 0.001; r < 1000.0; r *= 10.0)
+    {
+      const double y = r*sin(angle*to_radians);
+      const double x = r*cos(angle*to_radians);
+      atan2_error = fmax(atan2_error, fabs(fast_atan2d(y, x) - atan2(y, x)/to_radians));
+    }
+  }
+
+  for(double x = -0.999; x <= 0.999; x += 0.00007)
+  {
+    asin_error = fmax(asin_error, fabs(fast_asind(x) - asin(x)/to_radians));
+  }
+
+  check("fast_sind", sin_error, 5e-6);
+  check("fast_cosd", cos_error, 5e-6);
+  check("fast_tand", tan_error, 5e-5);
+  check("fast_atan2d", atan2_error, 1e-4);
+  check("fast_asind", asin_error, 1e-4);
+
+  return failures;
+}